@@ -23,6 +23,7 @@
 
 #include "Seldon.hxx"
 #include "SeldonComplexMatrixHeader.hxx"
+#include "SeldonSolver.hxx"
 namespace Seldon
 {
   template class MallocAlloc<int>;
@@ -99,6 +100,28 @@ namespace Seldon
                                                size_t index = 0);
 #endif
 
+  // solvers exposed in the Python module
+  template class SparseDirectSolver<double>;
+  template void SparseDirectSolver<double>
+  ::Factorize(Matrix<double, General, RowSparse, MallocAlloc<double> >& A,
+              bool keep_matrix);
+
+  template class Iteration<double>;
+  template int Cg(const Matrix<double, General, RowSparse, MallocAlloc<double> >& A,
+                  Vector<double, VectFull, MallocAlloc<double> >& x,
+                  const Vector<double, VectFull, MallocAlloc<double> >& b,
+                  Preconditioner_Base<double>& M, Iteration<double>& iter);
+  template int BiCgStab(const Matrix<double, General, RowSparse, MallocAlloc<double> >& A,
+                        Vector<double, VectFull, MallocAlloc<double> >& x,
+                        const Vector<double, VectFull, MallocAlloc<double> >& b,
+                        Preconditioner_Base<double>& M, Iteration<double>& iter);
+#ifdef SELDON_WITH_BLAS
+  template int Gmres(const Matrix<double, General, RowSparse, MallocAlloc<double> >& A,
+                     Vector<double, VectFull, MallocAlloc<double> >& x,
+                     const Vector<double, VectFull, MallocAlloc<double> >& b,
+                     Preconditioner_Base<double>& M, Iteration<double>& iter);
+#endif
+
   INSTANCE_BEGIN_LOOP(ColSymComplexSparse)
   INSTANCE_BEGIN_LOOP(RowMajor)
   INSTANCE_END_LOOP(RowMajor)
@@ -24,6 +24,8 @@
 #include "SeldonInline.hxx"
 
 #include "share/Allocator.cxx"
+#include "share/MemoryPool.cxx"
+#include "share/Parallel.cxx"
 
 #ifndef SELDON_WITH_COMPILED_LIBRARY
 #include "share/Common.cxx"
@@ -48,13 +50,19 @@
 #include "vector/VectorCollection.cxx"
 #include "vector/Functions_Arrays.cxx"
 #include "vector/SparseVector.cxx"
+#include "vector/TinyVector.cxx"
+#include "matrix/TinyMatrix.cxx"
+#include "matrix/MatrixBatch.cxx"
 #include "matrix/Functions.cxx"
 #include "matrix_sparse/IOMatrixMarket.cxx"
 #include "matrix_sparse/Matrix_Conversions.cxx"
 #include "computation/basic_functions/Functions_Matrix.cxx"
 #include "computation/basic_functions/Functions_Vector.cxx"
+#include "computation/basic_functions/Functions_VectorSimd.cxx"
+#include "computation/basic_functions/Functions_VectorReproducible.cxx"
 #include "computation/basic_functions/Functions_MatVect.cxx"
 #include "computation/basic_functions/Functions_Base.cxx"
+#include "computation/basic_functions/Functions_Eigenvalues.cxx"
 
 // Blas interface.
 #ifdef SELDON_WITH_BLAS
@@ -21,6 +21,7 @@
 
 #include <iostream>
 #include <algorithm>
+#include <utility>
 #include <vector>
 #include <complex>
 #include <cstring>
@@ -33,6 +34,10 @@
 #include <exception>
 #include <stdexcept>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 // For the compiled library.
 #ifdef SELDON_WITH_COMPILED_LIBRARY
 #define SELDON_EXTERN extern
@@ -45,6 +50,13 @@
 #define SELDON_WITH_BLAS
 #endif
 
+// Move constructors and move assignments (C++11).
+#if __cplusplus >= 201103L && !defined(SWIG) && !defined(SELDON_WITHOUT_CPP11)
+#ifndef SELDON_WITH_CPP11
+#define SELDON_WITH_CPP11
+#endif
+#endif
+
 #ifdef SELDON_WITH_BLAS
 extern "C"
 {
@@ -163,6 +175,7 @@ namespace Seldon
 // Exceptions and useful functions.
 #include "share/Errors.hxx"
 #include "share/Common.hxx"
+#include "share/BFloat16.hxx"
 
 // Default allocator.
 #ifndef SELDON_DEFAULT_ALLOCATOR
@@ -171,6 +184,9 @@ namespace Seldon
 // Memory management.
 #include "share/Allocator.hxx"
 #include "share/DefaultAllocator.hxx"
+#include "share/MemoryPool.hxx"
+#include "share/Parallel.hxx"
+#include "share/Profiler.hxx"
 
 // Storage type.
 #include "share/Storage.hxx"
@@ -207,6 +223,10 @@ namespace Seldon
   template <class T, class Allocator>
   class Vector<T, Collection, Allocator>;
 
+  // Vector expression (see vector/VectorExpression.hxx).
+  template <class T, class E>
+  class VectorExpression;
+
   // Matrix class - specialized for each used type.
   template <class T, class Prop = General,
 	    class Storage = RowMajor,
@@ -315,17 +335,24 @@ const int ARRAY_MAXRANK = 9;
 #include "matrix/Matrix_TriangPacked.hxx"
 #include "vector/Vector.hxx"
 #include "vector/SparseVector.hxx"
+#include "vector/TinyVector.hxx"
+#include "matrix/TinyMatrix.hxx"
+#include "matrix/MatrixBatch.hxx"
 #include "vector/Functions_Arrays.hxx"
 #include "matrix/Functions.hxx"
 #include "matrix_sparse/IOMatrixMarket.hxx"
 #include "matrix_sparse/Matrix_Conversions.hxx"
 #include "computation/basic_functions/Functions_Vector.hxx"
+#include "computation/basic_functions/Functions_VectorReproducible.hxx"
+#include "computation/basic_functions/Functions_VectorSimd.hxx"
 #include "computation/basic_functions/Functions_MatVect.hxx"
 #include "computation/basic_functions/Functions_Matrix.hxx"
 #include "computation/basic_functions/Functions_Base.hxx"
+#include "computation/basic_functions/Functions_Eigenvalues.hxx"
 
 #include "matrix/SubMatrix_Base.hxx"
 #include "matrix/SubMatrix.hxx"
+#include "matrix/StridedSubMatrix.hxx"
 
 // Blas interface.
 #ifdef SELDON_WITH_BLAS
@@ -21,9 +21,13 @@
 
 
 #include "share/CommonInline.cxx"
+#include "share/BFloat16Inline.cxx"
 
 // Memory management.
 #include "share/AllocatorInline.cxx"
+#include "share/MemoryPoolInline.cxx"
+#include "share/ParallelInline.cxx"
+#include "share/ProfilerInline.cxx"
 
 // Storage type.
 #include "share/StorageInline.cxx"
@@ -45,11 +49,17 @@
 #include "vector/VectorInline.cxx"
 #include "vector/VectorCollectionInline.cxx"
 #include "vector/SparseVectorInline.cxx"
+#include "vector/TinyVectorInline.cxx"
+#include "matrix/TinyMatrixInline.cxx"
+#include "matrix/MatrixBatchInline.cxx"
 
 #include "matrix/SubMatrix_BaseInline.cxx"
 #include "matrix/SubMatrixInline.cxx"
+#include "matrix/StridedSubMatrixInline.cxx"
 
 #include "computation/basic_functions/Functions_BaseInline.cxx"
+#include "computation/basic_functions/Functions_VectorSimdInline.cxx"
+#include "computation/basic_functions/Functions_VectorReproducibleInline.cxx"
 
 #define SELDON_FILE_SELDON_INLINE_HXX
 #endif
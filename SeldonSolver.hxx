@@ -28,6 +28,7 @@
 #include "matrix_sparse/Matrix_ArraySparse.cxx"
 #include "matrix_sparse/Permutation_ScalingMatrix.cxx"
 #include "matrix_sparse/Relaxation_MatVect.cxx"
+#include "matrix_sparse/Matrix_ReducedPrecision.cxx"
 #include "matrix_sparse/Functions_MatrixArray.cxx"
 
 
@@ -63,7 +64,10 @@
 #endif
 
 #include "computation/solver/Ordering.cxx"
+#include "computation/solver/TriangularLevelSet.cxx"
 #include "computation/solver/SparseSolver.cxx"
+#include "computation/solver/OutOfCoreStorage.cxx"
+#include "computation/solver/SparseSupernodalSolver.cxx"
 #include "computation/interfaces/direct/SparseDirectSolver.cxx"
 
 // iterative solvers and preconditioning
@@ -93,11 +97,22 @@
 #include "computation/interfaces/eigenvalue/Feast.cxx"
 #endif
 
+#ifdef SELDON_WITH_LAPACK
+#include "computation/interfaces/eigenvalue/NativeEigenvalueSolver.cxx"
+#endif
+
 #ifdef SELDON_WITH_VIRTUAL
 #include "computation/interfaces/eigenvalue/VirtualEigenvalueSolver.cxx"
 #else
 #include "computation/interfaces/eigenvalue/EigenvalueSolver.cxx"
 #endif
 
+// explicit instantiations provided by the compiled library
+#ifdef SELDON_WITH_COMPILED_LIBRARY
+#include "lib/MatrixSparse.cpp"
+#include "lib/MatrixConversions.cpp"
+#include "lib/Solver.cpp"
+#endif
+
 #define SELDON_FILE_SELDON_SOLVER_HXX
 #endif
@@ -25,13 +25,19 @@
 #include "matrix_sparse/Matrix_ArraySparse.hxx"
 #include "matrix_sparse/Permutation_ScalingMatrix.hxx"
 #include "matrix_sparse/Relaxation_MatVect.hxx"
+#include "matrix_sparse/Matrix_ReducedPrecision.hxx"
 #include "matrix_sparse/Functions_MatrixArray.hxx"
 
 // iterative solvers and preconditioning
 #include "computation/solver/iterative/Iterative.hxx"
 
+// level-set triangular solves
+#include "computation/solver/TriangularLevelSet.hxx"
+
 // interfaces with direct solvers
 #include "computation/solver/SparseSolver.hxx"
+#include "computation/solver/OutOfCoreStorage.hxx"
+#include "computation/solver/SparseSupernodalSolver.hxx"
 
 #ifdef SELDON_WITH_MUMPS
 #include "computation/interfaces/direct/Mumps.hxx"
@@ -90,5 +96,9 @@
 #include "computation/interfaces/eigenvalue/EigenvalueSolver.hxx"
 #endif
 
+#ifdef SELDON_WITH_LAPACK
+#include "computation/interfaces/eigenvalue/NativeEigenvalueSolver.hxx"
+#endif
+
 #define SELDON_FILE_SELDON_SOLVER_HEADER_HXX
 #endif
@@ -21,12 +21,16 @@
 #ifndef SELDON_FILE_SELDON_SOLVER_INLINE_HXX
 
 #include "matrix_sparse/Matrix_ArraySparseInline.cxx"
+#include "matrix_sparse/Matrix_ReducedPrecisionInline.cxx"
 
 #ifdef SELDON_WITH_PRECONDITIONING
 #include "SeldonPreconditionerInline.hxx"
 #endif
 
+#include "computation/solver/TriangularLevelSetInline.cxx"
 #include "computation/solver/SparseSolverInline.cxx"
+#include "computation/solver/OutOfCoreStorageInline.cxx"
+#include "computation/solver/SparseSupernodalSolverInline.cxx"
 #include "computation/interfaces/direct/SparseDirectSolverInline.cxx"
 
 // iterative solvers and preconditioning
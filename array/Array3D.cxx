@@ -476,10 +476,10 @@ namespace Seldon
 
     if (with_size)
       {
-	int new_l1, new_l2, new_l3;
-	FileStream.read(reinterpret_cast<char*>(&new_l1), sizeof(int));
-	FileStream.read(reinterpret_cast<char*>(&new_l2), sizeof(int));
-	FileStream.read(reinterpret_cast<char*>(&new_l3), sizeof(int));
+	size_t new_l1, new_l2, new_l3;
+	FileStream.read(reinterpret_cast<char*>(&new_l1), sizeof(size_t));
+	FileStream.read(reinterpret_cast<char*>(&new_l2), sizeof(size_t));
+	FileStream.read(reinterpret_cast<char*>(&new_l3), sizeof(size_t));
 	Reallocate(new_l1, new_l2, new_l3);
       }
 
@@ -483,6 +483,32 @@ namespace Seldon
 	   const Matrix<T, Prop1, Storage1, Allocator1>& M,
 	   const Vector<complex<T>, Storage2, Allocator2>& X,
 	   Vector<complex<T>, Storage3, Allocator3>& Y);
+
+  // SeldonTrans, SeldonNoTrans and SeldonConjTrans would otherwise be taken
+  // as the scalar alpha of Mlt(alpha, M, X, Y)
+  template<class T1, class Prop1, class Storage1, class Allocator1,
+	   class T2, class Storage2, class Allocator2,
+	   class T3, class Storage3, class Allocator3>
+  void Mlt(const class_SeldonTrans& Trans,
+	   const Matrix<T1, Prop1, Storage1, Allocator1>& M,
+	   const Vector<T2, Storage2, Allocator2>& X,
+	   Vector<T3, Storage3, Allocator3>& Y);
+
+  template<class T1, class Prop1, class Storage1, class Allocator1,
+	   class T2, class Storage2, class Allocator2,
+	   class T3, class Storage3, class Allocator3>
+  void Mlt(const class_SeldonNoTrans& Trans,
+	   const Matrix<T1, Prop1, Storage1, Allocator1>& M,
+	   const Vector<T2, Storage2, Allocator2>& X,
+	   Vector<T3, Storage3, Allocator3>& Y);
+
+  template<class T1, class Prop1, class Storage1, class Allocator1,
+	   class T2, class Storage2, class Allocator2,
+	   class T3, class Storage3, class Allocator3>
+  void Mlt(const class_SeldonConjTrans& Trans,
+	   const Matrix<T1, Prop1, Storage1, Allocator1>& M,
+	   const Vector<T2, Storage2, Allocator2>& X,
+	   Vector<T3, Storage3, Allocator3>& Y);
   
   template<class T,
 	   class Prop1, class Storage1, class Allocator1,
@@ -270,6 +270,42 @@ namespace Seldon
     throw WrongArgument("Mlt", "Incompatible matrix-vector product");
   }
 
+
+  template<class T1, class Prop1, class Storage1, class Allocator1,
+	   class T2, class Storage2, class Allocator2,
+	   class T3, class Storage3, class Allocator3>
+  inline void Mlt(const class_SeldonTrans& Trans,
+		  const Matrix<T1, Prop1, Storage1, Allocator1>& M,
+		  const Vector<T2, Storage2, Allocator2>& X,
+		  Vector<T3, Storage3, Allocator3>& Y)
+  {
+    Mlt(static_cast<const SeldonTranspose&>(Trans), M, X, Y);
+  }
+
+
+  template<class T1, class Prop1, class Storage1, class Allocator1,
+	   class T2, class Storage2, class Allocator2,
+	   class T3, class Storage3, class Allocator3>
+  inline void Mlt(const class_SeldonNoTrans& Trans,
+		  const Matrix<T1, Prop1, Storage1, Allocator1>& M,
+		  const Vector<T2, Storage2, Allocator2>& X,
+		  Vector<T3, Storage3, Allocator3>& Y)
+  {
+    Mlt(static_cast<const SeldonTranspose&>(Trans), M, X, Y);
+  }
+
+
+  template<class T1, class Prop1, class Storage1, class Allocator1,
+	   class T2, class Storage2, class Allocator2,
+	   class T3, class Storage3, class Allocator3>
+  inline void Mlt(const class_SeldonConjTrans& Trans,
+		  const Matrix<T1, Prop1, Storage1, Allocator1>& M,
+		  const Vector<T2, Storage2, Allocator2>& X,
+		  Vector<T3, Storage3, Allocator3>& Y)
+  {
+    Mlt(static_cast<const SeldonTranspose&>(Trans), M, X, Y);
+  }
+
 #ifdef SELDON_WITH_REDUCED_TEMPLATE
   template <class T, class Prop1, class Storage1, class Allocator1,
 	    class Storage2, class Allocator2,
@@ -0,0 +1,1349 @@
+// Copyright (C) 2016 INRIA
+//
+// This file is part of the linear-algebra library Seldon,
+// http://seldon.sourceforge.net/.
+//
+// Seldon is free software; you can redistribute it and/or modify it under the
+// terms of the GNU Lesser General Public License as published by the Free
+// Software Foundation; either version 2.1 of the License, or (at your option)
+// any later version.
+//
+// Seldon is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for
+// more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with Seldon. If not, see http://www.gnu.org/licenses/.
+
+
+#ifndef SELDON_FILE_FUNCTIONS_EIGENVALUES_CXX
+
+
+#include "Functions_Eigenvalues.hxx"
+
+
+namespace Seldon
+{
+
+
+  ////////////////////////////
+  // HOUSEHOLDER REFLECTORS //
+
+
+  //! generates an elementary reflector H = I - tau v v^H
+  /*!
+    On entry, x contains the vector (alpha, x_1, ..., x_{n-1}), on exit x
+    contains v (with v_0 = 1) such that H^H x = (beta, 0, ..., 0), beta being
+    real. If x is already in this form, tau is equal to 0 (H = I).
+  */
+  template<class T>
+  void GenerateHouseholder(int n, T* x, T& tau,
+			   typename ClassComplexType<T>::Treal& beta)
+  {
+    typedef typename ClassComplexType<T>::Treal Treal;
+
+    T alpha = x[0];
+    Treal xnorm(0);
+    for (int i = 1; i < n; i++)
+      xnorm += absSquare(x[i]);
+
+    Treal alpha_real = realpart(alpha);
+    if ((xnorm == Treal(0)) && (alpha == T(alpha_real)))
+      {
+	SetComplexZero(tau);
+	beta = alpha_real;
+	SetComplexOne(x[0]);
+	return;
+      }
+
+    beta = sqrt(absSquare(alpha) + xnorm);
+    if (alpha_real >= Treal(0))
+      beta = -beta;
+
+    tau = (beta - alpha) / beta;
+    T scale = T(1) / (alpha - beta);
+    for (int i = 1; i < n; i++)
+      x[i] *= scale;
+
+    SetComplexOne(x[0]);
+  }
+
+
+  //! applies Q = H_0 H_1 ... H_{nref-1} (or Q^H) to the columns of Z
+  /*!
+    The reflector H_k = I - tau_k v_k v_k^H is stored in the column k of V
+    (leading dimension ldv), v_k(i) being equal to 0 for i < k + offset, and
+    to 1 for i = k + offset (this value is not read). Z is a m x ncol matrix
+    stored by columns. The reflectors are applied by blocks with the compact
+    WY representation Q_b = I - V_b T_b V_b^H, the columns of Z being treated
+    in parallel.
+  */
+  template<class T>
+  void ApplyHouseholderBlocks(int m, int nref, int offset, const T* V,
+			      int ldv, const T* tau, bool conj_trans,
+			      int ncol, T* Z, int ldz)
+  {
+    const int nb_block = 32;
+    int nb_blocks = (nref + nb_block - 1) / nb_block;
+    Matrix<T, General, ColMajor> Tb(nb_block, nb_block);
+    Vector<T> tmp(nb_block);
+    T zero;
+    SetComplexZero(zero);
+    for (int b0 = 0; b0 < nb_blocks; b0++)
+      {
+	// Q^H = Q_0^H Q_1^H ... is applied from the first block,
+	// Q = ... Q_{nb-2} Q_{nb-1} from the last one
+	int b = conj_trans ? b0 : nb_blocks - 1 - b0;
+	int k0 = b * nb_block;
+	int kb = min(nb_block, nref - k0);
+
+	// triangular factor of the block
+	Tb.Fill(zero);
+	for (int i = 0; i < kb; i++)
+	  {
+	    int si = k0 + i + offset;
+	    const T* vi = &V[(k0 + i)*ldv];
+	    for (int j = 0; j < i; j++)
+	      {
+		const T* vj = &V[(k0 + j)*ldv];
+		T s = conjugate(vj[si]);
+		for (int r = si + 1; r < m; r++)
+		  s += conjugate(vj[r]) * vi[r];
+
+		tmp(j) = -tau[k0 + i] * s;
+	      }
+
+	    for (int j = 0; j < i; j++)
+	      {
+		T s = zero;
+		for (int l = j; l < i; l++)
+		  s += Tb(j, l) * tmp(l);
+
+		Tb(j, i) = s;
+	      }
+
+	    Tb(i, i) = tau[k0 + i];
+	  }
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) \
+  num_threads(ParallelContext::GetNumThreads(ncol, 16))
+#endif
+	for (int j = 0; j < ncol; j++)
+	  {
+	    T* z = &Z[j*ldz];
+	    Vector<T> y(kb);
+
+	    // y = V^H z
+	    for (int i = 0; i < kb; i++)
+	      {
+		int si = k0 + i + offset;
+		const T* vi = &V[(k0 + i)*ldv];
+		T s = z[si];
+		for (int r = si + 1; r < m; r++)
+		  s += conjugate(vi[r]) * z[r];
+
+		y(i) = s;
+	      }
+
+	    // y = T y or T^H y
+	    if (conj_trans)
+	      for (int i = kb - 1; i >= 0; i--)
+		{
+		  T s = zero;
+		  for (int l = 0; l <= i; l++)
+		    s += conjugate(Tb(l, i)) * y(l);
+
+		  y(i) = s;
+		}
+	    else
+	      for (int i = 0; i < kb; i++)
+		{
+		  T s = zero;
+		  for (int l = i; l < kb; l++)
+		    s += Tb(i, l) * y(l);
+
+		  y(i) = s;
+		}
+
+	    // z = z - V y
+	    for (int i = 0; i < kb; i++)
+	      {
+		int si = k0 + i + offset;
+		const T* vi = &V[(k0 + i)*ldv];
+		z[si] -= y(i);
+		for (int r = si + 1; r < m; r++)
+		  z[r] -= vi[r] * y(i);
+	      }
+	  }
+      }
+  }
+
+
+  //! reduction of a hermitian matrix to a real tridiagonal matrix
+  /*!
+    A is a full hermitian matrix (both triangles are stored), it is reduced
+    to T = Q^H A Q, with Q = H_0 H_1 ... H_{n-2}. On exit, d contains the
+    diagonal of T, e its subdiagonal, and the reflector H_k is stored in the
+    column k of A (rows k+1 to n-1). The reduction is blocked as in Lapack
+    (xLATRD): the reflectors of a panel are accumulated and the trailing
+    matrix is updated with a rank-2k update, in parallel over the columns.
+  */
+  template<class T>
+  void ReduceHermitianTridiagonal(Matrix<T, General, ColMajor>& A,
+				  Vector<typename ClassComplexType<T>::Treal>& d,
+				  Vector<typename ClassComplexType<T>::Treal>& e,
+				  Vector<T>& tau)
+  {
+    typedef typename ClassComplexType<T>::Treal Treal;
+
+    int n = A.GetM();
+    d.Reallocate(n);
+    e.Reallocate(max(n-1, 0));
+    tau.Reallocate(max(n-1, 0));
+    if (n == 0)
+      return;
+
+    T zero;
+    SetComplexZero(zero);
+    T* a = A.GetData();
+    const int nb_block = 32;
+    Matrix<T, General, ColMajor> W(n, nb_block);
+    T* w = W.GetData();
+    Vector<T> t1(nb_block), t2(nb_block);
+    for (int k0 = 0; k0 < n-1; k0 += nb_block)
+      {
+	int kb = min(nb_block, n-1-k0);
+	W.Fill(zero);
+	for (int jj = 0; jj < kb; jj++)
+	  {
+	    int k = k0 + jj;
+	    T* ak = &a[k*n];
+
+	    // previous reflectors of the panel are applied to the column k
+	    for (int p = 0; p < jj; p++)
+	      {
+		const T* vp = &a[(k0 + p)*n];
+		const T* wp = &w[p*n];
+		T cw = conjugate(wp[k]), cv = conjugate(vp[k]);
+		for (int i = k; i < n; i++)
+		  ak[i] -= vp[i] * cw + wp[i] * cv;
+	      }
+
+	    d(k) = realpart(ak[k]);
+	    ak[k] = d(k);
+
+	    // reflector annihilating A(k+2:n, k)
+	    GenerateHouseholder(n-k-1, &ak[k+1], tau(k), e(k));
+
+	    // w = A22 v (A22 before the update of the panel)
+	    T* wk = &w[jj*n];
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) \
+  num_threads(ParallelContext::GetNumThreads(n - k - 1, 16))
+#endif
+	    for (int i = k+1; i < n; i++)
+	      {
+		const T* ai = &a[i*n];
+		T s = zero;
+		for (int j = k+1; j < n; j++)
+		  s += conjugate(ai[j]) * ak[j];
+
+		wk[i] = s;
+	      }
+
+	    // w = w - V W^H v - W V^H v
+	    for (int p = 0; p < jj; p++)
+	      {
+		const T* vp = &a[(k0 + p)*n];
+		const T* wp = &w[p*n];
+		T s1 = zero, s2 = zero;
+		for (int r = k+1; r < n; r++)
+		  {
+		    s1 += conjugate(wp[r]) * ak[r];
+		    s2 += conjugate(vp[r]) * ak[r];
+		  }
+
+		t1(p) = s1;
+		t2(p) = s2;
+	      }
+
+	    for (int r = k+1; r < n; r++)
+	      {
+		T s = wk[r];
+		for (int p = 0; p < jj; p++)
+		  s -= a[(k0 + p)*n + r] * t1(p) + w[p*n + r] * t2(p);
+
+		wk[r] = tau(k) * s;
+	      }
+
+	    // w = w - 1/2 tau (w^H v) v
+	    T s = zero;
+	    for (int r = k+1; r < n; r++)
+	      s += conjugate(wk[r]) * ak[r];
+
+	    T alpha = -Treal(0.5) * tau(k) * s;
+	    for (int r = k+1; r < n; r++)
+	      wk[r] += alpha * ak[r];
+	  }
+
+	// trailing matrix : A22 = A22 - V W^H - W V^H
+	int j0 = k0 + kb;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) \
+  num_threads(ParallelContext::GetNumThreads(n - j0, 16))
+#endif
+	for (int j = j0; j < n; j++)
+	  {
+	    T* aj = &a[j*n];
+	    for (int p = 0; p < kb; p++)
+	      {
+		const T* vp = &a[(k0 + p)*n];
+		const T* wp = &w[p*n];
+		T cw = conjugate(wp[j]), cv = conjugate(vp[j]);
+		for (int i = j0; i < n; i++)
+		  aj[i] -= vp[i] * cw + wp[i] * cv;
+	      }
+	  }
+      }
+
+    d(n-1) = realpart(a[(n-1)*n + n-1]);
+  }
+
+
+  //! QR factorization A = Q R with Householder reflectors
+  /*!
+    On exit, R is stored in the upper part of A, the reflector H_k in the
+    column k of A (below the diagonal) and Q = H_0 H_1 ... H_{p-1} with
+    p = min(m, n). The factorization is blocked: the reflectors of a panel
+    are applied to the trailing columns with ApplyHouseholderBlocks.
+  */
+  template<class T>
+  void GetHouseholderQR(Matrix<T, General, ColMajor>& A, Vector<T>& tau)
+  {
+    typedef typename ClassComplexType<T>::Treal Treal;
+
+    int m = A.GetM(), n = A.GetN();
+    int nref = min(m, n);
+    tau.Reallocate(nref);
+    T* a = A.GetData();
+    const int nb_block = 32;
+    for (int k0 = 0; k0 < nref; k0 += nb_block)
+      {
+	int kb = min(nb_block, nref - k0);
+	for (int k = k0; k < k0 + kb; k++)
+	  {
+	    T* ak = &a[k*m];
+	    Treal beta;
+	    GenerateHouseholder(m - k, &ak[k], tau(k), beta);
+
+	    // H_k^H is applied to the next columns of the panel
+	    T ctau = conjugate(tau(k));
+	    for (int j = k+1; j < k0 + kb; j++)
+	      {
+		T* aj = &a[j*m];
+		T s = aj[k];
+		for (int r = k+1; r < m; r++)
+		  s += conjugate(ak[r]) * aj[r];
+
+		s *= ctau;
+		aj[k] -= s;
+		for (int r = k+1; r < m; r++)
+		  aj[r] -= ak[r] * s;
+	      }
+
+	    ak[k] = beta;
+	  }
+
+	if (k0 + kb < n)
+	  ApplyHouseholderBlocks(m, kb, k0, &a[k0*m], m, &tau(k0), true,
+				 n - k0 - kb, &a[(k0 + kb)*m], m);
+      }
+  }
+
+
+  // HOUSEHOLDER REFLECTORS //
+  ////////////////////////////
+
+
+  ///////////////////////////////
+  // SYMMETRIC TRIDIAGONAL EIG //
+
+
+  //! eigenvalues of a symmetric tridiagonal matrix with implicit QL
+  /*!
+    d contains the diagonal, e the subdiagonal (e has n elements, the last
+    one being used as workspace). On exit, d contains the eigenvalues in
+    ascending order. If z is not NULL, the columns of z (leading dimension
+    ldz) are rotated, so that z contains the eigenvectors if it is equal to
+    the identity on entry. Returns false if the algorithm did not converge.
+  */
+  template<class T>
+  bool SolveTridiagonalQL(int n, T* d, T* e, T* z, int ldz)
+  {
+    if (n <= 1)
+      return true;
+
+    T eps = numeric_limits<T>::epsilon();
+    e[n-1] = T(0);
+    for (int l = 0; l < n; l++)
+      {
+	int iter = 0, m;
+	do
+	  {
+	    for (m = l; m < n-1; m++)
+	      if (abs(e[m]) <= eps * (abs(d[m]) + abs(d[m+1])))
+		break;
+
+	    if (m != l)
+	      {
+		if (iter++ == 60)
+		  return false;
+
+		// implicit shift
+		T g = (d[l+1] - d[l]) / (T(2) * e[l]);
+		T r = sqrt(g*g + T(1));
+		g = d[m] - d[l] + e[l] / (g + (g >= T(0) ? r : -r));
+		T s(1), c(1), p(0);
+		bool underflow = false;
+		for (int i = m-1; i >= l; i--)
+		  {
+		    T f = s * e[i], b = c * e[i];
+		    r = sqrt(f*f + g*g);
+		    e[i+1] = r;
+		    if (r == T(0))
+		      {
+			d[i+1] -= p;
+			e[m] = T(0);
+			underflow = true;
+			break;
+		      }
+
+		    s = f / r;
+		    c = g / r;
+		    g = d[i+1] - p;
+		    r = (d[i] - g) * s + T(2) * c * b;
+		    p = s * r;
+		    d[i+1] = g + p;
+		    g = c * r - b;
+
+		    if (z != NULL)
+		      {
+			T* zi = &z[i*ldz];
+			T* zi1 = &z[(i+1)*ldz];
+			for (int k = 0; k < n; k++)
+			  {
+			    f = zi1[k];
+			    zi1[k] = s * zi[k] + c * f;
+			    zi[k] = c * zi[k] - s * f;
+			  }
+		      }
+		  }
+
+		if (underflow)
+		  continue;
+
+		d[l] -= p;
+		e[l] = g;
+		e[m] = T(0);
+	      }
+	  }
+	while (m != l);
+      }
+
+    // eigenvalues are sorted
+    for (int i = 0; i < n-1; i++)
+      {
+	int k = i;
+	T p = d[i];
+	for (int j = i+1; j < n; j++)
+	  if (d[j] < p)
+	    {
+	      k = j;
+	      p = d[j];
+	    }
+
+	if (k != i)
+	  {
+	    d[k] = d[i];
+	    d[i] = p;
+	    if (z != NULL)
+	      for (int r = 0; r < n; r++)
+		swap(z[i*ldz + r], z[k*ldz + r]);
+	  }
+      }
+
+    return true;
+  }
+
+
+  //! root of the secular equation 1 + rho sum z_j^2 / (d_j - lambda) = 0
+  /*!
+    d contains k values in ascending order, rho is positive. The root i
+    lies in ]d_i, d_{i+1}[ (in ]d_{k-1}, d_{k-1} + rho |z|^2] for the last
+    one), it is returned as lambda = d_origin + tau, origin being the closest
+    pole, so that the differences d_j - lambda are computed accurately. The
+    root is found by bisection on tau.
+  */
+  template<class T>
+  void SolveSecularEquation(int k, const T* d, const T* z, T rho,
+			    int i, int& origin, T& tau)
+  {
+    T a, b;
+    if (i < k-1)
+      {
+	T mid = (d[i+1] - d[i]) / T(2);
+	T f(1);
+	for (int j = 0; j < k; j++)
+	  f += rho * z[j] * z[j] / ((d[j] - d[i]) - mid);
+
+	if (f >= T(0))
+	  {
+	    origin = i;
+	    a = T(0);
+	    b = mid;
+	  }
+	else
+	  {
+	    origin = i+1;
+	    a = -mid;
+	    b = T(0);
+	  }
+      }
+    else
+      {
+	origin = k-1;
+	a = T(0);
+	b = T(0);
+	for (int j = 0; j < k; j++)
+	  b += rho * z[j] * z[j];
+      }
+
+    // the secular function is increasing between two poles
+    T d0 = d[origin];
+    for (int iter = 0; iter < 300; iter++)
+      {
+	T c = (a + b) / T(2);
+	if ((c == a) || (c == b))
+	  break;
+
+	T f(1);
+	for (int j = 0; j < k; j++)
+	  f += rho * z[j] * z[j] / ((d[j] - d0) - c);
+
+	if (f > T(0))
+	  b = c;
+	else
+	  a = c;
+      }
+
+    tau = (a + b) / T(2);
+  }
+
+
+  //! merges two eigendecompositions (divide-and-conquer)
+  /*!
+    The columns lo to hi-1 of Z contain the eigenvectors of the two
+    tridiagonal matrices T1 (rows lo to mid-1) and T2 (rows mid to hi-1),
+    d contains their eigenvalues (in ascending order for each matrix). The
+    tridiagonal matrix is equal to diag(T1, T2) + |beta| u u^T with
+    u = (e_{mid-1} + sign(beta) e_mid). On exit, Z and d contain the
+    eigenvectors and eigenvalues of this matrix (in ascending order).
+    Eigenvalues are deflated as in Lapack (xLAED2), the secular equation is
+    solved for the remaining ones and the eigenvectors are computed with the
+    method of Gu and Eisenstat.
+  */
+  template<class T>
+  void MergeTridiagonalDivideConquer(int lo, int mid, int hi, T beta,
+				     Vector<T>& d, Matrix<T, General,
+				     ColMajor>& Z)
+  {
+    int ns = hi - lo, n1 = mid - lo;
+    int N = Z.GetM();
+    T* blk = Z.GetData() + lo + lo*N;
+    T* dl = &d(lo);
+    T rho = abs(beta);
+
+    Vector<T> z(ns);
+    for (int c = 0; c < n1; c++)
+      z(c) = blk[c*N + n1-1];
+
+    for (int c = n1; c < ns; c++)
+      z(c) = beta >= T(0) ? blk[c*N + n1] : -blk[c*N + n1];
+
+    // both lists of eigenvalues are merged
+    Vector<int> perm(ns);
+    int i1 = 0, i2 = n1;
+    for (int k = 0; k < ns; k++)
+      if ((i2 >= ns) || ((i1 < n1) && (dl[i1] <= dl[i2])))
+	perm(k) = i1++;
+      else
+	perm(k) = i2++;
+
+    Vector<int> keep(ns);
+    int nk = 0;
+    if (rho > T(0))
+      {
+	T znorm = Norm2(z);
+	rho *= znorm*znorm;
+	Mlt(T(1) / znorm, z);
+
+	T dmax(0);
+	for (int k = 0; k < ns; k++)
+	  dmax = max(dmax, abs(dl[k]));
+
+	T tol = T(8) * numeric_limits<T>::epsilon() * max(dmax, rho);
+
+	// deflation
+	int prev = -1;
+	for (int k = 0; k < ns; k++)
+	  {
+	    int j = perm(k);
+	    if (rho * abs(z(j)) <= tol)
+	      continue;
+
+	    if (prev < 0)
+	      {
+		prev = j;
+		continue;
+	      }
+
+	    T s = z(prev), c = z(j);
+	    T t = sqrt(c*c + s*s);
+	    T gap = dl[j] - dl[prev];
+	    c /= t;
+	    s = -s / t;
+	    if (abs(gap * c * s) <= tol)
+	      {
+		// close eigenvalues, a rotation zeroes z(prev)
+		z(j) = t;
+		z(prev) = T(0);
+		T* xp = blk + prev*N;
+		T* xj = blk + j*N;
+		for (int r = 0; r < ns; r++)
+		  {
+		    T x = xp[r], y = xj[r];
+		    xp[r] = c*x + s*y;
+		    xj[r] = c*y - s*x;
+		  }
+
+		t = dl[prev]*c*c + dl[j]*s*s;
+		dl[j] = dl[prev]*s*s + dl[j]*c*c;
+		dl[prev] = t;
+	      }
+	    else
+	      keep(nk++) = prev;
+
+	    prev = j;
+	  }
+
+	if (prev >= 0)
+	  keep(nk++) = prev;
+      }
+
+    if (nk > 0)
+      {
+	Vector<T> dk(nk), zk(nk), tau(nk);
+	Vector<int> origin(nk);
+	for (int i = 0; i < nk; i++)
+	  {
+	    dk(i) = dl[keep(i)];
+	    zk(i) = z(keep(i));
+	  }
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) \
+  num_threads(ParallelContext::GetNumThreads(nk, 16))
+#endif
+	for (int i = 0; i < nk; i++)
+	  SolveSecularEquation(nk, dk.GetData(), zk.GetData(), rho,
+			       i, origin(i), tau(i));
+
+	// z is recomputed so that the eigenvectors are orthogonal
+	Vector<T> zhat(nk);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) \
+  num_threads(ParallelContext::GetNumThreads(nk, 16))
+#endif
+	for (int j = 0; j < nk; j++)
+	  {
+	    T prod = (dk(origin(j)) - dk(j)) + tau(j);
+	    for (int i = 0; i < nk; i++)
+	      if (i != j)
+		prod *= ((dk(origin(i)) - dk(j)) + tau(i)) / (dk(i) - dk(j));
+
+	    zhat(j) = sqrt(abs(prod) / rho);
+	    if (zk(j) < T(0))
+	      zhat(j) = -zhat(j);
+	  }
+
+	// eigenvectors of D + rho z z^T
+	Matrix<T, General, ColMajor> S(nk, nk);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) \
+  num_threads(ParallelContext::GetNumThreads(nk, 16))
+#endif
+	for (int i = 0; i < nk; i++)
+	  {
+	    T nrm(0);
+	    for (int j = 0; j < nk; j++)
+	      {
+		S(j, i) = zhat(j) / ((dk(j) - dk(origin(i))) - tau(i));
+		nrm += S(j, i) * S(j, i);
+	      }
+
+	    nrm = T(1) / sqrt(nrm);
+	    for (int j = 0; j < nk; j++)
+	      S(j, i) *= nrm;
+	  }
+
+	// eigenvectors of the tridiagonal matrix
+	Matrix<T, General, ColMajor> G(ns, nk);
+	for (int j = 0; j < nk; j++)
+	  for (int r = 0; r < ns; r++)
+	    G(r, j) = blk[keep(j)*N + r];
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) \
+  num_threads(ParallelContext::GetNumThreads(nk, 16))
+#endif
+	for (int i = 0; i < nk; i++)
+	  {
+	    T* x = blk + keep(i)*N;
+	    for (int r = 0; r < ns; r++)
+	      x[r] = T(0);
+
+	    for (int j = 0; j < nk; j++)
+	      {
+		T s = S(j, i);
+		const T* g = &G(0, j);
+		for (int r = 0; r < ns; r++)
+		  x[r] += s * g[r];
+	      }
+	  }
+
+	for (int i = 0; i < nk; i++)
+	  dl[keep(i)] = dk(origin(i)) + tau(i);
+      }
+
+    // eigenvalues are sorted in ascending order
+    Vector<T> val(ns);
+    Vector<int> order(ns);
+    for (int k = 0; k < ns; k++)
+      {
+	val(k) = dl[k];
+	order(k) = k;
+      }
+
+    Sort(val, order);
+    Matrix<T, General, ColMajor> X(ns, ns);
+    for (int j = 0; j < ns; j++)
+      for (int r = 0; r < ns; r++)
+	X(r, j) = blk[order(j)*N + r];
+
+    for (int j = 0; j < ns; j++)
+      {
+	dl[j] = val(j);
+	for (int r = 0; r < ns; r++)
+	  blk[j*N + r] = X(r, j);
+      }
+  }
+
+
+  //! eigenvalues and eigenvectors of a symmetric tridiagonal matrix
+  /*!
+    d contains the diagonal, e the subdiagonal. The matrix is split
+    recursively (Cuppen's method) until the blocks are small enough to be
+    solved with implicit QL, the eigendecompositions are then merged two by
+    two. Blocks of the same level are processed in parallel. On exit, d
+    contains the eigenvalues in ascending order and Z the eigenvectors.
+    Returns false if the QL algorithm did not converge.
+  */
+  template<class T>
+  bool SolveTridiagonalDivideConquer(Vector<T>& d, Vector<T>& e,
+				     Matrix<T, General, ColMajor>& Z)
+  {
+    int n = d.GetM();
+    Z.Reallocate(n, n);
+    Z.SetIdentity();
+    if (n == 0)
+      return true;
+
+    // binary splitting of [0, n)
+    const int leaf_size = 25;
+    Vector<int> node_lo, node_hi, node_level, leaf_lo, leaf_hi;
+    Vector<int> stack_lo(1), stack_hi(1), stack_level(1);
+    stack_lo(0) = 0;
+    stack_hi(0) = n;
+    stack_level(0) = 0;
+    int max_level = -1;
+    while (stack_lo.GetM() > 0)
+      {
+	int p = stack_lo.GetM() - 1;
+	int lo = stack_lo(p), hi = stack_hi(p), level = stack_level(p);
+	stack_lo.Resize(p);
+	stack_hi.Resize(p);
+	stack_level.Resize(p);
+	if (hi - lo <= leaf_size)
+	  {
+	    leaf_lo.PushBack(lo);
+	    leaf_hi.PushBack(hi);
+	  }
+	else
+	  {
+	    int mid = lo + (hi - lo) / 2;
+	    node_lo.PushBack(lo);
+	    node_hi.PushBack(hi);
+	    node_level.PushBack(level);
+	    max_level = max(max_level, level);
+	    stack_lo.PushBack(lo); stack_hi.PushBack(mid);
+	    stack_level.PushBack(level + 1);
+	    stack_lo.PushBack(mid); stack_hi.PushBack(hi);
+	    stack_level.PushBack(level + 1);
+	  }
+      }
+
+    // rank-one tearing
+    int nb_node = node_lo.GetM();
+    Vector<T> beta(nb_node);
+    for (int k = 0; k < nb_node; k++)
+      {
+	int mid = node_lo(k) + (node_hi(k) - node_lo(k)) / 2;
+	beta(k) = e(mid-1);
+	d(mid-1) -= abs(beta(k));
+	d(mid) -= abs(beta(k));
+      }
+
+    // small blocks
+    int nb_leaf = leaf_lo.GetM();
+    bool converged = true;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) reduction(&&:converged) \
+  num_threads(ParallelContext::GetNumThreads(nb_leaf, 1))
+#endif
+    for (int k = 0; k < nb_leaf; k++)
+      {
+	int lo = leaf_lo(k), nl = leaf_hi(k) - lo;
+	Vector<T> el(nl);
+	for (int i = 0; i < nl-1; i++)
+	  el(i) = e(lo + i);
+
+	if (!SolveTridiagonalQL(nl, &d(lo), el.GetData(), &Z(lo, lo), n))
+	  converged = false;
+      }
+
+    // merges, from the deepest level
+    for (int level = max_level; level >= 0; level--)
+      {
+	Vector<int> list;
+	for (int k = 0; k < nb_node; k++)
+	  if (node_level(k) == level)
+	    list.PushBack(k);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) \
+  num_threads(ParallelContext::GetNumThreads(list.GetM(), 1))
+#endif
+	for (int l = 0; l < int(list.GetM()); l++)
+	  {
+	    int k = list(l);
+	    int lo = node_lo(k), hi = node_hi(k), mid = lo + (hi - lo) / 2;
+	    MergeTridiagonalDivideConquer(lo, mid, hi, beta(k), d, Z);
+	  }
+      }
+
+    return converged;
+  }
+
+
+  // SYMMETRIC TRIDIAGONAL EIG //
+  ///////////////////////////////
+
+
+  //////////////////////////////////////
+  // SYMMETRIC / HERMITIAN EIGENPAIRS //
+
+
+  //! copies the lower part of a hermitian matrix in a full matrix
+  template<class T, class Prop, class Storage, class Allocator>
+  void CopyHermitianNative(const Matrix<T, Prop, Storage, Allocator>& A,
+			   Matrix<T, General, ColMajor>& B)
+  {
+    if (IsComplexMatrix(A) && IsSymmetricMatrix(A))
+      throw WrongArgument("GetEigenvaluesNative",
+			  "Complex symmetric matrices are not hermitian, "
+			  "use a hermitian matrix.");
+
+    int n = A.GetM();
+    B.Reallocate(n, n);
+    for (int j = 0; j < n; j++)
+      {
+	B(j, j) = realpart(A(j, j));
+	for (int i = j+1; i < n; i++)
+	  {
+	    B(i, j) = A(i, j);
+	    B(j, i) = conjugate(B(i, j));
+	  }
+      }
+  }
+
+
+  //! eigenvalues of a symmetric (or hermitian) matrix
+  /*!
+    Only the lower part of A is used. The matrix is reduced to a tridiagonal
+    matrix, whose eigenvalues are computed with implicit QL. On exit, w
+    contains the eigenvalues in ascending order, A is not modified.
+  */
+  template<class T, class Prop, class Storage,
+	   class Allocator1, class Allocator2>
+  void GetEigenvaluesNative(Matrix<T, Prop, Storage, Allocator1>& A,
+			    Vector<typename ClassComplexType<T>::Treal,
+			    VectFull, Allocator2>& w,
+			    LapackInfo& info)
+  {
+    typedef typename ClassComplexType<T>::Treal Treal;
+
+    int n = A.GetM();
+    Matrix<T, General, ColMajor> B;
+    CopyHermitianNative(A, B);
+
+    Vector<Treal> d, e;
+    Vector<T> tau;
+    ReduceHermitianTridiagonal(B, d, e, tau);
+    B.Clear();
+
+    e.Resize(n);
+    bool converged = SolveTridiagonalQL(n, d.GetData(), e.GetData(),
+					static_cast<Treal*>(NULL), n);
+
+    w.Reallocate(n);
+    for (int i = 0; i < n; i++)
+      w(i) = d(i);
+
+    info.GetInfoRef() = converged ? 0 : 1;
+#ifdef SELDON_LAPACK_CHECK_INFO
+    if (info.GetInfo() != 0)
+      throw LapackError(info.GetInfo(), "GetEigenvaluesNative",
+			"Failed to find eigenvalues ");
+#endif
+  }
+
+
+  //! eigenvalues and eigenvectors of a symmetric (or hermitian) matrix
+  /*!
+    Only the lower part of A is used. The matrix is reduced to a tridiagonal
+    matrix (blocked Householder reduction), whose eigenvalues and
+    eigenvectors are computed with a divide-and-conquer method. The
+    eigenvectors of A are then obtained by applying the reflectors by blocks.
+    On exit, w contains the eigenvalues in ascending order and z(i, j) is the
+    component i of the eigenvector j. A is not modified.
+  */
+  template<class T, class Prop, class Storage, class Allocator1,
+	   class Allocator2, class Storage3, class Allocator3>
+  void GetEigenvaluesEigenvectorsNative(Matrix<T, Prop, Storage,
+					Allocator1>& A,
+					Vector<typename ClassComplexType<T>
+					::Treal, VectFull, Allocator2>& w,
+					Matrix<T, General, Storage3,
+					Allocator3>& z,
+					LapackInfo& info)
+  {
+    typedef typename ClassComplexType<T>::Treal Treal;
+
+    int n = A.GetM();
+    Matrix<T, General, ColMajor> B;
+    CopyHermitianNative(A, B);
+
+    Vector<Treal> d, e;
+    Vector<T> tau;
+    ReduceHermitianTridiagonal(B, d, e, tau);
+
+    Matrix<Treal, General, ColMajor> Zr;
+    bool converged = SolveTridiagonalDivideConquer(d, e, Zr);
+
+    Matrix<T, General, ColMajor> X(n, n);
+    for (int j = 0; j < n; j++)
+      for (int i = 0; i < n; i++)
+	X(i, j) = Zr(i, j);
+
+    Zr.Clear();
+    ApplyHouseholderBlocks(n, n-1, 1, B.GetData(), n, tau.GetData(), false,
+			   n, X.GetData(), n);
+
+    w.Reallocate(n);
+    for (int i = 0; i < n; i++)
+      w(i) = d(i);
+
+    z.Reallocate(n, n);
+    for (int j = 0; j < n; j++)
+      for (int i = 0; i < n; i++)
+	z(i, j) = X(i, j);
+
+    info.GetInfoRef() = converged ? 0 : 1;
+#ifdef SELDON_LAPACK_CHECK_INFO
+    if (info.GetInfo() != 0)
+      throw LapackError(info.GetInfo(), "GetEigenvaluesEigenvectorsNative",
+			"Failed to find eigenvalues ");
+#endif
+  }
+
+
+  // SYMMETRIC / HERMITIAN EIGENPAIRS //
+  //////////////////////////////////////
+
+
+  //////////////////////////////////
+  // SINGULAR VALUE DECOMPOSITION //
+
+
+  //! singular value decomposition A = U diag(sigma) V^H for m >= n
+  /*!
+    A is first factorized as A = Q R, the columns of R are then
+    orthogonalized by one-sided Jacobi rotations (R V = U_R diag(sigma)).
+    The pairs of columns are chosen with a round-robin ordering, such that
+    the n/2 rotations of a step are independent and computed in parallel.
+    On exit, sigma contains the singular values in descending order, U is
+    the m x m unitary matrix Q diag(U_R, I) and V is the n x n unitary
+    matrix. A is modified. Returns false if the Jacobi iterations did not
+    converge.
+  */
+  template<class T>
+  bool GetSVDJacobi(Matrix<T, General, ColMajor>& A,
+		    Vector<typename ClassComplexType<T>::Treal>& sigma,
+		    Matrix<T, General, ColMajor>& U,
+		    Matrix<T, General, ColMajor>& V)
+  {
+    typedef typename ClassComplexType<T>::Treal Treal;
+
+    int m = A.GetM(), n = A.GetN();
+    T zero, one;
+    SetComplexZero(zero);
+    SetComplexOne(one);
+
+    Vector<T> tau;
+    GetHouseholderQR(A, tau);
+
+    Matrix<T, General, ColMajor> R(n, n);
+    R.Fill(zero);
+    for (int j = 0; j < n; j++)
+      for (int i = 0; i <= j; i++)
+	R(i, j) = A(i, j);
+
+    V.Reallocate(n, n);
+    V.SetIdentity();
+
+    // round-robin ordering of the pairs of columns
+    int np = n + (n % 2);
+    Vector<int> player(np);
+    player.Fill();
+
+    Treal tol = numeric_limits<Treal>::epsilon() * Treal(n);
+    bool converged = false;
+    for (int sweep = 0; (sweep < 60) && !converged; sweep++)
+      {
+	int nb_rotation = 0;
+	for (int round = 0; round < np-1; round++)
+	  {
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) reduction(+:nb_rotation) \
+  num_threads(ParallelContext::GetNumThreads(np/2, 16))
+#endif
+	    for (int k = 0; k < np/2; k++)
+	      {
+		int p = player(k), q = player(np-1-k);
+		if (p > q)
+		  swap(p, q);
+
+		if (q >= n)
+		  continue;
+
+		T* rp = &R(0, p);
+		T* rq = &R(0, q);
+		Treal alpha(0), beta(0);
+		T gamma = zero;
+		for (int r = 0; r < n; r++)
+		  {
+		    alpha += absSquare(rp[r]);
+		    beta += absSquare(rq[r]);
+		    gamma += conjugate(rp[r]) * rq[r];
+		  }
+
+		Treal abs_gamma = abs(gamma);
+		if ((alpha == Treal(0)) || (beta == Treal(0))
+		    || (abs_gamma <= tol * sqrt(alpha) * sqrt(beta)))
+		  continue;
+
+		nb_rotation++;
+		T phase = gamma / abs_gamma;
+		Treal zeta = (beta - alpha) / (Treal(2) * abs_gamma);
+		Treal t = Treal(1) / (abs(zeta) + sqrt(Treal(1) + zeta*zeta));
+		if (zeta < Treal(0))
+		  t = -t;
+
+		Treal c = Treal(1) / sqrt(Treal(1) + t*t), s = c*t;
+		T sp = s * phase, sc = s * conjugate(phase);
+		for (int r = 0; r < n; r++)
+		  {
+		    T x = rp[r], y = rq[r];
+		    rp[r] = c*x - sc*y;
+		    rq[r] = sp*x + c*y;
+		  }
+
+		T* vp = &V(0, p);
+		T* vq = &V(0, q);
+		for (int r = 0; r < n; r++)
+		  {
+		    T x = vp[r], y = vq[r];
+		    vp[r] = c*x - sc*y;
+		    vq[r] = sp*x + c*y;
+		  }
+	      }
+
+	    // next round
+	    int last = player(np-1);
+	    for (int k = np-1; k > 1; k--)
+	      player(k) = player(k-1);
+
+	    player(1) = last;
+	  }
+
+	converged = (nb_rotation == 0);
+      }
+
+    // singular values in descending order
+    Vector<Treal> val(n);
+    Vector<int> order(n);
+    for (int j = 0; j < n; j++)
+      {
+	Treal nrm(0);
+	for (int r = 0; r < n; r++)
+	  nrm += absSquare(R(r, j));
+
+	val(j) = -sqrt(nrm);
+	order(j) = j;
+      }
+
+    Sort(val, order);
+    sigma.Reallocate(n);
+    Matrix<T, General, ColMajor> Ur(n, n), Vs(n, n);
+    for (int j = 0; j < n; j++)
+      {
+	sigma(j) = -val(j);
+	for (int r = 0; r < n; r++)
+	  {
+	    Vs(r, j) = V(r, order(j));
+	    if (sigma(j) > Treal(0))
+	      Ur(r, j) = R(r, order(j)) / sigma(j);
+	    else
+	      Ur(r, j) = zero;
+	  }
+      }
+
+    V = Vs;
+
+    // null singular values : the columns of U_R are completed
+    for (int j = 0; j < n; j++)
+      if (sigma(j) == Treal(0))
+	for (int l = 0; l < n; l++)
+	  {
+	    for (int r = 0; r < n; r++)
+	      Ur(r, j) = zero;
+
+	    Ur(l, j) = one;
+	    for (int pass = 0; pass < 2; pass++)
+	      for (int i = 0; i < j; i++)
+		{
+		  T s = zero;
+		  for (int r = 0; r < n; r++)
+		    s += conjugate(Ur(r, i)) * Ur(r, j);
+
+		  for (int r = 0; r < n; r++)
+		    Ur(r, j) -= s * Ur(r, i);
+		}
+
+	    Treal nrm(0);
+	    for (int r = 0; r < n; r++)
+	      nrm += absSquare(Ur(r, j));
+
+	    nrm = sqrt(nrm);
+	    if (nrm > Treal(0.5))
+	      {
+		for (int r = 0; r < n; r++)
+		  Ur(r, j) /= nrm;
+
+		break;
+	      }
+	  }
+
+    // U = Q diag(U_R, I)
+    U.Reallocate(m, m);
+    U.Fill(zero);
+    for (int j = 0; j < n; j++)
+      for (int r = 0; r < n; r++)
+	U(r, j) = Ur(r, j);
+
+    for (int j = n; j < m; j++)
+      U(j, j) = one;
+
+    ApplyHouseholderBlocks(m, n, 0, A.GetData(), m, tau.GetData(), false,
+			   m, U.GetData(), m);
+
+    return converged;
+  }
+
+
+  //! singular value decomposition of a dense matrix
+  /*!
+    A (m x n) is factorized as A = U diag(sigma) V, U being a m x m unitary
+    matrix and V a n x n unitary matrix. As in GetSVD, v contains V (i.e.
+    the conjugate transpose of the right singular vectors) and the singular
+    values are sorted in descending order. A is not modified.
+  */
+  template<class T, class Prop1, class Storage1, class Allocator1,
+	   class Allocator4, class Storage2, class Allocator2,
+	   class Storage3, class Allocator3>
+  void GetSVDNative(Matrix<T, Prop1, Storage1, Allocator1>& A,
+		    Vector<typename ClassComplexType<T>::Treal,
+		    VectFull, Allocator4>& sigma,
+		    Matrix<T, General, Storage2, Allocator2>& u,
+		    Matrix<T, General, Storage3, Allocator3>& v,
+		    LapackInfo& info)
+  {
+    typedef typename ClassComplexType<T>::Treal Treal;
+
+    int m = A.GetM(), n = A.GetN();
+    Matrix<T, General, ColMajor> B, U, V;
+    Vector<Treal> s;
+    bool converged;
+    if (m >= n)
+      {
+	// A = U S V^H
+	B.Reallocate(m, n);
+	for (int j = 0; j < n; j++)
+	  for (int i = 0; i < m; i++)
+	    B(i, j) = A(i, j);
+
+	converged = GetSVDJacobi(B, s, U, V);
+
+	u.Reallocate(m, m);
+	for (int j = 0; j < m; j++)
+	  for (int i = 0; i < m; i++)
+	    u(i, j) = U(i, j);
+
+	v.Reallocate(n, n);
+	for (int j = 0; j < n; j++)
+	  for (int i = 0; i < n; i++)
+	    v(i, j) = conjugate(V(j, i));
+      }
+    else
+      {
+	// A^H = U S V^H, so that A = V S U^H
+	B.Reallocate(n, m);
+	for (int j = 0; j < n; j++)
+	  for (int i = 0; i < m; i++)
+	    B(j, i) = conjugate(A(i, j));
+
+	converged = GetSVDJacobi(B, s, U, V);
+
+	u.Reallocate(m, m);
+	for (int j = 0; j < m; j++)
+	  for (int i = 0; i < m; i++)
+	    u(i, j) = V(i, j);
+
+	v.Reallocate(n, n);
+	for (int j = 0; j < n; j++)
+	  for (int i = 0; i < n; i++)
+	    v(i, j) = conjugate(U(j, i));
+      }
+
+    sigma.Reallocate(s.GetM());
+    for (int i = 0; i < int(s.GetM()); i++)
+      sigma(i) = s(i);
+
+    info.GetInfoRef() = converged ? 0 : 1;
+#ifdef SELDON_LAPACK_CHECK_INFO
+    if (info.GetInfo() != 0)
+      throw LapackError(info.GetInfo(), "GetSVDNative",
+			"Failed to find singular value decomposition");
+#endif
+  }
+
+
+  // SINGULAR VALUE DECOMPOSITION //
+  //////////////////////////////////
+
+
+#ifndef SELDON_WITH_LAPACK
+
+  //! eigenvalues of a symmetric matrix (native implementation)
+  template<class T, class Storage, class Allocator1, class Allocator2>
+  void GetEigenvalues(Matrix<T, Symmetric, Storage, Allocator1>& A,
+		      Vector<typename ClassComplexType<T>::Treal,
+		      VectFull, Allocator2>& w,
+		      LapackInfo& info)
+  {
+    GetEigenvaluesNative(A, w, info);
+  }
+
+
+  //! eigenvalues of a hermitian matrix (native implementation)
+  template<class T, class Storage, class Allocator1, class Allocator2>
+  void GetEigenvalues(Matrix<T, Hermitian, Storage, Allocator1>& A,
+		      Vector<typename ClassComplexType<T>::Treal,
+		      VectFull, Allocator2>& w,
+		      LapackInfo& info)
+  {
+    GetEigenvaluesNative(A, w, info);
+  }
+
+
+  //! eigenvalues and eigenvectors of a symmetric matrix
+  //! (native implementation)
+  template<class T, class Storage, class Allocator1, class Allocator2,
+	   class Storage3, class Allocator3>
+  void GetEigenvaluesEigenvectors(Matrix<T, Symmetric, Storage,
+				  Allocator1>& A,
+				  Vector<typename ClassComplexType<T>::Treal,
+				  VectFull, Allocator2>& w,
+				  Matrix<T, General, Storage3, Allocator3>& z,
+				  LapackInfo& info)
+  {
+    GetEigenvaluesEigenvectorsNative(A, w, z, info);
+  }
+
+
+  //! eigenvalues and eigenvectors of a hermitian matrix
+  //! (native implementation)
+  template<class T, class Storage, class Allocator1, class Allocator2,
+	   class Storage3, class Allocator3>
+  void GetEigenvaluesEigenvectors(Matrix<T, Hermitian, Storage,
+				  Allocator1>& A,
+				  Vector<typename ClassComplexType<T>::Treal,
+				  VectFull, Allocator2>& w,
+				  Matrix<T, General, Storage3, Allocator3>& z,
+				  LapackInfo& info)
+  {
+    GetEigenvaluesEigenvectorsNative(A, w, z, info);
+  }
+
+
+  //! singular value decomposition (native implementation)
+  template<class T, class Storage, class Allocator1, class Allocator2,
+	   class Allocator3, class Allocator4>
+  void GetSVD(Matrix<T, General, Storage, Allocator1>& A,
+	      Vector<typename ClassComplexType<T>::Treal,
+	      VectFull, Allocator4>& sigma,
+	      Matrix<T, General, Storage, Allocator2>& u,
+	      Matrix<T, General, Storage, Allocator3>& v,
+	      LapackInfo& info)
+  {
+    GetSVDNative(A, sigma, u, v, info);
+  }
+
+#endif
+
+} // end namespace
+
+#define SELDON_FILE_FUNCTIONS_EIGENVALUES_CXX
+#endif
@@ -0,0 +1,190 @@
+// Copyright (C) 2016 INRIA
+//
+// This file is part of the linear-algebra library Seldon,
+// http://seldon.sourceforge.net/.
+//
+// Seldon is free software; you can redistribute it and/or modify it under the
+// terms of the GNU Lesser General Public License as published by the Free
+// Software Foundation; either version 2.1 of the License, or (at your option)
+// any later version.
+//
+// Seldon is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for
+// more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with Seldon. If not, see http://www.gnu.org/licenses/.
+
+
+#ifndef SELDON_FILE_FUNCTIONS_EIGENVALUES_HXX
+
+/*
+  Native dense eigenvalue functions (Lapack is not needed):
+
+  GetEigenvaluesNative, GetEigenvaluesEigenvectorsNative
+  (symmetric or hermitian matrices: blocked tridiagonal reduction,
+  then divide-and-conquer on the tridiagonal matrix)
+
+  GetSVDNative
+  (blocked QR factorization, then one-sided Jacobi on the triangular factor)
+
+  If Seldon is compiled without Lapack, GetEigenvalues,
+  GetEigenvaluesEigenvectors and GetSVD call these functions for symmetric,
+  hermitian and general dense matrices.
+*/
+
+namespace Seldon
+{
+
+
+  ////////////////////////////
+  // HOUSEHOLDER REFLECTORS //
+
+
+  template<class T>
+  void GenerateHouseholder(int n, T* x, T& tau,
+			   typename ClassComplexType<T>::Treal& beta);
+
+  template<class T>
+  void ApplyHouseholderBlocks(int m, int nref, int offset, const T* V,
+			      int ldv, const T* tau, bool conj_trans,
+			      int ncol, T* Z, int ldz);
+
+  template<class T>
+  void ReduceHermitianTridiagonal(Matrix<T, General, ColMajor>& A,
+				  Vector<typename ClassComplexType<T>::Treal>& d,
+				  Vector<typename ClassComplexType<T>::Treal>& e,
+				  Vector<T>& tau);
+
+  template<class T>
+  void GetHouseholderQR(Matrix<T, General, ColMajor>& A, Vector<T>& tau);
+
+
+  // HOUSEHOLDER REFLECTORS //
+  ////////////////////////////
+
+
+  ///////////////////////////////
+  // SYMMETRIC TRIDIAGONAL EIG //
+
+
+  template<class T>
+  bool SolveTridiagonalQL(int n, T* d, T* e, T* z, int ldz);
+
+  template<class T>
+  void SolveSecularEquation(int k, const T* d, const T* z, T rho,
+			    int i, int& origin, T& tau);
+
+  template<class T>
+  void MergeTridiagonalDivideConquer(int lo, int mid, int hi, T beta,
+				     Vector<T>& d, Matrix<T, General,
+				     ColMajor>& Z);
+
+  template<class T>
+  bool SolveTridiagonalDivideConquer(Vector<T>& d, Vector<T>& e,
+				     Matrix<T, General, ColMajor>& Z);
+
+
+  // SYMMETRIC TRIDIAGONAL EIG //
+  ///////////////////////////////
+
+
+  //////////////////////////////////////
+  // SYMMETRIC / HERMITIAN EIGENPAIRS //
+
+
+  template<class T, class Prop, class Storage,
+	   class Allocator1, class Allocator2>
+  void GetEigenvaluesNative(Matrix<T, Prop, Storage, Allocator1>& A,
+			    Vector<typename ClassComplexType<T>::Treal,
+			    VectFull, Allocator2>& w,
+			    LapackInfo& info = lapack_info);
+
+  template<class T, class Prop, class Storage, class Allocator1,
+	   class Allocator2, class Storage3, class Allocator3>
+  void GetEigenvaluesEigenvectorsNative(Matrix<T, Prop, Storage,
+					Allocator1>& A,
+					Vector<typename ClassComplexType<T>
+					::Treal, VectFull, Allocator2>& w,
+					Matrix<T, General, Storage3,
+					Allocator3>& z,
+					LapackInfo& info = lapack_info);
+
+
+  // SYMMETRIC / HERMITIAN EIGENPAIRS //
+  //////////////////////////////////////
+
+
+  //////////////////////////////////
+  // SINGULAR VALUE DECOMPOSITION //
+
+
+  template<class T>
+  bool GetSVDJacobi(Matrix<T, General, ColMajor>& A,
+		    Vector<typename ClassComplexType<T>::Treal>& sigma,
+		    Matrix<T, General, ColMajor>& U,
+		    Matrix<T, General, ColMajor>& V);
+
+  template<class T, class Prop1, class Storage1, class Allocator1,
+	   class Allocator4, class Storage2, class Allocator2,
+	   class Storage3, class Allocator3>
+  void GetSVDNative(Matrix<T, Prop1, Storage1, Allocator1>& A,
+		    Vector<typename ClassComplexType<T>::Treal,
+		    VectFull, Allocator4>& sigma,
+		    Matrix<T, General, Storage2, Allocator2>& u,
+		    Matrix<T, General, Storage3, Allocator3>& v,
+		    LapackInfo& info = lapack_info);
+
+
+  // SINGULAR VALUE DECOMPOSITION //
+  //////////////////////////////////
+
+
+#ifndef SELDON_WITH_LAPACK
+
+  template<class T, class Storage, class Allocator1, class Allocator2>
+  void GetEigenvalues(Matrix<T, Symmetric, Storage, Allocator1>& A,
+		      Vector<typename ClassComplexType<T>::Treal,
+		      VectFull, Allocator2>& w,
+		      LapackInfo& info = lapack_info);
+
+  template<class T, class Storage, class Allocator1, class Allocator2>
+  void GetEigenvalues(Matrix<T, Hermitian, Storage, Allocator1>& A,
+		      Vector<typename ClassComplexType<T>::Treal,
+		      VectFull, Allocator2>& w,
+		      LapackInfo& info = lapack_info);
+
+  template<class T, class Storage, class Allocator1, class Allocator2,
+	   class Storage3, class Allocator3>
+  void GetEigenvaluesEigenvectors(Matrix<T, Symmetric, Storage,
+				  Allocator1>& A,
+				  Vector<typename ClassComplexType<T>::Treal,
+				  VectFull, Allocator2>& w,
+				  Matrix<T, General, Storage3, Allocator3>& z,
+				  LapackInfo& info = lapack_info);
+
+  template<class T, class Storage, class Allocator1, class Allocator2,
+	   class Storage3, class Allocator3>
+  void GetEigenvaluesEigenvectors(Matrix<T, Hermitian, Storage,
+				  Allocator1>& A,
+				  Vector<typename ClassComplexType<T>::Treal,
+				  VectFull, Allocator2>& w,
+				  Matrix<T, General, Storage3, Allocator3>& z,
+				  LapackInfo& info = lapack_info);
+
+  template<class T, class Storage, class Allocator1, class Allocator2,
+	   class Allocator3, class Allocator4>
+  void GetSVD(Matrix<T, General, Storage, Allocator1>& A,
+	      Vector<typename ClassComplexType<T>::Treal,
+	      VectFull, Allocator4>& sigma,
+	      Matrix<T, General, Storage, Allocator2>& u,
+	      Matrix<T, General, Storage, Allocator3>& v,
+	      LapackInfo& info = lapack_info);
+
+#endif
+
+} // end namespace
+
+#define SELDON_FILE_FUNCTIONS_EIGENVALUES_HXX
+#endif
@@ -46,6 +46,71 @@
 namespace Seldon
 {
 
+  //! Constructor.
+  /*!
+    \param[in] alpha scalar multiplying M X, NULL if Y = M X.
+    \param[in] ptr row start indices of M.
+    \param[in] ind column indices of M.
+    \param[in] data values of M.
+    \param[in] X vector multiplied by M.
+    \param[in,out] Y result.
+  */
+  template<class T0, class T1, class Vector2, class Vector4>
+  RowSparseProduct<T0, T1, Vector2, Vector4>
+  ::RowSparseProduct(const T0* alpha, const size_t* ptr, const size_t* ind,
+		     const T1* data, const Vector2& X, Vector4& Y)
+    : alpha_(alpha), ptr_(ptr), ind_(ind), data_(data), X_(X), Y_(Y)
+  {
+  }
+
+
+  //! Computes the rows i0 to i1 - 1 of the product.
+  template<class T0, class T1, class Vector2, class Vector4>
+  void RowSparseProduct<T0, T1, Vector2, Vector4>
+  ::operator()(size_t i0, size_t i1) const
+  {
+    typename Vector4::value_type zero, temp;
+    SetComplexZero(zero);
+
+    for (size_t i = i0; i < i1; i++)
+      {
+	temp = zero;
+	for (size_t j = ptr_[i]; j < ptr_[i+1]; j++)
+	  temp += data_[j] * X_(ind_[j]);
+
+	if (alpha_ == NULL)
+	  Y_(i) = temp;
+	else
+	  Y_(i) += *alpha_ * temp;
+      }
+  }
+
+
+  //! Returns the number of bytes moved by a sparse matrix-vector product.
+  /*!
+    Values, indices and pointers of M, X and Y are counted, Y twice for
+    MltAdd (\a add true). This value is given to the profiler.
+  */
+  template <class T1, class Prop1, class Storage1, class Allocator1,
+	    class T2, class Storage2, class Allocator2,
+	    class T4, class Storage4, class Allocator4>
+  double GetSparseProductBytes(const Matrix<T1, Prop1, Storage1,
+			       Allocator1>& M,
+			       const Vector<T2, Storage2, Allocator2>& X,
+			       const Vector<T4, Storage4, Allocator4>& Y,
+			       bool add)
+  {
+    double nb_bytes = double(M.GetDataSize()) * (sizeof(T1) + sizeof(size_t))
+      + double(M.GetPtrSize()) * sizeof(size_t)
+      + double(X.GetM()) * sizeof(T2) + double(Y.GetM()) * sizeof(T4);
+
+    if (add)
+      nb_bytes += double(Y.GetM()) * sizeof(T4);
+
+    return nb_bytes;
+  }
+
+
   /////////
   // MLT //
 
@@ -58,27 +123,19 @@ namespace Seldon
 		 const Vector<T2, Storage2, Allocator2>& X,
 		 Vector<T4, Storage4, Allocator4>& Y)
   {
-    int ma = M.GetM();
-
 #ifdef SELDON_CHECK_DIMENSIONS
     CheckDim(M, X, Y, "Mlt(M, X, Y)");
 #endif
 
-    T4 zero, temp;
-    SetComplexZero(zero);
-
-    int* ptr = M.GetPtr();
-    int* ind = M.GetInd();
-    T1* data = M.GetData();
+    SELDON_PROFILE("MltVector(RowSparse)");
+    SELDON_PROFILE_COUNT(2. * M.GetDataSize(),
+			 GetSparseProductBytes(M, X, Y, false));
 
-    for (int i = 0; i < ma; i++)
-      {
-	temp = zero;
-	for (int j = ptr[i]; j < ptr[i+1]; j++)
-	  temp += data[j] * X(ind[j]);
-
-	Y(i) = temp;
-      }
+    // rows are shared between the threads
+    ParallelFor(0, M.GetM(),
+		RowSparseProduct<T4, T1, Vector<T2, Storage2, Allocator2>,
+		Vector<T4, Storage4, Allocator4> >
+		(NULL, M.GetPtr(), M.GetInd(), M.GetData(), X, Y));
   }
 
 
@@ -94,8 +151,12 @@ namespace Seldon
     CheckDim(M, X, Y, "Mlt(M, X, Y)");
 #endif
 
-    int* ptr = M.GetPtr();
-    int* ind = M.GetInd();
+    SELDON_PROFILE("MltVector(ColSparse)");
+    SELDON_PROFILE_COUNT(2. * M.GetDataSize(),
+			 GetSparseProductBytes(M, X, Y, false));
+
+    size_t* ptr = M.GetPtr();
+    size_t* ind = M.GetInd();
     T1* data = M.GetData();
     Y.Zero();
 
@@ -121,6 +182,10 @@ namespace Seldon
     CheckDim(M, X, Y, "Mlt(M, X, Y)");
 #endif
 
+    SELDON_PROFILE("MltVector(RowSymSparse)");
+    SELDON_PROFILE_COUNT(4. * M.GetDataSize(),
+			 GetSparseProductBytes(M, X, Y, false));
+
     size_t i, j;
     T4 zero, temp;
     SetComplexZero(zero);
@@ -159,12 +224,16 @@ namespace Seldon
     CheckDim(M, X, Y, "Mlt(M, X, Y)");
 #endif
 
+    SELDON_PROFILE("MltVector(ColSymSparse)");
+    SELDON_PROFILE_COUNT(4. * M.GetDataSize(),
+			 GetSparseProductBytes(M, X, Y, false));
+
     int i, j;
     T4 zero, temp;
     SetComplexZero(zero);
 
-    int* ptr = M.GetPtr();
-    int* ind = M.GetInd();
+    size_t* ptr = M.GetPtr();
+    size_t* ind = M.GetInd();
     T1* data = M.GetData();
 
     for (i = 0; i < ma; i++)
@@ -206,8 +275,8 @@ namespace Seldon
     CheckDim(Trans, M, X, Y, "Mlt(SeldonTrans, M, X, Y)");
 #endif
 
-    int* ptr = M.GetPtr();
-    int* ind = M.GetInd();
+    size_t* ptr = M.GetPtr();
+    size_t* ind = M.GetInd();
     T1* data = M.GetData();
     Y.Zero();
 
@@ -250,8 +319,8 @@ namespace Seldon
     T4 temp, zero;
     SetComplexZero(zero);
 
-    int* ptr = M.GetPtr();
-    int* ind = M.GetInd();
+    size_t* ptr = M.GetPtr();
+    size_t* ind = M.GetInd();
     T1* data = M.GetData();
 
     if (Trans.Trans())
@@ -304,8 +373,8 @@ namespace Seldon
     T4 zero, temp;
     SetComplexZero(zero);
 
-    int* ptr = M.GetPtr();
-    int* ind = M.GetInd();
+    size_t* ptr = M.GetPtr();
+    size_t* ind = M.GetInd();
     T1* data = M.GetData();
 
     for (i = 0; i < ma; i++)
@@ -349,8 +418,8 @@ namespace Seldon
     T4 zero, temp;
     SetComplexZero(zero);
 
-    int* ptr = M.GetPtr();
-    int* ind = M.GetInd();
+    size_t* ptr = M.GetPtr();
+    size_t* ind = M.GetInd();
     T1* data = M.GetData();
 
     for (i = 0; i < ma; i++)
@@ -478,29 +547,21 @@ namespace Seldon
 		    const Vector<T2, Storage2, Allocator2>& X,
 		    const T3& beta, Vector<T4, Storage4, Allocator4>& Y)
   {
-    size_t ma = M.GetM();
-
 #ifdef SELDON_CHECK_DIMENSIONS
     CheckDim(M, X, Y, "MltAdd(alpha, M, X, beta, Y)");
 #endif
 
-    Mlt(beta, Y);
+    SELDON_PROFILE("MltAddVector(RowSparse)");
+    SELDON_PROFILE_COUNT(2. * M.GetDataSize(),
+			 GetSparseProductBytes(M, X, Y, true));
 
-    T4 zero, temp;
-    SetComplexZero(zero);
-
-    size_t* ptr = M.GetPtr();
-    size_t* ind = M.GetInd();
-    typename Matrix<T1, Prop1, RowSparse, Allocator1>::pointer
-      data = M.GetData();
+    Mlt(beta, Y);
 
-    for (size_t i = 0; i < ma; i++)
-      {
-	temp = zero;
-	for (size_t j = ptr[i]; j < ptr[i+1]; j++)
-	  temp += data[j] * X(ind[j]);
-	Y(i) += alpha * temp;
-      }
+    // rows are shared between the threads
+    ParallelFor(0, M.GetM(),
+		RowSparseProduct<T0, T1, Vector<T2, Storage2, Allocator2>,
+		Vector<T4, Storage4, Allocator4> >
+		(&alpha, M.GetPtr(), M.GetInd(), M.GetData(), X, Y));
   }
 
 
@@ -555,10 +616,14 @@ namespace Seldon
     CheckDim(M, X, Y, "MltAdd(alpha, M, X, beta, Y)");
 #endif
 
+    SELDON_PROFILE("MltAddVector(ColSparse)");
+    SELDON_PROFILE_COUNT(2. * M.GetDataSize(),
+			 GetSparseProductBytes(M, X, Y, true));
+
     Mlt(beta, Y);
 
-    int* ptr = M.GetPtr();
-    int* ind = M.GetInd();
+    size_t* ptr = M.GetPtr();
+    size_t* ind = M.GetInd();
     typename Matrix<T1, Prop1, ColSparse, Allocator1>::pointer
       data = M.GetData();
 
@@ -589,6 +654,10 @@ namespace Seldon
     CheckDim(M, X, Y, "MltAdd(alpha, M, X, beta, Y)");
 #endif
 
+    SELDON_PROFILE("MltAddVector(RowSymSparse)");
+    SELDON_PROFILE_COUNT(4. * M.GetDataSize(),
+			 GetSparseProductBytes(M, X, Y, true));
+
     Mlt(beta, Y);
 
     size_t i, j;
@@ -631,6 +700,10 @@ namespace Seldon
     CheckDim(M, X, Y, "MltAdd(alpha, M, X, beta, Y)");
 #endif
 
+    SELDON_PROFILE("MltAddVector(ColSymSparse)");
+    SELDON_PROFILE_COUNT(4. * M.GetDataSize(),
+			 GetSparseProductBytes(M, X, Y, true));
+
     Mlt(beta, Y);
 
     size_t i, j;
@@ -681,8 +754,8 @@ namespace Seldon
     SetComplexZero(zero);
     typename T4::value_type temp;
 
-    int* ptr = M.GetPtr();
-    int* ind = M.GetInd();
+    size_t* ptr = M.GetPtr();
+    size_t* ind = M.GetInd();
     typename Matrix<T1, Prop1, RowSymSparse, Allocator1>::pointer
       data = M.GetData();
 
@@ -823,8 +896,8 @@ namespace Seldon
     T4 temp, zero;
     SetComplexZero(zero);
 
-    int* ptr = M.GetPtr();
-    int* ind = M.GetInd();
+    size_t* ptr = M.GetPtr();
+    size_t* ind = M.GetInd();
     typename Matrix<T1, Prop1, ColSparse, Allocator1>::pointer
       data = M.GetData();
 
@@ -885,8 +958,8 @@ namespace Seldon
     T4 zero, temp;
     SetComplexZero(zero);
 
-    int* ptr = M.GetPtr();
-    int* ind = M.GetInd();
+    size_t* ptr = M.GetPtr();
+    size_t* ind = M.GetInd();
     T1* data = M.GetData();
 
     for (i = 0; i < ma; i++)
@@ -933,8 +1006,8 @@ namespace Seldon
     T4 zero, temp;
     SetComplexZero(zero);
 
-    int* ptr = M.GetPtr();
-    int* ind = M.GetInd();
+    size_t* ptr = M.GetPtr();
+    size_t* ind = M.GetInd();
     T1* data = M.GetData();
 
     for (i = 0; i < ma; i++)
@@ -1629,8 +1702,8 @@ namespace Seldon
     Copy(X, Y);
 
     T0* data = A.GetData();
-    int* ptr = A.GetPtr();
-    int* ind = A.GetInd();
+    size_t* ptr = A.GetPtr();
+    size_t* ind = A.GetInd();
     T0 zero; SetComplexZero(zero);
     T1 val;
     if (Uplo.Lower())
@@ -43,6 +43,40 @@
 namespace Seldon
 {
 
+  //! Rows of the product of a RowSparse matrix by a vector.
+  /*!
+    Function object given to ParallelFor: rows i0 to i1 - 1 of Y are set to
+    the ones of M X if alpha is NULL, or incremented by alpha M X.
+  */
+  template<class T0, class T1, class Vector2, class Vector4>
+  class RowSparseProduct
+  {
+  protected:
+    const T0* alpha_;
+    const size_t* ptr_;
+    const size_t* ind_;
+    const T1* data_;
+    const Vector2& X_;
+    Vector4& Y_;
+
+  public:
+    RowSparseProduct(const T0* alpha, const size_t* ptr, const size_t* ind,
+		     const T1* data, const Vector2& X, Vector4& Y);
+
+    void operator()(size_t i0, size_t i1) const;
+  };
+
+
+  template <class T1, class Prop1, class Storage1, class Allocator1,
+	    class T2, class Storage2, class Allocator2,
+	    class T4, class Storage4, class Allocator4>
+  double GetSparseProductBytes(const Matrix<T1, Prop1, Storage1,
+			       Allocator1>& M,
+			       const Vector<T2, Storage2, Allocator2>& X,
+			       const Vector<T4, Storage4, Allocator4>& Y,
+			       bool add);
+
+
   /////////
   // MLT //
 
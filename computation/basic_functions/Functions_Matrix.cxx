@@ -864,6 +864,357 @@ namespace Seldon
   }
 
 
+  //! Multiplies two strided blocks, and adds the result to a third block.
+  /*! It performs the operation \f$ C = C + \alpha op(A) op(B) \f$, where
+    element (i, j) of op(A) is a[i * rs_a + j * cs_a], conjugated if \a
+    conj_a is true, and likewise for op(B) and C. This is the native kernel
+    of the products of dense blocks: panels of op(A) and op(B) are packed in
+    contiguous buffers, and C is updated by 4 x 4 tiles accumulated in
+    registers, whatever the strides and the transpositions.
+    \param[in] m number of rows of C.
+    \param[in] n number of columns of C.
+    \param[in] k number of columns of op(A).
+    \param[in] alpha scalar.
+    \param[in] a first element of A.
+    \param[in] rs_a distance between two consecutive rows of op(A).
+    \param[in] cs_a distance between two consecutive columns of op(A).
+    \param[in] conj_a true if the elements of A are to be conjugated.
+    \param[in] b first element of B.
+    \param[in] rs_b distance between two consecutive rows of op(B).
+    \param[in] cs_b distance between two consecutive columns of op(B).
+    \param[in] conj_b true if the elements of B are to be conjugated.
+    \param[in,out] c first element of C.
+    \param[in] rs_c distance between two consecutive rows of C.
+    \param[in] cs_c distance between two consecutive columns of C.
+  */
+  template <class T0, class T1, class T2, class T4>
+  void MltAddStrided(size_t m, size_t n, size_t k, const T0& alpha,
+                     const T1* a, size_t rs_a, size_t cs_a, bool conj_a,
+                     const T2* b, size_t rs_b, size_t cs_b, bool conj_b,
+                     T4* c, size_t rs_c, size_t cs_c)
+  {
+    // Sizes of the tiles of C, and of the packed panels.
+    const size_t mr = 4, nr = 4, kb = 256, nb = 512;
+
+    T4 zero;
+    SetComplexZero(zero);
+    Vector<T4> b_pack(kb * nb);
+
+    for (size_t p0 = 0; p0 < k; p0 += kb)
+      {
+        size_t kp = min(kb, k - p0);
+        for (size_t j0 = 0; j0 < n; j0 += nb)
+          {
+            size_t nj = min(nb, n - j0);
+            size_t n_panel = (nj + nr - 1) / nr;
+
+            // Packs op(B)(p0:p0+kp, j0:j0+nj) in panels of nr columns,
+            // padded with zeros.
+            for (size_t jp = 0; jp < n_panel; jp++)
+              for (size_t p = 0; p < kp; p++)
+                {
+                  T4* packed = b_pack.GetData() + (jp * kp + p) * nr;
+                  for (size_t jj = 0; jj < nr; jj++)
+                    {
+                      size_t j = jp * nr + jj;
+                      if (j >= nj)
+                        packed[jj] = zero;
+                      else if (conj_b)
+                        packed[jj] = conjugate(b[(p0 + p) * rs_b
+                                                 + (j0 + j) * cs_b]);
+                      else
+                        packed[jj] = b[(p0 + p) * rs_b + (j0 + j) * cs_b];
+                    }
+                }
+
+#ifdef _OPENMP
+#pragma omp parallel if (m * nj * kp > 100000) \
+  num_threads(ParallelContext::GetNumThreads(m, mr))
+#endif
+            {
+              Vector<T4> a_pack(mr * kp);
+              T4 acc[mr][nr];
+
+#ifdef _OPENMP
+#pragma omp for schedule(static)
+#endif
+              for (long i0 = 0; i0 < long(m); i0 += mr)
+                {
+                  size_t mi = min(mr, m - i0);
+
+                  // Packs alpha op(A)(i0:i0+mr, p0:p0+kp) column by column.
+                  for (size_t p = 0; p < kp; p++)
+                    for (size_t r = 0; r < mr; r++)
+                      if (r >= mi)
+                        a_pack(p * mr + r) = zero;
+                      else if (conj_a)
+                        a_pack(p * mr + r)
+                          = alpha * conjugate(a[(i0 + r) * rs_a
+                                                + (p0 + p) * cs_a]);
+                      else
+                        a_pack(p * mr + r)
+                          = alpha * a[(i0 + r) * rs_a + (p0 + p) * cs_a];
+
+                  for (size_t jp = 0; jp < n_panel; jp++)
+                    {
+                      for (size_t r = 0; r < mr; r++)
+                        for (size_t jj = 0; jj < nr; jj++)
+                          acc[r][jj] = zero;
+
+                      const T4* a_ptr = a_pack.GetData();
+                      const T4* b_ptr = b_pack.GetData() + jp * kp * nr;
+                      for (size_t p = 0; p < kp; p++)
+                        {
+                          for (size_t r = 0; r < mr; r++)
+                            for (size_t jj = 0; jj < nr; jj++)
+                              acc[r][jj] += a_ptr[r] * b_ptr[jj];
+                          a_ptr += mr;
+                          b_ptr += nr;
+                        }
+
+                      size_t nj_panel = min(nr, nj - jp * nr);
+                      for (size_t r = 0; r < mi; r++)
+                        for (size_t jj = 0; jj < nj_panel; jj++)
+                          c[(i0 + r) * rs_c + (j0 + jp * nr + jj) * cs_c]
+                            += acc[r][jj];
+                    }
+                }
+            }
+          }
+      }
+  }
+
+
+  //! Multiplies two dense blocks, and adds the result to a third block.
+  /*! It performs the operation \f$ C = \alpha A B + \beta C \f$ where \f$
+    \alpha \f$ and \f$ \beta \f$ are scalars, and \f$ A \f$, \f$ B \f$ and \f$
+    C \f$ are strided views on dense matrices.
+    \param[in] alpha scalar.
+    \param[in] A matrix.
+    \param[in] B matrix.
+    \param[in] beta scalar.
+    \param[in,out] C matrix, result of the product of \a A with \a B, times \a
+    alpha, plus \a beta times \a C.
+  */
+  template <class T0,
+	    class T1, class Prop1, class Storage1, class Allocator1,
+	    class T2, class Prop2, class Storage2, class Allocator2,
+	    class T3,
+	    class T4, class Prop4, class Storage4, class Allocator4>
+  void MltAddMatrix(const T0& alpha,
+		    const Matrix<T1, Prop1, StridedSubStorage<Storage1>,
+                    Allocator1>& A,
+		    const Matrix<T2, Prop2, StridedSubStorage<Storage2>,
+                    Allocator2>& B,
+		    const T3& beta,
+		    Matrix<T4, Prop4, StridedSubStorage<Storage4>,
+                    Allocator4>& C)
+  {
+    MltAddMatrix(alpha, SeldonNoTrans, A, SeldonNoTrans, B, beta, C);
+  }
+
+
+  //! Multiplies two dense blocks, and adds the result to a third block.
+  /*! It performs the operation \f$ C = \alpha op(A) op(B) + \beta C \f$
+    where \f$ \alpha \f$ and \f$ \beta \f$ are scalars, \f$ op(A) \f$ is \f$ A
+    \f$, \f$ A^T \f$ or \f$ A^H \f$, and \f$ A \f$, \f$ B \f$ and \f$ C \f$
+    are strided views on dense matrices.
+    \param[in] alpha scalar.
+    \param[in] TransA status of A: SeldonNoTrans, SeldonTrans or
+    SeldonConjTrans.
+    \param[in] A matrix.
+    \param[in] TransB status of B: SeldonNoTrans, SeldonTrans or
+    SeldonConjTrans.
+    \param[in] B matrix.
+    \param[in] beta scalar.
+    \param[in,out] C matrix, result of the product of \a op(A) with \a
+    op(B), times \a alpha, plus \a beta times \a C.
+  */
+  template <class T0,
+	    class T1, class Prop1, class Storage1, class Allocator1,
+	    class T2, class Prop2, class Storage2, class Allocator2,
+	    class T3,
+	    class T4, class Prop4, class Storage4, class Allocator4>
+  void MltAddMatrix(const T0& alpha,
+		    const SeldonTranspose& TransA,
+		    const Matrix<T1, Prop1, StridedSubStorage<Storage1>,
+                    Allocator1>& A,
+		    const SeldonTranspose& TransB,
+		    const Matrix<T2, Prop2, StridedSubStorage<Storage2>,
+                    Allocator2>& B,
+		    const T3& beta,
+		    Matrix<T4, Prop4, StridedSubStorage<Storage4>,
+                    Allocator4>& C)
+  {
+
+#ifdef SELDON_CHECK_DIMENSIONS
+    CheckDim(TransA, A, TransB, B, C,
+	     "MltAdd(alpha, TransA, A, TransB, B, beta, C)");
+#endif
+
+    size_t m = C.GetM(), n = C.GetN(), k = A.GetN(TransA);
+
+    // C = beta C.
+    T3 zero_T3, one_T3;
+    SetComplexZero(zero_T3);
+    SetComplexOne(one_T3);
+    if (beta == zero_T3)
+      C.Zero();
+    else if (beta != one_T3)
+      for (size_t i = 0; i < Storage4::GetFirst(m, n); i++)
+        {
+          T4* data = C.GetData() + i * C.GetLD();
+          for (size_t j = 0; j < Storage4::GetSecond(m, n); j++)
+            data[j] *= beta;
+        }
+
+    if (m == 0 || n == 0 || k == 0)
+      return;
+
+    // Distances between consecutive rows and columns of op(A), op(B) and C.
+    size_t rs_a = Storage1::GetFirst(1, 0) * A.GetLD()
+      + Storage1::GetSecond(1, 0);
+    size_t cs_a = Storage1::GetFirst(0, 1) * A.GetLD()
+      + Storage1::GetSecond(0, 1);
+    if (!TransA.NoTrans())
+      swap(rs_a, cs_a);
+
+    size_t rs_b = Storage2::GetFirst(1, 0) * B.GetLD()
+      + Storage2::GetSecond(1, 0);
+    size_t cs_b = Storage2::GetFirst(0, 1) * B.GetLD()
+      + Storage2::GetSecond(0, 1);
+    if (!TransB.NoTrans())
+      swap(rs_b, cs_b);
+
+    size_t rs_c = Storage4::GetFirst(1, 0) * C.GetLD()
+      + Storage4::GetSecond(1, 0);
+    size_t cs_c = Storage4::GetFirst(0, 1) * C.GetLD()
+      + Storage4::GetSecond(0, 1);
+
+    MltAddStrided(m, n, k, alpha,
+                  A.GetData(), rs_a, cs_a, TransA.ConjTrans(),
+                  B.GetData(), rs_b, cs_b, TransB.ConjTrans(),
+                  C.GetData(), rs_c, cs_c);
+  }
+
+
+  //! Multiplies two sub-matrices, and adds the result to a third one.
+  /*! It performs the operation \f$ C = \alpha A B + \beta C \f$ where \f$
+    \alpha \f$ and \f$ \beta \f$ are scalars, and \f$ A \f$, \f$ B \f$ and \f$
+    C \f$ are sub-matrices defined by lists of rows and columns.
+    \param[in] alpha scalar.
+    \param[in] A matrix.
+    \param[in] B matrix.
+    \param[in] beta scalar.
+    \param[in,out] C matrix, result of the product of \a A with \a B, times \a
+    alpha, plus \a beta times \a C.
+  */
+  template <class T0,
+	    class T1, class Prop1, class M1, class Allocator1,
+	    class T2, class Prop2, class M2, class Allocator2,
+	    class T3,
+	    class T4, class Prop4, class M4, class Allocator4>
+  void MltAddMatrix(const T0& alpha,
+		    const Matrix<T1, Prop1, SubStorage<M1>, Allocator1>& A,
+		    const Matrix<T2, Prop2, SubStorage<M2>, Allocator2>& B,
+		    const T3& beta,
+		    Matrix<T4, Prop4, SubStorage<M4>, Allocator4>& C)
+  {
+    MltAddMatrix(alpha, SeldonNoTrans, A, SeldonNoTrans, B, beta, C);
+  }
+
+
+  //! Multiplies two sub-matrices, and adds the result to a third one.
+  /*! It performs the operation \f$ C = \alpha op(A) op(B) + \beta C \f$
+    where \f$ \alpha \f$ and \f$ \beta \f$ are scalars, \f$ op(A) \f$ is \f$ A
+    \f$, \f$ A^T \f$ or \f$ A^H \f$, and \f$ A \f$, \f$ B \f$ and \f$ C \f$
+    are sub-matrices defined by lists of rows and columns. A is gathered in
+    a dense matrix; then, for each panel of columns of C, the corresponding
+    columns of op(B) and of C are gathered, the product of the dense blocks
+    is computed (with Blas if available) and the panel is scattered back
+    into C.
+    \param[in] alpha scalar.
+    \param[in] TransA status of A: SeldonNoTrans, SeldonTrans or
+    SeldonConjTrans.
+    \param[in] A matrix.
+    \param[in] TransB status of B: SeldonNoTrans, SeldonTrans or
+    SeldonConjTrans.
+    \param[in] B matrix.
+    \param[in] beta scalar.
+    \param[in,out] C matrix, result of the product of \a op(A) with \a
+    op(B), times \a alpha, plus \a beta times \a C.
+  */
+  template <class T0,
+	    class T1, class Prop1, class M1, class Allocator1,
+	    class T2, class Prop2, class M2, class Allocator2,
+	    class T3,
+	    class T4, class Prop4, class M4, class Allocator4>
+  void MltAddMatrix(const T0& alpha,
+		    const SeldonTranspose& TransA,
+		    const Matrix<T1, Prop1, SubStorage<M1>, Allocator1>& A,
+		    const SeldonTranspose& TransB,
+		    const Matrix<T2, Prop2, SubStorage<M2>, Allocator2>& B,
+		    const T3& beta,
+		    Matrix<T4, Prop4, SubStorage<M4>, Allocator4>& C)
+  {
+
+#ifdef SELDON_CHECK_DIMENSIONS
+    CheckDim(TransA, A, TransB, B, C,
+	     "MltAdd(alpha, TransA, A, TransB, B, beta, C)");
+#endif
+
+    // Number of columns of C updated at once.
+    const size_t nb = 256;
+
+    size_t m = C.GetM(), n = C.GetN();
+    T3 zero_T3;
+    SetComplexZero(zero_T3);
+
+    Matrix<T1, General, ColMajor> A_dense(A.GetM(), A.GetN());
+    for (size_t j = 0; j < size_t(A.GetN()); j++)
+      for (size_t i = 0; i < size_t(A.GetM()); i++)
+        A_dense(i, j) = A(i, j);
+    Matrix<T1, General, StridedSubStorage<ColMajor> > A_view(A_dense);
+
+    Matrix<T2, General, ColMajor> B_dense;
+    Matrix<T4, General, ColMajor> C_dense;
+    for (size_t j0 = 0; j0 < n; j0 += nb)
+      {
+        size_t nj = min(nb, n - j0);
+
+        // Columns [j0, j0 + nj[ of op(B).
+        if (TransB.NoTrans())
+          {
+            B_dense.Reallocate(B.GetM(), nj);
+            for (size_t j = 0; j < nj; j++)
+              for (size_t i = 0; i < size_t(B.GetM()); i++)
+                B_dense(i, j) = B(i, j0 + j);
+          }
+        else
+          {
+            B_dense.Reallocate(nj, B.GetN());
+            for (size_t j = 0; j < size_t(B.GetN()); j++)
+              for (size_t i = 0; i < nj; i++)
+                B_dense(i, j) = B(j0 + i, j);
+          }
+
+        C_dense.Reallocate(m, nj);
+        if (beta != zero_T3)
+          for (size_t j = 0; j < nj; j++)
+            for (size_t i = 0; i < m; i++)
+              C_dense(i, j) = C.Val(i, j0 + j);
+
+        Matrix<T2, General, StridedSubStorage<ColMajor> > B_view(B_dense);
+        Matrix<T4, General, StridedSubStorage<ColMajor> > C_view(C_dense);
+        MltAddMatrix(alpha, TransA, A_view, TransB, B_view, beta, C_view);
+
+        for (size_t j = 0; j < nj; j++)
+          for (size_t i = 0; i < m; i++)
+            C.Val(i, j0 + j) = C_dense(i, j);
+      }
+  }
+
+
    //! Multiplies two matrices, and adds the result to a third matrix.
   /*! It performs the operation \f$ C = \alpha A B + \beta C \f$ where \f$
     \alpha \f$ and \f$ \beta \f$ are scalars, and \f$ A \f$, \f$ B \f$ and \f$
@@ -2732,51 +3083,53 @@ namespace Seldon
                  Matrix<T, General, RowSparse, Allocator>& B)
   {
     B.Clear();
-    size_t m = A.GetM();
+    long m = A.GetM();
     size_t n = A.GetN();
-    size_t nnz = A.GetDataSize();
-    Vector<size_t> ptr_T(n+1), ptr;
-    Vector<size_t> ind_T(nnz), ind;
-    Vector<T, VectFull, Allocator> data_T(nnz), data;
-
-    ptr.SetData(m+1, A.GetPtr());
-    ind.SetData(nnz,  A.GetInd());
-    data.SetData(nnz, A.GetData());
-
-    ptr_T.Zero();
-    ind_T.Zero();
-    data_T.Zero();
-
-    // For each column j, computes number of its non-zeroes and stores it in
-    // ptr_T[j].
-    for (size_t i = 0; i < nnz; i++)
-      ptr_T(ind(i) + 1)++;
+    long nnz = A.GetDataSize();
+    size_t* ptr = A.GetPtr();
+    T* data = A.GetData();
+    Vector<size_t> ind;
+    ind.SetData(nnz, A.GetInd());
+
+    // Entries are sorted by rows, a stable sort with respect to column
+    // numbers keeps rows sorted in each column.
+    Vector<size_t> permutation;
+    GetRadixPermutation(ind, permutation);
+    ind.Nullify();
 
-    // Computes the required number of non-zeroes ptr_T(j).
-    for (size_t j = 1; j < n + 1; j++)
-      ptr_T(j) += ptr_T(j - 1);
+    Vector<size_t> row(nnz);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) \
+  num_threads(ParallelContext::GetNumThreads(m))
+#endif
+    for (long i = 0; i < m; i++)
+      for (size_t jp = ptr[i]; jp < ptr[i+1]; jp++)
+        row(jp) = i;
+
+    // Column numbers of sorted entries give the pointer array.
+    Vector<size_t> ptr_T, ind_T(nnz);
+    Vector<T, VectFull, Allocator> data_T(nnz);
+    const size_t* ind_ = A.GetInd();
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) \
+  num_threads(ParallelContext::GetNumThreads(nnz))
+#endif
+    for (long k = 0; k < nnz; k++)
+      ind_T(k) = ind_[permutation(k)];
 
-    Vector<size_t> row_ind(n+1);
-    row_ind.Zero();
-    for (size_t i = 0; i < m; i++)
-      for (size_t jp = ptr(i); jp < ptr(i+1); jp++)
-    	{
-	  size_t j = ind(jp);
-	  size_t k = ptr_T(j) + row_ind(j);
-	  ++row_ind(j);
-	  data_T(k) = data(jp);
-	  ind_T(k) = i;
-    	}
+    GetPtrFromSortedIndex(n, ind_T, ptr_T);
 
-    // sorting numbers
-    for (size_t i = 0; i < n; i++)
-      Sort(ptr_T(i), ptr_T(i+1)-1, ind_T, data_T);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) \
+  num_threads(ParallelContext::GetNumThreads(nnz))
+#endif
+    for (long k = 0; k < nnz; k++)
+      {
+        ind_T(k) = row(permutation(k));
+        data_T(k) = data[permutation(k)];
+      }
 
     B.SetData(n, m, data_T, ptr_T, ind_T);
-
-    data.Nullify();
-    ptr.Nullify();
-    ind.Nullify();
   }
 
 
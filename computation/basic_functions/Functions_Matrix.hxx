@@ -150,6 +150,66 @@ namespace Seldon
 		    const T3& beta,
 		    Matrix<T4, Prop4, Storage4, Allocator4>& C);
 
+  template <class T0, class T1, class T2, class T4>
+  void MltAddStrided(size_t m, size_t n, size_t k, const T0& alpha,
+                     const T1* a, size_t rs_a, size_t cs_a, bool conj_a,
+                     const T2* b, size_t rs_b, size_t cs_b, bool conj_b,
+                     T4* c, size_t rs_c, size_t cs_c);
+
+  template <class T0,
+	    class T1, class Prop1, class Storage1, class Allocator1,
+	    class T2, class Prop2, class Storage2, class Allocator2,
+	    class T3,
+	    class T4, class Prop4, class Storage4, class Allocator4>
+  void MltAddMatrix(const T0& alpha,
+		    const Matrix<T1, Prop1, StridedSubStorage<Storage1>,
+                    Allocator1>& A,
+		    const Matrix<T2, Prop2, StridedSubStorage<Storage2>,
+                    Allocator2>& B,
+		    const T3& beta,
+		    Matrix<T4, Prop4, StridedSubStorage<Storage4>,
+                    Allocator4>& C);
+
+  template <class T0,
+	    class T1, class Prop1, class Storage1, class Allocator1,
+	    class T2, class Prop2, class Storage2, class Allocator2,
+	    class T3,
+	    class T4, class Prop4, class Storage4, class Allocator4>
+  void MltAddMatrix(const T0& alpha,
+		    const SeldonTranspose& TransA,
+		    const Matrix<T1, Prop1, StridedSubStorage<Storage1>,
+                    Allocator1>& A,
+		    const SeldonTranspose& TransB,
+		    const Matrix<T2, Prop2, StridedSubStorage<Storage2>,
+                    Allocator2>& B,
+		    const T3& beta,
+		    Matrix<T4, Prop4, StridedSubStorage<Storage4>,
+                    Allocator4>& C);
+
+  template <class T0,
+	    class T1, class Prop1, class M1, class Allocator1,
+	    class T2, class Prop2, class M2, class Allocator2,
+	    class T3,
+	    class T4, class Prop4, class M4, class Allocator4>
+  void MltAddMatrix(const T0& alpha,
+		    const Matrix<T1, Prop1, SubStorage<M1>, Allocator1>& A,
+		    const Matrix<T2, Prop2, SubStorage<M2>, Allocator2>& B,
+		    const T3& beta,
+		    Matrix<T4, Prop4, SubStorage<M4>, Allocator4>& C);
+
+  template <class T0,
+	    class T1, class Prop1, class M1, class Allocator1,
+	    class T2, class Prop2, class M2, class Allocator2,
+	    class T3,
+	    class T4, class Prop4, class M4, class Allocator4>
+  void MltAddMatrix(const T0& alpha,
+		    const SeldonTranspose& TransA,
+		    const Matrix<T1, Prop1, SubStorage<M1>, Allocator1>& A,
+		    const SeldonTranspose& TransB,
+		    const Matrix<T2, Prop2, SubStorage<M2>, Allocator2>& B,
+		    const T3& beta,
+		    Matrix<T4, Prop4, SubStorage<M4>, Allocator4>& C);
+
   template <class T0,
 	    class T1, class Prop1, class Allocator1,
 	    class T2, class Prop2, class Allocator2,
@@ -339,6 +339,10 @@ namespace Seldon
     CheckDim(X, Y, "DotProd(X, Y)");
 #endif
 
+    if (ParallelContext::IsDeterministic()
+	&& ReproducibleDotProd(X, Y, false, value))
+      return value;
+
     for (size_t i = 0; i < X.GetM(); i++)
       value += X(i) * Y(i);
 
@@ -401,6 +405,10 @@ namespace Seldon
     CheckDim(X, Y, "DotProdConj(X, Y)");
 #endif
 
+    if (ParallelContext::IsDeterministic()
+	&& ReproducibleDotProd(X, Y, true, value))
+      return value;
+
     for (int i = 0; i < X.GetM(); i++)
       value += conjugate(X(i)) * Y(i);
 
@@ -555,6 +563,9 @@ namespace Seldon
   {
     T1 value(0);
 
+    if (ParallelContext::IsDeterministic() && ReproducibleNorm2(X, value))
+      return value;
+
     for (int i = 0; i < X.GetM(); i++)
       value += X(i) * X(i);
 
@@ -568,6 +579,9 @@ namespace Seldon
   {
     T1 value(0);
 
+    if (ParallelContext::IsDeterministic() && ReproducibleNorm2(X, value))
+      return value;
+
     for (int i = 0; i < X.GetM(); i++)
       value += absSquare(X(i));
 
@@ -0,0 +1,599 @@
+// Copyright (C) 2016 INRIA
+//
+// This file is part of the linear-algebra library Seldon,
+// http://seldon.sourceforge.net/.
+//
+// Seldon is free software; you can redistribute it and/or modify it under the
+// terms of the GNU Lesser General Public License as published by the Free
+// Software Foundation; either version 2.1 of the License, or (at your option)
+// any later version.
+//
+// Seldon is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for
+// more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with Seldon. If not, see http://www.gnu.org/licenses/.
+
+
+#ifndef SELDON_FILE_FUNCTIONS_VECTOR_REPRODUCIBLE_CXX
+
+#include "Functions_VectorReproducible.hxx"
+
+#include <limits>
+
+
+namespace Seldon
+{
+
+
+  /////////////////////////////
+  // REPRODUCIBLEBLOCKKERNEL //
+
+
+  //! Constructor.
+  /*!
+    \param[in] type reduction (DOT_PROD, DOT_PROD_COMPLEX, DOT_PROD_CONJ,
+    SUM_SQUARE or SUM_SQUARE_COMPLEX).
+    \param[in] x first array (real and imaginary parts for complex
+    reductions).
+    \param[in] y second array (not read by the sums of squares).
+    \param[in] index numbers of the elements of the reduction, element i of
+    a block being index[i]. If it is NULL, element i is i.
+  */
+  template<class T>
+  ReproducibleBlockKernel<T>::ReproducibleBlockKernel(int type, const T* x,
+						      const T* y,
+						      const size_t* index)
+    : type_(type), x_(x), y_(y), index_(index), scale_(1.)
+  {
+  }
+
+
+  //! Sets the scaling of the terms before their summation.
+  /*!
+    \param[in] scale power of 2 multiplying the products (the values for
+    the sums of squares), so that the terms are lower than 1.
+    \param[in] nb_term maximal number of terms of the sum.
+  */
+  template<class T>
+  void ReproducibleBlockKernel<T>::SetScale(double scale, double nb_term)
+  {
+    scale_ = scale;
+    zero_.Init(nb_term);
+  }
+
+
+  //! Returns the scaling of the terms.
+  template<class T>
+  double ReproducibleBlockKernel<T>::GetScale() const
+  {
+    return scale_;
+  }
+
+
+  //! Returns the maximal absolute value of the products on a block.
+  /*!
+    For the sums of squares, the maximal absolute value of the real and
+    imaginary parts is returned.
+  */
+  template<class T>
+  ReproducibleBound
+  ReproducibleBlockKernel<T>::GetBound(size_t i0, size_t i1) const
+  {
+    if (index_ == NULL)
+      {
+#ifdef SELDON_WITH_SIMD_DISPATCH
+	// the maximum is exact, hence the same with all instruction sets
+	size_t m = IsComplex(type_) ? 2 : 1;
+	ReproducibleBound bound;
+	if (SimdReproducibleBound(type_, m * (i1 - i0), x_ + m * i0,
+				  y_ == NULL ? y_ : y_ + m * i0, bound.value))
+	  return bound;
+#endif
+
+	return GetBound(i0, i1, ReproducibleIdentity());
+      }
+
+    return GetBound(i0, i1, index_);
+  }
+
+
+  //! Returns the sum of the scaled terms on the elements i0 to i1 - 1.
+  template<class T>
+  ReproducibleSum ReproducibleBlockKernel<T>::operator()(size_t i0,
+							 size_t i1) const
+  {
+    ReproducibleSum sum(zero_);
+    if (index_ == NULL)
+      {
+#ifdef SELDON_WITH_SIMD_DISPATCH
+	size_t m = IsComplex(type_) ? 2 : 1;
+	if (SimdSplitSum(type_, m * (i1 - i0), x_ + m * i0,
+			 y_ == NULL ? y_ : y_ + m * i0, scale_,
+			 sum.GetSigma(), sum.GetData()))
+	  return sum;
+#endif
+
+	AddTerms(i0, i1, ReproducibleIdentity(), sum);
+      }
+    else
+      AddTerms(i0, i1, index_, sum);
+
+    return sum;
+  }
+
+
+  //! Returns the number of terms of a reduction on n elements.
+  template<class T>
+  double ReproducibleBlockKernel<T>::GetNbTerm(int type, double n)
+  {
+    if (IsComplex(type))
+      return 2. * n;
+
+    return n;
+  }
+
+
+  //! Returns true if the reduction is performed on complex numbers.
+  template<class T>
+  bool ReproducibleBlockKernel<T>::IsComplex(int type)
+  {
+    return type == DOT_PROD_COMPLEX || type == DOT_PROD_CONJ
+      || type == SUM_SQUARE_COMPLEX;
+  }
+
+
+  //! Returns the maximal absolute value of the products on a block.
+  template<class T> template<class Index>
+  ReproducibleBound
+  ReproducibleBlockKernel<T>::GetBound(size_t i0, size_t i1,
+				       const Index& index) const
+  {
+    ReproducibleBound bound;
+    switch (type_)
+      {
+      case DOT_PROD:
+	for (size_t i = i0; i < i1; i++)
+	  {
+	    size_t j = index[i];
+	    bound += abs(double(x_[j]) * double(y_[j]));
+	  }
+	break;
+      case DOT_PROD_COMPLEX:
+      case DOT_PROD_CONJ:
+	for (size_t i = i0; i < i1; i++)
+	  {
+	    size_t j = 2*index[i];
+	    double x_r = x_[j], x_i = x_[j+1], y_r = y_[j], y_i = y_[j+1];
+	    bound += abs(x_r * y_r);
+	    bound += abs(x_i * y_i);
+	    bound += abs(x_r * y_i);
+	    bound += abs(x_i * y_r);
+	  }
+	break;
+      case SUM_SQUARE:
+	for (size_t i = i0; i < i1; i++)
+	  bound += abs(double(x_[index[i]]));
+	break;
+      case SUM_SQUARE_COMPLEX:
+	for (size_t i = i0; i < i1; i++)
+	  {
+	    size_t j = 2*index[i];
+	    bound += abs(double(x_[j]));
+	    bound += abs(double(x_[j+1]));
+	  }
+	break;
+      }
+
+    return bound;
+  }
+
+
+  //! Adds the scaled terms of the elements i0 to i1 - 1 to a sum.
+  /*!
+    The elements are processed by groups of four, each with its own sums,
+    so that the additions of consecutive elements are independent. Since
+    the sums of the levels are exact, the result does not depend on this
+    grouping.
+  */
+  template<class T> template<class Index>
+  SELDON_WITHOUT_FP_CONTRACT
+  void ReproducibleBlockKernel<T>::AddTerms(size_t i0, size_t i1,
+					    const Index& index,
+					    ReproducibleSum& sum) const
+  {
+#ifdef __clang__
+#pragma STDC FP_CONTRACT OFF
+#endif
+    const int nb_level = ReproducibleSum::NB_LEVEL;
+    const double* sigma = zero_.GetSigma();
+    double sum_r[4][nb_level], sum_i[4][nb_level];
+    for (int k = 0; k < 4; k++)
+      for (int l = 0; l < nb_level; l++)
+	{
+	  sum_r[k][l] = 0.;
+	  sum_i[k][l] = 0.;
+	}
+
+    double a = scale_;
+    size_t i = i0;
+    switch (type_)
+      {
+      case DOT_PROD:
+	for (; i + 4 <= i1; i += 4)
+	  for (int k = 0; k < 4; k++)
+	    {
+	      size_t j = index[i+k];
+	      ReproducibleSum::Deposit(double(x_[j]) * double(y_[j]) * a,
+				       sigma, sum_r[k]);
+	    }
+
+	for (; i < i1; i++)
+	  {
+	    size_t j = index[i];
+	    ReproducibleSum::Deposit(double(x_[j]) * double(y_[j]) * a,
+				     sigma, sum_r[0]);
+	  }
+	break;
+      case DOT_PROD_COMPLEX:
+      case DOT_PROD_CONJ:
+	{
+	  // conj(x).y = (x_r y_r + x_i y_i) + i (x_r y_i - x_i y_r)
+	  double sign = type_ == DOT_PROD_CONJ ? -1. : 1.;
+	  for (; i < i1; i++)
+	    {
+	      int k = i % 2;
+	      size_t j = 2*index[i];
+	      double x_r = x_[j], x_i = x_[j+1], y_r = y_[j], y_i = y_[j+1];
+	      ReproducibleSum::Deposit(x_r * y_r * a, sigma, sum_r[k]);
+	      ReproducibleSum::Deposit(-sign * (x_i * y_i) * a,
+				       sigma, sum_r[k+2]);
+	      ReproducibleSum::Deposit(x_r * y_i * a, sigma, sum_i[k]);
+	      ReproducibleSum::Deposit(sign * (x_i * y_r) * a,
+				       sigma, sum_i[k+2]);
+	    }
+	}
+	break;
+      case SUM_SQUARE:
+	for (; i + 4 <= i1; i += 4)
+	  for (int k = 0; k < 4; k++)
+	    {
+	      double u = double(x_[index[i+k]]) * a;
+	      ReproducibleSum::Deposit(u * u, sigma, sum_r[k]);
+	    }
+
+	for (; i < i1; i++)
+	  {
+	    double u = double(x_[index[i]]) * a;
+	    ReproducibleSum::Deposit(u * u, sigma, sum_r[0]);
+	  }
+	break;
+      case SUM_SQUARE_COMPLEX:
+	for (; i + 2 <= i1; i += 2)
+	  for (int k = 0; k < 2; k++)
+	    {
+	      size_t j = 2*index[i+k];
+	      double u = double(x_[j]) * a, v = double(x_[j+1]) * a;
+	      ReproducibleSum::Deposit(u * u, sigma, sum_r[2*k]);
+	      ReproducibleSum::Deposit(v * v, sigma, sum_r[2*k+1]);
+	    }
+
+	for (; i < i1; i++)
+	  {
+	    size_t j = 2*index[i];
+	    double u = double(x_[j]) * a, v = double(x_[j+1]) * a;
+	    ReproducibleSum::Deposit(u * u, sigma, sum_r[0]);
+	    ReproducibleSum::Deposit(v * v, sigma, sum_r[1]);
+	  }
+	break;
+      }
+
+    double* s = sum.GetData();
+    for (int k = 0; k < 4; k++)
+      for (int l = 0; l < nb_level; l++)
+	{
+	  s[l] += sum_r[k][l];
+	  s[nb_level + l] += sum_i[k][l];
+	}
+  }
+
+
+  // REPRODUCIBLEBLOCKKERNEL //
+  /////////////////////////////
+
+
+  //! Constructor.
+  template<class T>
+  ReproducibleBoundKernel<T>
+  ::ReproducibleBoundKernel(const ReproducibleBlockKernel<T>& kernel)
+    : kernel_(kernel)
+  {
+  }
+
+
+  //! Returns the maximal absolute value of the products on a block.
+  template<class T>
+  ReproducibleBound ReproducibleBoundKernel<T>::operator()(size_t i0,
+							   size_t i1) const
+  {
+    return kernel_.GetBound(i0, i1);
+  }
+
+
+  //! Returns the maximal absolute value of the products of a reduction.
+  /*!
+    \param[in] kernel reduction.
+    \param[in] n number of elements.
+    \return Maximal absolute value of the products (of the real and
+    imaginary parts for the sums of squares), NaN being ignored. It is Inf
+    if a product is infinite.
+  */
+  template<class T>
+  double ReproducibleMaxAbs(const ReproducibleBlockKernel<T>& kernel,
+			    size_t n)
+  {
+    return ParallelReduce(0, n, ReproducibleBoundKernel<T>(kernel),
+			  ReproducibleBound(),
+			  ReproducibleBlockKernel<T>::GRAIN_SIZE).value;
+  }
+
+
+  //! Adds the terms of a reduction to a sum, with the threads of Seldon.
+  /*!
+    \param[in] kernel reduction, whose scaling has been set.
+    \param[in] n number of elements.
+    \param[in,out] sum sum initialized with the same number of terms as the
+    kernel.
+  */
+  template<class T>
+  void ReproducibleAdd(const ReproducibleBlockKernel<T>& kernel, size_t n,
+		       ReproducibleSum& sum)
+  {
+    sum = ParallelReduce(0, n, kernel, sum,
+			 ReproducibleBlockKernel<T>::GRAIN_SIZE);
+  }
+
+
+  //! Computes a reduction whose result does not depend on the threads.
+  /*!
+    \param[in] type reduction (see ReproducibleBlockKernel).
+    \param[in] n number of elements.
+    \param[in] x first array.
+    \param[in] y second array (not read by the sums of squares).
+    \param[out] sum sum of the scaled terms.
+    \param[out] e exponent of the scaling. The result is the sum
+    multiplied by 2^e, or by 2^(2e) for the sums of squares.
+    \return false if a product is infinite, in which case the sum is not
+    computed. A NaN is propagated by the sum.
+  */
+  template<class T>
+  bool ReproducibleReduce(int type, size_t n, const T* x, const T* y,
+			  ReproducibleSum& sum, int& e)
+  {
+    e = 0;
+    ReproducibleBlockKernel<T> kernel(type, x, y);
+    double max_abs = ReproducibleMaxAbs(kernel, n);
+    if (!(max_abs <= numeric_limits<double>::max()))
+      return false;
+
+    // the terms are also summed if they are all zero, for the NaN
+    double nb_term = ReproducibleBlockKernel<T>::GetNbTerm(type, n);
+    sum.Init(nb_term);
+    e = GetReproducibleExponent(max_abs);
+    kernel.SetScale(ldexp(1., -e), nb_term);
+    ReproducibleAdd(kernel, n, sum);
+    return true;
+  }
+
+
+  /////////////
+  // DOTPROD //
+
+
+  //! Reproducible scalar product, not available for these vectors.
+  /*!
+    \return false, the usual scalar product has to be computed.
+  */
+  template<class T1, class Storage1, class Allocator1,
+	   class T2, class Storage2, class Allocator2>
+  bool ReproducibleDotProd(const Vector<T1, Storage1, Allocator1>&,
+			   const Vector<T2, Storage2, Allocator2>&,
+			   bool, T1&)
+  {
+    return false;
+  }
+
+
+  //! Reproducible scalar product X.Y.
+  /*!
+    \param[in] X first vector.
+    \param[in] Y second vector.
+    \param[out] value scalar product, computed in double precision.
+    \return false if a product is infinite, value is then not computed.
+    \note The third argument, true for conj(X).Y, has no effect on real
+    vectors.
+  */
+  template<class Allocator1, class Allocator2>
+  bool ReproducibleDotProd(const Vector<float, VectFull, Allocator1>& X,
+			   const Vector<float, VectFull, Allocator2>& Y,
+			   bool, float& value)
+  {
+    ReproducibleSum sum;
+    int e;
+    if (!ReproducibleReduce(ReproducibleBlockKernel<float>::DOT_PROD,
+			    X.GetM(), X.GetData(), Y.GetData(), sum, e))
+      return false;
+
+    value = ldexp(sum.GetReal(), e);
+    return true;
+  }
+
+
+  //! Reproducible scalar product X.Y.
+  template<class Allocator1, class Allocator2>
+  bool ReproducibleDotProd(const Vector<double, VectFull, Allocator1>& X,
+			   const Vector<double, VectFull, Allocator2>& Y,
+			   bool, double& value)
+  {
+    ReproducibleSum sum;
+    int e;
+    if (!ReproducibleReduce(ReproducibleBlockKernel<double>::DOT_PROD,
+			    X.GetM(), X.GetData(), Y.GetData(), sum, e))
+      return false;
+
+    value = ldexp(sum.GetReal(), e);
+    return true;
+  }
+
+
+  //! Reproducible scalar product X.Y or conj(X).Y.
+  template<class Allocator1, class Allocator2>
+  bool
+  ReproducibleDotProd(const Vector<complex<float>, VectFull, Allocator1>& X,
+		      const Vector<complex<float>, VectFull, Allocator2>& Y,
+		      bool conj, complex<float>& value)
+  {
+    typedef ReproducibleBlockKernel<float> Kernel;
+    ReproducibleSum sum;
+    int e;
+    if (!ReproducibleReduce(conj ? Kernel::DOT_PROD_CONJ
+			    : Kernel::DOT_PROD_COMPLEX, X.GetM(),
+			    reinterpret_cast<const float*>(X.GetData()),
+			    reinterpret_cast<const float*>(Y.GetData()),
+			    sum, e))
+      return false;
+
+    value = complex<float>(ldexp(sum.GetReal(), e),
+			   ldexp(sum.GetImag(), e));
+    return true;
+  }
+
+
+  //! Reproducible scalar product X.Y or conj(X).Y.
+  template<class Allocator1, class Allocator2>
+  bool
+  ReproducibleDotProd(const Vector<complex<double>, VectFull, Allocator1>& X,
+		      const Vector<complex<double>, VectFull, Allocator2>& Y,
+		      bool conj, complex<double>& value)
+  {
+    typedef ReproducibleBlockKernel<double> Kernel;
+    ReproducibleSum sum;
+    int e;
+    if (!ReproducibleReduce(conj ? Kernel::DOT_PROD_CONJ
+			    : Kernel::DOT_PROD_COMPLEX, X.GetM(),
+			    reinterpret_cast<const double*>(X.GetData()),
+			    reinterpret_cast<const double*>(Y.GetData()),
+			    sum, e))
+      return false;
+
+    value = complex<double>(ldexp(sum.GetReal(), e),
+			    ldexp(sum.GetImag(), e));
+    return true;
+  }
+
+
+  // DOTPROD //
+  /////////////
+
+
+  ///////////
+  // NORM2 //
+
+
+  //! Reproducible 2-norm, not available for this vector.
+  /*!
+    \return false, the usual 2-norm has to be computed.
+  */
+  template<class T1, class Storage1, class Allocator1>
+  bool ReproducibleNorm2(const Vector<T1, Storage1, Allocator1>& X,
+			 typename ClassComplexType<T1>::Treal& value)
+  {
+    return false;
+  }
+
+
+  //! Reproducible 2-norm.
+  /*!
+    \param[in] X vector.
+    \param[out] value 2-norm of X, computed without overflow nor underflow.
+    \return false if X contains Inf, value is then not computed.
+  */
+  template<class Allocator1>
+  bool ReproducibleNorm2(const Vector<float, VectFull, Allocator1>& X,
+			 float& value)
+  {
+    ReproducibleSum sum;
+    int e;
+    if (!ReproducibleReduce(ReproducibleBlockKernel<float>::SUM_SQUARE,
+			    X.GetM(), X.GetData(), (const float*) NULL,
+			    sum, e))
+      return false;
+
+    value = ldexp(sqrt(sum.GetReal()), e);
+    return true;
+  }
+
+
+  //! Reproducible 2-norm.
+  template<class Allocator1>
+  bool ReproducibleNorm2(const Vector<double, VectFull, Allocator1>& X,
+			 double& value)
+  {
+    ReproducibleSum sum;
+    int e;
+    if (!ReproducibleReduce(ReproducibleBlockKernel<double>::SUM_SQUARE,
+			    X.GetM(), X.GetData(), (const double*) NULL,
+			    sum, e))
+      return false;
+
+    value = ldexp(sqrt(sum.GetReal()), e);
+    return true;
+  }
+
+
+  //! Reproducible 2-norm.
+  template<class Allocator1>
+  bool ReproducibleNorm2(const Vector<complex<float>, VectFull,
+			 Allocator1>& X, float& value)
+  {
+    typedef ReproducibleBlockKernel<float> Kernel;
+    ReproducibleSum sum;
+    int e;
+    if (!ReproducibleReduce(Kernel::SUM_SQUARE_COMPLEX, X.GetM(),
+			    reinterpret_cast<const float*>(X.GetData()),
+			    (const float*) NULL, sum, e))
+      return false;
+
+    value = ldexp(sqrt(sum.GetReal()), e);
+    return true;
+  }
+
+
+  //! Reproducible 2-norm.
+  template<class Allocator1>
+  bool ReproducibleNorm2(const Vector<complex<double>, VectFull,
+			 Allocator1>& X, double& value)
+  {
+    typedef ReproducibleBlockKernel<double> Kernel;
+    ReproducibleSum sum;
+    int e;
+    if (!ReproducibleReduce(Kernel::SUM_SQUARE_COMPLEX, X.GetM(),
+			    reinterpret_cast<const double*>(X.GetData()),
+			    (const double*) NULL, sum, e))
+      return false;
+
+    value = ldexp(sqrt(sum.GetReal()), e);
+    return true;
+  }
+
+
+  // NORM2 //
+  ///////////
+
+
+} // namespace Seldon.
+
+#define SELDON_FILE_FUNCTIONS_VECTOR_REPRODUCIBLE_CXX
+#endif
@@ -0,0 +1,266 @@
+// Copyright (C) 2016 INRIA
+//
+// This file is part of the linear-algebra library Seldon,
+// http://seldon.sourceforge.net/.
+//
+// Seldon is free software; you can redistribute it and/or modify it under the
+// terms of the GNU Lesser General Public License as published by the Free
+// Software Foundation; either version 2.1 of the License, or (at your option)
+// any later version.
+//
+// Seldon is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for
+// more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with Seldon. If not, see http://www.gnu.org/licenses/.
+
+
+#ifndef SELDON_FILE_FUNCTIONS_VECTOR_REPRODUCIBLE_HXX
+
+#define SELDON_FILE_FUNCTIONS_VECTOR_REPRODUCIBLE_HXX
+
+
+/*
+  When ParallelContext::SetDeterministic(true) has been called, the
+  following functions return the same result, to the last bit, whatever the
+  number of threads, the number of MPI processes and the SIMD instruction
+  set:
+
+  DotProd(X, Y)
+  DotProdConj(X, Y)
+  Norm2(X)
+
+  for dense vectors of float, double, complex<float> and complex<double>
+  (with or without Blas), and for distributed vectors. The sums are computed
+  with the pre-rounded summation of Demmel and Nguyen ("Fast reproducible
+  floating-point summation", 2013): each term is split into parts lying on
+  fixed grids, so that the parts are added exactly, in any order. A first
+  pass computes the largest term, which sets the grids. If it is infinite,
+  the usual functions are called instead.
+
+  The code must not be compiled with -ffast-math or with the x87 unit
+  (32-bit x86 without SSE2), since the splitting relies on the rounding of
+  each operation.
+*/
+
+// A product must not be fused with the sum that splits it, otherwise the
+// parts of a term would depend on the inlining and vectorization of the loop.
+#if defined(__GNUC__) && !defined(__clang__)
+#define SELDON_WITHOUT_FP_CONTRACT __attribute__((optimize("fp-contract=off")))
+#else
+#define SELDON_WITHOUT_FP_CONTRACT
+#endif
+
+
+namespace Seldon
+{
+
+
+  //! Sum of real or complex numbers, independent of the order of the terms.
+  /*!
+    The terms must be lower than 1 in absolute value, and their number must
+    not exceed the number given to Init. Each term is split into NB_LEVEL
+    parts, the part of level l being a multiple of a power of 2 that only
+    depends on l and on the number of terms. The parts of each level are
+    summed exactly, so that two sums of the same terms are equal, whatever
+    the order of the terms and the way they are grouped (operator +=). The
+    error on the result is lower than 2^(-50) times the largest term for up
+    to 10^6 terms.
+  */
+  class ReproducibleSum
+  {
+  public:
+    //! number of parts of each term
+    enum {NB_LEVEL = 3};
+
+  protected:
+    //! offsets defining the grid of each level
+    double sigma_[NB_LEVEL];
+    //! sums of the real parts of the levels, then of the imaginary parts
+    double sum_[2*NB_LEVEL];
+
+  public:
+    ReproducibleSum();
+    explicit ReproducibleSum(double nb_term);
+
+    void Init(double nb_term);
+    void Zero();
+
+    const double* GetSigma() const;
+    int GetDataSize() const;
+    double* GetData();
+    const double* GetData() const;
+
+    void Add(double x);
+    void Add(double x_r, double x_i);
+
+    ReproducibleSum& operator+=(const ReproducibleSum& s);
+    ReproducibleSum& operator-=(const ReproducibleSum& s);
+
+    double GetReal() const;
+    double GetImag() const;
+
+    static void Deposit(double x, const double* sigma, double* sum);
+  };
+
+
+  //! Maximal absolute value, combined by operator +=.
+  /*!
+    This class is given to ParallelReduce, which adds the values of the
+    blocks. NaN is ignored, and is propagated by the sums instead.
+  */
+  class ReproducibleBound
+  {
+  public:
+    double value;
+
+    ReproducibleBound(double x = 0.);
+
+    ReproducibleBound& operator+=(const ReproducibleBound& b);
+  };
+
+
+  //! Terms of a reproducible reduction, computed on a block of elements.
+  /*!
+    Function object given to ParallelReduce. The values are read in arrays
+    of real numbers (interleaved real and imaginary parts for complex
+    numbers). The terms are computed in double precision, the products of
+    two float being exact.
+  */
+  template<class T>
+  class ReproducibleBlockKernel
+  {
+  public:
+    //! Reductions: x.y, x.y and conj(x).y for complex numbers, |x|^2.
+    enum {DOT_PROD, DOT_PROD_COMPLEX, DOT_PROD_CONJ, SUM_SQUARE,
+	  SUM_SQUARE_COMPLEX};
+
+    //! minimal number of elements per thread
+    enum {GRAIN_SIZE = 16384};
+
+  protected:
+    int type_;
+    const T* x_;
+    const T* y_;
+    //! element numbers (NULL for all the elements)
+    const size_t* index_;
+    //! scaling factor of the terms (products for SUM_SQUARE)
+    double scale_;
+    //! sum with the grid of the terms, and no term
+    ReproducibleSum zero_;
+
+  public:
+    ReproducibleBlockKernel(int type, const T* x, const T* y,
+			    const size_t* index = NULL);
+
+    void SetScale(double scale, double nb_term);
+    double GetScale() const;
+
+    ReproducibleBound GetBound(size_t i0, size_t i1) const;
+    ReproducibleSum operator()(size_t i0, size_t i1) const;
+
+    static double GetNbTerm(int type, double n);
+    static bool IsComplex(int type);
+
+  protected:
+    template<class Index>
+    ReproducibleBound GetBound(size_t i0, size_t i1,
+			       const Index& index) const;
+
+    template<class Index>
+    void AddTerms(size_t i0, size_t i1, const Index& index,
+		  ReproducibleSum& sum) const;
+  };
+
+
+  //! Element numbers of a contiguous block.
+  class ReproducibleIdentity
+  {
+  public:
+    size_t operator[](size_t i) const;
+  };
+
+
+  //! Function object computing the bound of ReproducibleBlockKernel.
+  template<class T>
+  class ReproducibleBoundKernel
+  {
+  protected:
+    const ReproducibleBlockKernel<T>& kernel_;
+
+  public:
+    ReproducibleBoundKernel(const ReproducibleBlockKernel<T>& kernel);
+
+    ReproducibleBound operator()(size_t i0, size_t i1) const;
+  };
+
+
+  template<class T>
+  double ReproducibleMaxAbs(const ReproducibleBlockKernel<T>& kernel,
+			    size_t n);
+
+  template<class T>
+  void ReproducibleAdd(const ReproducibleBlockKernel<T>& kernel, size_t n,
+		       ReproducibleSum& sum);
+
+  int GetReproducibleExponent(double max_abs);
+
+  template<class T>
+  bool ReproducibleReduce(int type, size_t n, const T* x, const T* y,
+			  ReproducibleSum& sum, int& e);
+
+
+  template<class T1, class Storage1, class Allocator1,
+	   class T2, class Storage2, class Allocator2>
+  bool ReproducibleDotProd(const Vector<T1, Storage1, Allocator1>& X,
+			   const Vector<T2, Storage2, Allocator2>& Y,
+			   bool conj, T1& value);
+
+  template<class Allocator1, class Allocator2>
+  bool ReproducibleDotProd(const Vector<float, VectFull, Allocator1>& X,
+			   const Vector<float, VectFull, Allocator2>& Y,
+			   bool conj, float& value);
+
+  template<class Allocator1, class Allocator2>
+  bool ReproducibleDotProd(const Vector<double, VectFull, Allocator1>& X,
+			   const Vector<double, VectFull, Allocator2>& Y,
+			   bool conj, double& value);
+
+  template<class Allocator1, class Allocator2>
+  bool
+  ReproducibleDotProd(const Vector<complex<float>, VectFull, Allocator1>& X,
+		      const Vector<complex<float>, VectFull, Allocator2>& Y,
+		      bool conj, complex<float>& value);
+
+  template<class Allocator1, class Allocator2>
+  bool
+  ReproducibleDotProd(const Vector<complex<double>, VectFull, Allocator1>& X,
+		      const Vector<complex<double>, VectFull, Allocator2>& Y,
+		      bool conj, complex<double>& value);
+
+  template<class T1, class Storage1, class Allocator1>
+  bool ReproducibleNorm2(const Vector<T1, Storage1, Allocator1>& X,
+			 typename ClassComplexType<T1>::Treal& value);
+
+  template<class Allocator1>
+  bool ReproducibleNorm2(const Vector<float, VectFull, Allocator1>& X,
+			 float& value);
+
+  template<class Allocator1>
+  bool ReproducibleNorm2(const Vector<double, VectFull, Allocator1>& X,
+			 double& value);
+
+  template<class Allocator1>
+  bool ReproducibleNorm2(const Vector<complex<float>, VectFull,
+			 Allocator1>& X, float& value);
+
+  template<class Allocator1>
+  bool ReproducibleNorm2(const Vector<complex<double>, VectFull,
+			 Allocator1>& X, double& value);
+
+
+} // namespace Seldon.
+
+#endif
@@ -0,0 +1,249 @@
+// Copyright (C) 2016 INRIA
+//
+// This file is part of the linear-algebra library Seldon,
+// http://seldon.sourceforge.net/.
+//
+// Seldon is free software; you can redistribute it and/or modify it under the
+// terms of the GNU Lesser General Public License as published by the Free
+// Software Foundation; either version 2.1 of the License, or (at your option)
+// any later version.
+//
+// Seldon is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for
+// more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with Seldon. If not, see http://www.gnu.org/licenses/.
+
+
+#ifndef SELDON_FILE_FUNCTIONS_VECTOR_REPRODUCIBLE_INLINE_CXX
+
+#include "Functions_VectorReproducible.hxx"
+
+namespace Seldon
+{
+
+
+  /////////////////////
+  // REPRODUCIBLESUM //
+
+
+  //! Default constructor.
+  /*!
+    The sum can only receive a single term, Init must be called otherwise.
+  */
+  inline ReproducibleSum::ReproducibleSum()
+  {
+    Init(1.);
+  }
+
+
+  //! Constructor.
+  /*!
+    \param[in] nb_term maximal number of terms of the sum.
+  */
+  inline ReproducibleSum::ReproducibleSum(double nb_term)
+  {
+    Init(nb_term);
+  }
+
+
+  //! Sets the grids of the levels for a given number of terms.
+  /*!
+    \param[in] nb_term maximal number of terms of the sum (2^50 at most).
+    The sum is set to 0. Two sums may be added only if they have been
+    initialized with the same number of terms.
+  */
+  inline void ReproducibleSum::Init(double nb_term)
+  {
+    // nb_term <= 2^L
+    int L = 0;
+    if (nb_term > 1.)
+      frexp(nb_term, &L);
+
+    if (L > 50)
+      throw WrongArgument("ReproducibleSum::Init(double)",
+			  "The number of terms must not exceed 2^50.");
+
+    // the terms of level l are lower than 2^e with e = l (L - 52), their
+    // parts are multiples of 2^(e + L - 52), so that the sum of 2^L parts
+    // is exact
+    for (int l = 0; l < NB_LEVEL; l++)
+      sigma_[l] = ldexp(1., l * (L - 52) + L + 1);
+
+    Zero();
+  }
+
+
+  //! Sets the sum to 0.
+  inline void ReproducibleSum::Zero()
+  {
+    for (int l = 0; l < 2*NB_LEVEL; l++)
+      sum_[l] = 0.;
+  }
+
+
+  //! Returns the offsets defining the grids of the levels.
+  inline const double* ReproducibleSum::GetSigma() const
+  {
+    return sigma_;
+  }
+
+
+  //! Returns the number of values returned by GetData.
+  inline int ReproducibleSum::GetDataSize() const
+  {
+    return 2*NB_LEVEL;
+  }
+
+
+  //! Returns the sums of the levels.
+  /*!
+    The sums of the real parts are followed by the sums of the imaginary
+    parts. They can be added to the sums of another process (by
+    MPI_Allreduce with MPI_SUM for instance), the additions being exact.
+  */
+  inline double* ReproducibleSum::GetData()
+  {
+    return sum_;
+  }
+
+
+  //! Returns the sums of the levels.
+  inline const double* ReproducibleSum::GetData() const
+  {
+    return sum_;
+  }
+
+
+  //! Adds a real term.
+  inline void ReproducibleSum::Add(double x)
+  {
+    Deposit(x, sigma_, sum_);
+  }
+
+
+  //! Adds a complex term.
+  inline void ReproducibleSum::Add(double x_r, double x_i)
+  {
+    Deposit(x_r, sigma_, sum_);
+    Deposit(x_i, sigma_, sum_ + NB_LEVEL);
+  }
+
+
+  //! Adds the terms of another sum, with the same grids.
+  inline ReproducibleSum& ReproducibleSum::operator+=(const ReproducibleSum& s)
+  {
+    for (int l = 0; l < 2*NB_LEVEL; l++)
+      sum_[l] += s.sum_[l];
+
+    return *this;
+  }
+
+
+  //! Removes terms that have been added to this sum, with the same grids.
+  inline ReproducibleSum& ReproducibleSum::operator-=(const ReproducibleSum& s)
+  {
+    for (int l = 0; l < 2*NB_LEVEL; l++)
+      sum_[l] -= s.sum_[l];
+
+    return *this;
+  }
+
+
+  //! Returns the sum of the real parts.
+  inline double ReproducibleSum::GetReal() const
+  {
+    return sum_[0] + (sum_[1] + sum_[2]);
+  }
+
+
+  //! Returns the sum of the imaginary parts.
+  inline double ReproducibleSum::GetImag() const
+  {
+    return sum_[NB_LEVEL] + (sum_[NB_LEVEL+1] + sum_[NB_LEVEL+2]);
+  }
+
+
+  //! Splits a term and adds its parts to the sums of the levels.
+  /*!
+    \param[in] x term, lower than 1 in absolute value.
+    \param[in] sigma offsets of the levels.
+    \param[in,out] sum sums of the levels.
+    The part of level l is (sigma[l] + x) - sigma[l], computed exactly, and
+    the remainder is split by the following levels. The remainder of the
+    last level is neglected.
+  */
+  inline SELDON_WITHOUT_FP_CONTRACT
+  void ReproducibleSum::Deposit(double x, const double* sigma, double* sum)
+  {
+#ifdef __clang__
+#pragma STDC FP_CONTRACT OFF
+#endif
+    for (int l = 0; l < NB_LEVEL; l++)
+      {
+	double q = (sigma[l] + x) - sigma[l];
+	sum[l] += q;
+	x -= q;
+      }
+  }
+
+
+  // REPRODUCIBLESUM //
+  /////////////////////
+
+
+  ///////////////////////
+  // REPRODUCIBLEBOUND //
+
+
+  //! Constructor.
+  inline ReproducibleBound::ReproducibleBound(double x)
+    : value(x)
+  {
+  }
+
+
+  //! Keeps the maximum of the two values, NaN being ignored.
+  inline ReproducibleBound&
+  ReproducibleBound::operator+=(const ReproducibleBound& b)
+  {
+    if (b.value > value)
+      value = b.value;
+
+    return *this;
+  }
+
+
+  // REPRODUCIBLEBOUND //
+  ///////////////////////
+
+
+  //! Returns the number of an element in a contiguous block.
+  inline size_t ReproducibleIdentity::operator[](size_t i) const
+  {
+    return i;
+  }
+
+
+  //! Returns the exponent used to scale the terms of a reproducible sum.
+  /*!
+    \param[in] max_abs maximal absolute value of the terms (of the values
+    for a sum of squares), finite and positive.
+    \return Exponent e such that max_abs < 2^e. The terms multiplied by
+    2^(-e) (or the squares of the values multiplied by 2^(-e)) are lower
+    than 1. The exponent is bounded so that 2^(-e) is finite.
+  */
+  inline int GetReproducibleExponent(double max_abs)
+  {
+    int e;
+    frexp(max_abs, &e);
+    return max(e, 1 - numeric_limits<double>::max_exponent);
+  }
+
+
+} // namespace Seldon.
+
+#define SELDON_FILE_FUNCTIONS_VECTOR_REPRODUCIBLE_INLINE_CXX
+#endif
@@ -0,0 +1,1695 @@
+// Copyright (C) 2016 INRIA
+//
+// This file is part of the linear-algebra library Seldon,
+// http://seldon.sourceforge.net/.
+//
+// Seldon is free software; you can redistribute it and/or modify it under the
+// terms of the GNU Lesser General Public License as published by the Free
+// Software Foundation; either version 2.1 of the License, or (at your option)
+// any later version.
+//
+// Seldon is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for
+// more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with Seldon. If not, see http://www.gnu.org/licenses/.
+
+
+#ifndef SELDON_FILE_FUNCTIONS_VECTOR_SIMD_CXX
+
+#include "Functions_VectorSimd.hxx"
+
+#ifdef SELDON_WITH_SIMD_DISPATCH
+
+#include <limits>
+
+
+namespace Seldon
+{
+
+
+  //////////////////
+  // SIMD KERNELS //
+
+
+  //! Pack of real numbers processed by one SIMD instruction.
+  /*!
+    SwapPairs exchanges the real and imaginary parts of the complex numbers
+    stored in a pack.
+  */
+  template<class T, int nb_bytes>
+  class SimdPack;
+
+  template<>
+  class SimdPack<float, 16>
+  {
+  public:
+    typedef float vect_type __attribute__((vector_size(16)));
+    typedef int mask_type __attribute__((vector_size(16)));
+    enum {size = 4};
+
+    static inline __attribute__((always_inline))
+    void SwapPairs(const vect_type& x, vect_type& y)
+    {
+#ifdef __clang__
+      y = __builtin_shufflevector(x, x, 1, 0, 3, 2);
+#else
+      y = __builtin_shuffle(x, (mask_type) {1, 0, 3, 2});
+#endif
+    }
+  };
+
+
+  template<>
+  class SimdPack<float, 32>
+  {
+  public:
+    typedef float vect_type __attribute__((vector_size(32)));
+    typedef int mask_type __attribute__((vector_size(32)));
+    enum {size = 8};
+
+    static inline __attribute__((always_inline))
+    void SwapPairs(const vect_type& x, vect_type& y)
+    {
+#ifdef __clang__
+      y = __builtin_shufflevector(x, x, 1, 0, 3, 2, 5, 4, 7, 6);
+#else
+      y = __builtin_shuffle(x, (mask_type) {1, 0, 3, 2, 5, 4, 7, 6});
+#endif
+    }
+  };
+
+
+  template<>
+  class SimdPack<float, 64>
+  {
+  public:
+    typedef float vect_type __attribute__((vector_size(64)));
+    typedef int mask_type __attribute__((vector_size(64)));
+    enum {size = 16};
+
+    static inline __attribute__((always_inline))
+    void SwapPairs(const vect_type& x, vect_type& y)
+    {
+#ifdef __clang__
+      y = __builtin_shufflevector(x, x, 1, 0, 3, 2, 5, 4, 7, 6,
+				  9, 8, 11, 10, 13, 12, 15, 14);
+#else
+      y = __builtin_shuffle(x, (mask_type) {1, 0, 3, 2, 5, 4, 7, 6,
+					      9, 8, 11, 10, 13, 12, 15, 14});
+#endif
+    }
+  };
+
+
+  template<>
+  class SimdPack<double, 16>
+  {
+  public:
+    typedef double vect_type __attribute__((vector_size(16)));
+    typedef long long mask_type __attribute__((vector_size(16)));
+    enum {size = 2};
+
+    static inline __attribute__((always_inline))
+    void SwapPairs(const vect_type& x, vect_type& y)
+    {
+#ifdef __clang__
+      y = __builtin_shufflevector(x, x, 1, 0);
+#else
+      y = __builtin_shuffle(x, (mask_type) {1, 0});
+#endif
+    }
+  };
+
+
+  template<>
+  class SimdPack<double, 32>
+  {
+  public:
+    typedef double vect_type __attribute__((vector_size(32)));
+    typedef long long mask_type __attribute__((vector_size(32)));
+    enum {size = 4};
+
+    static inline __attribute__((always_inline))
+    void SwapPairs(const vect_type& x, vect_type& y)
+    {
+#ifdef __clang__
+      y = __builtin_shufflevector(x, x, 1, 0, 3, 2);
+#else
+      y = __builtin_shuffle(x, (mask_type) {1, 0, 3, 2});
+#endif
+    }
+  };
+
+
+  template<>
+  class SimdPack<double, 64>
+  {
+  public:
+    typedef double vect_type __attribute__((vector_size(64)));
+    typedef long long mask_type __attribute__((vector_size(64)));
+    enum {size = 8};
+
+    static inline __attribute__((always_inline))
+    void SwapPairs(const vect_type& x, vect_type& y)
+    {
+#ifdef __clang__
+      y = __builtin_shufflevector(x, x, 1, 0, 3, 2, 5, 4, 7, 6);
+#else
+      y = __builtin_shuffle(x, (mask_type) {1, 0, 3, 2, 5, 4, 7, 6});
+#endif
+    }
+  };
+
+  //! Vector kernels written with packs of nb_bytes bytes.
+  /*!
+    These functions are always inlined: they are compiled with the
+    instruction set of the functions that call them (see SimdKernelSse2,
+    SimdKernelAvx2 and SimdKernelAvx512).
+  */
+  template<class T, int nb_bytes>
+  class SimdVectorKernel
+  {
+    typedef SimdPack<T, nb_bytes> Pack;
+    typedef typename Pack::vect_type vect_type;
+    typedef typename Pack::mask_type mask_type;
+    enum {p = Pack::size};
+
+    static inline __attribute__((always_inline))
+    void Load(const T* x, vect_type& u)
+    {
+      __builtin_memcpy(&u, x, sizeof(vect_type));
+    }
+
+    static inline __attribute__((always_inline))
+    void Store(const vect_type& u, T* x)
+    {
+      __builtin_memcpy(x, &u, sizeof(vect_type));
+    }
+
+    static inline __attribute__((always_inline))
+    void Fill(T a, vect_type& u)
+    {
+      for (int k = 0; k < p; k++)
+	u[k] = a;
+    }
+
+    //! Sets u = (a, b, a, b, ...).
+    static inline __attribute__((always_inline))
+    void FillAlternate(T a, T b, vect_type& u)
+    {
+      for (int k = 0; k < p; k += 2)
+	{
+	  u[k] = a;
+	  u[k+1] = b;
+	}
+    }
+
+    //! Copies the bits of u in m (a cast would convert the values).
+    static inline __attribute__((always_inline))
+    void GetBits(const vect_type& u, mask_type& m)
+    {
+      __builtin_memcpy(&m, &u, sizeof(vect_type));
+    }
+
+    static inline __attribute__((always_inline))
+    void SetBits(const mask_type& m, vect_type& u)
+    {
+      __builtin_memcpy(&u, &m, sizeof(vect_type));
+    }
+
+    //! Clears the sign bits.
+    static inline __attribute__((always_inline))
+    void Abs(vect_type& u)
+    {
+      mask_type m, sign;
+      GetBits(-vect_type(), sign);
+      GetBits(u, m);
+      SetBits(m & ~sign, u);
+    }
+
+    //! Replaces the elements of s by those of u that are greater.
+    static inline __attribute__((always_inline))
+    void SelectMax(const vect_type& u, vect_type& s)
+    {
+      // NaN are not selected since the comparison is false
+      mask_type c = u > s, mu, ms;
+      GetBits(u, mu);
+      GetBits(s, ms);
+      SetBits((mu & c) | (ms & ~c), s);
+    }
+
+    //! Splits the terms t and adds their parts to the sums of the levels.
+    static inline __attribute__((always_inline))
+    void Deposit(const vect_type& x, const vect_type* sigma, vect_type* sum)
+    {
+      vect_type t = x;
+      for (int l = 0; l < ReproducibleSum::NB_LEVEL; l++)
+	{
+	  vect_type q = (sigma[l] + t) - sigma[l];
+	  sum[l] += q;
+	  t -= q;
+	}
+    }
+
+    //! Splits the term t and adds its parts to the sums of the levels.
+    static inline __attribute__((always_inline))
+    void Deposit(T t, const T* sigma, T* sum)
+    {
+      for (int l = 0; l < ReproducibleSum::NB_LEVEL; l++)
+	{
+	  T q = (sigma[l] + t) - sigma[l];
+	  sum[l] += q;
+	  t -= q;
+	}
+    }
+
+    static inline __attribute__((always_inline))
+    T Sum(const vect_type& u)
+    {
+      T value(0);
+      for (int k = 0; k < p; k++)
+	value += u[k];
+
+      return value;
+    }
+
+  public:
+
+    static inline __attribute__((always_inline))
+    void Mlt(size_t n, T alpha, T* x)
+    {
+      vect_type a, u, v;
+      Fill(alpha, a);
+      size_t i = 0;
+      for (; i + 2*p <= n; i += 2*p)
+	{
+	  Load(x + i, u);
+	  Load(x + i + p, v);
+	  u *= a;
+	  v *= a;
+	  Store(u, x + i);
+	  Store(v, x + i + p);
+	}
+
+      for (; i < n; i++)
+	x[i] *= alpha;
+    }
+
+    static inline __attribute__((always_inline))
+    void MltComplex(size_t n, T alpha_r, T alpha_i, T* x)
+    {
+      // (a_r + i a_i) (x_r + i x_i) = a_r (x_r, x_i) + (-a_i, a_i) (x_i, x_r)
+      vect_type a, b, u, w;
+      Fill(alpha_r, a);
+      FillAlternate(-alpha_i, alpha_i, b);
+      size_t m = 2*n, i = 0;
+      for (; i + p <= m; i += p)
+	{
+	  Load(x + i, u);
+	  Pack::SwapPairs(u, w);
+	  u = a * u + b * w;
+	  Store(u, x + i);
+	}
+
+      for (; i < m; i += 2)
+	{
+	  T x_r = x[i], x_i = x[i+1];
+	  x[i] = alpha_r * x_r - alpha_i * x_i;
+	  x[i+1] = alpha_r * x_i + alpha_i * x_r;
+	}
+    }
+
+    static inline __attribute__((always_inline))
+    void Add(size_t n, T alpha, const T* x, T* y)
+    {
+      vect_type a, u, v, w, z;
+      Fill(alpha, a);
+      size_t i = 0;
+      for (; i + 2*p <= n; i += 2*p)
+	{
+	  Load(x + i, u);
+	  Load(x + i + p, v);
+	  Load(y + i, w);
+	  Load(y + i + p, z);
+	  w += a * u;
+	  z += a * v;
+	  Store(w, y + i);
+	  Store(z, y + i + p);
+	}
+
+      for (; i < n; i++)
+	y[i] += alpha * x[i];
+    }
+
+    static inline __attribute__((always_inline))
+    void AddComplex(size_t n, T alpha_r, T alpha_i, const T* x, T* y)
+    {
+      vect_type a, b, u, w, z;
+      Fill(alpha_r, a);
+      FillAlternate(-alpha_i, alpha_i, b);
+      size_t m = 2*n, i = 0;
+      for (; i + p <= m; i += p)
+	{
+	  Load(x + i, u);
+	  Load(y + i, z);
+	  Pack::SwapPairs(u, w);
+	  z += a * u + b * w;
+	  Store(z, y + i);
+	}
+
+      for (; i < m; i += 2)
+	{
+	  y[i] += alpha_r * x[i] - alpha_i * x[i+1];
+	  y[i+1] += alpha_r * x[i+1] + alpha_i * x[i];
+	}
+    }
+
+    static inline __attribute__((always_inline))
+    T DotProd(size_t n, const T* x, const T* y)
+    {
+      vect_type s0 = vect_type(), s1 = s0, s2 = s0, s3 = s0, u, v;
+      size_t i = 0;
+      for (; i + 4*p <= n; i += 4*p)
+	{
+	  Load(x + i, u);
+	  Load(y + i, v);
+	  s0 += u * v;
+	  Load(x + i + p, u);
+	  Load(y + i + p, v);
+	  s1 += u * v;
+	  Load(x + i + 2*p, u);
+	  Load(y + i + 2*p, v);
+	  s2 += u * v;
+	  Load(x + i + 3*p, u);
+	  Load(y + i + 3*p, v);
+	  s3 += u * v;
+	}
+
+      for (; i + p <= n; i += p)
+	{
+	  Load(x + i, u);
+	  Load(y + i, v);
+	  s0 += u * v;
+	}
+
+      T value = Sum((s0 + s1) + (s2 + s3));
+      for (; i < n; i++)
+	value += x[i] * y[i];
+
+      return value;
+    }
+
+    static inline __attribute__((always_inline))
+    void DotProdComplex(size_t n, const T* x, const T* y, bool conj,
+			T& value_r, T& value_i)
+    {
+      // the products x_r y_r, x_i y_i are accumulated in s_r,
+      // and the products x_r y_i, x_i y_r in s_i
+      vect_type s_r0 = vect_type(), s_r1 = s_r0, s_i0 = s_r0, s_i1 = s_r0;
+      vect_type u, v, w;
+      size_t m = 2*n, i = 0;
+      for (; i + 2*p <= m; i += 2*p)
+	{
+	  Load(x + i, u);
+	  Load(y + i, v);
+	  Pack::SwapPairs(v, w);
+	  s_r0 += u * v;
+	  s_i0 += u * w;
+	  Load(x + i + p, u);
+	  Load(y + i + p, v);
+	  Pack::SwapPairs(v, w);
+	  s_r1 += u * v;
+	  s_i1 += u * w;
+	}
+
+      for (; i + p <= m; i += p)
+	{
+	  Load(x + i, u);
+	  Load(y + i, v);
+	  Pack::SwapPairs(v, w);
+	  s_r0 += u * v;
+	  s_i0 += u * w;
+	}
+
+      vect_type sign;
+      FillAlternate(T(1), T(-1), sign);
+      s_r0 += s_r1;
+      s_i0 += s_i1;
+      if (conj)
+	{
+	  value_r = Sum(s_r0);
+	  value_i = Sum(sign * s_i0);
+	  for (; i < m; i += 2)
+	    {
+	      value_r += x[i] * y[i] + x[i+1] * y[i+1];
+	      value_i += x[i] * y[i+1] - x[i+1] * y[i];
+	    }
+	}
+      else
+	{
+	  value_r = Sum(sign * s_r0);
+	  value_i = Sum(s_i0);
+	  for (; i < m; i += 2)
+	    {
+	      value_r += x[i] * y[i] - x[i+1] * y[i+1];
+	      value_i += x[i] * y[i+1] + x[i+1] * y[i];
+	    }
+	}
+    }
+
+    static inline __attribute__((always_inline))
+    T Norm1(size_t n, const T* x)
+    {
+      vect_type s0 = vect_type(), s1 = s0, s2 = s0, s3 = s0, u;
+      size_t i = 0;
+      for (; i + 4*p <= n; i += 4*p)
+	{
+	  Load(x + i, u);
+	  Abs(u);
+	  s0 += u;
+	  Load(x + i + p, u);
+	  Abs(u);
+	  s1 += u;
+	  Load(x + i + 2*p, u);
+	  Abs(u);
+	  s2 += u;
+	  Load(x + i + 3*p, u);
+	  Abs(u);
+	  s3 += u;
+	}
+
+      for (; i + p <= n; i += p)
+	{
+	  Load(x + i, u);
+	  Abs(u);
+	  s0 += u;
+	}
+
+      T value = Sum((s0 + s1) + (s2 + s3));
+      for (; i < n; i++)
+	value += x[i] < T(0) ? -x[i] : x[i];
+
+      return value;
+    }
+
+    //! Returns the sum of |x_i|, for n complex numbers.
+    /*!
+      The squared moduli are computed by packs, the square roots one by
+      one. Squares of values greater than the square root of the largest
+      number overflow.
+    */
+    static inline __attribute__((always_inline))
+    T Norm1Complex(size_t n, const T* x)
+    {
+      vect_type u, v, w;
+      T value(0);
+      size_t i = 0;
+      for (; i + 2*p <= 2*n; i += 2*p)
+	{
+	  Load(x + i, u);
+	  Load(x + i + p, v);
+	  u *= u;
+	  v *= v;
+	  Pack::SwapPairs(u, w);
+	  u += w;
+	  Pack::SwapPairs(v, w);
+	  v += w;
+	  for (int k = 0; k < p; k += 2)
+	    value += sqrt(u[k]) + sqrt(v[k]);
+	}
+
+      for (; i < 2*n; i += 2)
+	value += sqrt(x[i] * x[i] + x[i+1] * x[i+1]);
+
+      return value;
+    }
+
+    static inline __attribute__((always_inline))
+    T SumSquareScaled(size_t n, const T* x, T scale)
+    {
+      vect_type s0 = vect_type(), s1 = s0, s2 = s0, s3 = s0, a, u;
+      Fill(scale, a);
+      size_t i = 0;
+      for (; i + 4*p <= n; i += 4*p)
+	{
+	  Load(x + i, u);
+	  u *= a;
+	  s0 += u * u;
+	  Load(x + i + p, u);
+	  u *= a;
+	  s1 += u * u;
+	  Load(x + i + 2*p, u);
+	  u *= a;
+	  s2 += u * u;
+	  Load(x + i + 3*p, u);
+	  u *= a;
+	  s3 += u * u;
+	}
+
+      for (; i + p <= n; i += p)
+	{
+	  Load(x + i, u);
+	  u *= a;
+	  s0 += u * u;
+	}
+
+      T value = Sum((s0 + s1) + (s2 + s3));
+      for (; i < n; i++)
+	value += (scale * x[i]) * (scale * x[i]);
+
+      return value;
+    }
+
+    static inline __attribute__((always_inline))
+    T SumSquare(size_t n, const T* x)
+    {
+      return SumSquareScaled(n, x, T(1));
+    }
+
+    static inline __attribute__((always_inline))
+    T MaxAbs(size_t n, const T* x)
+    {
+      vect_type s = vect_type(), u;
+      size_t i = 0;
+      for (; i + p <= n; i += p)
+	{
+	  Load(x + i, u);
+	  Abs(u);
+	  SelectMax(u, s);
+	}
+
+      T value(0), a;
+      for (int k = 0; k < p; k++)
+	if (s[k] > value)
+	  value = s[k];
+
+      for (; i < n; i++)
+	{
+	  a = x[i] < T(0) ? -x[i] : x[i];
+	  if (a > value)
+	    value = a;
+	}
+
+      return value;
+    }
+
+    static inline __attribute__((always_inline))
+    T MaxAbsProd(size_t n, const T* x, const T* y, bool cross)
+    {
+      vect_type s = vect_type(), u, v, w;
+      size_t i = 0;
+      for (; i + p <= n; i += p)
+	{
+	  Load(x + i, u);
+	  Load(y + i, v);
+	  w = u * v;
+	  Abs(w);
+	  SelectMax(w, s);
+	  if (cross)
+	    {
+	      Pack::SwapPairs(v, w);
+	      w *= u;
+	      Abs(w);
+	      SelectMax(w, s);
+	    }
+	}
+
+      T value(0), a;
+      for (int k = 0; k < p; k++)
+	if (s[k] > value)
+	  value = s[k];
+
+      for (; i < n; i++)
+	{
+	  a = x[i] * y[i];
+	  a = a < T(0) ? -a : a;
+	  if (a > value)
+	    value = a;
+
+	  if (cross)
+	    {
+	      a = x[i] * y[i^1];
+	      a = a < T(0) ? -a : a;
+	      if (a > value)
+		value = a;
+	    }
+	}
+
+      return value;
+    }
+
+    static inline __attribute__((always_inline))
+    void Convert(size_t n, const T* x, double* y)
+    {
+      // the loop on a full block is vectorized by the compiler
+      if (n == size_t(SimdKernelTable<T>::BLOCK_SIZE))
+	for (size_t i = 0; i < size_t(SimdKernelTable<T>::BLOCK_SIZE); i++)
+	  y[i] = x[i];
+      else
+	for (size_t i = 0; i < n; i++)
+	  y[i] = x[i];
+    }
+
+    //! Adds the parts of the terms of a reproducible sum to the levels.
+    /*!
+      The terms are the same as in ReproducibleBlockKernel, computed with
+      the same operations, so that they are split identically by all the
+      instruction sets. The sums of the levels are exact, therefore the
+      result does not depend on the number of elements of a pack.
+    */
+    static inline __attribute__((always_inline))
+    void SplitSum(size_t n, const T* x, const T* y, int type, T scale,
+		  const T* sigma, T* sum)
+    {
+      typedef ReproducibleBlockKernel<T> Reduction;
+      const int nb_level = ReproducibleSum::NB_LEVEL;
+      vect_type sig[nb_level], s0[nb_level], s1[nb_level], a, b, c, u, v, w;
+      for (int l = 0; l < nb_level; l++)
+	{
+	  Fill(sigma[l], sig[l]);
+	  s0[l] = vect_type();
+	  s1[l] = vect_type();
+	}
+
+      Fill(scale, a);
+      size_t i = 0;
+      switch (type)
+	{
+	case Reduction::DOT_PROD:
+	  for (; i + 2*p <= n; i += 2*p)
+	    {
+	      Load(x + i, u);
+	      Load(y + i, v);
+	      Deposit(u * v * a, sig, s0);
+	      Load(x + i + p, u);
+	      Load(y + i + p, v);
+	      Deposit(u * v * a, sig, s1);
+	    }
+
+	  for (; i < n; i++)
+	    Deposit(x[i] * y[i] * scale, sigma, sum);
+	  break;
+	case Reduction::DOT_PROD_COMPLEX:
+	case Reduction::DOT_PROD_CONJ:
+	  {
+	    // real parts in s0, imaginary parts in s1
+	    T sign = type == Reduction::DOT_PROD_CONJ ? T(-1) : T(1);
+	    FillAlternate(T(1), -sign, b);
+	    FillAlternate(T(1), sign, c);
+	    for (; i + p <= n; i += p)
+	      {
+		Load(x + i, u);
+		Load(y + i, v);
+		Deposit(u * v * b * a, sig, s0);
+		Pack::SwapPairs(v, w);
+		Deposit(u * w * c * a, sig, s1);
+	      }
+
+	    for (; i < n; i += 2)
+	      {
+		Deposit(x[i] * y[i] * scale, sigma, sum);
+		Deposit(x[i+1] * y[i+1] * -sign * scale, sigma, sum);
+		Deposit(x[i] * y[i+1] * scale, sigma, sum + nb_level);
+		Deposit(x[i+1] * y[i] * sign * scale, sigma, sum + nb_level);
+	      }
+
+	    for (int l = 0; l < nb_level; l++)
+	      for (int k = 0; k < p; k++)
+		sum[nb_level + l] += s1[l][k];
+
+	    for (int l = 0; l < nb_level; l++)
+	      s1[l] = vect_type();
+	  }
+	  break;
+	case Reduction::SUM_SQUARE:
+	  for (; i + 2*p <= n; i += 2*p)
+	    {
+	      Load(x + i, u);
+	      u *= a;
+	      Deposit(u * u, sig, s0);
+	      Load(x + i + p, u);
+	      u *= a;
+	      Deposit(u * u, sig, s1);
+	    }
+
+	  for (; i < n; i++)
+	    {
+	      T t = x[i] * scale;
+	      Deposit(t * t, sigma, sum);
+	    }
+	  break;
+	}
+
+      for (int l = 0; l < nb_level; l++)
+	for (int k = 0; k < p; k++)
+	  {
+	    sum[l] += s0[l][k];
+	    sum[l] += s1[l][k];
+	  }
+    }
+
+  };
+
+
+  //! Vector kernels without SIMD instruction.
+  template<class T>
+  class SimdKernelScalar
+  {
+  public:
+
+    static void Mlt(size_t n, T alpha, T* x)
+    {
+      for (size_t i = 0; i < n; i++)
+	x[i] *= alpha;
+    }
+
+    static void MltComplex(size_t n, T alpha_r, T alpha_i, T* x)
+    {
+      for (size_t i = 0; i < 2*n; i += 2)
+	{
+	  T x_r = x[i], x_i = x[i+1];
+	  x[i] = alpha_r * x_r - alpha_i * x_i;
+	  x[i+1] = alpha_r * x_i + alpha_i * x_r;
+	}
+    }
+
+    static void Add(size_t n, T alpha, const T* x, T* y)
+    {
+      for (size_t i = 0; i < n; i++)
+	y[i] += alpha * x[i];
+    }
+
+    static void AddComplex(size_t n, T alpha_r, T alpha_i, const T* x, T* y)
+    {
+      for (size_t i = 0; i < 2*n; i += 2)
+	{
+	  y[i] += alpha_r * x[i] - alpha_i * x[i+1];
+	  y[i+1] += alpha_r * x[i+1] + alpha_i * x[i];
+	}
+    }
+
+    static T DotProd(size_t n, const T* x, const T* y)
+    {
+      T value(0);
+      for (size_t i = 0; i < n; i++)
+	value += x[i] * y[i];
+
+      return value;
+    }
+
+    static void DotProdComplex(size_t n, const T* x, const T* y, bool conj,
+			       T& value_r, T& value_i)
+    {
+      T sign = conj ? T(-1) : T(1);
+      value_r = T(0);
+      value_i = T(0);
+      for (size_t i = 0; i < 2*n; i += 2)
+	{
+	  value_r += x[i] * y[i] - sign * x[i+1] * y[i+1];
+	  value_i += x[i] * y[i+1] + sign * x[i+1] * y[i];
+	}
+    }
+
+    static T Norm1(size_t n, const T* x)
+    {
+      T value(0);
+      for (size_t i = 0; i < n; i++)
+	value += x[i] < T(0) ? -x[i] : x[i];
+
+      return value;
+    }
+
+    static T Norm1Complex(size_t n, const T* x)
+    {
+      T value(0);
+      for (size_t i = 0; i < 2*n; i += 2)
+	value += sqrt(x[i] * x[i] + x[i+1] * x[i+1]);
+
+      return value;
+    }
+
+    static T SumSquare(size_t n, const T* x)
+    {
+      T value(0);
+      for (size_t i = 0; i < n; i++)
+	value += x[i] * x[i];
+
+      return value;
+    }
+
+    static T SumSquareScaled(size_t n, const T* x, T scale)
+    {
+      T value(0);
+      for (size_t i = 0; i < n; i++)
+	value += (scale * x[i]) * (scale * x[i]);
+
+      return value;
+    }
+
+    static T MaxAbs(size_t n, const T* x)
+    {
+      T value(0), a;
+      for (size_t i = 0; i < n; i++)
+	{
+	  a = x[i] < T(0) ? -x[i] : x[i];
+	  if (a > value)
+	    value = a;
+	}
+
+      return value;
+    }
+
+    static T MaxAbsProd(size_t n, const T* x, const T* y, bool cross)
+    {
+      T value(0), a;
+      for (size_t i = 0; i < n; i++)
+	{
+	  a = x[i] * y[i];
+	  a = a < T(0) ? -a : a;
+	  if (a > value)
+	    value = a;
+
+	  if (cross)
+	    {
+	      a = x[i] * y[i^1];
+	      a = a < T(0) ? -a : a;
+	      if (a > value)
+		value = a;
+	    }
+	}
+
+      return value;
+    }
+
+    static void Convert(size_t n, const T* x, double* y)
+    {
+      for (size_t i = 0; i < n; i++)
+	y[i] = x[i];
+    }
+
+    SELDON_WITHOUT_FP_CONTRACT
+    static void SplitSum(size_t n, const T* x, const T* y, int type, T scale,
+			 const T* sigma, T* sum)
+    {
+      typedef ReproducibleBlockKernel<T> Reduction;
+      const int nb_level = ReproducibleSum::NB_LEVEL;
+      T sign = type == Reduction::DOT_PROD_CONJ ? T(-1) : T(1);
+      for (size_t i = 0; i < n; i++)
+	{
+	  T t;
+	  switch (type)
+	    {
+	    case Reduction::DOT_PROD:
+	      t = x[i] * y[i] * scale;
+	      break;
+	    case Reduction::DOT_PROD_COMPLEX:
+	    case Reduction::DOT_PROD_CONJ:
+	      if (i % 2 == 0)
+		{
+		  t = x[i] * y[i+1] * scale;
+		  SimdKernelScalar<T>::Deposit(t, sigma, sum + nb_level);
+		  t = x[i] * y[i] * scale;
+		}
+	      else
+		{
+		  t = x[i] * y[i-1] * sign * scale;
+		  SimdKernelScalar<T>::Deposit(t, sigma, sum + nb_level);
+		  t = x[i] * y[i] * -sign * scale;
+		}
+	      break;
+	    default:
+	      t = x[i] * scale;
+	      t *= t;
+	    }
+
+	  SimdKernelScalar<T>::Deposit(t, sigma, sum);
+	}
+    }
+
+    SELDON_WITHOUT_FP_CONTRACT
+    static void Deposit(T t, const T* sigma, T* sum)
+    {
+      for (int l = 0; l < ReproducibleSum::NB_LEVEL; l++)
+	{
+	  T q = (sigma[l] + t) - sigma[l];
+	  sum[l] += q;
+	  t -= q;
+	}
+    }
+
+  };
+
+
+  /*
+    The following macro defines a class whose functions are compiled for
+    the instruction set 'isa', and call the kernels of SimdVectorKernel
+    with packs of 'nb_bytes' bytes.
+  */
+#define SELDON_SIMD_KERNEL(name, isa, nb_bytes)				\
+  template<class T>							\
+  class name								\
+  {									\
+    typedef SimdVectorKernel<T, nb_bytes> Kernel;			\
+									\
+  public:								\
+									\
+    __attribute__((target(isa)))					\
+    static void Mlt(size_t n, T alpha, T* x)				\
+    {									\
+      Kernel::Mlt(n, alpha, x);						\
+    }									\
+									\
+    __attribute__((target(isa)))					\
+    static void MltComplex(size_t n, T alpha_r, T alpha_i, T* x)	\
+    {									\
+      Kernel::MltComplex(n, alpha_r, alpha_i, x);			\
+    }									\
+									\
+    __attribute__((target(isa)))					\
+    static void Add(size_t n, T alpha, const T* x, T* y)		\
+    {									\
+      Kernel::Add(n, alpha, x, y);					\
+    }									\
+									\
+    __attribute__((target(isa)))					\
+    static void AddComplex(size_t n, T alpha_r, T alpha_i,		\
+			   const T* x, T* y)				\
+    {									\
+      Kernel::AddComplex(n, alpha_r, alpha_i, x, y);			\
+    }									\
+									\
+    __attribute__((target(isa)))					\
+    static T DotProd(size_t n, const T* x, const T* y)			\
+    {									\
+      return Kernel::DotProd(n, x, y);					\
+    }									\
+									\
+    __attribute__((target(isa)))					\
+    static void DotProdComplex(size_t n, const T* x, const T* y,	\
+			       bool conj, T& value_r, T& value_i)	\
+    {									\
+      Kernel::DotProdComplex(n, x, y, conj, value_r, value_i);		\
+    }									\
+									\
+    __attribute__((target(isa)))					\
+    static T Norm1(size_t n, const T* x)				\
+    {									\
+      return Kernel::Norm1(n, x);					\
+    }									\
+									\
+    __attribute__((target(isa)))					\
+    static T Norm1Complex(size_t n, const T* x)				\
+    {									\
+      return Kernel::Norm1Complex(n, x);				\
+    }									\
+									\
+    __attribute__((target(isa)))					\
+    static T SumSquare(size_t n, const T* x)				\
+    {									\
+      return Kernel::SumSquare(n, x);					\
+    }									\
+									\
+    __attribute__((target(isa)))					\
+    static T SumSquareScaled(size_t n, const T* x, T scale)		\
+    {									\
+      return Kernel::SumSquareScaled(n, x, scale);			\
+    }									\
+									\
+    __attribute__((target(isa)))					\
+    static T MaxAbs(size_t n, const T* x)				\
+    {									\
+      return Kernel::MaxAbs(n, x);					\
+    }									\
+									\
+    __attribute__((target(isa)))					\
+    static T MaxAbsProd(size_t n, const T* x, const T* y, bool cross)	\
+    {									\
+      return Kernel::MaxAbsProd(n, x, y, cross);			\
+    }									\
+									\
+    __attribute__((target(isa)))					\
+    static void Convert(size_t n, const T* x, double* y)		\
+    {									\
+      Kernel::Convert(n, x, y);						\
+    }									\
+									\
+    __attribute__((target(isa))) SELDON_WITHOUT_FP_CONTRACT		\
+    static void SplitSum(size_t n, const T* x, const T* y, int type,	\
+			 T scale, const T* sigma, T* sum)		\
+    {									\
+      Kernel::SplitSum(n, x, y, type, scale, sigma, sum);		\
+    }									\
+  };
+
+  SELDON_SIMD_KERNEL(SimdKernelSse2, "sse2", 16)
+  SELDON_SIMD_KERNEL(SimdKernelAvx2, "avx2,fma", 32)
+  SELDON_SIMD_KERNEL(SimdKernelAvx512, "avx512f", 64)
+
+#undef SELDON_SIMD_KERNEL
+
+
+  //! Sets the kernels to the functions of class Kernel.
+  template<class T>
+  template<class Kernel>
+  void SimdKernelTable<T>::SetKernel()
+  {
+    Mlt = &Kernel::Mlt;
+    MltComplex = &Kernel::MltComplex;
+    Add = &Kernel::Add;
+    AddComplex = &Kernel::AddComplex;
+    DotProd = &Kernel::DotProd;
+    DotProdComplex = &Kernel::DotProdComplex;
+    Norm1 = &Kernel::Norm1;
+    Norm1Complex = &Kernel::Norm1Complex;
+    SumSquare = &Kernel::SumSquare;
+    SumSquareScaled = &Kernel::SumSquareScaled;
+    MaxAbs = &Kernel::MaxAbs;
+    MaxAbsProd = &Kernel::MaxAbsProd;
+    Convert = &Kernel::Convert;
+    SplitSum = &Kernel::SplitSum;
+  }
+
+
+  //! Returns the kernels of the current instruction set.
+  template<class T>
+  const SimdKernelTable<T>& SimdKernelTable<T>::GetCurrent()
+  {
+    static const SimdKernelTable<T>* table = CreateTable();
+    return table[SimdInstructionSet::GetCurrent()];
+  }
+
+
+  //! Returns the kernels of all instruction sets.
+  template<class T>
+  const SimdKernelTable<T>* SimdKernelTable<T>::CreateTable()
+  {
+    static SimdKernelTable<T> table[4];
+    table[SimdInstructionSet::SCALAR].template
+      SetKernel<SimdKernelScalar<T> >();
+    table[SimdInstructionSet::SSE2].template SetKernel<SimdKernelSse2<T> >();
+    table[SimdInstructionSet::AVX2].template SetKernel<SimdKernelAvx2<T> >();
+    table[SimdInstructionSet::AVX512].template
+      SetKernel<SimdKernelAvx512<T> >();
+    return table;
+  }
+
+
+  //! Constructor.
+  /*!
+    \param[in] type kernel (MLT, ADD, DOT_PROD, ...).
+    \param[in] alpha_r real part of the scalar of MLT and ADD.
+    \param[in] alpha_i imaginary part of the scalar of MLT_COMPLEX and
+    ADD_COMPLEX.
+    \param[in] x first vector read by the kernel.
+    \param[in] y second vector read by the kernel (dot products only).
+    \param[in,out] z vector modified by the kernel (MLT and ADD only).
+  */
+  template<class T>
+  SimdBlockKernel<T>::SimdBlockKernel(int type, T alpha_r, T alpha_i,
+				      const T* x, const T* y, T* z)
+    : kernel_(SimdKernelTable<T>::GetCurrent()), type_(type),
+      alpha_r_(alpha_r), alpha_i_(alpha_i), x_(x), y_(y), z_(z)
+  {
+  }
+
+
+  //! Applies the kernel on the elements i0 to i1 - 1.
+  /*!
+    For the complex kernels, the elements are complex numbers.
+    \return The value computed by the kernel on the block (0 for MLT and
+    ADD).
+  */
+  template<class T>
+  complex<T> SimdBlockKernel<T>::operator()(size_t i0, size_t i1) const
+  {
+    size_t n = i1 - i0;
+    T value_r(0), value_i(0);
+    switch (type_)
+      {
+      case MLT:
+	kernel_.Mlt(n, alpha_r_, z_ + i0);
+	break;
+      case MLT_COMPLEX:
+	kernel_.MltComplex(n, alpha_r_, alpha_i_, z_ + 2*i0);
+	break;
+      case ADD:
+	kernel_.Add(n, alpha_r_, x_ + i0, z_ + i0);
+	break;
+      case ADD_COMPLEX:
+	kernel_.AddComplex(n, alpha_r_, alpha_i_, x_ + 2*i0, z_ + 2*i0);
+	break;
+      case DOT_PROD:
+	value_r = kernel_.DotProd(n, x_ + i0, y_ + i0);
+	break;
+      case DOT_PROD_COMPLEX:
+      case DOT_PROD_CONJ:
+	kernel_.DotProdComplex(n, x_ + 2*i0, y_ + 2*i0,
+			       type_ == DOT_PROD_CONJ, value_r, value_i);
+	break;
+      case NORM1:
+	value_r = kernel_.Norm1(n, x_ + i0);
+	break;
+      case NORM1_COMPLEX:
+	value_r = kernel_.Norm1Complex(n, x_ + 2*i0);
+	break;
+      case SUM_SQUARE:
+	value_r = kernel_.SumSquare(n, x_ + i0);
+	break;
+      }
+
+    return complex<T>(value_r, value_i);
+  }
+
+
+  //! Applies a kernel modifying z on n elements, with the threads of Seldon.
+  template<class T>
+  void SimdParallelUpdate(int type, size_t n, T alpha_r, T alpha_i,
+			  const T* x, T* z)
+  {
+    ParallelFor(0, n, SimdBlockKernel<T>(type, alpha_r, alpha_i, x, NULL, z),
+		SimdBlockKernel<T>::GRAIN_SIZE);
+  }
+
+
+  //! Sums the values of a kernel on n elements, with the threads of Seldon.
+  template<class T>
+  complex<T> SimdParallelReduce(int type, size_t n, const T* x, const T* y)
+  {
+    return ParallelReduce(0, n, SimdBlockKernel<T>(type, T(0), T(0), x, y,
+						   NULL),
+			  complex<T>(0), SimdBlockKernel<T>::GRAIN_SIZE);
+  }
+
+
+  //! Returns the 2-norm of n real numbers, without overflow nor underflow.
+  /*!
+    The sum of squares is first computed without scaling. When it overflows
+    or is so small that underflows may have spoiled it, the values are
+    scaled by a power of 2 close to the inverse of their maximal modulus,
+    and the sum is computed again.
+  */
+  template<class T>
+  T SimdNorm2(size_t n, const T* x)
+  {
+    const SimdKernelTable<T>& kernel = SimdKernelTable<T>::GetCurrent();
+    T sum = real(SimdParallelReduce(SimdBlockKernel<T>::SUM_SQUARE, n, x,
+				    (const T*) NULL));
+
+    const T huge = numeric_limits<T>::max();
+    const T tiny = numeric_limits<T>::min() / numeric_limits<T>::epsilon();
+    if (sum >= tiny && sum <= huge)
+      return sqrt(sum);
+
+    // NaN
+    if (sum != sum)
+      return sum;
+
+    T max_abs = kernel.MaxAbs(n, x);
+    if (max_abs == T(0) || max_abs > huge)
+      return max_abs;
+
+    // the scaling factor 2^(-e) is exact and finite
+    int e;
+    frexp(max_abs, &e);
+    e = max(e, 1 - numeric_limits<T>::max_exponent);
+    sum = kernel.SumSquareScaled(n, x, ldexp(T(1), -e));
+    return ldexp(sqrt(sum), e);
+  }
+
+
+  //! Returns the sum of the moduli of n complex numbers.
+  /*!
+    The moduli are computed from the unscaled squares. If a square has
+    overflowed, or if the sum is so small that underflows may have spoiled
+    it, the sum is computed again with the modulus of std::complex.
+  */
+  template<class T>
+  T SimdNorm1Complex(size_t n, const T* x)
+  {
+    T sum = real(SimdParallelReduce(SimdBlockKernel<T>::NORM1_COMPLEX, n, x,
+				    (const T*) NULL));
+
+    const T huge = numeric_limits<T>::max();
+    const T tiny = sqrt(numeric_limits<T>::min())
+      / numeric_limits<T>::epsilon();
+    if ((sum >= tiny && sum <= huge) || n == 0)
+      return sum;
+
+    const complex<T>* z = reinterpret_cast<const complex<T>*>(x);
+    sum = T(0);
+    for (size_t i = 0; i < n; i++)
+      sum += abs(z[i]);
+
+    return sum;
+  }
+
+
+  //! Computes the bound of the terms of a reproducible sum.
+  /*!
+    The kernels are only used for float and double.
+    \return false, the bound has not been computed.
+  */
+  template<class T>
+  bool SimdReproducibleBound(int type, size_t n, const T* x, const T* y,
+			     double& bound)
+  {
+    return false;
+  }
+
+
+  //! Adds the parts of the terms of a reproducible sum to the levels.
+  /*!
+    The kernels are only used for float and double.
+    \return false, the terms have not been added.
+  */
+  template<class T>
+  bool SimdSplitSum(int type, size_t n, const T* x, const T* y,
+		    double scale, const double* sigma, double* sum)
+  {
+    return false;
+  }
+
+
+  // SIMD KERNELS //
+  //////////////////
+
+
+#ifndef SELDON_WITH_BLAS
+
+
+  /////////
+  // MLT //
+
+
+  //! Multiplication of a vector by a scalar.
+  template <class Allocator>
+  void MltScalar(const float& alpha,
+		 Vector<float, VectFull, Allocator>& X)
+  {
+    SimdParallelUpdate<float>(SimdBlockKernel<float>::MLT, X.GetM(), alpha,
+			   float(0), NULL, X.GetData());
+  }
+
+
+  //! Multiplication of a vector by a scalar.
+  template <class Allocator>
+  void MltScalar(const double& alpha,
+		 Vector<double, VectFull, Allocator>& X)
+  {
+    SimdParallelUpdate<double>(SimdBlockKernel<double>::MLT, X.GetM(), alpha,
+			   double(0), NULL, X.GetData());
+  }
+
+
+  //! Multiplication of a vector by a scalar.
+  template <class Allocator>
+  void MltScalar(const float& alpha,
+		 Vector<complex<float>, VectFull, Allocator>& X)
+  {
+    SimdParallelUpdate<float>(SimdBlockKernel<float>::MLT, 2 * X.GetM(), alpha,
+			   float(0), NULL, reinterpret_cast<float*>(X.GetData()));
+  }
+
+
+  //! Multiplication of a vector by a scalar.
+  template <class Allocator>
+  void MltScalar(const double& alpha,
+		 Vector<complex<double>, VectFull, Allocator>& X)
+  {
+    SimdParallelUpdate<double>(SimdBlockKernel<double>::MLT, 2 * X.GetM(), alpha,
+			   double(0), NULL, reinterpret_cast<double*>(X.GetData()));
+  }
+
+
+  //! Multiplication of a vector by a scalar.
+  template <class Allocator>
+  void MltScalar(const complex<float>& alpha,
+		 Vector<complex<float>, VectFull, Allocator>& X)
+  {
+    SimdParallelUpdate<float>(SimdBlockKernel<float>::MLT_COMPLEX, X.GetM(),
+			   real(alpha), imag(alpha), NULL,
+			   reinterpret_cast<float*>(X.GetData()));
+  }
+
+
+  //! Multiplication of a vector by a scalar.
+  template <class Allocator>
+  void MltScalar(const complex<double>& alpha,
+		 Vector<complex<double>, VectFull, Allocator>& X)
+  {
+    SimdParallelUpdate<double>(SimdBlockKernel<double>::MLT_COMPLEX, X.GetM(),
+			   real(alpha), imag(alpha), NULL,
+			   reinterpret_cast<double*>(X.GetData()));
+  }
+
+
+  // MLT //
+  /////////
+
+
+  /////////
+  // ADD //
+
+
+  //! Adds two vectors Y = Y + alpha X.
+  template <class Allocator0, class Allocator1>
+  void AddVector(const float& alpha,
+		 const Vector<float, VectFull, Allocator0>& X,
+		 Vector<float, VectFull, Allocator1>& Y)
+  {
+    if (alpha != 0.f)
+      {
+#ifdef SELDON_CHECK_DIMENSIONS
+	CheckDim(X, Y, "Add(alpha, X, Y)");
+#endif
+
+	SimdParallelUpdate<float>(SimdBlockKernel<float>::ADD, X.GetM(), alpha,
+			       float(0), X.GetData(), Y.GetData());
+      }
+  }
+
+
+  //! Adds two vectors Y = Y + alpha X.
+  template <class Allocator0, class Allocator1>
+  void AddVector(const double& alpha,
+		 const Vector<double, VectFull, Allocator0>& X,
+		 Vector<double, VectFull, Allocator1>& Y)
+  {
+    if (alpha != 0.)
+      {
+#ifdef SELDON_CHECK_DIMENSIONS
+	CheckDim(X, Y, "Add(alpha, X, Y)");
+#endif
+
+	SimdParallelUpdate<double>(SimdBlockKernel<double>::ADD, X.GetM(), alpha,
+			       double(0), X.GetData(), Y.GetData());
+      }
+  }
+
+
+  //! Adds two vectors Y = Y + alpha X.
+  template <class Allocator0, class Allocator1>
+  void AddVector(const complex<float>& alpha,
+		 const Vector<complex<float>, VectFull, Allocator0>& X,
+		 Vector<complex<float>, VectFull, Allocator1>& Y)
+  {
+    if (alpha != complex<float>(0))
+      {
+#ifdef SELDON_CHECK_DIMENSIONS
+	CheckDim(X, Y, "Add(alpha, X, Y)");
+#endif
+
+	SimdParallelUpdate<float>(SimdBlockKernel<float>::ADD_COMPLEX, X.GetM(),
+			       real(alpha), imag(alpha),
+			       reinterpret_cast<const float*>(X.GetData()),
+			       reinterpret_cast<float*>(Y.GetData()));
+      }
+  }
+
+
+  //! Adds two vectors Y = Y + alpha X.
+  template <class Allocator0, class Allocator1>
+  void AddVector(const complex<double>& alpha,
+		 const Vector<complex<double>, VectFull, Allocator0>& X,
+		 Vector<complex<double>, VectFull, Allocator1>& Y)
+  {
+    if (alpha != complex<double>(0))
+      {
+#ifdef SELDON_CHECK_DIMENSIONS
+	CheckDim(X, Y, "Add(alpha, X, Y)");
+#endif
+
+	SimdParallelUpdate<double>(SimdBlockKernel<double>::ADD_COMPLEX, X.GetM(),
+			       real(alpha), imag(alpha),
+			       reinterpret_cast<const double*>(X.GetData()),
+			       reinterpret_cast<double*>(Y.GetData()));
+      }
+  }
+
+
+  // ADD //
+  /////////
+
+
+  /////////////
+  // DOTPROD //
+
+
+  //! Scalar product between two vectors.
+  template <class Allocator0, class Allocator1>
+  float DotProdVector(const Vector<float, VectFull, Allocator0>& X,
+		      const Vector<float, VectFull, Allocator1>& Y)
+  {
+#ifdef SELDON_CHECK_DIMENSIONS
+    CheckDim(X, Y, "DotProd(X, Y)");
+#endif
+
+    float value;
+    if (ParallelContext::IsDeterministic()
+	&& ReproducibleDotProd(X, Y, false, value))
+      return value;
+
+    return real(SimdParallelReduce(SimdBlockKernel<float>::DOT_PROD, X.GetM(),
+				   X.GetData(), Y.GetData()));
+  }
+
+
+  //! Scalar product between two vectors.
+  template <class Allocator0, class Allocator1>
+  double DotProdVector(const Vector<double, VectFull, Allocator0>& X,
+		       const Vector<double, VectFull, Allocator1>& Y)
+  {
+#ifdef SELDON_CHECK_DIMENSIONS
+    CheckDim(X, Y, "DotProd(X, Y)");
+#endif
+
+    double value;
+    if (ParallelContext::IsDeterministic()
+	&& ReproducibleDotProd(X, Y, false, value))
+      return value;
+
+    return real(SimdParallelReduce(SimdBlockKernel<double>::DOT_PROD, X.GetM(),
+				   X.GetData(), Y.GetData()));
+  }
+
+
+  //! Scalar product between two vectors.
+  template <class Allocator0, class Allocator1>
+  complex<float>
+  DotProdVector(const Vector<complex<float>, VectFull, Allocator0>& X,
+		const Vector<complex<float>, VectFull, Allocator1>& Y)
+  {
+#ifdef SELDON_CHECK_DIMENSIONS
+    CheckDim(X, Y, "DotProd(X, Y)");
+#endif
+
+    complex<float> value;
+    if (ParallelContext::IsDeterministic()
+	&& ReproducibleDotProd(X, Y, false, value))
+      return value;
+
+    return SimdParallelReduce(SimdBlockKernel<float>::DOT_PROD_COMPLEX, X.GetM(),
+			      reinterpret_cast<const float*>(X.GetData()),
+			      reinterpret_cast<const float*>(Y.GetData()));
+  }
+
+
+  //! Scalar product between two vectors.
+  template <class Allocator0, class Allocator1>
+  complex<double>
+  DotProdVector(const Vector<complex<double>, VectFull, Allocator0>& X,
+		const Vector<complex<double>, VectFull, Allocator1>& Y)
+  {
+#ifdef SELDON_CHECK_DIMENSIONS
+    CheckDim(X, Y, "DotProd(X, Y)");
+#endif
+
+    complex<double> value;
+    if (ParallelContext::IsDeterministic()
+	&& ReproducibleDotProd(X, Y, false, value))
+      return value;
+
+    return SimdParallelReduce(SimdBlockKernel<double>::DOT_PROD_COMPLEX, X.GetM(),
+			      reinterpret_cast<const double*>(X.GetData()),
+			      reinterpret_cast<const double*>(Y.GetData()));
+  }
+
+
+  //! Scalar product between two vectors conj(X).Y.
+  template <class Allocator0, class Allocator1>
+  float DotProdConjVector(const Vector<float, VectFull, Allocator0>& X,
+			  const Vector<float, VectFull, Allocator1>& Y)
+  {
+    return DotProdVector(X, Y);
+  }
+
+
+  //! Scalar product between two vectors conj(X).Y.
+  template <class Allocator0, class Allocator1>
+  double DotProdConjVector(const Vector<double, VectFull, Allocator0>& X,
+			   const Vector<double, VectFull, Allocator1>& Y)
+  {
+    return DotProdVector(X, Y);
+  }
+
+
+  //! Scalar product between two vectors conj(X).Y.
+  template <class Allocator0, class Allocator1>
+  complex<float>
+  DotProdConjVector(const Vector<complex<float>, VectFull, Allocator0>& X,
+		    const Vector<complex<float>, VectFull, Allocator1>& Y)
+  {
+#ifdef SELDON_CHECK_DIMENSIONS
+    CheckDim(X, Y, "DotProdConj(X, Y)");
+#endif
+
+    complex<float> value;
+    if (ParallelContext::IsDeterministic()
+	&& ReproducibleDotProd(X, Y, true, value))
+      return value;
+
+    return SimdParallelReduce(SimdBlockKernel<float>::DOT_PROD_CONJ, X.GetM(),
+			      reinterpret_cast<const float*>(X.GetData()),
+			      reinterpret_cast<const float*>(Y.GetData()));
+  }
+
+
+  //! Scalar product between two vectors conj(X).Y.
+  template <class Allocator0, class Allocator1>
+  complex<double>
+  DotProdConjVector(const Vector<complex<double>, VectFull, Allocator0>& X,
+		    const Vector<complex<double>, VectFull, Allocator1>& Y)
+  {
+#ifdef SELDON_CHECK_DIMENSIONS
+    CheckDim(X, Y, "DotProdConj(X, Y)");
+#endif
+
+    complex<double> value;
+    if (ParallelContext::IsDeterministic()
+	&& ReproducibleDotProd(X, Y, true, value))
+      return value;
+
+    return SimdParallelReduce(SimdBlockKernel<double>::DOT_PROD_CONJ, X.GetM(),
+			      reinterpret_cast<const double*>(X.GetData()),
+			      reinterpret_cast<const double*>(Y.GetData()));
+  }
+
+
+  // DOTPROD //
+  /////////////
+
+
+  ///////////
+  // NORM1 //
+
+
+  //! Returns the 1-norm of X.
+  template <class Allocator>
+  float Norm1(const Vector<float, VectFull, Allocator>& X)
+  {
+    return real(SimdParallelReduce(SimdBlockKernel<float>::NORM1, X.GetM(),
+				   X.GetData(), (const float*) NULL));
+  }
+
+
+  //! Returns the 1-norm of X.
+  template <class Allocator>
+  double Norm1(const Vector<double, VectFull, Allocator>& X)
+  {
+    return real(SimdParallelReduce(SimdBlockKernel<double>::NORM1, X.GetM(),
+				   X.GetData(), (const double*) NULL));
+  }
+
+
+  //! Returns the 1-norm of X (sum of the moduli).
+  template <class Allocator>
+  float Norm1(const Vector<complex<float>, VectFull, Allocator>& X)
+  {
+    return SimdNorm1Complex(X.GetM(),
+			    reinterpret_cast<const float*>(X.GetData()));
+  }
+
+
+  //! Returns the 1-norm of X (sum of the moduli).
+  template <class Allocator>
+  double Norm1(const Vector<complex<double>, VectFull, Allocator>& X)
+  {
+    return SimdNorm1Complex(X.GetM(),
+			    reinterpret_cast<const double*>(X.GetData()));
+  }
+
+
+  // NORM1 //
+  ///////////
+
+
+  ///////////
+  // NORM2 //
+
+
+  //! Returns the 2-norm of X.
+  template <class Allocator>
+  float Norm2(const Vector<float, VectFull, Allocator>& X)
+  {
+    float value;
+    if (ParallelContext::IsDeterministic() && ReproducibleNorm2(X, value))
+      return value;
+
+    return SimdNorm2(X.GetM(), X.GetData());
+  }
+
+
+  //! Returns the 2-norm of X.
+  template <class Allocator>
+  double Norm2(const Vector<double, VectFull, Allocator>& X)
+  {
+    double value;
+    if (ParallelContext::IsDeterministic() && ReproducibleNorm2(X, value))
+      return value;
+
+    return SimdNorm2(X.GetM(), X.GetData());
+  }
+
+
+  //! Returns the 2-norm of X.
+  template <class Allocator>
+  float Norm2(const Vector<complex<float>, VectFull, Allocator>& X)
+  {
+    float value;
+    if (ParallelContext::IsDeterministic() && ReproducibleNorm2(X, value))
+      return value;
+
+    return SimdNorm2(2 * X.GetM(),
+		     reinterpret_cast<const float*>(X.GetData()));
+  }
+
+
+  //! Returns the 2-norm of X.
+  template <class Allocator>
+  double Norm2(const Vector<complex<double>, VectFull, Allocator>& X)
+  {
+    double value;
+    if (ParallelContext::IsDeterministic() && ReproducibleNorm2(X, value))
+      return value;
+
+    return SimdNorm2(2 * X.GetM(),
+		     reinterpret_cast<const double*>(X.GetData()));
+  }
+
+
+  // NORM2 //
+  ///////////
+
+
+#endif // SELDON_WITH_BLAS.
+
+
+} // namespace Seldon.
+
+#endif // SELDON_WITH_SIMD_DISPATCH.
+
+#define SELDON_FILE_FUNCTIONS_VECTOR_SIMD_CXX
+#endif
@@ -0,0 +1,370 @@
+// Copyright (C) 2016 INRIA
+//
+// This file is part of the linear-algebra library Seldon,
+// http://seldon.sourceforge.net/.
+//
+// Seldon is free software; you can redistribute it and/or modify it under the
+// terms of the GNU Lesser General Public License as published by the Free
+// Software Foundation; either version 2.1 of the License, or (at your option)
+// any later version.
+//
+// Seldon is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for
+// more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with Seldon. If not, see http://www.gnu.org/licenses/.
+
+
+#ifndef SELDON_FILE_FUNCTIONS_VECTOR_SIMD_HXX
+
+#define SELDON_FILE_FUNCTIONS_VECTOR_SIMD_HXX
+
+
+/*
+  Without Blas, the following functions are computed for dense vectors of
+  float, double, complex<float> and complex<double> by SIMD kernels (SSE2,
+  AVX2 or AVX-512) chosen at run time from the instruction sets of the
+  processor:
+
+  Mlt(alpha, X)
+  Add(alpha, X, Y)
+  DotProd(X, Y)
+  DotProdConj(X, Y)
+  Norm1(X)
+  Norm2(X)
+
+  With Blas, the Blas functions are called instead. The reproducible sums
+  of Functions_VectorReproducible.hxx also use the kernels of this file for
+  double (float values being converted to double), with or without Blas.
+  The kernels rely on the vector extensions of GCC and Clang, and are only
+  compiled for x86 processors. They can be disabled by defining
+  SELDON_WITHOUT_SIMD.
+*/
+
+#if !defined(SELDON_WITHOUT_SIMD) && !defined(SWIG) && defined(__GNUC__) \
+  && (defined(__x86_64__) || defined(__i386__))
+#define SELDON_WITH_SIMD_DISPATCH
+#endif
+
+
+namespace Seldon
+{
+
+
+  //! Instruction sets of the vector kernels.
+  /*!
+    The best instruction set supported by the processor is selected at the
+    first call. SetCurrent may force a less recent set, for instance to
+    compare kernels.
+  */
+  class SimdInstructionSet
+  {
+  public:
+    enum {SCALAR, SSE2, AVX2, AVX512};
+
+    static int GetSupported();
+    static int GetCurrent();
+    static void SetCurrent(int type);
+    static string GetName(int type);
+
+  private:
+    static int& GetCurrentRef();
+  };
+
+
+#ifdef SELDON_WITH_SIMD_DISPATCH
+
+
+  //! Kernels of the vector functions for a given instruction set.
+  /*!
+    The kernels work on arrays of real numbers: complex vectors are seen
+    as arrays of interleaved real and imaginary parts.
+  */
+  template<class T>
+  class SimdKernelTable
+  {
+  public:
+    //! number of values converted to double at once (even, so that the
+    //! complex numbers are not split)
+    enum {BLOCK_SIZE = 512};
+
+    //! x = alpha x, for n real numbers.
+    void (*Mlt)(size_t n, T alpha, T* x);
+    //! x = (alpha_r + i alpha_i) x, for n complex numbers.
+    void (*MltComplex)(size_t n, T alpha_r, T alpha_i, T* x);
+    //! y = y + alpha x, for n real numbers.
+    void (*Add)(size_t n, T alpha, const T* x, T* y);
+    //! y = y + (alpha_r + i alpha_i) x, for n complex numbers.
+    void (*AddComplex)(size_t n, T alpha_r, T alpha_i, const T* x, T* y);
+    //! Returns x.y, for n real numbers.
+    T (*DotProd)(size_t n, const T* x, const T* y);
+    //! Computes x.y or conj(x).y, for n complex numbers.
+    void (*DotProdComplex)(size_t n, const T* x, const T* y, bool conj,
+			   T& value_r, T& value_i);
+    //! Returns the sum of |x_i|, for n real numbers.
+    T (*Norm1)(size_t n, const T* x);
+    //! Returns the sum of |x_i|, for n complex numbers.
+    T (*Norm1Complex)(size_t n, const T* x);
+    //! Returns the sum of x_i^2 without scaling, for n real numbers.
+    T (*SumSquare)(size_t n, const T* x);
+    //! Returns the sum of (scale x_i)^2, for n real numbers.
+    T (*SumSquareScaled)(size_t n, const T* x, T scale);
+    //! Returns the maximum of |x_i|, NaN being ignored.
+    T (*MaxAbs)(size_t n, const T* x);
+    //! Returns the maximum of |x_i y_i|, NaN being ignored.
+    /*!
+      If cross is true, the products x_i y_j, j being the other part of the
+      same complex number, are also considered.
+    */
+    T (*MaxAbsProd)(size_t n, const T* x, const T* y, bool cross);
+    //! Converts n values to double, n being at most BLOCK_SIZE.
+    void (*Convert)(size_t n, const T* x, double* y);
+    //! Adds the parts of the terms of a reproducible sum to the levels.
+    /*!
+      The terms are defined by type, as in ReproducibleBlockKernel, for n
+      real numbers. sigma and sum are the offsets and sums of
+      ReproducibleSum. Only used for double.
+    */
+    void (*SplitSum)(size_t n, const T* x, const T* y, int type, T scale,
+		     const T* sigma, T* sum);
+
+    template<class Kernel>
+    void SetKernel();
+
+    static const SimdKernelTable<T>& GetCurrent();
+
+  private:
+    static const SimdKernelTable<T>* CreateTable();
+  };
+
+
+  //! Kernel of SimdKernelTable applied on a block of elements.
+  /*!
+    Function object given to ParallelFor and ParallelReduce, so that the
+    kernels are applied on large vectors by all the threads of Seldon.
+  */
+  template<class T>
+  class SimdBlockKernel
+  {
+  public:
+    enum {MLT, MLT_COMPLEX, ADD, ADD_COMPLEX, DOT_PROD, DOT_PROD_COMPLEX,
+	  DOT_PROD_CONJ, NORM1, NORM1_COMPLEX, SUM_SQUARE};
+
+    //! minimal number of elements per thread
+    enum {GRAIN_SIZE = 32768};
+
+  protected:
+    const SimdKernelTable<T>& kernel_;
+    int type_;
+    T alpha_r_, alpha_i_;
+    const T* x_;
+    const T* y_;
+    T* z_;
+
+  public:
+    SimdBlockKernel(int type, T alpha_r, T alpha_i,
+		    const T* x, const T* y, T* z);
+
+    complex<T> operator()(size_t i0, size_t i1) const;
+  };
+
+
+  template<class T>
+  void SimdParallelUpdate(int type, size_t n, T alpha_r, T alpha_i,
+			  const T* x, T* z);
+
+  template<class T>
+  complex<T> SimdParallelReduce(int type, size_t n, const T* x, const T* y);
+
+  template<class T>
+  T SimdNorm2(size_t n, const T* x);
+
+  template<class T>
+  T SimdNorm1Complex(size_t n, const T* x);
+
+  template<class T>
+  bool SimdReproducibleBound(int type, size_t n, const T* x, const T* y,
+			     double& bound);
+
+  bool SimdReproducibleBound(int type, size_t n, const double* x,
+			     const double* y, double& bound);
+
+  const double* SimdConvertBlock(size_t n, const float* x, double* y);
+
+  bool SimdReproducibleBound(int type, size_t n, const float* x,
+			     const float* y, double& bound);
+
+  template<class T>
+  bool SimdSplitSum(int type, size_t n, const T* x, const T* y,
+		    double scale, const double* sigma, double* sum);
+
+  bool SimdSplitSum(int type, size_t n, const double* x, const double* y,
+		    double scale, const double* sigma, double* sum);
+
+  bool SimdSplitSum(int type, size_t n, const float* x, const float* y,
+		    double scale, const double* sigma, double* sum);
+
+
+#ifndef SELDON_WITH_BLAS
+
+
+  /////////
+  // MLT //
+
+
+  template <class Allocator>
+  void MltScalar(const float& alpha,
+		 Vector<float, VectFull, Allocator>& X);
+
+  template <class Allocator>
+  void MltScalar(const double& alpha,
+		 Vector<double, VectFull, Allocator>& X);
+
+  template <class Allocator>
+  void MltScalar(const float& alpha,
+		 Vector<complex<float>, VectFull, Allocator>& X);
+
+  template <class Allocator>
+  void MltScalar(const double& alpha,
+		 Vector<complex<double>, VectFull, Allocator>& X);
+
+  template <class Allocator>
+  void MltScalar(const complex<float>& alpha,
+		 Vector<complex<float>, VectFull, Allocator>& X);
+
+  template <class Allocator>
+  void MltScalar(const complex<double>& alpha,
+		 Vector<complex<double>, VectFull, Allocator>& X);
+
+
+  // MLT //
+  /////////
+
+
+  /////////
+  // ADD //
+
+
+  template <class Allocator0, class Allocator1>
+  void AddVector(const float& alpha,
+		 const Vector<float, VectFull, Allocator0>& X,
+		 Vector<float, VectFull, Allocator1>& Y);
+
+  template <class Allocator0, class Allocator1>
+  void AddVector(const double& alpha,
+		 const Vector<double, VectFull, Allocator0>& X,
+		 Vector<double, VectFull, Allocator1>& Y);
+
+  template <class Allocator0, class Allocator1>
+  void AddVector(const complex<float>& alpha,
+		 const Vector<complex<float>, VectFull, Allocator0>& X,
+		 Vector<complex<float>, VectFull, Allocator1>& Y);
+
+  template <class Allocator0, class Allocator1>
+  void AddVector(const complex<double>& alpha,
+		 const Vector<complex<double>, VectFull, Allocator0>& X,
+		 Vector<complex<double>, VectFull, Allocator1>& Y);
+
+
+  // ADD //
+  /////////
+
+
+  /////////////
+  // DOTPROD //
+
+
+  template <class Allocator0, class Allocator1>
+  float DotProdVector(const Vector<float, VectFull, Allocator0>& X,
+		      const Vector<float, VectFull, Allocator1>& Y);
+
+  template <class Allocator0, class Allocator1>
+  double DotProdVector(const Vector<double, VectFull, Allocator0>& X,
+		       const Vector<double, VectFull, Allocator1>& Y);
+
+  template <class Allocator0, class Allocator1>
+  complex<float>
+  DotProdVector(const Vector<complex<float>, VectFull, Allocator0>& X,
+		const Vector<complex<float>, VectFull, Allocator1>& Y);
+
+  template <class Allocator0, class Allocator1>
+  complex<double>
+  DotProdVector(const Vector<complex<double>, VectFull, Allocator0>& X,
+		const Vector<complex<double>, VectFull, Allocator1>& Y);
+
+  template <class Allocator0, class Allocator1>
+  float DotProdConjVector(const Vector<float, VectFull, Allocator0>& X,
+			  const Vector<float, VectFull, Allocator1>& Y);
+
+  template <class Allocator0, class Allocator1>
+  double DotProdConjVector(const Vector<double, VectFull, Allocator0>& X,
+			   const Vector<double, VectFull, Allocator1>& Y);
+
+  template <class Allocator0, class Allocator1>
+  complex<float>
+  DotProdConjVector(const Vector<complex<float>, VectFull, Allocator0>& X,
+		    const Vector<complex<float>, VectFull, Allocator1>& Y);
+
+  template <class Allocator0, class Allocator1>
+  complex<double>
+  DotProdConjVector(const Vector<complex<double>, VectFull, Allocator0>& X,
+		    const Vector<complex<double>, VectFull, Allocator1>& Y);
+
+
+  // DOTPROD //
+  /////////////
+
+
+  ///////////
+  // NORM1 //
+
+
+  template <class Allocator>
+  float Norm1(const Vector<float, VectFull, Allocator>& X);
+
+  template <class Allocator>
+  double Norm1(const Vector<double, VectFull, Allocator>& X);
+
+  template <class Allocator>
+  float Norm1(const Vector<complex<float>, VectFull, Allocator>& X);
+
+  template <class Allocator>
+  double Norm1(const Vector<complex<double>, VectFull, Allocator>& X);
+
+
+  // NORM1 //
+  ///////////
+
+
+  ///////////
+  // NORM2 //
+
+
+  template <class Allocator>
+  float Norm2(const Vector<float, VectFull, Allocator>& X);
+
+  template <class Allocator>
+  double Norm2(const Vector<double, VectFull, Allocator>& X);
+
+  template <class Allocator>
+  float Norm2(const Vector<complex<float>, VectFull, Allocator>& X);
+
+  template <class Allocator>
+  double Norm2(const Vector<complex<double>, VectFull, Allocator>& X);
+
+
+  // NORM2 //
+  ///////////
+
+
+#endif // SELDON_WITH_BLAS.
+
+
+#endif // SELDON_WITH_SIMD_DISPATCH.
+
+
+} // namespace Seldon.
+
+#endif
@@ -0,0 +1,213 @@
+// Copyright (C) 2016 INRIA
+//
+// This file is part of the linear-algebra library Seldon,
+// http://seldon.sourceforge.net/.
+//
+// Seldon is free software; you can redistribute it and/or modify it under the
+// terms of the GNU Lesser General Public License as published by the Free
+// Software Foundation; either version 2.1 of the License, or (at your option)
+// any later version.
+//
+// Seldon is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for
+// more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with Seldon. If not, see http://www.gnu.org/licenses/.
+
+
+#ifndef SELDON_FILE_FUNCTIONS_VECTOR_SIMD_INLINE_CXX
+
+#include "Functions_VectorSimd.hxx"
+
+namespace Seldon
+{
+
+
+  //! Returns the most recent instruction set supported by the processor.
+  inline int SimdInstructionSet::GetSupported()
+  {
+#ifdef SELDON_WITH_SIMD_DISPATCH
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f"))
+      return AVX512;
+
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"))
+      return AVX2;
+
+    if (__builtin_cpu_supports("sse2"))
+      return SSE2;
+#endif
+
+    return SCALAR;
+  }
+
+
+  //! Returns the instruction set used by the vector kernels.
+  inline int SimdInstructionSet::GetCurrent()
+  {
+    return GetCurrentRef();
+  }
+
+
+  //! Sets the instruction set used by the vector kernels.
+  /*!
+    \param[in] type instruction set. If it is not supported by the
+    processor, the most recent supported set is used.
+  */
+  inline void SimdInstructionSet::SetCurrent(int type)
+  {
+    GetCurrentRef() = min(type, GetSupported());
+  }
+
+
+  //! Returns the name of an instruction set.
+  inline string SimdInstructionSet::GetName(int type)
+  {
+    switch (type)
+      {
+      case SSE2:
+	return "SSE2";
+      case AVX2:
+	return "AVX2";
+      case AVX512:
+	return "AVX-512";
+      }
+
+    return "scalar";
+  }
+
+
+  //! Returns a reference to the current instruction set.
+  inline int& SimdInstructionSet::GetCurrentRef()
+  {
+    static int type = GetSupported();
+    return type;
+  }
+
+
+#ifdef SELDON_WITH_SIMD_DISPATCH
+
+
+  //! Computes the bound of the terms of a reproducible sum.
+  /*!
+    \param[in] type terms of the sum, as in ReproducibleBlockKernel.
+    \param[in] n number of real numbers.
+    \param[in] x first vector.
+    \param[in] y second vector (dot products only).
+    \param[out] bound maximal modulus of the terms, NaN being ignored.
+    \return true.
+  */
+  inline bool SimdReproducibleBound(int type, size_t n, const double* x,
+				    const double* y, double& bound)
+  {
+    typedef ReproducibleBlockKernel<double> Reduction;
+    const SimdKernelTable<double>& kernel
+      = SimdKernelTable<double>::GetCurrent();
+    if (type == Reduction::SUM_SQUARE || type == Reduction::SUM_SQUARE_COMPLEX)
+      bound = kernel.MaxAbs(n, x);
+    else
+      bound = kernel.MaxAbsProd(n, x, y, type != Reduction::DOT_PROD);
+
+    return true;
+  }
+
+
+  //! Adds the parts of the terms of a reproducible sum to the levels.
+  /*!
+    \param[in] type terms of the sum, as in ReproducibleBlockKernel.
+    \param[in] n number of real numbers.
+    \param[in] x first vector.
+    \param[in] y second vector (dot products only).
+    \param[in] scale power of 2 applied to the terms.
+    \param[in] sigma offsets of the levels of ReproducibleSum.
+    \param[in,out] sum sums of the levels of ReproducibleSum.
+    \return true.
+  */
+  inline bool SimdSplitSum(int type, size_t n, const double* x,
+			   const double* y, double scale,
+			   const double* sigma, double* sum)
+  {
+    typedef ReproducibleBlockKernel<double> Reduction;
+    if (type == Reduction::SUM_SQUARE_COMPLEX)
+      type = Reduction::SUM_SQUARE;
+
+    SimdKernelTable<double>::GetCurrent().SplitSum(n, x, y, type, scale,
+						   sigma, sum);
+    return true;
+  }
+
+
+  //! Converts a block of float to double.
+  /*!
+    \param[in] n number of values, at most SimdKernelTable::BLOCK_SIZE.
+    \param[in] x values to convert (not read if it is NULL).
+    \param[out] y converted values.
+    \return y, or NULL if x is NULL.
+  */
+  inline const double* SimdConvertBlock(size_t n, const float* x, double* y)
+  {
+    if (x == NULL)
+      return NULL;
+
+    SimdKernelTable<float>::GetCurrent().Convert(n, x, y);
+    return y;
+  }
+
+
+  //! Computes the bound of the terms of a reproducible sum.
+  /*!
+    The values are converted to double by blocks, the products of float
+    being exact in double.
+  */
+  inline bool SimdReproducibleBound(int type, size_t n, const float* x,
+				    const float* y, double& bound)
+  {
+    const size_t nb = SimdKernelTable<float>::BLOCK_SIZE;
+    double x_block[nb], y_block[nb], value;
+    bound = 0.;
+    for (size_t i = 0; i < n; i += nb)
+      {
+	size_t m = min(nb, n - i);
+	SimdReproducibleBound(type, m, SimdConvertBlock(m, x + i, x_block),
+			      SimdConvertBlock(m, y == NULL ? y : y + i,
+					       y_block), value);
+	if (value > bound)
+	  bound = value;
+      }
+
+    return true;
+  }
+
+
+  //! Adds the parts of the terms of a reproducible sum to the levels.
+  /*!
+    The values are converted to double by blocks, the products of float
+    being exact in double.
+  */
+  inline bool SimdSplitSum(int type, size_t n, const float* x,
+			   const float* y, double scale,
+			   const double* sigma, double* sum)
+  {
+    const size_t nb = SimdKernelTable<float>::BLOCK_SIZE;
+    double x_block[nb], y_block[nb];
+    for (size_t i = 0; i < n; i += nb)
+      {
+	size_t m = min(nb, n - i);
+	SimdSplitSum(type, m, SimdConvertBlock(m, x + i, x_block),
+		     SimdConvertBlock(m, y == NULL ? y : y + i, y_block),
+		     scale, sigma, sum);
+      }
+
+    return true;
+  }
+
+
+#endif // SELDON_WITH_SIMD_DISPATCH.
+
+
+} // namespace Seldon.
+
+#define SELDON_FILE_FUNCTIONS_VECTOR_SIMD_INLINE_CXX
+#endif
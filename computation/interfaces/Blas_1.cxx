@@ -419,6 +419,11 @@ namespace Seldon
     CheckDim(X, Y, "DotProd(X, Y)", "dot(X, Y)");
 #endif
 
+    float value;
+    if (ParallelContext::IsDeterministic()
+	&& ReproducibleDotProd(X, Y, false, value))
+      return value;
+
     return cblas_sdot(Y.GetLength(),
 		      reinterpret_cast<const float*>(X.GetData()), 1,
 		      reinterpret_cast<const float*>(Y.GetData()), 1);
@@ -434,6 +439,11 @@ namespace Seldon
     CheckDim(X, Y, "DotProd(X, Y)", "dot(X, Y)");
 #endif
 
+    double value;
+    if (ParallelContext::IsDeterministic()
+	&& ReproducibleDotProd(X, Y, false, value))
+      return value;
+
     return cblas_ddot(Y.GetLength(),
 		      reinterpret_cast<const double*>(X.GetData()), 1,
 		      reinterpret_cast<const double*>(Y.GetData()), 1);
@@ -450,6 +460,11 @@ namespace Seldon
     CheckDim(X, Y, "DotProd(X, Y)", "dot(X, Y)");
 #endif
 
+    complex<float> value;
+    if (ParallelContext::IsDeterministic()
+	&& ReproducibleDotProd(X, Y, false, value))
+      return value;
+
     // not using cblas_cdotu_sub because of a bug in mkl function
 #ifdef SELDON_WITHOUT_CBLAS_LIB
     complex<float> dotu;
@@ -479,7 +494,12 @@ namespace Seldon
 #ifdef SELDON_CHECK_DIMENSIONS
     CheckDim(X, Y, "DotProd(X, Y)", "dot(X, Y)");
 #endif
-    
+
+    complex<double> value;
+    if (ParallelContext::IsDeterministic()
+	&& ReproducibleDotProd(X, Y, false, value))
+      return value;
+
     // not using cblas_zdotu_sub because of a bug in mkl function
 #ifdef SELDON_WITHOUT_CBLAS_LIB
     complex<double> dotu;
@@ -544,6 +564,11 @@ namespace Seldon
     CheckDim(X, Y, "DotProdConj(X, Y)", "dot(X, Y)");
 #endif
 
+    complex<float> value;
+    if (ParallelContext::IsDeterministic()
+	&& ReproducibleDotProd(X, Y, true, value))
+      return value;
+
     // not using cblas_cdotc_sub because of a bug in mkl function
 #ifdef SELDON_WITHOUT_CBLAS_LIB
     complex<float> dotc;
@@ -574,6 +599,11 @@ namespace Seldon
     CheckDim(X, Y, "DotProdConj(X, Y)", "dot(X, Y)");
 #endif
 
+    complex<double> value;
+    if (ParallelContext::IsDeterministic()
+	&& ReproducibleDotProd(X, Y, true, value))
+      return value;
+
     // not using cblas_zdotc_sub because of a bug in mkl function
 #ifdef SELDON_WITHOUT_CBLAS_LIB
     complex<double> dotc;
@@ -661,6 +691,10 @@ namespace Seldon
   template <class Allocator>
   float Norm2(const Vector<float, VectFull, Allocator>& X)
   {
+    float value;
+    if (ParallelContext::IsDeterministic() && ReproducibleNorm2(X, value))
+      return value;
+
     return cblas_snrm2(X.GetLength(),
 		       reinterpret_cast<const float*>(X.GetData()), 1);
   }
@@ -669,6 +703,10 @@ namespace Seldon
   template <class Allocator>
   double Norm2(const Vector<double, VectFull, Allocator>& X)
   {
+    double value;
+    if (ParallelContext::IsDeterministic() && ReproducibleNorm2(X, value))
+      return value;
+
     return cblas_dnrm2(X.GetLength(),
 		       reinterpret_cast<const double*>(X.GetData()), 1);
   }
@@ -677,6 +715,10 @@ namespace Seldon
   template <class Allocator>
   float Norm2(const Vector<complex<float>, VectFull, Allocator>& X)
   {
+    float value;
+    if (ParallelContext::IsDeterministic() && ReproducibleNorm2(X, value))
+      return value;
+
     return cblas_scnrm2(X.GetLength(),
 			reinterpret_cast<const void*>(X.GetData()), 1);
   }
@@ -685,6 +727,10 @@ namespace Seldon
   template <class Allocator>
   double Norm2(const Vector<complex<double>, VectFull, Allocator>& X)
   {
+    double value;
+    if (ParallelContext::IsDeterministic() && ReproducibleNorm2(X, value))
+      return value;
+
     return cblas_dznrm2(X.GetLength(),
 			reinterpret_cast<const void*>(X.GetData()), 1);
   }
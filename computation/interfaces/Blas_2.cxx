@@ -1527,6 +1527,186 @@ namespace Seldon
   }
 
 
+  /*** Strided views on ColMajor or RowMajor matrices ***/
+
+
+  template <class Prop0, class Storage0, class Allocator0,
+	    class Allocator1, class Allocator2>
+  void MltAddVector(const float& alpha,
+		    const Matrix<float, Prop0, StridedSubStorage<Storage0>,
+		    Allocator0>& A,
+		    const Vector<float, VectFull, Allocator1>& X,
+		    const float& beta,
+		    Vector<float, VectFull, Allocator2>& Y)
+  {
+
+#ifdef SELDON_CHECK_DIMENSIONS
+    CheckDim(A, X, Y, "MltAdd(alpha, M, X, beta, Y)");
+#endif
+
+    cblas_sgemv(CblasOrder<Storage0>::value, CblasNoTrans,
+		A.GetM(), A.GetN(), alpha, A.GetData(), A.GetLD(),
+		X.GetData(), 1, beta, Y.GetData(), 1);
+  }
+
+
+  template <class Prop0, class Storage0, class Allocator0,
+	    class Allocator1, class Allocator2>
+  void MltAddVector(const double& alpha,
+		    const Matrix<double, Prop0, StridedSubStorage<Storage0>,
+		    Allocator0>& A,
+		    const Vector<double, VectFull, Allocator1>& X,
+		    const double& beta,
+		    Vector<double, VectFull, Allocator2>& Y)
+  {
+
+#ifdef SELDON_CHECK_DIMENSIONS
+    CheckDim(A, X, Y, "MltAdd(alpha, M, X, beta, Y)");
+#endif
+
+    cblas_dgemv(CblasOrder<Storage0>::value, CblasNoTrans,
+		A.GetM(), A.GetN(), alpha, A.GetData(), A.GetLD(),
+		X.GetData(), 1, beta, Y.GetData(), 1);
+  }
+
+
+  template <class Prop0, class Storage0, class Allocator0,
+	    class Allocator1, class Allocator2>
+  void MltAddVector(const complex<float>& alpha,
+		    const Matrix<complex<float>, Prop0, StridedSubStorage<Storage0>,
+		    Allocator0>& A,
+		    const Vector<complex<float>, VectFull, Allocator1>& X,
+		    const complex<float>& beta,
+		    Vector<complex<float>, VectFull, Allocator2>& Y)
+  {
+
+#ifdef SELDON_CHECK_DIMENSIONS
+    CheckDim(A, X, Y, "MltAdd(alpha, M, X, beta, Y)");
+#endif
+
+    cblas_cgemv(CblasOrder<Storage0>::value, CblasNoTrans,
+		A.GetM(), A.GetN(), reinterpret_cast<const void*>(&alpha),
+		reinterpret_cast<const void*>(A.GetData()), A.GetLD(),
+		reinterpret_cast<const void*>(X.GetData()), 1,
+		reinterpret_cast<const void*>(&beta),
+		reinterpret_cast<void*>(Y.GetData()), 1);
+  }
+
+
+  template <class Prop0, class Storage0, class Allocator0,
+	    class Allocator1, class Allocator2>
+  void MltAddVector(const complex<double>& alpha,
+		    const Matrix<complex<double>, Prop0, StridedSubStorage<Storage0>,
+		    Allocator0>& A,
+		    const Vector<complex<double>, VectFull, Allocator1>& X,
+		    const complex<double>& beta,
+		    Vector<complex<double>, VectFull, Allocator2>& Y)
+  {
+
+#ifdef SELDON_CHECK_DIMENSIONS
+    CheckDim(A, X, Y, "MltAdd(alpha, M, X, beta, Y)");
+#endif
+
+    cblas_zgemv(CblasOrder<Storage0>::value, CblasNoTrans,
+		A.GetM(), A.GetN(), reinterpret_cast<const void*>(&alpha),
+		reinterpret_cast<const void*>(A.GetData()), A.GetLD(),
+		reinterpret_cast<const void*>(X.GetData()), 1,
+		reinterpret_cast<const void*>(&beta),
+		reinterpret_cast<void*>(Y.GetData()), 1);
+  }
+
+
+  template <class Prop0, class Storage0, class Allocator0,
+	    class Allocator1, class Allocator2>
+  void MltAddVector(const float& alpha,
+		    const SeldonTranspose& TransA,
+		    const Matrix<float, Prop0, StridedSubStorage<Storage0>,
+		    Allocator0>& A,
+		    const Vector<float, VectFull, Allocator1>& X,
+		    const float& beta,
+		    Vector<float, VectFull, Allocator2>& Y)
+  {
+
+#ifdef SELDON_CHECK_DIMENSIONS
+    CheckDim(TransA, A, X, Y, "MltAdd(alpha, status, M, X, beta, Y)");
+#endif
+
+    cblas_sgemv(CblasOrder<Storage0>::value, TransA,
+		A.GetM(), A.GetN(), alpha, A.GetData(), A.GetLD(),
+		X.GetData(), 1, beta, Y.GetData(), 1);
+  }
+
+
+  template <class Prop0, class Storage0, class Allocator0,
+	    class Allocator1, class Allocator2>
+  void MltAddVector(const double& alpha,
+		    const SeldonTranspose& TransA,
+		    const Matrix<double, Prop0, StridedSubStorage<Storage0>,
+		    Allocator0>& A,
+		    const Vector<double, VectFull, Allocator1>& X,
+		    const double& beta,
+		    Vector<double, VectFull, Allocator2>& Y)
+  {
+
+#ifdef SELDON_CHECK_DIMENSIONS
+    CheckDim(TransA, A, X, Y, "MltAdd(alpha, status, M, X, beta, Y)");
+#endif
+
+    cblas_dgemv(CblasOrder<Storage0>::value, TransA,
+		A.GetM(), A.GetN(), alpha, A.GetData(), A.GetLD(),
+		X.GetData(), 1, beta, Y.GetData(), 1);
+  }
+
+
+  template <class Prop0, class Storage0, class Allocator0,
+	    class Allocator1, class Allocator2>
+  void MltAddVector(const complex<float>& alpha,
+		    const SeldonTranspose& TransA,
+		    const Matrix<complex<float>, Prop0, StridedSubStorage<Storage0>,
+		    Allocator0>& A,
+		    const Vector<complex<float>, VectFull, Allocator1>& X,
+		    const complex<float>& beta,
+		    Vector<complex<float>, VectFull, Allocator2>& Y)
+  {
+
+#ifdef SELDON_CHECK_DIMENSIONS
+    CheckDim(TransA, A, X, Y, "MltAdd(alpha, status, M, X, beta, Y)");
+#endif
+
+    cblas_cgemv(CblasOrder<Storage0>::value, TransA,
+		A.GetM(), A.GetN(), reinterpret_cast<const void*>(&alpha),
+		reinterpret_cast<const void*>(A.GetData()), A.GetLD(),
+		reinterpret_cast<const void*>(X.GetData()), 1,
+		reinterpret_cast<const void*>(&beta),
+		reinterpret_cast<void*>(Y.GetData()), 1);
+  }
+
+
+  template <class Prop0, class Storage0, class Allocator0,
+	    class Allocator1, class Allocator2>
+  void MltAddVector(const complex<double>& alpha,
+		    const SeldonTranspose& TransA,
+		    const Matrix<complex<double>, Prop0, StridedSubStorage<Storage0>,
+		    Allocator0>& A,
+		    const Vector<complex<double>, VectFull, Allocator1>& X,
+		    const complex<double>& beta,
+		    Vector<complex<double>, VectFull, Allocator2>& Y)
+  {
+
+#ifdef SELDON_CHECK_DIMENSIONS
+    CheckDim(TransA, A, X, Y, "MltAdd(alpha, status, M, X, beta, Y)");
+#endif
+
+    cblas_zgemv(CblasOrder<Storage0>::value, TransA,
+		A.GetM(), A.GetN(), reinterpret_cast<const void*>(&alpha),
+		reinterpret_cast<const void*>(A.GetData()), A.GetLD(),
+		reinterpret_cast<const void*>(X.GetData()), 1,
+		reinterpret_cast<const void*>(&beta),
+		reinterpret_cast<void*>(Y.GetData()), 1);
+  }
+
+
+
   // Hermitian //
 
   /*** ColHerm and Upper ***/
@@ -696,6 +696,107 @@ namespace Seldon
 		    Vector<complex<double>, VectFull, Allocator2>& Y);
   
   
+  /*** Strided views on ColMajor or RowMajor matrices ***/
+
+
+  //! Cblas order of a dense storage.
+  template <class Storage>
+  class CblasOrder;
+
+  template <>
+  class CblasOrder<ColMajor>
+  {
+  public:
+    static const CBLAS_ORDER value = CblasColMajor;
+  };
+
+  template <>
+  class CblasOrder<RowMajor>
+  {
+  public:
+    static const CBLAS_ORDER value = CblasRowMajor;
+  };
+
+
+  template <class Prop0, class Storage0, class Allocator0,
+	    class Allocator1, class Allocator2>
+  void MltAddVector(const float& alpha,
+		    const Matrix<float, Prop0, StridedSubStorage<Storage0>,
+		    Allocator0>& A,
+		    const Vector<float, VectFull, Allocator1>& X,
+		    const float& beta,
+		    Vector<float, VectFull, Allocator2>& Y);
+
+  template <class Prop0, class Storage0, class Allocator0,
+	    class Allocator1, class Allocator2>
+  void MltAddVector(const double& alpha,
+		    const Matrix<double, Prop0, StridedSubStorage<Storage0>,
+		    Allocator0>& A,
+		    const Vector<double, VectFull, Allocator1>& X,
+		    const double& beta,
+		    Vector<double, VectFull, Allocator2>& Y);
+
+  template <class Prop0, class Storage0, class Allocator0,
+	    class Allocator1, class Allocator2>
+  void MltAddVector(const complex<float>& alpha,
+		    const Matrix<complex<float>, Prop0, StridedSubStorage<Storage0>,
+		    Allocator0>& A,
+		    const Vector<complex<float>, VectFull, Allocator1>& X,
+		    const complex<float>& beta,
+		    Vector<complex<float>, VectFull, Allocator2>& Y);
+
+  template <class Prop0, class Storage0, class Allocator0,
+	    class Allocator1, class Allocator2>
+  void MltAddVector(const complex<double>& alpha,
+		    const Matrix<complex<double>, Prop0, StridedSubStorage<Storage0>,
+		    Allocator0>& A,
+		    const Vector<complex<double>, VectFull, Allocator1>& X,
+		    const complex<double>& beta,
+		    Vector<complex<double>, VectFull, Allocator2>& Y);
+
+
+  template <class Prop0, class Storage0, class Allocator0,
+	    class Allocator1, class Allocator2>
+  void MltAddVector(const float& alpha,
+		    const SeldonTranspose& TransA,
+		    const Matrix<float, Prop0, StridedSubStorage<Storage0>,
+		    Allocator0>& A,
+		    const Vector<float, VectFull, Allocator1>& X,
+		    const float& beta,
+		    Vector<float, VectFull, Allocator2>& Y);
+
+  template <class Prop0, class Storage0, class Allocator0,
+	    class Allocator1, class Allocator2>
+  void MltAddVector(const double& alpha,
+		    const SeldonTranspose& TransA,
+		    const Matrix<double, Prop0, StridedSubStorage<Storage0>,
+		    Allocator0>& A,
+		    const Vector<double, VectFull, Allocator1>& X,
+		    const double& beta,
+		    Vector<double, VectFull, Allocator2>& Y);
+
+  template <class Prop0, class Storage0, class Allocator0,
+	    class Allocator1, class Allocator2>
+  void MltAddVector(const complex<float>& alpha,
+		    const SeldonTranspose& TransA,
+		    const Matrix<complex<float>, Prop0, StridedSubStorage<Storage0>,
+		    Allocator0>& A,
+		    const Vector<complex<float>, VectFull, Allocator1>& X,
+		    const complex<float>& beta,
+		    Vector<complex<float>, VectFull, Allocator2>& Y);
+
+  template <class Prop0, class Storage0, class Allocator0,
+	    class Allocator1, class Allocator2>
+  void MltAddVector(const complex<double>& alpha,
+		    const SeldonTranspose& TransA,
+		    const Matrix<complex<double>, Prop0, StridedSubStorage<Storage0>,
+		    Allocator0>& A,
+		    const Vector<complex<double>, VectFull, Allocator1>& X,
+		    const complex<double>& beta,
+		    Vector<complex<double>, VectFull, Allocator2>& Y);
+
+
+
   // Hermitian //
 
   /*** ColHerm and Upper ***/
@@ -419,6 +419,226 @@ namespace Seldon
   }
 
 
+  /*** Strided views on ColMajor or RowMajor matrices ***/
+
+
+  template <class Prop0, class Storage0, class Allocator0,
+	    class Prop1, class Allocator1,
+	    class Prop2, class Allocator2>
+  void MltAddMatrix(const float& alpha,
+		    const Matrix<float, Prop0, StridedSubStorage<Storage0>,
+		    Allocator0>& A,
+		    const Matrix<float, Prop1, StridedSubStorage<Storage0>,
+		    Allocator1>& B,
+		    const float& beta,
+		    Matrix<float, Prop2, StridedSubStorage<Storage0>,
+		    Allocator2>& C)
+  {
+
+#ifdef SELDON_CHECK_DIMENSIONS
+    CheckDim(A, B, C, "MltAdd(alpha, A, B, beta, C)");
+#endif
+
+    cblas_sgemm(CblasOrder<Storage0>::value, CblasNoTrans, CblasNoTrans,
+		C.GetM(), C.GetN(), A.GetN(),
+		alpha, A.GetData(), A.GetLD(), B.GetData(), B.GetLD(),
+		beta, C.GetData(), C.GetLD());
+  }
+
+
+  template <class Prop0, class Storage0, class Allocator0,
+	    class Prop1, class Allocator1,
+	    class Prop2, class Allocator2>
+  void MltAddMatrix(const double& alpha,
+		    const Matrix<double, Prop0, StridedSubStorage<Storage0>,
+		    Allocator0>& A,
+		    const Matrix<double, Prop1, StridedSubStorage<Storage0>,
+		    Allocator1>& B,
+		    const double& beta,
+		    Matrix<double, Prop2, StridedSubStorage<Storage0>,
+		    Allocator2>& C)
+  {
+
+#ifdef SELDON_CHECK_DIMENSIONS
+    CheckDim(A, B, C, "MltAdd(alpha, A, B, beta, C)");
+#endif
+
+    cblas_dgemm(CblasOrder<Storage0>::value, CblasNoTrans, CblasNoTrans,
+		C.GetM(), C.GetN(), A.GetN(),
+		alpha, A.GetData(), A.GetLD(), B.GetData(), B.GetLD(),
+		beta, C.GetData(), C.GetLD());
+  }
+
+
+  template <class Prop0, class Storage0, class Allocator0,
+	    class Prop1, class Allocator1,
+	    class Prop2, class Allocator2>
+  void MltAddMatrix(const complex<float>& alpha,
+		    const Matrix<complex<float>, Prop0, StridedSubStorage<Storage0>,
+		    Allocator0>& A,
+		    const Matrix<complex<float>, Prop1, StridedSubStorage<Storage0>,
+		    Allocator1>& B,
+		    const complex<float>& beta,
+		    Matrix<complex<float>, Prop2, StridedSubStorage<Storage0>,
+		    Allocator2>& C)
+  {
+
+#ifdef SELDON_CHECK_DIMENSIONS
+    CheckDim(A, B, C, "MltAdd(alpha, A, B, beta, C)");
+#endif
+
+    cblas_cgemm(CblasOrder<Storage0>::value, CblasNoTrans, CblasNoTrans,
+		C.GetM(), C.GetN(), A.GetN(),
+		reinterpret_cast<const void*>(&alpha),
+		reinterpret_cast<const void*>(A.GetData()), A.GetLD(),
+		reinterpret_cast<const void*>(B.GetData()), B.GetLD(),
+		reinterpret_cast<const void*>(&beta),
+		reinterpret_cast<void*>(C.GetData()), C.GetLD());
+  }
+
+
+  template <class Prop0, class Storage0, class Allocator0,
+	    class Prop1, class Allocator1,
+	    class Prop2, class Allocator2>
+  void MltAddMatrix(const complex<double>& alpha,
+		    const Matrix<complex<double>, Prop0, StridedSubStorage<Storage0>,
+		    Allocator0>& A,
+		    const Matrix<complex<double>, Prop1, StridedSubStorage<Storage0>,
+		    Allocator1>& B,
+		    const complex<double>& beta,
+		    Matrix<complex<double>, Prop2, StridedSubStorage<Storage0>,
+		    Allocator2>& C)
+  {
+
+#ifdef SELDON_CHECK_DIMENSIONS
+    CheckDim(A, B, C, "MltAdd(alpha, A, B, beta, C)");
+#endif
+
+    cblas_zgemm(CblasOrder<Storage0>::value, CblasNoTrans, CblasNoTrans,
+		C.GetM(), C.GetN(), A.GetN(),
+		reinterpret_cast<const void*>(&alpha),
+		reinterpret_cast<const void*>(A.GetData()), A.GetLD(),
+		reinterpret_cast<const void*>(B.GetData()), B.GetLD(),
+		reinterpret_cast<const void*>(&beta),
+		reinterpret_cast<void*>(C.GetData()), C.GetLD());
+  }
+
+
+  template <class Prop0, class Storage0, class Allocator0,
+	    class Prop1, class Allocator1,
+	    class Prop2, class Allocator2>
+  void MltAddMatrix(const float& alpha,
+		    const SeldonTranspose& TransA,
+		    const Matrix<float, Prop0, StridedSubStorage<Storage0>,
+		    Allocator0>& A,
+		    const SeldonTranspose& TransB,
+		    const Matrix<float, Prop1, StridedSubStorage<Storage0>,
+		    Allocator1>& B,
+		    const float& beta,
+		    Matrix<float, Prop2, StridedSubStorage<Storage0>,
+		    Allocator2>& C)
+  {
+
+#ifdef SELDON_CHECK_DIMENSIONS
+    CheckDim(TransA, A, TransB, B, C,
+	     "MltAdd(alpha, TransA, A, TransB, B, beta, C)");
+#endif
+
+    cblas_sgemm(CblasOrder<Storage0>::value, TransA, TransB,
+		C.GetM(), C.GetN(), A.GetN(TransA),
+		alpha, A.GetData(), A.GetLD(), B.GetData(), B.GetLD(),
+		beta, C.GetData(), C.GetLD());
+  }
+
+
+  template <class Prop0, class Storage0, class Allocator0,
+	    class Prop1, class Allocator1,
+	    class Prop2, class Allocator2>
+  void MltAddMatrix(const double& alpha,
+		    const SeldonTranspose& TransA,
+		    const Matrix<double, Prop0, StridedSubStorage<Storage0>,
+		    Allocator0>& A,
+		    const SeldonTranspose& TransB,
+		    const Matrix<double, Prop1, StridedSubStorage<Storage0>,
+		    Allocator1>& B,
+		    const double& beta,
+		    Matrix<double, Prop2, StridedSubStorage<Storage0>,
+		    Allocator2>& C)
+  {
+
+#ifdef SELDON_CHECK_DIMENSIONS
+    CheckDim(TransA, A, TransB, B, C,
+	     "MltAdd(alpha, TransA, A, TransB, B, beta, C)");
+#endif
+
+    cblas_dgemm(CblasOrder<Storage0>::value, TransA, TransB,
+		C.GetM(), C.GetN(), A.GetN(TransA),
+		alpha, A.GetData(), A.GetLD(), B.GetData(), B.GetLD(),
+		beta, C.GetData(), C.GetLD());
+  }
+
+
+  template <class Prop0, class Storage0, class Allocator0,
+	    class Prop1, class Allocator1,
+	    class Prop2, class Allocator2>
+  void MltAddMatrix(const complex<float>& alpha,
+		    const SeldonTranspose& TransA,
+		    const Matrix<complex<float>, Prop0, StridedSubStorage<Storage0>,
+		    Allocator0>& A,
+		    const SeldonTranspose& TransB,
+		    const Matrix<complex<float>, Prop1, StridedSubStorage<Storage0>,
+		    Allocator1>& B,
+		    const complex<float>& beta,
+		    Matrix<complex<float>, Prop2, StridedSubStorage<Storage0>,
+		    Allocator2>& C)
+  {
+
+#ifdef SELDON_CHECK_DIMENSIONS
+    CheckDim(TransA, A, TransB, B, C,
+	     "MltAdd(alpha, TransA, A, TransB, B, beta, C)");
+#endif
+
+    cblas_cgemm(CblasOrder<Storage0>::value, TransA, TransB,
+		C.GetM(), C.GetN(), A.GetN(TransA),
+		reinterpret_cast<const void*>(&alpha),
+		reinterpret_cast<const void*>(A.GetData()), A.GetLD(),
+		reinterpret_cast<const void*>(B.GetData()), B.GetLD(),
+		reinterpret_cast<const void*>(&beta),
+		reinterpret_cast<void*>(C.GetData()), C.GetLD());
+  }
+
+
+  template <class Prop0, class Storage0, class Allocator0,
+	    class Prop1, class Allocator1,
+	    class Prop2, class Allocator2>
+  void MltAddMatrix(const complex<double>& alpha,
+		    const SeldonTranspose& TransA,
+		    const Matrix<complex<double>, Prop0, StridedSubStorage<Storage0>,
+		    Allocator0>& A,
+		    const SeldonTranspose& TransB,
+		    const Matrix<complex<double>, Prop1, StridedSubStorage<Storage0>,
+		    Allocator1>& B,
+		    const complex<double>& beta,
+		    Matrix<complex<double>, Prop2, StridedSubStorage<Storage0>,
+		    Allocator2>& C)
+  {
+
+#ifdef SELDON_CHECK_DIMENSIONS
+    CheckDim(TransA, A, TransB, B, C,
+	     "MltAdd(alpha, TransA, A, TransB, B, beta, C)");
+#endif
+
+    cblas_zgemm(CblasOrder<Storage0>::value, TransA, TransB,
+		C.GetM(), C.GetN(), A.GetN(TransA),
+		reinterpret_cast<const void*>(&alpha),
+		reinterpret_cast<const void*>(A.GetData()), A.GetLD(),
+		reinterpret_cast<const void*>(B.GetData()), B.GetLD(),
+		reinterpret_cast<const void*>(&beta),
+		reinterpret_cast<void*>(C.GetData()), C.GetLD());
+  }
+
+
+
   // MltAdd //
   ////////////
 
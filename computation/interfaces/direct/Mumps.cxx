@@ -430,6 +430,44 @@ namespace Seldon
   }
 
   
+  //! Numerical factorization of a matrix whose pattern has been analyzed
+  /*!
+    The analysis performed by PerformAnalysis or FactorizeMatrix is reused,
+    mat must have the same pattern as the analyzed matrix. Contrary to
+    PerformFactorization, any storage can be used.
+    \param[in,out] mat matrix to factorize
+    \param[in] keep_matrix if false, the given matrix is cleared
+  */
+  template<class T> template<class T0, class Prop, class Storage, class Allocator>
+  void MatrixMumps<T>
+  ::RefactorizeMatrix(Matrix<T0, Prop, Storage, Allocator> & mat,
+                      bool keep_matrix)
+  {
+    int n = mat.GetM();
+    // conversion in coordinate format with fortran convention (1-index)
+    Vector<MUMPS_INT> num_row, num_col; Vector<T> values;
+    ConvertMatrix_to_Coordinates(mat, num_row, num_col, values, 1);
+    if (!keep_matrix)
+      mat.Clear();
+
+    if ((struct_mumps.n != n) || (struct_mumps.nz != values.GetM()))
+      throw WrongArgument("MatrixMumps::RefactorizeMatrix(Matrix&, bool)",
+                          "The pattern of the matrix differs from the "
+                          "analyzed pattern.");
+
+    // row and column numbers are the same as for the analysis
+    struct_mumps.irn = num_row.GetData();
+    struct_mumps.jcn = num_col.GetData();
+    struct_mumps.a = reinterpret_cast<pointer>(values.GetData());
+
+    // Call the MUMPS package.
+    struct_mumps.job = 2; // we factorize the system
+    CallMumps();
+
+    IterateFacto();
+  }
+
+
   //! Returns memory used by the factorisation in bytes
   template<class T>
   int64_t MatrixMumps<T>::GetMemorySize() const
@@ -185,9 +185,22 @@ namespace Seldon
 
   template<class T>
   void MatrixPardiso<T>::FactorizeCSR(bool sym)
+  {
+    PerformAnalysis(sym);
+    if ((size_matrix <= 0) || (info_facto != 0))
+      return;
+
+    PerformFactorization();
+  }
+
+
+  //! performs analysis and symbolic factorisation of ptrA, indA
+  template<class T>
+  void MatrixPardiso<T>::PerformAnalysis(bool sym)
   {
     // checking that the matrix is non-empty
     size_matrix = ptrA.GetM()-1;
+    info_facto = 0;
     if (size_matrix <= 0)
       return;
     
@@ -276,9 +289,19 @@ namespace Seldon
         cout << "Number of non-zero factors  = " << iparm[17] << endl;
         cout << "Number of factorization MFLOPS = " << iparm[18] << endl;
       }
-    
+  }
+
+
+  //! performs numerical factorisation of the analyzed matrix
+  template<class T>
+  void MatrixPardiso<T>::PerformFactorization()
+  {
+    double ddum;
+    pardiso_int_t nrhs = 0, error = 0;
+    info_facto = 0;
+
     // numerical factorization
-    phase = 22;
+    pardiso_int_t phase = 22;
     // MKL version
     call_pardiso(pt, &maxfct, &mnum, &mtype, &phase, &size_matrix,
                  valA.GetData(), ptrA.GetData(), indA.GetData(), 
@@ -301,6 +324,54 @@ namespace Seldon
     if (msglvl >= 1)
       cout << "Factorization completed" << endl;
   }
+
+
+  //! performs analysis of matrix mat
+  /*!
+    The numerical factorisation is performed by RefactorizeMatrix,
+    the matrix mat is not modified.
+  */
+  template<class T> template<class T0, class Prop, class Storage, class Allocator>
+  void MatrixPardiso<T>::AnalyzeMatrix(Matrix<T0, Prop, Storage, Allocator>& mat)
+  {
+    // previous factorization is cleared if present
+    Clear();
+
+    // conversion of sparse matrix into CSR form
+    Prop prop;
+    ConvertToCSR(mat, prop, ptrA, indA, valA);
+
+    PerformAnalysis(IsSymmetricMatrix(mat));
+  }
+
+
+  //! performs numerical factorisation of matrix mat
+  /*!
+    The analysis of the last call to AnalyzeMatrix or FactorizeMatrix is
+    reused, mat must have the same pattern as the analyzed matrix.
+  */
+  template<class T> template<class T0, class Prop, class Storage, class Allocator>
+  void MatrixPardiso<T>::RefactorizeMatrix(Matrix<T0, Prop, Storage, Allocator>& mat,
+                                           bool keep_matrix)
+  {
+    Vector<pardiso_int_t> Ptr, Ind;
+    Vector<T> Val;
+    Prop prop;
+    ConvertToCSR(mat, prop, Ptr, Ind, Val);
+    if (!keep_matrix)
+      mat.Clear();
+
+    if ((size_matrix <= 0) || (Val.GetM() != valA.GetM()))
+      throw WrongArgument("MatrixPardiso::RefactorizeMatrix(Matrix&, bool)",
+                          "The pattern of the matrix differs from the "
+                          "analyzed pattern.");
+
+    // only values are modified
+    for (int i = 0; i < Val.GetM(); i++)
+      valA(i) = Val(i);
+
+    PerformFactorization();
+  }
   
     
   //! solves A x = b, x contains the source b on input, the solution x on output
@@ -73,6 +73,10 @@ namespace Seldon
     Vector<pardiso_int_t> perm; //!< permutation array
     pardiso_int_t type_ordering;
     
+    void PerformAnalysis(bool sym);
+    void PerformFactorization();
+
+
   public :
     MatrixPardiso();
     ~MatrixPardiso();
@@ -98,6 +102,13 @@ namespace Seldon
 		      Vector<T>& Values, bool sym);
     
     void FactorizeCSR(bool sym); 
+
+    template<class T0, class Prop, class Storage, class Allocator>
+    void AnalyzeMatrix(Matrix<T0, Prop, Storage, Allocator>& mat);
+
+    template<class T0, class Prop, class Storage, class Allocator>
+    void RefactorizeMatrix(Matrix<T0, Prop, Storage, Allocator>& mat,
+                           bool keep_matrix = false);
    
     template<class Allocator2>
     void Solve(Vector<T, VectFull, Allocator2>& x);
@@ -58,6 +58,9 @@ namespace Seldon
     print_level = 0;
     refine_solution = false;
     enforce_unsym_ilut = false;
+    out_of_core = false;
+    ooc_memory_budget = 0;
+    ooc_directory = ".";
     // for this default value, the corresponding method of the
     // sparse solver will not be called
     pivot_threshold = -2.0;
@@ -66,6 +69,17 @@ namespace Seldon
     InitSolver();
   }
   
+
+  //! destructor
+  template<class T>
+  SparseDirectSolver<T>::~SparseDirectSolver()
+  {
+    // the solver is deleted so that files written on the disk
+    // (out-of-core) are removed
+    if (solver != NULL)
+      delete solver;
+  }
+  
   
   //! clearing factorisation
   template<class T>
@@ -121,6 +135,7 @@ namespace Seldon
 	return true;
 #endif
 	return false;
+      case SELDON_SUPERNODAL: return true;
       default:
 	return false;
       }
@@ -172,6 +187,10 @@ namespace Seldon
               
               type_ordering = SparseMatrixOrdering::IDENTITY;
               
+              // reducing the bandwidth limits the size of the fronts
+              if (type_solver == SELDON_SUPERNODAL)
+                type_ordering = SparseMatrixOrdering::REVERSE_CUTHILL_MCKEE;
+
 #ifdef SELDON_WITH_UMFPACK
               type_ordering = SparseMatrixOrdering::AMD;
 #endif
@@ -347,6 +366,8 @@ namespace Seldon
   void SparseDirectSolver<T>
   ::ComputeOrdering(Matrix<T0, Prop, Storage, Alloc>& A)
   {
+    SELDON_PROFILE("SparseDirectSolver::Ordering");
+
     bool user_ordering = AffectOrdering();
     
     if (user_ordering)
@@ -453,6 +474,9 @@ namespace Seldon
       case SELDON_SOLVER:
 	solver = new SparseSeldonSolver<T>();
 	break;
+      case SELDON_SUPERNODAL:
+	solver = new SparseSupernodalSolver<T>();
+	break;
       default:
 	cout << "Unknown solver" << endl;
 	abort();
@@ -467,6 +491,15 @@ namespace Seldon
       solver->DoNotRefineSolution();
 
     solver->SetNumberOfThreadPerNode(nb_threads_per_node);
+    if (out_of_core)
+      {
+        solver->SetOutOfCoreDirectory(ooc_directory);
+        solver->SetOutOfCoreMemoryBudget(ooc_memory_budget);
+        solver->EnableOutOfCore();
+      }
+    else
+      solver->DisableOutOfCore();
+
     if (print_level > 0)
       solver->ShowMessages();
     else
@@ -484,6 +517,7 @@ namespace Seldon
   void SparseDirectSolver<T>::Factorize(Matrix<T, Prop, Storage, Allocator>& A,
 					bool keep_matrix)
   {
+    SELDON_PROFILE_SOLVE("SparseDirectSolver::Factorize");
     ComputeOrdering(A);
     n = A.GetM();
     if (type_solver == UMFPACK)
@@ -577,6 +611,13 @@ namespace Seldon
                         "Seldon was not compiled with the preconditioners.");
 #endif
       }
+    else if (type_solver == SELDON_SUPERNODAL)
+      {
+	SparseSupernodalSolver<T>& mat_super =
+	  static_cast<SparseSupernodalSolver<T>& >(*solver);
+
+	GetLU(A, mat_super, permut, keep_matrix);
+      }
     else
       {
 	SparseSeldonSolver<T>& mat_seldon =
@@ -587,6 +628,224 @@ namespace Seldon
   }
    
 
+  //! symbolic factorisation of matrix A
+  /*!
+    The ordering is computed and the structure of the factors is analyzed,
+    no numerical factorisation is performed. The matrix A is not modified,
+    FactorizeNumeric can then be called for any matrix with the same
+    pattern as A. For solvers without separate analysis (SuperLU, Pastix,
+    Wsmp, Ilut), only the ordering is computed.
+   */
+  template<class T>
+  template<class Prop, class Storage, class Allocator>
+  void SparseDirectSolver<T>::Analyze(Matrix<T, Prop, Storage, Allocator>& A)
+  {
+    SELDON_PROFILE_SOLVE("SparseDirectSolver::Analyze");
+    ComputeOrdering(A);
+    n = A.GetM();
+    if (type_solver == UMFPACK)
+      {
+#ifdef SELDON_WITH_UMFPACK
+	MatrixUmfPack<T>& mat_umf =
+	  dynamic_cast<MatrixUmfPack<T>& >(*solver);
+
+        mat_umf.AnalyzeMatrix(A);
+#else
+        throw Undefined("SparseDirectSolver::Analyze(MatrixSparse&)",
+                        "Seldon was not compiled with UmfPack support.");
+#endif
+      }
+    else if (type_solver == PARDISO)
+      {
+#ifdef SELDON_WITH_PARDISO
+	MatrixPardiso<T>& mat_pardiso =
+	  dynamic_cast<MatrixPardiso<T>& >(*solver);
+
+        mat_pardiso.AnalyzeMatrix(A);
+#else
+        throw Undefined("SparseDirectSolver::Analyze(MatrixSparse&)",
+                        "Seldon was not compiled with Pardiso support.");
+#endif
+      }
+    else if (type_solver == MUMPS)
+      {
+#ifdef SELDON_WITH_MUMPS
+	MatrixMumps<T>& mat_mumps =
+	  dynamic_cast<MatrixMumps<T>& >(*solver);
+
+        mat_mumps.PerformAnalysis(A);
+#else
+        throw Undefined("SparseDirectSolver::Analyze(MatrixSparse&)",
+                        "Seldon was not compiled with Mumps support.");
+#endif
+      }
+    else if (type_solver == SELDON_SOLVER)
+      {
+	SparseSeldonSolver<T>& mat_seldon =
+	  static_cast<SparseSeldonSolver<T>& >(*solver);
+
+        mat_seldon.AnalyzeMatrix(permut, A);
+      }
+    else if (type_solver == SELDON_SUPERNODAL)
+      {
+	SparseSupernodalSolver<T>& mat_super =
+	  static_cast<SparseSupernodalSolver<T>& >(*solver);
+
+        mat_super.AnalyzeMatrix(permut, A);
+      }
+  }
+
+
+  //! numerical factorisation of matrix A
+  /*!
+    Analyze or Factorize must have been called before with a matrix having
+    the same pattern as A. The ordering and the structure of the factors
+    are reused, only the numerical factorisation is performed. For the
+    default solver, the pivots found by the last call to Factorize are
+    kept. For solvers without separate analysis (SuperLU, Pastix, Wsmp,
+    Ilut), the complete factorisation is performed.
+   */
+  template<class T>
+  template<class Prop, class Storage, class Allocator>
+  void SparseDirectSolver<T>
+  ::FactorizeNumeric(Matrix<T, Prop, Storage, Allocator>& A, bool keep_matrix)
+  {
+    SELDON_PROFILE_SOLVE("SparseDirectSolver::FactorizeNumeric");
+
+    if ((n == 0) || (size_t(A.GetM()) != n))
+      throw WrongArgument("SparseDirectSolver::FactorizeNumeric"
+                          "(MatrixSparse&, bool)",
+                          "The matrix is of size " + to_str(A.GetM())
+                          + " while the analyzed matrix is of size "
+                          + to_str(n) + ". Analyze or Factorize should be"
+                          + " called first.");
+
+    if (type_solver == UMFPACK)
+      {
+#ifdef SELDON_WITH_UMFPACK
+	MatrixUmfPack<T>& mat_umf =
+	  dynamic_cast<MatrixUmfPack<T>& >(*solver);
+
+        mat_umf.RefactorizeMatrix(A, keep_matrix);
+#else
+        throw Undefined("SparseDirectSolver::FactorizeNumeric"
+                        "(MatrixSparse&, bool)",
+                        "Seldon was not compiled with UmfPack support.");
+#endif
+      }
+    else if (type_solver == PARDISO)
+      {
+#ifdef SELDON_WITH_PARDISO
+	MatrixPardiso<T>& mat_pardiso =
+	  dynamic_cast<MatrixPardiso<T>& >(*solver);
+
+        mat_pardiso.RefactorizeMatrix(A, keep_matrix);
+#else
+        throw Undefined("SparseDirectSolver::FactorizeNumeric"
+                        "(MatrixSparse&, bool)",
+                        "Seldon was not compiled with Pardiso support.");
+#endif
+      }
+    else if (type_solver == MUMPS)
+      {
+#ifdef SELDON_WITH_MUMPS
+	MatrixMumps<T>& mat_mumps =
+	  dynamic_cast<MatrixMumps<T>& >(*solver);
+
+        mat_mumps.RefactorizeMatrix(A, keep_matrix);
+#else
+        throw Undefined("SparseDirectSolver::FactorizeNumeric"
+                        "(MatrixSparse&, bool)",
+                        "Seldon was not compiled with Mumps support.");
+#endif
+      }
+    else if (type_solver == SELDON_SOLVER)
+      {
+	SparseSeldonSolver<T>& mat_seldon =
+	  static_cast<SparseSeldonSolver<T>& >(*solver);
+
+        mat_seldon.RefactorizeMatrix(A, keep_matrix);
+      }
+    else if (type_solver == SELDON_SUPERNODAL)
+      {
+	SparseSupernodalSolver<T>& mat_super =
+	  static_cast<SparseSupernodalSolver<T>& >(*solver);
+
+        mat_super.RefactorizeMatrix(A, keep_matrix);
+      }
+    else
+      Factorize(A, keep_matrix);
+  }
+
+
+  //! factorisation of matrix A, reusing the previous analysis if possible
+  /*!
+    If a factorisation (or an analysis) of a matrix of the same size is
+    present, only the numerical factorisation is performed (see
+    FactorizeNumeric), otherwise the matrix is completely factorized. The
+    matrix is assumed to have the same pattern as the previous one.
+   */
+  template<class T>
+  template<class Prop, class Storage, class Allocator>
+  void SparseDirectSolver<T>
+  ::Refactorize(Matrix<T, Prop, Storage, Allocator>& A, bool keep_matrix)
+  {
+    if ((n == 0) || (size_t(A.GetM()) != n))
+      Factorize(A, keep_matrix);
+    else
+      FactorizeNumeric(A, keep_matrix);
+  }
+
+
+  //! computation of the Schur complement A22 - A21 A11^-1 A12
+  /*!
+    The unknowns of A that are not in num are eliminated (partial
+    factorisation), the Schur complement is associated with the unknowns
+    num (row i of mat_schur corresponds to num(i)). This method is only
+    available for Mumps and for the supernodal solver of Seldon.
+    \param[inout] A matrix to factorize
+    \param[in] num unknowns of the Schur complement
+    \param[out] mat_schur Schur complement (dense or ArrayRowSparse)
+    \param[in] keep_matrix if true the given matrix A is kept
+   */
+  template<class T>
+  template<class Prop, class Storage, class Allocator,
+           class Storage1, class Allocator1>
+  void SparseDirectSolver<T>
+  ::GetSchurMatrix(Matrix<T, Prop, Storage, Allocator>& A, const IVect& num,
+                   Matrix<T, General, Storage1, Allocator1>& mat_schur,
+                   bool keep_matrix)
+  {
+    if (type_solver == MUMPS)
+      {
+#ifdef SELDON_WITH_MUMPS
+	MatrixMumps<T>& mat_mumps =
+	  dynamic_cast<MatrixMumps<T>& >(*solver);
+
+        n = A.GetM();
+        mat_mumps.GetSchurMatrix(A, num, mat_schur, keep_matrix);
+#else
+        throw Undefined("SparseDirectSolver::GetSchurMatrix",
+                        "Seldon was not compiled with Mumps support.");
+#endif
+      }
+    else if (type_solver == SELDON_SUPERNODAL)
+      {
+	SparseSupernodalSolver<T>& mat_super =
+	  static_cast<SparseSupernodalSolver<T>& >(*solver);
+
+        // the ordering is computed on the whole matrix
+        ComputeOrdering(A);
+        n = A.GetM();
+        mat_super.GetSchurMatrix(permut, A, num, mat_schur, keep_matrix);
+      }
+    else
+      throw Undefined("SparseDirectSolver::GetSchurMatrix",
+                      "The Schur complement is only available with Mumps"
+                      " and the supernodal solver of Seldon.");
+  }
+
+
   //! Returns error code of the direct solver
   template <class T>
   int SparseDirectSolver<T>::GetInfoFactorization(int& ierr) const
@@ -731,6 +990,7 @@ namespace Seldon
 		     + to_str(n) + ".");
 #endif
     
+    SELDON_PROFILE_SOLVE("SparseDirectSolver::Solve");
     solver->Solve(trans, x_solution.GetData(), 1);
   }
   
@@ -766,6 +1026,7 @@ namespace Seldon
 		     + to_str(n) + ".");
 #endif
     
+    SELDON_PROFILE_SOLVE("SparseDirectSolver::Solve");
     solver->Solve(trans, x_sol.GetData(), x_sol.GetN());
   }
 
@@ -792,6 +1053,8 @@ namespace Seldon
                        Vector<Tint>& Ptr, Vector<Tint>& Row, Vector<T>& Val,
                        const IVect& glob_num, bool sym, bool keep_matrix)
   {
+    SELDON_PROFILE_SOLVE("SparseDirectSolver::Factorize");
+
     bool user_ordering = AffectOrdering();
     if (user_ordering)
       {
@@ -838,6 +1101,7 @@ namespace Seldon
 		     + to_str(n) + ".");
 #endif
 
+    SELDON_PROFILE_SOLVE("SparseDirectSolver::Solve");
     solver->SolveDistributed(comm_facto, trans,
 			     x_solution.GetData(), 1, glob_number);
   }
@@ -874,6 +1138,7 @@ namespace Seldon
 		     + to_str(n) + ".");
 #endif
 
+    SELDON_PROFILE_SOLVE("SparseDirectSolver::Solve");
     solver->SolveDistributed(comm_facto, trans,
 			     x.GetData(), x.GetN(), glob_number);
   }
@@ -45,10 +45,15 @@ namespace Seldon
     int print_level;
     //! use of non-symmetric ilut ?
     bool enforce_unsym_ilut;
+    //! factors written on the disk (Mumps and supernodal solvers)
+    bool out_of_core;
+    int64_t ooc_memory_budget;
+    string ooc_directory;
         
   public :
     // available solvers
-    enum {SELDON_SOLVER, UMFPACK, SUPERLU, MUMPS, PASTIX, ILUT, PARDISO, WSMP};
+    enum {SELDON_SOLVER, UMFPACK, SUPERLU, MUMPS, PASTIX, ILUT, PARDISO, WSMP,
+          SELDON_SUPERNODAL};
     
     // error codes
     enum {FACTO_OK, STRUCTURALLY_SINGULAR_MATRIX,
@@ -58,6 +63,7 @@ namespace Seldon
           OVERFLOW_32BIT};
     
     SparseDirectSolver();
+    ~SparseDirectSolver();
     
     // Inline methods
     int GetM() const;
@@ -74,6 +80,11 @@ namespace Seldon
     void SetPivotThreshold(const double&);
     void SetNumberOfThreadPerNode(int m);
     int GetNumberOfThreadPerNode() const;
+
+    void EnableOutOfCore();
+    void DisableOutOfCore();
+    void SetOutOfCoreDirectory(const string& dir);
+    void SetOutOfCoreMemoryBudget(int64_t nb_bytes);
     
     void SelectDirectSolver(int);    
     void SetNonSymmetricIlut();
@@ -107,6 +118,24 @@ namespace Seldon
     template<class Prop, class Storage, class Allocator>
     void Factorize(Matrix<T, Prop, Storage, Allocator>& A,
 		   bool keep_matrix = false);
+
+    template<class Prop, class Storage, class Allocator>
+    void Analyze(Matrix<T, Prop, Storage, Allocator>& A);
+
+    template<class Prop, class Storage, class Allocator>
+    void FactorizeNumeric(Matrix<T, Prop, Storage, Allocator>& A,
+                          bool keep_matrix = false);
+
+    template<class Prop, class Storage, class Allocator>
+    void Refactorize(Matrix<T, Prop, Storage, Allocator>& A,
+                     bool keep_matrix = false);
+
+    template<class Prop, class Storage, class Allocator,
+             class Storage1, class Allocator1>
+    void GetSchurMatrix(Matrix<T, Prop, Storage, Allocator>& A,
+                        const IVect& num,
+                        Matrix<T, General, Storage1, Allocator1>& mat_schur,
+                        bool keep_matrix = false);
     
     int GetInfoFactorization(int& ierr) const;
     
@@ -139,6 +168,11 @@ namespace Seldon
 			  Matrix<T, General, ColMajor>& x_solution,
                           const IVect& glob_number);
 #endif
+
+  private :
+    // the pointer solver cannot be shared between two objects
+    SparseDirectSolver(const SparseDirectSolver<T>&);
+    SparseDirectSolver<T>& operator=(const SparseDirectSolver<T>&);
     
   };
 
@@ -113,6 +113,44 @@ namespace Seldon
   {
     return nb_threads_per_node;
   }
+
+
+
+  //! factors will be written on the disk (Mumps and supernodal solvers)
+  template<class T>
+  inline void SparseDirectSolver<T>::EnableOutOfCore()
+  {
+    out_of_core = true;
+    solver->EnableOutOfCore();
+  }
+
+
+  //! factors will be kept in memory
+  template<class T>
+  inline void SparseDirectSolver<T>::DisableOutOfCore()
+  {
+    out_of_core = false;
+    solver->DisableOutOfCore();
+  }
+
+
+  //! sets the directory where factors are written (supernodal solver)
+  template<class T>
+  inline void SparseDirectSolver<T>::SetOutOfCoreDirectory(const string& dir)
+  {
+    ooc_directory = dir;
+    solver->SetOutOfCoreDirectory(dir);
+  }
+
+
+  //! sets the number of bytes of factors kept in memory (supernodal solver)
+  template<class T>
+  inline void SparseDirectSolver<T>
+  ::SetOutOfCoreMemoryBudget(int64_t nb_bytes)
+  {
+    ooc_memory_budget = nb_bytes;
+    solver->SetOutOfCoreMemoryBudget(nb_bytes);
+  }
   
   
   //! modifies the direct solver to use
@@ -326,6 +326,105 @@ namespace Seldon
   }
 
 
+  //! Symbolic factorization of a matrix
+  /*!
+    The numerical factorization is performed by RefactorizeMatrix,
+    the matrix mat is not modified.
+  */
+  template<class T0, class Prop, class Storage, class Allocator>
+  void MatrixUmfPack<double>::
+  AnalyzeMatrix(Matrix<T0, Prop, Storage, Allocator> & mat)
+  {
+    // we clear previous factorization
+    Clear();
+
+    Vector<umfpack_int_t> Ptr, IndRow;
+    Vector<double> Val;
+
+    // conversion to unsymmetric matrix in Column Sparse Column Format
+    General prop;
+    ConvertToCSC(mat, prop, Ptr, IndRow, Val, false);
+
+    transpose = false;
+    this->n = Ptr.GetM()-1;
+    ptr_ = Ptr.GetData();
+    ind_ = IndRow.GetData();
+    data_ = Val.GetData();
+    Ptr.Nullify(); IndRow.Nullify(); Val.Nullify();
+
+#ifdef UMFPACK_INTSIZE64
+    umfpack_dl_symbolic(this->n, this->n, ptr_, ind_, data_, &this->Symbolic,
+			this->Control.GetData(), this->Info.GetData());
+#else
+    umfpack_di_symbolic(this->n, this->n, ptr_, ind_, data_, &this->Symbolic,
+			this->Control.GetData(), this->Info.GetData());
+#endif
+  }
+
+
+  //! Numerical factorization of a matrix
+  /*!
+    The symbolic factorization of the last call to FactorizeMatrix or
+    AnalyzeMatrix is reused, mat must have the same pattern.
+  */
+  template<class T0, class Prop, class Storage, class Allocator>
+  void MatrixUmfPack<double>::
+  RefactorizeMatrix(Matrix<T0, Prop, Storage, Allocator> & mat,
+                    bool keep_matrix)
+  {
+    Vector<umfpack_int_t> Ptr, Ind;
+    Vector<double> Val;
+
+    // same format as the analyzed matrix
+    General prop;
+    if (transpose)
+      ConvertToCSR(mat, prop, Ptr, Ind, Val);
+    else
+      ConvertToCSC(mat, prop, Ptr, Ind, Val, false);
+
+    if (!keep_matrix)
+      mat.Clear();
+
+    if ((this->Symbolic == NULL) || (Ptr.GetM() != this->n+1)
+        || (Val.GetM() != ptr_[this->n]))
+      throw WrongArgument("MatrixUmfPack::RefactorizeMatrix(Matrix&, bool)",
+                          "The pattern of the matrix differs from the "
+                          "analyzed pattern.");
+
+    // we copy values
+    for (int i = 0; i < Val.GetM(); i++)
+      data_[i] = Val(i);
+
+    // previous numerical factorization is released
+#ifdef UMFPACK_INTSIZE64
+    if (this->Numeric != NULL)
+      umfpack_dl_free_numeric(&this->Numeric);
+
+    status_facto =
+      umfpack_dl_numeric(ptr_, ind_, data_,
+			 this->Symbolic, &this->Numeric,
+			 this->Control.GetData(), this->Info.GetData());
+#else
+    if (this->Numeric != NULL)
+      umfpack_di_free_numeric(&this->Numeric);
+
+    status_facto =
+      umfpack_di_numeric(ptr_, ind_, data_,
+			 this->Symbolic, &this->Numeric,
+			 this->Control.GetData(), this->Info.GetData());
+#endif
+
+    if (print_level > 1)
+      {
+#ifdef UMFPACK_INTSIZE64
+	umfpack_dl_report_status(this->Control.GetData(), status_facto);
+#else
+	umfpack_di_report_status(this->Control.GetData(), status_facto);
+#endif
+      }
+  }
+
+
   //! Symbolic factorization
   template<class Prop, class Allocator>
   void MatrixUmfPack<double>
@@ -562,6 +661,117 @@ namespace Seldon
   }
 
 
+  //! Symbolic factorization of a complex matrix
+  /*!
+    The numerical factorization is performed by RefactorizeMatrix,
+    the matrix mat is not modified.
+  */
+  template<class T0, class Prop, class Storage, class Allocator>
+  void MatrixUmfPack<complex<double> >::
+  AnalyzeMatrix(Matrix<T0, Prop, Storage, Allocator> & mat)
+  {
+    Clear();
+
+    Vector<umfpack_int_t> Ptr, IndRow;
+    Vector<complex<double> > Val;
+
+    // conversion to CSC format
+    General prop;
+    ConvertToCSC(mat, prop, Ptr, IndRow, Val, false);
+
+    transpose = false;
+    this->n = Ptr.GetM()-1;
+    int nnz = IndRow.GetM();
+    Vector<double> ValuesReal(nnz), ValuesImag(nnz);
+    for (int i = 0; i < nnz; i++)
+      {
+	ValuesReal(i) = real(Val(i));
+	ValuesImag(i) = imag(Val(i));
+      }
+
+    Val.Clear();
+    data_real_ = ValuesReal.GetData();
+    data_imag_ = ValuesImag.GetData();
+    ptr_ = Ptr.GetData();
+    ind_ = IndRow.GetData();
+    ValuesReal.Nullify(); ValuesImag.Nullify();
+    Ptr.Nullify(); IndRow.Nullify();
+
+#ifdef UMFPACK_INTSIZE64
+    umfpack_zl_symbolic(this->n, this->n, ptr_, ind_,
+			data_real_, data_imag_,
+			&this->Symbolic, this->Control.GetData(),
+			this->Info.GetData());
+#else
+    umfpack_zi_symbolic(this->n, this->n, ptr_, ind_,
+			data_real_, data_imag_,
+			&this->Symbolic, this->Control.GetData(),
+			this->Info.GetData());
+#endif
+  }
+
+
+  //! Numerical factorization of a complex matrix
+  /*!
+    The symbolic factorization of the last call to FactorizeMatrix or
+    AnalyzeMatrix is reused, mat must have the same pattern.
+  */
+  template<class T0, class Prop, class Storage, class Allocator>
+  void MatrixUmfPack<complex<double> >::
+  RefactorizeMatrix(Matrix<T0, Prop, Storage, Allocator> & mat,
+                    bool keep_matrix)
+  {
+    Vector<umfpack_int_t> Ptr, IndRow;
+    Vector<complex<double> > Val;
+
+    General prop;
+    ConvertToCSC(mat, prop, Ptr, IndRow, Val, false);
+    if (!keep_matrix)
+      mat.Clear();
+
+    if ((this->Symbolic == NULL) || (Ptr.GetM() != this->n+1)
+        || (Val.GetM() != ptr_[this->n]))
+      throw WrongArgument("MatrixUmfPack::RefactorizeMatrix(Matrix&, bool)",
+                          "The pattern of the matrix differs from the "
+                          "analyzed pattern.");
+
+    // we copy values
+    for (int i = 0; i < Val.GetM(); i++)
+      {
+	data_real_[i] = real(Val(i));
+	data_imag_[i] = imag(Val(i));
+      }
+
+    // previous numerical factorization is released
+#ifdef UMFPACK_INTSIZE64
+    if (this->Numeric != NULL)
+      umfpack_zl_free_numeric(&this->Numeric);
+
+    status_facto
+      = umfpack_zl_numeric(ptr_, ind_, data_real_, data_imag_,
+			   this->Symbolic, &this->Numeric,
+			   this->Control.GetData(), this->Info.GetData());
+#else
+    if (this->Numeric != NULL)
+      umfpack_zi_free_numeric(&this->Numeric);
+
+    status_facto
+      = umfpack_zi_numeric(ptr_, ind_, data_real_, data_imag_,
+			   this->Symbolic, &this->Numeric,
+			   this->Control.GetData(), this->Info.GetData());
+#endif
+
+    if (print_level > 1)
+      {
+#ifdef UMFPACK_INTSIZE64
+	umfpack_zl_report_status(this->Control.GetData(), status_facto);
+#else
+	umfpack_zi_report_status(this->Control.GetData(), status_facto);
+#endif
+      }
+  }
+
+
   //! solves linear system in complex double precision using UmfPack
   template<class Allocator2>
   void MatrixUmfPack<complex<double> >::
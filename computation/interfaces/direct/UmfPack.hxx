@@ -92,7 +92,15 @@ namespace Seldon
 
     void FactorizeCSC(Vector<umfpack_int_t>& Ptr, Vector<umfpack_int_t>& IndRow,
 		      Vector<double>& Val, bool sym);
+
+    template<class T0, class Prop, class Storage, class Allocator>
+    void AnalyzeMatrix(Matrix<T0, Prop, Storage, Allocator> & mat);
+
+    template<class T0, class Prop, class Storage, class Allocator>
+    void RefactorizeMatrix(Matrix<T0, Prop, Storage, Allocator> & mat,
+                           bool keep_matrix = false);
     
+
     template<class Prop, class Allocator>
     void PerformAnalysis(Matrix<double, Prop, RowSparse, Allocator> & mat);
 
@@ -142,6 +150,13 @@ namespace Seldon
     void FactorizeCSC(Vector<umfpack_int_t>& Ptr, Vector<umfpack_int_t>& IndRow,
 		      Vector<complex<double> >& Val, bool sym);
 
+    template<class T0, class Prop, class Storage, class Allocator>
+    void AnalyzeMatrix(Matrix<T0, Prop, Storage, Allocator> & mat);
+
+    template<class T0, class Prop, class Storage, class Allocator>
+    void RefactorizeMatrix(Matrix<T0, Prop, Storage, Allocator> & mat,
+                           bool keep_matrix = false);
+
     template<class Allocator2>
     void Solve(Vector<complex<double>, VectFull, Allocator2>& x);
 
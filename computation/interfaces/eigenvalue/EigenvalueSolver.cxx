@@ -49,6 +49,10 @@ namespace Seldon
     ortho_manager = ORTHO_DGKS;
     nb_blocks = 2;
     restart_number = 20;
+    
+    emin_interval = 0.0;
+    emax_interval = 0.0;
+    nb_quadrature_points = 8;
   }
   
   
@@ -83,6 +87,22 @@ namespace Seldon
   }
   
   
+  //! copies parameters and matrices of another eigenvalue problem
+  /*!
+    Factorisations are not copied, the current object can be used
+    to factorize a M + b K with other coefficients a and b
+    (e.g. one object per shift in the contour solver).
+  */
+  template<class T, class MatStiff, class MatMass>
+  void EigenProblem_Base<T, MatStiff, MatMass>::
+  CopyParameters(const EigenProblem_Base<T, MatStiff, MatMass>& var)
+  {
+    EigenProblem_Base<T, MatStiff, MatMass>::operator=(var);
+    nb_prod = 0;
+    complex_system = false;
+  }
+  
+  
   //! initialization of a standard eigenvalue problem
   /*!
     Stiffness matrix K is given in argument.
@@ -378,6 +398,24 @@ namespace Seldon
     emin_interval = l0;
     emax_interval = l1;
   }
+  
+  
+  //! returns the number of quadrature points on the contour
+  template<class T, class MatStiff, class MatMass>
+  int EigenProblem_Base<T, MatStiff, MatMass>
+  ::GetNbQuadraturePoints() const
+  {
+    return nb_quadrature_points;
+  }
+  
+  
+  //! sets the number of quadrature points on the contour
+  template<class T, class MatStiff, class MatMass>
+  void EigenProblem_Base<T, MatStiff, MatMass>
+  ::SetNbQuadraturePoints(int n)
+  {
+    nb_quadrature_points = n;
+  }
     
 
   //! indicates the use of Cholesky factorisation in order to 
@@ -1336,7 +1374,7 @@ namespace Seldon
   ComputeAndFactorizeStiffnessMatrix(const complex<T>& a, const complex<T>& b,
                                      bool real_part)
   {
-    ComputeAndFactorizeComplexMatrix(a, b);
+    ComputeAndFactorizeComplexMatrix(a, b, real_part);
   }
   
   
@@ -1352,7 +1390,9 @@ namespace Seldon
  
     this->complex_system = true;
     // inverse of (a M + b K), then we take real_part or imaginary part
-    Matrix<complex<double>, Prop, Storage> InvMat(this->n_, this->n_);
+    // the complex inverse is kept for solutions with complex vectors
+    Matrix<complex<double>, Prop, Storage>& InvMat = mat_lu_cplx;
+    InvMat.Reallocate(this->n_, this->n_);
     for (int i = 0; i < this->n_; i++)
       for (int j = 0; j < this->n_; j++)
         InvMat(i, j) = (*this->Kh)(i, j);
@@ -1410,7 +1450,7 @@ namespace Seldon
   ComputeSolution(const Vector<T0>& X, Vector<T0>& Y)
   {
     if (this->complex_system)
-      Mlt(mat_lu, X, Y);
+      ComputeComplexSolution(SeldonNoTrans, X, Y);
     else
       {
         Copy(X, Y);
@@ -1427,7 +1467,7 @@ namespace Seldon
   ComputeSolution(const TransA& transA, const Vector<T0>& X, Vector<T0>& Y)
   {
     if (this->complex_system)
-      Mlt(transA, mat_lu, X, Y);
+      ComputeComplexSolution(transA, X, Y);
     else
       {
         Copy(X, Y);
@@ -1436,6 +1476,29 @@ namespace Seldon
   }
   
   
+  //! computes Y = Real( (a M + b K)^-1 ) X or Imag( (a M + b K)^-1 ) X
+  template<class T, class Prop, class Storage,
+           class Tmass, class PropM, class StorageM> template<class TransA>
+  void DenseEigenProblem<T, Prop, Storage, Tmass, PropM, StorageM>::
+  ComputeComplexSolution(const TransA& transA,
+                         const Vector<double>& X, Vector<double>& Y)
+  {
+    Mlt(transA, mat_lu, X, Y);
+  }
+  
+  
+  //! computes Y = (a M + b K)^-1 X when a and b are complex
+  template<class T, class Prop, class Storage,
+           class Tmass, class PropM, class StorageM> template<class TransA>
+  void DenseEigenProblem<T, Prop, Storage, Tmass, PropM, StorageM>::
+  ComputeComplexSolution(const TransA& transA,
+                         const Vector<complex<double> >& X,
+                         Vector<complex<double> >& Y)
+  {
+    Mlt(transA, mat_lu_cplx, X, Y);
+  }
+  
+  
   //! clearing variables used for eigenvalue resolution
   template<class T, class Prop, class Storage,
            class Tmass, class PropM, class StorageM>
@@ -1446,6 +1509,7 @@ namespace Seldon
       Matrix<Tmass, PropM, StorageM> >::Clear();
     
     mat_lu.Clear();
+    mat_lu_cplx.Clear();
     mat_chol.Clear();
   }
   
@@ -1850,8 +1914,9 @@ namespace Seldon
       }
     else
       {
+        // complex vectors are accepted for a real factorization
         Copy(X, Y);
-        mat_lu.Solve(Y);
+        SolveLU(SeldonNoTrans, mat_lu, Y);
       }
   }
   
@@ -1869,7 +1934,7 @@ namespace Seldon
     else
       {
         Copy(X, Y);
-        mat_lu.Solve(transA, Y);
+        SolveLU(transA, mat_lu, Y);
       }
   }
   
@@ -1947,6 +2012,10 @@ namespace Seldon
     return ARPACK;
 #endif
     
+#ifdef SELDON_WITH_LAPACK
+    return KRYLOV_SCHUR;
+#endif
+    
     return -1;
   }
   
@@ -2007,6 +2076,54 @@ namespace Seldon
 #else
         cout << "Recompile with MKL" << endl;
         abort();
+#endif
+      }
+    else if (type_solver == TypeEigenvalueSolver::LOBPCG)
+      {
+#ifdef SELDON_WITH_LAPACK
+        T zero; SetComplexZero(zero);
+        Matrix<T, General, ColMajor> eigen_old;
+        FindEigenvaluesLobpcg(var_eig, lambda, lambda_imag, eigen_old);
+        
+        // eigenvalues are sorted by ascending order
+        SortEigenvalues(lambda, lambda_imag, eigen_old,
+                        eigen_vec, var_eig.LARGE_EIGENVALUES,
+                        var_eig.GetTypeSorting(), zero, zero);
+#else
+        cout << "Recompile with Lapack" << endl;
+        abort();
+#endif
+      }
+    else if (type_solver == TypeEigenvalueSolver::KRYLOV_SCHUR)
+      {
+#ifdef SELDON_WITH_LAPACK
+        T zero; SetComplexZero(zero);
+        Matrix<T, General, ColMajor> eigen_old;
+        FindEigenvaluesKrylovSchur(var_eig, lambda, lambda_imag, eigen_old);
+        
+        // eigenvalues are sorted by ascending order
+        SortEigenvalues(lambda, lambda_imag, eigen_old,
+                        eigen_vec, var_eig.LARGE_EIGENVALUES,
+                        var_eig.GetTypeSorting(), zero, zero);
+#else
+        cout << "Recompile with Lapack" << endl;
+        abort();
+#endif
+      }
+    else if (type_solver == TypeEigenvalueSolver::CONTOUR)
+      {
+#ifdef SELDON_WITH_LAPACK
+        T zero; SetComplexZero(zero);
+        Matrix<T, General, ColMajor> eigen_old;
+        FindEigenvaluesContour(var_eig, lambda, lambda_imag, eigen_old);
+        
+        // eigenvalues are sorted by ascending order
+        SortEigenvalues(lambda, lambda_imag, eigen_old,
+                        eigen_vec, var_eig.LARGE_EIGENVALUES,
+                        var_eig.GetTypeSorting(), zero, zero);
+#else
+        cout << "Recompile with Lapack" << endl;
+        abort();
 #endif
       }
     else
@@ -161,12 +161,16 @@ namespace Seldon
     //! interval where eigenvalues are searched
     double emin_interval, emax_interval;
     
+    //! number of quadrature points on the contour (native contour solver)
+    int nb_quadrature_points;
+    
   public :
 
     EigenProblem_Base();
     
     // initialization
     void Init(int n);
+    void CopyParameters(const EigenProblem_Base<T, MatStiff, MatMass>&);
     
     void InitMatrix(MatStiff&);
     void InitMatrix(MatStiff&, MatMass& );
@@ -212,6 +216,9 @@ namespace Seldon
     double GetUpperBoundInterval() const;
 
     void SetIntervalSpectrum(double, double);
+    
+    int GetNbQuadraturePoints() const;
+    void SetNbQuadraturePoints(int);
             
     void SetCholeskyFactoForMass(bool chol = true);
     bool UseCholeskyFactoForMass() const;
@@ -338,6 +345,9 @@ namespace Seldon
     //! pivot used by the LU factorisation
     Vector<int> pivot;
 
+    //! inverse of a M + b K when a and b are complex (real matrices)
+    Matrix<complex<double>, Prop, Storage> mat_lu_cplx;
+
     //! Cholesky factorisation of mass matrix
     Matrix<Tmass, PropM, StorageM> mat_chol;
     
@@ -385,6 +395,15 @@ namespace Seldon
     void ComputeSolution(const TransA& transA,
                          const Vector<T0>& X, Vector<T0>& Y);
     
+    template<class TransA>
+    void ComputeComplexSolution(const TransA&,
+                                const Vector<double>& X, Vector<double>& Y);
+    
+    template<class TransA>
+    void ComputeComplexSolution(const TransA&,
+                                const Vector<complex<double> >& X,
+                                Vector<complex<double> >& Y);
+    
     void Clear();
     
   };
@@ -509,10 +528,14 @@ namespace Seldon
   
   
   //! list of availables eigenvalue solvers
+  /*!
+    LOBPCG, KRYLOV_SCHUR and CONTOUR are native solvers (only Lapack is needed)
+    CONTOUR computes eigenvalues in the interval given by SetIntervalSpectrum
+  */
   class TypeEigenvalueSolver
   {
   public :
-    enum {DEFAULT, ARPACK, ANASAZI, FEAST};
+    enum {DEFAULT, ARPACK, ANASAZI, FEAST, LOBPCG, KRYLOV_SCHUR, CONTOUR};
     
     static int default_solver;
     
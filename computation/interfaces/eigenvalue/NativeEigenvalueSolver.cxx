@@ -0,0 +1,1886 @@
+#ifndef SELDON_FILE_NATIVE_EIGENVALUE_SOLVER_CXX
+#define SELDON_FILE_NATIVE_EIGENVALUE_SOLVER_CXX
+
+namespace Seldon
+{
+
+  /***********************
+   * NativeEigenOperator *
+   ***********************/
+
+
+  //! constructor
+  template<class EigenPb, class T>
+  NativeEigenOperator<EigenPb, T>::NativeEigenOperator(EigenPb& var_)
+    : var(var_)
+  {
+    type_transform = REGULAR;
+    standard_problem = false;
+    only_operator = true;
+    transform_eigenvalues = false;
+    SetComplexZero(shift);
+  }
+
+
+  //! computes and factorizes the matrices needed by the computational mode
+  /*!
+    \param[in] pencil if true, A and B will be used (LOBPCG),
+    otherwise only the operator B^-1 A is needed (Krylov-Schur)
+    \param[in] interval if true, eigenvalues are searched in an interval
+    (contour solver) and the wanted part of the spectrum is not checked
+  */
+  template<class EigenPb, class T>
+  void NativeEigenOperator<EigenPb, T>::Init(bool pencil, bool interval)
+  {
+    int n = var.GetM();
+    T zero, one;
+    SetComplexZero(zero);
+    SetComplexOne(one);
+
+#ifdef SELDON_WITH_MPI
+    if (var.GetCommunicator().Get_size() > 1)
+      {
+        cout << "Native eigenvalue solvers are sequential" << endl;
+        abort();
+      }
+#endif
+
+    // checking if computation mode is compatible with the spectrum
+    // the user wants to find
+    int mode = var.GetComputationalMode();
+    // the imaginary part of the shift is only used for real problems
+    bool complex_shift = !IsComplexNumber(zero)
+      && (var.GetImagShiftValue() != zero);
+    if (mode == var.REGULAR_MODE)
+      {
+        if (!interval && (var.GetTypeSpectrum() == var.CENTERED_EIGENVALUES))
+          {
+            cout << "You can not use regular mode to find "
+                 << "eigenvalues closest to a given value" << endl;
+            cout << "Try to use shifted mode for example " << endl;
+            abort();
+          }
+      }
+    else
+      {
+        if ((var.GetTypeSpectrum() != var.CENTERED_EIGENVALUES) &&
+            (mode != var.INVERT_MODE))
+          {
+            cout << "To find large or small eigenvalues, use a regular mode" << endl;
+            abort();
+          }
+
+        if (mode == var.IMAG_SHIFTED_MODE)
+          {
+            cout << "Imaginary part of the shifted operator is not available "
+                 << "with native eigenvalue solvers" << endl;
+            abort();
+          }
+
+        if (complex_shift && ((mode != var.SHIFTED_MODE) || var.DiagonalMass()
+                              || var.UseCholeskyFactoForMass()))
+          {
+            cout << "Complex shifts for real problems are only available "
+                 << "with SHIFTED_MODE" << endl;
+            abort();
+          }
+
+        if ((mode == var.BUCKLING_MODE) || (mode == var.CAYLEY_MODE))
+          {
+            if (!var.IsSymmetricProblem() || IsComplexNumber(zero))
+              {
+                cout << "Cayley or Bucking mode are reserved for real symmetric "
+                     << "generalized eigenproblems " << endl;
+                abort();
+              }
+          }
+      }
+
+    only_operator = !pencil;
+    shift = var.GetShiftValue();
+    transform_eigenvalues = false;
+    Xh.Reallocate(n); Yh.Reallocate(n); Zh.Reallocate(n);
+    Xh.Fill(zero); Yh.Fill(zero); Zh.Fill(zero);
+
+    if (var.DiagonalMass() || var.UseCholeskyFactoForMass())
+      {
+        // standard problem with M^-1/2 K M^-1/2 or L^-1 K L^-T
+        // eigenvalues are modified in ApplyScalingEigenvec
+        standard_problem = true;
+        if (var.DiagonalMass())
+          {
+            var.ComputeDiagonalMass();
+            var.FactorizeDiagonalMass();
+          }
+        else
+          {
+            var.ComputeMassForCholesky();
+            var.FactorizeCholeskyMass();
+          }
+
+        if (mode == var.REGULAR_MODE)
+          {
+            type_transform = REGULAR;
+            var.ComputeStiffnessMatrix();
+          }
+        else
+          {
+            type_transform = SHIFT_INVERT;
+            var.ComputeAndFactorizeStiffnessMatrix(-shift, one);
+          }
+      }
+    else
+      {
+        standard_problem = false;
+        if ((mode == var.REGULAR_MODE) ||
+            ((mode == var.INVERT_MODE) &&
+             (var.GetTypeSpectrum() != var.CENTERED_EIGENVALUES)))
+          {
+            type_transform = REGULAR;
+            if (pencil)
+              var.ComputeMassMatrix();
+            else
+              var.ComputeAndFactorizeStiffnessMatrix(one, zero);
+
+            var.ComputeStiffnessMatrix();
+          }
+        else if (mode == var.BUCKLING_MODE)
+          {
+            type_transform = BUCKLING;
+            transform_eigenvalues = true;
+            var.ComputeAndFactorizeStiffnessMatrix(-shift, one);
+            var.ComputeStiffnessMatrix();
+          }
+        else if (mode == var.CAYLEY_MODE)
+          {
+            type_transform = CAYLEY;
+            transform_eigenvalues = true;
+            var.ComputeAndFactorizeStiffnessMatrix(-shift, one);
+            var.ComputeMassMatrix();
+            var.ComputeStiffnessMatrix(shift, one);
+          }
+        else if (complex_shift)
+          {
+            // complex shift for a real problem, the operator is
+            // Real((K - sigma M)^-1 M) as in mode 3 of Arpack
+            // eigenvalues are recovered in ApplyScalingEigenvec
+            type_transform = SHIFT_INVERT;
+            FactorizeComplexShiftNative(var, shift, var.GetImagShiftValue());
+            var.ComputeMassMatrix();
+            var.ComputeStiffnessMatrix();
+          }
+        else
+          {
+            // for invert mode, eigenvalues are modified in ApplyScalingEigenvec
+            type_transform = SHIFT_INVERT;
+            transform_eigenvalues = (mode != var.INVERT_MODE);
+            var.ComputeAndFactorizeStiffnessMatrix(-shift, one);
+            var.ComputeMassMatrix();
+          }
+      }
+  }
+
+
+  //! returns the spectral transformation (REGULAR, SHIFT_INVERT, etc)
+  template<class EigenPb, class T>
+  int NativeEigenOperator<EigenPb, T>::GetTypeTransform() const
+  {
+    return type_transform;
+  }
+
+
+  //! returns true if B is the identity
+  template<class EigenPb, class T>
+  bool NativeEigenOperator<EigenPb, T>::IsStandardProblem() const
+  {
+    return standard_problem;
+  }
+
+
+  //! returns true if B^-1 A X is obtained when A X is computed
+  /*!
+    It is the case for shifted modes of generalized problems, since
+    A = B (K - sigma M)^-1 B', the vector B^-1 A X is an intermediate result
+  */
+  template<class EigenPb, class T>
+  bool NativeEigenOperator<EigenPb, T>::IsOperatorGivenWithA() const
+  {
+    return (!standard_problem) && (type_transform != REGULAR);
+  }
+
+
+  //! computes Y = B^-1 A X
+  template<class EigenPb, class T>
+  void NativeEigenOperator<EigenPb, T>::
+  MltOperator(const Vector<T>& X, Vector<T>& Y)
+  {
+    if (standard_problem)
+      {
+        MltA(X, Y);
+        return;
+      }
+
+    T one; SetComplexOne(one);
+    switch (type_transform)
+      {
+      case REGULAR :
+        var.MltStiffness(X, Zh);
+        break;
+      case SHIFT_INVERT :
+        var.MltMass(X, Zh);
+        break;
+      case BUCKLING :
+        var.MltStiffness(X, Zh);
+        break;
+      case CAYLEY :
+        var.MltStiffness(shift, one, X, Zh);
+        break;
+      }
+
+    var.ComputeSolution(Zh, Y);
+    var.IncrementProdMatVect();
+  }
+
+
+  //! computes Y = A X
+  template<class EigenPb, class T>
+  void NativeEigenOperator<EigenPb, T>::MltA(const Vector<T>& X, Vector<T>& Y)
+  {
+    if (standard_problem)
+      {
+        Copy(X, Xh);
+        if (type_transform == REGULAR)
+          {
+            // M^-1/2 K M^-1/2 X  or L^-1 K L^-T X
+            if (var.DiagonalMass())
+              var.MltInvSqrtDiagonalMass(Xh);
+            else
+              var.SolveCholeskyMass(SeldonTrans, Xh);
+
+            var.MltStiffness(Xh, Y);
+
+            if (var.DiagonalMass())
+              var.MltInvSqrtDiagonalMass(Y);
+            else
+              var.SolveCholeskyMass(SeldonNoTrans, Y);
+          }
+        else
+          {
+            // M^1/2 (K - sigma M)^-1 M^1/2 X  or L^T (K - sigma M)^-1 L X
+            if (var.DiagonalMass())
+              var.MltSqrtDiagonalMass(Xh);
+            else
+              var.MltCholeskyMass(SeldonNoTrans, Xh);
+
+            var.ComputeSolution(Xh, Y);
+
+            if (var.DiagonalMass())
+              var.MltSqrtDiagonalMass(Y);
+            else
+              var.MltCholeskyMass(SeldonTrans, Y);
+          }
+
+        var.IncrementProdMatVect();
+        return;
+      }
+
+    if (only_operator)
+      {
+        cout << "The pencil (A, B) has not been computed" << endl;
+        abort();
+      }
+
+    T one; SetComplexOne(one);
+    switch (type_transform)
+      {
+      case REGULAR :
+        var.MltStiffness(X, Y);
+        break;
+      case SHIFT_INVERT :
+        var.MltMass(X, Zh);
+        var.ComputeSolution(Zh, Yh);
+        var.MltMass(Yh, Y);
+        break;
+      case BUCKLING :
+        var.MltStiffness(X, Zh);
+        var.ComputeSolution(Zh, Yh);
+        var.MltStiffness(Yh, Y);
+        break;
+      case CAYLEY :
+        var.MltStiffness(shift, one, X, Zh);
+        var.ComputeSolution(Zh, Yh);
+        var.MltMass(Yh, Y);
+        break;
+      }
+
+    var.IncrementProdMatVect();
+  }
+
+
+  //! computes Y = B X
+  template<class EigenPb, class T>
+  void NativeEigenOperator<EigenPb, T>::MltB(const Vector<T>& X, Vector<T>& Y)
+  {
+    if (standard_problem)
+      Copy(X, Y);
+    else if (type_transform == BUCKLING)
+      var.MltStiffness(X, Y);
+    else
+      var.MltMass(X, Y);
+  }
+
+
+  //! computes Y = A X for a block of vectors
+  template<class EigenPb, class T>
+  void NativeEigenOperator<EigenPb, T>::
+  MltA(const Matrix<T, General, ColMajor>& X, Matrix<T, General, ColMajor>& Y)
+  {
+    int n = X.GetM();
+    Vector<T> x(n), y(n);
+    Y.Reallocate(n, X.GetN());
+    for (int j = 0; j < X.GetN(); j++)
+      {
+        GetCol(X, j, x);
+        MltA(x, y);
+        SetCol(y, j, Y);
+      }
+  }
+
+
+  //! computes Y = A X and Z = B^-1 A X for a block of vectors
+  /*!
+    This function can be called only if IsOperatorGivenWithA() is true
+  */
+  template<class EigenPb, class T>
+  void NativeEigenOperator<EigenPb, T>::
+  MltA(const Matrix<T, General, ColMajor>& X, Matrix<T, General, ColMajor>& Y,
+       Matrix<T, General, ColMajor>& Z)
+  {
+    int n = X.GetM();
+    Vector<T> x(n), y(n);
+    Y.Reallocate(n, X.GetN());
+    Z.Reallocate(n, X.GetN());
+    for (int j = 0; j < X.GetN(); j++)
+      {
+        GetCol(X, j, x);
+        MltA(x, y);
+        SetCol(y, j, Y);
+        // Yh contains (K - sigma M)^-1 B' x
+        SetCol(Yh, j, Z);
+      }
+  }
+
+
+  //! computes Y = B X for a block of vectors
+  template<class EigenPb, class T>
+  void NativeEigenOperator<EigenPb, T>::
+  MltB(const Matrix<T, General, ColMajor>& X, Matrix<T, General, ColMajor>& Y)
+  {
+    if (standard_problem)
+      {
+        Y = X;
+        return;
+      }
+
+    int n = X.GetM();
+    Vector<T> x(n), y(n);
+    Y.Reallocate(n, X.GetN());
+    for (int j = 0; j < X.GetN(); j++)
+      {
+        GetCol(X, j, x);
+        MltB(x, y);
+        SetCol(y, j, Y);
+      }
+  }
+
+
+  //! returns a score for the eigenvalue mu of B^-1 A
+  /*!
+    Wanted eigenvalues have the highest scores. For shifted modes, the
+    eigenvalues closest to the shift are the largest eigenvalues of B^-1 A.
+  */
+  template<class EigenPb, class T>
+  typename ClassComplexType<T>::Treal
+  NativeEigenOperator<EigenPb, T>::GetScore(const Tcplx& mu) const
+  {
+    if (type_transform != REGULAR)
+      return abs(mu);
+
+    Treal key = abs(mu);
+    if (var.GetTypeSorting() == var.SORTED_REAL)
+      key = real(mu);
+    else if (var.GetTypeSorting() == var.SORTED_IMAG)
+      key = imag(mu);
+
+    if (var.GetTypeSpectrum() == var.SMALL_EIGENVALUES)
+      return -key;
+
+    return key;
+  }
+
+
+  //! retrieves eigenvalues of the original problem from eigenvalues of B^-1 A
+  template<class EigenPb, class T>
+  void NativeEigenOperator<EigenPb, T>::
+  TransformEigenvalues(Vector<T>& lambda_r, Vector<T>& lambda_i) const
+  {
+    if (!transform_eigenvalues)
+      return;
+
+    for (int i = 0; i < lambda_r.GetM(); i++)
+      TransformEigenvalueNative(type_transform, shift, lambda_r(i), lambda_i(i));
+  }
+
+
+  /*******************
+   * Small functions *
+   *******************/
+
+
+  //! factorizes K - sigma M for a complex shift sigma = sr + i si
+  /*!
+    The real part of (K - sigma M)^-1 is then given by ComputeSolution
+  */
+  template<class EigenPb, class T>
+  void FactorizeComplexShiftNative(EigenPb& var, const T& sr, const T& si)
+  {
+    complex<T> one(1, 0);
+#ifdef SELDON_WITH_VIRTUAL
+    var.ComputeAndFactorizeStiffnessMatrix(-complex<T>(sr, si), one,
+                                           EigenProblem_Base<T>::REAL_PART);
+#else
+    var.ComputeAndFactorizeStiffnessMatrix(-complex<T>(sr, si), one, true);
+#endif
+  }
+
+
+  //! for complex problems, the imaginary part of the shift is not used
+  template<class EigenPb, class T>
+  void FactorizeComplexShiftNative(EigenPb& var, const complex<T>& sr,
+                                   const complex<T>&)
+  {
+    complex<T> one(1, 0);
+    var.ComputeAndFactorizeStiffnessMatrix(-sr, one);
+  }
+
+
+
+  //! retrieves lambda from mu for a spectral transformation (real case)
+  template<class T>
+  void TransformEigenvalueNative(int type, const T& sigma, T& lambda_r, T& lambda_i)
+  {
+    complex<T> mu(lambda_r, lambda_i), val(0, 0);
+    if (type == NativeEigenTransform::SHIFT_INVERT)
+      {
+        // mu = 1 / (lambda - sigma)
+        if (mu != complex<T>(0, 0))
+          val = sigma + T(1) / mu;
+      }
+    else if (type == NativeEigenTransform::BUCKLING)
+      {
+        // mu = lambda / (lambda - sigma)
+        if (mu != complex<T>(1, 0))
+          val = sigma * mu / (mu - T(1));
+      }
+    else if (type == NativeEigenTransform::CAYLEY)
+      {
+        // mu = (lambda + sigma) / (lambda - sigma)
+        if (mu != complex<T>(1, 0))
+          val = sigma * (mu + T(1)) / (mu - T(1));
+      }
+    else
+      val = mu;
+
+    lambda_r = real(val);
+    lambda_i = imag(val);
+  }
+
+
+  //! retrieves lambda from mu for a spectral transformation (complex case)
+  template<class T>
+  void TransformEigenvalueNative(int type, const complex<T>& sigma,
+                                 complex<T>& lambda_r, complex<T>& lambda_i)
+  {
+    complex<T> mu = lambda_r, val(0, 0), one(1, 0);
+    if (type == NativeEigenTransform::SHIFT_INVERT)
+      {
+        if (mu != complex<T>(0, 0))
+          val = sigma + one / mu;
+      }
+    else if (type == NativeEigenTransform::BUCKLING)
+      {
+        if (mu != one)
+          val = sigma * mu / (mu - one);
+      }
+    else if (type == NativeEigenTransform::CAYLEY)
+      {
+        if (mu != one)
+          val = sigma * (mu + one) / (mu - one);
+      }
+    else
+      val = mu;
+
+    lambda_r = val;
+    lambda_i = complex<T>(0, 0);
+  }
+
+
+  //! stores a complex eigenvalue as real and imaginary parts
+  template<class T>
+  void SetEigenvalueNative(const complex<T>& mu, T& lambda_r, T& lambda_i)
+  {
+    lambda_r = real(mu);
+    lambda_i = imag(mu);
+  }
+
+
+  //! stores a complex eigenvalue
+  template<class T>
+  void SetEigenvalueNative(const complex<T>& mu, complex<T>& lambda_r,
+                           complex<T>& lambda_i)
+  {
+    lambda_r = mu;
+    lambda_i = complex<T>(0, 0);
+  }
+
+
+  //! eigenvalues and eigenvectors of a dense symmetric matrix
+  /*!
+    Only the upper part of A is used
+  */
+  template<class T>
+  void GetHermitianEigenNative(Matrix<T, General, ColMajor>& A, Vector<T>& w,
+                               Matrix<T, General, ColMajor>& z)
+  {
+    int n = A.GetM();
+    Matrix<T, Symmetric, ColSym> As(n, n);
+    for (int j = 0; j < n; j++)
+      for (int i = 0; i <= j; i++)
+        As.Val(i, j) = A(i, j);
+
+    GetEigenvaluesEigenvectors(As, w, z);
+  }
+
+
+  //! eigenvalues and eigenvectors of a dense hermitian matrix
+  /*!
+    Only the upper part of A is used
+  */
+  template<class T>
+  void GetHermitianEigenNative(Matrix<complex<T>, General, ColMajor>& A,
+                               Vector<T>& w,
+                               Matrix<complex<T>, General, ColMajor>& z)
+  {
+    int n = A.GetM();
+    Matrix<complex<T>, Hermitian, ColHerm> Ah(n, n);
+    for (int j = 0; j < n; j++)
+      for (int i = 0; i <= j; i++)
+        Ah.Val(i, j) = A(i, j);
+
+    GetEigenvaluesEigenvectors(Ah, w, z);
+  }
+
+
+  //! Ritz values and vectors of a real Hessenberg matrix
+  /*!
+    \param[in] H square matrix
+    \param[out] mu eigenvalues of H
+    \param[out] Y normalized eigenvectors of H
+    Complex conjugate pairs are stored consecutively, the eigenvalue with
+    a positive imaginary part being placed first.
+  */
+  template<class T>
+  void GetRitzPairsNative(const Matrix<T, General, ColMajor>& H,
+                          Vector<complex<T> >& mu,
+                          Matrix<complex<T>, General, ColMajor>& Y)
+  {
+    int m = H.GetM();
+    Matrix<T, General, ColMajor> A(H), Z;
+    Vector<T> wr, wi;
+    GetEigenvaluesEigenvectors(A, wr, wi, Z);
+
+    mu.Reallocate(m);
+    Y.Reallocate(m, m);
+    int j = 0;
+    while (j < m)
+      {
+        if ((wi(j) == T(0)) || (j == m-1))
+          {
+            mu(j) = complex<T>(wr(j), wi(j));
+            for (int i = 0; i < m; i++)
+              Y(i, j) = complex<T>(Z(i, j), 0);
+
+            j++;
+          }
+        else
+          {
+            mu(j) = complex<T>(wr(j), wi(j));
+            mu(j+1) = complex<T>(wr(j+1), wi(j+1));
+            for (int i = 0; i < m; i++)
+              {
+                Y(i, j) = complex<T>(Z(i, j), Z(i, j+1));
+                Y(i, j+1) = complex<T>(Z(i, j), -Z(i, j+1));
+              }
+
+            j += 2;
+          }
+      }
+  }
+
+
+  //! Ritz values and vectors of a complex Hessenberg matrix
+  template<class T>
+  void GetRitzPairsNative(const Matrix<complex<T>, General, ColMajor>& H,
+                          Vector<complex<T> >& mu,
+                          Matrix<complex<T>, General, ColMajor>& Y)
+  {
+    Matrix<complex<T>, General, ColMajor> A(H);
+    GetEigenvaluesEigenvectors(A, mu, Y);
+  }
+
+
+  //! basis of the space spanned by selected Ritz vectors (real case)
+  /*!
+    \param[in] Y Ritz vectors
+    \param[in] mu Ritz values
+    \param[in] index selected Ritz vectors, conjugate pairs being consecutive
+    \param[out] Q real and imaginary parts of the selected Ritz vectors
+  */
+  template<class T>
+  void GetRitzBasisNative(const Matrix<complex<T>, General, ColMajor>& Y,
+                          const Vector<complex<T> >& mu, const IVect& index,
+                          Matrix<T, General, ColMajor>& Q)
+  {
+    int m = Y.GetM(), k = index.GetM();
+    Q.Reallocate(m, k);
+    int p = 0;
+    while (p < k)
+      {
+        int j = index(p);
+        if ((imag(mu(j)) == T(0)) || (p == k-1))
+          {
+            for (int i = 0; i < m; i++)
+              Q(i, p) = real(Y(i, j));
+
+            p++;
+          }
+        else
+          {
+            for (int i = 0; i < m; i++)
+              {
+                Q(i, p) = real(Y(i, j));
+                Q(i, p+1) = imag(Y(i, j));
+              }
+
+            p += 2;
+          }
+      }
+  }
+
+
+  //! basis of the space spanned by selected Ritz vectors (complex case)
+  template<class T>
+  void GetRitzBasisNative(const Matrix<complex<T>, General, ColMajor>& Y,
+                          const Vector<complex<T> >& mu, const IVect& index,
+                          Matrix<complex<T>, General, ColMajor>& Q)
+  {
+    int m = Y.GetM(), k = index.GetM();
+    Q.Reallocate(m, k);
+    for (int p = 0; p < k; p++)
+      for (int i = 0; i < m; i++)
+        Q(i, p) = Y(i, index(p));
+  }
+
+
+  //! orthonormalization of the columns of Q (Gram-Schmidt applied twice)
+  template<class T>
+  void OrthonormalizeColumnsNative(Matrix<T, General, ColMajor>& Q)
+  {
+    int m = Q.GetM(), k = Q.GetN();
+    T zero; SetComplexZero(zero);
+    for (int j = 0; j < k; j++)
+      {
+        for (int pass = 0; pass < 2; pass++)
+          for (int q = 0; q < j; q++)
+            {
+              T scal = zero;
+              for (int i = 0; i < m; i++)
+                scal += conjugate(Q(i, q)) * Q(i, j);
+
+              for (int i = 0; i < m; i++)
+                Q(i, j) -= scal * Q(i, q);
+            }
+
+        typename ClassComplexType<T>::Treal nrm(0);
+        for (int i = 0; i < m; i++)
+          nrm += absSquare(Q(i, j));
+
+        nrm = sqrt(nrm);
+        if (nrm > 0)
+          for (int i = 0; i < m; i++)
+            Q(i, j) /= nrm;
+      }
+  }
+
+
+  //! Rayleigh-Ritz procedure used by LOBPCG
+  /*!
+    \param[in] op operator
+    \param[in] S basis of the search space
+    \param[in] AS A S
+    \param[in] BS B S
+    \param[in] nb number of wanted Ritz vectors
+    \param[out] C coefficients of the Ritz vectors in the basis S
+    \param[out] mu Ritz values (sorted from the most wanted)
+    \param[out] rank dimension of the search space after removal
+    of dependent directions
+    \return number of Ritz vectors computed (lower than nb
+    if the search space is too small)
+    The basis S does not need to be B-orthonormal, directions
+    that are numerically dependent are removed.
+  */
+  template<class EigenPb, class T>
+  int ComputeRayleighRitzLobpcg(NativeEigenOperator<EigenPb, T>& op,
+                                const Matrix<T, General, ColMajor>& S,
+                                const Matrix<T, General, ColMajor>& AS,
+                                const Matrix<T, General, ColMajor>& BS,
+                                int nb, Matrix<T, General, ColMajor>& C,
+                                Vector<typename ClassComplexType<T>::Treal>& mu,
+                                int& rank)
+  {
+    typedef typename ClassComplexType<T>::Treal Treal;
+    typedef typename ClassComplexType<T>::Tcplx Tcplx;
+
+    T zero, one;
+    SetComplexZero(zero);
+    SetComplexOne(one);
+
+    // projected matrices S^H A S and S^H B S
+    int ns = S.GetN();
+    Matrix<T, General, ColMajor> GA(ns, ns), GB(ns, ns);
+    MltAdd(one, SeldonConjTrans, S, SeldonNoTrans, AS, zero, GA);
+    MltAdd(one, SeldonConjTrans, S, SeldonNoTrans, BS, zero, GB);
+
+    // scaling to have a unit diagonal in S^H B S
+    Vector<Treal> d(ns);
+    for (int i = 0; i < ns; i++)
+      {
+        Treal val = realpart(GB(i, i));
+        d(i) = (val > Treal(0)) ? Treal(1) / sqrt(val) : Treal(0);
+      }
+
+    Matrix<T, General, ColMajor> GBs(ns, ns), U;
+    for (int j = 0; j < ns; j++)
+      for (int i = 0; i <= j; i++)
+        {
+          GA(i, j) = Treal(0.5) * (GA(i, j) + conjugate(GA(j, i)));
+          GA(j, i) = conjugate(GA(i, j));
+          GBs(i, j) = d(i) * d(j) * Treal(0.5) * (GB(i, j) + conjugate(GB(j, i)));
+        }
+
+    // S^H B S = U W U^H, and small eigenvalues are dropped
+    Vector<Treal> w;
+    GetHermitianEigenNative(GBs, w, U);
+    Treal wmax(0);
+    for (int i = 0; i < ns; i++)
+      wmax = max(wmax, w(i));
+
+    Treal threshold = Treal(ns) * sqrt(numeric_limits<Treal>::epsilon()) * wmax;
+
+    int r = 0;
+    for (int i = 0; i < ns; i++)
+      if (w(i) > threshold)
+        r++;
+
+    rank = r;
+
+    // B-orthonormal basis of the search space : S D U W^-1/2
+    Matrix<T, General, ColMajor> Tm(ns, r);
+    int q = 0;
+    for (int k = 0; k < ns; k++)
+      if (w(k) > threshold)
+        {
+          Treal coef = Treal(1) / sqrt(w(k));
+          for (int i = 0; i < ns; i++)
+            Tm(i, q) = d(i) * coef * U(i, k);
+
+          q++;
+        }
+
+    // projected standard eigenvalue problem
+    Matrix<T, General, ColMajor> GT(ns, r), Gr(r, r), Z;
+    MltAdd(one, SeldonNoTrans, GA, SeldonNoTrans, Tm, zero, GT);
+    MltAdd(one, SeldonConjTrans, Tm, SeldonNoTrans, GT, zero, Gr);
+
+    Vector<Treal> theta;
+    GetHermitianEigenNative(Gr, theta, Z);
+
+    // selection of the most wanted Ritz values
+    Vector<Treal> key(r);
+    IVect perm(r);
+    perm.Fill();
+    for (int k = 0; k < r; k++)
+      key(k) = -op.GetScore(Tcplx(theta(k)));
+
+    Sort(key, perm);
+
+    int nsel = min(nb, r);
+    Matrix<T, General, ColMajor> Zsel(r, nsel);
+    mu.Reallocate(nsel);
+    for (int k = 0; k < nsel; k++)
+      {
+        mu(k) = theta(perm(k));
+        for (int i = 0; i < r; i++)
+          Zsel(i, k) = Z(i, perm(k));
+      }
+
+    C.Reallocate(ns, nsel);
+    MltAdd(one, SeldonNoTrans, Tm, SeldonNoTrans, Zsel, zero, C);
+    return nsel;
+  }
+
+
+  /**********
+   * LOBPCG *
+   **********/
+
+
+  //! computation of eigenvalues and related eigenvectors with LOBPCG
+  /*!
+    \param[in,out] var eigenproblem to solve
+    \param[out] eigen_values eigenvalue
+    \param[out] lambda_imag imaginary part of eigenvalues (equal to 0)
+    \param[out] eigen_vectors eigenvectors
+    LOBPCG (Locally Optimal Block Preconditioned Conjugate Gradient)
+    is reserved for symmetric (or hermitian) eigenproblems.
+  */
+#ifdef SELDON_WITH_VIRTUAL
+  template<class T>
+  void FindEigenvaluesLobpcg(EigenProblem_Base<T>& var,
+                             Vector<T>& eigen_values,
+                             Vector<T>& lambda_imag,
+                             Matrix<T, General, ColMajor>& eigen_vectors)
+#else
+  template<class EigenProblem, class T, class Allocator1,
+	   class Allocator2, class Allocator3>
+  void FindEigenvaluesLobpcg(EigenProblem& var,
+                             Vector<T, VectFull, Allocator1>& eigen_values,
+                             Vector<T, VectFull, Allocator2>& lambda_imag,
+                             Matrix<T, General, ColMajor, Allocator3>& eigen_vectors)
+#endif
+  {
+    Preconditioner_Base<T> prec;
+    FindEigenvaluesLobpcg(var, eigen_values, lambda_imag, eigen_vectors, prec);
+  }
+
+
+  //! computation of eigenvalues and related eigenvectors with LOBPCG
+  /*!
+    \param[in,out] var eigenproblem to solve
+    \param[out] eigen_values eigenvalue
+    \param[out] lambda_imag imaginary part of eigenvalues (equal to 0)
+    \param[out] eigen_vectors eigenvectors
+    \param[in,out] prec preconditioner applied to residuals
+    The preconditioner is called as prec.Solve(A, r, z), where A is an empty
+    matrix of the size of the problem : prec has to store its own
+    approximation of the operator inverse (for instance K^-1 in regular mode).
+    In shifted modes of generalized problems, residuals are preconditioned
+    by B^-1 (obtained without additional solve) and prec is not used.
+  */
+#ifdef SELDON_WITH_VIRTUAL
+  template<class T>
+  void FindEigenvaluesLobpcg(EigenProblem_Base<T>& var,
+                             Vector<T>& eigen_values,
+                             Vector<T>& lambda_imag,
+                             Matrix<T, General, ColMajor>& eigen_vectors,
+                             Preconditioner_Base<T>& prec)
+#else
+  template<class EigenProblem, class T, class Allocator1,
+	   class Allocator2, class Allocator3, class Preconditioner>
+  void FindEigenvaluesLobpcg(EigenProblem& var,
+                             Vector<T, VectFull, Allocator1>& eigen_values,
+                             Vector<T, VectFull, Allocator2>& lambda_imag,
+                             Matrix<T, General, ColMajor, Allocator3>& eigen_vectors,
+                             Preconditioner& prec)
+#endif
+  {
+    typedef typename ClassComplexType<T>::Treal Treal;
+#ifdef SELDON_WITH_VIRTUAL
+    typedef EigenProblem_Base<T> EigenProblem;
+#endif
+
+    T zero, one;
+    SetComplexZero(zero);
+    SetComplexOne(one);
+
+    if (!IsComplexNumber(zero) && !var.IsSymmetricProblem())
+      {
+        cout << "LOBPCG is reserved for symmetric eigenproblems" << endl;
+        cout << "Select Krylov-Schur for unsymmetric problems" << endl;
+        abort();
+      }
+
+    int n = var.GetM();
+    int nev = min(var.GetNbAskedEigenvalues(), n);
+    Treal tol = var.GetStoppingCriterion();
+    int nb_max_iter = var.GetNbMaximumIterations();
+    int print_level = var.GetPrintLevel();
+
+    // block size (the search space contains at most 3 nb vectors)
+    int nb = min(n, max(nev, var.GetNbArnoldiVectors()));
+    bool whole_space = (3*nb >= n);
+    if (whole_space)
+      nb = n;
+
+    NativeEigenOperator<EigenProblem, T> op(var);
+    op.Init(true);
+
+    // if with_op is true, B^-1 A is stored for each block
+    // to precondition residuals
+    bool with_op = op.IsOperatorGivenWithA();
+
+    // initial block
+    Matrix<T, General, ColMajor> X(n, nb), AX, BX, OX, S, AS, BS, OS, C;
+    X.Fill(zero);
+    if (whole_space)
+      {
+        // the search space is the whole space
+        for (int i = 0; i < n; i++)
+          X(i, i) = one;
+      }
+    else
+      for (int j = 0; j < nb; j++)
+        for (int i = 0; i < n; i++)
+          X(i, j) = Treal(rand())/RAND_MAX - Treal(0.5);
+
+    if (with_op)
+      op.MltA(X, AX, OX);
+    else
+      op.MltA(X, AX);
+
+    op.MltB(X, BX);
+
+    Vector<Treal> mu;
+    int rank;
+    nb = ComputeRayleighRitzLobpcg(op, X, AX, BX, nb, C, mu, rank);
+    S = X; AS = AX; BS = BX; OS = OX;
+    X.Reallocate(n, nb); AX.Reallocate(n, nb); BX.Reallocate(n, nb);
+    MltAdd(one, SeldonNoTrans, S, SeldonNoTrans, C, zero, X);
+    MltAdd(one, SeldonNoTrans, AS, SeldonNoTrans, C, zero, AX);
+    MltAdd(one, SeldonNoTrans, BS, SeldonNoTrans, C, zero, BX);
+    if (with_op)
+      {
+        OX.Reallocate(n, nb);
+        MltAdd(one, SeldonNoTrans, OS, SeldonNoTrans, C, zero, OX);
+      }
+
+    if (print_level >= 2)
+      cout << "Starting LOBPCG iterations..." << endl;
+
+    Matrix<T, General, ColMajor> W, AW, BW, OW, P, AP, BP, OP, G;
+    Vector<T> r(n), z(n);
+    Vector<Treal> residual(nb);
+    VirtualMatrix<T> mat_prec(n, n);
+    int np = 0, nb_iter = 0;
+    r.Fill(zero); z.Fill(zero);
+    while (true)
+      {
+        // residuals R = A X - B X diag(mu)
+        int nconv = 0;
+        IVect active;
+        for (int j = 0; j < nb; j++)
+          {
+            Treal norm_r(0), norm_ax(0), norm_bx(0);
+            for (int i = 0; i < n; i++)
+              {
+                r(i) = AX(i, j) - mu(j) * BX(i, j);
+                norm_r += absSquare(r(i));
+                norm_ax += absSquare(AX(i, j));
+                norm_bx += absSquare(BX(i, j));
+              }
+
+            Treal den = sqrt(norm_ax) + abs(mu(j)) * sqrt(norm_bx);
+            residual(j) = (den > Treal(0)) ? sqrt(norm_r) / den : sqrt(norm_r);
+            if (residual(j) <= tol)
+              {
+                if (j < nev)
+                  nconv++;
+              }
+            else
+              active.PushBack(j);
+          }
+
+        if (print_level >= 3)
+          cout << "Iteration " << nb_iter << ", number of converged "
+               << "eigenvalues : " << nconv << endl;
+
+        if ((nconv >= nev) || whole_space)
+          break;
+
+        if (nb_iter >= nb_max_iter)
+          {
+            cout << "Maximum number of iterations reached" << endl;
+            cout << "Try again with a larger number of iterations"
+                 << " or with a less restrictive stopping criterion" << endl;
+            abort();
+          }
+
+        // preconditioned residuals for non-converged vectors
+        int nw = active.GetM();
+        W.Reallocate(n, nw);
+        for (int k = 0; k < nw; k++)
+          {
+            int j = active(k);
+            if (with_op)
+              {
+                // B^-1 r = B^-1 A x - mu x
+                for (int i = 0; i < n; i++)
+                  z(i) = OX(i, j) - mu(j) * X(i, j);
+              }
+            else
+              {
+                for (int i = 0; i < n; i++)
+                  r(i) = AX(i, j) - mu(j) * BX(i, j);
+
+                prec.Solve(mat_prec, r, z);
+              }
+
+            Treal nrm = Norm2(z);
+            if (nrm > Treal(0))
+              Mlt(Treal(1)/nrm, z);
+
+            SetCol(z, k, W);
+          }
+
+        // W is made B-orthogonal to X (X is B-orthonormal)
+        G.Reallocate(nb, nw);
+        for (int pass = 0; pass < 2; pass++)
+          {
+            MltAdd(one, SeldonConjTrans, BX, SeldonNoTrans, W, zero, G);
+            MltAdd(-one, SeldonNoTrans, X, SeldonNoTrans, G, one, W);
+          }
+
+        OrthonormalizeColumnsNative(W);
+
+        if (with_op)
+          op.MltA(W, AW, OW);
+        else
+          op.MltA(W, AW);
+
+        op.MltB(W, BW);
+
+        // search space S = [X W P]
+        int ns = nb + nw + np;
+        S.Reallocate(n, ns); AS.Reallocate(n, ns); BS.Reallocate(n, ns);
+        if (with_op)
+          OS.Reallocate(n, ns);
+
+        for (int j = 0; j < nb; j++)
+          for (int i = 0; i < n; i++)
+            {
+              S(i, j) = X(i, j);
+              AS(i, j) = AX(i, j);
+              BS(i, j) = BX(i, j);
+              if (with_op)
+                OS(i, j) = OX(i, j);
+            }
+
+        for (int j = 0; j < nw; j++)
+          for (int i = 0; i < n; i++)
+            {
+              S(i, nb+j) = W(i, j);
+              AS(i, nb+j) = AW(i, j);
+              BS(i, nb+j) = BW(i, j);
+              if (with_op)
+                OS(i, nb+j) = OW(i, j);
+            }
+
+        for (int j = 0; j < np; j++)
+          for (int i = 0; i < n; i++)
+            {
+              S(i, nb+nw+j) = P(i, j);
+              AS(i, nb+nw+j) = AP(i, j);
+              BS(i, nb+nw+j) = BP(i, j);
+              if (with_op)
+                OS(i, nb+nw+j) = OP(i, j);
+            }
+
+        // Rayleigh-Ritz
+        int nb_old = nb;
+        nb = ComputeRayleighRitzLobpcg(op, S, AS, BS, nb, C, mu, rank);
+
+        X.Reallocate(n, nb); AX.Reallocate(n, nb); BX.Reallocate(n, nb);
+        MltAdd(one, SeldonNoTrans, S, SeldonNoTrans, C, zero, X);
+        MltAdd(one, SeldonNoTrans, AS, SeldonNoTrans, C, zero, AX);
+        MltAdd(one, SeldonNoTrans, BS, SeldonNoTrans, C, zero, BX);
+        if (with_op)
+          {
+            OX.Reallocate(n, nb);
+            MltAdd(one, SeldonNoTrans, OS, SeldonNoTrans, C, zero, OX);
+          }
+
+        // new search directions P = [W P] C_{W,P}
+        // if the search space was ill-conditioned, P is dropped (restart)
+        for (int j = 0; j < nb; j++)
+          for (int i = 0; i < nb_old; i++)
+            C(i, j) = zero;
+
+        np = (rank < ns) ? 0 : nb;
+        P.Reallocate(n, np); AP.Reallocate(n, np); BP.Reallocate(n, np);
+        if (np > 0)
+          {
+            MltAdd(one, SeldonNoTrans, S, SeldonNoTrans, C, zero, P);
+            MltAdd(one, SeldonNoTrans, AS, SeldonNoTrans, C, zero, AP);
+            MltAdd(one, SeldonNoTrans, BS, SeldonNoTrans, C, zero, BP);
+            if (with_op)
+              {
+                OP.Reallocate(n, np);
+                MltAdd(one, SeldonNoTrans, OS, SeldonNoTrans, C, zero, OP);
+              }
+          }
+
+        nb_iter++;
+      }
+
+    if (print_level >= 1)
+      cout << "LOBPCG converged in " << nb_iter << " iterations" << endl;
+
+    // eigenvalues and eigenvectors are retrieved
+    nev = min(nev, nb);
+    eigen_values.Reallocate(nev);
+    lambda_imag.Reallocate(nev);
+    lambda_imag.Fill(zero);
+    eigen_vectors.Reallocate(n, nev);
+    for (int j = 0; j < nev; j++)
+      {
+        eigen_values(j) = mu(j);
+        for (int i = 0; i < n; i++)
+          eigen_vectors(i, j) = X(i, j);
+      }
+
+    op.TransformEigenvalues(eigen_values, lambda_imag);
+
+    T shiftr = var.GetShiftValue(), shifti = var.GetImagShiftValue();
+    ApplyScalingEigenvec(var, eigen_values, lambda_imag, eigen_vectors,
+                         shiftr, shifti);
+  }
+
+
+  /****************
+   * Krylov-Schur *
+   ****************/
+
+
+  //! computation of eigenvalues and related eigenvectors with Krylov-Schur
+  /*!
+    \param[in,out] var eigenproblem to solve
+    \param[out] eigen_values eigenvalue
+    \param[out] lambda_imag imaginary part of eigenvalues
+    \param[out] eigen_vectors eigenvectors
+    Krylov-Schur method (Stewart, 2001) for general eigenproblems.
+    An Arnoldi decomposition A V = V H + v b^T is expanded up to
+    the number of Arnoldi vectors, and restarted with the invariant
+    subspace of H associated with the wanted Ritz values.
+    For real unsymmetric problems, a complex conjugate pair is stored
+    as in Arpack : the real part of the eigenvector in the first column,
+    and the imaginary part in the second column.
+  */
+#ifdef SELDON_WITH_VIRTUAL
+  template<class T>
+  void FindEigenvaluesKrylovSchur(EigenProblem_Base<T>& var,
+                                  Vector<T>& eigen_values,
+                                  Vector<T>& lambda_imag,
+                                  Matrix<T, General, ColMajor>& eigen_vectors)
+#else
+  template<class EigenProblem, class T, class Allocator1,
+	   class Allocator2, class Allocator3>
+  void FindEigenvaluesKrylovSchur(EigenProblem& var,
+                                  Vector<T, VectFull, Allocator1>& eigen_values,
+                                  Vector<T, VectFull, Allocator2>& lambda_imag,
+                                  Matrix<T, General, ColMajor, Allocator3>& eigen_vectors)
+#endif
+  {
+    typedef typename ClassComplexType<T>::Treal Treal;
+    typedef typename ClassComplexType<T>::Tcplx Tcplx;
+#ifdef SELDON_WITH_VIRTUAL
+    typedef EigenProblem_Base<T> EigenProblem;
+#endif
+
+    T zero, one;
+    SetComplexZero(zero);
+    SetComplexOne(one);
+    bool real_problem = !IsComplexNumber(zero);
+
+    int n = var.GetM();
+    int nev = min(var.GetNbAskedEigenvalues(), n);
+    Treal tol = var.GetStoppingCriterion();
+    int nb_max_restart = var.GetNbMaximumIterations();
+    int print_level = var.GetPrintLevel();
+    Treal eps = numeric_limits<Treal>::epsilon();
+
+    // dimension of the Krylov space
+    int m = min(n, max(var.GetNbArnoldiVectors(), nev+3));
+
+    NativeEigenOperator<EigenProblem, T> op(var);
+    op.Init(false);
+
+    // Krylov decomposition A V(:, 0:m-1) = V H
+    // V has m+1 columns, and H m+1 rows
+    Matrix<T, General, ColMajor> V(n, m+1), H(m+1, m), Hm(m, m);
+    V.Fill(zero);
+    H.Fill(zero);
+    Vector<T> x(n), w(n), h(m+1), h2(m+1);
+    x.Fill(zero); w.Fill(zero);
+
+    // random starting vector
+    for (int i = 0; i < n; i++)
+      w(i) = Treal(rand())/RAND_MAX - Treal(0.5);
+
+    Mlt(Treal(1)/Norm2(w), w);
+    SetCol(w, 0, V);
+
+    if (print_level >= 2)
+      cout << "Starting Krylov-Schur iterations..." << endl;
+
+    Vector<Tcplx> mu;
+    Matrix<Tcplx, General, ColMajor> Y;
+    Vector<Treal> res, key;
+    IVect perm, index;
+    int k = 0, nb_restart = 0;
+    while (true)
+      {
+        // expansion of the Krylov decomposition from k to m vectors
+        for (int j = k; j < m; j++)
+          {
+            GetCol(V, j, x);
+            op.MltOperator(x, w);
+            Treal norm_w = Norm2(w);
+
+            // orthogonalization against V (applied twice)
+            // the columns of V after j are null
+            MltAdd(one, SeldonConjTrans, V, w, zero, h);
+            MltAdd(-one, SeldonNoTrans, V, h, one, w);
+            MltAdd(one, SeldonConjTrans, V, w, zero, h2);
+            MltAdd(-one, SeldonNoTrans, V, h2, one, w);
+            Add(one, h2, h);
+
+            for (int i = 0; i <= j; i++)
+              H(i, j) = h(i);
+
+            Treal beta = Norm2(w);
+            if (beta > Treal(n) * eps * norm_w)
+              {
+                H(j+1, j) = beta;
+                Mlt(Treal(1)/beta, w);
+              }
+            else
+              {
+                // invariant subspace found
+                H(j+1, j) = zero;
+                w.Fill(zero);
+                if (j+1 < m)
+                  {
+                    // a new random vector orthogonal to V is generated
+                    for (int i = 0; i < n; i++)
+                      w(i) = Treal(rand())/RAND_MAX - Treal(0.5);
+
+                    for (int pass = 0; pass < 2; pass++)
+                      {
+                        MltAdd(one, SeldonConjTrans, V, w, zero, h);
+                        MltAdd(-one, SeldonNoTrans, V, h, one, w);
+                      }
+
+                    Mlt(Treal(1)/Norm2(w), w);
+                  }
+              }
+
+            SetCol(w, j+1, V);
+          }
+
+        // Ritz values and vectors
+        for (int j = 0; j < m; j++)
+          for (int i = 0; i < m; i++)
+            Hm(i, j) = H(i, j);
+
+        GetRitzPairsNative(Hm, mu, Y);
+
+        // residuals |b^T y| and sorting of Ritz values
+        res.Reallocate(m); key.Reallocate(m); perm.Reallocate(m);
+        perm.Fill();
+        for (int j = 0; j < m; j++)
+          {
+            Tcplx val = 0;
+            for (int i = 0; i < m; i++)
+              val += H(m, i) * Y(i, j);
+
+            res(j) = abs(val);
+            key(j) = -op.GetScore(mu(j));
+          }
+
+        Sort(key, perm);
+
+        // nev wanted Ritz values, conjugate pairs are kept together
+        int nsel = 0, nconv = 0;
+        Vector<bool> selected(m);
+        selected.Fill(false);
+        index.Reallocate(m);
+        for (int p = 0; p < m; p++)
+          {
+            if (nsel >= nev)
+              break;
+
+            int j = perm(p);
+            if (selected(j))
+              continue;
+
+            // for a conjugate pair, eigenvalue with positive imaginary part first
+            if (real_problem && (imag(mu(j)) < Treal(0)) && (j > 0))
+              j--;
+
+            index(nsel++) = j;
+            selected(j) = true;
+            if (real_problem && (imag(mu(j)) > Treal(0)) && (j+1 < m))
+              {
+                index(nsel++) = j+1;
+                selected(j+1) = true;
+              }
+          }
+
+        for (int p = 0; p < nsel; p++)
+          {
+            int j = index(p);
+            if (res(j) <= tol * max(abs(mu(j)), eps))
+              nconv++;
+          }
+
+        if (print_level >= 3)
+          cout << "Restart " << nb_restart << ", number of converged "
+               << "eigenvalues : " << nconv << endl;
+
+        if ((nconv >= nsel) || (m == n))
+          {
+            // eigenvalues and eigenvectors are retrieved
+            index.Resize(nsel);
+            Matrix<T, General, ColMajor> Q, Qm(m+1, nsel);
+            GetRitzBasisNative(Y, mu, index, Q);
+            Qm.Fill(zero);
+            for (int j = 0; j < nsel; j++)
+              for (int i = 0; i < m; i++)
+                Qm(i, j) = Q(i, j);
+
+            eigen_vectors.Reallocate(n, nsel);
+            MltAdd(one, SeldonNoTrans, V, SeldonNoTrans, Qm, zero, eigen_vectors);
+
+            eigen_values.Reallocate(nsel);
+            lambda_imag.Reallocate(nsel);
+            for (int p = 0; p < nsel; p++)
+              SetEigenvalueNative(mu(index(p)), eigen_values(p), lambda_imag(p));
+
+            break;
+          }
+
+        nb_restart++;
+        if (nb_restart > nb_max_restart)
+          {
+            cout << "Maximum number of iterations reached" << endl;
+            cout << "Try again with a larger number of iterations"
+                 << " or with a less restrictive stopping criterion" << endl;
+            abort();
+          }
+
+        // selection of the Ritz vectors kept after the restart
+        int k_restart = nev + (m - nev)/2;
+        for (int p = 0; p < m; p++)
+          {
+            if (nsel >= k_restart)
+              break;
+
+            int j = perm(p);
+            if (selected(j))
+              continue;
+
+            if (real_problem && (imag(mu(j)) < Treal(0)) && (j > 0))
+              j--;
+
+            if (real_problem && (imag(mu(j)) > Treal(0)) && (j+1 < m))
+              {
+                if (nsel+2 > m-1)
+                  break;
+
+                index(nsel++) = j;
+                index(nsel++) = j+1;
+                selected(j) = true;
+                selected(j+1) = true;
+              }
+            else
+              {
+                index(nsel++) = j;
+                selected(j) = true;
+              }
+          }
+
+        k = nsel;
+        index.Resize(k);
+
+        // orthonormal basis Q of the invariant subspace
+        Matrix<T, General, ColMajor> Q, Qm(m+1, k), HQ(m, k), Vk(n, k);
+        GetRitzBasisNative(Y, mu, index, Q);
+        OrthonormalizeColumnsNative(Q);
+        Qm.Fill(zero);
+        for (int j = 0; j < k; j++)
+          for (int i = 0; i < m; i++)
+            Qm(i, j) = Q(i, j);
+
+        // new decomposition : V Q, Q^H H Q and b^T Q
+        MltAdd(one, SeldonNoTrans, Hm, SeldonNoTrans, Q, zero, HQ);
+        Matrix<T, General, ColMajor> Hk(k, k);
+        MltAdd(one, SeldonConjTrans, Q, SeldonNoTrans, HQ, zero, Hk);
+
+        Vector<T> b(k);
+        b.Fill(zero);
+        for (int j = 0; j < k; j++)
+          for (int i = 0; i < m; i++)
+            b(j) += H(m, i) * Q(i, j);
+
+        MltAdd(one, SeldonNoTrans, V, SeldonNoTrans, Qm, zero, Vk);
+        GetCol(V, m, x);
+        V.Fill(zero);
+        for (int j = 0; j < k; j++)
+          for (int i = 0; i < n; i++)
+            V(i, j) = Vk(i, j);
+
+        SetCol(x, k, V);
+
+        H.Fill(zero);
+        for (int j = 0; j < k; j++)
+          {
+            for (int i = 0; i < k; i++)
+              H(i, j) = Hk(i, j);
+
+            H(k, j) = b(j);
+          }
+      }
+
+    if (print_level >= 1)
+      cout << "Krylov-Schur converged after " << nb_restart << " restarts" << endl;
+
+    op.TransformEigenvalues(eigen_values, lambda_imag);
+
+    T shiftr = var.GetShiftValue(), shifti = var.GetImagShiftValue();
+    ApplyScalingEigenvec(var, eigen_values, lambda_imag, eigen_vectors,
+                         shiftr, shifti);
+  }
+
+
+  /******************
+   * Contour solver *
+   ******************/
+
+
+  //! nodes and weights of Gauss-Legendre quadrature on [-1, 1]
+  /*!
+    \param[in] n number of points
+    \param[out] x nodes (sorted by ascending order)
+    \param[out] w weights
+    The nodes are roots of Legendre polynomial P_n found with Newton's method.
+  */
+  template<class T>
+  void GetGaussLegendreNative(int n, Vector<T>& x, Vector<T>& w)
+  {
+    x.Reallocate(n);
+    w.Reallocate(n);
+    T pi = acos(T(-1)), eps = numeric_limits<T>::epsilon();
+    for (int i = 0; i < (n+1)/2; i++)
+      {
+        T t = cos(pi*(T(i) + T(0.75))/(T(n) + T(0.5))), dp(1);
+        for (int iter = 0; iter < 100; iter++)
+          {
+            // P_n(t) with the three-term recurrence
+            T p0(1), p1 = t;
+            for (int k = 2; k <= n; k++)
+              {
+                T p2 = (T(2*k-1)*t*p1 - T(k-1)*p0) / T(k);
+                p0 = p1;
+                p1 = p2;
+              }
+
+            dp = T(n)*(t*p1 - p0) / (t*t - T(1));
+            T dt = p1 / dp;
+            t -= dt;
+            if (abs(dt) <= T(4)*eps)
+              break;
+          }
+
+        x(i) = -t;
+        x(n-1-i) = t;
+        w(i) = T(2) / ((T(1) - t*t)*dp*dp);
+        w(n-1-i) = w(i);
+      }
+  }
+
+
+  //! adds the contribution of a quadrature point to the filtered subspace
+  /*!
+    \param[in] var eigenproblem where z M - K has been factorized
+    \param[in] w quadrature weight
+    \param[in] Y right hand sides
+    \param[in,out] Q columns offset to offset + Y.GetN() - 1 are
+    set to Re( w (z M - K)^-1 Y )
+    For real symmetric problems, the contribution of the conjugate point
+    conj(z) is the conjugate of the contribution of z.
+  */
+  template<class EigenPb, class T>
+  void ApplyContourResolventNative(EigenPb& var, const complex<T>& w,
+                                   const Matrix<T, General, ColMajor>& Y,
+                                   Matrix<T, General, ColMajor>& Q, int offset)
+  {
+    int n = Y.GetM();
+    Vector<complex<T> > x(n), y(n);
+    y.Fill(0);
+    for (int j = 0; j < Y.GetN(); j++)
+      {
+        for (int i = 0; i < n; i++)
+          x(i) = Y(i, j);
+
+        var.ComputeSolution(x, y);
+
+        for (int i = 0; i < n; i++)
+          Q(i, offset+j) = realpart(w*y(i));
+      }
+  }
+
+
+  //! adds the contribution of a quadrature point to the filtered subspace
+  /*!
+    \param[in] var eigenproblem where z M - K has been factorized
+    \param[in] w quadrature weight
+    \param[in] Y right hand sides
+    \param[in,out] Q columns offset to offset + Y.GetN() - 1 are
+    set to w (z M - K)^-1 Y + conj(w) (conj(z) M - K)^-1 Y
+    For hermitian problems, conj(z) M - K is the adjoint of z M - K,
+    the same factorisation is used for both points.
+  */
+  template<class EigenPb, class T>
+  void ApplyContourResolventNative(EigenPb& var, const complex<T>& w,
+                                   const Matrix<complex<T>, General, ColMajor>& Y,
+                                   Matrix<complex<T>, General, ColMajor>& Q,
+                                   int offset)
+  {
+    int n = Y.GetM();
+    Vector<complex<T> > x(n), y(n), y2(n);
+    y.Fill(0); y2.Fill(0);
+    for (int j = 0; j < Y.GetN(); j++)
+      {
+        for (int i = 0; i < n; i++)
+          x(i) = Y(i, j);
+
+        var.ComputeSolution(x, y);
+
+        // (z M - K)^-H x = conj( (z M - K)^-T conj(x) )
+        Conjugate(x);
+        var.ComputeSolution(SeldonTrans, x, y2);
+        Conjugate(y2);
+
+        for (int i = 0; i < n; i++)
+          Q(i, offset+j) = w*y(i) + conj(w)*y2(i);
+      }
+  }
+
+
+  //! computation of eigenvalues in an interval with a contour integral method
+  /*!
+    \param[in,out] var eigenproblem to solve
+    \param[out] eigen_values eigenvalues in the interval
+    \param[out] lambda_imag imaginary part of eigenvalues (equal to 0)
+    \param[out] eigen_vectors eigenvectors
+    Subspace iteration filtered by the spectral projector of the interval
+    [emin, emax] given by SetIntervalSpectrum (as in Feast, or Sakurai-Sugiura
+    methods). The projector is approximated by a Gauss-Legendre quadrature
+    on the circle enclosing the interval :
+      P = 1/(2 i pi) \int (z M - K)^-1 M dz
+    The matrix z M - K is factorized once for each quadrature point, each
+    point having its own eigenproblem (copy of var) such that factorizations
+    and solutions are performed concurrently when OpenMP is enabled.
+    The number of points is given by SetNbQuadraturePoints and the size of
+    the subspace by SetNbArnoldiVectors, it should be larger than the number
+    of eigenvalues in the interval. The method is reserved for symmetric
+    (or hermitian) eigenproblems with a positive definite mass matrix.
+  */
+#ifdef SELDON_WITH_VIRTUAL
+  template<class T>
+  void FindEigenvaluesContour(EigenProblem_Base<T>& var,
+                              Vector<T>& eigen_values,
+                              Vector<T>& lambda_imag,
+                              Matrix<T, General, ColMajor>& eigen_vectors)
+#else
+  template<class EigenProblem, class T, class Allocator1,
+	   class Allocator2, class Allocator3>
+  void FindEigenvaluesContour(EigenProblem& var,
+                              Vector<T, VectFull, Allocator1>& eigen_values,
+                              Vector<T, VectFull, Allocator2>& lambda_imag,
+                              Matrix<T, General, ColMajor, Allocator3>& eigen_vectors)
+#endif
+  {
+    typedef typename ClassComplexType<T>::Treal Treal;
+    typedef typename ClassComplexType<T>::Tcplx Tcplx;
+#ifdef SELDON_WITH_VIRTUAL
+    typedef EigenProblem_Base<T> EigenProblem;
+#endif
+
+    T zero, one;
+    SetComplexZero(zero);
+    SetComplexOne(one);
+
+    if (!IsComplexNumber(zero) && !var.IsSymmetricProblem())
+      {
+        cout << "The contour solver is reserved for symmetric eigenproblems" << endl;
+        abort();
+      }
+
+    Treal emin = var.GetLowerBoundInterval(), emax = var.GetUpperBoundInterval();
+    if (emin >= emax)
+      {
+        cout << "Give the interval where eigenvalues are searched "
+             << "with SetIntervalSpectrum" << endl;
+        abort();
+      }
+
+    int n = var.GetM();
+    int m0 = min(n, max(var.GetNbArnoldiVectors(), 1));
+    int nb_points = max(var.GetNbQuadraturePoints(), 1);
+    Treal tol = var.GetStoppingCriterion();
+    int nb_max_iter = var.GetNbMaximumIterations();
+    int print_level = var.GetPrintLevel();
+
+    var.SetComputationalMode(var.REGULAR_MODE);
+    NativeEigenOperator<EigenProblem, T> op(var);
+    op.Init(true, true);
+    bool standard = op.IsStandardProblem();
+
+    // quadrature points on the upper half of the circle
+    // z = c + r exp(i theta), theta = pi/2 (1 - t)
+    Vector<Treal> t, omega;
+    GetGaussLegendreNative(nb_points, t, omega);
+    Vector<Tcplx> z(nb_points), w(nb_points);
+    Treal pi = acos(Treal(-1));
+    Treal center = Treal(0.5)*(emin + emax), radius = Treal(0.5)*(emax - emin);
+    Treal coef = IsComplexNumber(zero) ? Treal(0.25) : Treal(0.5);
+    for (int e = 0; e < nb_points; e++)
+      {
+        Treal theta = Treal(0.5)*pi*(Treal(1) - t(e));
+        Tcplx eit(cos(theta), sin(theta));
+        z(e) = center + radius*eit;
+        w(e) = coef*omega(e)*radius*eit;
+      }
+
+#ifndef SELDON_WITH_VIRTUAL
+    // one eigenproblem per quadrature point, factorizations are kept
+    // during the iterations
+    EigenProblem* var_shift = new EigenProblem[nb_points];
+    for (int e = 0; e < nb_points; e++)
+      var_shift[e].CopyParameters(var);
+#endif
+
+    // random initial subspace
+    Matrix<T, General, ColMajor> X(n, m0), Y, Qe, Q, AQ, BQ, C;
+    for (int j = 0; j < m0; j++)
+      for (int i = 0; i < n; i++)
+        X(i, j) = Treal(rand())/RAND_MAX - Treal(0.5);
+
+    if (print_level >= 2)
+      cout << "Starting contour iterations with " << nb_points
+           << " quadrature points..." << endl;
+
+    Vector<T> x(n);
+    Vector<Treal> mu, residual;
+    IVect inside;
+    x.Fill(zero);
+    int nb_iter = 0, rank;
+    while (true)
+      {
+        // right hand sides M X (or M^1/2 X, L X for standard problems)
+        int m = X.GetN();
+        if (standard)
+          {
+            Y = X;
+            for (int j = 0; j < m; j++)
+              {
+                GetCol(Y, j, x);
+                if (var.DiagonalMass())
+                  var.MltSqrtDiagonalMass(x);
+                else
+                  var.MltCholeskyMass(SeldonNoTrans, x);
+
+                SetCol(x, j, Y);
+              }
+          }
+        else
+          op.MltB(X, Y);
+
+        // contributions of each quadrature point
+        Qe.Reallocate(n, nb_points*m);
+#ifdef SELDON_WITH_VIRTUAL
+        // only one factorization can be stored in var
+        for (int e = 0; e < nb_points; e++)
+          {
+            var.ComputeAndFactorizeStiffnessMatrix(z(e), -Tcplx(1));
+            ApplyContourResolventNative(var, w(e), Y, Qe, e*m);
+          }
+#else
+#ifdef _OPENMP
+        // the cost of a factorization depends on the shift
+        // => points are distributed dynamically among threads
+#pragma omp parallel for schedule(dynamic, 1) \
+  num_threads(ParallelContext::GetNumThreads(nb_points, 1))
+#endif
+        for (int e = 0; e < nb_points; e++)
+          {
+            if (nb_iter == 0)
+              var_shift[e].ComputeAndFactorizeStiffnessMatrix(z(e), -Tcplx(1));
+
+            ApplyContourResolventNative(var_shift[e], w(e), Y, Qe, e*m);
+          }
+#endif
+
+        // contributions are summed in the order of quadrature points
+        // such that the result does not depend on the number of threads
+        Q.Reallocate(n, m);
+        Q.Fill(zero);
+        for (int e = 0; e < nb_points; e++)
+          for (int j = 0; j < m; j++)
+            for (int i = 0; i < n; i++)
+              Q(i, j) += Qe(i, e*m + j);
+
+        for (int k = 0; k < nb_points*m; k++)
+          var.IncrementProdMatVect();
+
+        if (standard)
+          for (int j = 0; j < m; j++)
+            {
+              GetCol(Q, j, x);
+              if (var.DiagonalMass())
+                var.MltSqrtDiagonalMass(x);
+              else
+                var.MltCholeskyMass(SeldonTrans, x);
+
+              SetCol(x, j, Q);
+            }
+
+        // the filtered subspace is orthonormalized first, otherwise
+        // the Rayleigh-Ritz procedure would remove directions with small
+        // components (outside the interval) and limit the accuracy
+        OrthonormalizeColumnsNative(Q);
+
+        // Rayleigh-Ritz on the filtered subspace
+        op.MltA(Q, AQ);
+        op.MltB(Q, BQ);
+        int nb = ComputeRayleighRitzLobpcg(op, Q, AQ, BQ, m, C, mu, rank);
+
+        X.Reallocate(n, nb);
+        MltAdd(one, SeldonNoTrans, Q, SeldonNoTrans, C, zero, X);
+        op.MltA(X, AQ);
+        op.MltB(X, BQ);
+
+        // residuals of Ritz values inside the interval
+        int nconv = 0;
+        inside.Clear();
+        residual.Reallocate(nb);
+        for (int j = 0; j < nb; j++)
+          {
+            Treal norm_r(0), norm_ax(0), norm_bx(0);
+            for (int i = 0; i < n; i++)
+              {
+                norm_r += absSquare(AQ(i, j) - mu(j) * BQ(i, j));
+                norm_ax += absSquare(AQ(i, j));
+                norm_bx += absSquare(BQ(i, j));
+              }
+
+            Treal den = sqrt(norm_ax) + abs(mu(j)) * sqrt(norm_bx);
+            residual(j) = (den > Treal(0)) ? sqrt(norm_r) / den : sqrt(norm_r);
+            if ((mu(j) >= emin) && (mu(j) <= emax))
+              {
+                inside.PushBack(j);
+                if (residual(j) <= tol)
+                  nconv++;
+              }
+          }
+
+        int nb_inside = inside.GetM();
+        if (print_level >= 3)
+          cout << "Iteration " << nb_iter << ", " << nb_inside << " eigenvalues "
+               << "in the interval, " << nconv << " converged" << endl;
+
+        if ((nb_inside >= m0) && (m0 < n))
+          {
+            cout << "The subspace is too small, there are at least " << m0
+                 << " eigenvalues in the interval" << endl;
+            cout << "Increase the number of Arnoldi vectors" << endl;
+            abort();
+          }
+
+        // at least two iterations if no eigenvalue is found
+        if ((nconv == nb_inside) && ((nb_inside > 0) || (nb_iter > 0)))
+          break;
+
+        nb_iter++;
+        if (nb_iter >= nb_max_iter)
+          {
+            cout << "Maximum number of iterations reached" << endl;
+            cout << "Try again with a larger number of iterations"
+                 << " or with a less restrictive stopping criterion" << endl;
+            abort();
+          }
+
+        // dependent directions removed by Rayleigh-Ritz are replaced
+        // by random vectors
+        if (nb < m0)
+          {
+            Q = X;
+            X.Reallocate(n, m0);
+            for (int j = 0; j < nb; j++)
+              for (int i = 0; i < n; i++)
+                X(i, j) = Q(i, j);
+
+            for (int j = nb; j < m0; j++)
+              for (int i = 0; i < n; i++)
+                X(i, j) = Treal(rand())/RAND_MAX - Treal(0.5);
+          }
+      }
+
+#ifndef SELDON_WITH_VIRTUAL
+    delete [] var_shift;
+#endif
+
+    if (print_level >= 1)
+      cout << "Contour solver converged in " << nb_iter+1 << " iterations" << endl;
+
+    // eigenvalues in the interval by ascending order
+    int nev = inside.GetM();
+    Vector<Treal> key(nev);
+    IVect perm(nev);
+    perm.Fill();
+    for (int k = 0; k < nev; k++)
+      key(k) = mu(inside(k));
+
+    Sort(key, perm);
+
+    eigen_values.Reallocate(nev);
+    lambda_imag.Reallocate(nev);
+    lambda_imag.Fill(zero);
+    eigen_vectors.Reallocate(n, nev);
+    for (int k = 0; k < nev; k++)
+      {
+        int j = inside(perm(k));
+        eigen_values(k) = mu(j);
+        for (int i = 0; i < n; i++)
+          eigen_vectors(i, k) = X(i, j);
+      }
+
+    T shiftr = var.GetShiftValue(), shifti = var.GetImagShiftValue();
+    ApplyScalingEigenvec(var, eigen_values, lambda_imag, eigen_vectors,
+                         shiftr, shifti);
+  }
+
+}
+
+#endif
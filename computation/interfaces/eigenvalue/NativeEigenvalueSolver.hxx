@@ -0,0 +1,226 @@
+#ifndef SELDON_FILE_NATIVE_EIGENVALUE_SOLVER_HXX
+
+namespace Seldon
+{
+
+  //! spectral transformations used by native eigenvalue solvers
+  class NativeEigenTransform
+  {
+  public :
+    enum {REGULAR, SHIFT_INVERT, BUCKLING, CAYLEY};
+
+  };
+
+
+  //! Operator handled by native eigenvalue solvers (LOBPCG, Krylov-Schur, contour)
+  /*!
+    The eigenvalue problem K x = lambda M x is rewritten as a pencil (A, B)
+    such that B^-1 A is the operator used by Arpack in the same mode :
+      - if the mass matrix is diagonal, or factorized with Cholesky :
+          regular mode => A = M^-1/2 K M^-1/2, B = I
+          shifted mode => A = M^1/2 (K - sigma M)^-1 M^1/2, B = I
+      - generalized problem :
+          regular mode => A = K, B = M
+          shifted mode => A = M (K - sigma M)^-1 M, B = M
+          buckling mode => A = K (K - sigma M)^-1 K, B = K
+          Cayley mode => A = M (K - sigma M)^-1 (K + sigma M), B = M
+    A and B are hermitian if K and M are hermitian, so that LOBPCG can work
+    with the pencil, whereas Krylov-Schur only needs the operator B^-1 A.
+  */
+  template<class EigenPb, class T>
+  class NativeEigenOperator : public NativeEigenTransform
+  {
+  public :
+    typedef typename ClassComplexType<T>::Treal Treal;
+    typedef typename ClassComplexType<T>::Tcplx Tcplx;
+
+  protected :
+    //! eigenvalue problem
+    EigenPb& var;
+
+    //! spectral transformation
+    int type_transform;
+
+    //! if true, B = I
+    bool standard_problem;
+
+    //! if true, only B^-1 A is applied (B is not computed)
+    bool only_operator;
+
+    //! if true, eigenvalues of B^-1 A are converted by this class
+    //! (otherwise ApplyScalingEigenvec does it)
+    bool transform_eigenvalues;
+
+    //! shift sigma
+    T shift;
+
+    //! temporary vectors
+    Vector<T> Xh, Yh, Zh;
+
+  public :
+    explicit NativeEigenOperator(EigenPb& var);
+
+    void Init(bool pencil, bool interval = false);
+
+    int GetTypeTransform() const;
+    bool IsStandardProblem() const;
+    bool IsOperatorGivenWithA() const;
+
+    void MltOperator(const Vector<T>& X, Vector<T>& Y);
+    void MltA(const Vector<T>& X, Vector<T>& Y);
+    void MltB(const Vector<T>& X, Vector<T>& Y);
+
+    void MltA(const Matrix<T, General, ColMajor>& X,
+              Matrix<T, General, ColMajor>& Y);
+
+    void MltA(const Matrix<T, General, ColMajor>& X,
+              Matrix<T, General, ColMajor>& Y,
+              Matrix<T, General, ColMajor>& Z);
+
+    void MltB(const Matrix<T, General, ColMajor>& X,
+              Matrix<T, General, ColMajor>& Y);
+
+    Treal GetScore(const Tcplx& mu) const;
+
+    void TransformEigenvalues(Vector<T>& lambda_r, Vector<T>& lambda_i) const;
+
+  };
+
+
+  template<class EigenPb, class T>
+  void FactorizeComplexShiftNative(EigenPb& var, const T& sr, const T& si);
+
+  template<class EigenPb, class T>
+  void FactorizeComplexShiftNative(EigenPb& var, const complex<T>& sr,
+                                   const complex<T>& si);
+
+  template<class T>
+  void TransformEigenvalueNative(int type, const T& sigma, T& lambda_r, T& lambda_i);
+
+  template<class T>
+  void TransformEigenvalueNative(int type, const complex<T>& sigma,
+                                 complex<T>& lambda_r, complex<T>& lambda_i);
+
+  template<class T>
+  void SetEigenvalueNative(const complex<T>& mu, T& lambda_r, T& lambda_i);
+
+  template<class T>
+  void SetEigenvalueNative(const complex<T>& mu, complex<T>& lambda_r,
+                           complex<T>& lambda_i);
+
+  template<class T>
+  void GetHermitianEigenNative(Matrix<T, General, ColMajor>& A, Vector<T>& w,
+                               Matrix<T, General, ColMajor>& z);
+
+  template<class T>
+  void GetHermitianEigenNative(Matrix<complex<T>, General, ColMajor>& A,
+                               Vector<T>& w,
+                               Matrix<complex<T>, General, ColMajor>& z);
+
+  template<class T>
+  void GetRitzPairsNative(const Matrix<T, General, ColMajor>& H,
+                          Vector<complex<T> >& mu,
+                          Matrix<complex<T>, General, ColMajor>& Y);
+
+  template<class T>
+  void GetRitzPairsNative(const Matrix<complex<T>, General, ColMajor>& H,
+                          Vector<complex<T> >& mu,
+                          Matrix<complex<T>, General, ColMajor>& Y);
+
+  template<class T>
+  void GetRitzBasisNative(const Matrix<complex<T>, General, ColMajor>& Y,
+                          const Vector<complex<T> >& mu, const IVect& index,
+                          Matrix<T, General, ColMajor>& Q);
+
+  template<class T>
+  void GetRitzBasisNative(const Matrix<complex<T>, General, ColMajor>& Y,
+                          const Vector<complex<T> >& mu, const IVect& index,
+                          Matrix<complex<T>, General, ColMajor>& Q);
+
+  template<class T>
+  void OrthonormalizeColumnsNative(Matrix<T, General, ColMajor>& Q);
+
+  template<class EigenPb, class T>
+  int ComputeRayleighRitzLobpcg(NativeEigenOperator<EigenPb, T>& op,
+                                const Matrix<T, General, ColMajor>& S,
+                                const Matrix<T, General, ColMajor>& AS,
+                                const Matrix<T, General, ColMajor>& BS,
+                                int nb, Matrix<T, General, ColMajor>& C,
+                                Vector<typename ClassComplexType<T>::Treal>& mu,
+                                int& rank);
+
+  template<class T>
+  void GetGaussLegendreNative(int n, Vector<T>& x, Vector<T>& w);
+
+  template<class EigenPb, class T>
+  void ApplyContourResolventNative(EigenPb& var, const complex<T>& w,
+                                   const Matrix<T, General, ColMajor>& Y,
+                                   Matrix<T, General, ColMajor>& Q, int offset);
+
+  template<class EigenPb, class T>
+  void ApplyContourResolventNative(EigenPb& var, const complex<T>& w,
+                                   const Matrix<complex<T>, General, ColMajor>& Y,
+                                   Matrix<complex<T>, General, ColMajor>& Q,
+                                   int offset);
+
+  // main functions to find eigenvalues and eigenvectors without external library
+#ifdef SELDON_WITH_VIRTUAL
+  template<class T>
+  void FindEigenvaluesLobpcg(EigenProblem_Base<T>& var,
+                             Vector<T>& eigen_values,
+                             Vector<T>& lambda_imag,
+                             Matrix<T, General, ColMajor>& eigen_vectors);
+
+  template<class T>
+  void FindEigenvaluesLobpcg(EigenProblem_Base<T>& var,
+                             Vector<T>& eigen_values,
+                             Vector<T>& lambda_imag,
+                             Matrix<T, General, ColMajor>& eigen_vectors,
+                             Preconditioner_Base<T>& prec);
+
+  template<class T>
+  void FindEigenvaluesKrylovSchur(EigenProblem_Base<T>& var,
+                                  Vector<T>& eigen_values,
+                                  Vector<T>& lambda_imag,
+                                  Matrix<T, General, ColMajor>& eigen_vectors);
+
+  template<class T>
+  void FindEigenvaluesContour(EigenProblem_Base<T>& var,
+                              Vector<T>& eigen_values,
+                              Vector<T>& lambda_imag,
+                              Matrix<T, General, ColMajor>& eigen_vectors);
+#else
+  template<class EigenProblem, class T, class Allocator1,
+	   class Allocator2, class Allocator3>
+  void FindEigenvaluesLobpcg(EigenProblem& var,
+                             Vector<T, VectFull, Allocator1>& eigen_values,
+                             Vector<T, VectFull, Allocator2>& lambda_imag,
+                             Matrix<T, General, ColMajor, Allocator3>& eigen_vectors);
+
+  template<class EigenProblem, class T, class Allocator1,
+	   class Allocator2, class Allocator3, class Preconditioner>
+  void FindEigenvaluesLobpcg(EigenProblem& var,
+                             Vector<T, VectFull, Allocator1>& eigen_values,
+                             Vector<T, VectFull, Allocator2>& lambda_imag,
+                             Matrix<T, General, ColMajor, Allocator3>& eigen_vectors,
+                             Preconditioner& prec);
+
+  template<class EigenProblem, class T, class Allocator1,
+	   class Allocator2, class Allocator3>
+  void FindEigenvaluesKrylovSchur(EigenProblem& var,
+                                  Vector<T, VectFull, Allocator1>& eigen_values,
+                                  Vector<T, VectFull, Allocator2>& lambda_imag,
+                                  Matrix<T, General, ColMajor, Allocator3>& eigen_vectors);
+
+  template<class EigenProblem, class T, class Allocator1,
+	   class Allocator2, class Allocator3>
+  void FindEigenvaluesContour(EigenProblem& var,
+                              Vector<T, VectFull, Allocator1>& eigen_values,
+                              Vector<T, VectFull, Allocator2>& lambda_imag,
+                              Matrix<T, General, ColMajor, Allocator3>& eigen_vectors);
+#endif
+
+}
+
+#define SELDON_FILE_NATIVE_EIGENVALUE_SOLVER_HXX
+#endif
@@ -48,6 +48,10 @@ namespace Seldon
     ortho_manager = ORTHO_DGKS;
     nb_blocks = 2;
     restart_number = 20;
+    
+    emin_interval = 0;
+    emax_interval = 0;
+    nb_quadrature_points = 8;
   }
   
 
@@ -352,6 +356,22 @@ namespace Seldon
     emin_interval = l0;
     emax_interval = l1;
   }
+  
+  
+  //! returns the number of quadrature points on the contour
+  template<class T>
+  int EigenProblem_Base<T>::GetNbQuadraturePoints() const
+  {
+    return nb_quadrature_points;
+  }
+  
+  
+  //! sets the number of quadrature points on the contour
+  template<class T>
+  void EigenProblem_Base<T>::SetNbQuadraturePoints(int n)
+  {
+    nb_quadrature_points = n;
+  }
     
 
   //! indicates the use of Cholesky factorisation in order to 
@@ -2249,6 +2269,10 @@ namespace Seldon
     return FEAST;
 #endif
     
+#ifdef SELDON_WITH_LAPACK
+    return KRYLOV_SCHUR;
+#endif
+    
     return -1;
   }
   
@@ -2308,6 +2332,54 @@ namespace Seldon
 #else
         cout << "Recompile with MKL" << endl;
         abort();
+#endif
+      }
+    else if (type_solver == TypeEigenvalueSolver::LOBPCG)
+      {
+#ifdef SELDON_WITH_LAPACK
+        T zero; SetComplexZero(zero);
+        Matrix<T, General, ColMajor> eigen_old;
+        FindEigenvaluesLobpcg(var_eig, lambda, lambda_imag, eigen_old);
+        
+        // eigenvalues are sorted by ascending order
+        SortEigenvalues(lambda, lambda_imag, eigen_old,
+                        eigen_vec, var_eig.LARGE_EIGENVALUES,
+                        var_eig.GetTypeSorting(), zero, zero);
+#else
+        cout << "Recompile with Lapack" << endl;
+        abort();
+#endif
+      }
+    else if (type_solver == TypeEigenvalueSolver::KRYLOV_SCHUR)
+      {
+#ifdef SELDON_WITH_LAPACK
+        T zero; SetComplexZero(zero);
+        Matrix<T, General, ColMajor> eigen_old;
+        FindEigenvaluesKrylovSchur(var_eig, lambda, lambda_imag, eigen_old);
+        
+        // eigenvalues are sorted by ascending order
+        SortEigenvalues(lambda, lambda_imag, eigen_old,
+                        eigen_vec, var_eig.LARGE_EIGENVALUES,
+                        var_eig.GetTypeSorting(), zero, zero);
+#else
+        cout << "Recompile with Lapack" << endl;
+        abort();
+#endif
+      }
+    else if (type_solver == TypeEigenvalueSolver::CONTOUR)
+      {
+#ifdef SELDON_WITH_LAPACK
+        T zero; SetComplexZero(zero);
+        Matrix<T, General, ColMajor> eigen_old;
+        FindEigenvaluesContour(var_eig, lambda, lambda_imag, eigen_old);
+        
+        // eigenvalues are sorted by ascending order
+        SortEigenvalues(lambda, lambda_imag, eigen_old,
+                        eigen_vec, var_eig.LARGE_EIGENVALUES,
+                        var_eig.GetTypeSorting(), zero, zero);
+#else
+        cout << "Recompile with Lapack" << endl;
+        abort();
 #endif
       }
     else
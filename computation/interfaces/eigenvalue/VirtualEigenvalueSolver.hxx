@@ -155,6 +155,9 @@ namespace Seldon
     //! interval where eigenvalues are searched
     Treal emin_interval, emax_interval;
     
+    //! number of quadrature points on the contour (native contour solver)
+    int nb_quadrature_points;
+    
   public :
 
     EigenProblem_Base();
@@ -207,6 +210,9 @@ namespace Seldon
     Treal GetUpperBoundInterval() const;
 
     void SetIntervalSpectrum(Treal, Treal);
+    
+    int GetNbQuadraturePoints() const;
+    void SetNbQuadraturePoints(int);
             
     void SetCholeskyFactoForMass(bool chol = true);
     bool UseCholeskyFactoForMass() const;
@@ -541,10 +547,14 @@ namespace Seldon
  
     
   //! list of availables eigenvalue solvers
+  /*!
+    LOBPCG, KRYLOV_SCHUR and CONTOUR are native solvers (only Lapack is needed)
+    CONTOUR computes eigenvalues in the interval given by SetIntervalSpectrum
+  */
   class TypeEigenvalueSolver
   {
   public :
-    enum {DEFAULT, ARPACK, ANASAZI, FEAST};
+    enum {DEFAULT, ARPACK, ANASAZI, FEAST, LOBPCG, KRYLOV_SCHUR, CONTOUR};
     
     static int default_solver;
     
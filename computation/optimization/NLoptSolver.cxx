@@ -24,6 +24,14 @@
 
 #include "NLoptSolver.hxx"
 
+#ifndef _OPENMP
+#ifdef SELDON_WITH_CPP11
+#include <chrono>
+#elif defined(__unix__) || defined(__APPLE__)
+#include <sys/time.h>
+#endif
+#endif
+
 
 namespace Seldon
 {
@@ -32,6 +40,16 @@ namespace Seldon
   //! Default constructor.
   NLoptSolver::NLoptSolver()
   {
+    Nstart_ = 1;
+    Nsample_ = 0;
+    seed_ = 0;
+    start_radius_ = 0.1;
+    target_cost_ = -HUGE_VAL;
+    Nevaluation_ = 0;
+    target_reached_ = false;
+    start_time_ = 0.;
+    time_to_target_ = -1.;
+    optimization_time_ = 0.;
   }
 
 
@@ -162,7 +180,11 @@ namespace Seldon
   void NLoptSolver::SetLowerBound(const Vector<double>& lower_bound)
   {
     if (lower_bound.GetSize() != 0)
-      opt_.set_lower_bounds(lower_bound);
+      {
+        opt_.set_lower_bounds(lower_bound);
+        lower_bound_.Reallocate(lower_bound.GetM());
+        Copy(lower_bound, lower_bound_);
+      }
   }
 
 
@@ -173,7 +195,11 @@ namespace Seldon
   void NLoptSolver::SetUpperBound(const Vector<double>& upper_bound)
   {
     if (upper_bound.GetSize() != 0)
-      opt_.set_upper_bounds(upper_bound);
+      {
+        opt_.set_upper_bounds(upper_bound);
+        upper_bound_.Reallocate(upper_bound.GetM());
+        Copy(upper_bound, upper_bound_);
+      }
   }
 
 
@@ -320,6 +346,413 @@ namespace Seldon
   }
 
 
+  //! Sets the number of local optimizations of a multi-start optimization.
+  /*!
+    \param[in] Nstart number of local optimizations, run from different
+    starting points.
+  */
+  void NLoptSolver::SetNstart(int Nstart)
+  {
+    Nstart_ = Nstart;
+  }
+
+
+  //! Sets the number of sampled starting points.
+  /*!
+    \param[in] Nsample number of starting points sampled before the local
+    optimizations. If it is greater than the number of local optimizations,
+    the cost function is evaluated at all sampled points and the best ones
+    are selected as starting points. Otherwise, no screening is performed.
+  */
+  void NLoptSolver::SetNsample(int Nsample)
+  {
+    Nsample_ = Nsample;
+  }
+
+
+  //! Sets the seed of the random generator of the starting points.
+  /*!
+    \param[in] seed the seed. Two multi-start optimizations with the same
+    seed use the same starting points, whatever the number of threads.
+  */
+  void NLoptSolver::SetSeed(int seed)
+  {
+    seed_ = seed;
+  }
+
+
+  //! Sets the relative radius of the sampling of the starting points.
+  /*!
+    \param[in] radius relative radius. A parameter which is not bounded on
+    both sides is sampled in [x - r, x + r] where x is the initial value of
+    the parameter and r = \a radius max(|x|, 1).
+  */
+  void NLoptSolver::SetStartRadius(double radius)
+  {
+    start_radius_ = radius;
+  }
+
+
+  //! Sets the cost to be reached.
+  /*!
+    \param[in] cost target cost. The multi-start optimization is stopped as
+    soon as a cost lower than \a cost has been found, and the wall-clock time
+    needed to reach it is available with GetTimeToTarget.
+  */
+  void NLoptSolver::SetTargetCost(double cost)
+  {
+    target_cost_ = cost;
+  }
+
+
+  //! Gets the number of local optimizations of a multi-start optimization.
+  /*!
+    \param[out] Nstart number of local optimizations.
+  */
+  void NLoptSolver::GetNstart(int& Nstart) const
+  {
+    Nstart = Nstart_;
+  }
+
+
+  //! Gets the number of sampled starting points.
+  /*!
+    \param[out] Nsample number of sampled starting points.
+  */
+  void NLoptSolver::GetNsample(int& Nsample) const
+  {
+    Nsample = Nsample_;
+  }
+
+
+  //! Gets the seed of the random generator of the starting points.
+  /*!
+    \param[out] seed the seed.
+  */
+  void NLoptSolver::GetSeed(int& seed) const
+  {
+    seed = seed_;
+  }
+
+
+  //! Gets the relative radius of the sampling of the starting points.
+  /*!
+    \param[out] radius relative radius.
+  */
+  void NLoptSolver::GetStartRadius(double& radius) const
+  {
+    radius = start_radius_;
+  }
+
+
+  //! Gets the cost to be reached.
+  /*!
+    \param[out] cost target cost (-HUGE_VAL if no target has been set).
+  */
+  void NLoptSolver::GetTargetCost(double& cost) const
+  {
+    cost = target_cost_;
+  }
+
+
+  //! Multi-start optimization.
+  /*!
+    \param[in] cost pointer to the cost function (see Optimize).
+    \param[in] argument third argument of the cost function.
+    \sa OptimizeMultiStart(cost_ptr, batch_cost_ptr, void*)
+  */
+  void NLoptSolver::OptimizeMultiStart(cost_ptr cost, void* argument)
+  {
+    OptimizeMultiStart(cost, NULL, argument);
+  }
+
+
+  //! Multi-start optimization.
+  /*! Independent local optimizations are run from seeded starting points, in
+    parallel if OpenMP is enabled. The first starting point is the current
+    vector of parameters, the other ones are drawn in the bounds (or around
+    the initial parameters, see SetStartRadius). The best parameters found by
+    all optimizations are shared: on exit, GetParameter and GetCost return the
+    best point ever evaluated. If a target cost has been set, all
+    optimizations stop as soon as one of them has reached it.
+    \param[in] cost pointer to the cost function (see Optimize). It is called
+    simultaneously by several threads, and must therefore be thread-safe.
+    \param[in] batch_cost pointer to a batched cost function, or NULL. If
+    more points are sampled than local optimizations are run (see
+    SetNsample), the sampled points are evaluated with a single call to
+    \a batch_cost. The first argument of \a batch_cost is a matrix whose
+    columns are the parameter vectors, the second argument is the vector of
+    costs to be computed (already allocated), and the third argument is \a
+    argument. If \a batch_cost is NULL, the sampled points are evaluated with
+    \a cost (with an empty gradient vector).
+    \param[in] argument third argument of the cost functions.
+  */
+  void NLoptSolver::OptimizeMultiStart(cost_ptr cost,
+                                       batch_cost_ptr batch_cost,
+                                       void* argument)
+  {
+    int Nparameter;
+    if (0 == (Nparameter = parameter_.GetM()))
+      throw WrongArgument("NLoptSolver::OptimizeMultiStart()",
+                          "The vector of parameters to be optimized"
+                          " is empty.");
+
+    if (Nstart_ <= 0)
+      throw WrongArgument("NLoptSolver::OptimizeMultiStart()",
+                          "The number of starting points should be positive,"
+                          " but is equal to " + to_str(Nstart_) + ".");
+
+    start_time_ = GetWallTime();
+    Nevaluation_ = 0;
+    target_reached_ = false;
+    time_to_target_ = -1.;
+
+    Matrix<double, General, ColMajor> start;
+    GenerateStart(start);
+    cost_ = HUGE_VAL;
+
+    int Nsample = start.GetN();
+    Vector<int> index(Nsample);
+    index.Fill();
+
+    // Screening of the sampled points.
+    if (Nsample > Nstart_)
+      {
+        Vector<double> sample_cost(Nsample);
+        if (batch_cost != NULL)
+          {
+            batch_cost(start, sample_cost, argument);
+            if (int(sample_cost.GetM()) != Nsample)
+              throw WrongDim("NLoptSolver::OptimizeMultiStart()",
+                             "The batched cost function returned "
+                             + to_str(sample_cost.GetM()) + " costs instead"
+                             " of " + to_str(Nsample) + ".");
+            Vector<double> x(Nparameter);
+            for (int j = 0; j < Nsample; j++)
+              {
+                for (int i = 0; i < Nparameter; i++)
+                  x(i) = start(i, j);
+                UpdateBest(x, sample_cost(j));
+              }
+          }
+        else
+          {
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) \
+  num_threads(ParallelContext::GetNumThreads(Nsample, 1))
+#endif
+            for (int j = 0; j < Nsample; j++)
+              {
+                Vector<double> x(Nparameter), gradient;
+                for (int i = 0; i < Nparameter; i++)
+                  x(i) = start(i, j);
+                sample_cost(j) = cost(x, gradient, argument);
+                UpdateBest(x, sample_cost(j));
+              }
+          }
+
+        Sort(sample_cost, index);
+      }
+
+    // Local optimizations.
+    int Nfailure = 0;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) reduction(+:Nfailure) \
+  num_threads(ParallelContext::GetNumThreads(Nstart_, 1))
+#endif
+    for (int k = 0; k < Nstart_; k++)
+      {
+        NLoptSolver solver;
+        bool stop;
+#ifdef _OPENMP
+#pragma omp critical(NLoptSolver_best)
+#endif
+        {
+          stop = target_reached_;
+          if (!stop)
+            solver = *this;
+        }
+
+        if (stop)
+          continue;
+
+        for (int i = 0; i < Nparameter; i++)
+          solver.parameter_(i) = start(i, index(k));
+        solver.opt_.set_stopval(target_cost_);
+
+        MultiStartData data;
+        data.solver = this;
+        data.cost = cost;
+        data.argument = argument;
+        try
+          {
+            solver.Optimize(&MultiStartCost, &data);
+          }
+        catch (Error&)
+          {
+            Nfailure++;
+          }
+      }
+
+    optimization_time_ = GetWallTime() - start_time_;
+
+    if (Nfailure == Nstart_)
+      throw Error("NLoptSolver::OptimizeMultiStart()",
+                  "Nlopt failed for all starting points.");
+  }
+
+
+  //! Returns the number of cost function evaluations.
+  /*! This method should be called after a multi-start optimization.
+    \return the number of cost function evaluations, by all threads.
+  */
+  int NLoptSolver::GetNevaluation() const
+  {
+    return Nevaluation_;
+  }
+
+
+  //! Returns the wall-clock time needed to reach the target cost.
+  /*! This method should be called after a multi-start optimization.
+    \return the wall-clock time (in seconds) between the beginning of the
+    optimization and the first evaluation of a cost lower than the target
+    cost, or -1 if the target cost has not been reached.
+  */
+  double NLoptSolver::GetTimeToTarget() const
+  {
+    return time_to_target_;
+  }
+
+
+  //! Returns the wall-clock time of the last multi-start optimization.
+  /*!
+    \return the wall-clock time in seconds.
+  */
+  double NLoptSolver::GetOptimizationTime() const
+  {
+    return optimization_time_;
+  }
+
+
+  //! Generates the starting points of a multi-start optimization.
+  /*!
+    \param[out] start matrix whose columns are the starting points. The
+    first column is the current vector of parameters.
+  */
+  void NLoptSolver::GenerateStart(Matrix<double, General, ColMajor>& start)
+  {
+    int Nparameter = parameter_.GetM();
+    int Nsample = max(Nsample_, Nstart_);
+    start.Reallocate(Nparameter, Nsample);
+
+    // Minimal standard generator of Park and Miller, so that the starting
+    // points only depend on the seed.
+    int64_t state = abs(seed_) % 2147483646 + 1;
+    for (int j = 0; j < Nsample; j++)
+      for (int i = 0; i < Nparameter; i++)
+        {
+          double x = parameter_(i);
+          if (j > 0)
+            {
+              state = (state * 48271) % 2147483647;
+              double u = double(state) / 2147483647.;
+
+              bool lower = (lower_bound_.GetM() > 0)
+                && (lower_bound_(i) > -HUGE_VAL);
+              bool upper = (upper_bound_.GetM() > 0)
+                && (upper_bound_(i) < HUGE_VAL);
+              if (lower && upper)
+                x = lower_bound_(i) + u * (upper_bound_(i) - lower_bound_(i));
+              else
+                {
+                  x += start_radius_ * max(abs(x), 1.) * (2. * u - 1.);
+                  if (lower)
+                    x = max(x, lower_bound_(i));
+                  if (upper)
+                    x = min(x, upper_bound_(i));
+                }
+            }
+          start(i, j) = x;
+        }
+  }
+
+
+  //! Updates the best parameters with a new evaluation of the cost function.
+  /*!
+    \param[in] parameter the parameters vector.
+    \param[in] cost the value of the cost function for \a parameter.
+  */
+  void NLoptSolver::UpdateBest(const Vector<double>& parameter, double cost)
+  {
+#ifdef _OPENMP
+#pragma omp critical(NLoptSolver_best)
+#endif
+    {
+      Nevaluation_++;
+      if (cost < cost_)
+        {
+          cost_ = cost;
+          Copy(parameter, parameter_);
+        }
+      if (!target_reached_ && cost <= target_cost_)
+        {
+          target_reached_ = true;
+          time_to_target_ = GetWallTime() - start_time_;
+        }
+    }
+  }
+
+
+  //! Cost function of the local optimizations of a multi-start optimization.
+  /*! The cost function provided by the user is evaluated, and the best
+    parameters are updated. If the target cost has been reached by another
+    optimization, the cost function is not evaluated and -HUGE_VAL is
+    returned so that NLopt stops.
+    \param[in] parameter the parameters vector.
+    \param[out] gradient the gradient vector (empty for derivative-free
+    algorithms).
+    \param[in] data pointer to a MultiStartData object.
+    \return the value of the cost function.
+  */
+  double NLoptSolver::MultiStartCost(const Vector<double>& parameter,
+                                     Vector<double>& gradient, void* data)
+  {
+    MultiStartData& d = *reinterpret_cast<MultiStartData*>(data);
+
+    bool stop;
+#ifdef _OPENMP
+#pragma omp critical(NLoptSolver_best)
+#endif
+    stop = d.solver->target_reached_;
+
+    if (stop)
+      return -HUGE_VAL;
+
+    double cost = d.cost(parameter, gradient, d.argument);
+    d.solver->UpdateBest(parameter, cost);
+    return cost;
+  }
+
+
+  //! Returns the wall-clock time in seconds.
+  double NLoptSolver::GetWallTime()
+  {
+#ifdef _OPENMP
+    return omp_get_wtime();
+#elif defined(SELDON_WITH_CPP11)
+    // clock() measures the CPU time, not the wall-clock time
+    return std::chrono::duration<double>(std::chrono::steady_clock::now()
+                                         .time_since_epoch()).count();
+#elif defined(__unix__) || defined(__APPLE__)
+    timeval t;
+    gettimeofday(&t, NULL);
+    return double(t.tv_sec) + 1e-6 * double(t.tv_usec);
+#else
+    return double(clock()) / CLOCKS_PER_SEC;
+#endif
+  }
+
+
 } // namespace Seldon.
 
 
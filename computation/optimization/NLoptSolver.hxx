@@ -42,6 +42,18 @@ namespace Seldon
 
     typedef double (*cost_ptr)(const Vector<double>&,
                                Vector<double>&, void*);
+    /*! \brief Batched cost function: the costs of several parameter vectors
+      (columns of the matrix) are computed in one call. */
+    typedef void (*batch_cost_ptr)(const Matrix<double, General, ColMajor>&,
+                                   Vector<double>&, void*);
+
+    //! Data passed to the cost function of a multi-start optimization.
+    struct MultiStartData
+    {
+      NLoptSolver* solver;
+      cost_ptr cost;
+      void* argument;
+    };
 
     //! NLopt optimization solver.
     nlopt::SeldonOpt opt_;
@@ -65,6 +77,28 @@ namespace Seldon
     //! The value of cost function for given parameter values.
     double cost_;
 
+    //! Lower bounds on the parameters (empty if not provided).
+    Vector<double> lower_bound_;
+    //! Upper bounds on the parameters (empty if not provided).
+    Vector<double> upper_bound_;
+    //! Number of local optimizations of a multi-start optimization.
+    int Nstart_;
+    /*! \brief Number of sampled starting points, among which the best
+      \a Nstart_ points are selected. */
+    int Nsample_;
+    //! Seed of the random generator of the starting points.
+    int seed_;
+    /*! \brief Relative radius of the sampling around the initial parameters,
+      for the parameters that are not bounded. */
+    double start_radius_;
+    /*! \brief Cost to be reached: the multi-start optimization is stopped as
+      soon as a cost lower than \a target_cost_ is found. */
+    double target_cost_;
+    //! Statistics of the last multi-start optimization.
+    int Nevaluation_;
+    bool target_reached_;
+    double start_time_, time_to_target_, optimization_time_;
+
   public:
     // Constructor and destructor.
     NLoptSolver();
@@ -87,6 +121,30 @@ namespace Seldon
     void Optimize(cost_ptr cost, void* argument);
     double GetCost() const;
 
+    void SetNstart(int Nstart);
+    void SetNsample(int Nsample);
+    void SetSeed(int seed);
+    void SetStartRadius(double radius);
+    void SetTargetCost(double cost);
+    void GetNstart(int&) const;
+    void GetNsample(int&) const;
+    void GetSeed(int&) const;
+    void GetStartRadius(double&) const;
+    void GetTargetCost(double&) const;
+    void OptimizeMultiStart(cost_ptr cost, void* argument);
+    void OptimizeMultiStart(cost_ptr cost, batch_cost_ptr batch_cost,
+                            void* argument);
+    int GetNevaluation() const;
+    double GetTimeToTarget() const;
+    double GetOptimizationTime() const;
+
+  protected:
+    void GenerateStart(Matrix<double, General, ColMajor>& start);
+    void UpdateBest(const Vector<double>& parameter, double cost);
+    static double MultiStartCost(const Vector<double>& parameter,
+                                 Vector<double>& gradient, void* data);
+    static double GetWallTime();
+
   };
 
 
@@ -409,16 +409,22 @@ namespace Seldon
 	MatrixMumps<T>& mat_mumps =
 	  dynamic_cast<MatrixMumps<T>& >(*this->solver);
 	
-	GetSchurMatrix(mat_direct, this->mat_mumps, num, mat_schur);
+	GetSchurMatrix(mat_direct, mat_mumps, num, mat_schur);
 #else
 	cout<<"Recompile Montjoie with Mumps."
 	    << " Schur complement can't be performed otherwise"<<endl;
 	abort();
 #endif
       }
+    else if (this->type_solver == this->SELDON_SUPERNODAL)
+      {
+        // partial factorisation with the native supernodal solver
+        this->GetSchurMatrix(mat_direct, num, mat_schur);
+      }
     else
       {
-        cout << "Try to use Mumps, not implemented with other solvers " <<endl;
+        cout << "Try to use Mumps or SELDON_SUPERNODAL, not implemented"
+             << " with other solvers " << endl;
         abort();
       }
   }
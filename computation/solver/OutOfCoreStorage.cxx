@@ -0,0 +1,179 @@
+// Copyright (C) 2016 INRIA
+//
+// This file is part of the linear-algebra library Seldon,
+// http://seldon.sourceforge.net/.
+//
+// Seldon is free software; you can redistribute it and/or modify it under the
+// terms of the GNU Lesser General Public License as published by the Free
+// Software Foundation; either version 2.1 of the License, or (at your option)
+// any later version.
+//
+// Seldon is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for
+// more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with Seldon. If not, see http://www.gnu.org/licenses/.
+
+
+#ifndef SELDON_FILE_COMPUTATION_OUT_OF_CORE_STORAGE_CXX
+
+#include "OutOfCoreStorage.hxx"
+
+namespace Seldon
+{
+
+  //! creates a new file able to contain nb_records records
+  /*!
+    The previous file (if any) is removed. The new file is created in the
+    directory given by SetDirectory, with a name that is not already used.
+   */
+  template<class T>
+  void OutOfCoreStorage<T>::Open(size_t nb_records)
+  {
+    Close();
+
+    string prefix = directory + "/seldon_ooc_"
+      + to_str(reinterpret_cast<size_t>(this)) + "_"
+      + to_str(time(NULL)) + "_";
+
+    string name;
+    bool exist = true;
+    for (int num = 0; exist; num++)
+      {
+        name = prefix + to_str(num) + ".bin";
+        ifstream test(name.c_str());
+        exist = test.good();
+        test.close();
+      }
+
+    file_stream.open(name.c_str(), fstream::in | fstream::out
+                     | fstream::binary | fstream::trunc);
+
+    if (!file_stream.is_open())
+      throw IOError("OutOfCoreStorage::Open(size_t)",
+                    "Unable to create the file \"" + name + "\".");
+
+    file_name = name;
+    offset.Reallocate(nb_records);
+    offset.Fill(-1);
+    length.Reallocate(nb_records);
+    length.Fill(0);
+    file_length = 0;
+  }
+
+
+  //! closes and removes the file
+  template<class T>
+  void OutOfCoreStorage<T>::Close()
+  {
+    if (!IsOpen())
+      return;
+
+    file_stream.close();
+    file_stream.clear();
+    remove(file_name.c_str());
+    file_name.clear();
+    offset.Clear();
+    length.Clear();
+    file_length = 0;
+  }
+
+
+  //! writes the array data (of size nb) as the record i
+  /*!
+    If the record i has already been written with the same size, it is
+    overwritten, otherwise data is appended to the file.
+   */
+  template<class T>
+  void OutOfCoreStorage<T>::Write(size_t i, const T* data, int64_t nb)
+  {
+    if (!IsOpen())
+      throw IOError("OutOfCoreStorage::Write(size_t, const T*, int64_t)",
+                    "No file has been opened.");
+
+    if (i >= offset.GetM())
+      throw WrongIndex("OutOfCoreStorage::Write(size_t, const T*, int64_t)",
+                       "Record " + to_str(i) + " is out of range [0, "
+                       + to_str(offset.GetM()) + "[.");
+
+    double t0 = GetWallTime();
+    if ((offset(i) < 0) || (length(i) != nb))
+      {
+        offset(i) = file_length;
+        length(i) = nb;
+        file_length += nb;
+      }
+
+    int64_t nb_bytes = nb * int64_t(sizeof(T));
+    file_stream.seekp(offset(i) * int64_t(sizeof(T)));
+    file_stream.write(reinterpret_cast<const char*>(data), nb_bytes);
+    if (!file_stream.good())
+      throw IOError("OutOfCoreStorage::Write(size_t, const T*, int64_t)",
+                    "Unable to write " + to_str(nb_bytes) + " bytes in \""
+                    + file_name + "\".");
+
+    nb_bytes_written += nb_bytes;
+    time_write += GetWallTime() - t0;
+  }
+
+
+  //! reads the record i in the array data
+  /*!
+    data must be able to contain GetRecordSize(i) elements.
+   */
+  template<class T>
+  void OutOfCoreStorage<T>::Read(size_t i, T* data)
+  {
+    if (!IsStored(i))
+      throw WrongArgument("OutOfCoreStorage::Read(size_t, T*)",
+                          "Record " + to_str(i) + " has not been written.");
+
+    double t0 = GetWallTime();
+    int64_t nb_bytes = length(i) * int64_t(sizeof(T));
+    file_stream.seekg(offset(i) * int64_t(sizeof(T)));
+    file_stream.read(reinterpret_cast<char*>(data), nb_bytes);
+    if (!file_stream.good())
+      throw IOError("OutOfCoreStorage::Read(size_t, T*)",
+                    "Unable to read " + to_str(nb_bytes) + " bytes in \""
+                    + file_name + "\".");
+
+    nb_bytes_read += nb_bytes;
+    time_read += GetWallTime() - t0;
+  }
+
+
+  //! writes the values of a dense matrix as the record i
+  template<class T> template<class Storage, class Allocator>
+  void OutOfCoreStorage<T>
+  ::Write(size_t i, const Matrix<T, General, Storage, Allocator>& A)
+  {
+    Write(i, A.GetData(), A.GetDataSize());
+  }
+
+
+  //! reads the record i in a dense matrix
+  /*!
+    The matrix must have been allocated with the dimensions of the matrix
+    which has been written.
+   */
+  template<class T> template<class Storage, class Allocator>
+  void OutOfCoreStorage<T>
+  ::Read(size_t i, Matrix<T, General, Storage, Allocator>& A)
+  {
+    if (int64_t(A.GetDataSize()) != GetRecordSize(i))
+      throw WrongDim("OutOfCoreStorage::Read(size_t, Matrix&)",
+                     "The matrix contains " + to_str(A.GetDataSize())
+                     + " elements while the record " + to_str(i)
+                     + " contains " + to_str(GetRecordSize(i))
+                     + " elements.");
+
+    Read(i, A.GetData());
+  }
+
+}  // namespace Seldon.
+
+
+#define SELDON_FILE_COMPUTATION_OUT_OF_CORE_STORAGE_CXX
+#endif
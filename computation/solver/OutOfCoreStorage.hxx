@@ -0,0 +1,98 @@
+// Copyright (C) 2016 INRIA
+//
+// This file is part of the linear-algebra library Seldon,
+// http://seldon.sourceforge.net/.
+//
+// Seldon is free software; you can redistribute it and/or modify it under the
+// terms of the GNU Lesser General Public License as published by the Free
+// Software Foundation; either version 2.1 of the License, or (at your option)
+// any later version.
+//
+// Seldon is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for
+// more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with Seldon. If not, see http://www.gnu.org/licenses/.
+
+
+#ifndef SELDON_FILE_COMPUTATION_OUT_OF_CORE_STORAGE_HXX
+
+namespace Seldon
+{
+
+  //! Storage of arrays in a binary file (out-of-core)
+  /*!
+    Arrays (records) are identified by their number, they are appended to
+    a temporary file created in a given directory, and can be read back in
+    any order. The file is removed when Close is called (or when the object
+    is destroyed). The number of bytes written and read, and the time spent
+    in these operations are counted in order to report the bandwidth.
+  */
+  template<class T>
+  class OutOfCoreStorage
+  {
+  protected :
+    //! directory where the file is created
+    string directory;
+    //! name of the file (empty if no file is opened)
+    string file_name;
+    //! binary file
+    fstream file_stream;
+    //! position of each record in the file (-1 if not stored)
+    Vector<int64_t> offset;
+    //! number of elements of each record
+    Vector<int64_t> length;
+    //! number of elements stored in the file
+    int64_t file_length;
+    //! statistics
+    int64_t nb_bytes_written, nb_bytes_read;
+    double time_write, time_read;
+
+  public :
+    OutOfCoreStorage();
+    ~OutOfCoreStorage();
+
+    const string& GetDirectory() const;
+    void SetDirectory(const string& dir);
+    const string& GetFileName() const;
+
+    bool IsOpen() const;
+    bool IsStored(size_t i) const;
+    size_t GetNbRecords() const;
+    int64_t GetRecordSize(size_t i) const;
+    int64_t GetFileSize() const;
+
+    int64_t GetNbBytesWritten() const;
+    int64_t GetNbBytesRead() const;
+    double GetWriteTime() const;
+    double GetReadTime() const;
+    void ResetStatistics();
+
+    void Open(size_t nb_records);
+    void Close();
+
+    void Write(size_t i, const T* data, int64_t nb);
+    void Read(size_t i, T* data);
+
+    template<class Storage, class Allocator>
+    void Write(size_t i, const Matrix<T, General, Storage, Allocator>& A);
+
+    template<class Storage, class Allocator>
+    void Read(size_t i, Matrix<T, General, Storage, Allocator>& A);
+
+    static double GetWallTime();
+
+  private :
+    // the file cannot be shared between two objects
+    OutOfCoreStorage(const OutOfCoreStorage<T>&);
+    OutOfCoreStorage<T>& operator=(const OutOfCoreStorage<T>&);
+
+  };
+
+}  // namespace Seldon.
+
+
+#define SELDON_FILE_COMPUTATION_OUT_OF_CORE_STORAGE_HXX
+#endif
@@ -0,0 +1,170 @@
+// Copyright (C) 2016 INRIA
+//
+// This file is part of the linear-algebra library Seldon,
+// http://seldon.sourceforge.net/.
+//
+// Seldon is free software; you can redistribute it and/or modify it under the
+// terms of the GNU Lesser General Public License as published by the Free
+// Software Foundation; either version 2.1 of the License, or (at your option)
+// any later version.
+//
+// Seldon is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for
+// more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with Seldon. If not, see http://www.gnu.org/licenses/.
+
+
+#ifndef SELDON_FILE_COMPUTATION_OUT_OF_CORE_STORAGE_INLINE_CXX
+
+#include "OutOfCoreStorage.hxx"
+
+namespace Seldon
+{
+
+  //! default constructor
+  template<class T>
+  inline OutOfCoreStorage<T>::OutOfCoreStorage()
+  {
+    directory = ".";
+    file_length = 0;
+    ResetStatistics();
+  }
+
+
+  //! destructor (the file is removed)
+  template<class T>
+  inline OutOfCoreStorage<T>::~OutOfCoreStorage()
+  {
+    Close();
+  }
+
+
+  //! returns the directory where the file is created
+  template<class T>
+  inline const string& OutOfCoreStorage<T>::GetDirectory() const
+  {
+    return directory;
+  }
+
+
+  //! sets the directory where the file is created
+  /*!
+    The directory is used by the next call to Open.
+   */
+  template<class T>
+  inline void OutOfCoreStorage<T>::SetDirectory(const string& dir)
+  {
+    directory = dir;
+  }
+
+
+  //! returns the name of the opened file
+  template<class T>
+  inline const string& OutOfCoreStorage<T>::GetFileName() const
+  {
+    return file_name;
+  }
+
+
+  //! returns true if a file is opened
+  template<class T>
+  inline bool OutOfCoreStorage<T>::IsOpen() const
+  {
+    return !file_name.empty();
+  }
+
+
+  //! returns true if the record i has been written in the file
+  template<class T>
+  inline bool OutOfCoreStorage<T>::IsStored(size_t i) const
+  {
+    return (i < offset.GetM()) && (offset(i) >= 0);
+  }
+
+
+  //! returns the number of records
+  template<class T>
+  inline size_t OutOfCoreStorage<T>::GetNbRecords() const
+  {
+    return offset.GetM();
+  }
+
+
+  //! returns the number of elements of the record i
+  template<class T>
+  inline int64_t OutOfCoreStorage<T>::GetRecordSize(size_t i) const
+  {
+    return length(i);
+  }
+
+
+  //! returns the size of the file in bytes
+  template<class T>
+  inline int64_t OutOfCoreStorage<T>::GetFileSize() const
+  {
+    return file_length * int64_t(sizeof(T));
+  }
+
+
+  //! returns the number of bytes written since the last reset
+  template<class T>
+  inline int64_t OutOfCoreStorage<T>::GetNbBytesWritten() const
+  {
+    return nb_bytes_written;
+  }
+
+
+  //! returns the number of bytes read since the last reset
+  template<class T>
+  inline int64_t OutOfCoreStorage<T>::GetNbBytesRead() const
+  {
+    return nb_bytes_read;
+  }
+
+
+  //! returns the time (in seconds) spent in writing since the last reset
+  template<class T>
+  inline double OutOfCoreStorage<T>::GetWriteTime() const
+  {
+    return time_write;
+  }
+
+
+  //! returns the time (in seconds) spent in reading since the last reset
+  template<class T>
+  inline double OutOfCoreStorage<T>::GetReadTime() const
+  {
+    return time_read;
+  }
+
+
+  //! resets the counters of bytes and time
+  template<class T>
+  inline void OutOfCoreStorage<T>::ResetStatistics()
+  {
+    nb_bytes_written = 0;
+    nb_bytes_read = 0;
+    time_write = 0;
+    time_read = 0;
+  }
+
+
+  //! returns the wall-clock time in seconds
+  template<class T>
+  inline double OutOfCoreStorage<T>::GetWallTime()
+  {
+#ifdef _OPENMP
+    return omp_get_wtime();
+#else
+    return double(clock()) / CLOCKS_PER_SEC;
+#endif
+  }
+
+}  // namespace Seldon.
+
+
+#define SELDON_FILE_COMPUTATION_OUT_OF_CORE_STORAGE_INLINE_CXX
+#endif
@@ -37,8 +37,14 @@ namespace Seldon
     int n = A.GetN();
     T t, s, fact;
     int j_col, jrow, index_lu, jpos;    
-    Vector<T> Row_Val(n);
-    IVect Index(n), Row_Ind(n);
+    Vector<T> Row_Val;
+    IVect Index, Row_Ind;
+
+    // work arrays are taken from the memory pool
+    Workspace work;
+    work.GetVector(n, Row_Val);
+    work.GetVector(n, Index);
+    work.GetVector(n, Row_Ind);
     Row_Val.Fill(0);
     Row_Ind.Fill(-1);
     
@@ -505,6 +511,8 @@ namespace Seldon
 	  solver->Clear();
 
         mat_sym.Clear();
+        forward_levels.Clear();
+        backward_levels.Clear();
       }    
   }
     
@@ -531,6 +539,8 @@ namespace Seldon
   {
     int64_t taille = mat_sym.GetMemorySize();
     taille += xtmp.GetMemorySize();
+    taille += forward_levels.GetMemorySize()
+      + backward_levels.GetMemorySize();
     if (solver != NULL)
       taille += solver->GetMemorySize();
 
@@ -660,6 +670,13 @@ namespace Seldon
         
 	GetCholesky(mat_sym, print_level);
         xtmp.Reallocate(n);
+
+        // schedules of the triangular solves
+        forward_levels.Init(mat_sym, TriangularLevelSet::UPPER_PART, true,
+                            TriangularLevelSet::DIVIDE_DIAGONAL);
+
+        backward_levels.Init(mat_sym, TriangularLevelSet::UPPER_PART, false,
+                             TriangularLevelSet::DIVIDE_DIAGONAL);
       }
   }
    
@@ -694,22 +711,82 @@ namespace Seldon
 #endif
       }
     else
+      SolveFactors(TransA, x_solution.GetData(), 1);
+  }
+
+
+  //! Solves L X = B or L^T X = B, B being overwritten by X.
+  template<class T> template<class T1, class Allocator1>
+  void SparseCholeskySolver<T>
+  ::Solve(const SeldonTranspose& TransA,
+          Matrix<T1, General, ColMajor, Allocator1>& x)
+  {
+    if (type_solver == SELDON_SOLVER)
       {
-	if (TransA.NoTrans())
+        if (x.GetM() != n)
+          throw WrongDim("SparseCholeskySolver::Solve",
+                         "The matrix has " + to_str(x.GetM()) + " rows "
+                         + "while the system is of size " + to_str(n) + ".");
+
+        SolveFactors(TransA, x.GetData(), x.GetN());
+      }
+    else
+      {
+        Vector<T1> xcol;
+        for (int k = 0; k < x.GetN(); k++)
           {
-            for (int i = 0; i < x_solution.GetM(); i++)
-              xtmp(permutation(i)) = x_solution(i);
-            
-            SolveCholesky(TransA, mat_sym, xtmp);
-            Copy(xtmp, x_solution);
+            xcol.SetData(x.GetM(), &x.GetData()[k*x.GetM()]);
+            Solve(TransA, xcol);
+            xcol.Nullify();
+          }
+      }
+  }
+
+
+  //! Solves L x = b or L^T x = b with the factors stored in mat_sym.
+  /*!
+    The level-set schedules computed after the factorisation are used, so
+    that the unknowns of a same level are computed in parallel if OpenMP
+    is enabled.
+   */
+  template<class T> template<class T1>
+  void SparseCholeskySolver<T>
+  ::SolveFactors(const SeldonTranspose& TransA, T1* x_ptr, int nrhs)
+  {
+    if (nrhs <= 0)
+      return;
+
+    // right hand sides are interleaved by blocks
+    int nb_block = min(nrhs, int(TriangularLevelSet::RHS_BLOCK_SIZE));
+    Vector<T1> y(n*nb_block);
+    for (int k0 = 0; k0 < nrhs; k0 += nb_block)
+      {
+        int nb = min(nb_block, nrhs - k0);
+        for (int k = 0; k < nb; k++)
+          {
+            T1* x = &x_ptr[(k0+k)*n];
+            if (TransA.NoTrans())
+              for (int i = 0; i < n; i++)
+                y(permutation(i)*nb + k) = x[i];
+            else
+              for (int i = 0; i < n; i++)
+                y(i*nb + k) = x[i];
           }
+
+        if (TransA.NoTrans())
+          forward_levels.SolveInterleaved(mat_sym, y.GetData(), nb);
         else
-          {	
-            Copy(x_solution, xtmp);
-            SolveCholesky(TransA, mat_sym, xtmp);
-            
-            for (int i = 0; i < x_solution.GetM(); i++)
-              x_solution(i) = xtmp(permutation(i));
+          backward_levels.SolveInterleaved(mat_sym, y.GetData(), nb);
+
+        for (int k = 0; k < nb; k++)
+          {
+            T1* x = &x_ptr[(k0+k)*n];
+            if (TransA.NoTrans())
+              for (int i = 0; i < n; i++)
+                x[i] = y(i*nb + k);
+            else
+              for (int i = 0; i < n; i++)
+                x[i] = y(permutation(i)*nb + k);
           }
       }
   }
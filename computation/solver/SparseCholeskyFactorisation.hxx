@@ -44,6 +44,11 @@ namespace Seldon
     Vector<T> xtmp;
     //! extern Cholesky solver
     VirtualSparseDirectSolver<T>* solver;
+    //! Level-set schedules for L x = b and L^T x = b.
+    TriangularLevelSet forward_levels, backward_levels;
+
+    template<class T1>
+    void SolveFactors(const SeldonTranspose& TransA, T1* x_ptr, int nrhs);
     
   public :
     // Available solvers.
@@ -77,6 +82,10 @@ namespace Seldon
     template<class T1>
     void Solve(const SeldonTranspose& TransA, Vector<T1>& x);
 
+    template<class T1, class Allocator1>
+    void Solve(const SeldonTranspose& TransA,
+               Matrix<T1, General, ColMajor, Allocator1>& x);
+
     template<class T1>
     void Mlt(const SeldonTranspose& TransA, Vector<T1>& x);
     
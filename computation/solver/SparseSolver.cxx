@@ -108,6 +108,34 @@ namespace Seldon
   void VirtualSparseDirectSolver<T>::SetNumberOfThreadPerNode(int n)
   {
   }
+
+
+  //! Enables writing of the factors on the disk (if available)
+  template<class T>
+  void VirtualSparseDirectSolver<T>::EnableOutOfCore()
+  {
+  }
+
+
+  //! Factors are kept in memory
+  template<class T>
+  void VirtualSparseDirectSolver<T>::DisableOutOfCore()
+  {
+  }
+
+
+  //! Sets the directory where the factors are written (out-of-core)
+  template<class T>
+  void VirtualSparseDirectSolver<T>::SetOutOfCoreDirectory(const string&)
+  {
+  }
+
+
+  //! Sets the memory for the factors kept in memory (out-of-core)
+  template<class T>
+  void VirtualSparseDirectSolver<T>::SetOutOfCoreMemoryBudget(int64_t)
+  {
+  }
    
   
 #ifdef SELDON_WITH_MPI
@@ -167,6 +195,7 @@ namespace Seldon
   {
     int64_t taille = mat_sym.GetMemorySize() + mat_unsym.GetMemorySize();
     taille += permutation_row.GetMemorySize() + permutation_col.GetMemorySize();
+    taille += level_set.GetMemorySize();
     return taille;
   }
   
@@ -184,6 +213,8 @@ namespace Seldon
 		  Matrix<T0, General, Storage0, Allocator0>& mat,
 		  bool keep_matrix)
   {
+    SELDON_PROFILE("SparseSeldonSolver::Factorize");
+
     IVect inv_permutation;
 
     // We convert matrix to unsymmetric format.
@@ -229,6 +260,7 @@ namespace Seldon
     symmetric_matrix = false;
     inv_permutation.Fill();
     GetLU(mat_unsym, permutation_col, inv_permutation, permtol, print_level);
+    level_set.Init(mat_unsym);
 
     // Combining permutations.
     IVect itmp = permutation_col;
@@ -253,6 +285,8 @@ namespace Seldon
 		  Matrix<T0, Symmetric, Storage0, Allocator0>& mat,
 		  bool keep_matrix)
   {
+    SELDON_PROFILE("SparseSeldonSolver::Factorize");
+
     IVect inv_permutation;
 
     // We convert matrix to symmetric format.
@@ -292,59 +326,247 @@ namespace Seldon
     // Factorization is performed.
     symmetric_matrix = true;
     GetLU(mat_sym, print_level);
+    level_set.Init(mat_sym);
   }
   
   
-  template<class T, class Allocator> template<class T1>
-  void SparseSeldonSolver<T, Allocator>::Solve(Vector<T1>& z)
+  //! symbolic factorisation of matrix mat
+  /*!
+    The pattern of the factors L and U is computed for the renumbered
+    matrix, without pivoting. The numerical factorisation can then be
+    performed with RefactorizeMatrix, for any matrix sharing the pattern of
+    mat.
+    \param[in] perm permutation array used to renumber the matrix
+    \param[in] mat matrix whose pattern is analyzed (values are not used)
+   */
+  template<class T, class Allocator>
+  template<class T0, class Storage0, class Allocator0>
+  void SparseSeldonSolver<T, Allocator>::
+  AnalyzeMatrix(const IVect& perm,
+                Matrix<T0, General, Storage0, Allocator0>& mat)
   {
-    Vector<T1> xtmp(z);
+    SELDON_PROFILE("SparseSeldonSolver::Analyze");
+
+    size_t n = mat.GetM();
+    if (perm.GetM() != n)
+      throw WrongArgument("AnalyzeMatrix(IVect&, Matrix&)",
+                          "Numbering array is of size "
+                          + to_str(perm.GetM())
+                          + " while the matrix is of size "
+                          + to_str(mat.GetM()) + " x "
+                          + to_str(mat.GetN()) + ".");
+
+    IVect inv_permutation(n);
+    inv_permutation.Fill(-1);
+    for (size_t i = 0; i < n; i++)
+      inv_permutation(perm(i)) = i;
+
+    for (size_t i = 0; i < n; i++)
+      if (inv_permutation(i) == -1)
+        throw WrongArgument("AnalyzeMatrix(IVect&, Matrix&)",
+                            "The numbering array is invalid.");
+
+    // No pivoting, rows and columns are renumbered in the same way.
+    permutation_row = perm;
+    permutation_col = inv_permutation;
+    symmetric_matrix = false;
+    mat_sym.Clear();
+
+    // Pattern of the matrix in CSR format.
+    General prop;
+    Vector<size_t> Ptr, Ind;
+    Vector<T0> Val;
+    ConvertToCSR(mat, prop, Ptr, Ind, Val);
+    Val.Clear();
+
+    GetSymbolicLU(Ptr, Ind, inv_permutation, perm, mat_unsym);
+    level_set.Init(mat_unsym);
+  }
+
+
+  //! symbolic factorisation of matrix mat
+  /*!
+    The pattern of the factor of the renumbered matrix is computed. The
+    numerical factorisation can then be performed with RefactorizeMatrix,
+    for any matrix sharing the pattern of mat.
+    \param[in] perm permutation array used to renumber the matrix
+    \param[in] mat matrix whose pattern is analyzed (values are not used)
+   */
+  template<class T, class Allocator>
+  template<class T0, class Storage0, class Allocator0>
+  void SparseSeldonSolver<T, Allocator>::
+  AnalyzeMatrix(const IVect& perm,
+                Matrix<T0, Symmetric, Storage0, Allocator0>& mat)
+  {
+    SELDON_PROFILE("SparseSeldonSolver::Analyze");
+
+    size_t n = mat.GetM();
+    if (perm.GetM() != n)
+      throw WrongArgument("AnalyzeMatrix(IVect&, Matrix&)",
+                          "Numbering array is of size "
+                          + to_str(perm.GetM())
+                          + " while the matrix is of size "
+                          + to_str(mat.GetM()) + " x "
+                          + to_str(mat.GetN()) + ".");
+
+    IVect inv_permutation(n);
+    inv_permutation.Fill(-1);
+    for (size_t i = 0; i < n; i++)
+      inv_permutation(perm(i)) = i;
+
+    for (size_t i = 0; i < n; i++)
+      if (inv_permutation(i) == -1)
+        throw WrongArgument("AnalyzeMatrix(IVect&, Matrix&)",
+                            "The numbering array is invalid.");
+
+    permutation_row = perm;
+    symmetric_matrix = true;
+    mat_unsym.Clear();
+
+    // Both triangles of the matrix are needed.
+    General prop;
+    Vector<size_t> Ptr, Ind;
+    Vector<T0> Val;
+    ConvertToCSR(mat, prop, Ptr, Ind, Val);
+    Val.Clear();
+
+    GetSymbolicLU(Ptr, Ind, inv_permutation, perm, mat_sym);
+    level_set.Init(mat_sym);
+  }
+
+
+  //! numerical factorisation of matrix mat
+  /*!
+    The pattern of the factors and the permutations are the ones computed
+    by the last call to AnalyzeMatrix or FactorizeMatrix, only the
+    elimination is performed. In the latter case, the column pivots found
+    during the previous factorisation are reused. The matrix mat must have
+    the same pattern as the analyzed matrix. The level-set schedules of the
+    triangular solves are not recomputed.
+    \param[inout] mat matrix to factorize
+    \param[in] keep_matrix if true the given matrix mat is kept
+   */
+  template<class T, class Allocator>
+  template<class T0, class Prop0, class Storage0, class Allocator0>
+  void SparseSeldonSolver<T, Allocator>::
+  RefactorizeMatrix(Matrix<T0, Prop0, Storage0, Allocator0>& mat,
+                    bool keep_matrix)
+  {
+    SELDON_PROFILE("SparseSeldonSolver::Factorize");
+
+    size_t n = permutation_row.GetM();
+    if ((n == 0) || (mat.GetM() != n))
+      throw WrongArgument("RefactorizeMatrix(Matrix&, bool)",
+                          "The matrix is of size "
+                          + to_str(mat.GetM()) + " x "
+                          + to_str(mat.GetN()) + " while the analyzed "
+                          + "pattern is of size " + to_str(n) + ".");
+
+    if (symmetric_matrix && !IsSymmetricMatrix(mat))
+      throw WrongArgument("RefactorizeMatrix(Matrix&, bool)",
+                          "The analyzed pattern is the one of a symmetric"
+                          " matrix, while the given matrix is unsymmetric.");
+
+    // Both triangles of the matrix are needed.
+    General prop;
+    Vector<size_t> Ptr, Ind;
+    Vector<T0> Val;
+    ConvertToCSR(mat, prop, Ptr, Ind, Val);
+    if (!keep_matrix)
+      mat.Clear();
+
+    // row_num(i) is the row of mat stored in the row i of the factor,
+    // col_num(j) the column of the factor where the column j of mat is.
+    IVect row_num(n), col_num(n);
+    for (size_t i = 0; i < n; i++)
+      row_num(permutation_row(i)) = i;
 
     if (symmetric_matrix)
       {
-	for (size_t i = 0; i < z.GetM(); i++)
-	  xtmp(permutation_row(i)) = z(i);
-	
-	SolveLU(mat_sym, xtmp);
-	
-	for (size_t i = 0; i < z.GetM(); i++)
-	  z(i) = xtmp(permutation_row(i));
+        col_num = permutation_row;
+        GetNumericLU(Ptr, Ind, Val, row_num, col_num, mat_sym);
       }
     else
       {
-	for (size_t i = 0; i < z.GetM(); i++)
-	  xtmp(permutation_row(i)) = z(i);
-	
-	SolveLU(mat_unsym, xtmp);
-	
-	for (size_t i = 0; i < z.GetM(); i++)
-	  z(permutation_col(i)) = xtmp(i);
+        for (size_t i = 0; i < n; i++)
+          col_num(permutation_col(i)) = i;
+
+        GetNumericLU(Ptr, Ind, Val, row_num, col_num, mat_unsym);
       }
   }
+
+
+  //! solves A x = b or A^T x = b for nrhs right hand sides
+  /*!
+    The triangular solves use the level-set schedules computed after the
+    factorisation, such that the unknowns of a same level are computed in
+    parallel if OpenMP is enabled.
+    \param[in] TransA SeldonNoTrans or SeldonTrans
+    \param[inout] x_ptr right hand sides stored column by column,
+    overwritten by the solutions
+    \param[in] nrhs number of right hand sides
+    The right hand sides are permuted by blocks of
+    TriangularLevelSet::RHS_BLOCK_SIZE columns in an interleaved array, such
+    that the factors are read once for each block.
+   */
+  template<class T, class Allocator> template<class T1>
+  void SparseSeldonSolver<T, Allocator>
+  ::SolveFactors(const SeldonTranspose& TransA, T1* x_ptr, int nrhs)
+  {
+    SELDON_PROFILE("SparseSeldonSolver::Solve");
+
+    size_t n = permutation_row.GetM();
+    if (nrhs <= 0)
+      return;
+
+    int nb_block = min(nrhs, int(TriangularLevelSet::RHS_BLOCK_SIZE));
+    Vector<T1> xtmp(n*nb_block);
+    T1* y = xtmp.GetData();
+    for (int k0 = 0; k0 < nrhs; k0 += nb_block)
+      {
+        int nb = min(nb_block, nrhs - k0);
+        for (int k = 0; k < nb; k++)
+          {
+            T1* x = &x_ptr[(k0+k)*n];
+            if (symmetric_matrix || TransA.NoTrans())
+              for (size_t i = 0; i < n; i++)
+                y[permutation_row(i)*nb + k] = x[i];
+            else
+              for (size_t i = 0; i < n; i++)
+                y[i*nb + k] = x[permutation_col(i)];
+          }
+
+        if (symmetric_matrix)
+          level_set.SolveInterleaved(SeldonNoTrans, mat_sym, y, nb);
+        else
+          level_set.SolveInterleaved(TransA, mat_unsym, y, nb);
+
+        for (int k = 0; k < nb; k++)
+          {
+            T1* x = &x_ptr[(k0+k)*n];
+            if (symmetric_matrix || TransA.Trans())
+              for (size_t i = 0; i < n; i++)
+                x[i] = y[permutation_row(i)*nb + k];
+            else
+              for (size_t i = 0; i < n; i++)
+                x[permutation_col(i)] = y[i*nb + k];
+          }
+      }
+  }
+
+
+  template<class T, class Allocator> template<class T1>
+  void SparseSeldonSolver<T, Allocator>::Solve(Vector<T1>& z)
+  {
+    SolveFactors(SeldonNoTrans, z.GetData(), 1);
+  }
   
   
   template<class T, class Allocator> template<class T1>
   void SparseSeldonSolver<T, Allocator>
   ::Solve(const SeldonTranspose& TransA, Vector<T1>& z)
   {
-    if (symmetric_matrix)
-      Solve(z);
-    else
-      {
-	Vector<T1> xtmp(z);
-	if (TransA.Trans())
-	  {
-	    for (size_t i = 0; i < z.GetM(); i++)
-	      xtmp(i) = z(permutation_col(i));
-	    
-	    SolveLU(SeldonTrans, mat_unsym, xtmp);
-	    
-	    for (size_t i = 0; i < z.GetM(); i++)
-	      z(i) = xtmp(permutation_row(i));
-	  }
-	else
-	  Solve(z);
-      }
+    SolveFactors(TransA, z.GetData(), 1);
   }
 
   
@@ -352,14 +574,23 @@ namespace Seldon
   void SparseSeldonSolver<T, Allocator>
   ::Solve(const SeldonTranspose& TransA, T* x_ptr, int nrhs)
   {
-    Vector<T> x;
-    int n = permutation_row.GetM();
-    for (int k = 0; k < nrhs; k++)
-      {
-	x.SetData(n, &x_ptr[k*n]);
-	Solve(TransA, x);
-	x.Nullify();
-      }
+    SolveFactors(TransA, x_ptr, nrhs);
+  }
+
+
+  //! solves A X = B or A^T X = B, B being overwritten by X
+  template<class T, class Allocator> template<class T1, class Allocator1>
+  void SparseSeldonSolver<T, Allocator>
+  ::Solve(const SeldonTranspose& TransA,
+          Matrix<T1, General, ColMajor, Allocator1>& x)
+  {
+    if (size_t(x.GetM()) != permutation_row.GetM())
+      throw WrongDim("SparseSeldonSolver::Solve(SeldonTranspose&, Matrix&)",
+                     "The matrix has " + to_str(x.GetM()) + " rows while "
+                     + "the system is of size "
+                     + to_str(permutation_row.GetM()) + ".");
+
+    SolveFactors(TransA, x.GetData(), x.GetN());
   }
   
   
@@ -384,8 +615,15 @@ namespace Seldon
     T czero, cone;
     SetComplexZero(czero);
     SetComplexOne(cone);
-    Vector<T, VectFull, Allocator> Row_Val(n);
-    IVect Index(n), Row_Ind(n), Index_Diag(n);
+    Vector<T, VectFull, Allocator> Row_Val;
+    IVect Index, Row_Ind, Index_Diag;
+
+    // work arrays are taken from the memory pool
+    Workspace work;
+    work.GetVector(n, Row_Val);
+    work.GetVector(n, Index);
+    work.GetVector(n, Row_Ind);
+    work.GetVector(n, Index_Diag);
     Row_Val.Fill(czero);
     Row_Ind.Fill(-1);
     Index_Diag.Fill(-1);
@@ -673,8 +911,9 @@ namespace Seldon
 	  }
 	
 	// Backward solve (with L^T).
-	for (i = n-1 ; i>=0  ; i--)
+	for (size_t i2 = n; i2 > 0; i2--)
 	  {
+	    i = i2-1;
 	    k_ = 0; k = A.Index(i, k_);
 	    while (k < i)
 	      {
@@ -735,8 +974,14 @@ namespace Seldon
     int i_row, j_col, index_lu, length;
     int i, j, k;
 
-    Vector<T, VectFull, Allocator> Row_Val(n);
-    IVect Index(n), Row_Ind(n);
+    Vector<T, VectFull, Allocator> Row_Val;
+    IVect Index, Row_Ind;
+
+    // work arrays are taken from the memory pool
+    Workspace work;
+    work.GetVector(n, Row_Val);
+    work.GetVector(n, Index);
+    work.GetVector(n, Row_Ind);
     Row_Val.Zero();
     Row_Ind.Fill(-1);
     Index.Fill(-1);
@@ -934,6 +1179,7 @@ namespace Seldon
 	  }
 
 	// Stores the inverse of the diagonal element of u.
+	A.Index(i_row, 0) = i_row;
 	A.Value(i_row,0) = one / Row_Val(i_row);
 
       } // end main loop.
@@ -1005,6 +1251,328 @@ namespace Seldon
   }
   
   
+  //! Symbolic LU factorisation without pivoting
+  /*!
+    \param[in] Ptr start index of each row of the matrix (CSR format)
+    \param[in] Ind column numbers of the non-zero entries, both triangles
+    being given for a symmetric matrix
+    \param[in] row_num row of the matrix stored in each row of the factor
+    \param[in] col_num column of the factor for each column of the matrix
+    \param[out] A pattern of the factors, with null values. For an
+    unsymmetric matrix, each row contains the L-part (sorted), the
+    diagonal and the U-part as in GetLU. For a symmetric matrix, each row
+    contains the diagonal and the U-part.
+    The fill-in is the one of GetLU with diagonal pivots.
+  */
+  template<class Tint, class Alloc1, class Alloc2,
+           class T, class Prop, class Storage, class Allocator>
+  void GetSymbolicLU(const Vector<Tint, VectFull, Alloc1>& Ptr,
+                     const Vector<Tint, VectFull, Alloc2>& Ind,
+                     const IVect& row_num, const IVect& col_num,
+                     Matrix<T, Prop, Storage, Allocator>& A)
+  {
+    size_t n = row_num.GetM();
+    bool sym = IsSymmetricMatrix(A);
+    size_t length_lower, length_upper, jrow, i, j, k;
+    T czero;
+    SetComplexZero(czero);
+
+    // Index(j) is different from -1 if column j is in the current row.
+    IVect Index, Row_Ind;
+    Workspace work;
+    work.GetVector(n, Index);
+    work.GetVector(n, Row_Ind);
+    Index.Fill(-1);
+
+    A.Clear();
+    A.Reallocate(n, n);
+    for (size_t i_row = 0; i_row < n; i_row++)
+      {
+        // Pattern of the row of the renumbered matrix.
+        length_lower = 0;
+        length_upper = 1;
+        Row_Ind(i_row) = i_row;
+        Index(i_row) = i_row;
+        i = row_num(i_row);
+        for (k = Ptr(i); k < size_t(Ptr(i+1)); k++)
+          {
+            j = col_num(Ind(k));
+            if (Index(j) != -1)
+              continue;
+
+            if (j < i_row)
+              {
+                Row_Ind(length_lower) = j;
+                Index(j) = length_lower;
+                length_lower++;
+              }
+            else
+              {
+                Row_Ind(i_row + length_upper) = j;
+                Index(j) = i_row + length_upper;
+                length_upper++;
+              }
+          }
+
+        // Previous rows are eliminated by increasing numbers.
+        for (size_t j_col = 0; j_col < length_lower; j_col++)
+          {
+            jrow = Row_Ind(j_col);
+            k = j_col;
+            for (j = j_col + 1; j < length_lower; j++)
+              if (Row_Ind(j) < jrow)
+                {
+                  jrow = Row_Ind(j);
+                  k = j;
+                }
+
+            Row_Ind(k) = Row_Ind(j_col);
+            Row_Ind(j_col) = jrow;
+
+            // Fill-in due to the U-part of row jrow.
+            for (k = 0; k < size_t(A.GetRowSize(jrow)); k++)
+              {
+                j = A.Index(jrow, k);
+                if ((j <= jrow) || (Index(j) != -1))
+                  continue;
+
+                if (j < i_row)
+                  {
+                    Row_Ind(length_lower) = j;
+                    Index(j) = length_lower;
+                    length_lower++;
+                  }
+                else
+                  {
+                    Row_Ind(i_row + length_upper) = j;
+                    Index(j) = i_row + length_upper;
+                    length_upper++;
+                  }
+              }
+          }
+
+        // Storing the pattern of the row.
+        size_t index_lu = 0;
+        if (sym)
+          A.ReallocateRow(i_row, length_upper);
+        else
+          {
+            A.ReallocateRow(i_row, length_lower + length_upper);
+            for (k = 0; k < length_lower; k++)
+              {
+                A.Index(i_row, index_lu) = Row_Ind(k);
+                A.Value(i_row, index_lu) = czero;
+                index_lu++;
+              }
+          }
+
+        for (k = i_row; k < i_row + length_upper; k++)
+          {
+            A.Index(i_row, index_lu) = Row_Ind(k);
+            A.Value(i_row, index_lu) = czero;
+            index_lu++;
+          }
+
+        for (k = 0; k < length_lower; k++)
+          Index(Row_Ind(k)) = -1;
+
+        for (k = i_row; k < i_row + length_upper; k++)
+          Index(Row_Ind(k)) = -1;
+      }
+  }
+
+
+  //! Numerical LU factorisation on a given pattern
+  /*!
+    The rows of A must contain the pattern of the factors (as computed by
+    GetSymbolicLU or by a previous call to GetLU), the values are
+    overwritten by the factorisation of the renumbered matrix. Pivots are
+    not modified, the storage is the one of GetLU.
+    \param[in] Ptr start index of each row of the matrix (CSR format)
+    \param[in] Ind column numbers of the non-zero entries
+    \param[in] Val values of the non-zero entries
+    \param[in] row_num row of the matrix stored in each row of the factor
+    \param[in] col_num column of the factor for each column of the matrix
+    \param[inout] A factors L and U
+  */
+  template<class Tint, class Alloc1, class Alloc2, class T0, class Alloc3,
+           class T, class Allocator>
+  void GetNumericLU(const Vector<Tint, VectFull, Alloc1>& Ptr,
+                    const Vector<Tint, VectFull, Alloc2>& Ind,
+                    const Vector<T0, VectFull, Alloc3>& Val,
+                    const IVect& row_num, const IVect& col_num,
+                    Matrix<T, General, ArrayRowSparse, Allocator>& A)
+  {
+    size_t n = row_num.GetM();
+    size_t i, j, k, jrow, size_row;
+    T fact, czero, cone;
+    SetComplexZero(czero);
+    SetComplexOne(cone);
+
+    // Row_Val contains the current row in dense format.
+    Vector<T, VectFull, Allocator> Row_Val;
+    IVect Index_Diag;
+    Workspace work;
+    work.GetVector(n, Row_Val);
+    work.GetVector(n, Index_Diag);
+    Row_Val.Fill(czero);
+
+    for (size_t i_row = 0; i_row < n; i_row++)
+      {
+        i = row_num(i_row);
+        for (k = Ptr(i); k < size_t(Ptr(i+1)); k++)
+          Row_Val(col_num(Ind(k))) += Val(k);
+
+        // Eliminates previous rows (L-part is sorted).
+        size_row = A.GetRowSize(i_row);
+        for (k = 0; k < size_row; k++)
+          {
+            jrow = A.Index(i_row, k);
+            if (jrow >= i_row)
+              break;
+
+            fact = Row_Val(jrow) * A.Value(jrow, Index_Diag(jrow));
+            Row_Val(jrow) = czero;
+            A.Value(i_row, k) = fact;
+            for (j = Index_Diag(jrow) + 1; j < size_t(A.GetRowSize(jrow)); j++)
+              Row_Val(A.Index(jrow, j)) -= fact * A.Value(jrow, j);
+          }
+
+        if ((k == size_row) || (A.Index(i_row, k) != i_row))
+          throw WrongArgument("GetNumericLU(Vector&, Vector&, Vector&, "
+                              "IVect&, IVect&, Matrix<ArrayRowSparse>&)",
+                              "The diagonal of row " + to_str(i_row)
+                              + " is not present in the pattern.");
+
+        if (Row_Val(i_row) == czero)
+          throw WrongArgument("GetNumericLU(Vector&, Vector&, Vector&, "
+                              "IVect&, IVect&, Matrix<ArrayRowSparse>&)",
+                              "Null pivot in row " + to_str(i_row) + ".");
+
+        // Stores inverse of diagonal element of U, then U-part.
+        Index_Diag(i_row) = k;
+        A.Value(i_row, k) = cone / Row_Val(i_row);
+        Row_Val(i_row) = czero;
+        for (k++; k < size_row; k++)
+          {
+            A.Value(i_row, k) = Row_Val(A.Index(i_row, k));
+            Row_Val(A.Index(i_row, k)) = czero;
+          }
+
+        // Remaining values are out of the pattern.
+        for (k = Ptr(i); k < size_t(Ptr(i+1)); k++)
+          if (Row_Val(col_num(Ind(k))) != czero)
+            throw WrongArgument("GetNumericLU(Vector&, Vector&, Vector&, "
+                                "IVect&, IVect&, Matrix<ArrayRowSparse>&)",
+                                "The pattern of the matrix differs from the"
+                                " pattern of the factors.");
+      }
+  }
+
+
+  //! Numerical LDLt factorisation on a given pattern
+  /*!
+    The rows of A must contain the pattern of the factor (as computed by
+    GetSymbolicLU or by a previous call to GetLU), the values are
+    overwritten by the factorisation of the renumbered matrix. The storage
+    is the one of GetLU.
+    \param[in] Ptr start index of each row of the matrix (CSR format)
+    \param[in] Ind column numbers of the non-zero entries (both triangles)
+    \param[in] Val values of the non-zero entries
+    \param[in] row_num row of the matrix stored in each row of the factor
+    \param[in] col_num column of the factor for each column of the matrix
+    \param[inout] A factor L^t and inverse of D
+  */
+  template<class Tint, class Alloc1, class Alloc2, class T0, class Alloc3,
+           class T, class Allocator>
+  void GetNumericLU(const Vector<Tint, VectFull, Alloc1>& Ptr,
+                    const Vector<Tint, VectFull, Alloc2>& Ind,
+                    const Vector<T0, VectFull, Alloc3>& Val,
+                    const IVect& row_num, const IVect& col_num,
+                    Matrix<T, Symmetric, ArrayRowSymSparse, Allocator>& A)
+  {
+    size_t n = row_num.GetM();
+    size_t i, j, k, jrow;
+    T fact, czero, cone;
+    SetComplexZero(czero);
+    SetComplexOne(cone);
+
+    // Pattern of L, obtained by transposing the pattern of L^t. Rows are
+    // sorted since the loop is performed on increasing row numbers.
+    IVect PtrL, IndL;
+    Vector<T, VectFull, Allocator> Row_Val;
+    Workspace work;
+    work.GetVector(n+1, PtrL);
+    PtrL.Zero();
+    for (i = 0; i < n; i++)
+      for (k = 1; k < size_t(A.GetRowSize(i)); k++)
+        PtrL(A.Index(i, k) + 1)++;
+
+    for (i = 0; i < n; i++)
+      PtrL(i+1) += PtrL(i);
+
+    work.GetVector(PtrL(n), IndL);
+    for (i = 0; i < n; i++)
+      for (k = 1; k < size_t(A.GetRowSize(i)); k++)
+        IndL(PtrL(A.Index(i, k))++) = i;
+
+    for (i = n; i > 0; i--)
+      PtrL(i) = PtrL(i-1);
+
+    PtrL(0) = 0;
+
+    work.GetVector(n, Row_Val);
+    Row_Val.Fill(czero);
+
+    for (size_t i_row = 0; i_row < n; i_row++)
+      {
+        i = row_num(i_row);
+        for (k = Ptr(i); k < size_t(Ptr(i+1)); k++)
+          Row_Val(col_num(Ind(k))) += Val(k);
+
+        // Eliminates previous rows, stored rows of L^t are already divided
+        // by their diagonal.
+        for (k = PtrL(i_row); k < PtrL(i_row+1); k++)
+          {
+            jrow = IndL(k);
+            fact = Row_Val(jrow);
+            Row_Val(jrow) = czero;
+            for (j = 1; j < size_t(A.GetRowSize(jrow)); j++)
+              Row_Val(A.Index(jrow, j)) -= fact * A.Value(jrow, j);
+          }
+
+        if (A.GetRowSize(i_row) == 0)
+          throw WrongArgument("GetNumericLU(Vector&, Vector&, Vector&, "
+                              "IVect&, IVect&, Matrix<ArrayRowSymSparse>&)",
+                              "The diagonal of row " + to_str(i_row)
+                              + " is not present in the pattern.");
+
+        if (Row_Val(i_row) == czero)
+          throw WrongArgument("GetNumericLU(Vector&, Vector&, Vector&, "
+                              "IVect&, IVect&, Matrix<ArrayRowSymSparse>&)",
+                              "Null pivot in row " + to_str(i_row) + ".");
+
+        // Stores the inverse of D and the row of L^t divided by D.
+        A.Value(i_row, 0) = cone / Row_Val(i_row);
+        Row_Val(i_row) = czero;
+        for (k = 1; k < size_t(A.GetRowSize(i_row)); k++)
+          {
+            A.Value(i_row, k) = Row_Val(A.Index(i_row, k))
+              * A.Value(i_row, 0);
+            Row_Val(A.Index(i_row, k)) = czero;
+          }
+
+        // Remaining values are out of the pattern.
+        for (k = Ptr(i); k < size_t(Ptr(i+1)); k++)
+          if (Row_Val(col_num(Ind(k))) != czero)
+            throw WrongArgument("GetNumericLU(Vector&, Vector&, Vector&, "
+                                "IVect&, IVect&, Matrix<ArrayRowSymSparse>&)",
+                                "The pattern of the matrix differs from the"
+                                " pattern of the factor.");
+      }
+  }
+
+
   /********************************************
    * GetLU and SolveLU for SeldonSparseSolver *
    ********************************************/
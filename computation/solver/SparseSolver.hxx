@@ -44,6 +44,11 @@ namespace Seldon
     virtual void SelectParallelOrdering(int);
     virtual void SetPermutation(const Vector<size_t>&);
     virtual void SetNumberOfThreadPerNode(int n);
+
+    virtual void EnableOutOfCore();
+    virtual void DisableOutOfCore();
+    virtual void SetOutOfCoreDirectory(const string& dir);
+    virtual void SetOutOfCoreMemoryBudget(int64_t nb_bytes);
     
 #ifdef SELDON_WITH_MPI
     virtual void 
@@ -99,7 +104,12 @@ namespace Seldon
     IVect permutation_row, permutation_col;
     //! if true the factorisation is contained in mat_sym
     bool symmetric_matrix;
+    //! Level-set schedules of the triangular solves.
+    SparseLuLevelSet level_set;
     
+    template<class T1>
+    void SolveFactors(const SeldonTranspose& TransA, T1* x_ptr, int nrhs);
+
   public :
     
     SparseSeldonSolver();
@@ -127,6 +137,18 @@ namespace Seldon
                          Matrix<T0, Symmetric, Storage0, Allocator0>& mat,
                          bool keep_matrix = false);
 
+    template<class T0, class Storage0, class Allocator0>
+    void AnalyzeMatrix(const IVect& perm,
+                       Matrix<T0, General, Storage0, Allocator0>& mat);
+
+    template<class T0, class Storage0, class Allocator0>
+    void AnalyzeMatrix(const IVect& perm,
+                       Matrix<T0, Symmetric, Storage0, Allocator0>& mat);
+
+    template<class T0, class Prop0, class Storage0, class Allocator0>
+    void RefactorizeMatrix(Matrix<T0, Prop0, Storage0, Allocator0>& mat,
+                           bool keep_matrix = false);
+
     template<class T1>
     void Solve(Vector<T1>& z);
 
@@ -134,6 +156,10 @@ namespace Seldon
     void Solve(const SeldonTranspose& TransA, Vector<T1>& z);
 
     void Solve(const SeldonTranspose&, T* x_ptr, int nrhs);
+
+    template<class T1, class Allocator1>
+    void Solve(const SeldonTranspose& TransA,
+               Matrix<T1, General, ColMajor, Allocator1>& x);
     
   };
 
@@ -142,6 +168,29 @@ namespace Seldon
 	     IVect& iperm, IVect& rperm, 
 	     const Treal& permtol, int print_level);
 
+  template<class Tint, class Alloc1, class Alloc2,
+           class T, class Prop, class Storage, class Allocator>
+  void GetSymbolicLU(const Vector<Tint, VectFull, Alloc1>& Ptr,
+                     const Vector<Tint, VectFull, Alloc2>& Ind,
+                     const IVect& row_num, const IVect& col_num,
+                     Matrix<T, Prop, Storage, Allocator>& A);
+
+  template<class Tint, class Alloc1, class Alloc2, class T0, class Alloc3,
+           class T, class Allocator>
+  void GetNumericLU(const Vector<Tint, VectFull, Alloc1>& Ptr,
+                    const Vector<Tint, VectFull, Alloc2>& Ind,
+                    const Vector<T0, VectFull, Alloc3>& Val,
+                    const IVect& row_num, const IVect& col_num,
+                    Matrix<T, General, ArrayRowSparse, Allocator>& A);
+
+  template<class Tint, class Alloc1, class Alloc2, class T0, class Alloc3,
+           class T, class Allocator>
+  void GetNumericLU(const Vector<Tint, VectFull, Alloc1>& Ptr,
+                    const Vector<Tint, VectFull, Alloc2>& Ind,
+                    const Vector<T0, VectFull, Alloc3>& Val,
+                    const IVect& row_num, const IVect& col_num,
+                    Matrix<T, Symmetric, ArrayRowSymSparse, Allocator>& A);
+
   template<class T1, class Allocator1,
 	   class T2, class Storage2, class Allocator2>
   void SolveLuVector(const Matrix<T1, General, ArrayRowSparse, Allocator1>& A,
@@ -51,6 +51,9 @@ namespace Seldon
   {
     mat_sym.Clear();
     mat_unsym.Clear();
+    permutation_row.Clear();
+    permutation_col.Clear();
+    level_set.Clear();
   }
     
   
@@ -0,0 +1,1435 @@
+// Copyright (C) 2016 INRIA
+//
+// This file is part of the linear-algebra library Seldon,
+// http://seldon.sourceforge.net/.
+//
+// Seldon is free software; you can redistribute it and/or modify it under the
+// terms of the GNU Lesser General Public License as published by the Free
+// Software Foundation; either version 2.1 of the License, or (at your option)
+// any later version.
+//
+// Seldon is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for
+// more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with Seldon. If not, see http://www.gnu.org/licenses/.
+
+
+
+#ifndef SELDON_FILE_COMPUTATION_SPARSE_SUPERNODAL_SOLVER_CXX
+
+#include "SparseSupernodalSolver.hxx"
+
+namespace Seldon
+{
+
+  //! clears the factorisation
+  template<class T>
+  void SparseSupernodalSolver<T>::Clear()
+  {
+    n = 0;
+    n_schur = 0;
+    nb_perturbed_pivots = 0;
+    permutation.Clear();
+    inv_permutation.Clear();
+    super_ptr.Clear();
+    struct_ptr.Clear();
+    struct_ind.Clear();
+    super_parent.Clear();
+    child_ptr.Clear();
+    child_ind.Clear();
+    level_ptr.Clear();
+    level_super.Clear();
+    diag_block.Clear();
+    lower_block.Clear();
+    upper_block.Clear();
+    pivot.Clear();
+    ptrA.Clear();
+    indA.Clear();
+    valA.Clear();
+    factor_file.Close();
+    incore_factor_size = 0;
+  }
+
+
+  //! returns memory used by the object in bytes
+  template<class T>
+  int64_t SparseSupernodalSolver<T>::GetMemorySize() const
+  {
+    int64_t taille = permutation.GetMemorySize()
+      + inv_permutation.GetMemorySize() + super_ptr.GetMemorySize()
+      + struct_ptr.GetMemorySize() + struct_ind.GetMemorySize()
+      + super_parent.GetMemorySize() + child_ptr.GetMemorySize()
+      + child_ind.GetMemorySize() + level_ptr.GetMemorySize()
+      + level_super.GetMemorySize() + pivot.GetMemorySize()
+      + ptrA.GetMemorySize() + indA.GetMemorySize() + valA.GetMemorySize();
+
+    for (size_t s = 0; s < diag_block.GetM(); s++)
+      taille += diag_block(s).GetMemorySize() + lower_block(s).GetMemorySize()
+        + upper_block(s).GetMemorySize();
+
+    return taille;
+  }
+
+
+  //! returns the number of entries stored in the factors L and U
+  template<class T>
+  size_t SparseSupernodalSolver<T>::GetNonZeros() const
+  {
+    size_t nnz = 0;
+    for (size_t s = 0; s < GetNbSupernodes(); s++)
+      {
+        size_t ns = super_ptr(s+1) - super_ptr(s);
+        size_t nr = struct_ptr(s+1) - struct_ptr(s);
+        nnz += ns*ns + 2*ns*nr;
+      }
+
+    return nnz;
+  }
+
+
+  //! symbolic factorisation of matrix mat
+  /*!
+    The elimination tree of the renumbered matrix is computed and
+    postordered, the columns are grouped into supernodes and the structure
+    of each frontal matrix is determined. Only the pattern of mat is used.
+    \param[in] perm permutation array used to renumber the matrix
+    \param[in] mat matrix to analyze
+    \param[in] nb_schur the last nb_schur unknowns of perm are not
+    eliminated, they form the last supernode whose frontal matrix will
+    contain the Schur complement
+   */
+  template<class T>
+  template<class T0, class Prop0, class Storage0, class Allocator0>
+  void SparseSupernodalSolver<T>::
+  AnalyzeMatrix(const IVect& perm,
+                Matrix<T0, Prop0, Storage0, Allocator0>& mat,
+                size_t nb_schur)
+  {
+    SELDON_PROFILE("SparseSupernodalSolver::Analyze");
+
+    Clear();
+    size_t m = mat.GetM();
+    if (nb_schur > m)
+      throw WrongArgument("SparseSupernodalSolver::AnalyzeMatrix",
+                          "The Schur complement cannot contain "
+                          + to_str(nb_schur) + " unknowns for a matrix of"
+                          + " size " + to_str(m) + ".");
+
+    if (perm.GetM() != m)
+      throw WrongArgument("SparseSupernodalSolver::AnalyzeMatrix",
+                          "Numbering array is of size "
+                          + to_str(perm.GetM())
+                          + " while the matrix is of size "
+                          + to_str(mat.GetM()) + " x "
+                          + to_str(mat.GetN()) + ".");
+
+    IVect iperm(m);
+    iperm.Fill(-1);
+    for (size_t i = 0; i < m; i++)
+      iperm(perm(i)) = i;
+
+    for (size_t i = 0; i < m; i++)
+      if (iperm(i) == size_t(-1))
+        throw WrongArgument("SparseSupernodalSolver::AnalyzeMatrix",
+                            "The numbering array is invalid.");
+
+    // pattern of A + A^T in CSC format
+    General prop;
+    Vector<size_t> Ptr, Ind;
+    Vector<T0> Val;
+    ConvertToCSC(mat, prop, Ptr, Ind, Val, true);
+    Val.Clear();
+
+    // elimination tree of the renumbered matrix
+    Vector<long> parent(m), ancestor(m);
+    for (size_t k = 0; k < m; k++)
+      {
+        parent(k) = -1;
+        ancestor(k) = -1;
+        size_t j = perm(k);
+        for (size_t p = Ptr(j); p < Ptr(j+1); p++)
+          {
+            long i = iperm(Ind(p));
+            while ((i != -1) && (i < long(k)))
+              {
+                long inext = ancestor(i);
+                ancestor(i) = k;
+                if (inext == -1)
+                  parent(i) = k;
+
+                i = inext;
+              }
+          }
+      }
+
+    ancestor.Clear();
+
+    // postorder of the elimination tree (depth-first search), unknowns of
+    // the Schur complement are kept at the end, their children being
+    // treated as roots
+    long m_int = m - nb_schur;
+    Vector<long> head(m), next(m), stack(m);
+    head.Fill(-1);
+    for (long j = m_int-1; j >= 0; j--)
+      if ((parent(j) != -1) && (parent(j) < m_int))
+        {
+          next(j) = head(parent(j));
+          head(parent(j)) = j;
+        }
+
+    IVect post(m);
+    size_t nb = 0;
+    for (long j = 0; j < m_int; j++)
+      if ((parent(j) == -1) || (parent(j) >= m_int))
+        {
+          long top = 0;
+          stack(0) = j;
+          while (top >= 0)
+            {
+              long p = stack(top);
+              long i = head(p);
+              if (i == -1)
+                {
+                  top--;
+                  post(nb++) = p;
+                }
+              else
+                {
+                  head(p) = next(i);
+                  stack(++top) = i;
+                }
+            }
+        }
+
+    for (size_t j = m_int; j < m; j++)
+      post(nb++) = j;
+
+    head.Clear(); next.Clear(); stack.Clear();
+
+    // final numbering (ordering combined with postorder)
+    n = m;
+    permutation.Reallocate(n);
+    inv_permutation.Reallocate(n);
+    for (size_t k = 0; k < n; k++)
+      {
+        permutation(k) = perm(post(k));
+        inv_permutation(permutation(k)) = k;
+      }
+
+    Vector<long> etree(n);
+    for (size_t k = 0; k < n; k++)
+      if (parent(post(k)) == -1)
+        etree(k) = -1;
+      else
+        etree(k) = inv_permutation(perm(parent(post(k))));
+
+    parent.Clear(); post.Clear(); iperm.Clear();
+
+    // number of entries in each column of L (with row subtrees)
+    Vector<size_t> col_count(n), nb_child(n);
+    Vector<long> mark(n);
+    col_count.Fill(1);
+    nb_child.Fill(0);
+    mark.Fill(-1);
+    for (size_t i = 0; i < n; i++)
+      {
+        mark(i) = i;
+        if (etree(i) != -1)
+          nb_child(etree(i))++;
+
+        size_t c = permutation(i);
+        for (size_t p = Ptr(c); p < Ptr(c+1); p++)
+          {
+            long j = inv_permutation(Ind(p));
+            if (j < long(i))
+              while (mark(j) != long(i))
+                {
+                  col_count(j)++;
+                  mark(j) = i;
+                  j = etree(j);
+                }
+          }
+      }
+
+    // relaxed supernodes : column j is merged with the supernode of column
+    // j-1 if j-1 is the only child of j and if the number of explicit
+    // zeros introduced in the supernode stays below 20 percent
+    Vector<size_t> col_super(n);
+    size_t nb_super = 0, first_col = 0, nb_zero = 0;
+    for (size_t j = 0; j < n; j++)
+      {
+        bool merge = false;
+        size_t new_zero = 0;
+        if (long(j) > m_int)
+          merge = true;
+        else if ((long(j) < m_int) && (j > 0) && (etree(j-1) == long(j))
+                 && (nb_child(j) == 1))
+          {
+            size_t ns = j - first_col;
+            new_zero = nb_zero + ns*(col_count(j) + 1 - col_count(j-1));
+            size_t nb_entries = (ns+1)*(ns + col_count(j));
+            if (5*new_zero <= nb_entries)
+              merge = true;
+          }
+
+        if (merge)
+          nb_zero = new_zero;
+        else
+          {
+            nb_super++;
+            first_col = j;
+            nb_zero = 0;
+          }
+
+        col_super(j) = nb_super - 1;
+      }
+
+    super_ptr.Reallocate(nb_super+1);
+    super_ptr(nb_super) = n;
+    for (long j = long(n)-1; j >= 0; j--)
+      super_ptr(col_super(j)) = j;
+
+    // assembly tree
+    super_parent.Reallocate(nb_super);
+    child_ptr.Reallocate(nb_super+1);
+    child_ptr.Fill(0);
+    for (size_t s = 0; s < nb_super; s++)
+      {
+        long j = etree(super_ptr(s+1)-1);
+        if (j == -1)
+          super_parent(s) = -1;
+        else
+          {
+            super_parent(s) = col_super(j);
+            child_ptr(col_super(j)+1)++;
+          }
+      }
+
+    for (size_t s = 0; s < nb_super; s++)
+      child_ptr(s+1) += child_ptr(s);
+
+    child_ind.Reallocate(child_ptr(nb_super));
+    Vector<size_t> nb_filled(nb_super);
+    nb_filled.Fill(0);
+    for (size_t s = 0; s < nb_super; s++)
+      if (super_parent(s) != -1)
+        {
+          size_t p = super_parent(s);
+          child_ind(child_ptr(p) + nb_filled(p)) = s;
+          nb_filled(p)++;
+        }
+
+    // structure of each supernode (rows below the diagonal block)
+    struct_ptr.Reallocate(nb_super+1);
+    struct_ptr(0) = 0;
+    for (size_t s = 0; s < nb_super; s++)
+      struct_ptr(s+1) = struct_ptr(s) + col_count(super_ptr(s+1)-1) - 1;
+
+    struct_ind.Reallocate(struct_ptr(nb_super));
+    mark.Fill(-1);
+    for (size_t s = 0; s < nb_super; s++)
+      {
+        size_t f = super_ptr(s), l = super_ptr(s+1);
+        size_t nb_row = 0, offset = struct_ptr(s);
+        for (size_t k = f; k < l; k++)
+          {
+            size_t c = permutation(k);
+            for (size_t p = Ptr(c); p < Ptr(c+1); p++)
+              {
+                size_t i = inv_permutation(Ind(p));
+                if ((i >= l) && (mark(i) != long(s)))
+                  {
+                    mark(i) = s;
+                    struct_ind(offset + nb_row++) = i;
+                  }
+              }
+          }
+
+        for (size_t p = child_ptr(s); p < child_ptr(s+1); p++)
+          {
+            size_t c = child_ind(p);
+            for (size_t q = struct_ptr(c); q < struct_ptr(c+1); q++)
+              {
+                size_t i = struct_ind(q);
+                if ((i >= l) && (mark(i) != long(s)))
+                  {
+                    mark(i) = s;
+                    struct_ind(offset + nb_row++) = i;
+                  }
+              }
+          }
+
+        if (nb_row != struct_ptr(s+1) - offset)
+          throw Undefined("SparseSupernodalSolver::AnalyzeMatrix",
+                          "Inconsistent structure of supernode "
+                          + to_str(s) + ".");
+
+        if (nb_row > 1)
+          Sort(offset, offset + nb_row - 1, struct_ind);
+      }
+
+    // levels in the assembly tree (leaves are on level 0)
+    Vector<size_t> level(nb_super);
+    level.Fill(0);
+    size_t nb_level = 0;
+    for (size_t s = 0; s < nb_super; s++)
+      {
+        nb_level = max(nb_level, level(s)+1);
+        if (super_parent(s) != -1)
+          level(super_parent(s)) = max(level(super_parent(s)), level(s)+1);
+      }
+
+    level_ptr.Reallocate(nb_level+1);
+    level_ptr.Fill(0);
+    for (size_t s = 0; s < nb_super; s++)
+      level_ptr(level(s)+1)++;
+
+    for (size_t k = 0; k < nb_level; k++)
+      level_ptr(k+1) += level_ptr(k);
+
+    level_super.Reallocate(nb_super);
+    nb_filled.Reallocate(nb_level);
+    nb_filled.Fill(0);
+    for (size_t s = 0; s < nb_super; s++)
+      {
+        size_t k = level(s);
+        level_super(level_ptr(k) + nb_filled(k)) = s;
+        nb_filled(k)++;
+      }
+
+    n_schur = nb_schur;
+    if (print_level > 0)
+      cout << "Supernodal analysis : " << nb_super << " supernodes, "
+           << nb_level << " levels, " << GetNonZeros()
+           << " entries in the factors" << endl;
+  }
+
+
+  //! numerical factorisation of matrix mat
+  /*!
+    AnalyzeMatrix must have been called before with a matrix having the
+    same pattern as mat.
+    \param[inout] mat matrix to factorize
+    \param[in] keep_matrix if true the given matrix mat is kept
+   */
+  template<class T>
+  template<class T0, class Prop0, class Storage0, class Allocator0>
+  void SparseSupernodalSolver<T>::
+  RefactorizeMatrix(Matrix<T0, Prop0, Storage0, Allocator0>& mat,
+                    bool keep_matrix)
+  {
+    SELDON_PROFILE("SparseSupernodalSolver::Factorize");
+
+    if ((n == 0) || (size_t(mat.GetM()) != n))
+      throw WrongArgument("SparseSupernodalSolver::RefactorizeMatrix",
+                          "The matrix is of size " + to_str(mat.GetM())
+                          + " while the analyzed matrix is of size "
+                          + to_str(n) + ".");
+
+    // the matrix is needed both in CSR and CSC formats
+    General prop;
+    Vector<size_t> PtrR, IndR, PtrC, IndC;
+    Vector<T0> ValR, ValC;
+    ConvertToCSR(mat, prop, PtrR, IndR, ValR);
+    ConvertToCSC(mat, prop, PtrC, IndC, ValC);
+    if (!keep_matrix)
+      mat.Clear();
+
+    // too small pivots are replaced by sqrt(epsilon) |A|
+    Treal anorm(0);
+    for (size_t i = 0; i < ValR.GetM(); i++)
+      anorm = max(anorm, Treal(abs(ValR(i))));
+
+    if (anorm == Treal(0))
+      anorm = Treal(1);
+
+    Treal eps_pivot = sqrt(numeric_limits<Treal>::epsilon()) * anorm;
+
+    size_t nb_super = GetNbSupernodes();
+    diag_block.Reallocate(nb_super);
+    lower_block.Reallocate(nb_super);
+    upper_block.Reallocate(nb_super);
+    pivot.Reallocate(n);
+
+    // factors exceeding the memory budget are written on the disk
+    incore_factor_size = 0;
+    if (out_of_core)
+      factor_file.Open(3*nb_super);
+    else
+      factor_file.Close();
+
+    factor_file.ResetStatistics();
+
+    // contribution blocks are freed once assembled in the parent front
+    VectMatrix contrib(nb_super);
+    int nb_perturbed = 0, nb_error = 0, nb_io_error = 0;
+    for (size_t k = 0; k < GetNbLevels(); k++)
+      {
+        long first = level_ptr(k), last = level_ptr(k+1);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) \
+  reduction(+:nb_perturbed, nb_error, nb_io_error) \
+  num_threads(ParallelContext::GetNumThreads(last - first, 1))
+#endif
+        for (long p = first; p < last; p++)
+          {
+            if (!FactorizeFront(level_super(p), PtrC, IndC, ValC,
+                                PtrR, IndR, ValR, eps_pivot,
+                                contrib, nb_perturbed))
+              nb_error++;
+            else if (out_of_core
+                     && (level_super(p) < GetNbEliminatedSupernodes())
+                     && !StoreFactors(level_super(p)))
+              nb_io_error++;
+          }
+
+        if ((nb_error > 0) || (nb_io_error > 0))
+          {
+            diag_block.Clear();
+            lower_block.Clear();
+            upper_block.Clear();
+            factor_file.Close();
+            if (nb_io_error > 0)
+              throw IOError("SparseSupernodalSolver::RefactorizeMatrix",
+                            "Unable to write the factors in the directory \""
+                            + factor_file.GetDirectory() + "\".");
+
+            throw WrongArgument("SparseSupernodalSolver::RefactorizeMatrix",
+                                "The pattern of the matrix differs from "
+                                "the pattern of the analyzed matrix.");
+          }
+      }
+
+    nb_perturbed_pivots = nb_perturbed;
+    if ((print_level > 0) && (nb_perturbed > 0))
+      cout << "Supernodal factorisation : " << nb_perturbed
+           << " pivots have been perturbed" << endl;
+
+    if ((print_level > 0) && out_of_core)
+      {
+        PrintOutOfCoreStatistics("factorisation",
+                                 factor_file.GetNbBytesWritten(),
+                                 factor_file.GetWriteTime());
+
+        cout << "Supernodal factorisation : "
+             << double(incore_factor_size) / 1048576.0
+             << " MB of factors kept in memory" << endl;
+      }
+
+    // matrix is kept in CSR format to compute residuals
+    if (refine_solution)
+      {
+        ptrA = PtrR;
+        indA = IndR;
+        valA.Reallocate(ValR.GetM());
+        for (size_t i = 0; i < ValR.GetM(); i++)
+          valA(i) = ValR(i);
+      }
+  }
+
+
+  //! performs LU factorisation of matrix mat
+  /*!
+    \param[in] perm permutation array used to renumber the matrix
+    \param[inout] mat matrix to factorize
+    \param[in] keep_matrix if true the given matrix mat is kept
+   */
+  template<class T>
+  template<class T0, class Prop0, class Storage0, class Allocator0>
+  void SparseSupernodalSolver<T>::
+  FactorizeMatrix(const IVect& perm,
+                  Matrix<T0, Prop0, Storage0, Allocator0>& mat,
+                  bool keep_matrix)
+  {
+    AnalyzeMatrix(perm, mat);
+    RefactorizeMatrix(mat, keep_matrix);
+  }
+
+
+  //! factorisation of the frontal matrix associated with supernode s
+  /*!
+    Entries of the matrix and contribution blocks of the children are
+    assembled, then the diagonal block is factorized, blocks L21 and U12
+    are computed, and the contribution block F22 - L21 U12 is stored in
+    contrib(s). Returns false if an entry of the matrix is outside of the
+    analyzed pattern.
+   */
+  template<class T> template<class T1>
+  bool SparseSupernodalSolver<T>::
+  FactorizeFront(size_t s, const Vector<size_t>& PtrC,
+                 const Vector<size_t>& IndC, const Vector<T1>& ValC,
+                 const Vector<size_t>& PtrR,
+                 const Vector<size_t>& IndR, const Vector<T1>& ValR,
+                 const Treal& eps_pivot, VectMatrix& contrib,
+                 int& nb_perturbed)
+  {
+    size_t f = super_ptr(s), l = super_ptr(s+1);
+    size_t ns = l - f, nr = struct_ptr(s+1) - struct_ptr(s);
+    Matrix<T, General, ColMajor>& F11 = diag_block(s);
+    Matrix<T, General, ColMajor>& F12 = upper_block(s);
+    Matrix<T, General, ColMajor>& F21 = lower_block(s);
+    Matrix<T, General, ColMajor>& F22 = contrib(s);
+    F11.Reallocate(ns, ns);
+    F12.Reallocate(ns, nr);
+    F21.Reallocate(nr, ns);
+    F22.Reallocate(nr, nr);
+    F11.Zero();
+    F12.Zero();
+    F21.Zero();
+    F22.Zero();
+
+    // entries of the matrix (columns and rows of the supernode)
+    for (size_t k = f; k < l; k++)
+      {
+        size_t c = permutation(k);
+        for (size_t p = PtrC(c); p < PtrC(c+1); p++)
+          {
+            size_t i = inv_permutation(IndC(p));
+            if (i < f)
+              continue;
+
+            if (i < l)
+              F11(i-f, k-f) += ValC(p);
+            else
+              {
+                size_t pos = GetLocalPosition(s, i);
+                if (pos == n)
+                  return false;
+
+                F21(pos-ns, k-f) += ValC(p);
+              }
+          }
+
+        for (size_t p = PtrR(c); p < PtrR(c+1); p++)
+          {
+            size_t j = inv_permutation(IndR(p));
+            if (j >= l)
+              {
+                size_t pos = GetLocalPosition(s, j);
+                if (pos == n)
+                  return false;
+
+                F12(k-f, pos-ns) += ValR(p);
+              }
+          }
+      }
+
+    // contribution blocks of the children (extend-add)
+    Vector<size_t> loc;
+    for (size_t q = child_ptr(s); q < child_ptr(s+1); q++)
+      {
+        size_t c = child_ind(q);
+        size_t nc = struct_ptr(c+1) - struct_ptr(c);
+        loc.Reallocate(nc);
+        size_t r = struct_ptr(s);
+        for (size_t a = 0; a < nc; a++)
+          {
+            size_t i = struct_ind(struct_ptr(c) + a);
+            if (i < l)
+              loc(a) = i - f;
+            else
+              {
+                while ((r < struct_ptr(s+1)) && (struct_ind(r) < i))
+                  r++;
+
+                loc(a) = ns + r - struct_ptr(s);
+              }
+          }
+
+        Matrix<T, General, ColMajor>& C = contrib(c);
+        for (size_t b = 0; b < nc; b++)
+          {
+            size_t jb = loc(b);
+            for (size_t a = 0; a < nc; a++)
+              {
+                size_t ia = loc(a);
+                if (ia < ns)
+                  {
+                    if (jb < ns)
+                      F11(ia, jb) += C(a, b);
+                    else
+                      F12(ia, jb-ns) += C(a, b);
+                  }
+                else
+                  {
+                    if (jb < ns)
+                      F21(ia-ns, jb) += C(a, b);
+                    else
+                      F22(ia-ns, jb-ns) += C(a, b);
+                  }
+              }
+          }
+
+        C.Clear();
+      }
+
+    // the front of the Schur complement is only assembled
+    if (s >= GetNbEliminatedSupernodes())
+      {
+        for (size_t k = 0; k < ns; k++)
+          pivot(f+k) = k;
+
+        return true;
+      }
+
+    // factorisation of the diagonal block with partial pivoting
+    int* ipiv = &pivot(f);
+    GetSupernodalFrontLU(F11, ipiv, pivot_threshold, eps_pivot,
+                         nb_perturbed);
+
+    // row interchanges are applied to F12
+    for (size_t k = 0; k < ns; k++)
+      if (ipiv[k] != int(k))
+        for (size_t j = 0; j < nr; j++)
+          {
+            T tmp = F12(k, j);
+            F12(k, j) = F12(ipiv[k], j);
+            F12(ipiv[k], j) = tmp;
+          }
+
+    // U12 = L11^-1 F12, L21 = F21 U11^-1, and Schur complement
+    SolveSupernodalLower(F11, F12);
+    SolveSupernodalUpper(F11, F21);
+    MltAddSupernodalUpdate(F21, F12, F22);
+
+    return true;
+  }
+
+
+  //! solution of the permuted linear system
+  /*!
+    The forward and backward substitutions are performed with the
+    factors of the renumbered matrix.
+   */
+  template<class T> template<class T1>
+  void SparseSupernodalSolver<T>::
+  SolvePermuted(const SeldonTranspose& TransA, Vector<T1>& y)
+  {
+    if (TransA.NoTrans())
+      {
+        // L y = P b, then U x = y
+        SweepSupernodes(SOLVE_L, y);
+        SweepSupernodes(SOLVE_U, y);
+      }
+    else
+      {
+        // U^T z = b, then L^T x = z and inverse row interchanges
+        SweepSupernodes(SOLVE_UT, y);
+        SweepSupernodes(SOLVE_LT, y);
+      }
+  }
+
+
+  //! forward or backward substitution over all the supernodes
+  /*!
+    Factors stored on the disk are read supernode by supernode. With
+    OpenMP, the factors of the next supernode are read by a second thread
+    while the current supernode is treated.
+   */
+  template<class T> template<class T1>
+  void SparseSupernodalSolver<T>::SweepSupernodes(int phase, Vector<T1>& y)
+  {
+    // the supernode of the Schur complement (if any) is not factorized
+    size_t nb_super = GetNbEliminatedSupernodes();
+    bool forward = (phase == SOLVE_L) || (phase == SOLVE_UT);
+    bool lower = (phase == SOLVE_L) || (phase == SOLVE_LT);
+    VectMatrix& off_block = lower ? lower_block : upper_block;
+    if (!factor_file.IsOpen())
+      {
+        for (size_t p = 0; p < nb_super; p++)
+          {
+            size_t s = forward ? p : nb_super-1-p;
+            SolveSupernode(phase, s, diag_block(s), off_block(s), y);
+          }
+
+        return;
+      }
+
+    // double buffering for the factors stored on the disk
+    VectMatrix buffer[2];
+    buffer[0].Reallocate(2);
+    buffer[1].Reallocate(2);
+    int cur = 0;
+    if ((nb_super > 0) && factor_file.IsStored(forward ? 0 : 3*(nb_super-1)))
+      LoadFactors(forward ? 0 : nb_super-1, lower, buffer[cur]);
+
+    for (size_t p = 0; p < nb_super; p++)
+      {
+        size_t s = forward ? p : nb_super-1-p;
+        long next = -1;
+        if (p+1 < nb_super)
+          {
+            next = forward ? p+1 : nb_super-2-p;
+            if (!factor_file.IsStored(3*next))
+              next = -1;
+          }
+
+        VectMatrix& block = buffer[cur];
+        VectMatrix& next_block = buffer[1-cur];
+        bool stored = factor_file.IsStored(3*s), read_error = false;
+#ifdef _OPENMP
+#pragma omp parallel sections num_threads(2) \
+  if ((next >= 0) && (ParallelContext::GetNumThreads(2, 1) > 1))
+#endif
+        {
+#ifdef _OPENMP
+#pragma omp section
+#endif
+          if (next >= 0)
+            {
+              // exceptions cannot be propagated out of a parallel region
+              try
+                {
+                  LoadFactors(next, lower, next_block);
+                }
+              catch (Error&)
+                {
+                  read_error = true;
+                }
+            }
+
+#ifdef _OPENMP
+#pragma omp section
+#endif
+          if (stored)
+            SolveSupernode(phase, s, block(0), block(1), y);
+          else
+            SolveSupernode(phase, s, diag_block(s), off_block(s), y);
+        }
+
+        if (read_error)
+          throw IOError("SparseSupernodalSolver::SweepSupernodes",
+                        "Unable to read the factors in \""
+                        + factor_file.GetFileName() + "\".");
+
+        cur = 1 - cur;
+      }
+  }
+
+
+  //! substitution for the unknowns of supernode s
+  /*!
+    \param[in] phase SOLVE_L, SOLVE_U, SOLVE_UT or SOLVE_LT
+    \param[in] s supernode number
+    \param[in] LU factorisation of the diagonal block
+    \param[in] B block L21 (for SOLVE_L and SOLVE_LT) or U12
+    \param[inout] y solution
+   */
+  template<class T> template<class T1>
+  void SparseSupernodalSolver<T>::
+  SolveSupernode(int phase, size_t s, const Matrix<T, General, ColMajor>& LU,
+                 const Matrix<T, General, ColMajor>& B, Vector<T1>& y) const
+  {
+    size_t f = super_ptr(s), ns = super_ptr(s+1) - f;
+    size_t nr = struct_ptr(s+1) - struct_ptr(s);
+    const size_t* row = struct_ind.GetData() + struct_ptr(s);
+    T1* x = &y(f);
+    if (phase == SOLVE_L)
+      {
+        for (size_t k = 0; k < ns; k++)
+          if (pivot(f+k) != int(k))
+            {
+              T1 tmp = x[k];
+              x[k] = x[pivot(f+k)];
+              x[pivot(f+k)] = tmp;
+            }
+
+        for (size_t k = 0; k < ns; k++)
+          for (size_t i = k+1; i < ns; i++)
+            x[i] -= LU(i, k) * x[k];
+
+        for (size_t k = 0; k < ns; k++)
+          for (size_t i = 0; i < nr; i++)
+            y(row[i]) -= B(i, k) * x[k];
+      }
+    else if (phase == SOLVE_U)
+      {
+        for (size_t j = 0; j < nr; j++)
+          for (size_t k = 0; k < ns; k++)
+            x[k] -= B(k, j) * y(row[j]);
+
+        for (long k = long(ns)-1; k >= 0; k--)
+          {
+            x[k] /= LU(k, k);
+            for (long i = 0; i < k; i++)
+              x[i] -= LU(i, k) * x[k];
+          }
+      }
+    else if (phase == SOLVE_UT)
+      {
+        for (size_t k = 0; k < ns; k++)
+          {
+            for (size_t i = 0; i < k; i++)
+              x[k] -= LU(i, k) * x[i];
+
+            x[k] /= LU(k, k);
+          }
+
+        for (size_t j = 0; j < nr; j++)
+          for (size_t k = 0; k < ns; k++)
+            y(row[j]) -= B(k, j) * x[k];
+      }
+    else
+      {
+        for (size_t k = 0; k < ns; k++)
+          for (size_t i = 0; i < nr; i++)
+            x[k] -= B(i, k) * y(row[i]);
+
+        for (long k = long(ns)-1; k >= 0; k--)
+          for (size_t i = k+1; i < ns; i++)
+            x[k] -= LU(i, k) * x[i];
+
+        for (long k = long(ns)-1; k >= 0; k--)
+          if (pivot(f+k) != int(k))
+            {
+              T1 tmp = x[k];
+              x[k] = x[pivot(f+k)];
+              x[pivot(f+k)] = tmp;
+            }
+      }
+  }
+
+
+  //! writes the factors of supernode s on the disk if needed
+  /*!
+    The factors are kept in memory if they fit in the memory budget,
+    otherwise they are written in the file and released. Returns false if
+    the writing failed.
+   */
+  template<class T>
+  bool SparseSupernodalSolver<T>::StoreFactors(size_t s)
+  {
+    int64_t size_block = int64_t(sizeof(T))
+      * (diag_block(s).GetDataSize() + lower_block(s).GetDataSize()
+         + upper_block(s).GetDataSize());
+
+    bool success = true;
+#ifdef _OPENMP
+#pragma omp critical(seldon_supernodal_out_of_core)
+#endif
+    {
+      if (incore_factor_size + size_block <= memory_budget)
+        incore_factor_size += size_block;
+      else
+        {
+          try
+            {
+              factor_file.Write(3*s, diag_block(s));
+              factor_file.Write(3*s+1, lower_block(s));
+              factor_file.Write(3*s+2, upper_block(s));
+            }
+          catch (Error&)
+            {
+              success = false;
+            }
+
+          diag_block(s).Clear();
+          lower_block(s).Clear();
+          upper_block(s).Clear();
+        }
+    }
+
+    return success;
+  }
+
+
+  //! reads the factors of supernode s
+  /*!
+    \param[in] s supernode number
+    \param[in] lower if true, L21 is read, otherwise U12 is read
+    \param[out] block factorisation of the diagonal block and L21 (or U12)
+   */
+  template<class T>
+  void SparseSupernodalSolver<T>::
+  LoadFactors(size_t s, bool lower, VectMatrix& block)
+  {
+    size_t ns = super_ptr(s+1) - super_ptr(s);
+    size_t nr = struct_ptr(s+1) - struct_ptr(s);
+    block(0).Reallocate(ns, ns);
+    factor_file.Read(3*s, block(0));
+    if (lower)
+      {
+        block(1).Reallocate(nr, ns);
+        factor_file.Read(3*s+1, block(1));
+      }
+    else
+      {
+        block(1).Reallocate(ns, nr);
+        factor_file.Read(3*s+2, block(1));
+      }
+  }
+
+
+  //! displays the volume of data transferred and the bandwidth
+  template<class T>
+  void SparseSupernodalSolver<T>::
+  PrintOutOfCoreStatistics(const string& step, int64_t nb_bytes,
+                           double time) const
+  {
+    double size_mb = double(nb_bytes) / 1048576.0;
+    cout << "Supernodal " << step << " : " << size_mb << " MB ";
+    if (step == "solve")
+      cout << "read from ";
+    else
+      cout << "written in ";
+
+    cout << factor_file.GetFileName() << " in " << time << " s";
+    if (time > 0)
+      cout << " (" << size_mb / time << " MB/s)";
+
+    cout << endl;
+  }
+
+
+  //! solution of A x = b, x is overwritten with the solution
+  template<class T> template<class T1>
+  void SparseSupernodalSolver<T>::Solve(Vector<T1>& z)
+  {
+    Solve(SeldonNoTrans, z);
+  }
+
+
+  //! solution of A x = b or A^T x = b, x is overwritten with the solution
+  template<class T> template<class T1>
+  void SparseSupernodalSolver<T>::
+  Solve(const SeldonTranspose& TransA, Vector<T1>& z)
+  {
+    SELDON_PROFILE("SparseSupernodalSolver::Solve");
+
+    if (n_schur > 0)
+      throw WrongArgument("SparseSupernodalSolver::Solve",
+                          "Only a partial factorisation has been performed"
+                          " (Schur complement), use CondenseRightHandSide"
+                          " and ExpandSolution.");
+
+    bool conj_trans = TransA.ConjTrans();
+    int64_t nb_bytes_read = factor_file.GetNbBytesRead();
+    double time_read = factor_file.GetReadTime();
+    Vector<T1> y(n), b;
+    if (refine_solution && (ptrA.GetM() > 0))
+      b = z;
+
+    for (size_t i = 0; i < n; i++)
+      if (conj_trans)
+        y(i) = conjugate(z(permutation(i)));
+      else
+        y(i) = z(permutation(i));
+
+    SolvePermuted(TransA, y);
+
+    for (size_t i = 0; i < n; i++)
+      if (conj_trans)
+        z(permutation(i)) = conjugate(y(i));
+      else
+        z(permutation(i)) = y(i);
+
+    // iterative refinement : r = b - A x, A dx = r, x = x + dx
+    Vector<T1> r;
+    for (int iter = 0; (iter < 2) && (b.GetM() > 0); iter++)
+      {
+        r = b;
+        for (size_t i = 0; i < n; i++)
+          for (size_t p = ptrA(i); p < ptrA(i+1); p++)
+            if (TransA.NoTrans())
+              r(i) -= valA(p) * z(indA(p));
+            else if (conj_trans)
+              r(indA(p)) -= conjugate(valA(p)) * z(i);
+            else
+              r(indA(p)) -= valA(p) * z(i);
+
+        for (size_t i = 0; i < n; i++)
+          if (conj_trans)
+            y(i) = conjugate(r(permutation(i)));
+          else
+            y(i) = r(permutation(i));
+
+        SolvePermuted(TransA, y);
+
+        for (size_t i = 0; i < n; i++)
+          if (conj_trans)
+            z(permutation(i)) += conjugate(y(i));
+          else
+            z(permutation(i)) += y(i);
+      }
+
+    if ((print_level > 0) && (factor_file.GetNbBytesRead() > nb_bytes_read))
+      PrintOutOfCoreStatistics("solve",
+                               factor_file.GetNbBytesRead() - nb_bytes_read,
+                               factor_file.GetReadTime() - time_read);
+  }
+
+
+  //! solution of A x = b or A^T x = b for nrhs right hand sides
+  template<class T>
+  void SparseSupernodalSolver<T>::
+  Solve(const SeldonTranspose& TransA, T* x_ptr, int nrhs)
+  {
+    Vector<T> x;
+    for (int k = 0; k < nrhs; k++)
+      {
+        x.SetData(n, &x_ptr[k*n]);
+        Solve(TransA, x);
+        x.Nullify();
+      }
+  }
+
+
+  //! partial factorisation of mat and computation of the Schur complement
+  /*!
+    The unknowns that are not in num are eliminated, the Schur complement
+    A22 - A21 A11^-1 A12 associated with the unknowns num is assembled from
+    the contribution blocks (computed with matrix-matrix products).
+    \param[in] perm ordering of the unknowns of mat (the unknowns num are
+    removed from perm and numbered last)
+    \param[inout] mat matrix to factorize
+    \param[in] num unknowns of the Schur complement
+    \param[out] mat_schur Schur complement, row i corresponds to num(i)
+    \param[in] keep_matrix if true the given matrix mat is kept
+   */
+  template<class T>
+  template<class T0, class Prop0, class Storage0, class Allocator0,
+           class Storage1, class Allocator1>
+  void SparseSupernodalSolver<T>::
+  GetSchurMatrix(const IVect& perm,
+                 Matrix<T0, Prop0, Storage0, Allocator0>& mat,
+                 const IVect& num,
+                 Matrix<T, General, Storage1, Allocator1>& mat_schur,
+                 bool keep_matrix)
+  {
+    size_t m = mat.GetM(), nb_schur = num.GetM();
+    if ((perm.GetM() != m) || (nb_schur > m))
+      throw WrongArgument("SparseSupernodalSolver::GetSchurMatrix",
+                          "Numbering arrays are of size "
+                          + to_str(perm.GetM()) + " and "
+                          + to_str(nb_schur) + " while the matrix is of"
+                          + " size " + to_str(m) + ".");
+
+    // unknowns of the Schur complement are numbered last
+    Vector<bool> schur_dof(m);
+    schur_dof.Fill(false);
+    for (size_t i = 0; i < nb_schur; i++)
+      {
+        if ((num(i) >= m) || schur_dof(num(i)))
+          throw WrongArgument("SparseSupernodalSolver::GetSchurMatrix",
+                              "Invalid or duplicated unknown "
+                              + to_str(num(i))
+                              + " in the Schur complement.");
+
+        schur_dof(num(i)) = true;
+      }
+
+    IVect new_perm(m);
+    size_t nb = 0;
+    for (size_t i = 0; i < m; i++)
+      if (!schur_dof(perm(i)))
+        new_perm(nb++) = perm(i);
+
+    for (size_t i = 0; i < nb_schur; i++)
+      new_perm(nb++) = num(i);
+
+    AnalyzeMatrix(new_perm, mat, nb_schur);
+    RefactorizeMatrix(mat, keep_matrix);
+    GetSchurMatrix(mat_schur);
+  }
+
+
+  //! copies the Schur complement computed by the last factorisation
+  template<class T> template<class Storage1, class Allocator1>
+  void SparseSupernodalSolver<T>::
+  GetSchurMatrix(Matrix<T, General, Storage1, Allocator1>& mat_schur) const
+  {
+    mat_schur.Reallocate(n_schur, n_schur);
+    if (n_schur == 0)
+      return;
+
+    const Matrix<T, General, ColMajor>& S = diag_block(GetNbSupernodes()-1);
+    for (size_t i = 0; i < n_schur; i++)
+      for (size_t j = 0; j < n_schur; j++)
+        mat_schur(i, j) = S(i, j);
+  }
+
+
+  //! copies the non-zero entries of the Schur complement
+  /*!
+    Entries of the frontal matrix which are outside of the pattern of the
+    Schur complement are equal to zero and are not stored.
+   */
+  template<class T> template<class Allocator1>
+  void SparseSupernodalSolver<T>::
+  GetSchurMatrix(Matrix<T, General, ArrayRowSparse, Allocator1>& mat_schur)
+    const
+  {
+    mat_schur.Reallocate(n_schur, n_schur);
+    if (n_schur == 0)
+      return;
+
+    T zero;
+    SetComplexZero(zero);
+    const Matrix<T, General, ColMajor>& S = diag_block(GetNbSupernodes()-1);
+    Vector<int> nb_entries(n_schur);
+    nb_entries.Fill(0);
+    for (size_t j = 0; j < n_schur; j++)
+      for (size_t i = 0; i < n_schur; i++)
+        if (S(i, j) != zero)
+          nb_entries(i)++;
+
+    for (size_t i = 0; i < n_schur; i++)
+      {
+        mat_schur.ReallocateRow(i, nb_entries(i));
+        int k = 0;
+        for (size_t j = 0; j < n_schur; j++)
+          if (S(i, j) != zero)
+            {
+              mat_schur.Index(i, k) = j;
+              mat_schur.Value(i, k) = S(i, j);
+              k++;
+            }
+      }
+  }
+
+
+  //! computes the right hand side of the condensed system
+  /*!
+    \param[in] b right hand side of the complete system
+    \param[out] b_schur right hand side b2 - A21 A11^-1 b1 of the system
+    S x2 = b_schur, where S is the Schur complement returned by
+    GetSchurMatrix
+   */
+  template<class T> template<class T1>
+  void SparseSupernodalSolver<T>::
+  CondenseRightHandSide(const Vector<T1>& b, Vector<T1>& b_schur)
+  {
+    if (n_schur == 0)
+      throw WrongArgument("SparseSupernodalSolver::CondenseRightHandSide",
+                          "No Schur complement has been computed.");
+
+    Vector<T1> y(n);
+    for (size_t i = 0; i < n; i++)
+      y(i) = b(permutation(i));
+
+    SweepSupernodes(SOLVE_L, y);
+
+    b_schur.Reallocate(n_schur);
+    for (size_t i = 0; i < n_schur; i++)
+      b_schur(i) = y(n - n_schur + i);
+  }
+
+
+  //! computes the solution of the complete system
+  /*!
+    \param[in] b right hand side of the complete system
+    \param[in] x_schur solution of the condensed system (unknowns num)
+    \param[out] x solution of the complete system, x1 = A11^-1 (b1 - A12 x2)
+   */
+  template<class T> template<class T1>
+  void SparseSupernodalSolver<T>::
+  ExpandSolution(const Vector<T1>& b, const Vector<T1>& x_schur,
+                 Vector<T1>& x)
+  {
+    if (n_schur == 0)
+      throw WrongArgument("SparseSupernodalSolver::ExpandSolution",
+                          "No Schur complement has been computed.");
+
+    if (x_schur.GetM() != n_schur)
+      throw WrongDim("SparseSupernodalSolver::ExpandSolution",
+                     "The solution of the condensed system is of size "
+                     + to_str(x_schur.GetM()) + " while the Schur"
+                     + " complement is of size " + to_str(n_schur) + ".");
+
+    Vector<T1> y(n);
+    for (size_t i = 0; i < n; i++)
+      y(i) = b(permutation(i));
+
+    SweepSupernodes(SOLVE_L, y);
+    for (size_t i = 0; i < n_schur; i++)
+      y(n - n_schur + i) = x_schur(i);
+
+    SweepSupernodes(SOLVE_U, y);
+
+    x.Reallocate(n);
+    for (size_t i = 0; i < n; i++)
+      x(permutation(i)) = y(i);
+  }
+
+
+  /********************************
+   * Dense kernels for the fronts *
+   ********************************/
+
+
+  //! LU factorisation of a dense block with threshold partial pivoting
+  /*!
+    \param[inout] A on input the matrix to factorize, on output its LU
+    factorisation (L has a unit diagonal which is not stored)
+    \param[out] ipiv row i has been interchanged with row ipiv[i]
+    \param[in] tol threshold for partial pivoting
+    \param[in] eps pivots whose modulus is lower than eps are replaced by eps
+    \param[inout] nb_perturbed incremented for each perturbed pivot
+   */
+  template<class T>
+  void GetSupernodalFrontLU(Matrix<T, General, ColMajor>& A, int* ipiv,
+                            const typename ClassComplexType<T>::Treal& tol,
+                            const typename ClassComplexType<T>::Treal& eps,
+                            int& nb_perturbed)
+  {
+    typedef typename ClassComplexType<T>::Treal Treal;
+    int m = A.GetM();
+    T* data = A.GetData();
+    for (int k = 0; k < m; k++)
+      {
+        T* col_k = &data[size_t(k)*m];
+
+        // largest element in column k
+        int p = k;
+        Treal amax = abs(col_k[k]);
+        for (int i = k+1; i < m; i++)
+          if (abs(col_k[i]) > amax)
+            {
+              amax = abs(col_k[i]);
+              p = i;
+            }
+
+        // the diagonal element is preferred if large enough
+        if (abs(col_k[k]) >= tol*amax)
+          p = k;
+
+        ipiv[k] = p;
+        if (p != k)
+          for (int j = 0; j < m; j++)
+            {
+              T tmp = data[size_t(j)*m + k];
+              data[size_t(j)*m + k] = data[size_t(j)*m + p];
+              data[size_t(j)*m + p] = tmp;
+            }
+
+        if (abs(col_k[k]) <= eps)
+          {
+            if (realpart(col_k[k]) < Treal(0))
+              col_k[k] = -eps;
+            else
+              col_k[k] = eps;
+
+            nb_perturbed++;
+          }
+
+        T inv_pivot = T(1) / col_k[k];
+        for (int i = k+1; i < m; i++)
+          col_k[i] *= inv_pivot;
+
+        // rank-one update of the remaining columns
+        for (int j = k+1; j < m; j++)
+          {
+            T* col_j = &data[size_t(j)*m];
+            T u = col_j[k];
+            if (u != T(0))
+              for (int i = k+1; i < m; i++)
+                col_j[i] -= col_k[i] * u;
+          }
+      }
+  }
+
+
+  //! B is replaced by L^-1 B, L being the unit lower part of LU
+  template<class T>
+  void SolveSupernodalLower(const Matrix<T, General, ColMajor>& LU,
+                            Matrix<T, General, ColMajor>& B)
+  {
+    int m = LU.GetM(), nrhs = B.GetN();
+    const T* lu = LU.GetData();
+    for (int j = 0; j < nrhs; j++)
+      {
+        T* x = &B.GetData()[size_t(j)*m];
+        for (int k = 0; k < m; k++)
+          {
+            T xk = x[k];
+            if (xk != T(0))
+              {
+                const T* col_k = &lu[size_t(k)*m];
+                for (int i = k+1; i < m; i++)
+                  x[i] -= col_k[i] * xk;
+              }
+          }
+      }
+  }
+
+
+  //! B is replaced by B U^-1, U being the upper part of LU
+  template<class T>
+  void SolveSupernodalUpper(const Matrix<T, General, ColMajor>& LU,
+                            Matrix<T, General, ColMajor>& B)
+  {
+    int m = LU.GetM(), nb = B.GetM();
+    const T* lu = LU.GetData();
+    T* b = B.GetData();
+    for (int k = 0; k < m; k++)
+      {
+        T* col_k = &b[size_t(k)*nb];
+        for (int i = 0; i < k; i++)
+          {
+            T u = lu[size_t(k)*m + i];
+            if (u != T(0))
+              {
+                const T* col_i = &b[size_t(i)*nb];
+                for (int j = 0; j < nb; j++)
+                  col_k[j] -= col_i[j] * u;
+              }
+          }
+
+        T inv_diag = T(1) / lu[size_t(k)*m + k];
+        for (int j = 0; j < nb; j++)
+          col_k[j] *= inv_diag;
+      }
+  }
+
+
+  //! C is replaced by C - L U
+  /*!
+    The product is performed by Blas (xGEMM) if Seldon is compiled with
+    Blas, otherwise with a native loop on columns (parallelized for large
+    blocks).
+   */
+  template<class T>
+  void MltAddSupernodalUpdate(const Matrix<T, General, ColMajor>& L,
+                              const Matrix<T, General, ColMajor>& U,
+                              Matrix<T, General, ColMajor>& C)
+  {
+    int m = C.GetM(), n = C.GetN(), p = L.GetN();
+    if ((m == 0) || (n == 0) || (p == 0))
+      return;
+
+#ifdef SELDON_WITH_BLAS
+    T one(1), minus_one(-1);
+    MltAddMatrix(minus_one, L, U, one, C);
+#else
+    const T* l = L.GetData();
+    const T* u = U.GetData();
+    T* c = C.GetData();
+#ifdef _OPENMP
+#pragma omp parallel for if (double(m)*n*p > 1e6) \
+  num_threads(ParallelContext::GetNumThreads(n, 1))
+#endif
+    for (int j = 0; j < n; j++)
+      {
+        T* col_j = &c[size_t(j)*m];
+        for (int k = 0; k < p; k++)
+          {
+            T ukj = u[size_t(j)*p + k];
+            if (ukj != T(0))
+              {
+                const T* col_k = &l[size_t(k)*m];
+                for (int i = 0; i < m; i++)
+                  col_j[i] -= col_k[i] * ukj;
+              }
+          }
+      }
+#endif
+  }
+
+}  // namespace Seldon.
+
+
+#define SELDON_FILE_COMPUTATION_SPARSE_SUPERNODAL_SOLVER_CXX
+#endif
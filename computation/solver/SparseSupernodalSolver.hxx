@@ -0,0 +1,256 @@
+// Copyright (C) 2016 INRIA
+//
+// This file is part of the linear-algebra library Seldon,
+// http://seldon.sourceforge.net/.
+//
+// Seldon is free software; you can redistribute it and/or modify it under the
+// terms of the GNU Lesser General Public License as published by the Free
+// Software Foundation; either version 2.1 of the License, or (at your option)
+// any later version.
+//
+// Seldon is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for
+// more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with Seldon. If not, see http://www.gnu.org/licenses/.
+
+
+
+#ifndef SELDON_FILE_COMPUTATION_SPARSE_SUPERNODAL_SOLVER_HXX
+
+namespace Seldon
+{
+
+  //! Native supernodal LU solver
+  /*!
+    The matrix is factorized with a multifrontal method based on the
+    pattern of A + A^T. Columns of the renumbered matrix are grouped into
+    supernodes (consecutive columns with the same structure in L), each
+    supernode is eliminated in a dense frontal matrix and the Schur
+    complement is computed with a matrix-matrix product. Pivots are chosen
+    with threshold partial pivoting among the rows of the diagonal block of
+    each supernode, too small pivots are perturbed. Supernodes of the same
+    level in the assembly tree are factorized in parallel with OpenMP.
+    In out-of-core mode, the factors of a supernode are written on the disk
+    as soon as the supernode is factorized, unless they fit in the memory
+    budget. During the solution, they are read back supernode by supernode,
+    the next supernode being read while the current one is treated.
+    A partial factorisation can also be performed: the last unknowns are
+    then grouped in a single root supernode which is not factorized, its
+    frontal matrix is the Schur complement A22 - A21 A11^-1 A12 assembled
+    from the contribution blocks of its children (static condensation).
+  */
+  template<class T>
+  class SparseSupernodalSolver : public VirtualSparseDirectSolver<T>
+  {
+  protected :
+    typedef typename ClassComplexType<T>::Treal Treal;
+    typedef Vector<Matrix<T, General, ColMajor>, VectFull,
+                   NewAlloc<Matrix<T, General, ColMajor> > > VectMatrix;
+
+    //! Verbosity level
+    int print_level;
+    //! Threshold for partial pivoting (between 0 and 1)
+    Treal pivot_threshold;
+    //! Number of pivots that have been perturbed
+    int nb_perturbed_pivots;
+    //! if true, the solution is refined with iterative refinement
+    bool refine_solution;
+    //! Size of the factorized matrix
+    size_t n;
+    //! number of unknowns kept in the Schur complement (last unknowns)
+    size_t n_schur;
+    //! permutation(i) is the original number of the i-th unknown
+    IVect permutation;
+    //! inverse of permutation
+    IVect inv_permutation;
+    //! first column of each supernode
+    Vector<size_t> super_ptr;
+    //! rows of L (below the diagonal block) for each supernode
+    Vector<size_t> struct_ptr, struct_ind;
+    //! parent of each supernode in the assembly tree (-1 for roots)
+    Vector<long> super_parent;
+    //! children of each supernode in the assembly tree
+    Vector<size_t> child_ptr, child_ind;
+    //! supernodes sorted by level in the assembly tree
+    Vector<size_t> level_ptr, level_super;
+    //! LU factorisation of diagonal blocks
+    VectMatrix diag_block;
+    //! blocks L21 (below the diagonal block)
+    VectMatrix lower_block;
+    //! blocks U12 (at the right of the diagonal block)
+    VectMatrix upper_block;
+    //! local row interchanges in diagonal blocks
+    Vector<int> pivot;
+    //! copy of the matrix (CSR format) for iterative refinement
+    Vector<size_t> ptrA, indA;
+    Vector<T> valA;
+    //! if true, the factors are written on the disk
+    bool out_of_core;
+    //! memory (in bytes) for the factors kept in memory (out-of-core mode)
+    int64_t memory_budget;
+    //! memory (in bytes) used by the factors kept in memory
+    int64_t incore_factor_size;
+    //! file containing the factors (records 3s, 3s+1 and 3s+2 for s)
+    OutOfCoreStorage<T> factor_file;
+
+    //! sweeps of the triangular solves
+    enum {SOLVE_L, SOLVE_U, SOLVE_UT, SOLVE_LT};
+
+  public :
+    SparseSupernodalSolver();
+
+    bool UseInteger8() const;
+    void Clear();
+
+    void HideMessages();
+    void ShowMessages();
+    int GetPrintLevel() const;
+
+    int64_t GetMemorySize() const;
+    int GetInfoFactorization() const;
+
+    double GetPivotThreshold() const;
+    void SetPivotThreshold(double);
+
+    void RefineSolution();
+    void DoNotRefineSolution();
+
+    size_t GetNbSupernodes() const;
+    size_t GetNbLevels() const;
+    size_t GetNonZeros() const;
+    int GetNbPerturbedPivots() const;
+
+    void EnableOutOfCore();
+    void DisableOutOfCore();
+    bool IsOutOfCore() const;
+    void SetOutOfCoreDirectory(const string& dir);
+    void SetOutOfCoreMemoryBudget(int64_t nb_bytes);
+    int64_t GetOutOfCoreMemoryBudget() const;
+    int64_t GetOutOfCoreBytesWritten() const;
+    int64_t GetOutOfCoreBytesRead() const;
+
+    template<class T0, class Prop0, class Storage0, class Allocator0>
+    void AnalyzeMatrix(const IVect& perm,
+                       Matrix<T0, Prop0, Storage0, Allocator0>& mat,
+                       size_t nb_schur = 0);
+
+    template<class T0, class Prop0, class Storage0, class Allocator0>
+    void RefactorizeMatrix(Matrix<T0, Prop0, Storage0, Allocator0>& mat,
+                           bool keep_matrix = false);
+
+    template<class T0, class Prop0, class Storage0, class Allocator0>
+    void FactorizeMatrix(const IVect& perm,
+                         Matrix<T0, Prop0, Storage0, Allocator0>& mat,
+                         bool keep_matrix = false);
+
+    template<class T1>
+    void Solve(Vector<T1>& z);
+
+    template<class T1>
+    void Solve(const SeldonTranspose& TransA, Vector<T1>& z);
+
+    void Solve(const SeldonTranspose&, T* x_ptr, int nrhs);
+
+    size_t GetSchurSize() const;
+
+    template<class T0, class Prop0, class Storage0, class Allocator0,
+             class Storage1, class Allocator1>
+    void GetSchurMatrix(const IVect& perm,
+                        Matrix<T0, Prop0, Storage0, Allocator0>& mat,
+                        const IVect& num,
+                        Matrix<T, General, Storage1, Allocator1>& mat_schur,
+                        bool keep_matrix = false);
+
+    template<class Storage1, class Allocator1>
+    void GetSchurMatrix(Matrix<T, General, Storage1, Allocator1>& mat_schur)
+      const;
+
+    template<class Allocator1>
+    void GetSchurMatrix(Matrix<T, General, ArrayRowSparse,
+                        Allocator1>& mat_schur) const;
+
+    template<class T1>
+    void CondenseRightHandSide(const Vector<T1>& b, Vector<T1>& b_schur);
+
+    template<class T1>
+    void ExpandSolution(const Vector<T1>& b, const Vector<T1>& x_schur,
+                        Vector<T1>& x);
+
+  protected :
+    size_t GetNbEliminatedSupernodes() const;
+
+    size_t GetLocalPosition(size_t s, size_t i) const;
+
+    template<class T1>
+    void SolvePermuted(const SeldonTranspose& TransA, Vector<T1>& y);
+
+    template<class T1>
+    void SweepSupernodes(int phase, Vector<T1>& y);
+
+    template<class T1>
+    void SolveSupernode(int phase, size_t s,
+                        const Matrix<T, General, ColMajor>& LU,
+                        const Matrix<T, General, ColMajor>& B,
+                        Vector<T1>& y) const;
+
+    bool StoreFactors(size_t s);
+    void LoadFactors(size_t s, bool lower, VectMatrix& block);
+    void PrintOutOfCoreStatistics(const string& step, int64_t nb_bytes,
+                                  double time) const;
+
+    template<class T1>
+    bool FactorizeFront(size_t s, const Vector<size_t>& PtrC,
+                        const Vector<size_t>& IndC, const Vector<T1>& ValC,
+                        const Vector<size_t>& PtrR,
+                        const Vector<size_t>& IndR, const Vector<T1>& ValR,
+                        const Treal& eps_pivot, VectMatrix& contrib,
+                        int& nb_perturbed);
+
+  };
+
+
+  template<class T>
+  void GetSupernodalFrontLU(Matrix<T, General, ColMajor>& A, int* ipiv,
+                            const typename ClassComplexType<T>::Treal& tol,
+                            const typename ClassComplexType<T>::Treal& eps,
+                            int& nb_perturbed);
+
+  template<class T>
+  void SolveSupernodalUpper(const Matrix<T, General, ColMajor>& LU,
+                            Matrix<T, General, ColMajor>& B);
+
+  template<class T>
+  void SolveSupernodalLower(const Matrix<T, General, ColMajor>& LU,
+                            Matrix<T, General, ColMajor>& B);
+
+  template<class T>
+  void MltAddSupernodalUpdate(const Matrix<T, General, ColMajor>& L,
+                              const Matrix<T, General, ColMajor>& U,
+                              Matrix<T, General, ColMajor>& C);
+
+  template<class T0, class Prop, class Storage, class Allocator, class T>
+  void GetLU(Matrix<T0, Prop, Storage, Allocator>& A,
+	     SparseSupernodalSolver<T>& mat_lu, bool keep_matrix = false);
+
+  template<class T0, class Prop, class Storage, class Allocator, class T>
+  void GetLU(Matrix<T0, Prop, Storage, Allocator>& A,
+	     SparseSupernodalSolver<T>& mat_lu,
+	     IVect& permut, bool keep_matrix = false);
+
+  template<class T, class T1, class Allocator>
+  void SolveLU(SparseSupernodalSolver<T>& mat_lu,
+	       Vector<T1, VectFull, Allocator>& x);
+
+  template<class T, class T1, class Allocator>
+  void SolveLU(const SeldonTranspose& TransA,
+	       SparseSupernodalSolver<T>& mat_lu,
+	       Vector<T1, VectFull, Allocator>& x);
+
+}  // namespace Seldon.
+
+
+#define SELDON_FILE_COMPUTATION_SPARSE_SUPERNODAL_SOLVER_HXX
+#endif
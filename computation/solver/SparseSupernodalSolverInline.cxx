@@ -0,0 +1,324 @@
+// Copyright (C) 2016 INRIA
+//
+// This file is part of the linear-algebra library Seldon,
+// http://seldon.sourceforge.net/.
+//
+// Seldon is free software; you can redistribute it and/or modify it under the
+// terms of the GNU Lesser General Public License as published by the Free
+// Software Foundation; either version 2.1 of the License, or (at your option)
+// any later version.
+//
+// Seldon is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for
+// more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with Seldon. If not, see http://www.gnu.org/licenses/.
+
+
+
+#ifndef SELDON_FILE_COMPUTATION_SPARSE_SUPERNODAL_SOLVER_INLINE_CXX
+
+#include "SparseSupernodalSolver.hxx"
+
+namespace Seldon
+{
+
+  //! default constructor
+  template<class T>
+  inline SparseSupernodalSolver<T>::SparseSupernodalSolver()
+  {
+    print_level = -1;
+    pivot_threshold = 0.1;
+    nb_perturbed_pivots = 0;
+    refine_solution = false;
+    n = 0;
+    n_schur = 0;
+    out_of_core = false;
+    memory_budget = 0;
+    incore_factor_size = 0;
+  }
+
+
+  template<class T>
+  inline bool SparseSupernodalSolver<T>::UseInteger8() const
+  {
+    return false;
+  }
+
+
+  template<class T>
+  inline void SparseSupernodalSolver<T>::HideMessages()
+  {
+    print_level = -1;
+  }
+
+
+  template<class T>
+  inline void SparseSupernodalSolver<T>::ShowMessages()
+  {
+    print_level = 1;
+  }
+
+
+  template<class T>
+  inline int SparseSupernodalSolver<T>::GetPrintLevel() const
+  {
+    return print_level;
+  }
+
+
+  //! returns 0 (the factorisation does not fail, small pivots are perturbed)
+  template<class T>
+  inline int SparseSupernodalSolver<T>::GetInfoFactorization() const
+  {
+    return 0;
+  }
+
+
+  //! returns the threshold used for partial pivoting
+  template<class T>
+  inline double SparseSupernodalSolver<T>::GetPivotThreshold() const
+  {
+    return pivot_threshold;
+  }
+
+
+  //! modifies the threshold used for partial pivoting
+  /*!
+    A diagonal element is kept as pivot if its modulus is greater than
+    tol times the largest modulus in the column (restricted to the
+    diagonal block of the supernode). tol = 1 corresponds to partial
+    pivoting, tol = 0 to a factorisation without pivoting.
+   */
+  template<class T>
+  inline void SparseSupernodalSolver<T>::SetPivotThreshold(double tol)
+  {
+    pivot_threshold = tol;
+  }
+
+
+  //! the solution is improved with two steps of iterative refinement
+  /*!
+    A copy of the matrix is kept for the computation of residuals.
+   */
+  template<class T>
+  inline void SparseSupernodalSolver<T>::RefineSolution()
+  {
+    refine_solution = true;
+  }
+
+
+  //! no iterative refinement is performed
+  template<class T>
+  inline void SparseSupernodalSolver<T>::DoNotRefineSolution()
+  {
+    refine_solution = false;
+    ptrA.Clear();
+    indA.Clear();
+    valA.Clear();
+  }
+
+
+  //! returns the number of supernodes
+  template<class T>
+  inline size_t SparseSupernodalSolver<T>::GetNbSupernodes() const
+  {
+    if (super_ptr.GetM() == 0)
+      return 0;
+
+    return super_ptr.GetM() - 1;
+  }
+
+
+  //! returns the number of levels in the assembly tree
+  template<class T>
+  inline size_t SparseSupernodalSolver<T>::GetNbLevels() const
+  {
+    if (level_ptr.GetM() == 0)
+      return 0;
+
+    return level_ptr.GetM() - 1;
+  }
+
+
+  //! returns the number of unknowns kept in the Schur complement
+  /*!
+    It is equal to 0 if the matrix has been completely factorized.
+   */
+  template<class T>
+  inline size_t SparseSupernodalSolver<T>::GetSchurSize() const
+  {
+    return n_schur;
+  }
+
+
+  //! returns the number of supernodes which are factorized
+  /*!
+    The last supernode is not factorized if a Schur complement is computed.
+   */
+  template<class T>
+  inline size_t SparseSupernodalSolver<T>::GetNbEliminatedSupernodes() const
+  {
+    if ((n_schur > 0) && (GetNbSupernodes() > 0))
+      return GetNbSupernodes() - 1;
+
+    return GetNbSupernodes();
+  }
+
+
+  //! returns the number of pivots that have been perturbed
+  template<class T>
+  inline int SparseSupernodalSolver<T>::GetNbPerturbedPivots() const
+  {
+    return nb_perturbed_pivots;
+  }
+
+
+  //! the factors will be written on the disk during the next factorisation
+  template<class T>
+  inline void SparseSupernodalSolver<T>::EnableOutOfCore()
+  {
+    out_of_core = true;
+  }
+
+
+  //! the factors will be kept in memory during the next factorisation
+  template<class T>
+  inline void SparseSupernodalSolver<T>::DisableOutOfCore()
+  {
+    out_of_core = false;
+  }
+
+
+  //! returns true if the out-of-core mode is enabled
+  template<class T>
+  inline bool SparseSupernodalSolver<T>::IsOutOfCore() const
+  {
+    return out_of_core;
+  }
+
+
+  //! sets the directory where the factors are written
+  template<class T>
+  inline void SparseSupernodalSolver<T>::
+  SetOutOfCoreDirectory(const string& dir)
+  {
+    factor_file.SetDirectory(dir);
+  }
+
+
+  //! sets the memory (in bytes) for the factors kept in memory
+  /*!
+    In out-of-core mode, the factors of a supernode are kept in memory as
+    long as the total size of the factors in memory does not exceed
+    nb_bytes. The other factors are written on the disk. The default value
+    is 0 (all the factors are written). Frontal matrices and contribution
+    blocks are not counted.
+   */
+  template<class T>
+  inline void SparseSupernodalSolver<T>::
+  SetOutOfCoreMemoryBudget(int64_t nb_bytes)
+  {
+    memory_budget = nb_bytes;
+  }
+
+
+  //! returns the memory (in bytes) for the factors kept in memory
+  template<class T>
+  inline int64_t SparseSupernodalSolver<T>::GetOutOfCoreMemoryBudget() const
+  {
+    return memory_budget;
+  }
+
+
+  //! returns the number of bytes written during the last factorisation
+  template<class T>
+  inline int64_t SparseSupernodalSolver<T>::GetOutOfCoreBytesWritten() const
+  {
+    return factor_file.GetNbBytesWritten();
+  }
+
+
+  //! returns the number of bytes read since the last factorisation
+  template<class T>
+  inline int64_t SparseSupernodalSolver<T>::GetOutOfCoreBytesRead() const
+  {
+    return factor_file.GetNbBytesRead();
+  }
+
+
+  //! returns the local position of row i in the frontal matrix of s
+  /*!
+    i must be a row of the frontal matrix, located after the diagonal
+    block. n is returned if i is not found.
+   */
+  template<class T>
+  inline size_t SparseSupernodalSolver<T>::
+  GetLocalPosition(size_t s, size_t i) const
+  {
+    size_t first = struct_ptr(s), last = struct_ptr(s+1);
+    while (first < last)
+      {
+        size_t mid = (first + last) / 2;
+        if (struct_ind(mid) < i)
+          first = mid + 1;
+        else
+          last = mid;
+      }
+
+    if ((first == struct_ptr(s+1)) || (struct_ind(first) != i))
+      return n;
+
+    return super_ptr(s+1) - super_ptr(s) + first - struct_ptr(s);
+  }
+
+
+  /************************
+   * GetLU and SolveLU    *
+   ************************/
+
+
+  //! LU factorisation with natural ordering
+  template<class T0, class Prop, class Storage, class Allocator, class T>
+  inline void GetLU(Matrix<T0, Prop, Storage, Allocator>& A,
+                    SparseSupernodalSolver<T>& mat_lu, bool keep_matrix)
+  {
+    IVect perm(A.GetM());
+    perm.Fill();
+    mat_lu.FactorizeMatrix(perm, A, keep_matrix);
+  }
+
+
+  //! LU factorisation with a given ordering
+  template<class T0, class Prop, class Storage, class Allocator, class T>
+  inline void GetLU(Matrix<T0, Prop, Storage, Allocator>& A,
+                    SparseSupernodalSolver<T>& mat_lu,
+                    IVect& permut, bool keep_matrix)
+  {
+    mat_lu.FactorizeMatrix(permut, A, keep_matrix);
+  }
+
+
+  template<class T, class T1, class Allocator>
+  inline void SolveLU(SparseSupernodalSolver<T>& mat_lu,
+                      Vector<T1, VectFull, Allocator>& x)
+  {
+    mat_lu.Solve(x);
+  }
+
+
+  template<class T, class T1, class Allocator>
+  inline void SolveLU(const SeldonTranspose& TransA,
+                      SparseSupernodalSolver<T>& mat_lu,
+                      Vector<T1, VectFull, Allocator>& x)
+  {
+    mat_lu.Solve(TransA, x);
+  }
+
+}  // namespace Seldon.
+
+
+#define SELDON_FILE_COMPUTATION_SPARSE_SUPERNODAL_SOLVER_INLINE_CXX
+#endif
@@ -0,0 +1,507 @@
+// Copyright (C) 2016 INRIA
+//
+// This file is part of the linear-algebra library Seldon,
+// http://seldon.sourceforge.net/.
+//
+// Seldon is free software; you can redistribute it and/or modify it under the
+// terms of the GNU Lesser General Public License as published by the Free
+// Software Foundation; either version 2.1 of the License, or (at your option)
+// any later version.
+//
+// Seldon is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for
+// more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with Seldon. If not, see http://www.gnu.org/licenses/.
+
+
+#ifndef SELDON_FILE_COMPUTATION_TRIANGULAR_LEVEL_SET_CXX
+
+#include "TriangularLevelSet.hxx"
+
+namespace Seldon
+{
+
+  /**********************
+   * TriangularLevelSet *
+   **********************/
+
+
+  //! computes the levels of a triangular part of A
+  /*!
+    \param[in] A sparse matrix whose rows are sorted (ArrayRowSparse or
+    ArrayRowSymSparse), only its pattern is used
+    \param[in] part LOWER_PART (strictly lower part of A) or UPPER_PART
+    (strictly upper part of A)
+    \param[in] trans if true, the transpose of the triangular part is solved
+    \param[in] diag treatment of the diagonal (UNIT_DIAGONAL, DIVIDE_DIAGONAL
+    or MULTIPLY_DIAGONAL)
+  */
+  template<class MatrixSparse>
+  void TriangularLevelSet::Init(const MatrixSparse& A,
+                                int part, bool trans, int diag)
+  {
+    Clear();
+    n = A.GetM();
+    type_part = part;
+    type_diagonal = diag;
+    transpose = trans;
+
+    // position of the diagonal and of the triangular part in each row
+    diag_pos.Reallocate(n);
+    row_beg.Reallocate(n);
+    row_end.Reallocate(n);
+    for (size_t i = 0; i < n; i++)
+      {
+        size_t size_row = A.GetRowSize(i);
+        size_t k = 0;
+        while ((k < size_row) && (A.Index(i, k) < i))
+          k++;
+
+        size_t k_upper = k;
+        diag_pos(i) = size_row;
+        if ((k < size_row) && (A.Index(i, k) == i))
+          {
+            diag_pos(i) = k;
+            k_upper++;
+          }
+        else if (diag != UNIT_DIAGONAL)
+          throw WrongArgument("TriangularLevelSet::Init",
+                              "No diagonal coefficient in row "
+                              + to_str(i) + ".");
+
+        if (part == LOWER_PART)
+          {
+            row_beg(i) = 0;
+            row_end(i) = k;
+          }
+        else
+          {
+            row_beg(i) = k_upper;
+            row_end(i) = size_row;
+          }
+      }
+
+    if (transpose)
+      {
+        // the transposed pattern is stored, pos_trans(k) being the
+        // position of the value in the row ind_trans(k) of A
+        ptr_trans.Reallocate(n+1);
+        ptr_trans.Zero();
+        for (size_t i = 0; i < n; i++)
+          for (size_t k = row_beg(i); k < row_end(i); k++)
+            ptr_trans(A.Index(i, k) + 1)++;
+
+        for (size_t i = 0; i < n; i++)
+          ptr_trans(i+1) += ptr_trans(i);
+
+        ind_trans.Reallocate(ptr_trans(n));
+        pos_trans.Reallocate(ptr_trans(n));
+        Vector<size_t> ptr_cur(n);
+        for (size_t i = 0; i < n; i++)
+          ptr_cur(i) = ptr_trans(i);
+
+        for (size_t i = 0; i < n; i++)
+          for (size_t k = row_beg(i); k < row_end(i); k++)
+            {
+              size_t j = A.Index(i, k);
+              ind_trans(ptr_cur(j)) = i;
+              pos_trans(ptr_cur(j)) = k;
+              ptr_cur(j)++;
+            }
+      }
+
+    // an unknown is in the level following the ones of its dependencies
+    bool forward = ((part == LOWER_PART) != transpose);
+    Vector<size_t> level(n);
+    size_t nb_levels = 0;
+    for (size_t p = 0; p < n; p++)
+      {
+        size_t i = forward ? p : n-1-p;
+        size_t lev = 0;
+        if (transpose)
+          {
+            for (size_t k = ptr_trans(i); k < ptr_trans(i+1); k++)
+              lev = max(lev, level(ind_trans(k)) + 1);
+          }
+        else
+          {
+            for (size_t k = row_beg(i); k < row_end(i); k++)
+              lev = max(lev, level(A.Index(i, k)) + 1);
+          }
+
+        level(i) = lev;
+        nb_levels = max(nb_levels, lev + 1);
+      }
+
+    // unknowns are sorted by levels
+    level_ptr.Reallocate(nb_levels+1);
+    level_ptr.Zero();
+    for (size_t i = 0; i < n; i++)
+      level_ptr(level(i) + 1)++;
+
+    for (size_t l = 0; l < nb_levels; l++)
+      level_ptr(l+1) += level_ptr(l);
+
+    num.Reallocate(n);
+    Vector<size_t> ptr_cur(nb_levels);
+    for (size_t l = 0; l < nb_levels; l++)
+      ptr_cur(l) = level_ptr(l);
+
+    for (size_t i = 0; i < n; i++)
+      num(ptr_cur(level(i))++) = i;
+
+    // threads are used only if levels contain enough unknowns
+    // to compensate the synchronisation between two levels
+    use_threads = (n >= 1024) && (n >= 32*nb_levels);
+  }
+
+
+  //! computation of the unknown i for a single right hand side
+  template<class MatrixSparse, class T1>
+  inline void TriangularLevelSet
+  ::SolveRow(const MatrixSparse& A, size_t i, T1* x) const
+  {
+    T1 val = x[i];
+    if (transpose)
+      {
+        for (size_t k = ptr_trans(i); k < ptr_trans(i+1); k++)
+          val -= A.Value(ind_trans(k), pos_trans(k)) * x[ind_trans(k)];
+      }
+    else
+      {
+        for (size_t k = row_beg(i); k < row_end(i); k++)
+          val -= A.Value(i, k) * x[A.Index(i, k)];
+      }
+
+    if (type_diagonal == DIVIDE_DIAGONAL)
+      val /= A.Value(i, diag_pos(i));
+    else if (type_diagonal == MULTIPLY_DIAGONAL)
+      val *= A.Value(i, diag_pos(i));
+
+    x[i] = val;
+  }
+
+
+  //! computation of the unknown i for nrhs interleaved right hand sides
+  /*!
+    Each value of the factor is applied to the nrhs contiguous values
+    x[j*nrhs], ..., x[j*nrhs + nrhs-1], the inner loops are vectorized by
+    the compiler.
+   */
+  template<class MatrixSparse, class T1>
+  inline void TriangularLevelSet
+  ::SolveRow(const MatrixSparse& A, size_t i, T1* x, int nrhs) const
+  {
+    // j is different from i, so that xi and xj never overlap
+    typedef typename MatrixSparse::value_type T;
+    T1* xi = &x[i*nrhs];
+    if (transpose)
+      {
+        for (size_t k = ptr_trans(i); k < ptr_trans(i+1); k++)
+          {
+            const T a = A.Value(ind_trans(k), pos_trans(k));
+            const T1* xj = &x[ind_trans(k)*nrhs];
+            for (int r = 0; r < nrhs; r++)
+              xi[r] -= a * xj[r];
+          }
+      }
+    else
+      {
+        for (size_t k = row_beg(i); k < row_end(i); k++)
+          {
+            const T a = A.Value(i, k);
+            const T1* xj = &x[A.Index(i, k)*nrhs];
+            for (int r = 0; r < nrhs; r++)
+              xi[r] -= a * xj[r];
+          }
+      }
+
+    if (type_diagonal == DIVIDE_DIAGONAL)
+      {
+        const T d = A.Value(i, diag_pos(i));
+        for (int r = 0; r < nrhs; r++)
+          xi[r] /= d;
+      }
+    else if (type_diagonal == MULTIPLY_DIAGONAL)
+      {
+        const T d = A.Value(i, diag_pos(i));
+        for (int r = 0; r < nrhs; r++)
+          xi[r] *= d;
+      }
+  }
+
+
+  //! solves the triangular system for nrhs interleaved right hand sides
+  /*!
+    \param[in] A matrix analyzed in Init (values may have changed)
+    \param[inout] x right hand sides stored row by row (x[i*nrhs + r] is
+    the component i of the right hand side r), overwritten by the solutions
+    \param[in] nrhs number of right hand sides
+    The factor is read only once for all the right hand sides.
+   */
+  template<class MatrixSparse, class T1>
+  void TriangularLevelSet
+  ::SolveInterleaved(const MatrixSparse& A, T1* x, int nrhs) const
+  {
+    if ((n == 0) || (nrhs <= 0))
+      return;
+
+    if (size_t(A.GetM()) != n)
+      throw WrongDim("TriangularLevelSet::SolveInterleaved",
+                     "The matrix is of size " + to_str(A.GetM())
+                     + " while the analyzed pattern is of size "
+                     + to_str(n) + ".");
+
+#ifdef _OPENMP
+    int nb_threads = use_threads ? ParallelContext::GetNumThreads(n, 256) : 1;
+    if (nb_threads > 1)
+      {
+        long nb_levels = GetNbLevels();
+#pragma omp parallel num_threads(nb_threads)
+        {
+          for (long l = 0; l < nb_levels; l++)
+            {
+              long first = level_ptr(l), last = level_ptr(l+1);
+#pragma omp for schedule(static)
+              for (long p = first; p < last; p++)
+                if (nrhs == 1)
+                  SolveRow(A, num(p), x);
+                else
+                  SolveRow(A, num(p), x, nrhs);
+            }
+        }
+
+        return;
+      }
+#endif
+
+    // sequential solve, rows are treated in their natural order
+    bool forward = ((type_part == LOWER_PART) != transpose);
+    if (nrhs == 1)
+      {
+        if (forward)
+          for (size_t i = 0; i < n; i++)
+            SolveRow(A, i, x);
+        else
+          for (size_t i = n; i > 0; i--)
+            SolveRow(A, i-1, x);
+      }
+    else
+      {
+        if (forward)
+          for (size_t i = 0; i < n; i++)
+            SolveRow(A, i, x, nrhs);
+        else
+          for (size_t i = n; i > 0; i--)
+            SolveRow(A, i-1, x, nrhs);
+      }
+  }
+
+
+  //! solves the triangular system for nrhs right hand sides
+  /*!
+    \param[in] A matrix analyzed in Init (values may have changed)
+    \param[inout] x right hand sides stored column by column (x[i + r*n] is
+    the component i of the right hand side r), overwritten by the solutions
+    \param[in] nrhs number of right hand sides
+    The right hand sides are copied by blocks of RHS_BLOCK_SIZE columns in
+    the interleaved storage used by SolveInterleaved.
+   */
+  template<class MatrixSparse, class T1>
+  void TriangularLevelSet::Solve(const MatrixSparse& A, T1* x, int nrhs) const
+  {
+    if (nrhs <= 1)
+      {
+        SolveInterleaved(A, x, nrhs);
+        return;
+      }
+
+    int nb_block = min(nrhs, int(RHS_BLOCK_SIZE));
+    Vector<T1> y(n*nb_block);
+    for (int k = 0; k < nrhs; k += nb_block)
+      {
+        int nb = min(nb_block, nrhs - k);
+        for (int r = 0; r < nb; r++)
+          {
+            const T1* xr = &x[(k+r)*n];
+            for (size_t i = 0; i < n; i++)
+              y(i*nb + r) = xr[i];
+          }
+
+        SolveInterleaved(A, y.GetData(), nb);
+
+        for (int r = 0; r < nb; r++)
+          {
+            T1* xr = &x[(k+r)*n];
+            for (size_t i = 0; i < n; i++)
+              xr[i] = y(i*nb + r);
+          }
+      }
+  }
+
+
+  //! solves the triangular system for a single right hand side
+  template<class MatrixSparse, class T1, class Allocator1>
+  void TriangularLevelSet::Solve(const MatrixSparse& A,
+                                 Vector<T1, VectFull, Allocator1>& x) const
+  {
+    Solve(A, x.GetData(), 1);
+  }
+
+
+  //! solves the triangular system for the columns of x
+  template<class MatrixSparse, class T1, class Allocator1>
+  void TriangularLevelSet
+  ::Solve(const MatrixSparse& A,
+          Matrix<T1, General, ColMajor, Allocator1>& x) const
+  {
+    Solve(A, x.GetData(), x.GetN());
+  }
+
+
+  /********************
+   * SparseLuLevelSet *
+   ********************/
+
+
+  //! analyzes the factors L and U stored in A (as computed by GetLU)
+  template<class T, class Allocator>
+  void SparseLuLevelSet
+  ::Init(const Matrix<T, General, ArrayRowSparse, Allocator>& A)
+  {
+    Clear();
+    lower.Init(A, TriangularLevelSet::LOWER_PART, false,
+               TriangularLevelSet::UNIT_DIAGONAL);
+
+    upper.Init(A, TriangularLevelSet::UPPER_PART, false,
+               TriangularLevelSet::MULTIPLY_DIAGONAL);
+  }
+
+
+  //! analyzes the factor L^T stored in A (as computed by GetLU)
+  template<class T, class Allocator>
+  void SparseLuLevelSet
+  ::Init(const Matrix<T, Symmetric, ArrayRowSymSparse, Allocator>& A)
+  {
+    Clear();
+    lower.Init(A, TriangularLevelSet::UPPER_PART, true,
+               TriangularLevelSet::UNIT_DIAGONAL);
+
+    upper.Init(A, TriangularLevelSet::UPPER_PART, false,
+               TriangularLevelSet::UNIT_DIAGONAL);
+  }
+
+
+  //! solves L U x = b or U^T L^T x = b for nrhs right hand sides
+  /*!
+    The right hand sides are interleaved (x[i*nrhs + r] is the component i
+    of the right hand side r). The schedules of U^T and L^T are computed
+    during the first transposed solve.
+   */
+  template<class T, class Allocator, class T1>
+  void SparseLuLevelSet
+  ::SolveInterleaved(const SeldonTranspose& TransA,
+                     const Matrix<T, General, ArrayRowSparse, Allocator>& A,
+                     T1* x, int nrhs)
+  {
+    SolveUnsymmetric(TransA, A, x, nrhs);
+  }
+
+
+  //! solves L D L^T x = b for nrhs interleaved right hand sides
+  template<class T, class Allocator, class T1>
+  void SparseLuLevelSet
+  ::SolveInterleaved(const SeldonTranspose&,
+                     const Matrix<T, Symmetric, ArrayRowSymSparse,
+                     Allocator>& A, T1* x, int nrhs)
+  {
+    SolveSymmetric(A, x, nrhs);
+  }
+
+
+  //! solves L U x = b or U^T L^T x = b with factors in reduced precision
+  /*!
+    A is the conversion of the factors given to Init, the values are
+    converted to T when they are read.
+   */
+  template<class T, class Tvalue, class T1>
+  void SparseLuLevelSet
+  ::SolveInterleaved(const SeldonTranspose& TransA,
+                     const ReducedPrecisionMatrix<T, General, Tvalue>& A,
+                     T1* x, int nrhs)
+  {
+    SolveUnsymmetric(TransA, A, x, nrhs);
+  }
+
+
+  //! solves L D L^T x = b with factors in reduced precision
+  template<class T, class Tvalue, class T1>
+  void SparseLuLevelSet
+  ::SolveInterleaved(const SeldonTranspose&,
+                     const ReducedPrecisionMatrix<T, Symmetric, Tvalue>& A,
+                     T1* x, int nrhs)
+  {
+    SolveSymmetric(A, x, nrhs);
+  }
+
+
+  //! solves L U x = b or U^T L^T x = b (factors of an unsymmetric matrix)
+  template<class MatrixSparse, class T1>
+  void SparseLuLevelSet
+  ::SolveUnsymmetric(const SeldonTranspose& TransA, const MatrixSparse& A,
+                     T1* x, int nrhs)
+  {
+    if (TransA.Trans())
+      {
+        if (lower_trans.GetM() != size_t(A.GetM()))
+          {
+            lower_trans.Init(A, TriangularLevelSet::UPPER_PART, true,
+                             TriangularLevelSet::MULTIPLY_DIAGONAL);
+
+            upper_trans.Init(A, TriangularLevelSet::LOWER_PART, true,
+                             TriangularLevelSet::UNIT_DIAGONAL);
+          }
+
+        lower_trans.SolveInterleaved(A, x, nrhs);
+        upper_trans.SolveInterleaved(A, x, nrhs);
+      }
+    else
+      {
+        lower.SolveInterleaved(A, x, nrhs);
+        upper.SolveInterleaved(A, x, nrhs);
+      }
+  }
+
+
+  //! solves L D L^T x = b (factors of a symmetric matrix)
+  template<class MatrixSparse, class T1>
+  void SparseLuLevelSet::SolveSymmetric(const MatrixSparse& A,
+                                        T1* x, int nrhs)
+  {
+    lower.SolveInterleaved(A, x, nrhs);
+
+    // the diagonal of A contains the inverse of D
+    long n = A.GetM();
+#ifdef _OPENMP
+#pragma omp parallel for if (lower.UseThreads()) \
+  num_threads(ParallelContext::GetNumThreads(n))
+#endif
+    for (long i = 0; i < n; i++)
+      {
+        const typename MatrixSparse::value_type d = A.Value(i, 0);
+        T1* xi = &x[i*nrhs];
+        for (int r = 0; r < nrhs; r++)
+          xi[r] *= d;
+      }
+
+    upper.SolveInterleaved(A, x, nrhs);
+  }
+
+}  // namespace Seldon.
+
+
+#define SELDON_FILE_COMPUTATION_TRIANGULAR_LEVEL_SET_CXX
+#endif
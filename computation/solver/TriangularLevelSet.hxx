@@ -0,0 +1,185 @@
+// Copyright (C) 2016 INRIA
+//
+// This file is part of the linear-algebra library Seldon,
+// http://seldon.sourceforge.net/.
+//
+// Seldon is free software; you can redistribute it and/or modify it under the
+// terms of the GNU Lesser General Public License as published by the Free
+// Software Foundation; either version 2.1 of the License, or (at your option)
+// any later version.
+//
+// Seldon is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for
+// more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with Seldon. If not, see http://www.gnu.org/licenses/.
+
+
+#ifndef SELDON_FILE_COMPUTATION_TRIANGULAR_LEVEL_SET_HXX
+
+namespace Seldon
+{
+
+  //! Level-set schedule of a sparse triangular solve
+  /*!
+    The triangular part of a factor stored in a row-oriented sparse matrix
+    (ArrayRowSparse, ArrayRowSymSparse or ReducedPrecisionMatrix, any class
+    with the methods GetM, GetRowSize, Index and Value) is analyzed once:
+    the unknowns are grouped into levels such that each unknown only
+    depends on unknowns of previous levels. The unknowns of a level are then computed
+    in parallel (with OpenMP), the levels being treated one after the
+    other. When the factor is transposed, the transposed pattern is stored
+    (with the positions of the values in the factor) so that each unknown
+    is computed by gathering contributions, and no write conflict occurs.
+    The values of the factor are not stored, the schedule remains valid as
+    long as the pattern of the factor is not modified.
+  */
+  class TriangularLevelSet
+  {
+  public :
+    //! Part of the matrix used as triangular factor.
+    enum {LOWER_PART, UPPER_PART};
+
+    //! Treatment of the diagonal.
+    /*!
+      UNIT_DIAGONAL : the diagonal is equal to identity (not used)
+      DIVIDE_DIAGONAL : the diagonal of the factor is stored
+      MULTIPLY_DIAGONAL : the inverse of the diagonal is stored
+    */
+    enum {UNIT_DIAGONAL, DIVIDE_DIAGONAL, MULTIPLY_DIAGONAL};
+
+    //! Maximal number of right hand sides solved together.
+    /*!
+      Several right hand sides are interleaved (x[i*nrhs + r] is the
+      component i of the right hand side r) so that each value of the factor
+      is read once and applied to contiguous values (vectorized loop).
+      Larger sets of right hand sides are split into blocks of this size.
+    */
+    enum {RHS_BLOCK_SIZE = 64};
+
+  protected :
+    //! Number of rows.
+    size_t n;
+    //! Part of the matrix used (LOWER_PART or UPPER_PART).
+    int type_part;
+    //! Treatment of the diagonal.
+    int type_diagonal;
+    //! if true, the transpose of the triangular part is solved
+    bool transpose;
+    //! if true, levels are treated with several threads
+    bool use_threads;
+
+    //! position of the diagonal in each row
+    Vector<size_t> diag_pos;
+    //! first and last (excluded) position of the used part in each row
+    Vector<size_t> row_beg, row_end;
+
+    //! transposed pattern (only computed if transpose is true)
+    Vector<size_t> ptr_trans, ind_trans, pos_trans;
+
+    //! unknowns sorted by levels
+    Vector<size_t> level_ptr, num;
+
+  public :
+    TriangularLevelSet();
+
+    size_t GetM() const;
+    size_t GetNbLevels() const;
+    bool IsTransposed() const;
+    bool UseThreads() const;
+    int64_t GetMemorySize() const;
+
+    void Clear();
+
+    template<class MatrixSparse>
+    void Init(const MatrixSparse& A, int part, bool trans, int diag);
+
+    template<class MatrixSparse, class T1>
+    void SolveInterleaved(const MatrixSparse& A, T1* x, int nrhs) const;
+
+    template<class MatrixSparse, class T1>
+    void Solve(const MatrixSparse& A, T1* x, int nrhs) const;
+
+    template<class MatrixSparse, class T1, class Allocator1>
+    void Solve(const MatrixSparse& A,
+               Vector<T1, VectFull, Allocator1>& x) const;
+
+    template<class MatrixSparse, class T1, class Allocator1>
+    void Solve(const MatrixSparse& A,
+               Matrix<T1, General, ColMajor, Allocator1>& x) const;
+
+  protected :
+    template<class MatrixSparse, class T1>
+    void SolveRow(const MatrixSparse& A, size_t i, T1* x) const;
+
+    template<class MatrixSparse, class T1>
+    void SolveRow(const MatrixSparse& A, size_t i, T1* x, int nrhs) const;
+
+  };
+
+
+  //! Level-set schedules for the solution of L U x = b or L D L^T x = b
+  /*!
+    The factors are the ones computed by GetLU (or GetIlut) for
+    ArrayRowSparse and ArrayRowSymSparse matrices. They can also be solved
+    after conversion to a ReducedPrecisionMatrix (with the schedules
+    computed on the original factors). The schedules used for the
+    transposed unsymmetric system are only computed when the first
+    transposed solve is performed. Right hand sides are given in the
+    interleaved storage of TriangularLevelSet::SolveInterleaved.
+  */
+  class SparseLuLevelSet
+  {
+  protected :
+    //! schedules for L and U
+    TriangularLevelSet lower, upper;
+    //! schedules for U^T and L^T
+    TriangularLevelSet lower_trans, upper_trans;
+
+  public :
+    int64_t GetMemorySize() const;
+    void Clear();
+
+    template<class T, class Allocator>
+    void Init(const Matrix<T, General, ArrayRowSparse, Allocator>& A);
+
+    template<class T, class Allocator>
+    void Init(const Matrix<T, Symmetric, ArrayRowSymSparse, Allocator>& A);
+
+    template<class T, class Allocator, class T1>
+    void SolveInterleaved(const SeldonTranspose& TransA,
+                          const Matrix<T, General, ArrayRowSparse,
+                          Allocator>& A, T1* x, int nrhs);
+
+    template<class T, class Allocator, class T1>
+    void SolveInterleaved(const SeldonTranspose& TransA,
+                          const Matrix<T, Symmetric, ArrayRowSymSparse,
+                          Allocator>& A, T1* x, int nrhs);
+
+    template<class T, class Tvalue, class T1>
+    void SolveInterleaved(const SeldonTranspose& TransA,
+                          const ReducedPrecisionMatrix<T, General,
+                          Tvalue>& A, T1* x, int nrhs);
+
+    template<class T, class Tvalue, class T1>
+    void SolveInterleaved(const SeldonTranspose& TransA,
+                          const ReducedPrecisionMatrix<T, Symmetric,
+                          Tvalue>& A, T1* x, int nrhs);
+
+  protected :
+    template<class MatrixSparse, class T1>
+    void SolveUnsymmetric(const SeldonTranspose& TransA,
+                          const MatrixSparse& A, T1* x, int nrhs);
+
+    template<class MatrixSparse, class T1>
+    void SolveSymmetric(const MatrixSparse& A, T1* x, int nrhs);
+
+  };
+
+}  // namespace Seldon.
+
+
+#define SELDON_FILE_COMPUTATION_TRIANGULAR_LEVEL_SET_HXX
+#endif
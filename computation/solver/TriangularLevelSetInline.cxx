@@ -0,0 +1,122 @@
+// Copyright (C) 2016 INRIA
+//
+// This file is part of the linear-algebra library Seldon,
+// http://seldon.sourceforge.net/.
+//
+// Seldon is free software; you can redistribute it and/or modify it under the
+// terms of the GNU Lesser General Public License as published by the Free
+// Software Foundation; either version 2.1 of the License, or (at your option)
+// any later version.
+//
+// Seldon is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for
+// more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with Seldon. If not, see http://www.gnu.org/licenses/.
+
+
+#ifndef SELDON_FILE_COMPUTATION_TRIANGULAR_LEVEL_SET_INLINE_CXX
+
+#include "TriangularLevelSet.hxx"
+
+namespace Seldon
+{
+
+  /**********************
+   * TriangularLevelSet *
+   **********************/
+
+
+  //! default constructor
+  inline TriangularLevelSet::TriangularLevelSet()
+  {
+    n = 0;
+    type_part = LOWER_PART;
+    type_diagonal = UNIT_DIAGONAL;
+    transpose = false;
+    use_threads = false;
+  }
+
+
+  //! returns the number of rows of the analyzed factor
+  inline size_t TriangularLevelSet::GetM() const
+  {
+    return n;
+  }
+
+
+  //! returns the number of levels
+  inline size_t TriangularLevelSet::GetNbLevels() const
+  {
+    if (level_ptr.GetM() == 0)
+      return 0;
+
+    return level_ptr.GetM() - 1;
+  }
+
+
+  //! returns true if the transpose of the triangular part is solved
+  inline bool TriangularLevelSet::IsTransposed() const
+  {
+    return transpose;
+  }
+
+
+  //! returns true if levels are solved with several threads
+  inline bool TriangularLevelSet::UseThreads() const
+  {
+    return use_threads;
+  }
+
+
+  //! returns the memory used by the object in bytes
+  inline int64_t TriangularLevelSet::GetMemorySize() const
+  {
+    int64_t taille = sizeof(*this);
+    taille += diag_pos.GetMemorySize() + row_beg.GetMemorySize()
+      + row_end.GetMemorySize() + ptr_trans.GetMemorySize()
+      + ind_trans.GetMemorySize() + pos_trans.GetMemorySize()
+      + level_ptr.GetMemorySize() + num.GetMemorySize();
+
+    return taille;
+  }
+
+
+  //! clears the schedule
+  inline void TriangularLevelSet::Clear()
+  {
+    n = 0;
+    use_threads = false;
+    diag_pos.Clear(); row_beg.Clear(); row_end.Clear();
+    ptr_trans.Clear(); ind_trans.Clear(); pos_trans.Clear();
+    level_ptr.Clear(); num.Clear();
+  }
+
+
+  /********************
+   * SparseLuLevelSet *
+   ********************/
+
+
+  //! returns the memory used by the object in bytes
+  inline int64_t SparseLuLevelSet::GetMemorySize() const
+  {
+    return lower.GetMemorySize() + upper.GetMemorySize()
+      + lower_trans.GetMemorySize() + upper_trans.GetMemorySize();
+  }
+
+
+  //! clears the schedules
+  inline void SparseLuLevelSet::Clear()
+  {
+    lower.Clear(); upper.Clear();
+    lower_trans.Clear(); upper_trans.Clear();
+  }
+
+}  // namespace Seldon.
+
+
+#define SELDON_FILE_COMPUTATION_TRIANGULAR_LEVEL_SET_INLINE_CXX
+#endif
@@ -54,6 +54,8 @@ namespace Seldon
 	   Preconditioner& M, Iteration<Titer> & iter)
 #endif
   {
+    SELDON_PROFILE_SOLVE("BiCg");
+
     int N = A.GetM();
     if (N <= 0)
       return 0;
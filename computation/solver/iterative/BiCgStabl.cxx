@@ -51,6 +51,8 @@ namespace Seldon
 		Preconditioner& M, Iteration<Titer> & iter)
 #endif
   {
+    SELDON_PROFILE_SOLVE("BiCgStabl");
+
     const int N = A.GetM();
     if (N <= 0)
       return 0;
@@ -53,6 +53,8 @@ namespace Seldon
 	     Preconditioner& M, Iteration<Titer> & iter)
 #endif
   {
+    SELDON_PROFILE_SOLVE("BiCgcr");
+
     const int N = A.GetM();
     if (N <= 0)
       return 0;
@@ -52,6 +52,8 @@ namespace Seldon
 	   Preconditioner& M, Iteration<Titer> & iter)
 #endif
   {
+    SELDON_PROFILE_SOLVE("CoCg");
+
     const int N = A.GetM();
     if (N <= 0)
       return 0;
@@ -53,6 +53,8 @@ namespace Seldon
 	  Preconditioner& M, Iteration<Titer> & outer)
 #endif
   {
+    SELDON_PROFILE_SOLVE("Gcr");
+
     const int N = A.GetM();
     if (N <= 0)
       return 0;
@@ -135,11 +137,17 @@ namespace Seldon
 	    Copy(r, p[j+1]);
 	    // we compute direction p(j+1) = r(j+1) +
 	    // \sum_{i=0..j} ( -(A*r_j+1,A*p_i)/(A*p_i,A*p_i) p(i))
-	    for (int i = 0; i <= j; i++)
-	      {
-		delta = -DotProdConj(w[i], q)/beta(i);
-		Add(delta, p[i], p[j+1]);
-	      }
+	    {
+	      SELDON_PROFILE("Gcr::Orthogonalization");
+	      SELDON_PROFILE_COUNT(4. * (j+1) * N,
+				   5. * (j+1) * N * sizeof(Complexe));
+
+	      for (int i = 0; i <= j; i++)
+		{
+		  delta = -DotProdConj(w[i], q)/beta(i);
+		  Add(delta, p[i], p[j+1]);
+		}
+	    }
 
 	    ++inner;
 	    ++outer;
@@ -52,6 +52,8 @@ namespace Seldon
 	    Preconditioner& M, Iteration<Titer> & outer)
 #endif
   {
+    SELDON_PROFILE_SOLVE("Gmres");
+
     const int N = A.GetM();
     if (N <= 0)
       return 0;
@@ -137,20 +139,26 @@ namespace Seldon
 	    M.Solve(A, u, w);
 
 	    // Arnoldi algorithm
-	    for (k = 0; k <= i; k++)
-	      {
-		// h_{k,i} = \bar{v(k)} w
-		H.Val(k, i) = DotProdConj(V[k], w);
-		Add(-H(k,i), V[k], w);
-	      }
-
-	    // we compute h(i+1,i)
-	    SetComplexReal(Norm2(w), hi_ip1);
-	    Copy(w, V[i+1]);
-
-	    // we normalize V(i+1)
-	    if (hi_ip1 != zero)
-	      Mlt(one/hi_ip1, V[i+1]);
+	    {
+	      SELDON_PROFILE("Gmres::Orthogonalization");
+	      SELDON_PROFILE_COUNT(4. * (i+2) * N,
+				   5. * (i+2) * N * sizeof(Complexe));
+
+	      for (k = 0; k <= i; k++)
+		{
+		  // h_{k,i} = \bar{v(k)} w
+		  H.Val(k, i) = DotProdConj(V[k], w);
+		  Add(-H(k,i), V[k], w);
+		}
+
+	      // we compute h(i+1,i)
+	      SetComplexReal(Norm2(w), hi_ip1);
+	      Copy(w, V[i+1]);
+
+	      // we normalize V(i+1)
+	      if (hi_ip1 != zero)
+		Mlt(one/hi_ip1, V[i+1]);
+	    }
 
 	    // we apply precedent generated rotations
 	    // to the last column we computed.
@@ -38,6 +38,7 @@ namespace Seldon
   inline void Preconditioner_Base<T>
   ::Solve(const VirtualMatrix<T>&, const Vector<T>& r, Vector<T>& z)
   {
+    SELDON_PROFILE("Preconditioner_Base::Solve");
     Copy(r, z);
   }
 
@@ -49,6 +50,7 @@ namespace Seldon
   inline void Preconditioner_Base<T>
   ::TransSolve(const VirtualMatrix<T>&, const Vector<T>& r, Vector<T>& z)
   {
+    SELDON_PROFILE("Preconditioner_Base::Solve");
     Copy(r, z);
   }
 
@@ -68,6 +70,7 @@ namespace Seldon
   inline void Preconditioner_Base<T>
   ::Solve(const Matrix1& A, const Vector1& r, Vector1& z)
   {
+    SELDON_PROFILE("Preconditioner_Base::Solve");
     Copy(r, z);
   }
 
@@ -91,6 +94,7 @@ namespace Seldon
   ::MltAdd(const T1& alpha, const Matrix1& A, const Vector1& x,
 	   const T1& beta, Vector1& y)
   {
+    SELDON_PROFILE("Iteration::MltAdd");
 #ifdef SELDON_WITH_VIRTUAL
     A.MltAddVector(alpha, x, beta, y);
 #else
@@ -104,6 +108,7 @@ namespace Seldon
   inline void Iteration<T>
   ::Mlt(const Matrix1& A, const Vector1& x, Vector1& y)
   {
+    SELDON_PROFILE("Iteration::Mlt");
 #ifdef SELDON_WITH_VIRTUAL
     A.MltVector(x, y);
 #else
@@ -118,6 +123,7 @@ namespace Seldon
   ::Mlt(const class_SeldonTrans& trans,
 	const Matrix1& A, const Vector1& x, Vector1& y)
   {
+    SELDON_PROFILE("Iteration::Mlt");
 #ifdef SELDON_WITH_VIRTUAL
     A.MltVector(trans, x, y);
 #else
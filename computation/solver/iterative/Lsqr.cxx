@@ -48,6 +48,8 @@ namespace Seldon
 	   Preconditioner& M, Iteration<Titer> & iter)
 #endif
   {
+    SELDON_PROFILE_SOLVE("Lsqr");
+
     const int N = A.GetM();
     if (N <= 0)
       return 0;
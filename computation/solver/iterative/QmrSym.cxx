@@ -49,6 +49,8 @@ namespace Seldon
 	     Preconditioner& M, Iteration<Titer> & iter)
 #endif
   {
+    SELDON_PROFILE_SOLVE("QmrSym");
+
     const int N = A.GetM();
     if (N <= 0)
       return 0;
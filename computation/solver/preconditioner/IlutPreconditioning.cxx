@@ -36,6 +36,7 @@ namespace Seldon
     alpha = 1.0;
     droptol = 0.01;
     permtol = 0.1;
+    single_precision = false;
   }
 
 
@@ -45,6 +46,9 @@ namespace Seldon
     permutation_row.Clear();
     mat_sym.Clear();
     mat_unsym.Clear();
+    mat_sym_single.Clear();
+    mat_unsym_single.Clear();
+    level_set.Clear();
   }
 
   
@@ -110,6 +114,9 @@ namespace Seldon
   {
     int64_t taille = sizeof(int)*(permutation_row.GetM() + permutation_col.GetM());
     taille += mat_sym.GetMemorySize() + mat_unsym.GetMemorySize();
+    taille += mat_sym_single.GetMemorySize()
+      + mat_unsym_single.GetMemorySize();
+    taille += level_set.GetMemorySize();
     return taille;
   }
   
@@ -220,6 +227,31 @@ namespace Seldon
   }
 
 
+  //! Returns true if the factors are stored in single precision.
+  template<class cplx, class Allocator>
+  bool IlutPreconditioning<cplx, Allocator>::UseSinglePrecisionFactors() const
+  {
+    return single_precision;
+  }
+
+
+  //! Stores the factors in single precision (from the next factorisation).
+  /*!
+    The factorisation is computed in the precision of cplx, the factors are
+    then converted to float (or complex<float>) and the original factors
+    are released. The memory of the factors is divided by two (values on 4
+    bytes and column numbers on 4 bytes instead of 8), and so is the time
+    of the triangular solves, which is limited by the memory bandwidth. The
+    solves are still performed in the precision of the vectors.
+  */
+  template<class cplx, class Allocator>
+  void IlutPreconditioning<cplx, Allocator>
+  ::SetSinglePrecisionFactors(bool single)
+  {
+    single_precision = single;
+  }
+
+
   template<class cplx, class Allocator>
   template<class T0, class Storage0, class Allocator0>
   void IlutPreconditioning<cplx, Allocator>::
@@ -267,7 +299,7 @@ namespace Seldon
 
     // We keep permutation array in memory, and check it.
     int n = mat_sym.GetM();
-    if (perm.GetM() != n)
+    if (perm.GetM() != size_t(n))
       {
         cout << "Numbering array should have the same size as matrix.";
         cout << endl;
@@ -284,7 +316,7 @@ namespace Seldon
       }
 
     for (int i = 0; i < n; i++)
-      if (inv_permutation(i) == -1)
+      if (inv_permutation(i) == size_t(-1))
         {
           cout << "Error in the numbering array." << endl;
           abort();
@@ -295,6 +327,8 @@ namespace Seldon
 
     // Factorization is performed.
     GetIlut(*this, mat_sym);
+    level_set.Init(mat_sym);
+    ConvertFactors();
   }
 
 
@@ -314,7 +348,7 @@ namespace Seldon
 
     // We keep permutation array in memory, and check it.
     int n = mat_unsym.GetM();
-    if (perm.GetM() != n)
+    if (perm.GetM() != size_t(n))
       {
         cout << "Numbering array should have the same size as matrix.";
         cout << endl;
@@ -333,7 +367,7 @@ namespace Seldon
       }
 
     for (int i = 0; i < n; i++)
-      if (inv_permutation(i) == -1)
+      if (inv_permutation(i) == size_t(-1))
         {
           cout << "Error in the numbering array." << endl;
           abort();
@@ -355,38 +389,115 @@ namespace Seldon
       permutation_col(i) = iperm(itmp(i));
 
     permutation_row = perm;
+    level_set.Init(mat_unsym);
+    ConvertFactors();
   }
 
 
-#ifdef SELDON_WITH_VIRTUAL
-  //! Applies ilut preconditioning
-  template<class T, class Allocator>
-  void IlutPreconditioning<T, Allocator>
-  ::Solve(const VirtualMatrix<T>&, const Vector<T>& r, Vector<T>& z)
+  //! Converts the factors to single precision if required.
+  /*!
+    The level-set schedules computed on the original factors remain valid,
+    since the conversion keeps the positions of the values in each row.
+  */
+  template<class cplx, class Allocator>
+  void IlutPreconditioning<cplx, Allocator>::ConvertFactors()
   {
+    mat_sym_single.Clear();
+    mat_unsym_single.Clear();
+    if (!single_precision)
+      return;
+
     if (symmetric_algorithm)
       {
-	Vector<T> xtmp(z);
-        for (int i = 0; i < r.GetM(); i++)
-          xtmp(permutation_row(i)) = r(i);
-	
-        SolveLU(mat_sym, xtmp);
-	
-        for (int i = 0; i < r.GetM(); i++)
-          z(i) = xtmp(permutation_row(i));
+        Copy(mat_sym, mat_sym_single);
+        mat_sym.Clear();
       }
     else
       {
-	Vector<T> xtmp(z);
-        for (int i = 0; i < r.GetM(); i++)
-          xtmp(permutation_row(i)) = r(i);
+        Copy(mat_unsym, mat_unsym_single);
+        mat_unsym.Clear();
+      }
+  }
 
-        SolveLU(mat_unsym, xtmp);
 
-        for (int i = 0; i < r.GetM(); i++)
-          z(permutation_col(i)) = xtmp(i);
+  //! Applies the incomplete factorisation to nrhs vectors
+  /*!
+    The triangular solves use the level-set schedules computed after the
+    factorisation, the unknowns of a same level are computed in parallel
+    if OpenMP is enabled.
+    \param[in] TransA SeldonNoTrans or SeldonTrans
+    \param[in] r right hand sides stored column by column
+    \param[out] z solutions (r and z can be the same array)
+    \param[in] nrhs number of right hand sides
+   */
+  template<class cplx, class Allocator> template<class T1>
+  void IlutPreconditioning<cplx, Allocator>
+  ::SolveFactors(const SeldonTranspose& TransA, const T1* r,
+                 T1* z, int nrhs)
+  {
+    int n = permutation_row.GetM();
+    if (nrhs <= 0)
+      return;
+
+    SELDON_PROFILE("IlutPreconditioning::Solve");
+    SELDON_PROFILE_COUNT(2. * nrhs * (symmetric_algorithm
+                                      ? 2. * (mat_sym.GetDataSize()
+                                              + mat_sym_single.GetDataSize())
+                                      : double(mat_unsym.GetDataSize()
+                                               + mat_unsym_single
+                                               .GetDataSize())),
+                         nrhs * (2. * n * sizeof(T1)));
+
+    // right hand sides are interleaved by blocks
+    bool trans = TransA.Trans() && !symmetric_algorithm;
+    int nb_block = min(nrhs, int(TriangularLevelSet::RHS_BLOCK_SIZE));
+    Vector<T1> xtmp(n*nb_block);
+    T1* y = xtmp.GetData();
+    for (int k0 = 0; k0 < nrhs; k0 += nb_block)
+      {
+        int nb = min(nb_block, nrhs - k0);
+        for (int k = 0; k < nb; k++)
+          {
+            const T1* rk = &r[(k0+k)*n];
+            if (trans)
+              for (int i = 0; i < n; i++)
+                y[i*nb + k] = rk[permutation_col(i)];
+            else
+              for (int i = 0; i < n; i++)
+                y[permutation_row(i)*nb + k] = rk[i];
+          }
+
+        if (symmetric_algorithm && single_precision)
+          level_set.SolveInterleaved(SeldonNoTrans, mat_sym_single, y, nb);
+        else if (symmetric_algorithm)
+          level_set.SolveInterleaved(SeldonNoTrans, mat_sym, y, nb);
+        else if (single_precision)
+          level_set.SolveInterleaved(TransA, mat_unsym_single, y, nb);
+        else
+          level_set.SolveInterleaved(TransA, mat_unsym, y, nb);
+
+        for (int k = 0; k < nb; k++)
+          {
+            T1* zk = &z[(k0+k)*n];
+            if (symmetric_algorithm || trans)
+              for (int i = 0; i < n; i++)
+                zk[i] = y[permutation_row(i)*nb + k];
+            else
+              for (int i = 0; i < n; i++)
+                zk[permutation_col(i)] = y[i*nb + k];
+          }
       }
   }
+
+
+#ifdef SELDON_WITH_VIRTUAL
+  //! Applies ilut preconditioning
+  template<class T, class Allocator>
+  void IlutPreconditioning<T, Allocator>
+  ::Solve(const VirtualMatrix<T>&, const Vector<T>& r, Vector<T>& z)
+  {
+    SolveFactors(SeldonNoTrans, r.GetData(), z.GetData(), 1);
+  }
   
   
   //! Applies transpose of ilut preconditioning
@@ -394,19 +505,7 @@ namespace Seldon
   void IlutPreconditioning<T, Allocator>
   ::TransSolve(const VirtualMatrix<T>& A, const Vector<T>& r, Vector<T>& z)
   {
-    if (symmetric_algorithm)
-      Solve(A, r, z);
-    else
-      {
-	Vector<T> xtmp(z);
-        for (int i = 0; i < r.GetM(); i++)
-          xtmp(i) = r(permutation_col(i));
-
-        SolveLU(SeldonTrans, mat_unsym, xtmp);
-
-        for (int i = 0; i < r.GetM(); i++)
-          z(i) = xtmp(permutation_row(i));
-      }
+    SolveFactors(SeldonTrans, r.GetData(), z.GetData(), 1);
   }
 
 #else
@@ -417,28 +516,7 @@ namespace Seldon
   void IlutPreconditioning<cplx, Allocator>
   ::Solve(const Matrix1& A, const Vector1& r, Vector1& z)
   {
-    if (symmetric_algorithm)
-      {
-	Vector1 xtmp(z);
-        for (int i = 0; i < r.GetM(); i++)
-          xtmp(permutation_row(i)) = r(i);
-	
-        SolveLU(mat_sym, xtmp);
-	
-        for (int i = 0; i < r.GetM(); i++)
-          z(i) = xtmp(permutation_row(i));
-      }
-    else
-      {
-	Vector1 xtmp(z);
-        for (int i = 0; i < r.GetM(); i++)
-          xtmp(permutation_row(i)) = r(i);
-
-        SolveLU(mat_unsym, xtmp);
-
-        for (int i = 0; i < r.GetM(); i++)
-          z(permutation_col(i)) = xtmp(i);
-      }
+    SolveFactors(SeldonNoTrans, r.GetData(), z.GetData(), 1);
   }
 
 
@@ -448,19 +526,7 @@ namespace Seldon
   void IlutPreconditioning<cplx, Allocator>
   ::TransSolve(const Matrix1& A, const Vector1& r, Vector1& z)
   {
-    if (symmetric_algorithm)
-      Solve(A, r, z);
-    else
-      {
-	Vector1 xtmp(z);
-        for (int i = 0; i < r.GetM(); i++)
-          xtmp(i) = r(permutation_col(i));
-
-        SolveLU(SeldonTrans, mat_unsym, xtmp);
-
-        for (int i = 0; i < r.GetM(); i++)
-          z(i) = xtmp(permutation_row(i));
-      }
+    SolveFactors(SeldonTrans, r.GetData(), z.GetData(), 1);
   }
 #endif
 
@@ -469,28 +535,7 @@ namespace Seldon
   template<class Vector1>
   void IlutPreconditioning<cplx, Allocator>::Solve(Vector1& z)
   {
-    if (symmetric_algorithm)
-      {
-	Vector1 xtmp(z);
-        for (int i = 0; i < z.GetM(); i++)
-          xtmp(permutation_row(i)) = z(i);
-
-        SolveLU(mat_sym, xtmp);
-
-        for (int i = 0; i < z.GetM(); i++)
-          z(i) = xtmp(permutation_row(i));
-      }
-    else
-      {
-	Vector1 xtmp(z);
-        for (int i = 0; i < z.GetM(); i++)
-          xtmp(permutation_row(i)) = z(i);
-
-        SolveLU(mat_unsym, xtmp);
-
-        for (int i = 0; i < z.GetM(); i++)
-          z(permutation_col(i)) = xtmp(i);
-      }
+    SolveFactors(SeldonNoTrans, z.GetData(), z.GetData(), 1);
   }
 
 
@@ -498,19 +543,7 @@ namespace Seldon
   template<class Vector1>
   void IlutPreconditioning<cplx, Allocator>::TransSolve(Vector1& z)
   {
-    if (symmetric_algorithm)
-      Solve(z);
-    else
-      {
-	Vector1 xtmp(z);
-        for (int i = 0; i < z.GetM(); i++)
-          xtmp(i) = z(permutation_col(i));
-
-        SolveLU(SeldonTrans, mat_unsym, xtmp);
-
-        for (int i = 0; i < z.GetM(); i++)
-          z(i) = xtmp(permutation_row(i));
-      }
+    SolveFactors(SeldonTrans, z.GetData(), z.GetData(), 1);
   }
 
   
@@ -529,14 +562,23 @@ namespace Seldon
   void IlutPreconditioning<cplx, Allocator>
   ::Solve(const SeldonTranspose& TransA, cplx* x_ptr, int nrhs)
   {
-    Vector<cplx> x;
-    int n = permutation_row.GetM();
-    for (int k = 0; k < nrhs; k++)
-      {
-	x.SetData(n, &x_ptr[k*n]);
-	Solve(TransA, x);
-	x.Nullify();
-      }
+    SolveFactors(TransA, x_ptr, x_ptr, nrhs);
+  }
+
+
+  //! Applies ilut preconditioning to the columns of x
+  template<class cplx, class Allocator> template<class T1, class Allocator1>
+  void IlutPreconditioning<cplx, Allocator>
+  ::Solve(const SeldonTranspose& TransA,
+          Matrix<T1, General, ColMajor, Allocator1>& x)
+  {
+    if (x.GetM() != permutation_row.GetM())
+      throw WrongDim("IlutPreconditioning::Solve(SeldonTranspose&, Matrix&)",
+                     "The matrix has " + to_str(x.GetM()) + " rows while "
+                     + "the preconditioner is of size "
+                     + to_str(permutation_row.GetM()) + ".");
+
+    SolveFactors(TransA, x.GetData(), x.GetData(), x.GetN());
   }
   
 
@@ -667,8 +709,15 @@ namespace Seldon
     SetComplexZero(czero);
     SetComplexOne(cone);
     typedef Vector<cplx, VectFull, Allocator2> VectCplx;
-    VectCplx Row_Val(n);
-    IVect Index(n), Row_Ind(n), Index_Diag(n);
+    VectCplx Row_Val;
+    IVect Index, Row_Ind, Index_Diag;
+
+    // work arrays are taken from the memory pool
+    Workspace work;
+    work.GetVector(n, Row_Val);
+    work.GetVector(n, Index);
+    work.GetVector(n, Row_Ind);
+    work.GetVector(n, Index_Diag);
     Row_Val.Fill(czero);
     Row_Ind.Fill(-1);
     Index_Diag.Fill(-1);
@@ -760,7 +809,7 @@ namespace Seldon
 	    // Determine smallest column index.
 	    for (j = j_col + 1; j < length_lower; j++)
 	      {
-		if (Row_Ind(j) < jrow)
+		if (Row_Ind(j) < size_t(jrow))
 		  {
 		    jrow = Row_Ind(j);
 		    k = j;
@@ -809,7 +858,7 @@ namespace Seldon
 	    if (!element_dropped)
 	      {
 		// Combines current row and row jrow.
-		for (k = (Index_Diag(jrow)+1); k < A.GetRowSize(jrow); k++)
+		for (k = (Index_Diag(jrow)+1); k < int(A.GetRowSize(jrow)); k++)
 		  {
 		    s = fact * A.Value(jrow,k);
                     j = rperm(A.Index(jrow,k));
@@ -927,7 +976,7 @@ namespace Seldon
           {
             tnorm = abs(Row_Val(k));
             if ((tnorm > xmax) && (tnorm*permtol > xmax0)
-                && (Row_Ind(k)<= icut))
+                && (Row_Ind(k)<= size_t(icut)))
               {
                 imax = k;
                 xmax = tnorm;
@@ -980,7 +1029,7 @@ namespace Seldon
         int((A.GetDataSize()*(sizeof(cplx)+4))/(1024*1024)) << " MB" << endl;
 
     for (i = 0; i < n; i++ )
-      for (j = 0; j < A.GetRowSize(i); j++)
+      for (j = 0; j < int(A.GetRowSize(i)); j++)
         A.Index(i,j) = rperm(A.Index(i,j));
   }
 
@@ -991,8 +1040,11 @@ namespace Seldon
     int n = A.GetM();
     Vector<cplx> w;
     w.Reallocate(n+1);
-    IVect jw(3*n), Index_Diag(n);
-    Vector<IVect, VectFull, NewAlloc<IVect> > levs(n);
+    // jw stores signed positions and levels, -1 marking an empty position
+    // or an entry of the original matrix
+    Vector<int> jw(3*n);
+    IVect Index_Diag(n);
+    Vector<Vector<int>, VectFull, NewAlloc<Vector<int> > > levs(n);
 
     cplx czero, cone;
     SetComplexZero(czero);
@@ -1105,7 +1157,7 @@ namespace Seldon
 	      {
 		// Combines current row and row jrow.
 		k_ = 0;
-		for (k = (Index_Diag(jrow)+1); k < A.GetRowSize(jrow) ; k++)
+		for (k = (Index_Diag(jrow)+1); k < int(A.GetRowSize(jrow)) ; k++)
 		  {
 		    s = fact * A.Value(jrow,k);
 		    j = A.Index(jrow,k);
@@ -1236,7 +1288,7 @@ namespace Seldon
     for (int i_row = 0 ; i_row < n ; i_row++)
       {
 	// Generating row number i_row of L and U.
-        for (int j = 0 ; j < A.GetRowSize(i_row) ; j++ )
+        for (int j = 0 ; j < int(A.GetRowSize(i_row)) ; j++ )
 	  {
 	    j_col = A.Index(i_row, j);
 	    if (j_col == i_row)
@@ -1255,7 +1307,7 @@ namespace Seldon
 	    A.Value(i_row, j) = tl;
 
 	    // Performs linear combination.
-            for ( j_col = (ju(jrow)+1); j_col < A.GetRowSize(jrow); j_col++)
+            for ( j_col = (ju(jrow)+1); j_col < int(A.GetRowSize(jrow)); j_col++)
 	      {
 		jw = Index(A.Index(jrow,j_col));
 		if (jw != -1)
@@ -1276,7 +1328,7 @@ namespace Seldon
 
         // Resets pointer Index to zero.
         Index(i_row) = -1;
-        for (int i = 0; i < A.GetRowSize(i_row); i++)
+        for (int i = 0; i < int(A.GetRowSize(i_row)); i++)
           Index(A.Index(i_row, i)) = -1;
       }
 
@@ -1301,7 +1353,7 @@ namespace Seldon
     for (int i_row = 0 ; i_row < n ; i_row++)
       {
         // Generating row number i_row of L and U.
-        for (int j = 0; j < A.GetRowSize(i_row); j++ )
+        for (int j = 0; j < int(A.GetRowSize(i_row)); j++ )
 	  {
 	    j_col = A.Index(i_row, j);
 	    if (j_col == i_row)
@@ -1321,7 +1373,7 @@ namespace Seldon
 	    A.Value(i_row, j) = tl;
 
             // Performs linear combination.
-            for ( j_col = (ju(jrow)+1); j_col < A.GetRowSize(jrow); j_col++ )
+            for ( j_col = (ju(jrow)+1); j_col < int(A.GetRowSize(jrow)); j_col++ )
 	      {
 		jw = Index(A.Index(jrow, j_col));
 		if (jw != -1)
@@ -1344,7 +1396,7 @@ namespace Seldon
 
         // Resets pointer Index to zero.
         Index(i_row) = -1;
-	for (int i = 0; i < A.GetRowSize(i_row); i++)
+	for (int i = 0; i < int(A.GetRowSize(i_row)); i++)
 	  Index(A.Index(i_row, i)) = -1;
       }
   }
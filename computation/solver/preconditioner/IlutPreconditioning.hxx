@@ -56,6 +56,24 @@ namespace Seldon
     Matrix<T, Symmetric, ArrayRowSymSparse, Allocator> mat_sym;
     //! Unsymmetric matrix.
     Matrix<T, General, ArrayRowSparse, Allocator> mat_unsym;
+    //! Level-set schedules of the triangular solves.
+    SparseLuLevelSet level_set;
+    //! True if the factors are stored in single precision.
+    bool single_precision;
+    //! Symmetric factors in single precision.
+    ReducedPrecisionMatrix<T, Symmetric,
+                           typename ClassSinglePrecision<T>::Tsingle>
+    mat_sym_single;
+    //! Unsymmetric factors in single precision.
+    ReducedPrecisionMatrix<T, General,
+                           typename ClassSinglePrecision<T>::Tsingle>
+    mat_unsym_single;
+
+    void ConvertFactors();
+
+    template<class T1>
+    void SolveFactors(const SeldonTranspose& TransA, const T1* r,
+                      T1* z, int nrhs);
 
   public :
 
@@ -86,6 +104,9 @@ namespace Seldon
     void SetSymmetricAlgorithm();
     void SetUnsymmetricAlgorithm();
 
+    bool UseSinglePrecisionFactors() const;
+    void SetSinglePrecisionFactors(bool single = true);
+
     typename ClassComplexType<T>::Treal GetDroppingThreshold() const;
     typename ClassComplexType<T>::Treal GetDiagonalCoefficient() const;
     typename ClassComplexType<T>::Treal GetPivotThreshold() const;
@@ -133,6 +154,10 @@ namespace Seldon
     void Solve(const SeldonTranspose&, Vector1& z);
 
     void Solve(const SeldonTranspose&, T* x_ptr, int nrhs);
+
+    template<class T1, class Allocator1>
+    void Solve(const SeldonTranspose& TransA,
+               Matrix<T1, General, ColMajor, Allocator1>& x);
     
   };
 
@@ -79,6 +79,8 @@ namespace Seldon
   void SorPreconditioner<T>
   ::Solve(const VirtualMatrix<T>& A, const Vector<T>& r, Vector<T>& z, bool init)
   {
+    SELDON_PROFILE("SorPreconditioner::Solve");
+
     if (init)
       z.Fill(0);
    
@@ -93,6 +95,8 @@ namespace Seldon
   void SorPreconditioner<T>
   ::TransSolve(const VirtualMatrix<T>& A, const Vector<T>& r, Vector<T>& z, bool init)
   {
+    SELDON_PROFILE("SorPreconditioner::TransSolve");
+
     if (init)
       z.Fill(0);
     
@@ -122,6 +126,8 @@ namespace Seldon
   void SorPreconditioner<T>::
   Solve(const Matrix1& A, const Vector1& r, Vector1& z, bool init_guess_null)
   {
+    SELDON_PROFILE("SorPreconditioner::Solve");
+
     if (init_guess_null)
       z.Fill(0);
     
@@ -138,6 +144,8 @@ namespace Seldon
   TransSolve(const Matrix1& A, const Vector1& r,
 	     Vector1& z, bool init_guess_null)
   {
+    SELDON_PROFILE("SorPreconditioner::TransSolve");
+
     if (init_guess_null)
       z.Fill(0);
     
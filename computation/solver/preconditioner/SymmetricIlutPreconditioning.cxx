@@ -71,8 +71,14 @@ namespace Seldon
 
     lfil = n;
     typedef Vector<cplx, VectFull, Allocator2> VectCplx;
-    VectCplx Row_Val(n);
-    IVect Index(n), Row_Ind(n);
+    VectCplx Row_Val;
+    IVect Index, Row_Ind;
+
+    // work arrays are taken from the memory pool
+    Workspace work;
+    work.GetVector(n, Row_Val);
+    work.GetVector(n, Index);
+    work.GetVector(n, Row_Ind);
     Row_Val.Fill(0); Row_Ind.Fill(-1);
 
     Index.Fill(-1);
@@ -172,7 +178,7 @@ namespace Seldon
 	    // We determine smallest column index.
 	    for (j = (j_col+1) ; j < length_lower; j++)
 	      {
-		if (Row_Ind(j) < jrow)
+		if (Row_Ind(j) < size_t(jrow))
 		  {
 		    jrow = Row_Ind(j);
 		    k = j;
@@ -326,6 +332,7 @@ namespace Seldon
 	if (Row_Val(i_row) == czero)
           Row_Val(i_row) = (droptol + 1e-4) * tnorm;
 
+	A.Index(i_row,0) = i_row;
 	A.Value(i_row,0) = one / Row_Val(i_row);
 
       } // end main loop.
@@ -369,8 +376,17 @@ namespace Seldon
       }
 
     typedef Vector<cplx, VectFull, Allocator> VectCplx;
-    VectCplx Row_Val(n);
-    IVect Index(n), Row_Ind(n), Row_Level(n);
+    VectCplx Row_Val;
+    IVect Index, Row_Ind;
+    // levels are signed, -1 marking an entry of the original matrix
+    Vector<int> Row_Level;
+
+    // work arrays are taken from the memory pool
+    Workspace work;
+    work.GetVector(n, Row_Val);
+    work.GetVector(n, Index);
+    work.GetVector(n, Row_Ind);
+    work.GetVector(n, Row_Level);
     Row_Val.Fill(0); Row_Ind.Fill(-1);
     Row_Level.Fill(-1);
     Index.Fill(-1);
@@ -383,7 +399,7 @@ namespace Seldon
     
     A.Clear();
     A.Reallocate(n, n);
-    Vector<IVect, VectFull, NewAlloc<IVect> > levs(n);
+    Vector<Vector<int>, VectFull, NewAlloc<Vector<int> > > levs(n);
     
     // Main loop.
     int new_percent = 0, old_percent = 0;
@@ -481,7 +497,7 @@ namespace Seldon
 	    // We determine smallest column index.
 	    for (j = (j_col+1) ; j < length_lower; j++)
 	      {
-		if (Row_Ind(j) < jrow)
+		if (Row_Ind(j) < size_t(jrow))
 		  {
 		    jrow = Row_Ind(j);
 		    k = j;		    
@@ -639,7 +655,7 @@ namespace Seldon
     cplx one, invDiag, fact, zero;
     SetComplexOne(one);
     SetComplexZero(zero);
-    IVect Index(n);
+    Vector<int> Index(n);
     Index.Fill(-1);
     // loop on rows
     for (int i = 0; i < n; i++)
@@ -651,7 +667,7 @@ namespace Seldon
 	    abort();
 	  }
 	
-	if (A.Index(i, 0) != i)
+	if (A.Index(i, 0) != size_t(i))
 	  {
 	    cout << "No diagonal element on row " << i << endl;
 	    cout << "ILU(0) needs one" << endl;
@@ -724,7 +740,7 @@ namespace Seldon
 	    abort();
 	  }
 	
-	if (A.Index(i, 0) != i)
+	if (A.Index(i, 0) != size_t(i))
 	  {
 	    cout << "No diagonal element on row " << i << endl;
 	    cout << "ILU(0) needs one" << endl;
@@ -750,7 +766,7 @@ namespace Seldon
 	    fact = A.Value(i, jloc) * invDiag;
 	    
 	    int k2 = 0;
-	    while ((k2 < A.GetRowSize(i)) && (A.Index(i, k2) < j))
+	    while ((k2 < A.GetRowSize(i)) && (A.Index(i, k2) < size_t(j)))
 	      k2++;
 	    
 	    for (int kloc = 0; kloc < A.GetRowSize(j); kloc++)
@@ -759,10 +775,10 @@ namespace Seldon
 		// MILU(0) -> combination performed only if a non-zero entry
 		// exists at position (j, k)
 		// Fill-in elements are summed and reported to the diagonal
-		while ((k2 < A.GetRowSize(i)) && (A.Index(i, k2) < k))
+		while ((k2 < A.GetRowSize(i)) && (A.Index(i, k2) < size_t(k)))
 		  SumRow(j) -= fact * A.Value(i, k2++);
 		
-		if ((k2 < A.GetRowSize(i)) && (A.Index(i, k2) == k))
+		if ((k2 < A.GetRowSize(i)) && (A.Index(i, k2) == size_t(k)))
 		  A.Value(j, kloc) -= fact * A.Value(i, k2++);
 	      }
 	    
@@ -8,6 +8,7 @@
 #include "SeldonHeader.hxx"
 
 #ifndef SELDON_WITH_COMPILED_LIBRARY
+#include "SeldonInline.hxx"
 #include "vector/Vector.cxx"
 #include "matrix/Matrix_Base.cxx"
 #include "matrix/Matrix_Pointers.cxx"
@@ -18,12 +19,15 @@
 #include "matrix_sparse/Matrix_Sparse.cxx"
 #include "share/Allocator.cxx"
 #include "share/AllocatorInline.cxx"
+#include "share/Parallel.cxx"
 #include "share/StorageInline.cxx"
 #include "share/MatrixFlagInline.cxx"
 #include "computation/interfaces/Blas_1.cxx"
 #include "computation/interfaces/Blas_2.cxx"
 #include "computation/interfaces/Blas_3.cxx"
 #include "computation/basic_functions/Functions_Vector.cxx"
+#include "computation/basic_functions/Functions_VectorSimd.cxx"
+#include "computation/basic_functions/Functions_VectorReproducible.cxx"
 #include "computation/basic_functions/Functions_MatVect.cxx"
 #include "computation/basic_functions/Functions_Matrix.cxx"
 #endif
@@ -43,6 +47,8 @@ namespace Seldon
   SELDON_EXTERN template void Swap(Vector<@real_complex>&, Vector<@real_complex>&);
 
   SELDON_EXTERN template void MltScalar(const @scalar&, Vector<@scalar>&);
+  SELDON_EXTERN template void MltScalar(const float&, Vector<complexfloat>&);
+  SELDON_EXTERN template void MltScalar(const double&, Vector<complexdouble>&);
 
   SELDON_EXTERN template void CopyVector(const Vector<@real_complex>&, Vector<@real_complex>&);
 
@@ -0,0 +1,103 @@
+// Copyright (C) 2016 INRIA
+//
+// This file is part of the linear-algebra library Seldon,
+// http://seldon.sourceforge.net/.
+//
+// Seldon is free software; you can redistribute it and/or modify it under the
+// terms of the GNU Lesser General Public License as published by the Free
+// Software Foundation; either version 2.1 of the License, or (at your option)
+// any later version.
+//
+// Seldon is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for
+// more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with Seldon. If not, see http://www.gnu.org/licenses/.
+
+
+#ifndef SELDON_WITH_COMPILED_LIBRARY
+// SeldonTranspose must have the same layout as in the Blas objects.
+#ifndef SELDON_WITH_BLAS
+#define SELDON_WITH_BLAS
+#endif
+#ifndef SELDON_WITH_LAPACK
+#define SELDON_WITH_LAPACK
+#endif
+#endif
+
+#include "SeldonHeader.hxx"
+#include "SeldonInline.hxx"
+#include "SeldonSolverHeader.hxx"
+#include "SeldonSolverInline.hxx"
+
+#ifndef SELDON_WITH_COMPILED_LIBRARY
+#include "share/Allocator.cxx"
+#include "share/MemoryPool.cxx"
+#include "share/Parallel.cxx"
+#include "matrix/Matrix_Base.cxx"
+#include "matrix/Matrix_Pointers.cxx"
+#include "matrix/Matrix_Triangular.cxx"
+#include "matrix/Matrix_Symmetric.cxx"
+#include "matrix/Matrix_Hermitian.cxx"
+#include "matrix_sparse/Matrix_Sparse.cxx"
+#include "matrix_sparse/Matrix_SymSparse.cxx"
+#include "matrix/Matrix_SymPacked.cxx"
+#include "matrix/Matrix_HermPacked.cxx"
+#include "matrix/Matrix_TriangPacked.cxx"
+#include "vector/Vector.cxx"
+#include "vector/Functions_Arrays.cxx"
+#include "vector/SparseVector.cxx"
+#include "matrix/Functions.cxx"
+#include "matrix_sparse/IOMatrixMarket.cxx"
+#include "matrix_sparse/Matrix_Conversions.cxx"
+#include "matrix_sparse/Matrix_ArraySparse.cxx"
+#include "matrix_sparse/Permutation_ScalingMatrix.cxx"
+#include "matrix_sparse/Relaxation_MatVect.cxx"
+#include "matrix_sparse/Functions_MatrixArray.cxx"
+#include "computation/basic_functions/Functions_Matrix.cxx"
+#include "computation/basic_functions/Functions_Vector.cxx"
+#include "computation/basic_functions/Functions_VectorSimd.cxx"
+#include "computation/basic_functions/Functions_VectorReproducible.cxx"
+#include "computation/basic_functions/Functions_MatVect.cxx"
+#include "computation/basic_functions/Functions_Base.cxx"
+#ifdef SELDON_WITH_BLAS
+#include "computation/interfaces/Blas_2.cxx"
+#include "computation/interfaces/Blas_3.cxx"
+#endif
+#ifdef SELDON_WITH_LAPACK
+#include "computation/interfaces/Lapack_LinearEquations.cxx"
+#endif
+#endif
+
+#include <complex>
+typedef std::complex<float> complexfloat;
+typedef std::complex<double> complexdouble;
+
+
+namespace Seldon
+{
+
+  /* Between general sparse formats */
+
+  SELDON_EXTERN template void CopyMatrix(const Matrix<@sparse_scalar, General, ArrayRowSparse>&, Matrix<@sparse_scalar, General, RowSparse>&);
+  SELDON_EXTERN template void CopyMatrix(const Matrix<@sparse_scalar, General, ArrayRowSparse>&, Matrix<@sparse_scalar, General, ColSparse>&);
+  SELDON_EXTERN template void CopyMatrix(const Matrix<@sparse_scalar, General, RowSparse>&, Matrix<@sparse_scalar, General, ArrayRowSparse>&);
+  SELDON_EXTERN template void CopyMatrix(const Matrix<@sparse_scalar, General, RowSparse>&, Matrix<@sparse_scalar, General, ColSparse>&);
+  SELDON_EXTERN template void CopyMatrix(const Matrix<@sparse_scalar, General, ColSparse>&, Matrix<@sparse_scalar, General, RowSparse>&);
+  SELDON_EXTERN template void CopyMatrix(const Matrix<@sparse_scalar, General, ColSparse>&, Matrix<@sparse_scalar, General, ArrayRowSparse>&);
+  SELDON_EXTERN template void CopyMatrix(const Matrix<@sparse_scalar, General, @storage_sparse_general>&, Matrix<@sparse_scalar, General, @storage_sparse_general>&);
+
+  /* From symmetric sparse formats */
+
+  SELDON_EXTERN template void CopyMatrix(const Matrix<@sparse_scalar, Symmetric, ArrayRowSymSparse>&, Matrix<@sparse_scalar, Symmetric, RowSymSparse>&);
+  SELDON_EXTERN template void CopyMatrix(const Matrix<@sparse_scalar, Symmetric, ArrayRowSymSparse>&, Matrix<@sparse_scalar, General, RowSparse>&);
+  SELDON_EXTERN template void CopyMatrix(const Matrix<@sparse_scalar, Symmetric, ArrayRowSymSparse>&, Matrix<@sparse_scalar, General, ColSparse>&);
+  SELDON_EXTERN template void CopyMatrix(const Matrix<@sparse_scalar, Symmetric, RowSymSparse>&, Matrix<@sparse_scalar, Symmetric, ArrayRowSymSparse>&);
+  SELDON_EXTERN template void CopyMatrix(const Matrix<@sparse_scalar, Symmetric, RowSymSparse>&, Matrix<@sparse_scalar, General, RowSparse>&);
+  SELDON_EXTERN template void CopyMatrix(const Matrix<@sparse_scalar, Symmetric, RowSymSparse>&, Matrix<@sparse_scalar, General, ColSparse>&);
+  SELDON_EXTERN template void CopyMatrix(const Matrix<@sparse_scalar, Symmetric, RowSymSparse>&, Matrix<@sparse_scalar, General, ArrayRowSparse>&);
+  SELDON_EXTERN template void CopyMatrix(const Matrix<@sparse_scalar, Symmetric, @storage_sparse_symmetric>&, Matrix<@sparse_scalar, Symmetric, @storage_sparse_symmetric>&);
+
+}
@@ -0,0 +1,144 @@
+// Copyright (C) 2016 INRIA
+//
+// This file is part of the linear-algebra library Seldon,
+// http://seldon.sourceforge.net/.
+//
+// Seldon is free software; you can redistribute it and/or modify it under the
+// terms of the GNU Lesser General Public License as published by the Free
+// Software Foundation; either version 2.1 of the License, or (at your option)
+// any later version.
+//
+// Seldon is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for
+// more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with Seldon. If not, see http://www.gnu.org/licenses/.
+
+
+#ifndef SELDON_WITH_COMPILED_LIBRARY
+#ifndef SELDON_WITH_PRECONDITIONING
+#define SELDON_WITH_PRECONDITIONING
+#endif
+// Gmres solves its Hessenberg system with Blas.
+#ifndef SELDON_WITH_BLAS
+#define SELDON_WITH_BLAS
+#endif
+#ifndef SELDON_WITH_LAPACK
+#define SELDON_WITH_LAPACK
+#endif
+#endif
+
+#include "SeldonHeader.hxx"
+#include "SeldonInline.hxx"
+#include "SeldonSolverHeader.hxx"
+#include "SeldonSolverInline.hxx"
+
+#ifndef SELDON_WITH_COMPILED_LIBRARY
+#include "share/Allocator.cxx"
+#include "share/MemoryPool.cxx"
+#include "share/Parallel.cxx"
+#include "matrix/Matrix_Base.cxx"
+#include "matrix/Matrix_Pointers.cxx"
+#include "matrix/Matrix_Triangular.cxx"
+#include "matrix/Matrix_Symmetric.cxx"
+#include "matrix/Matrix_Hermitian.cxx"
+#include "matrix_sparse/Matrix_Sparse.cxx"
+#include "matrix_sparse/Matrix_SymSparse.cxx"
+#include "matrix/Matrix_SymPacked.cxx"
+#include "matrix/Matrix_HermPacked.cxx"
+#include "matrix/Matrix_TriangPacked.cxx"
+#include "vector/Vector.cxx"
+#include "vector/Functions_Arrays.cxx"
+#include "vector/SparseVector.cxx"
+#include "matrix/Functions.cxx"
+#include "matrix_sparse/IOMatrixMarket.cxx"
+#include "matrix_sparse/Matrix_Conversions.cxx"
+#include "matrix_sparse/Matrix_ArraySparse.cxx"
+#include "matrix_sparse/Permutation_ScalingMatrix.cxx"
+#include "matrix_sparse/Relaxation_MatVect.cxx"
+#include "matrix_sparse/Matrix_ReducedPrecision.cxx"
+#include "matrix_sparse/Functions_MatrixArray.cxx"
+#include "computation/basic_functions/Functions_Matrix.cxx"
+#include "computation/basic_functions/Functions_Vector.cxx"
+#include "computation/basic_functions/Functions_VectorSimd.cxx"
+#include "computation/basic_functions/Functions_VectorReproducible.cxx"
+#include "computation/basic_functions/Functions_MatVect.cxx"
+#include "computation/basic_functions/Functions_Base.cxx"
+#ifdef SELDON_WITH_BLAS
+#include "computation/interfaces/Blas_2.cxx"
+#include "computation/interfaces/Blas_3.cxx"
+#endif
+#ifdef SELDON_WITH_LAPACK
+#include "computation/interfaces/Lapack_LinearEquations.cxx"
+#endif
+#include "computation/solver/preconditioner/Precond_Ssor.cxx"
+#include "computation/solver/preconditioner/IlutPreconditioning.cxx"
+#include "computation/solver/Ordering.cxx"
+#include "computation/solver/TriangularLevelSet.cxx"
+#include "computation/solver/SparseSolver.cxx"
+#include "computation/solver/OutOfCoreStorage.cxx"
+#include "computation/solver/SparseSupernodalSolver.cxx"
+#include "computation/interfaces/direct/SparseDirectSolver.cxx"
+#include "computation/solver/iterative/Iterative.cxx"
+#endif
+
+#include <complex>
+typedef std::complex<float> complexfloat;
+typedef std::complex<double> complexdouble;
+
+
+namespace Seldon
+{
+
+  /* Preconditioners */
+
+  SELDON_EXTERN template class Iteration<double>;
+  SELDON_EXTERN template class Preconditioner_Base<@sparse_scalar>;
+
+#ifdef SELDON_WITH_PRECONDITIONING
+  SELDON_EXTERN template class IlutPreconditioning<@sparse_scalar, MallocAlloc<@sparse_scalar> >;
+
+  SELDON_EXTERN template void IlutPreconditioning<@sparse_scalar, MallocAlloc<@sparse_scalar> >::FactorizeMatrix(const IVect&, Matrix<@sparse_scalar, General, ArrayRowSparse>&, bool);
+  SELDON_EXTERN template void IlutPreconditioning<@sparse_scalar, MallocAlloc<@sparse_scalar> >::FactorizeMatrix(const IVect&, Matrix<@sparse_scalar, Symmetric, ArrayRowSymSparse>&, bool);
+  SELDON_EXTERN template void IlutPreconditioning<@sparse_scalar, MallocAlloc<@sparse_scalar> >::Solve(Vector<@sparse_scalar>&);
+  SELDON_EXTERN template void IlutPreconditioning<@sparse_scalar, MallocAlloc<@sparse_scalar> >::TransSolve(Vector<@sparse_scalar>&);
+  SELDON_EXTERN template void IlutPreconditioning<@sparse_scalar, MallocAlloc<@sparse_scalar> >::Solve(const SeldonTranspose&, Vector<@sparse_scalar>&);
+#endif
+
+  /* Direct solvers */
+
+  SELDON_EXTERN template class SparseDirectSolver<@sparse_scalar>;
+
+  SELDON_EXTERN template void SparseDirectSolver<@sparse_scalar>::Factorize(Matrix<@sparse_scalar, General, @storage_solver_general>&, bool);
+  SELDON_EXTERN template void SparseDirectSolver<@sparse_scalar>::Factorize(Matrix<@sparse_scalar, Symmetric, @storage_solver_symmetric>&, bool);
+  SELDON_EXTERN template void SparseDirectSolver<@sparse_scalar>::Analyze(Matrix<@sparse_scalar, General, @storage_solver_general>&);
+  SELDON_EXTERN template void SparseDirectSolver<@sparse_scalar>::Analyze(Matrix<@sparse_scalar, Symmetric, @storage_solver_symmetric>&);
+  SELDON_EXTERN template void SparseDirectSolver<@sparse_scalar>::FactorizeNumeric(Matrix<@sparse_scalar, General, @storage_solver_general>&, bool);
+  SELDON_EXTERN template void SparseDirectSolver<@sparse_scalar>::FactorizeNumeric(Matrix<@sparse_scalar, Symmetric, @storage_solver_symmetric>&, bool);
+
+  /* Iterative solvers */
+
+#ifdef SELDON_WITH_VIRTUAL
+  SELDON_EXTERN template int @iterative_solver(const VirtualMatrix<@sparse_scalar>&, Vector<@sparse_scalar>&, const Vector<@sparse_scalar>&, Preconditioner_Base<@sparse_scalar>&, Iteration<double>&);
+#else
+  SELDON_EXTERN template void Preconditioner_Base<@sparse_scalar>::Solve(const Matrix<@sparse_scalar, General, @storage_solver_general>&, const Vector<@sparse_scalar>&, Vector<@sparse_scalar>&);
+  SELDON_EXTERN template void Preconditioner_Base<@sparse_scalar>::Solve(const Matrix<@sparse_scalar, Symmetric, @storage_solver_symmetric>&, const Vector<@sparse_scalar>&, Vector<@sparse_scalar>&);
+  SELDON_EXTERN template int @iterative_solver(const Matrix<@sparse_scalar, General, @storage_solver_general>&, Vector<@sparse_scalar>&, const Vector<@sparse_scalar>&, Preconditioner_Base<@sparse_scalar>&, Iteration<double>&);
+  SELDON_EXTERN template int @iterative_solver(const Matrix<@sparse_scalar, Symmetric, @storage_solver_symmetric>&, Vector<@sparse_scalar>&, const Vector<@sparse_scalar>&, Preconditioner_Base<@sparse_scalar>&, Iteration<double>&);
+
+#ifdef SELDON_WITH_PRECONDITIONING
+  SELDON_EXTERN template void IlutPreconditioning<@sparse_scalar, MallocAlloc<@sparse_scalar> >::Solve(const Matrix<@sparse_scalar, General, @storage_solver_general>&, const Vector<@sparse_scalar>&, Vector<@sparse_scalar>&);
+  SELDON_EXTERN template void IlutPreconditioning<@sparse_scalar, MallocAlloc<@sparse_scalar> >::Solve(const Matrix<@sparse_scalar, Symmetric, @storage_solver_symmetric>&, const Vector<@sparse_scalar>&, Vector<@sparse_scalar>&);
+  SELDON_EXTERN template int @iterative_solver(const Matrix<@sparse_scalar, General, @storage_solver_general>&, Vector<@sparse_scalar>&, const Vector<@sparse_scalar>&, IlutPreconditioning<@sparse_scalar, MallocAlloc<@sparse_scalar> >&, Iteration<double>&);
+  SELDON_EXTERN template int @iterative_solver(const Matrix<@sparse_scalar, Symmetric, @storage_solver_symmetric>&, Vector<@sparse_scalar>&, const Vector<@sparse_scalar>&, IlutPreconditioning<@sparse_scalar, MallocAlloc<@sparse_scalar> >&, Iteration<double>&);
+#endif
+#endif
+
+#ifndef SELDON_WITH_COMPILED_LIBRARY
+  // the eigenvalue interfaces only define this member without the library
+  int TypeEigenvalueSolver::default_solver(0);
+#endif
+
+}
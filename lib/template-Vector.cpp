@@ -20,6 +20,7 @@
 #include "SeldonHeader.hxx"
 
 #ifndef SELDON_WITH_COMPILED_LIBRARY
+#include "SeldonInline.hxx"
 #include "share/Errors.hxx"
 #include "share/Allocator.cxx"
 #include "vector/VectorInline.cxx"
@@ -0,0 +1,585 @@
+// Copyright (C) 2016 INRIA
+//
+// This file is part of the linear-algebra library Seldon,
+// http://seldon.sourceforge.net/.
+//
+// Seldon is free software; you can redistribute it and/or modify it under the
+// terms of the GNU Lesser General Public License as published by the Free
+// Software Foundation; either version 2.1 of the License, or (at your option)
+// any later version.
+//
+// Seldon is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for
+// more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with Seldon. If not, see http://www.gnu.org/licenses/.
+
+
+#ifndef SELDON_FILE_MATRIX_BATCH_CXX
+
+
+#include "MatrixBatch.hxx"
+
+
+namespace Seldon
+{
+
+
+  /////////////////
+  // MATRIXBATCH //
+  /////////////////
+
+
+  /****************
+   * CONSTRUCTORS *
+   ****************/
+
+
+  //! Default constructor.
+  /*!
+    On exit, the batch is empty.
+  */
+  template <class T, class Allocator>
+  MatrixBatch<T, Allocator>::MatrixBatch()
+  {
+    nb_ = 0;
+    m_ = 0;
+    n_ = 0;
+  }
+
+
+  //! Main constructor.
+  /*!
+    \param[in] nb number of matrices.
+    \param[in] m number of rows of each matrix.
+    \param[in] n number of columns of each matrix.
+    \warning The matrices are not initialized.
+  */
+  template <class T, class Allocator>
+  MatrixBatch<T, Allocator>::MatrixBatch(size_t nb, size_t m, size_t n)
+  {
+    nb_ = 0;
+    m_ = 0;
+    n_ = 0;
+    Reallocate(nb, m, n);
+  }
+
+
+  /*********************
+   * MEMORY MANAGEMENT *
+   *********************/
+
+
+  //! Reallocates the batch.
+  /*!
+    \param[in] nb number of matrices.
+    \param[in] m number of rows of each matrix.
+    \param[in] n number of columns of each matrix.
+    \warning Previous values are lost, the matrices are not initialized.
+  */
+  template <class T, class Allocator>
+  void MatrixBatch<T, Allocator>::Reallocate(size_t nb, size_t m, size_t n)
+  {
+    nb_ = nb;
+    m_ = m;
+    n_ = n;
+    data_.Reallocate(GetNbPack()*m_*n_*pack_size);
+    FillPadding();
+  }
+
+
+  //! Releases the memory used by the batch.
+  template <class T, class Allocator>
+  void MatrixBatch<T, Allocator>::Clear()
+  {
+    data_.Clear();
+    nb_ = 0;
+    m_ = 0;
+    n_ = 0;
+  }
+
+
+  /*******************
+   * BASIC FUNCTIONS *
+   *******************/
+
+
+  /**********************************
+   * ELEMENT ACCESS AND AFFECTATION *
+   **********************************/
+
+
+  /************************
+   * CONVENIENT FUNCTIONS *
+   ************************/
+
+
+  //! Sets all matrices to zero.
+  template <class T, class Allocator>
+  void MatrixBatch<T, Allocator>::Zero()
+  {
+    T zero;
+    SetComplexZero(zero);
+    data_.Fill(zero);
+    FillPadding();
+  }
+
+
+  //! Sets all matrices to the identity.
+  template <class T, class Allocator>
+  void MatrixBatch<T, Allocator>::SetIdentity()
+  {
+    T zero, one;
+    SetComplexZero(zero);
+    SetComplexOne(one);
+    data_.Fill(zero);
+    size_t mn = min(m_, n_);
+    for (size_t p = 0; p < GetNbPack(); p++)
+      {
+	T* a = GetPack(p);
+	for (size_t i = 0; i < mn; i++)
+	  for (int l = 0; l < pack_size; l++)
+	    a[(i*n_ + i)*pack_size + l] = one;
+      }
+  }
+
+
+  //! Sets all the elements of all matrices to \a x.
+  template <class T, class Allocator> template<class T0>
+  void MatrixBatch<T, Allocator>::Fill(const T0& x)
+  {
+    T x_;
+    SetComplexReal(x, x_);
+    data_.Fill(x_);
+    FillPadding();
+  }
+
+
+  //! Fills the matrices randomly.
+  template <class T, class Allocator>
+  void MatrixBatch<T, Allocator>::FillRand()
+  {
+    data_.FillRand();
+    FillPadding();
+  }
+
+
+  //! Copies a matrix in the batch.
+  /*!
+    \param[in] k matrix number.
+    \param[in] A matrix to be copied in the slot \a k. It must have the
+    dimensions of the batch.
+  */
+  template <class T, class Allocator>
+  template<class Prop0, class Storage0, class Allocator0>
+  void MatrixBatch<T, Allocator>
+  ::SetMatrix(size_t k, const Matrix<T, Prop0, Storage0, Allocator0>& A)
+  {
+
+#ifdef SELDON_CHECK_DIMENSIONS
+    if (size_t(A.GetM()) != m_ || size_t(A.GetN()) != n_)
+      throw WrongDim("MatrixBatch::SetMatrix(int, Matrix)",
+		     "The matrix is " + to_str(A.GetM()) + " x "
+		     + to_str(A.GetN()) + " whereas the batch contains "
+		     + to_str(m_) + " x " + to_str(n_) + " matrices.");
+#endif
+
+    T* a = GetPack(k / pack_size) + k % pack_size;
+    for (size_t i = 0; i < m_; i++)
+      for (size_t j = 0; j < n_; j++)
+	a[(i*n_ + j)*pack_size] = A(i, j);
+  }
+
+
+  //! Extracts a matrix from the batch.
+  /*!
+    \param[in] k matrix number.
+    \param[out] A matrix \a k of the batch.
+  */
+  template <class T, class Allocator>
+  template<class Prop0, class Storage0, class Allocator0>
+  void MatrixBatch<T, Allocator>
+  ::GetMatrix(size_t k, Matrix<T, Prop0, Storage0, Allocator0>& A) const
+  {
+    A.Reallocate(m_, n_);
+    const T* a = GetPack(k / pack_size) + k % pack_size;
+    for (size_t i = 0; i < m_; i++)
+      for (size_t j = 0; j < n_; j++)
+	A.Set(i, j, a[(i*n_ + j)*pack_size]);
+  }
+
+
+  //! Displays the matrix \a k on the standard output.
+  template <class T, class Allocator>
+  void MatrixBatch<T, Allocator>::Print(size_t k) const
+  {
+    for (size_t i = 0; i < m_; i++)
+      {
+	for (size_t j = 0; j < n_; j++)
+	  cout << (*this)(k, i, j) << "\t";
+	cout << endl;
+      }
+  }
+
+
+  //! Sets the unused slots of the last pack to identity matrices.
+  template <class T, class Allocator>
+  void MatrixBatch<T, Allocator>::FillPadding()
+  {
+    size_t nb_pack = GetNbPack();
+    if (nb_pack*pack_size == nb_)
+      return;
+
+    T zero, one;
+    SetComplexZero(zero);
+    SetComplexOne(one);
+    T* a = GetPack(nb_pack - 1);
+    for (size_t i = 0; i < m_; i++)
+      for (size_t j = 0; j < n_; j++)
+	for (size_t l = nb_ % pack_size; l < size_t(pack_size); l++)
+	  a[(i*n_ + j)*pack_size + l] = (i == j) ? one : zero;
+  }
+
+
+  /////////////////////
+  // BATCHED KERNELS //
+  /////////////////////
+
+
+  //! Computes alpha A B + beta C for a single pack.
+  /*!
+    \param[in] alpha scalar.
+    \param[in] a pack of m x k matrices.
+    \param[in] b pack of k x n matrices.
+    \param[in] beta scalar.
+    \param[in,out] c pack of m x n matrices.
+  */
+  template<class T>
+  void MltAddBatchPack(const T& alpha, const T* a, const T* b, const T& beta,
+		       T* c, int m, int k, int n)
+  {
+    const int P = SELDON_BATCH_PACK_SIZE;
+    T zero; SetComplexZero(zero);
+    T alpha_a[P];
+    for (int i = 0; i < m; i++)
+      {
+	T* ci = c + i*n*P;
+	if (beta == zero)
+	  for (int j = 0; j < n*P; j++)
+	    ci[j] = zero;
+	else
+	  for (int j = 0; j < n*P; j++)
+	    ci[j] *= beta;
+
+	for (int p = 0; p < k; p++)
+	  {
+	    const T* aip = a + (i*k + p)*P;
+	    const T* bp = b + p*n*P;
+	    for (int l = 0; l < P; l++)
+	      alpha_a[l] = alpha*aip[l];
+
+	    for (int j = 0; j < n; j++)
+	      for (int l = 0; l < P; l++)
+		ci[j*P + l] += alpha_a[l]*bp[j*P + l];
+	  }
+      }
+  }
+
+
+  //! LU factorization with partial pivoting of a single pack.
+  /*!
+    \param[in,out] a pack of m x m matrices, replaced by their LU factors.
+    \param[out] pivot row interchanges (m x P integers).
+    \return -1 if all the matrices are regular, the lane of the first
+    singular matrix otherwise.
+  */
+  template<class T>
+  int GetLUBatchPack(T* a, int* pivot, int m)
+  {
+    typedef typename ClassComplexType<T>::Treal Treal;
+    const int P = SELDON_BATCH_PACK_SIZE;
+    T one; SetComplexOne(one);
+    int ipiv[P]; Treal vmax[P]; T inv_piv[P];
+    int singular = -1;
+    for (int k = 0; k < m; k++)
+      {
+	// search of the pivot for each matrix of the pack
+	T* ak = a + k*m*P;
+	for (int l = 0; l < P; l++)
+	  {
+	    ipiv[l] = k;
+	    vmax[l] = abs(ak[k*P + l]);
+	  }
+
+	for (int i = k+1; i < m; i++)
+	  {
+	    const T* aik = a + (i*m + k)*P;
+	    for (int l = 0; l < P; l++)
+	      {
+		Treal v = abs(aik[l]);
+		if (v > vmax[l])
+		  {
+		    vmax[l] = v;
+		    ipiv[l] = i;
+		  }
+	      }
+	  }
+
+	// row interchanges, matrix by matrix
+	for (int l = 0; l < P; l++)
+	  {
+	    pivot[k*P + l] = ipiv[l];
+	    if (ipiv[l] != k)
+	      {
+		T* ap = a + ipiv[l]*m*P;
+		for (int j = 0; j < m; j++)
+		  swap(ak[j*P + l], ap[j*P + l]);
+	      }
+
+	    if (vmax[l] == Treal(0))
+	      {
+		if (singular < 0)
+		  singular = l;
+		inv_piv[l] = one;
+	      }
+	    else
+	      inv_piv[l] = one / ak[k*P + l];
+	  }
+
+	// elimination, vectorized over the pack
+	for (int i = k+1; i < m; i++)
+	  {
+	    T* ai = a + i*m*P;
+	    for (int l = 0; l < P; l++)
+	      ai[k*P + l] *= inv_piv[l];
+
+	    for (int j = k+1; j < m; j++)
+	      for (int l = 0; l < P; l++)
+		ai[j*P + l] -= ai[k*P + l]*ak[j*P + l];
+	  }
+      }
+
+    return singular;
+  }
+
+
+  //! Solves A X = B for a single pack, A being factorized by GetLUBatchPack.
+  /*!
+    \param[in] a pack of LU factors (m x m matrices).
+    \param[in] pivot row interchanges computed by GetLUBatchPack.
+    \param[in,out] b on entry the pack of right hand sides (m x nrhs
+    matrices), on exit the solutions.
+  */
+  template<class T>
+  void SolveLUBatchPack(const T* a, const int* pivot, T* b, int m, int nrhs)
+  {
+    const int P = SELDON_BATCH_PACK_SIZE;
+    T one; SetComplexOne(one);
+    T inv_diag[P];
+
+    // row interchanges
+    for (int k = 0; k < m; k++)
+      for (int l = 0; l < P; l++)
+	{
+	  int p = pivot[k*P + l];
+	  if (p != k)
+	    for (int j = 0; j < nrhs; j++)
+	      swap(b[(k*nrhs + j)*P + l], b[(p*nrhs + j)*P + l]);
+	}
+
+    // forward substitution with L (unit diagonal)
+    for (int i = 1; i < m; i++)
+      {
+	T* bi = b + i*nrhs*P;
+	for (int k = 0; k < i; k++)
+	  {
+	    const T* aik = a + (i*m + k)*P;
+	    const T* bk = b + k*nrhs*P;
+	    for (int j = 0; j < nrhs; j++)
+	      for (int l = 0; l < P; l++)
+		bi[j*P + l] -= aik[l]*bk[j*P + l];
+	  }
+      }
+
+    // backward substitution with U
+    for (int i = m-1; i >= 0; i--)
+      {
+	T* bi = b + i*nrhs*P;
+	for (int k = i+1; k < m; k++)
+	  {
+	    const T* aik = a + (i*m + k)*P;
+	    const T* bk = b + k*nrhs*P;
+	    for (int j = 0; j < nrhs; j++)
+	      for (int l = 0; l < P; l++)
+		bi[j*P + l] -= aik[l]*bk[j*P + l];
+	  }
+
+	const T* aii = a + (i*m + i)*P;
+	for (int l = 0; l < P; l++)
+	  inv_diag[l] = one / aii[l];
+
+	for (int j = 0; j < nrhs; j++)
+	  for (int l = 0; l < P; l++)
+	    bi[j*P + l] *= inv_diag[l];
+      }
+  }
+
+
+  //! Computes C_k = A_k B_k for all the matrices of the batch.
+  template<class T, class Allocator1, class Allocator2, class Allocator3>
+  void Mlt(const MatrixBatch<T, Allocator1>& A,
+	   const MatrixBatch<T, Allocator2>& B,
+	   MatrixBatch<T, Allocator3>& C)
+  {
+    T zero, one;
+    SetComplexZero(zero);
+    SetComplexOne(one);
+    MltAdd(one, A, B, zero, C);
+  }
+
+
+  //! Computes C_k = alpha A_k B_k + beta C_k for all the matrices of the batch.
+  /*!
+    \param[in] alpha scalar.
+    \param[in] A batch of m x k matrices.
+    \param[in] B batch of k x n matrices.
+    \param[in] beta scalar.
+    \param[in,out] C batch of m x n matrices.
+  */
+  template<class T0, class T, class Allocator1, class Allocator2,
+	   class Allocator3>
+  void MltAdd(const T0& alpha, const MatrixBatch<T, Allocator1>& A,
+	      const MatrixBatch<T, Allocator2>& B, const T0& beta,
+	      MatrixBatch<T, Allocator3>& C)
+  {
+
+#ifdef SELDON_CHECK_DIMENSIONS
+    if (A.GetNbMatrix() != B.GetNbMatrix()
+	|| A.GetNbMatrix() != C.GetNbMatrix())
+      throw WrongDim("MltAdd(alpha, MatrixBatch, MatrixBatch, beta,"
+		     " MatrixBatch)",
+		     "The batches do not contain the same number of matrices.");
+    if (A.GetN() != B.GetM() || A.GetM() != C.GetM() || B.GetN() != C.GetN())
+      throw WrongDim("MltAdd(alpha, MatrixBatch, MatrixBatch, beta,"
+		     " MatrixBatch)",
+		     "Operation A B + C -> C not permitted: A is "
+		     + to_str(A.GetM()) + " x " + to_str(A.GetN())
+		     + ", B is " + to_str(B.GetM()) + " x " + to_str(B.GetN())
+		     + " and C is " + to_str(C.GetM()) + " x "
+		     + to_str(C.GetN()) + ".");
+#endif
+
+    T alpha_, beta_;
+    SetComplexReal(alpha, alpha_);
+    SetComplexReal(beta, beta_);
+    for (size_t p = 0; p < A.GetNbPack(); p++)
+      MltAddBatchPack(alpha_, A.GetPack(p), B.GetPack(p), beta_, C.GetPack(p),
+		      A.GetM(), A.GetN(), B.GetN());
+  }
+
+
+  //! LU factorization with partial pivoting of all the matrices of a batch.
+  /*!
+    \param[in,out] A on entry, the square matrices to be factorized; on exit,
+    their LU factorizations (L with unit diagonal in the lower part, U in the
+    upper part).
+    \param[out] pivot row interchanges, stored pack by pack.
+  */
+  template<class T, class Allocator>
+  void GetLU(MatrixBatch<T, Allocator>& A, Vector<int>& pivot)
+  {
+    int m = A.GetM();
+    int P = A.GetPackSize();
+
+#ifdef SELDON_CHECK_DIMENSIONS
+    if (A.GetM() != A.GetN())
+      throw WrongDim("GetLU(MatrixBatch&, Vector<int>&)",
+		     "The matrices must be squared.");
+#endif
+
+    pivot.Reallocate(A.GetNbPack()*m*P);
+    for (size_t p = 0; p < A.GetNbPack(); p++)
+      {
+	int l = GetLUBatchPack(A.GetPack(p), pivot.GetData() + p*m*P, m);
+	if (l >= 0)
+	  throw WrongArgument("GetLU(MatrixBatch&, Vector<int>&)",
+			      "The matrix " + to_str(p*P + l)
+			      + " of the batch is singular.");
+      }
+  }
+
+
+  //! Solves A_k X_k = B_k for all the matrices of a batch.
+  /*!
+    \param[in] A LU factorizations computed by GetLU.
+    \param[in] pivot row interchanges computed by GetLU.
+    \param[in,out] B on entry, the right hand sides (m x nrhs matrices); on
+    exit, the solutions.
+  */
+  template<class T, class Allocator1, class Allocator2>
+  void SolveLU(const MatrixBatch<T, Allocator1>& A, const Vector<int>& pivot,
+	       MatrixBatch<T, Allocator2>& B)
+  {
+    int m = A.GetM();
+    int P = A.GetPackSize();
+
+#ifdef SELDON_CHECK_DIMENSIONS
+    if (A.GetNbMatrix() != B.GetNbMatrix() || A.GetM() != B.GetM())
+      throw WrongDim("SolveLU(MatrixBatch, Vector<int>, MatrixBatch&)",
+		     "Incompatible dimensions between the factorizations and"
+		     " the right hand sides.");
+#endif
+
+    for (size_t p = 0; p < A.GetNbPack(); p++)
+      SolveLUBatchPack(A.GetPack(p), pivot.GetData() + p*m*P, B.GetPack(p),
+		       m, B.GetN());
+  }
+
+
+  //! Replaces all the matrices of a batch by their inverses.
+  template<class T, class Allocator>
+  void GetInverse(MatrixBatch<T, Allocator>& A)
+  {
+    int m = A.GetM();
+    int P = A.GetPackSize();
+
+#ifdef SELDON_CHECK_DIMENSIONS
+    if (A.GetM() != A.GetN())
+      throw WrongDim("GetInverse(MatrixBatch&)",
+		     "The matrices must be squared.");
+#endif
+
+    T zero, one;
+    SetComplexZero(zero);
+    SetComplexOne(one);
+    Vector<T> lu(m*m*P);
+    Vector<int> pivot(m*P);
+    for (size_t p = 0; p < A.GetNbPack(); p++)
+      {
+	T* a = A.GetPack(p);
+	for (int i = 0; i < m*m*P; i++)
+	  lu(i) = a[i];
+
+	int l = GetLUBatchPack(lu.GetData(), pivot.GetData(), m);
+	if (l >= 0)
+	  throw WrongArgument("GetInverse(MatrixBatch&)",
+			      "The matrix " + to_str(p*P + l)
+			      + " of the batch is singular.");
+
+	for (int i = 0; i < m; i++)
+	  for (int j = 0; j < m; j++)
+	    for (int q = 0; q < P; q++)
+	      a[(i*m + j)*P + q] = (i == j) ? one : zero;
+
+	SolveLUBatchPack(lu.GetData(), pivot.GetData(), a, m, m);
+      }
+  }
+
+
+} // namespace Seldon.
+
+
+#define SELDON_FILE_MATRIX_BATCH_CXX
+#endif
@@ -0,0 +1,157 @@
+// Copyright (C) 2016 INRIA
+//
+// This file is part of the linear-algebra library Seldon,
+// http://seldon.sourceforge.net/.
+//
+// Seldon is free software; you can redistribute it and/or modify it under the
+// terms of the GNU Lesser General Public License as published by the Free
+// Software Foundation; either version 2.1 of the License, or (at your option)
+// any later version.
+//
+// Seldon is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for
+// more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with Seldon. If not, see http://www.gnu.org/licenses/.
+
+
+#ifndef SELDON_FILE_MATRIX_BATCH_HXX
+
+
+#ifndef SELDON_BATCH_PACK_SIZE
+/*! \def SELDON_BATCH_PACK_SIZE
+  Number of matrices interleaved in a pack of MatrixBatch. The innermost
+  loops of the batched kernels run over this dimension, so that it should be
+  a multiple of the SIMD width (8 is suitable for AVX-512 in double
+  precision).
+*/
+#define SELDON_BATCH_PACK_SIZE 8
+#endif
+
+
+namespace Seldon
+{
+
+
+  //! Batch of dense matrices of the same size.
+  /*! MatrixBatch stores \a nb matrices of size \a m x \a n in a single
+    contiguous array. The matrices are gathered in packs of
+    SELDON_BATCH_PACK_SIZE matrices, and within a pack the element (i, j) of
+    all matrices are contiguous:
+    \f[ data[((k / P) m n + i n + j) P + k \% P] = A_k(i, j) \f]
+    with P = SELDON_BATCH_PACK_SIZE. The batched kernels (Mlt, MltAdd, GetLU,
+    SolveLU, GetInverse) therefore vectorize over the batch dimension. The
+    last pack is completed with identity matrices (when m = n) so that
+    factorizations remain valid on the unused slots.
+  */
+  template <class T, class Allocator
+	    = typename SeldonDefaultAllocator<VectFull, T>::allocator>
+  class MatrixBatch
+  {
+  public:
+    typedef T value_type;
+    typedef T* pointer;
+    typedef const T* const_pointer;
+    typedef T& reference;
+    typedef const T& const_reference;
+
+    //! number of matrices in a pack
+    static const int pack_size = SELDON_BATCH_PACK_SIZE;
+
+  protected:
+    //! number of matrices
+    size_t nb_;
+    //! number of rows of each matrix
+    size_t m_;
+    //! number of columns of each matrix
+    size_t n_;
+    //! values of all matrices (packed storage)
+    Vector<T, VectFull, Allocator> data_;
+
+  public:
+    MatrixBatch();
+    MatrixBatch(size_t nb, size_t m, size_t n);
+
+    void Reallocate(size_t nb, size_t m, size_t n);
+    void Clear();
+
+    size_t GetNbMatrix() const;
+    size_t GetM() const;
+    size_t GetN() const;
+    size_t GetNbPack() const;
+    size_t GetPackSize() const;
+    size_t GetDataSize() const;
+    int64_t GetMemorySize() const;
+
+    pointer GetData() const;
+    pointer GetPack(size_t p) const;
+
+    reference operator() (size_t k, size_t i, size_t j);
+#ifndef SWIG
+    const_reference operator() (size_t k, size_t i, size_t j) const;
+#endif
+
+    void Zero();
+    void SetIdentity();
+    template<class T0>
+    void Fill(const T0& x);
+    void FillRand();
+
+    template<class Prop0, class Storage0, class Allocator0>
+    void SetMatrix(size_t k, const Matrix<T, Prop0, Storage0, Allocator0>& A);
+
+    template<class Prop0, class Storage0, class Allocator0>
+    void GetMatrix(size_t k, Matrix<T, Prop0, Storage0, Allocator0>& A) const;
+
+    void Print(size_t k) const;
+
+  protected:
+    void FillPadding();
+
+  };
+
+
+  /////////////////////
+  // BATCHED KERNELS //
+  /////////////////////
+
+
+  template<class T, class Allocator1, class Allocator2, class Allocator3>
+  void Mlt(const MatrixBatch<T, Allocator1>& A,
+	   const MatrixBatch<T, Allocator2>& B,
+	   MatrixBatch<T, Allocator3>& C);
+
+  template<class T0, class T, class Allocator1, class Allocator2,
+	   class Allocator3>
+  void MltAdd(const T0& alpha, const MatrixBatch<T, Allocator1>& A,
+	      const MatrixBatch<T, Allocator2>& B, const T0& beta,
+	      MatrixBatch<T, Allocator3>& C);
+
+  template<class T, class Allocator>
+  void GetLU(MatrixBatch<T, Allocator>& A, Vector<int>& pivot);
+
+  template<class T, class Allocator1, class Allocator2>
+  void SolveLU(const MatrixBatch<T, Allocator1>& A, const Vector<int>& pivot,
+	       MatrixBatch<T, Allocator2>& B);
+
+  template<class T, class Allocator>
+  void GetInverse(MatrixBatch<T, Allocator>& A);
+
+  template<class T>
+  void MltAddBatchPack(const T& alpha, const T* a, const T* b, const T& beta,
+		       T* c, int m, int k, int n);
+
+  template<class T>
+  int GetLUBatchPack(T* a, int* pivot, int m);
+
+  template<class T>
+  void SolveLUBatchPack(const T* a, const int* pivot, T* b, int m, int nrhs);
+
+
+} // namespace Seldon.
+
+
+#define SELDON_FILE_MATRIX_BATCH_HXX
+#endif
@@ -0,0 +1,162 @@
+// Copyright (C) 2016 INRIA
+//
+// This file is part of the linear-algebra library Seldon,
+// http://seldon.sourceforge.net/.
+//
+// Seldon is free software; you can redistribute it and/or modify it under the
+// terms of the GNU Lesser General Public License as published by the Free
+// Software Foundation; either version 2.1 of the License, or (at your option)
+// any later version.
+//
+// Seldon is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for
+// more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with Seldon. If not, see http://www.gnu.org/licenses/.
+
+
+#ifndef SELDON_FILE_MATRIX_BATCH_INLINE_CXX
+
+
+#include "MatrixBatch.hxx"
+
+
+namespace Seldon
+{
+
+
+  /////////////////
+  // MATRIXBATCH //
+  /////////////////
+
+
+  //! Returns the number of matrices stored in the batch.
+  template <class T, class Allocator>
+  inline size_t MatrixBatch<T, Allocator>::GetNbMatrix() const
+  {
+    return nb_;
+  }
+
+
+  //! Returns the number of rows of each matrix.
+  template <class T, class Allocator>
+  inline size_t MatrixBatch<T, Allocator>::GetM() const
+  {
+    return m_;
+  }
+
+
+  //! Returns the number of columns of each matrix.
+  template <class T, class Allocator>
+  inline size_t MatrixBatch<T, Allocator>::GetN() const
+  {
+    return n_;
+  }
+
+
+  //! Returns the number of packs.
+  template <class T, class Allocator>
+  inline size_t MatrixBatch<T, Allocator>::GetNbPack() const
+  {
+    return (nb_ + pack_size - 1) / pack_size;
+  }
+
+
+  //! Returns the number of matrices in a pack.
+  template <class T, class Allocator>
+  inline size_t MatrixBatch<T, Allocator>::GetPackSize() const
+  {
+    return pack_size;
+  }
+
+
+  //! Returns the number of elements stored (including the padding).
+  template <class T, class Allocator>
+  inline size_t MatrixBatch<T, Allocator>::GetDataSize() const
+  {
+    return data_.GetM();
+  }
+
+
+  //! Returns the memory used by the object in bytes.
+  template <class T, class Allocator>
+  inline int64_t MatrixBatch<T, Allocator>::GetMemorySize() const
+  {
+    return sizeof(*this) + int64_t(sizeof(T))*GetDataSize();
+  }
+
+
+  //! Returns a pointer to the stored values.
+  template <class T, class Allocator>
+  inline typename MatrixBatch<T, Allocator>::pointer
+  MatrixBatch<T, Allocator>::GetData() const
+  {
+    return data_.GetData();
+  }
+
+
+  //! Returns a pointer to the values of the pack \a p.
+  /*!
+    The pack \a p contains the matrices p P, ..., p P + P - 1 with P =
+    SELDON_BATCH_PACK_SIZE. Within the pack, the element (i, j) of the
+    matrix p P + l is stored at (i n + j) P + l.
+  */
+  template <class T, class Allocator>
+  inline typename MatrixBatch<T, Allocator>::pointer
+  MatrixBatch<T, Allocator>::GetPack(size_t p) const
+  {
+    return data_.GetData() + p*m_*n_*pack_size;
+  }
+
+
+  //! Access operator.
+  /*!
+    \param[in] k matrix number.
+    \param[in] i row index.
+    \param[in] j column index.
+    \return Element (i, j) of the matrix \a k.
+  */
+  template <class T, class Allocator>
+  inline typename MatrixBatch<T, Allocator>::reference
+  MatrixBatch<T, Allocator>::operator() (size_t k, size_t i, size_t j)
+  {
+
+#ifdef SELDON_CHECK_BOUNDS
+    CheckBounds(k, nb_, "MatrixBatch");
+    CheckBounds(i, j, m_, n_, "MatrixBatch");
+#endif
+
+    return data_.GetData()[((k / pack_size)*m_*n_ + i*n_ + j)*pack_size
+			   + k % pack_size];
+  }
+
+
+  //! Access operator.
+  /*!
+    \param[in] k matrix number.
+    \param[in] i row index.
+    \param[in] j column index.
+    \return Element (i, j) of the matrix \a k.
+  */
+  template <class T, class Allocator>
+  inline typename MatrixBatch<T, Allocator>::const_reference
+  MatrixBatch<T, Allocator>::operator() (size_t k, size_t i, size_t j) const
+  {
+
+#ifdef SELDON_CHECK_BOUNDS
+    CheckBounds(k, nb_, "MatrixBatch");
+    CheckBounds(i, j, m_, n_, "MatrixBatch");
+#endif
+
+    return data_.GetData()[((k / pack_size)*m_*n_ + i*n_ + j)*pack_size
+			   + k % pack_size];
+  }
+
+
+} // namespace Seldon.
+
+
+#define SELDON_FILE_MATRIX_BATCH_INLINE_CXX
+#endif
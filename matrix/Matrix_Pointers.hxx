@@ -57,6 +57,10 @@ namespace Seldon
     Matrix_Pointers();
     explicit Matrix_Pointers(size_t i, size_t j);
     Matrix_Pointers(const Matrix_Pointers<T, Prop, Storage, Allocator>& A);
+#ifdef SELDON_WITH_CPP11
+    Matrix_Pointers(Matrix_Pointers<T, Prop, Storage, Allocator>&& A)
+      noexcept;
+#endif
 
     // Destructor.
     ~Matrix_Pointers();
@@ -89,6 +93,10 @@ namespace Seldon
 
     Matrix_Pointers<T, Prop, Storage, Allocator>&
     operator= (const Matrix_Pointers<T, Prop, Storage, Allocator>& A);
+#ifdef SELDON_WITH_CPP11
+    Matrix_Pointers<T, Prop, Storage, Allocator>&
+    operator= (Matrix_Pointers<T, Prop, Storage, Allocator>&& A) noexcept;
+#endif
 #endif
 
     void Set(size_t i, size_t j, const T& val);
@@ -151,6 +159,9 @@ namespace Seldon
     Matrix();
     explicit Matrix(size_t i, size_t j);
     Matrix(const Matrix<T, Prop, ColMajor, Allocator>& A);
+#ifdef SELDON_WITH_CPP11
+    Matrix(Matrix<T, Prop, ColMajor, Allocator>&& A) noexcept;
+#endif
 
     void WriteColumn(string FileName, size_t col) const;
     void WriteColumn(ostream& FileStream, size_t col) const;
@@ -160,6 +171,11 @@ namespace Seldon
     Matrix<T, Prop, ColMajor, Allocator>& operator= (const T0& x);
     Matrix<T, Prop, ColMajor, Allocator>& operator=(const Matrix<T, Prop,
                                                     ColMajor, Allocator>& A);
+#ifdef SELDON_WITH_CPP11
+    Matrix<T, Prop, ColMajor, Allocator>& operator=(Matrix<T, Prop,
+                                                    ColMajor, Allocator>&& A)
+      noexcept;
+#endif
 #endif
     template<class T0>
     Matrix<T, Prop, ColMajor, Allocator>& operator*= (const T0& x);
@@ -182,6 +198,9 @@ namespace Seldon
     Matrix();
     explicit Matrix(size_t i, size_t j);
     Matrix(const Matrix<T, Prop, RowMajor, Allocator>& A);
+#ifdef SELDON_WITH_CPP11
+    Matrix(Matrix<T, Prop, RowMajor, Allocator>&& A) noexcept;
+#endif
 
     void WriteRow(string FileName, size_t row) const;
     void WriteRow(ostream& FileStream, size_t row) const;
@@ -192,6 +211,11 @@ namespace Seldon
     Matrix<T, Prop, RowMajor, Allocator>& operator= (const T0& x);
     Matrix<T, Prop, RowMajor, Allocator>& operator=(const Matrix<T, Prop,
                                                     RowMajor, Allocator>& A);
+#ifdef SELDON_WITH_CPP11
+    Matrix<T, Prop, RowMajor, Allocator>& operator=(Matrix<T, Prop,
+                                                    RowMajor, Allocator>&& A)
+      noexcept;
+#endif
 #endif
     template<class T0>
     Matrix<T, Prop, RowMajor, Allocator>& operator*= (const T0& x);
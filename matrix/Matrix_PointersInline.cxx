@@ -43,6 +43,29 @@ namespace Seldon
   }
 
 
+#ifdef SELDON_WITH_CPP11
+  //! Move constructor.
+  /*! The arrays of \a A are taken over, no memory is allocated.
+    \param A matrix to be moved. On exit, \a A is an empty 0x0 matrix.
+  */
+  template <class T, class Prop, class Storage, class Allocator>
+  inline Matrix_Pointers<T, Prop, Storage, Allocator>
+  ::Matrix_Pointers(Matrix_Pointers<T, Prop, Storage, Allocator>&& A)
+    noexcept:
+    Matrix_Base<T, Allocator>()
+  {
+    this->m_ = A.m_;
+    this->n_ = A.n_;
+    this->data_ = A.data_;
+    me_ = A.me_;
+    A.m_ = 0;
+    A.n_ = 0;
+    A.data_ = NULL;
+    A.me_ = NULL;
+  }
+#endif
+
+
   /**************
    * DESTRUCTOR *
    **************/
@@ -316,6 +339,35 @@ namespace Seldon
   }
 
 
+#ifdef SELDON_WITH_CPP11
+  //! Move assignment.
+  /*!
+    The current matrix is released and the arrays of \a A are taken over.
+    \param A matrix to be moved. On exit, \a A is an empty 0x0 matrix.
+  */
+  template <class T, class Prop, class Storage, class Allocator>
+  inline Matrix_Pointers<T, Prop, Storage, Allocator>&
+  Matrix_Pointers<T, Prop, Storage, Allocator>
+  ::operator= (Matrix_Pointers<T, Prop, Storage, Allocator>&& A) noexcept
+  {
+    if (this != &A)
+      {
+	this->Clear();
+	this->m_ = A.m_;
+	this->n_ = A.n_;
+	this->data_ = A.data_;
+	me_ = A.me_;
+	A.m_ = 0;
+	A.n_ = 0;
+	A.data_ = NULL;
+	A.me_ = NULL;
+      }
+
+    return *this;
+  }
+#endif
+
+
   //! Duplicates a matrix.
   /*!
     \param A matrix to be copied.
@@ -384,6 +436,18 @@ namespace Seldon
   }
 
 
+#ifdef SELDON_WITH_CPP11
+  //! Move constructor.
+  template <class T, class Prop, class Allocator>
+  inline Matrix<T, Prop, ColMajor, Allocator>
+  ::Matrix(Matrix<T, Prop, ColMajor, Allocator>&& A) noexcept:
+    Matrix_Pointers<T, Prop, ColMajor, Allocator>
+    (static_cast<Matrix_Pointers<T, Prop, ColMajor, Allocator>&&>(A))
+  {
+  }
+#endif
+
+
   //! Fills the matrix with a given value.
   /*!
     \param x the value to fill the matrix with.
@@ -416,6 +480,24 @@ namespace Seldon
   }
 
 
+#ifdef SELDON_WITH_CPP11
+  //! Move assignment.
+  /*!
+    \param A matrix to be moved. On exit, \a A is an empty 0x0 matrix.
+  */
+  template <class T, class Prop, class Allocator>
+  inline Matrix<T, Prop, ColMajor, Allocator>&
+  Matrix<T, Prop, ColMajor, Allocator>
+  ::operator= (Matrix<T, Prop, ColMajor, Allocator>&& A) noexcept
+  {
+    Matrix_Pointers<T, Prop, ColMajor, Allocator>::operator=
+      (static_cast<Matrix_Pointers<T, Prop, ColMajor, Allocator>&&>(A));
+
+    return *this;
+  }
+#endif
+
+
   //! Multiplies the matrix by a scalar.
   /*!
     \param alpha scalar.
@@ -473,6 +555,18 @@ namespace Seldon
   }
 
 
+#ifdef SELDON_WITH_CPP11
+  //! Move constructor.
+  template <class T, class Prop, class Allocator>
+  inline Matrix<T, Prop, RowMajor, Allocator>
+  ::Matrix(Matrix<T, Prop, RowMajor, Allocator>&& A) noexcept:
+    Matrix_Pointers<T, Prop, RowMajor, Allocator>
+    (static_cast<Matrix_Pointers<T, Prop, RowMajor, Allocator>&&>(A))
+  {
+  }
+#endif
+
+
   /*****************
    * OTHER METHODS *
    *****************/
@@ -510,6 +604,24 @@ namespace Seldon
   }
 
 
+#ifdef SELDON_WITH_CPP11
+  //! Move assignment.
+  /*!
+    \param A matrix to be moved. On exit, \a A is an empty 0x0 matrix.
+  */
+  template <class T, class Prop, class Allocator>
+  inline Matrix<T, Prop, RowMajor, Allocator>&
+  Matrix<T, Prop, RowMajor, Allocator>
+  ::operator= (Matrix<T, Prop, RowMajor, Allocator>&& A) noexcept
+  {
+    Matrix_Pointers<T, Prop, RowMajor, Allocator>::operator=
+      (static_cast<Matrix_Pointers<T, Prop, RowMajor, Allocator>&&>(A));
+
+    return *this;
+  }
+#endif
+
+
   //! Multiplies the matrix by a scalar.
   /*!
     \param alpha scalar.
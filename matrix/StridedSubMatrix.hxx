@@ -0,0 +1,146 @@
+// Copyright (C) 2016 INRIA
+//
+// This file is part of the linear-algebra library Seldon,
+// http://seldon.sourceforge.net/.
+//
+// Seldon is free software; you can redistribute it and/or modify it under the
+// terms of the GNU Lesser General Public License as published by the Free
+// Software Foundation; either version 2.1 of the License, or (at your option)
+// any later version.
+//
+// Seldon is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for
+// more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with Seldon. If not, see http://www.gnu.org/licenses/.
+
+
+
+#ifndef SELDON_FILE_STRIDED_SUBMATRIX_HXX
+
+
+namespace Seldon
+{
+
+
+  ////////////////////////////////////////
+  // MATRIX<STRIDEDSUBSTORAGE<STORAGE>> //
+  ////////////////////////////////////////
+
+
+  //! Strided view on a contiguous block of a dense matrix.
+  /*!
+    The view does not own its elements: element (i, j) of the view is stored
+    at data_[Storage::GetFirst(i, j) * ld_ + Storage::GetSecond(i, j)]. A
+    block of a ColMajor or RowMajor matrix is therefore described by the
+    address of its first element, its extents and the leading dimension of
+    the matrix, which is what Blas expects. The copy constructor copies the
+    view, not the elements.
+    \tparam Storage storage of the viewed matrix (ColMajor or RowMajor).
+  */
+  template <class T, class Prop, class Storage, class Allocator>
+  class Matrix<T, Prop, StridedSubStorage<Storage>, Allocator>:
+    public Matrix_Base<T, Allocator>
+  {
+    // typedef declaration.
+  public:
+    typedef typename Allocator::value_type value_type;
+    typedef typename Allocator::pointer pointer;
+    typedef typename Allocator::const_pointer const_pointer;
+    typedef typename Allocator::reference reference;
+    typedef typename Allocator::const_reference const_reference;
+    typedef typename Allocator::value_type entry_type;
+    typedef typename Allocator::reference access_type;
+    typedef typename Allocator::const_reference const_access_type;
+    typedef Prop property;
+    typedef StridedSubStorage<Storage> storage;
+    typedef Allocator allocator;
+
+    // Attributes.
+  protected:
+    //! Leading dimension of the viewed matrix.
+    size_t ld_;
+
+    // Methods.
+  public:
+    // Constructors.
+    Matrix();
+    Matrix(size_t i, size_t j, pointer data, size_t ld);
+    template <class Allocator0>
+    Matrix(Matrix<T, Prop, Storage, Allocator0>& A);
+    template <class Allocator0>
+    Matrix(Matrix<T, Prop, Storage, Allocator0>& A,
+           size_t i0, size_t j0, size_t i, size_t j);
+    Matrix(const Matrix<T, Prop, StridedSubStorage<Storage>, Allocator>& A);
+    Matrix(const Matrix<T, Prop, StridedSubStorage<Storage>, Allocator>& A,
+           size_t i0, size_t j0, size_t i, size_t j);
+
+    // Destructor.
+    ~Matrix();
+
+    // Basic methods.
+    size_t GetLD() const;
+    void SetData(size_t i, size_t j, pointer data, size_t ld);
+    void Nullify();
+
+    // Element access and affectation.
+    reference operator() (size_t i, size_t j);
+#ifndef SWIG
+    const_reference operator() (size_t i, size_t j) const;
+#endif
+    reference Val(size_t i, size_t j);
+#ifndef SWIG
+    const_reference Val(size_t i, size_t j) const;
+#endif
+    reference Get(size_t i, size_t j);
+#ifndef SWIG
+    const_reference Get(size_t i, size_t j) const;
+#endif
+    void Set(size_t i, size_t j, const T& x);
+
+    template <class T0, class Prop0, class Storage0, class Allocator0>
+    void Copy(const Matrix<T0, Prop0, Storage0, Allocator0>& A);
+
+    // Convenient functions.
+    void Zero();
+    template <class T0>
+    void Fill(const T0& x);
+    void Print() const;
+
+#ifdef SELDON_WITH_VIRTUAL
+    void Reallocate(size_t, size_t) {}
+    int64_t GetMemorySize() const { return 0; }
+#endif
+
+  };
+
+
+  //////////////////////
+  // STRIDEDSUBMATRIX //
+  //////////////////////
+
+
+  //! Strided view on a contiguous block of a dense matrix.
+  /*!
+    \extends Matrix<T, Prop, StridedSubStorage<Storage>, Allocator>
+    \tparam M type of the viewed matrix, with ColMajor or RowMajor storage.
+  */
+  template <class M>
+  class StridedSubMatrix:
+    public Matrix<typename M::value_type, typename M::property,
+                  StridedSubStorage<typename M::storage>,
+                  typename M::allocator>
+  {
+  public:
+    StridedSubMatrix(M& A);
+    StridedSubMatrix(M& A, size_t i0, size_t j0, size_t i, size_t j);
+  };
+
+
+} // namespace Seldon.
+
+
+#define SELDON_FILE_STRIDED_SUBMATRIX_HXX
+#endif
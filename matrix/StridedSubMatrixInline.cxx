@@ -0,0 +1,457 @@
+// Copyright (C) 2016 INRIA
+//
+// This file is part of the linear-algebra library Seldon,
+// http://seldon.sourceforge.net/.
+//
+// Seldon is free software; you can redistribute it and/or modify it under the
+// terms of the GNU Lesser General Public License as published by the Free
+// Software Foundation; either version 2.1 of the License, or (at your option)
+// any later version.
+//
+// Seldon is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for
+// more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with Seldon. If not, see http://www.gnu.org/licenses/.
+
+
+
+#ifndef SELDON_FILE_STRIDED_SUBMATRIX_INLINE_CXX
+
+
+#include "StridedSubMatrix.hxx"
+
+
+namespace Seldon
+{
+
+
+  ////////////////////////////////////////
+  // MATRIX<STRIDEDSUBSTORAGE<STORAGE>> //
+  ////////////////////////////////////////
+
+
+  /****************
+   * CONSTRUCTORS *
+   ****************/
+
+
+  //! Default constructor.
+  /*!
+    On exit, the view is empty.
+  */
+  template <class T, class Prop, class Storage, class Allocator>
+  inline Matrix<T, Prop, StridedSubStorage<Storage>, Allocator>::Matrix():
+    Matrix_Base<T, Allocator>(), ld_(0)
+  {
+  }
+
+
+  //! Constructs a view on an array.
+  /*!
+    \param[in] i number of rows.
+    \param[in] j number of columns.
+    \param[in] data address of the first element.
+    \param[in] ld leading dimension.
+  */
+  template <class T, class Prop, class Storage, class Allocator>
+  inline Matrix<T, Prop, StridedSubStorage<Storage>, Allocator>
+  ::Matrix(size_t i, size_t j, pointer data, size_t ld):
+    Matrix_Base<T, Allocator>(i, j), ld_(ld)
+  {
+    this->data_ = data;
+  }
+
+
+  //! Constructs a view on a whole matrix.
+  /*!
+    \param[in] A viewed matrix.
+  */
+  template <class T, class Prop, class Storage, class Allocator>
+  template <class Allocator0>
+  inline Matrix<T, Prop, StridedSubStorage<Storage>, Allocator>
+  ::Matrix(Matrix<T, Prop, Storage, Allocator0>& A):
+    Matrix_Base<T, Allocator>(A.GetM(), A.GetN()), ld_(A.GetLD())
+  {
+    this->data_ = A.GetData();
+  }
+
+
+  //! Constructs a view on a block of a matrix.
+  /*!
+    \param[in] A viewed matrix.
+    \param[in] i0 first row of the block.
+    \param[in] j0 first column of the block.
+    \param[in] i number of rows of the block.
+    \param[in] j number of columns of the block.
+  */
+  template <class T, class Prop, class Storage, class Allocator>
+  template <class Allocator0>
+  inline Matrix<T, Prop, StridedSubStorage<Storage>, Allocator>
+  ::Matrix(Matrix<T, Prop, Storage, Allocator0>& A,
+           size_t i0, size_t j0, size_t i, size_t j):
+    Matrix_Base<T, Allocator>()
+  {
+#ifdef SELDON_CHECK_BOUNDS
+    if (i0 + i > A.GetM() || j0 + j > A.GetN())
+      throw WrongArgument("Matrix::Matrix(A, i0, j0, i, j)",
+                          "The block [" + to_str(i0) + ", "
+                          + to_str(i0 + i) + "[ x [" + to_str(j0) + ", "
+                          + to_str(j0 + j) + "[ is not inside the "
+                          + to_str(A.GetM()) + " x " + to_str(A.GetN())
+                          + " matrix.");
+#endif
+
+    SetData(i, j, A.GetData() + Storage::GetFirst(i0, j0) * A.GetLD()
+            + Storage::GetSecond(i0, j0), A.GetLD());
+  }
+
+
+  //! Copy constructor.
+  /*!
+    \param[in] A view to be copied. The elements are not copied, they are
+    shared by the two views.
+  */
+  template <class T, class Prop, class Storage, class Allocator>
+  inline Matrix<T, Prop, StridedSubStorage<Storage>, Allocator>
+  ::Matrix(const Matrix<T, Prop, StridedSubStorage<Storage>, Allocator>& A):
+    Matrix_Base<T, Allocator>(A.GetM(), A.GetN()), ld_(A.GetLD())
+  {
+    this->data_ = A.GetData();
+  }
+
+
+  //! Constructs a view on a block of another view.
+  /*!
+    \param[in] A viewed view.
+    \param[in] i0 first row of the block.
+    \param[in] j0 first column of the block.
+    \param[in] i number of rows of the block.
+    \param[in] j number of columns of the block.
+  */
+  template <class T, class Prop, class Storage, class Allocator>
+  inline Matrix<T, Prop, StridedSubStorage<Storage>, Allocator>
+  ::Matrix(const Matrix<T, Prop, StridedSubStorage<Storage>, Allocator>& A,
+           size_t i0, size_t j0, size_t i, size_t j):
+    Matrix_Base<T, Allocator>()
+  {
+#ifdef SELDON_CHECK_BOUNDS
+    if (i0 + i > A.GetM() || j0 + j > A.GetN())
+      throw WrongArgument("Matrix::Matrix(A, i0, j0, i, j)",
+                          "The block [" + to_str(i0) + ", "
+                          + to_str(i0 + i) + "[ x [" + to_str(j0) + ", "
+                          + to_str(j0 + j) + "[ is not inside the "
+                          + to_str(A.GetM()) + " x " + to_str(A.GetN())
+                          + " view.");
+#endif
+
+    SetData(i, j, A.GetData() + Storage::GetFirst(i0, j0) * A.GetLD()
+            + Storage::GetSecond(i0, j0), A.GetLD());
+  }
+
+
+  /**************
+   * DESTRUCTOR *
+   **************/
+
+
+  //! Destructor.
+  /*!
+    The viewed elements are not released.
+  */
+  template <class T, class Prop, class Storage, class Allocator>
+  inline Matrix<T, Prop, StridedSubStorage<Storage>, Allocator>::~Matrix()
+  {
+  }
+
+
+  /*****************
+   * BASIC METHODS *
+   *****************/
+
+
+  //! Returns the leading dimension.
+  /*!
+    \return The distance between the first elements of two consecutive
+    columns (ColMajor) or rows (RowMajor).
+  */
+  template <class T, class Prop, class Storage, class Allocator>
+  inline size_t Matrix<T, Prop, StridedSubStorage<Storage>, Allocator>
+  ::GetLD() const
+  {
+    return ld_;
+  }
+
+
+  //! Changes the viewed elements.
+  /*!
+    \param[in] i number of rows.
+    \param[in] j number of columns.
+    \param[in] data address of the first element.
+    \param[in] ld leading dimension.
+  */
+  template <class T, class Prop, class Storage, class Allocator>
+  inline void Matrix<T, Prop, StridedSubStorage<Storage>, Allocator>
+  ::SetData(size_t i, size_t j, pointer data, size_t ld)
+  {
+    this->m_ = i;
+    this->n_ = j;
+    this->data_ = data;
+    ld_ = ld;
+  }
+
+
+  //! Empties the view.
+  template <class T, class Prop, class Storage, class Allocator>
+  inline void Matrix<T, Prop, StridedSubStorage<Storage>, Allocator>
+  ::Nullify()
+  {
+    this->m_ = 0;
+    this->n_ = 0;
+    this->data_ = NULL;
+    ld_ = 0;
+  }
+
+
+  /**********************************
+   * ELEMENT ACCESS AND AFFECTATION *
+   **********************************/
+
+
+  //! Access operator.
+  /*!
+    \param[in] i row index.
+    \param[in] j column index.
+    \return Element (i, j) of the view.
+  */
+  template <class T, class Prop, class Storage, class Allocator>
+  inline typename Matrix<T, Prop, StridedSubStorage<Storage>, Allocator>
+  ::reference Matrix<T, Prop, StridedSubStorage<Storage>, Allocator>
+  ::operator() (size_t i, size_t j)
+  {
+
+#ifdef SELDON_CHECK_BOUNDS
+    CheckBounds(i, j, this->m_, this->n_, "Matrix");
+#endif
+
+    return this->data_[Storage::GetFirst(i, j) * ld_
+                       + Storage::GetSecond(i, j)];
+  }
+
+
+  //! Access operator.
+  /*!
+    \param[in] i row index.
+    \param[in] j column index.
+    \return Element (i, j) of the view.
+  */
+  template <class T, class Prop, class Storage, class Allocator>
+  inline typename Matrix<T, Prop, StridedSubStorage<Storage>, Allocator>
+  ::const_reference Matrix<T, Prop, StridedSubStorage<Storage>, Allocator>
+  ::operator() (size_t i, size_t j) const
+  {
+
+#ifdef SELDON_CHECK_BOUNDS
+    CheckBounds(i, j, this->m_, this->n_, "Matrix");
+#endif
+
+    return this->data_[Storage::GetFirst(i, j) * ld_
+                       + Storage::GetSecond(i, j)];
+  }
+
+
+  //! Access operator.
+  /*!
+    \param[in] i row index.
+    \param[in] j column index.
+    \return Element (i, j) of the view.
+  */
+  template <class T, class Prop, class Storage, class Allocator>
+  inline typename Matrix<T, Prop, StridedSubStorage<Storage>, Allocator>
+  ::reference Matrix<T, Prop, StridedSubStorage<Storage>, Allocator>
+  ::Val(size_t i, size_t j)
+  {
+    return (*this)(i, j);
+  }
+
+
+  //! Access operator.
+  /*!
+    \param[in] i row index.
+    \param[in] j column index.
+    \return Element (i, j) of the view.
+  */
+  template <class T, class Prop, class Storage, class Allocator>
+  inline typename Matrix<T, Prop, StridedSubStorage<Storage>, Allocator>
+  ::const_reference Matrix<T, Prop, StridedSubStorage<Storage>, Allocator>
+  ::Val(size_t i, size_t j) const
+  {
+    return (*this)(i, j);
+  }
+
+
+  //! Access operator.
+  /*!
+    \param[in] i row index.
+    \param[in] j column index.
+    \return Element (i, j) of the view.
+  */
+  template <class T, class Prop, class Storage, class Allocator>
+  inline typename Matrix<T, Prop, StridedSubStorage<Storage>, Allocator>
+  ::reference Matrix<T, Prop, StridedSubStorage<Storage>, Allocator>
+  ::Get(size_t i, size_t j)
+  {
+    return (*this)(i, j);
+  }
+
+
+  //! Access operator.
+  /*!
+    \param[in] i row index.
+    \param[in] j column index.
+    \return Element (i, j) of the view.
+  */
+  template <class T, class Prop, class Storage, class Allocator>
+  inline typename Matrix<T, Prop, StridedSubStorage<Storage>, Allocator>
+  ::const_reference Matrix<T, Prop, StridedSubStorage<Storage>, Allocator>
+  ::Get(size_t i, size_t j) const
+  {
+    return (*this)(i, j);
+  }
+
+
+  //! Sets an element of the view.
+  /*!
+    \param[in] i row index.
+    \param[in] j column index.
+    \param[in] x new value of element (i, j).
+  */
+  template <class T, class Prop, class Storage, class Allocator>
+  inline void Matrix<T, Prop, StridedSubStorage<Storage>, Allocator>
+  ::Set(size_t i, size_t j, const T& x)
+  {
+    (*this)(i, j) = x;
+  }
+
+
+  //! Copies the elements of a matrix into the viewed elements.
+  /*!
+    \param[in] A matrix with the same dimensions as the view.
+  */
+  template <class T, class Prop, class Storage, class Allocator>
+  template <class T0, class Prop0, class Storage0, class Allocator0>
+  inline void Matrix<T, Prop, StridedSubStorage<Storage>, Allocator>
+  ::Copy(const Matrix<T0, Prop0, Storage0, Allocator0>& A)
+  {
+
+#ifdef SELDON_CHECK_DIMENSIONS
+    if (size_t(A.GetM()) != this->m_ || size_t(A.GetN()) != this->n_)
+      throw WrongDim("Matrix::Copy(A)",
+                     "The view is " + to_str(this->m_) + " x "
+                     + to_str(this->n_) + " but the matrix is "
+                     + to_str(A.GetM()) + " x " + to_str(A.GetN()) + ".");
+#endif
+
+    for (size_t i = 0; i < Storage::GetFirst(this->m_, this->n_); i++)
+      for (size_t j = 0; j < Storage::GetSecond(this->m_, this->n_); j++)
+        (*this)(Storage::GetFirst(i, j), Storage::GetSecond(i, j))
+          = A(Storage::GetFirst(i, j), Storage::GetSecond(i, j));
+  }
+
+
+  /************************
+   * CONVENIENT FUNCTIONS *
+   ************************/
+
+
+  //! Sets all viewed elements to zero.
+  template <class T, class Prop, class Storage, class Allocator>
+  inline void Matrix<T, Prop, StridedSubStorage<Storage>, Allocator>::Zero()
+  {
+    T zero;
+    SetComplexZero(zero);
+    Fill(zero);
+  }
+
+
+  //! Sets all viewed elements to a given value.
+  /*!
+    \param[in] x value to be assigned.
+  */
+  template <class T, class Prop, class Storage, class Allocator>
+  template <class T0>
+  inline void Matrix<T, Prop, StridedSubStorage<Storage>, Allocator>
+  ::Fill(const T0& x)
+  {
+    T x_ = x;
+    size_t n = Storage::GetSecond(this->m_, this->n_);
+    for (size_t i = 0; i < Storage::GetFirst(this->m_, this->n_); i++)
+      {
+        pointer data = this->data_ + i * ld_;
+        for (size_t j = 0; j < n; j++)
+          data[j] = x_;
+      }
+  }
+
+
+  //! Displays the viewed elements on the standard output.
+  /*!
+    Each row is displayed on a single line, and the elements of a row are
+    delimited by tabulations.
+  */
+  template <class T, class Prop, class Storage, class Allocator>
+  inline void Matrix<T, Prop, StridedSubStorage<Storage>, Allocator>
+  ::Print() const
+  {
+    for (size_t i = 0; i < this->m_; i++)
+      {
+        for (size_t j = 0; j < this->n_; j++)
+          cout << (*this)(i, j) << "\t";
+        cout << endl;
+      }
+  }
+
+
+  //////////////////////
+  // STRIDEDSUBMATRIX //
+  //////////////////////
+
+
+  //! Constructs a view on a whole matrix.
+  /*!
+    \param[in] A viewed matrix.
+  */
+  template <class M>
+  inline StridedSubMatrix<M>::StridedSubMatrix(M& A):
+    Matrix<typename M::value_type, typename M::property,
+           StridedSubStorage<typename M::storage>,
+           typename M::allocator>(A)
+  {
+  }
+
+
+  //! Constructs a view on a block of a matrix.
+  /*!
+    \param[in] A viewed matrix.
+    \param[in] i0 first row of the block.
+    \param[in] j0 first column of the block.
+    \param[in] i number of rows of the block.
+    \param[in] j number of columns of the block.
+  */
+  template <class M>
+  inline StridedSubMatrix<M>
+  ::StridedSubMatrix(M& A, size_t i0, size_t j0, size_t i, size_t j):
+    Matrix<typename M::value_type, typename M::property,
+           StridedSubStorage<typename M::storage>,
+           typename M::allocator>(A, i0, j0, i, j)
+  {
+  }
+
+
+} // namespace Seldon.
+
+
+#define SELDON_FILE_STRIDED_SUBMATRIX_INLINE_CXX
+#endif
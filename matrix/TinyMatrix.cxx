@@ -0,0 +1,157 @@
+// Copyright (C) 2016 INRIA
+//
+// This file is part of the linear-algebra library Seldon,
+// http://seldon.sourceforge.net/.
+//
+// Seldon is free software; you can redistribute it and/or modify it under the
+// terms of the GNU Lesser General Public License as published by the Free
+// Software Foundation; either version 2.1 of the License, or (at your option)
+// any later version.
+//
+// Seldon is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for
+// more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with Seldon. If not, see http://www.gnu.org/licenses/.
+
+
+#ifndef SELDON_FILE_TINY_MATRIX_CXX
+
+
+#include "TinyMatrix.hxx"
+
+
+namespace Seldon
+{
+
+
+  ////////////////
+  // TINYMATRIX //
+  ////////////////
+
+
+  //! Displays the matrix on the standard output.
+  template <class T, int m, int n>
+  void TinyMatrix<T, m, n>::Print() const
+  {
+    for (int i = 0; i < m; i++)
+      {
+	for (int j = 0; j < n; j++)
+	  cout << data_[i*n + j] << "\t";
+	cout << endl;
+      }
+  }
+
+
+  //! LU factorization with partial pivoting.
+  /*!
+    \param[in,out] A on entry, the matrix to be factorized; on exit, the LU
+    factorization (L with unit diagonal in the lower part, U in the upper
+    part).
+    \param[out] pivot row interchanges.
+  */
+  template<class T, int m>
+  void GetLU(TinyMatrix<T, m, m>& A, TinyVector<int, m>& pivot)
+  {
+    typedef typename ClassComplexType<T>::Treal Treal;
+    for (int k = 0; k < m; k++)
+      {
+	int p = k;
+	Treal vmax = abs(A(k, k));
+	for (int i = k+1; i < m; i++)
+	  if (abs(A(i, k)) > vmax)
+	    {
+	      vmax = abs(A(i, k));
+	      p = i;
+	    }
+
+	if (vmax == Treal(0))
+	  throw WrongArgument("GetLU(TinyMatrix&, TinyVector<int>&)",
+			      "The matrix is singular.");
+
+	pivot(k) = p;
+	if (p != k)
+	  for (int j = 0; j < m; j++)
+	    swap(A(k, j), A(p, j));
+
+	T inv_piv;
+	SetComplexOne(inv_piv);
+	inv_piv /= A(k, k);
+	for (int i = k+1; i < m; i++)
+	  {
+	    A(i, k) *= inv_piv;
+	    for (int j = k+1; j < m; j++)
+	      A(i, j) -= A(i, k)*A(k, j);
+	  }
+      }
+  }
+
+
+  //! Solves A x = b, A being factorized by GetLU.
+  /*!
+    \param[in] A LU factorization.
+    \param[in] pivot row interchanges computed by GetLU.
+    \param[in,out] x on entry, the right hand side; on exit, the solution.
+  */
+  template<class T, int m>
+  void SolveLU(const TinyMatrix<T, m, m>& A, const TinyVector<int, m>& pivot,
+	       TinyVector<T, m>& x)
+  {
+    for (int k = 0; k < m; k++)
+      if (pivot(k) != k)
+	swap(x(k), x(pivot(k)));
+
+    for (int i = 1; i < m; i++)
+      for (int k = 0; k < i; k++)
+	x(i) -= A(i, k)*x(k);
+
+    for (int i = m-1; i >= 0; i--)
+      {
+	for (int k = i+1; k < m; k++)
+	  x(i) -= A(i, k)*x(k);
+	x(i) /= A(i, i);
+      }
+  }
+
+
+  //! Replaces a matrix by its inverse.
+  template<class T, int m>
+  void GetInverse(TinyMatrix<T, m, m>& A)
+  {
+    TinyVector<int, m> pivot;
+    TinyMatrix<T, m, m> lu(A);
+    GetLU(lu, pivot);
+
+    TinyVector<T, m> x;
+    for (int j = 0; j < m; j++)
+      {
+	x.Zero();
+	SetComplexOne(x(j));
+	SolveLU(lu, pivot, x);
+	for (int i = 0; i < m; i++)
+	  A(i, j) = x(i);
+      }
+  }
+
+
+  //! Writes the matrix in a stream.
+  template<class T, int m, int n>
+  ostream& operator << (ostream& out, const TinyMatrix<T, m, n>& A)
+  {
+    for (int i = 0; i < m; i++)
+      {
+	for (int j = 0; j < n; j++)
+	  out << A(i, j) << '\t';
+	out << '\n';
+      }
+    return out;
+  }
+
+
+} // namespace Seldon.
+
+
+#define SELDON_FILE_TINY_MATRIX_CXX
+#endif
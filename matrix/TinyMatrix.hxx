@@ -0,0 +1,125 @@
+// Copyright (C) 2016 INRIA
+//
+// This file is part of the linear-algebra library Seldon,
+// http://seldon.sourceforge.net/.
+//
+// Seldon is free software; you can redistribute it and/or modify it under the
+// terms of the GNU Lesser General Public License as published by the Free
+// Software Foundation; either version 2.1 of the License, or (at your option)
+// any later version.
+//
+// Seldon is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for
+// more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with Seldon. If not, see http://www.gnu.org/licenses/.
+
+
+#ifndef SELDON_FILE_TINY_MATRIX_HXX
+
+
+namespace Seldon
+{
+
+
+  //! Dense matrix whose dimensions are known at compilation time.
+  /*! TinyMatrix stores its m x n elements (row-major) in a static array. It
+    does not require any dynamic allocation and the loops of the associated
+    functions (Mlt, MltAdd, GetLU, SolveLU, GetInverse) have fixed trip
+    counts. It is intended for small matrices, e.g. elementary matrices in
+    finite elements. For large sets of matrices of the same size, see also
+    MatrixBatch.
+  */
+  template <class T, int m, int n>
+  class TinyMatrix
+  {
+  public:
+    typedef T value_type;
+    typedef T* pointer;
+    typedef const T* const_pointer;
+    typedef T& reference;
+    typedef const T& const_reference;
+
+  protected:
+    //! elements of the matrix (row-major)
+    T data_[m*n];
+
+  public:
+    TinyMatrix();
+
+    int GetM() const;
+    int GetN() const;
+    int GetSize() const;
+    pointer GetData();
+    const_pointer GetData() const;
+
+    reference operator() (int i, int j);
+#ifndef SWIG
+    const_reference operator() (int i, int j) const;
+#endif
+
+    void Zero();
+    void SetIdentity();
+    template<class T0>
+    void Fill(const T0& x);
+    void FillRand();
+
+    template<class Prop0, class Storage0, class Allocator0>
+    void Copy(const Matrix<T, Prop0, Storage0, Allocator0>& A);
+
+#ifndef SWIG
+    template<class T0>
+    TinyMatrix<T, m, n>& operator= (const T0& x);
+#endif
+    TinyMatrix<T, m, n>& operator+= (const TinyMatrix<T, m, n>& A);
+    template<class T0>
+    TinyMatrix<T, m, n>& operator*= (const T0& alpha);
+
+    void Print() const;
+  };
+
+
+  template<class T, int m, int n>
+  void Mlt(const TinyMatrix<T, m, n>& A, const TinyVector<T, n>& x,
+	   TinyVector<T, m>& y);
+
+  template<class T0, class T, int m, int n>
+  void MltAdd(const T0& alpha, const TinyMatrix<T, m, n>& A,
+	      const TinyVector<T, n>& x, const T0& beta,
+	      TinyVector<T, m>& y);
+
+  template<class T, int m, int k, int n>
+  void Mlt(const TinyMatrix<T, m, k>& A, const TinyMatrix<T, k, n>& B,
+	   TinyMatrix<T, m, n>& C);
+
+  template<class T0, class T, int m, int k, int n>
+  void MltAdd(const T0& alpha, const TinyMatrix<T, m, k>& A,
+	      const TinyMatrix<T, k, n>& B, const T0& beta,
+	      TinyMatrix<T, m, n>& C);
+
+  template<class T, int m, int n>
+  void Transpose(const TinyMatrix<T, m, n>& A, TinyMatrix<T, n, m>& B);
+
+  template<class T, int m>
+  void GetLU(TinyMatrix<T, m, m>& A, TinyVector<int, m>& pivot);
+
+  template<class T, int m>
+  void SolveLU(const TinyMatrix<T, m, m>& A, const TinyVector<int, m>& pivot,
+	       TinyVector<T, m>& x);
+
+  template<class T, int m>
+  void GetInverse(TinyMatrix<T, m, m>& A);
+
+#ifndef SWIG
+  template<class T, int m, int n>
+  ostream& operator << (ostream& out, const TinyMatrix<T, m, n>& A);
+#endif
+
+
+} // namespace Seldon.
+
+
+#define SELDON_FILE_TINY_MATRIX_HXX
+#endif
@@ -0,0 +1,296 @@
+// Copyright (C) 2016 INRIA
+//
+// This file is part of the linear-algebra library Seldon,
+// http://seldon.sourceforge.net/.
+//
+// Seldon is free software; you can redistribute it and/or modify it under the
+// terms of the GNU Lesser General Public License as published by the Free
+// Software Foundation; either version 2.1 of the License, or (at your option)
+// any later version.
+//
+// Seldon is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for
+// more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with Seldon. If not, see http://www.gnu.org/licenses/.
+
+
+#ifndef SELDON_FILE_TINY_MATRIX_INLINE_CXX
+
+
+#include "TinyMatrix.hxx"
+
+
+namespace Seldon
+{
+
+
+  ////////////////
+  // TINYMATRIX //
+  ////////////////
+
+
+  //! Default constructor.
+  /*!
+    \warning The elements are not initialized.
+  */
+  template <class T, int m, int n>
+  inline TinyMatrix<T, m, n>::TinyMatrix()
+  {
+  }
+
+
+  //! Returns the number of rows.
+  template <class T, int m, int n>
+  inline int TinyMatrix<T, m, n>::GetM() const
+  {
+    return m;
+  }
+
+
+  //! Returns the number of columns.
+  template <class T, int m, int n>
+  inline int TinyMatrix<T, m, n>::GetN() const
+  {
+    return n;
+  }
+
+
+  //! Returns the number of elements.
+  template <class T, int m, int n>
+  inline int TinyMatrix<T, m, n>::GetSize() const
+  {
+    return m*n;
+  }
+
+
+  //! Returns a pointer to the elements (row-major).
+  template <class T, int m, int n>
+  inline typename TinyMatrix<T, m, n>::pointer TinyMatrix<T, m, n>::GetData()
+  {
+    return data_;
+  }
+
+
+  //! Returns a const pointer to the elements (row-major).
+  template <class T, int m, int n>
+  inline typename TinyMatrix<T, m, n>::const_pointer
+  TinyMatrix<T, m, n>::GetData() const
+  {
+    return data_;
+  }
+
+
+  //! Access operator.
+  /*!
+    \param[in] i row index.
+    \param[in] j column index.
+    \return The element (\a i, \a j) of the matrix.
+  */
+  template <class T, int m, int n>
+  inline typename TinyMatrix<T, m, n>::reference
+  TinyMatrix<T, m, n>::operator() (int i, int j)
+  {
+
+#ifdef SELDON_CHECK_BOUNDS
+    CheckBounds(i, j, m, n, "TinyMatrix");
+#endif
+
+    return data_[i*n + j];
+  }
+
+
+  //! Access operator.
+  /*!
+    \param[in] i row index.
+    \param[in] j column index.
+    \return The element (\a i, \a j) of the matrix.
+  */
+  template <class T, int m, int n>
+  inline typename TinyMatrix<T, m, n>::const_reference
+  TinyMatrix<T, m, n>::operator() (int i, int j) const
+  {
+
+#ifdef SELDON_CHECK_BOUNDS
+    CheckBounds(i, j, m, n, "TinyMatrix");
+#endif
+
+    return data_[i*n + j];
+  }
+
+
+  //! Sets all elements to zero.
+  template <class T, int m, int n>
+  inline void TinyMatrix<T, m, n>::Zero()
+  {
+    T zero;
+    SetComplexZero(zero);
+    for (int i = 0; i < m*n; i++)
+      data_[i] = zero;
+  }
+
+
+  //! Sets the matrix to the identity.
+  template <class T, int m, int n>
+  inline void TinyMatrix<T, m, n>::SetIdentity()
+  {
+    Zero();
+    for (int i = 0; i < min(m, n); i++)
+      SetComplexOne(data_[i*n + i]);
+  }
+
+
+  //! Sets all elements to \a x.
+  template <class T, int m, int n> template<class T0>
+  inline void TinyMatrix<T, m, n>::Fill(const T0& x)
+  {
+    T x_;
+    SetComplexReal(x, x_);
+    for (int i = 0; i < m*n; i++)
+      data_[i] = x_;
+  }
+
+
+  //! Fills the matrix randomly.
+  template <class T, int m, int n>
+  inline void TinyMatrix<T, m, n>::FillRand()
+  {
+#ifndef SELDON_WITHOUT_REINIT_RANDOM
+    srand(time(NULL));
+#endif
+    for (int i = 0; i < m*n; i++)
+      SetComplexReal(rand(), data_[i]);
+  }
+
+
+  //! Copies a dense Seldon matrix.
+  /*!
+    \param[in] A matrix to be copied, it must be m x n.
+  */
+  template <class T, int m, int n>
+  template<class Prop0, class Storage0, class Allocator0>
+  inline void TinyMatrix<T, m, n>
+  ::Copy(const Matrix<T, Prop0, Storage0, Allocator0>& A)
+  {
+
+#ifdef SELDON_CHECK_DIMENSIONS
+    if (A.GetM() != m || A.GetN() != n)
+      throw WrongDim("TinyMatrix::Copy(Matrix)",
+		     "The matrix is " + to_str(A.GetM()) + " x "
+		     + to_str(A.GetN()) + " instead of " + to_str(m) + " x "
+		     + to_str(n) + ".");
+#endif
+
+    for (int i = 0; i < m; i++)
+      for (int j = 0; j < n; j++)
+	data_[i*n + j] = A(i, j);
+  }
+
+
+  //! Sets all elements to \a x.
+  template <class T, int m, int n> template<class T0>
+  inline TinyMatrix<T, m, n>& TinyMatrix<T, m, n>::operator= (const T0& x)
+  {
+    Fill(x);
+    return *this;
+  }
+
+
+  //! Adds a matrix to the current matrix.
+  template <class T, int m, int n>
+  inline TinyMatrix<T, m, n>&
+  TinyMatrix<T, m, n>::operator+= (const TinyMatrix<T, m, n>& A)
+  {
+    for (int i = 0; i < m*n; i++)
+      data_[i] += A.data_[i];
+    return *this;
+  }
+
+
+  //! Multiplies the matrix by a scalar.
+  template <class T, int m, int n> template<class T0>
+  inline TinyMatrix<T, m, n>& TinyMatrix<T, m, n>::operator*= (const T0& alpha)
+  {
+    for (int i = 0; i < m*n; i++)
+      data_[i] *= alpha;
+    return *this;
+  }
+
+
+  //! y = A x
+  template<class T, int m, int n>
+  inline void Mlt(const TinyMatrix<T, m, n>& A, const TinyVector<T, n>& x,
+		  TinyVector<T, m>& y)
+  {
+    for (int i = 0; i < m; i++)
+      {
+	T s;
+	SetComplexZero(s);
+	for (int j = 0; j < n; j++)
+	  s += A(i, j)*x(j);
+	y(i) = s;
+      }
+  }
+
+
+  //! y = beta y + alpha A x
+  template<class T0, class T, int m, int n>
+  inline void MltAdd(const T0& alpha, const TinyMatrix<T, m, n>& A,
+		     const TinyVector<T, n>& x, const T0& beta,
+		     TinyVector<T, m>& y)
+  {
+    for (int i = 0; i < m; i++)
+      {
+	T s;
+	SetComplexZero(s);
+	for (int j = 0; j < n; j++)
+	  s += A(i, j)*x(j);
+	y(i) = beta*y(i) + alpha*s;
+      }
+  }
+
+
+  //! C = A B
+  template<class T, int m, int k, int n>
+  inline void Mlt(const TinyMatrix<T, m, k>& A, const TinyMatrix<T, k, n>& B,
+		  TinyMatrix<T, m, n>& C)
+  {
+    C.Zero();
+    for (int i = 0; i < m; i++)
+      for (int p = 0; p < k; p++)
+	for (int j = 0; j < n; j++)
+	  C(i, j) += A(i, p)*B(p, j);
+  }
+
+
+  //! C = beta C + alpha A B
+  template<class T0, class T, int m, int k, int n>
+  inline void MltAdd(const T0& alpha, const TinyMatrix<T, m, k>& A,
+		     const TinyMatrix<T, k, n>& B, const T0& beta,
+		     TinyMatrix<T, m, n>& C)
+  {
+    TinyMatrix<T, m, n> AB;
+    Mlt(A, B, AB);
+    for (int i = 0; i < m; i++)
+      for (int j = 0; j < n; j++)
+	C(i, j) = beta*C(i, j) + alpha*AB(i, j);
+  }
+
+
+  //! B = A^T
+  template<class T, int m, int n>
+  inline void Transpose(const TinyMatrix<T, m, n>& A, TinyMatrix<T, n, m>& B)
+  {
+    for (int i = 0; i < m; i++)
+      for (int j = 0; j < n; j++)
+	B(j, i) = A(i, j);
+  }
+
+
+} // namespace Seldon.
+
+
+#define SELDON_FILE_TINY_MATRIX_INLINE_CXX
+#endif
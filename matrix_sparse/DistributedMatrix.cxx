@@ -277,17 +277,19 @@ namespace Seldon
                   const Vector<IVect>& num_send, const IVect& proc_send,
                   Vector<T2>& Xcol) const
   {
+    SELDON_PROFILE("DistributedMatrix::ScatterValues");
+
     // sending datas
     MPI::Comm& comm = *comm_;
     Vector<Vector<T2> > xsend(proc_send.GetM()), xrecv(proc_recv.GetM());
     Vector<Vector<int64_t> > xsend_tmp(proc_send.GetM()),
       xrecv_tmp(proc_recv.GetM());
     
-    int tag = 30;
+    int tag = 30, nb_send = 0;
     Vector<MPI::Request> request_send(proc_send.GetM());
     for (int i = 0; i < proc_send.GetM(); i++)
       {
-        int nb = num_send(i).GetM();
+        int nb = num_send(i).GetM(); nb_send += nb;
         xsend(i).Reallocate(nb);
         for (int j = 0; j < nb; j++)
           xsend(i)(j) = X(num_send(i)(j));
@@ -315,6 +317,7 @@ namespace Seldon
     for (int i = 0; i < request_recv.GetM(); i++)
       request_recv(i).Wait(status);
     
+    SELDON_PROFILE_COUNT(0., double(nb_send + N) * sizeof(T2));
     xsend.Clear();
     // completing receives
     for (int i = 0; i < request_recv.GetM(); i++)
@@ -336,13 +339,15 @@ namespace Seldon
                  const Vector<IVect>& num_send, const IVect& proc_send,
 		 Vector<T2>& X) const
   {
+    SELDON_PROFILE("DistributedMatrix::AssembleValues");
+
     // sending datas
     MPI::Comm& comm = *comm_;
     Vector<Vector<T2> > xsend(proc_recv.GetM()), xrecv(proc_send.GetM());    
     Vector<Vector<int64_t> > xsend_tmp(proc_recv.GetM()),
       xrecv_tmp(proc_send.GetM());
     
-    int tag = 32, N = 0;
+    int tag = 32, N = 0, nb_recv = 0;
     Vector<MPI::Request> request_send(proc_recv.GetM());
     for (int i = 0; i < proc_recv.GetM(); i++)
       {
@@ -359,7 +364,7 @@ namespace Seldon
     Vector<MPI::Request> request_recv(proc_send.GetM());
     for (int i = 0; i < proc_send.GetM(); i++)
       {
-        int nb = num_send(i).GetM();
+        int nb = num_send(i).GetM(); nb_recv += nb;
         xrecv(i).Reallocate(nb);
         request_recv(i) =
           MpiIrecv(comm, xrecv(i), xrecv_tmp(i), nb, proc_send(i), tag);
@@ -373,6 +378,7 @@ namespace Seldon
     for (int i = 0; i < request_recv.GetM(); i++)
       request_recv(i).Wait(status);
     
+    SELDON_PROFILE_COUNT(0., double(N + nb_recv) * sizeof(T2));
     xsend.Clear();
     // completing receives
     for (int i = 0; i < request_recv.GetM(); i++)
@@ -400,10 +406,12 @@ namespace Seldon
                     const Vector<IVect>& num_send, const IVect& proc_send,
                     IVect& Y, IVect& Yproc) const
   {
+    SELDON_PROFILE("DistributedMatrix::AssembleValuesMin");
+
     // sending datas
     MPI::Comm& comm = *comm_;
     Vector<Vector<int> > xsend(proc_recv.GetM()), xrecv(proc_send.GetM());    
-    int tag = 35, N = 0;
+    int tag = 35, N = 0, nb_recv = 0;
     Vector<MPI::Request> request_send(proc_recv.GetM());
     for (int i = 0; i < proc_recv.GetM(); i++)
       {
@@ -424,7 +432,7 @@ namespace Seldon
     Vector<MPI::Request> request_recv(proc_send.GetM());
     for (int i = 0; i < proc_send.GetM(); i++)
       {
-        int nb = num_send(i).GetM();
+        int nb = num_send(i).GetM(); nb_recv += nb;
         xrecv(i).Reallocate(2*nb);
         request_recv(i) = comm.Irecv(xrecv(i).GetDataVoid(), 2*nb,
                                      GetMpiDataType(Xcol), proc_send(i), tag);
@@ -438,6 +446,7 @@ namespace Seldon
     for (int i = 0; i < request_recv.GetM(); i++)
       request_recv(i).Wait(status);
     
+    SELDON_PROFILE_COUNT(0., 2. * (N + nb_recv) * sizeof(int));
     xsend.Clear();
     // values are assembled in X
     for (int i = 0; i < num_send.GetM(); i++)
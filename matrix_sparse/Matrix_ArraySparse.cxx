@@ -294,10 +294,10 @@ namespace Seldon
 		    "Stream is not ready.");
 #endif
 
-    FileStream.write(reinterpret_cast<char*>(const_cast<int*>(&this->m_)),
-		     sizeof(int));
-    FileStream.write(reinterpret_cast<char*>(const_cast<int*>(&this->n_)),
-		     sizeof(int));
+    FileStream.write(reinterpret_cast<char*>(const_cast<size_t*>(&this->m_)),
+		     sizeof(size_t));
+    FileStream.write(reinterpret_cast<char*>(const_cast<size_t*>(&this->n_)),
+		     sizeof(size_t));
 
     for (int i = 0; i < val_.GetM(); i++)
       val_(i).Write(FileStream);
@@ -406,10 +406,10 @@ namespace Seldon
 		    "Stream is not ready.");
 #endif
 
-    FileStream.read(reinterpret_cast<char*>(const_cast<int*>(&this->m_)),
-		    sizeof(int));
-    FileStream.read(reinterpret_cast<char*>(const_cast<int*>(&this->n_)),
-		    sizeof(int));
+    FileStream.read(reinterpret_cast<char*>(const_cast<size_t*>(&this->m_)),
+		    sizeof(size_t));
+    FileStream.read(reinterpret_cast<char*>(const_cast<size_t*>(&this->n_)),
+		    sizeof(size_t));
 
     val_.Reallocate(Storage::GetFirst(this->m_, this->n_));
     for (int i = 0; i < val_.GetM(); i++)
@@ -526,7 +526,7 @@ namespace Seldon
   */
   template <class T, class Prop, class Allocator>
   void Matrix<T, Prop, ArrayColSparse, Allocator>::
-  AddInteractionRow(int i, int nb, const Vector<int>& col, const Vector<T>& val)
+  AddInteractionRow(size_t i, size_t nb, const IVect& col, const Vector<T>& val)
   {
     for (int j = 0; j < nb; j++)
       this->val_(col(j)).AddInteraction(i, val(j));
@@ -542,7 +542,7 @@ namespace Seldon
   */
   template <class T, class Prop, class Allocator>
   void Matrix<T, Prop, ArrayColSparse, Allocator>::
-  AddInteractionColumn(int i, int nb, const Vector<int>& row,
+  AddInteractionColumn(size_t i, size_t nb, const IVect& row,
 		       const Vector<T>& val, bool already_sorted)
   {
     this->val_(i).AddInteractionRow(nb, row, val, already_sorted);
@@ -606,7 +606,7 @@ namespace Seldon
   */
   template <class T, class Prop, class Allocator>
   void Matrix<T, Prop, ArrayRowSparse, Allocator>::
-  AddInteractionRow(int i, int nb, const Vector<int>& col,
+  AddInteractionRow(size_t i, size_t nb, const IVect& col,
 		    const Vector<T>& val, bool already_sorted)
   {
     this->val_(i).AddInteractionRow(nb, col, val, already_sorted);
@@ -622,7 +622,7 @@ namespace Seldon
   */
   template <class T, class Prop, class Allocator>
   void Matrix<T, Prop, ArrayRowSparse, Allocator>::
-  AddInteractionRow(int i, int nb, const Vector<int>& col,
+  AddInteractionRow(size_t i, size_t nb, const IVect& col,
 		    const Vector<T>& val)
   {
     AddInteractionRow(i, nb, col, val, false);
@@ -638,7 +638,7 @@ namespace Seldon
   */
   template <class T, class Prop, class Allocator>
   void Matrix<T, Prop, ArrayRowSparse, Allocator>::
-  AddInteractionColumn(int i, int nb, const Vector<int>& row,
+  AddInteractionColumn(size_t i, size_t nb, const IVect& row,
 		       const Vector<T>& val)
   {
     for (int j = 0; j < nb; j++)
@@ -703,7 +703,7 @@ namespace Seldon
   */
   template <class T, class Prop, class Allocator>
   void Matrix<T, Prop, ArrayColSymSparse, Allocator>::
-  AddInteractionRow(int i, int nb, const Vector<int>& col,
+  AddInteractionRow(size_t i, size_t nb, const IVect& col,
 		    const Vector<T>& val)
   {
     for (int j = 0; j < nb; j++)
@@ -721,7 +721,7 @@ namespace Seldon
   */
   template <class T, class Prop, class Allocator>
   void Matrix<T, Prop, ArrayColSymSparse, Allocator>::
-  AddInteractionColumn(int i, int nb, const Vector<int>& row,
+  AddInteractionColumn(size_t i, size_t nb, const IVect& row,
 		       const Vector<T>& val, bool already_sorted)
   {
     IVect new_row(nb);
@@ -795,7 +795,7 @@ namespace Seldon
   */
   template <class T, class Prop, class Allocator>
   void Matrix<T, Prop, ArrayRowSymSparse, Allocator>::
-  AddInteractionRow(int i, int nb, const Vector<int>& col,
+  AddInteractionRow(size_t i, size_t nb, const IVect& col,
 		    const Vector<T>& val, bool already_sorted)
   {
     IVect new_col(nb);
@@ -821,7 +821,7 @@ namespace Seldon
   */
   template <class T, class Prop, class Allocator>
   void Matrix<T, Prop, ArrayRowSymSparse, Allocator>::
-  AddInteractionRow(int i, int nb, const Vector<int>& col,
+  AddInteractionRow(size_t i, size_t nb, const IVect& col,
 		    const Vector<T>& val)
   {
     AddInteractionRow(i, nb, col, val, false);
@@ -837,7 +837,7 @@ namespace Seldon
   */
   template <class T, class Prop, class Allocator>
   void Matrix<T, Prop, ArrayRowSymSparse, Allocator>::
-  AddInteractionColumn(int i, int nb, const Vector<int>& row,
+  AddInteractionColumn(size_t i, size_t nb, const IVect& row,
 		       const Vector<T>& val)
   {
     for (int j = 0; j < nb; j++)
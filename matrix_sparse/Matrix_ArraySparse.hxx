@@ -73,7 +73,7 @@ namespace Seldon
 
     // Inline methods.
     int GetDataSize() const;
-    int* GetIndex(int i) const;
+    size_t* GetIndex(int i) const;
     T* GetData(int i) const;
 
     Vector<T, VectSparse, Allocator>* GetData() const;
@@ -91,11 +91,11 @@ namespace Seldon
 
     const T& Value(int num_row, int i) const;
     T& Value(int num_row, int i);
-    int Index(int num_row, int i) const;
+    size_t Index(size_t num_row, size_t i) const;
     size_t& Index(size_t num_row, size_t i);
 
     void SetData(int, int, Vector<T, VectSparse, Allocator>*);
-    void SetData(int, int, T*, int*);
+    void SetData(size_t, size_t, T*, size_t*);
     void Nullify(int i);
     void Nullify();
 
@@ -198,10 +198,10 @@ namespace Seldon
     void AddInteractionRow(size_t, size_t, size_t*, T*);
     void AddInteractionColumn(size_t, size_t, size_t*, T*, bool already_sorted = false);
 
-    void AddInteractionRow(int i, int nb, const Vector<int>& col,
+    void AddInteractionRow(size_t i, size_t nb, const IVect& col,
 			   const Vector<T>& val);
     
-    void AddInteractionColumn(int i, int nb, const Vector<int>& row,
+    void AddInteractionColumn(size_t i, size_t nb, const IVect& row,
 			      const Vector<T>& val,
                               bool already_sorted = false);
     
@@ -240,13 +240,13 @@ namespace Seldon
     void AddInteractionRow(size_t, size_t, size_t*, T*, bool already_sorted = false);
     void AddInteractionColumn(size_t, size_t, size_t*, T*);
 
-    void AddInteractionRow(int i, int nb, const Vector<int>& col,
+    void AddInteractionRow(size_t i, size_t nb, const IVect& col,
 			   const Vector<T>& val, bool already_sorted);
 
-    void AddInteractionRow(int i, int nb, const Vector<int>& col,
+    void AddInteractionRow(size_t i, size_t nb, const IVect& col,
 			   const Vector<T>& val);
     
-    void AddInteractionColumn(int i, int nb, const Vector<int>& row,
+    void AddInteractionColumn(size_t i, size_t nb, const IVect& row,
 			      const Vector<T>& val);
   };
 
@@ -295,10 +295,10 @@ namespace Seldon
     void AddInteractionColumn(size_t, size_t, size_t*, T*,
                               bool already_sorted = false);
 
-    void AddInteractionRow(int i, int nb, const Vector<int>& col,
+    void AddInteractionRow(size_t i, size_t nb, const IVect& col,
 			   const Vector<T>& val);
 
-    void AddInteractionColumn(int i, int nb, const Vector<int>& row,
+    void AddInteractionColumn(size_t i, size_t nb, const IVect& row,
 			      const Vector<T>& val,
                               bool already_sorted = false);
   };
@@ -348,13 +348,13 @@ namespace Seldon
     void AddInteractionRow(size_t, size_t, size_t*, T*, bool already_sorted = false);
     void AddInteractionColumn(size_t, size_t, size_t*, T*);
 
-    void AddInteractionRow(int i, int nb, const Vector<int>& col,
+    void AddInteractionRow(size_t i, size_t nb, const IVect& col,
 			   const Vector<T>& val, bool already_sorted);
     
-    void AddInteractionRow(int i, int nb, const Vector<int>& col,
+    void AddInteractionRow(size_t i, size_t nb, const IVect& col,
 			   const Vector<T>& val);
     
-    void AddInteractionColumn(int i, int nb, const Vector<int>& row,
+    void AddInteractionColumn(size_t i, size_t nb, const IVect& row,
 			      const Vector<T>& val);
     
   };
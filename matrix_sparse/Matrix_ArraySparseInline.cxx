@@ -97,7 +97,7 @@ namespace Seldon
     of row (or column) i.
   */
   template <class T, class Prop, class Storage, class Allocator>
-  inline int* Matrix_ArraySparse<T, Prop, Storage, Allocator>::GetIndex(int i)
+  inline size_t* Matrix_ArraySparse<T, Prop, Storage, Allocator>::GetIndex(int i)
     const
   {
     return val_(i).GetIndex();
@@ -308,8 +308,8 @@ namespace Seldon
     \return Column/row number of j-th non-zero value of row/column i.
   */
   template <class T, class Prop, class Storage, class Allocator> inline
-  int Matrix_ArraySparse<T, Prop, Storage, Allocator>::Index(int i, int j)
-    const
+  size_t Matrix_ArraySparse<T, Prop, Storage, Allocator>
+  ::Index(size_t i, size_t j) const
   {
 
 #ifdef SELDON_CHECK_BOUNDS
@@ -349,7 +349,7 @@ namespace Seldon
   */
   template <class T, class Prop, class Storage, class Allocator>
   inline void Matrix_ArraySparse<T, Prop, Storage, Allocator>::
-  SetData(int i, int n, T* val, int* ind)
+  SetData(size_t i, size_t n, T* val, size_t* ind)
   {
     val_(i).SetData(n, val, ind);
   }
@@ -48,10 +48,9 @@ namespace Seldon
 			       Vector<Tint, VectFull, Allocator2>& IndRow,
 			       Vector<Tint, VectFull, Allocator3>& IndCol,
 			       Vector<T, VectFull, Allocator4>& Val,
-			       size_t index, bool sym)
+			       size_t index, bool)
   {
-    size_t i, j;
-    size_t m = A.GetM();
+    long m = A.GetM();
     size_t nnz = A.GetDataSize();
     IndRow.Reallocate(nnz);
     IndCol.Reallocate(nnz);
@@ -59,8 +58,12 @@ namespace Seldon
     size_t* ptr = A.GetPtr();
     size_t* ind = A.GetInd();
     T* val = A.GetData();
-    for (i = 0; i < m; i++)
-      for (j = ptr[i]; j< ptr[i+1]; j++)
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) \
+  num_threads(ParallelContext::GetNumThreads(m))
+#endif
+    for (long i = 0; i < m; i++)
+      for (size_t j = ptr[i]; j < ptr[i+1]; j++)
 	{
 	  IndRow(j) = i + index;
 	  IndCol(j) = ind[j] + index;
@@ -80,14 +83,14 @@ namespace Seldon
 			       Vector<T, VectFull, Allocator4>& Val,
 			       int index, bool sym)
   {
-    int i, j;
-    int n = A.GetN();
-    int nnz = A.GetDataSize();
+    size_t i, j;
+    size_t n = A.GetN();
+    size_t nnz = A.GetDataSize();
     IndCol.Reallocate(nnz);
     IndRow.Reallocate(nnz);
     Val.Reallocate(nnz);
-    int* ptr = A.GetPtr();
-    int* ind = A.GetInd();
+    size_t* ptr = A.GetPtr();
+    size_t* ind = A.GetInd();
     T* val = A.GetData();
     for (i = 0; i < n; i++)
       for (j = ptr[i]; j< ptr[i+1]; j++)
@@ -110,11 +113,11 @@ namespace Seldon
 			       Vector<T, VectFull, Allocator4>& Val,
 			       int index, bool sym)
   {
-    int i, j;
-    int m = A.GetM();
-    int nnz = A.GetDataSize();
-    int* ptr = A.GetPtr();
-    int* ind = A.GetInd();
+    size_t i, j;
+    size_t m = A.GetM();
+    size_t nnz = A.GetDataSize();
+    size_t* ptr = A.GetPtr();
+    size_t* ind = A.GetInd();
     T* val = A.GetData();
     if (sym)
       {
@@ -188,11 +191,11 @@ namespace Seldon
 			       Vector<T, VectFull, Allocator4>& Val,
 			       int index, bool sym)
   {
-    int i, j;
-    int m = A.GetM();
-    int nnz = A.GetDataSize();
-    int* ptr = A.GetPtr();
-    int* ind = A.GetInd();
+    size_t i, j;
+    size_t m = A.GetM();
+    size_t nnz = A.GetDataSize();
+    size_t* ptr = A.GetPtr();
+    size_t* ind = A.GetInd();
     T* val = A.GetData();
     if (sym)
       {
@@ -269,7 +272,7 @@ namespace Seldon
 			       Vector<Tint, VectFull, Allocator2>& IndRow,
 			       Vector<Tint, VectFull, Allocator3>& IndCol,
 			       Vector<T, VectFull, Allocator4>& Val,
-			       size_t index, bool sym)
+			       size_t index, bool)
   {
     size_t i, j;
     size_t m = A.GetM();
@@ -299,7 +302,7 @@ namespace Seldon
 			       Vector<Tint, VectFull, Allocator2>& IndRow,
 			       Vector<Tint, VectFull, Allocator3>& IndCol,
 			       Vector<T, VectFull, Allocator4>& Val,
-			       int index, bool sym)
+			       int index, bool)
   {
     int i, j;
     int n = A.GetN();
@@ -473,6 +476,36 @@ namespace Seldon
   }
 
 
+  //! Computes the start indices of a CSR or CSC structure.
+  /*!
+    \param[in] m number of rows (or columns).
+    \param[in] Ind sorted row (or column) numbers of the non-zero entries.
+    \param[out] Ptr start index of each row (or column), Ptr(m) being the
+    number of non-zero entries. Each boundary between two consecutive rows
+    in \a Ind is processed independently, in parallel.
+  */
+  template<class Tint, class Allocator1, class Tint2, class Allocator2>
+  void GetPtrFromSortedIndex(size_t m,
+                             const Vector<Tint, VectFull, Allocator1>& Ind,
+                             Vector<Tint2, VectFull, Allocator2>& Ptr)
+  {
+    long nnz = Ind.GetM();
+    Ptr.Reallocate(m + 1);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) \
+  num_threads(ParallelContext::GetNumThreads(nnz + 1))
+#endif
+    for (long i = 0; i <= nnz; i++)
+      {
+        // rows starting at entry i
+        size_t first = (i == 0) ? 0 : size_t(Ind(i-1)) + 1;
+        size_t last = (i == nnz) ? m : size_t(Ind(i));
+        for (size_t r = first; r <= last; r++)
+          Ptr(r) = i;
+      }
+  }
+
+
   /*
     From "Matlab" coordinate format to CSR formats.
   */
@@ -496,41 +529,38 @@ namespace Seldon
 				 Matrix<T, Prop, RowSparse, Allocator3>& A,
 				 size_t index)
   {
-    size_t Nelement = IndRow_.GetLength();
+    long Nelement = IndRow_.GetLength();
 
     Vector<size_t> IndRow(Nelement), IndCol(Nelement);
 
-    for (size_t i = 0; i < Nelement; i++)
+    size_t row_max = 0, col_max = 0;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) reduction(max: row_max, col_max) \
+  num_threads(ParallelContext::GetNumThreads(Nelement))
+#endif
+    for (long i = 0; i < Nelement; i++)
       {
 	IndRow(i) = IndRow_(i) - index;
 	IndCol(i) = IndCol_(i) - index;
+	row_max = max(row_max, IndRow(i));
+	col_max = max(col_max, IndCol(i));
       }
 
     IndRow_.Clear();
     IndCol_.Clear();
 
-    size_t row_max = IndRow.GetNormInf();
-    size_t col_max = IndCol.GetNormInf();
-
     size_t m = row_max + 1;
     size_t n = col_max + 1;
     m = max(m, A.GetM());
     n = max(n, A.GetN());
 
-    Sort(IndRow, IndCol, Val);
+    // Sorts rows, then columns in each row.
+    RadixSort(IndRow, IndCol, Val);
 
     // Construction of array 'Ptr'.
-    Vector<size_t> Ptr(m + 1);
-    Ptr.Zero();
-    for (size_t i = 0; i < Nelement; i++)
-      Ptr(IndRow(i)+1)++;
-
-    for (size_t i = 0; i < m; i++)
-      Ptr(i + 1) += Ptr(i);
-
-    // Sorts 'IndCol'
-    for (size_t i = 0; i < m; i++)
-      Sort(Ptr(i), Ptr(i + 1) - 1, IndCol, Val);
+    Vector<size_t> Ptr;
+    GetPtrFromSortedIndex(m, IndRow, Ptr);
+    IndRow.Clear();
 
     A.SetData(m, n, Val, Ptr, IndCol);
   }
@@ -539,11 +569,11 @@ namespace Seldon
 #ifndef SWIG
 
   //! Conversion from coordinate format to ColSparse.
-  template<class T, class Prop, class Allocator1,
+  template<class T, class Prop, class Tint, class Allocator1,
 	   class Allocator2, class Allocator3>
   void
-  ConvertMatrix_from_Coordinates(Vector<int, VectFull, Allocator1>& IndRow_,
-				 Vector<int, VectFull, Allocator2>& IndCol_,
+  ConvertMatrix_from_Coordinates(Vector<Tint, VectFull, Allocator1>& IndRow_,
+				 Vector<Tint, VectFull, Allocator2>& IndCol_,
 				 Vector<T, VectFull, Allocator3>& Val,
 				 Matrix<T, Prop, ColSparse, Allocator3>& A,
 				 int index)
@@ -553,7 +583,7 @@ namespace Seldon
       return;
 
     int nnz = IndRow_.GetM();
-    Vector<int> IndRow(nnz), IndCol(nnz);
+    Vector<size_t> IndRow(nnz), IndCol(nnz);
     for (int i = 0; i < nnz; i++)
       {
 	IndRow(i) = IndRow_(i);
@@ -562,10 +592,15 @@ namespace Seldon
     IndRow_.Clear();
     IndCol_.Clear();
 
-    int row_max = IndRow.GetNormInf();
-    int col_max = IndCol.GetNormInf();
-    int m = row_max - index + 1;
-    int n = col_max - index + 1;
+    size_t row_max = 0, col_max = 0;
+    for (int i = 0; i < nnz; i++)
+      {
+	row_max = max(row_max, IndRow(i));
+	col_max = max(col_max, IndCol(i));
+      }
+
+    size_t m = row_max - index + 1;
+    size_t n = col_max - index + 1;
     m = max(m, A.GetM());
     n = max(n, A.GetN());
 
@@ -573,7 +608,7 @@ namespace Seldon
     Sort(IndCol, IndRow, Val);
 
     // Construction of array 'Ptr'.
-    Vector<int> Ptr(n + 1);
+    Vector<size_t> Ptr(n + 1);
     Ptr.Zero();
     for (int i = 0; i < nnz; i++)
       {
@@ -582,8 +617,7 @@ namespace Seldon
 	Ptr(IndCol(i) + 1)++;
       }
 
-    for (int i = 0; i < n; i++)
-      Ptr(i + 1) += Ptr(i);
+    CumulativeSum(Ptr);
 
     // Sorts 'IndRow'
     for (int i = 0; i < n; i++)
@@ -594,25 +628,39 @@ namespace Seldon
 
 
   //! Conversion from coordinate format to RowSymSparse.
-  template<class T, class Prop, class Allocator1,
+  template<class T, class Prop, class Tint, class Allocator1,
 	   class Allocator2, class Allocator3>
   void
-  ConvertMatrix_from_Coordinates(Vector<int, VectFull, Allocator1>& IndRow,
-				 Vector<int, VectFull, Allocator2>& IndCol,
+  ConvertMatrix_from_Coordinates(Vector<Tint, VectFull, Allocator1>& IndRow_,
+				 Vector<Tint, VectFull, Allocator2>& IndCol_,
 				 Vector<T, VectFull, Allocator3>& Val,
 				 Matrix<T, Prop, RowSymSparse, Allocator3>& A,
 				 int index)
   {
     // Assuming there is no duplicate value.
-    if (IndRow.GetM() <= 0)
+    if (IndRow_.GetM() <= 0)
       return;
 
-    int nnz = IndRow.GetM();
+    int nnz = IndRow_.GetM();
+    Vector<size_t> IndRow(nnz), IndCol(nnz);
+    for (int i = 0; i < nnz; i++)
+      {
+	IndRow(i) = IndRow_(i);
+	IndCol(i) = IndCol_(i);
+      }
+
+    IndRow_.Clear();
+    IndCol_.Clear();
 
-    int row_max = IndRow.GetNormInf();
-    int col_max = IndCol.GetNormInf();
-    int m = row_max - index + 1;
-    int n = col_max - index + 1;
+    size_t row_max = 0, col_max = 0;
+    for (int i = 0; i < nnz; i++)
+      {
+	row_max = max(row_max, IndRow(i));
+	col_max = max(col_max, IndCol(i));
+      }
+
+    size_t m = row_max - index + 1;
+    size_t n = col_max - index + 1;
     m = max(m, A.GetM());
     n = max(n, A.GetN());
 
@@ -644,7 +692,7 @@ namespace Seldon
     Sort(IndRow, IndCol, Val);
 
     // Construction of array 'Ptr'.
-    Vector<int> Ptr(m + 1);
+    Vector<size_t> Ptr(m + 1);
     Ptr.Zero();
     for (int i = 0; i < nnz; i++)
       {
@@ -653,8 +701,7 @@ namespace Seldon
 	Ptr(IndRow(i) + 1)++;
       }
 
-    for (int i = 0; i < m; i++)
-      Ptr(i + 1) += Ptr(i);
+    CumulativeSum(Ptr);
 
     // Sorts 'IndCol'.
     for (int i = 0; i < m; i++)
@@ -665,11 +712,11 @@ namespace Seldon
 
 
   //! Conversion from coordinate format to ColSymSparse.
-  template<class T, class Prop, class Allocator1,
+  template<class T, class Prop, class Tint, class Allocator1,
 	   class Allocator2, class Allocator3>
   void
-  ConvertMatrix_from_Coordinates(Vector<int, VectFull, Allocator1>& IndRow_,
-				 Vector<int, VectFull, Allocator2>& IndCol_,
+  ConvertMatrix_from_Coordinates(Vector<Tint, VectFull, Allocator1>& IndRow_,
+				 Vector<Tint, VectFull, Allocator2>& IndCol_,
 				 Vector<T, VectFull, Allocator3>& Val,
 				 Matrix<T, Prop, ColSymSparse, Allocator3>& A,
 				 int index)
@@ -679,7 +726,7 @@ namespace Seldon
       return;
 
     int nnz = IndRow_.GetM();
-    Vector<int> IndRow(nnz), IndCol(nnz);
+    Vector<size_t> IndRow(nnz), IndCol(nnz);
     for (int i = 0; i < nnz; i++)
       {
 	IndRow(i) = IndRow_(i);
@@ -689,10 +736,15 @@ namespace Seldon
     IndRow_.Clear();
     IndCol_.Clear();
 
-    int row_max = IndRow.GetNormInf();
-    int col_max = IndCol.GetNormInf();
-    int m = row_max - index + 1;
-    int n = col_max - index + 1;
+    size_t row_max = 0, col_max = 0;
+    for (int i = 0; i < nnz; i++)
+      {
+	row_max = max(row_max, IndRow(i));
+	col_max = max(col_max, IndCol(i));
+      }
+
+    size_t m = row_max - index + 1;
+    size_t n = col_max - index + 1;
     m = max(m, A.GetM());
     n = max(n, A.GetN());
 
@@ -724,7 +776,7 @@ namespace Seldon
     Sort(IndCol, IndRow, Val);
 
     // Construction of array 'Ptr'.
-    Vector<int> Ptr(m + 1);
+    Vector<size_t> Ptr(m + 1);
     Ptr.Zero();
     for (int i = 0; i < nnz; i++)
       {
@@ -733,8 +785,7 @@ namespace Seldon
 	Ptr(IndCol(i) + 1)++;
       }
 
-    for (int i = 0; i < m; i++)
-      Ptr(i + 1) += Ptr(i);
+    CumulativeSum(Ptr);
 
     // Sorts 'IndRow'.
     for (int i = 0; i < m; i++)
@@ -750,11 +801,11 @@ namespace Seldon
 
 
   //! Conversion from coordinate format to ArrayRowSparse.
-  template<class T, class Prop, class Allocator1,
+  template<class T, class Prop, class Tint, class Allocator1,
 	   class Allocator2, class Allocator3>
   void
-  ConvertMatrix_from_Coordinates(Vector<int, VectFull, Allocator1>& IndRow_,
-				 Vector<int, VectFull, Allocator2>& IndCol_,
+  ConvertMatrix_from_Coordinates(Vector<Tint, VectFull, Allocator1>& IndRow_,
+				 Vector<Tint, VectFull, Allocator2>& IndCol_,
 				 Vector<T, VectFull, Allocator3>& Val,
 				 Matrix<T, Prop, ArrayRowSparse,
 				 Allocator3>& A,
@@ -764,7 +815,7 @@ namespace Seldon
       return;
 
     int nnz = IndRow_.GetM();
-    Vector<int> IndRow(nnz), IndCol(nnz);
+    Vector<size_t> IndRow(nnz), IndCol(nnz);
     for (int i = 0; i < nnz; i++)
       {
 	IndRow(i) = IndRow_(i);
@@ -773,10 +824,15 @@ namespace Seldon
     IndRow_.Clear();
     IndCol_.Clear();
 
-    int row_max = IndRow.GetNormInf();
-    int col_max = IndCol.GetNormInf();
-    int m = row_max - index + 1;
-    int n = col_max - index + 1;
+    size_t row_max = 0, col_max = 0;
+    for (int i = 0; i < nnz; i++)
+      {
+	row_max = max(row_max, IndRow(i));
+	col_max = max(col_max, IndCol(i));
+      }
+
+    size_t m = row_max - index + 1;
+    size_t n = col_max - index + 1;
     m = max(m, A.GetM());
     n = max(n, A.GetN());
 
@@ -784,7 +840,7 @@ namespace Seldon
     Sort(IndRow, IndCol, Val);
 
     // Number of elements per row.
-    Vector<int> Ptr(m);
+    Vector<size_t> Ptr(m);
     Ptr.Zero();
     for (int i = 0; i < nnz; i++)
       {
@@ -814,11 +870,11 @@ namespace Seldon
 
 
   //! Conversion from coordinate format to ArrayColSparse.
-  template<class T, class Prop, class Allocator1,
+  template<class T, class Prop, class Tint, class Allocator1,
 	   class Allocator2, class Allocator3>
   void
-  ConvertMatrix_from_Coordinates(Vector<int, VectFull, Allocator1>& IndRow_,
-				 Vector<int, VectFull, Allocator2>& IndCol_,
+  ConvertMatrix_from_Coordinates(Vector<Tint, VectFull, Allocator1>& IndRow_,
+				 Vector<Tint, VectFull, Allocator2>& IndCol_,
 				 Vector<T, VectFull, Allocator3>& Val,
 				 Matrix<T, Prop, ArrayColSparse,
 				 Allocator3>& A,
@@ -829,7 +885,7 @@ namespace Seldon
       return;
 
     int nnz = IndRow_.GetM();
-    Vector<int> IndRow(nnz), IndCol(nnz);
+    Vector<size_t> IndRow(nnz), IndCol(nnz);
     for (int i = 0; i < nnz; i++)
       {
 	IndRow(i) = IndRow_(i);
@@ -838,10 +894,15 @@ namespace Seldon
     IndRow_.Clear();
     IndCol_.Clear();
 
-    int row_max = IndRow.GetNormInf();
-    int col_max = IndCol.GetNormInf();
-    int m = row_max - index + 1;
-    int n = col_max - index + 1;
+    size_t row_max = 0, col_max = 0;
+    for (int i = 0; i < nnz; i++)
+      {
+	row_max = max(row_max, IndRow(i));
+	col_max = max(col_max, IndCol(i));
+      }
+
+    size_t m = row_max - index + 1;
+    size_t n = col_max - index + 1;
     m = max(m, A.GetM());
     n = max(n, A.GetN());
 
@@ -849,7 +910,7 @@ namespace Seldon
     Sort(IndCol, IndRow, Val);
 
     // Construction of array 'Ptr'.
-    Vector<int> Ptr(n);
+    Vector<size_t> Ptr(n);
     Ptr.Zero();
     for (int i = 0; i < nnz; i++)
       {
@@ -879,11 +940,11 @@ namespace Seldon
 
 
   //! Conversion from coordinate format to ArrayRowSymSparse.
-  template<class T, class Prop, class Allocator1,
+  template<class T, class Prop, class Tint, class Allocator1,
 	   class Allocator2, class Allocator3>
   void
-  ConvertMatrix_from_Coordinates(Vector<int, VectFull, Allocator1>& IndRow_,
-				 Vector<int, VectFull, Allocator2>& IndCol_,
+  ConvertMatrix_from_Coordinates(Vector<Tint, VectFull, Allocator1>& IndRow_,
+				 Vector<Tint, VectFull, Allocator2>& IndCol_,
 				 Vector<T, VectFull, Allocator3>& Val,
 				 Matrix<T, Prop, ArrayRowSymSparse,
 				 Allocator3>& A,
@@ -894,7 +955,7 @@ namespace Seldon
       return;
 
     int nnz = IndRow_.GetM();
-    Vector<int> IndRow(nnz), IndCol(nnz);
+    Vector<size_t> IndRow(nnz), IndCol(nnz);
     for (int i = 0; i < nnz; i++)
       {
 	IndRow(i) = IndRow_(i);
@@ -903,10 +964,15 @@ namespace Seldon
     IndRow_.Clear();
     IndCol_.Clear();
 
-    int row_max = IndRow.GetNormInf();
-    int col_max = IndCol.GetNormInf();
-    int m = row_max - index + 1;
-    int n = col_max - index + 1;
+    size_t row_max = 0, col_max = 0;
+    for (int i = 0; i < nnz; i++)
+      {
+	row_max = max(row_max, IndRow(i));
+	col_max = max(col_max, IndCol(i));
+      }
+
+    size_t m = row_max - index + 1;
+    size_t n = col_max - index + 1;
     m = max(m, A.GetM());
     n = max(n, A.GetN());
 
@@ -938,7 +1004,7 @@ namespace Seldon
     Sort(IndRow, IndCol, Val);
 
     // Construction of array 'Ptr'.
-    Vector<int> Ptr(m);
+    Vector<size_t> Ptr(m);
     Ptr.Zero();
     for (int i = 0; i < nnz; i++)
       {
@@ -970,11 +1036,11 @@ namespace Seldon
 
 
   //! Conversion from coordinate format to ArrayColSymSparse.
-  template<class T, class Prop, class Allocator1,
+  template<class T, class Prop, class Tint, class Allocator1,
 	   class Allocator2, class Allocator3>
   void
-  ConvertMatrix_from_Coordinates(Vector<int, VectFull, Allocator1>& IndRow_,
-				 Vector<int, VectFull, Allocator2>& IndCol_,
+  ConvertMatrix_from_Coordinates(Vector<Tint, VectFull, Allocator1>& IndRow_,
+				 Vector<Tint, VectFull, Allocator2>& IndCol_,
 				 Vector<T, VectFull, Allocator3>& Val,
 				 Matrix<T, Prop, ArrayColSymSparse,
 				 Allocator3>& A,
@@ -985,7 +1051,7 @@ namespace Seldon
       return;
 
     int nnz = IndRow_.GetM();
-    Vector<int> IndRow(nnz), IndCol(nnz);
+    Vector<size_t> IndRow(nnz), IndCol(nnz);
     for (int i = 0; i < nnz; i++)
       {
 	IndRow(i) = IndRow_(i);
@@ -995,10 +1061,15 @@ namespace Seldon
     IndRow_.Clear();
     IndCol_.Clear();
 
-    int row_max = IndRow.GetNormInf();
-    int col_max = IndCol.GetNormInf();
-    int m = row_max - index + 1;
-    int n = col_max - index + 1;
+    size_t row_max = 0, col_max = 0;
+    for (int i = 0; i < nnz; i++)
+      {
+	row_max = max(row_max, IndRow(i));
+	col_max = max(col_max, IndCol(i));
+      }
+
+    size_t m = row_max - index + 1;
+    size_t n = col_max - index + 1;
     m = max(m, A.GetM());
     n = max(n, A.GetN());
 
@@ -1030,7 +1101,7 @@ namespace Seldon
     Sort(IndCol, IndRow, Val);
 
     // Construction of array 'Ptr'.
-    Vector<int> Ptr(m);
+    Vector<size_t> Ptr(m);
     Ptr.Zero();
     for (int i = 0; i < nnz; i++)
       {
@@ -1074,7 +1145,7 @@ namespace Seldon
   template<class T, class Prop, class Alloc1,
            class Tint, class Alloc2, class Alloc3, class Alloc4>
   void ConvertToCSC(const Matrix<T, Prop, RowSparse, Alloc1>& A,
-                    General& sym, Vector<Tint, VectFull, Alloc2>& Ptr,
+                    General&, Vector<Tint, VectFull, Alloc2>& Ptr,
                     Vector<Tint, VectFull, Alloc3>& IndRow,
                     Vector<T, VectFull, Alloc4>& Val, bool sym_pat)
   {
@@ -1088,8 +1159,20 @@ namespace Seldon
     Vector<Tint> IndCol;
     ConvertMatrix_to_Coordinates(A, IndRow, IndCol, Val);
 
-    // Sorting with respect to column numbers.
-    Sort(IndCol, IndRow, Val);
+    // Sorting with respect to column numbers. Coordinates are sorted by
+    // rows, so that a stable sort keeps rows sorted in each column.
+    Vector<size_t> permutation;
+    GetRadixPermutation(IndCol, permutation);
+    PermuteVector(IndCol, permutation);
+    PermuteVector(IndRow, permutation);
+    PermuteVector(Val, permutation);
+    permutation.Clear();
+
+    if (!sym_pat)
+      {
+        GetPtrFromSortedIndex(n, IndCol, Ptr);
+        return;
+      }
 
     // Constructing pointer array 'Ptr'.
     Ptr.Reallocate(n + 1);
@@ -1132,8 +1215,7 @@ namespace Seldon
 
     // Accumulation to get pointer array.
     Ptr(0) = 0;
-    for (size_t i = 0; i < n; i++)
-      Ptr(i + 1) += Ptr(i);
+    CumulativeSum(Ptr);
 
     if (sym_pat && (nb_new_val > 0))
       {
@@ -1192,7 +1274,7 @@ namespace Seldon
   template<class T, class Prop, class Alloc1,
            class Tint, class Alloc2, class Alloc3, class Alloc4>
   void ConvertToCSC(const Matrix<T, Prop, ArrayRowSparse, Alloc1>& A,
-                    General& sym, Vector<Tint, VectFull, Alloc2>& Ptr,
+                    General&, Vector<Tint, VectFull, Alloc2>& Ptr,
                     Vector<Tint, VectFull, Alloc3>& IndRow,
                     Vector<T, VectFull, Alloc4>& Val, bool sym_pat)
   {
@@ -1204,8 +1286,20 @@ namespace Seldon
     Vector<Tint> IndCol;
     ConvertMatrix_to_Coordinates(A, IndRow, IndCol, Val);
 
-    // Sorting with respect to column numbers.
-    Sort(IndCol, IndRow, Val);
+    // Sorting with respect to column numbers. Coordinates are sorted by
+    // rows, so that a stable sort keeps rows sorted in each column.
+    Vector<size_t> permutation;
+    GetRadixPermutation(IndCol, permutation);
+    PermuteVector(IndCol, permutation);
+    PermuteVector(IndRow, permutation);
+    PermuteVector(Val, permutation);
+    permutation.Clear();
+
+    if (!sym_pat)
+      {
+        GetPtrFromSortedIndex(n, IndCol, Ptr);
+        return;
+      }
 
     // Constructing pointer array 'Ptr'.
     Ptr.Reallocate(n + 1);
@@ -1248,8 +1342,7 @@ namespace Seldon
 
     // Accumulation to get pointer array.
     Ptr(0) = 0;
-    for (size_t i = 0; i < n; i++)
-      Ptr(i + 1) += Ptr(i);
+    CumulativeSum(Ptr);
 
     if (sym_pat && (nb_new_val > 0))
       {
@@ -1383,8 +1476,7 @@ namespace Seldon
 
 	// Accumulation to get pointer array.
 	Ptr(0) = 0;
-	for (int i = 0; i < n; i++)
-	  Ptr(i + 1) += Ptr(i);
+	CumulativeSum(Ptr);
 
 	if (nb_new_val > 0)
 	  {
@@ -1530,8 +1622,7 @@ namespace Seldon
 
 	// Accumulation to get pointer array.
 	Ptr(0) = 0;
-	for (int i = 0; i < n; i++)
-	  Ptr(i + 1) += Ptr(i);
+	CumulativeSum(Ptr);
 
 	if (nb_new_val > 0)
 	  {
@@ -1746,8 +1837,7 @@ namespace Seldon
     for (int i = 0; i < nnz; i++)
       Ptr(IndCol(i) + 1)++;
 
-    for (int i = 0; i < n; i++)
-      Ptr(i+1) += Ptr(i);
+    CumulativeSum(Ptr);
   }
 
 
@@ -1809,8 +1899,7 @@ namespace Seldon
     for (int i = 0; i < nnz; i++)
       Ptr(IndCol(i) + 1)++;
 
-    for (int i = 0; i < n; i++)
-      Ptr(i+1) += Ptr(i);
+    CumulativeSum(Ptr);
   }
 
 
@@ -2123,8 +2212,8 @@ namespace Seldon
   void CopyMatrix(const Matrix<T, Prop1, RowSymSparse, Alloc1>& A,
 		  Matrix<T, Prop2, ColSparse, Alloc2>& B)
   {
-    Vector<int> Ptr;
-    Vector<int> Ind;
+    Vector<size_t> Ptr;
+    Vector<size_t> Ind;
     Vector<T, VectFull, Alloc2> Val;
 
     int m = A.GetM(), n = A.GetN();
@@ -2141,7 +2230,7 @@ namespace Seldon
   void CopyMatrix(const Matrix<T0, Prop0, ArrayRowSymSparse, Allocator0>& A,
 		  Matrix<T1, Prop1, ColSparse, Allocator1>& B)
   {
-    Vector<int> Ptr, Ind;
+    Vector<size_t> Ptr, Ind;
     Vector<T1, VectFull, Allocator1> AllVal;
 
     int n = A.GetM();
@@ -2199,8 +2288,8 @@ namespace Seldon
                     Vector<Tint, VectFull, Alloc3>& IndCol,
                     Vector<T, VectFull, Alloc4>& Value)
   {
-    int m = A.GetM();
-    int  nnz = A.GetDataSize();
+    size_t m = A.GetM();
+    size_t nnz = A.GetDataSize();
     if (m <= 0)
       {
 	Ptr.Clear();
@@ -2209,17 +2298,17 @@ namespace Seldon
 	return;
       }
 
-    int* ptr_ = A.GetPtr();
-    int* ind_ = A.GetInd();
+    size_t* ptr_ = A.GetPtr();
+    size_t* ind_ = A.GetInd();
     T* data_ = A.GetData();
 
     Ptr.Reallocate(m+1);
     IndCol.Reallocate(nnz);
     Value.Reallocate(nnz);
-    for (int i = 0; i <= m; i++)
+    for (size_t i = 0; i <= m; i++)
       Ptr(i) = ptr_[i];
 
-    for (int i = 0; i < nnz; i++)
+    for (size_t i = 0; i < nnz; i++)
       {
         IndCol(i) = ind_[i];
         Value(i) = data_[i];
@@ -2246,8 +2335,8 @@ namespace Seldon
 	return;
       }
 
-    int* ptr_ = A.GetPtr();
-    int* ind_ = A.GetInd();
+    size_t* ptr_ = A.GetPtr();
+    size_t* ind_ = A.GetInd();
     T* data_ = A.GetData();
 
     // Computation of the indexes of the beginning of rows.
@@ -2669,7 +2758,7 @@ namespace Seldon
   void CopyMatrix(const Matrix<T1, Prop1, ColSparse, Alloc1>& A,
 		  Matrix<T2, Prop2, RowSparse, Alloc2>& B)
   {
-    Vector<int> Ptr, Ind;
+    Vector<size_t> Ptr, Ind;
     Vector<T1, VectFull, Alloc2> Value;
 
     General sym;
@@ -2822,8 +2911,8 @@ namespace Seldon
 		  Matrix<T1, Prop1, RowSparse, Allocator1>& mat_csr)
   {
     Vector<T1, VectFull, Allocator1> Val;
-    Vector<int> IndRow;
-    Vector<int> IndCol;
+    Vector<size_t> IndRow;
+    Vector<size_t> IndCol;
 
     General unsym;
     ConvertToCSR(mat_array, unsym, IndRow, IndCol, Val);
@@ -2858,8 +2947,8 @@ namespace Seldon
 		  Matrix<T1, Prop1, RowSparse, Allocator1>& mat_csr)
   {
     Vector<T1, VectFull, Allocator1> Val;
-    Vector<int> IndRow;
-    Vector<int> IndCol;
+    Vector<size_t> IndRow;
+    Vector<size_t> IndCol;
 
     General unsym;
     ConvertToCSR(mat_array, unsym, IndRow, IndCol, Val);
@@ -2886,8 +2975,8 @@ namespace Seldon
 	return;
       }
 
-    int* ptr_ = A.GetPtr();
-    int* ind_ = A.GetInd();
+    size_t* ptr_ = A.GetPtr();
+    size_t* ind_ = A.GetInd();
     T0* data_ = A.GetData();
 
     B.Reallocate(n, n);
@@ -2980,8 +3069,8 @@ namespace Seldon
     int n = A.GetM();
     Vector<int> IndRow(nnz), IndCol(nnz);
     Vector<T1, VectFull, Allocator1> Val(nnz);
-    int* indA = A.GetInd();
-    int* ptrA = A.GetPtr();
+    size_t* indA = A.GetInd();
+    size_t* ptrA = A.GetPtr();
     T0* dataA = A.GetData();
     int ind = 0;
     for (i = 0; i < n; i++)
@@ -3107,8 +3196,8 @@ namespace Seldon
     Matrix<T0, Prop0, RowSparse, Allocator0> A;
     CopyMatrix(Acsc, A);
 
-    int* ptr_ = A.GetPtr();
-    int* ind_ = A.GetInd();
+    size_t* ptr_ = A.GetPtr();
+    size_t* ind_ = A.GetInd();
     T0* data_ = A.GetData();
 
     B.Reallocate(m, n);
@@ -3283,7 +3372,7 @@ namespace Seldon
     int ind = 0;
     for (i = 0; i < n; i++)
       for (j = 0; j < A.GetRowSize(i); j++)
-	if (A.Index(i, j) != i)
+	if (A.Index(i, j) != size_t(i))
 	  {
 	    IndRow(ind) = i;
 	    IndCol(ind) = A.Index(i, j);
@@ -3335,7 +3424,7 @@ namespace Seldon
     int ind = 0;
     for (i = 0; i < n; i++)
       for (j = 0; j < A.GetRowSize(i); j++)
-	if (A.Index(i, j) != i)
+	if (A.Index(i, j) != size_t(i))
 	  {
 	    IndRow(ind) = i;
 	    IndCol(ind) = A.Index(i, j);
@@ -3403,8 +3492,7 @@ namespace Seldon
 
     // Accumulation to get pointer array.
     Ptr(0) = 0;
-    for (i = 0; i < n; i++)
-      Ptr(i + 1) += Ptr(i);
+    CumulativeSum(Ptr);
 
     // we fill matrix B
     B.Reallocate(A.GetM(), n);
@@ -3455,7 +3543,7 @@ namespace Seldon
     Vector<size_t> IndRow2, IndCol2, Index(2*n);
     IndRow2 = IndRow;
     IndCol2 = IndCol;
-    Sort(IndCol2.GetM(), IndCol2, IndRow2);
+    RadixSort(IndCol2, IndRow2);
 
     Tint max_nnz = 0;
     for (size_t i = 0; i < IndRow.GetM(); i++)
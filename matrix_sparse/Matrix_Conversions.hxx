@@ -160,6 +160,12 @@ namespace Seldon
 			       int index = 0, bool sym = false);
 
 
+  template<class Tint, class Allocator1, class Tint2, class Allocator2>
+  void GetPtrFromSortedIndex(size_t m,
+                             const Vector<Tint, VectFull, Allocator1>& Ind,
+                             Vector<Tint2, VectFull, Allocator2>& Ptr);
+
+
   /*
     From "Matlab" coordinate format to CSR formats.
   */
@@ -177,31 +183,31 @@ namespace Seldon
 
 #ifndef SWIG
 
-  template<class T, class Prop, class Allocator1,
+  template<class T, class Prop, class Tint, class Allocator1,
 	   class Allocator2, class Allocator3>
   void
-  ConvertMatrix_from_Coordinates(Vector<int, VectFull, Allocator1>& IndRow_,
-				 Vector<int, VectFull, Allocator2>& IndCol_,
+  ConvertMatrix_from_Coordinates(Vector<Tint, VectFull, Allocator1>& IndRow_,
+				 Vector<Tint, VectFull, Allocator2>& IndCol_,
 				 Vector<T, VectFull, Allocator3>& Val,
 				 Matrix<T, Prop, ColSparse, Allocator3>& A,
 				 int index = 0);
 
 
-  template<class T, class Prop, class Allocator1,
+  template<class T, class Prop, class Tint, class Allocator1,
 	   class Allocator2, class Allocator3>
   void
-  ConvertMatrix_from_Coordinates(Vector<int, VectFull, Allocator1>& IndRow_,
-				 Vector<int, VectFull, Allocator2>& IndCol_,
+  ConvertMatrix_from_Coordinates(Vector<Tint, VectFull, Allocator1>& IndRow_,
+				 Vector<Tint, VectFull, Allocator2>& IndCol_,
 				 Vector<T, VectFull, Allocator3>& Val,
 				 Matrix<T, Prop, RowSymSparse, Allocator3>& A,
 				 int index = 0);
 
 
-  template<class T, class Prop, class Allocator1,
+  template<class T, class Prop, class Tint, class Allocator1,
 	   class Allocator2, class Allocator3>
   void
-  ConvertMatrix_from_Coordinates(Vector<int, VectFull, Allocator1>& IndRow_,
-				 Vector<int, VectFull, Allocator2>& IndCol_,
+  ConvertMatrix_from_Coordinates(Vector<Tint, VectFull, Allocator1>& IndRow_,
+				 Vector<Tint, VectFull, Allocator2>& IndCol_,
 				 Vector<T, VectFull, Allocator3>& Val,
 				 Matrix<T, Prop, ColSymSparse, Allocator3>& A,
 				 int index = 0);
@@ -212,44 +218,44 @@ namespace Seldon
   */
 
 
-  template<class T, class Prop, class Allocator1,
+  template<class T, class Prop, class Tint, class Allocator1,
 	   class Allocator2, class Allocator3>
   void
-  ConvertMatrix_from_Coordinates(Vector<int, VectFull, Allocator1>& IndRow_,
-				 Vector<int, VectFull, Allocator2>& IndCol_,
+  ConvertMatrix_from_Coordinates(Vector<Tint, VectFull, Allocator1>& IndRow_,
+				 Vector<Tint, VectFull, Allocator2>& IndCol_,
 				 Vector<T, VectFull, Allocator3>& Val,
 				 Matrix<T, Prop, ArrayRowSparse,
 				 Allocator3>& A,
 				 int index = 0);
 
 
-  template<class T, class Prop, class Allocator1,
+  template<class T, class Prop, class Tint, class Allocator1,
 	   class Allocator2, class Allocator3>
   void
-  ConvertMatrix_from_Coordinates(Vector<int, VectFull, Allocator1>& IndRow_,
-				 Vector<int, VectFull, Allocator2>& IndCol_,
+  ConvertMatrix_from_Coordinates(Vector<Tint, VectFull, Allocator1>& IndRow_,
+				 Vector<Tint, VectFull, Allocator2>& IndCol_,
 				 Vector<T, VectFull, Allocator3>& Val,
 				 Matrix<T, Prop, ArrayColSparse,
 				 Allocator3>& A,
 				 int index = 0);
 
 
-  template<class T, class Prop, class Allocator1,
+  template<class T, class Prop, class Tint, class Allocator1,
 	   class Allocator2, class Allocator3>
   void
-  ConvertMatrix_from_Coordinates(Vector<int, VectFull, Allocator1>& IndRow_,
-				 Vector<int, VectFull, Allocator2>& IndCol_,
+  ConvertMatrix_from_Coordinates(Vector<Tint, VectFull, Allocator1>& IndRow_,
+				 Vector<Tint, VectFull, Allocator2>& IndCol_,
 				 Vector<T, VectFull, Allocator3>& Val,
 				 Matrix<T, Prop, ArrayRowSymSparse,
 				 Allocator3>& A,
 				 int index = 0);
 
 
-  template<class T, class Prop, class Allocator1,
+  template<class T, class Prop, class Tint, class Allocator1,
 	   class Allocator2, class Allocator3>
   void
-  ConvertMatrix_from_Coordinates(Vector<int, VectFull, Allocator1>& IndRow_,
-				 Vector<int, VectFull, Allocator2>& IndCol_,
+  ConvertMatrix_from_Coordinates(Vector<Tint, VectFull, Allocator1>& IndRow_,
+				 Vector<Tint, VectFull, Allocator2>& IndCol_,
 				 Vector<T, VectFull, Allocator3>& Val,
 				 Matrix<T, Prop, ArrayColSymSparse,
 				 Allocator3>& A,
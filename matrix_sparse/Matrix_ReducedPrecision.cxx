@@ -0,0 +1,375 @@
+// Copyright (C) 2016 INRIA
+//
+// This file is part of the linear-algebra library Seldon,
+// http://seldon.sourceforge.net/.
+//
+// Seldon is free software; you can redistribute it and/or modify it under the
+// terms of the GNU Lesser General Public License as published by the Free
+// Software Foundation; either version 2.1 of the License, or (at your option)
+// any later version.
+//
+// Seldon is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for
+// more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with Seldon. If not, see http://www.gnu.org/licenses/.
+
+
+
+#ifndef SELDON_FILE_MATRIX_REDUCED_PRECISION_CXX
+
+#include "Matrix_ReducedPrecision.hxx"
+
+/*
+  Functions defined in this file
+
+  conversion to reduced precision
+  Copy(A, B)
+
+  alpha M X + beta Y -> Y
+  MltAdd(alpha, M, X, beta, Y)
+
+  SOR(M, X, B, omega, iter)
+*/
+
+namespace Seldon
+{
+
+
+  ////////////////////////////
+  // REDUCEDPRECISIONMATRIX //
+  ////////////////////////////
+
+
+  //! Allocates the matrix, previous values are lost.
+  /*!
+    \param[in] m number of rows
+    \param[in] n number of columns
+    \param[in] nnz number of stored values
+    The first entries of the rows (GetPtr), the column numbers (GetInd) and
+    the values (GetData) have to be filled.
+  */
+  template<class T, class Prop, class Tvalue>
+  void ReducedPrecisionMatrix<T, Prop, Tvalue>
+  ::Reallocate(size_t m, size_t n, size_t nnz)
+  {
+    if ((n > 0) && (n - 1 > size_t(numeric_limits<uint32_t>::max())))
+      throw WrongArgument("ReducedPrecisionMatrix::Reallocate",
+			  "The number of columns (" + to_str(n)
+			  + ") is too large for column numbers on 32 bits.");
+
+    m_ = m;
+    n_ = n;
+    ptr_.Reallocate(m+1);
+    ptr_.Zero();
+    ind_.Reallocate(nnz);
+    data_.Reallocate(nnz);
+  }
+
+
+  /////////////////////////////
+  // REDUCEDPRECISIONPRODUCT //
+  /////////////////////////////
+
+
+  //! Constructor.
+  /*!
+    \param[in] alpha scalar multiplying M X, NULL if Y = M X.
+    \param[in] ptr row start indices of M.
+    \param[in] ind column indices of M.
+    \param[in] data values of M.
+    \param[in] X vector multiplied by M.
+    \param[in,out] Y result.
+  */
+  template<class T0, class T1, class Tvalue, class Vector2, class Vector4>
+  ReducedPrecisionProduct<T0, T1, Tvalue, Vector2, Vector4>
+  ::ReducedPrecisionProduct(const T0* alpha, const size_t* ptr,
+			    const uint32_t* ind, const Tvalue* data,
+			    const Vector2& X, Vector4& Y)
+    : alpha_(alpha), ptr_(ptr), ind_(ind), data_(data), X_(X), Y_(Y)
+  {
+  }
+
+
+  //! Computes the rows i0 to i1 - 1 of the product.
+  template<class T0, class T1, class Tvalue, class Vector2, class Vector4>
+  void ReducedPrecisionProduct<T0, T1, Tvalue, Vector2, Vector4>
+  ::operator()(size_t i0, size_t i1) const
+  {
+    typename Vector4::value_type zero, temp;
+    SetComplexZero(zero);
+
+    for (size_t i = i0; i < i1; i++)
+      {
+	temp = zero;
+	for (size_t j = ptr_[i]; j < ptr_[i+1]; j++)
+	  temp += T1(data_[j]) * X_(ind_[j]);
+
+	if (alpha_ == NULL)
+	  Y_(i) = temp;
+	else
+	  Y_(i) += *alpha_ * temp;
+      }
+  }
+
+
+  ////////////////
+  // CONVERSION //
+  ////////////////
+
+
+  //! Conversion of a RowSparse matrix to reduced precision.
+  /*!
+    Each value is rounded to the nearest value of type Tvalue.
+  */
+  template<class T0, class Allocator0, class T, class Tvalue>
+  void Copy(const Matrix<T0, General, RowSparse, Allocator0>& A,
+	    ReducedPrecisionMatrix<T, General, Tvalue>& B)
+  {
+    size_t m = A.GetM(), nnz = A.GetDataSize();
+    B.Reallocate(m, A.GetN(), nnz);
+
+    size_t* ptr = B.GetPtr();
+    uint32_t* ind = B.GetInd();
+    Tvalue* data = B.GetData();
+    const size_t* ptrA = A.GetPtr();
+    const size_t* indA = A.GetInd();
+    const T0* dataA = A.GetData();
+    for (size_t i = 0; i <= m; i++)
+      ptr[i] = ptrA[i];
+
+    for (size_t k = 0; k < nnz; k++)
+      {
+	ind[k] = uint32_t(indA[k]);
+	data[k] = Tvalue(dataA[k]);
+      }
+  }
+
+
+  //! Conversion of a ArrayRowSparse matrix to reduced precision.
+  /*!
+    All the stored values are kept (even null values) in the same order, so
+    that the k-th value of a row is the same in A and B.
+  */
+  template<class T0, class Allocator0, class T, class Tvalue>
+  void Copy(const Matrix<T0, General, ArrayRowSparse, Allocator0>& A,
+	    ReducedPrecisionMatrix<T, General, Tvalue>& B)
+  {
+    size_t m = A.GetM();
+    B.Reallocate(m, A.GetN(), A.GetDataSize());
+
+    size_t* ptr = B.GetPtr();
+    uint32_t* ind = B.GetInd();
+    Tvalue* data = B.GetData();
+    for (size_t i = 0; i < m; i++)
+      {
+	size_t size_row = A.GetRowSize(i);
+	ptr[i+1] = ptr[i] + size_row;
+	for (size_t k = 0; k < size_row; k++)
+	  {
+	    ind[ptr[i] + k] = uint32_t(A.Index(i, k));
+	    data[ptr[i] + k] = Tvalue(A.Value(i, k));
+	  }
+      }
+  }
+
+
+  //! Conversion of a ArrayRowSymSparse matrix to reduced precision.
+  /*!
+    The upper part of A is stored, all the stored values are kept (even
+    null values) in the same order.
+  */
+  template<class T0, class Allocator0, class T, class Tvalue>
+  void Copy(const Matrix<T0, Symmetric, ArrayRowSymSparse, Allocator0>& A,
+	    ReducedPrecisionMatrix<T, Symmetric, Tvalue>& B)
+  {
+    size_t m = A.GetM();
+    B.Reallocate(m, A.GetN(), A.GetDataSize());
+
+    size_t* ptr = B.GetPtr();
+    uint32_t* ind = B.GetInd();
+    Tvalue* data = B.GetData();
+    for (size_t i = 0; i < m; i++)
+      {
+	size_t size_row = A.GetRowSize(i);
+	ptr[i+1] = ptr[i] + size_row;
+	for (size_t k = 0; k < size_row; k++)
+	  {
+	    ind[ptr[i] + k] = uint32_t(A.Index(i, k));
+	    data[ptr[i] + k] = Tvalue(A.Value(i, k));
+	  }
+      }
+  }
+
+
+  ////////////
+  // MLTADD //
+  ////////////
+
+
+  //! Returns the number of bytes moved by a matrix-vector product.
+  /*!
+    Values (sizeof(Tvalue1) bytes), column numbers (4 bytes) and row
+    pointers of M, X and Y are counted, Y twice for MltAdd (\a add true).
+  */
+  template <class T1, class Prop1, class Tvalue1,
+	    class T2, class Storage2, class Allocator2,
+	    class T4, class Storage4, class Allocator4>
+  double GetSparseProductBytes(const ReducedPrecisionMatrix<T1, Prop1,
+			       Tvalue1>& M,
+			       const Vector<T2, Storage2, Allocator2>& X,
+			       const Vector<T4, Storage4, Allocator4>& Y,
+			       bool add)
+  {
+    double nb_bytes = double(M.GetDataSize())
+      * (sizeof(Tvalue1) + sizeof(uint32_t))
+      + double(M.GetM() + 1) * sizeof(size_t)
+      + double(X.GetM()) * sizeof(T2) + double(Y.GetM()) * sizeof(T4);
+
+    if (add)
+      nb_bytes += double(Y.GetM()) * sizeof(T4);
+
+    return nb_bytes;
+  }
+
+
+  //! Y = M X for a matrix stored in reduced precision.
+  template <class T1, class Tvalue1,
+	    class T2, class Storage2, class Allocator2,
+	    class T4, class Storage4, class Allocator4>
+  void MltVector(const ReducedPrecisionMatrix<T1, General, Tvalue1>& M,
+		 const Vector<T2, Storage2, Allocator2>& X,
+		 Vector<T4, Storage4, Allocator4>& Y)
+  {
+#ifdef SELDON_CHECK_DIMENSIONS
+    if ((size_t(X.GetM()) != M.GetN()) || (size_t(Y.GetM()) != M.GetM()))
+      throw WrongDim("Mlt(M, X, Y)", "The matrix is of size "
+		     + to_str(M.GetM()) + " x " + to_str(M.GetN())
+		     + " while X and Y are of size " + to_str(X.GetM())
+		     + " and " + to_str(Y.GetM()) + ".");
+#endif
+
+    SELDON_PROFILE("MltVector(ReducedPrecision)");
+    SELDON_PROFILE_COUNT(2. * M.GetDataSize(),
+			 GetSparseProductBytes(M, X, Y, false));
+
+    // rows are shared between the threads
+    ParallelFor(0, M.GetM(),
+		ReducedPrecisionProduct<T4, T1, Tvalue1,
+		Vector<T2, Storage2, Allocator2>,
+		Vector<T4, Storage4, Allocator4> >
+		(NULL, M.GetPtr(), M.GetInd(), M.GetData(), X, Y));
+  }
+
+
+  //! Y = beta Y + alpha M X for a matrix stored in reduced precision.
+  template <class T0, class T1, class Tvalue1,
+	    class T2, class Storage2, class Allocator2,
+	    class T3, class T4, class Storage4, class Allocator4>
+  void MltAddVector(const T0& alpha,
+		    const ReducedPrecisionMatrix<T1, General, Tvalue1>& M,
+		    const Vector<T2, Storage2, Allocator2>& X,
+		    const T3& beta, Vector<T4, Storage4, Allocator4>& Y)
+  {
+#ifdef SELDON_CHECK_DIMENSIONS
+    if ((size_t(X.GetM()) != M.GetN()) || (size_t(Y.GetM()) != M.GetM()))
+      throw WrongDim("MltAdd(alpha, M, X, beta, Y)", "The matrix is of size "
+		     + to_str(M.GetM()) + " x " + to_str(M.GetN())
+		     + " while X and Y are of size " + to_str(X.GetM())
+		     + " and " + to_str(Y.GetM()) + ".");
+#endif
+
+    SELDON_PROFILE("MltAddVector(ReducedPrecision)");
+    SELDON_PROFILE_COUNT(2. * M.GetDataSize(),
+			 GetSparseProductBytes(M, X, Y, true));
+
+    Mlt(beta, Y);
+
+    // rows are shared between the threads
+    ParallelFor(0, M.GetM(),
+		ReducedPrecisionProduct<T0, T1, Tvalue1,
+		Vector<T2, Storage2, Allocator2>,
+		Vector<T4, Storage4, Allocator4> >
+		(&alpha, M.GetPtr(), M.GetInd(), M.GetData(), X, Y));
+  }
+
+
+  /////////
+  // SOR //
+  /////////
+
+
+  //! Successive overrelaxation.
+  /*!
+    Solving A X = B by using S.O.R algorithm, the values of A being
+    converted to T0. omega is the relaxation parameter, iter the number of
+    iterations.
+    type_ssor = 2 forward sweep
+    type_ssor = 3 backward sweep
+    type_ssor = 0 forward and backward sweep
+  */
+  template <class T0, class Tvalue0,
+	    class T1, class Storage1, class Allocator1,
+	    class T2, class Storage2, class Allocator2, class T3>
+  void SorVector(const ReducedPrecisionMatrix<T0, General, Tvalue0>& A,
+		 Vector<T2, Storage2, Allocator2>& X,
+		 const Vector<T1, Storage1, Allocator1>& B,
+		 const T3& omega, int iter, int type_ssor)
+  {
+    T1 temp, zero; T3 one;
+    T0 ajj, zero_a;
+    SetComplexZero(zero);
+    SetComplexZero(zero_a);
+    SetComplexOne(one);
+
+    long ma = A.GetM();
+
+#ifdef SELDON_CHECK_BOUNDS
+    if (A.GetN() != A.GetM())
+      throw WrongDim("SOR", "Matrix must be squared.");
+
+    if (ma != long(X.GetLength()) || ma != long(B.GetLength()))
+      throw WrongDim("SOR", "Matrix and vector dimensions are incompatible.");
+#endif
+
+    const size_t* ptr = A.GetPtr();
+    const uint32_t* ind = A.GetInd();
+    const Tvalue0* data = A.GetData();
+
+    // iter forward sweeps, then iter backward sweeps
+    for (int sweep = 0; sweep < 2; sweep++)
+      {
+	if (((sweep == 0) && (type_ssor % 2 != 0))
+	    || ((sweep == 1) && (type_ssor % 3 != 0)))
+	  continue;
+
+	for (int i = 0; i < iter; i++)
+	  for (long p = 0; p < ma; p++)
+	    {
+	      long j = (sweep == 0) ? p : ma - 1 - p;
+	      temp = zero;
+	      ajj = zero_a;
+	      for (size_t k = ptr[j]; k < ptr[j+1]; k++)
+		if (long(ind[k]) == j)
+		  ajj = T0(data[k]);
+		else
+		  temp += T0(data[k]) * X(ind[k]);
+
+#ifdef SELDON_CHECK_BOUNDS
+	      if (ajj == zero_a)
+		throw WrongArgument("SOR", "Matrix must contain"
+				    " a non-null diagonal");
+#endif
+
+	      X(j) = (one-omega) * X(j) + omega * (B(j) - temp) / ajj;
+	    }
+      }
+  }
+
+} // namespace Seldon.
+
+
+#define SELDON_FILE_MATRIX_REDUCED_PRECISION_CXX
+#endif
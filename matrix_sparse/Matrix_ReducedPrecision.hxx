@@ -0,0 +1,190 @@
+// Copyright (C) 2016 INRIA
+//
+// This file is part of the linear-algebra library Seldon,
+// http://seldon.sourceforge.net/.
+//
+// Seldon is free software; you can redistribute it and/or modify it under the
+// terms of the GNU Lesser General Public License as published by the Free
+// Software Foundation; either version 2.1 of the License, or (at your option)
+// any later version.
+//
+// Seldon is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for
+// more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with Seldon. If not, see http://www.gnu.org/licenses/.
+
+
+#ifndef SELDON_FILE_MATRIX_REDUCED_PRECISION_HXX
+
+namespace Seldon
+{
+
+
+  //! Single precision type associated with a scalar type.
+  template<class T>
+  class ClassSinglePrecision
+  {
+  public :
+    typedef float Tsingle;
+  };
+
+
+  //! Single precision type associated with a complex type.
+  template<class T>
+  class ClassSinglePrecision<complex<T> >
+  {
+  public :
+    typedef complex<float> Tsingle;
+  };
+
+
+  //! Row-oriented sparse matrix whose values are stored in reduced precision.
+  /*!
+    The matrix is stored as a RowSparse matrix (or as the upper part of a
+    ArrayRowSymSparse matrix if Prop is Symmetric), but the values are
+    stored with the type Tvalue (float, BFloat16 or complex<float>) and the
+    column numbers on 32 bits. A non-zero entry then takes 8 bytes (float)
+    or 6 bytes (BFloat16) instead of 16 bytes for a RowSparse matrix of
+    doubles. The values are converted to T when they are read, so that the
+    products are accumulated in the precision of T (or of the vectors).
+
+    Such a matrix is obtained by conversion (Copy) of a sparse matrix, and
+    is meant for memory-bound operations whose accuracy is not critical:
+    matrix-vector products in a preconditioner or a smoother (SorVector),
+    application of incomplete factors (see TriangularLevelSet). The
+    relative error on each value is 2^-24 for float and 2^-9 for BFloat16.
+  */
+  template<class T, class Prop, class Tvalue>
+  class ReducedPrecisionMatrix
+  {
+  public :
+    //! type of the computations
+    typedef T value_type;
+    //! type of the stored values
+    typedef Tvalue storage_type;
+
+  protected :
+    //! number of rows and columns
+    size_t m_, n_;
+    //! first entry of each row
+    Vector<size_t> ptr_;
+    //! column numbers
+    Vector<uint32_t> ind_;
+    //! values
+    Vector<Tvalue> data_;
+
+  public :
+    ReducedPrecisionMatrix();
+
+    void Clear();
+    void Reallocate(size_t m, size_t n, size_t nnz);
+
+    size_t GetM() const;
+    size_t GetN() const;
+    size_t GetDataSize() const;
+    size_t GetRowSize(size_t i) const;
+    int64_t GetMemorySize() const;
+
+    size_t* GetPtr() const;
+    uint32_t* GetInd() const;
+    Tvalue* GetData() const;
+
+    size_t Index(size_t i, size_t k) const;
+    T Value(size_t i, size_t k) const;
+
+  };
+
+
+  //! Rows of the product of a ReducedPrecisionMatrix by a vector.
+  /*!
+    Function object given to ParallelFor, as RowSparseProduct: the values
+    are converted to T1 before the multiplication, the sum of a row being
+    computed with the type of the elements of Y.
+  */
+  template<class T0, class T1, class Tvalue, class Vector2, class Vector4>
+  class ReducedPrecisionProduct
+  {
+  protected:
+    const T0* alpha_;
+    const size_t* ptr_;
+    const uint32_t* ind_;
+    const Tvalue* data_;
+    const Vector2& X_;
+    Vector4& Y_;
+
+  public:
+    ReducedPrecisionProduct(const T0* alpha, const size_t* ptr,
+			    const uint32_t* ind, const Tvalue* data,
+			    const Vector2& X, Vector4& Y);
+
+    void operator()(size_t i0, size_t i1) const;
+  };
+
+
+  template<class T0, class Allocator0, class T, class Tvalue>
+  void Copy(const Matrix<T0, General, RowSparse, Allocator0>& A,
+	    ReducedPrecisionMatrix<T, General, Tvalue>& B);
+
+  template<class T0, class Allocator0, class T, class Tvalue>
+  void Copy(const Matrix<T0, General, ArrayRowSparse, Allocator0>& A,
+	    ReducedPrecisionMatrix<T, General, Tvalue>& B);
+
+  template<class T0, class Allocator0, class T, class Tvalue>
+  void Copy(const Matrix<T0, Symmetric, ArrayRowSymSparse, Allocator0>& A,
+	    ReducedPrecisionMatrix<T, Symmetric, Tvalue>& B);
+
+  template <class T1, class Prop1, class Tvalue1,
+	    class T2, class Storage2, class Allocator2,
+	    class T4, class Storage4, class Allocator4>
+  double GetSparseProductBytes(const ReducedPrecisionMatrix<T1, Prop1,
+			       Tvalue1>& M,
+			       const Vector<T2, Storage2, Allocator2>& X,
+			       const Vector<T4, Storage4, Allocator4>& Y,
+			       bool add);
+
+  template <class T1, class Tvalue1,
+	    class T2, class Storage2, class Allocator2,
+	    class T4, class Storage4, class Allocator4>
+  void MltVector(const ReducedPrecisionMatrix<T1, General, Tvalue1>& M,
+		 const Vector<T2, Storage2, Allocator2>& X,
+		 Vector<T4, Storage4, Allocator4>& Y);
+
+  template <class T0, class T1, class Tvalue1,
+	    class T2, class Storage2, class Allocator2,
+	    class T3, class T4, class Storage4, class Allocator4>
+  void MltAddVector(const T0& alpha,
+		    const ReducedPrecisionMatrix<T1, General, Tvalue1>& M,
+		    const Vector<T2, Storage2, Allocator2>& X,
+		    const T3& beta, Vector<T4, Storage4, Allocator4>& Y);
+
+  template <class T1, class Tvalue1,
+	    class T2, class Storage2, class Allocator2,
+	    class T4, class Storage4, class Allocator4>
+  void Mlt(const ReducedPrecisionMatrix<T1, General, Tvalue1>& M,
+	   const Vector<T2, Storage2, Allocator2>& X,
+	   Vector<T4, Storage4, Allocator4>& Y);
+
+  template <class T0, class T1, class Tvalue1,
+	    class T2, class Storage2, class Allocator2,
+	    class T3, class T4, class Storage4, class Allocator4>
+  void MltAdd(const T0& alpha,
+	      const ReducedPrecisionMatrix<T1, General, Tvalue1>& M,
+	      const Vector<T2, Storage2, Allocator2>& X,
+	      const T3& beta, Vector<T4, Storage4, Allocator4>& Y);
+
+  template <class T0, class Tvalue0,
+	    class T1, class Storage1, class Allocator1,
+	    class T2, class Storage2, class Allocator2, class T3>
+  void SorVector(const ReducedPrecisionMatrix<T0, General, Tvalue0>& A,
+		 Vector<T2, Storage2, Allocator2>& X,
+		 const Vector<T1, Storage1, Allocator1>& B,
+		 const T3& omega, int iter, int type_ssor = 2);
+
+} // namespace Seldon.
+
+
+#define SELDON_FILE_MATRIX_REDUCED_PRECISION_HXX
+#endif
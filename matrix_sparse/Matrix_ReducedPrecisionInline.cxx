@@ -0,0 +1,173 @@
+// Copyright (C) 2016 INRIA
+//
+// This file is part of the linear-algebra library Seldon,
+// http://seldon.sourceforge.net/.
+//
+// Seldon is free software; you can redistribute it and/or modify it under the
+// terms of the GNU Lesser General Public License as published by the Free
+// Software Foundation; either version 2.1 of the License, or (at your option)
+// any later version.
+//
+// Seldon is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for
+// more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with Seldon. If not, see http://www.gnu.org/licenses/.
+
+
+
+#ifndef SELDON_FILE_MATRIX_REDUCED_PRECISION_INLINE_CXX
+
+#include "Matrix_ReducedPrecision.hxx"
+
+namespace Seldon
+{
+
+
+  ////////////////////////////
+  // REDUCEDPRECISIONMATRIX //
+  ////////////////////////////
+
+
+  //! Default constructor (empty matrix).
+  template<class T, class Prop, class Tvalue>
+  inline ReducedPrecisionMatrix<T, Prop, Tvalue>::ReducedPrecisionMatrix()
+  {
+    m_ = 0;
+    n_ = 0;
+  }
+
+
+  //! Clears the matrix.
+  template<class T, class Prop, class Tvalue>
+  inline void ReducedPrecisionMatrix<T, Prop, Tvalue>::Clear()
+  {
+    m_ = 0;
+    n_ = 0;
+    ptr_.Clear();
+    ind_.Clear();
+    data_.Clear();
+  }
+
+
+  //! Returns the number of rows.
+  template<class T, class Prop, class Tvalue>
+  inline size_t ReducedPrecisionMatrix<T, Prop, Tvalue>::GetM() const
+  {
+    return m_;
+  }
+
+
+  //! Returns the number of columns.
+  template<class T, class Prop, class Tvalue>
+  inline size_t ReducedPrecisionMatrix<T, Prop, Tvalue>::GetN() const
+  {
+    return n_;
+  }
+
+
+  //! Returns the number of stored values.
+  template<class T, class Prop, class Tvalue>
+  inline size_t ReducedPrecisionMatrix<T, Prop, Tvalue>::GetDataSize() const
+  {
+    return data_.GetM();
+  }
+
+
+  //! Returns the number of stored values in row i.
+  template<class T, class Prop, class Tvalue>
+  inline size_t ReducedPrecisionMatrix<T, Prop, Tvalue>
+  ::GetRowSize(size_t i) const
+  {
+    return ptr_(i+1) - ptr_(i);
+  }
+
+
+  //! Returns the memory used by the matrix in bytes.
+  template<class T, class Prop, class Tvalue>
+  inline int64_t ReducedPrecisionMatrix<T, Prop, Tvalue>
+  ::GetMemorySize() const
+  {
+    return sizeof(*this) + int64_t(ptr_.GetM()) * sizeof(size_t)
+      + int64_t(ind_.GetM()) * sizeof(uint32_t)
+      + int64_t(data_.GetM()) * sizeof(Tvalue);
+  }
+
+
+  //! Returns a pointer to the first entry of each row (m+1 values).
+  template<class T, class Prop, class Tvalue>
+  inline size_t* ReducedPrecisionMatrix<T, Prop, Tvalue>::GetPtr() const
+  {
+    return ptr_.GetData();
+  }
+
+
+  //! Returns a pointer to the column numbers.
+  template<class T, class Prop, class Tvalue>
+  inline uint32_t* ReducedPrecisionMatrix<T, Prop, Tvalue>::GetInd() const
+  {
+    return ind_.GetData();
+  }
+
+
+  //! Returns a pointer to the stored values.
+  template<class T, class Prop, class Tvalue>
+  inline Tvalue* ReducedPrecisionMatrix<T, Prop, Tvalue>::GetData() const
+  {
+    return data_.GetData();
+  }
+
+
+  //! Returns the column number of the k-th entry of row i.
+  template<class T, class Prop, class Tvalue>
+  inline size_t ReducedPrecisionMatrix<T, Prop, Tvalue>
+  ::Index(size_t i, size_t k) const
+  {
+    return ind_(ptr_(i) + k);
+  }
+
+
+  //! Returns the k-th value of row i, converted to T.
+  template<class T, class Prop, class Tvalue>
+  inline T ReducedPrecisionMatrix<T, Prop, Tvalue>
+  ::Value(size_t i, size_t k) const
+  {
+    return T(data_(ptr_(i) + k));
+  }
+
+
+  /////////////////////////
+  // MATRIX-VECTOR PRODUCTS
+
+
+  //! Y = M X, the values of M being converted to T1.
+  template <class T1, class Tvalue1,
+	    class T2, class Storage2, class Allocator2,
+	    class T4, class Storage4, class Allocator4>
+  inline void Mlt(const ReducedPrecisionMatrix<T1, General, Tvalue1>& M,
+		  const Vector<T2, Storage2, Allocator2>& X,
+		  Vector<T4, Storage4, Allocator4>& Y)
+  {
+    MltVector(M, X, Y);
+  }
+
+
+  //! Y = beta Y + alpha M X, the values of M being converted to T1.
+  template <class T0, class T1, class Tvalue1,
+	    class T2, class Storage2, class Allocator2,
+	    class T3, class T4, class Storage4, class Allocator4>
+  inline void MltAdd(const T0& alpha,
+		     const ReducedPrecisionMatrix<T1, General, Tvalue1>& M,
+		     const Vector<T2, Storage2, Allocator2>& X,
+		     const T3& beta, Vector<T4, Storage4, Allocator4>& Y)
+  {
+    MltAddVector(alpha, M, X, beta, Y);
+  }
+
+} // namespace Seldon.
+
+
+#define SELDON_FILE_MATRIX_REDUCED_PRECISION_INLINE_CXX
+#endif
@@ -78,6 +78,9 @@ namespace Seldon
 		  Vector<size_t, Storage1, Allocator1>& ptr,
 		  Vector<size_t, Storage2, Allocator2>& ind);
     Matrix_Sparse(const Matrix_Sparse<T, Prop, Storage, Allocator>& A);
+#ifdef SELDON_WITH_CPP11
+    Matrix_Sparse(Matrix_Sparse<T, Prop, Storage, Allocator>&& A) noexcept;
+#endif
 
     // Destructor.
     ~Matrix_Sparse();
@@ -125,6 +128,10 @@ namespace Seldon
 #ifndef SWIG
     Matrix_Sparse<T, Prop, Storage, Allocator>&
     operator= (const Matrix_Sparse<T, Prop, Storage, Allocator>& A);
+#ifdef SELDON_WITH_CPP11
+    Matrix_Sparse<T, Prop, Storage, Allocator>&
+    operator= (Matrix_Sparse<T, Prop, Storage, Allocator>&& A) noexcept;
+#endif
 #endif
 
     // Convenient functions.
@@ -79,6 +79,9 @@ namespace Seldon
 		     Vector<size_t, Storage1, Allocator1>& ptr,
 		     Vector<size_t, Storage2, Allocator2>& ind);
     Matrix_SymSparse(const Matrix_SymSparse<T, Prop, Storage, Allocator>& A);
+#ifdef SELDON_WITH_CPP11
+    Matrix_SymSparse(Matrix_SymSparse<T, Prop, Storage, Allocator>&& A) noexcept;
+#endif
 
     // Destructor.
     ~Matrix_SymSparse();
@@ -123,6 +126,10 @@ namespace Seldon
 
     Matrix_SymSparse<T, Prop, Storage, Allocator>&
     operator= (const Matrix_SymSparse<T, Prop, Storage, Allocator>& A);
+#ifdef SELDON_WITH_CPP11
+    Matrix_SymSparse<T, Prop, Storage, Allocator>&
+    operator= (Matrix_SymSparse<T, Prop, Storage, Allocator>&& A) noexcept;
+#endif
 
     // Convenient functions.
     void Zero();
@@ -261,6 +261,63 @@ namespace Seldon
   }
 
 
+#ifdef SELDON_WITH_CPP11
+  //! Move constructor.
+  /*! The arrays of \a A are taken over, no memory is allocated.
+    \param A matrix to be moved. On exit, \a A is an empty 0x0 matrix.
+  */
+  template <class T, class Prop, class Storage, class Allocator>
+  inline Matrix_SymSparse<T, Prop, Storage, Allocator>
+  ::Matrix_SymSparse(Matrix_SymSparse<T, Prop, Storage, Allocator>&& A) noexcept:
+    Matrix_Base<T, Allocator>()
+  {
+    this->m_ = A.m_;
+    this->n_ = A.n_;
+    this->nz_ = A.nz_;
+    this->data_ = A.data_;
+    ptr_ = A.ptr_;
+    ind_ = A.ind_;
+    A.m_ = 0;
+    A.n_ = 0;
+    A.nz_ = 0;
+    A.data_ = NULL;
+    A.ptr_ = NULL;
+    A.ind_ = NULL;
+  }
+
+
+  //! Move assignment.
+  /*!
+    The current matrix is released and the arrays of \a A are taken over.
+    \param A matrix to be moved. On exit, \a A is an empty 0x0 matrix.
+  */
+  template <class T, class Prop, class Storage, class Allocator>
+  inline Matrix_SymSparse<T, Prop, Storage, Allocator>&
+  Matrix_SymSparse<T, Prop, Storage, Allocator>
+  ::operator= (Matrix_SymSparse<T, Prop, Storage, Allocator>&& A) noexcept
+  {
+    if (this != &A)
+      {
+	this->Clear();
+	this->m_ = A.m_;
+	this->n_ = A.n_;
+	this->nz_ = A.nz_;
+	this->data_ = A.data_;
+	ptr_ = A.ptr_;
+	ind_ = A.ind_;
+	A.m_ = 0;
+	A.n_ = 0;
+	A.nz_ = 0;
+	A.data_ = NULL;
+	A.ptr_ = NULL;
+	A.ind_ = NULL;
+      }
+
+    return *this;
+  }
+#endif
+
+
 #ifdef SELDON_WITH_VIRTUAL
   template <class T, class Prop, class Storage, class Allocator>
   inline void Matrix_SymSparse<T, Prop, Storage, Allocator>
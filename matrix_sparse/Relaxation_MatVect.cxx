@@ -51,37 +51,37 @@ namespace Seldon
     SetComplexZero(zero);
     SetComplexOne(one);
 
-    int ma = A.GetM();
+    long ma = A.GetM();
 
 #ifdef SELDON_CHECK_BOUNDS
     int na = A.GetN();
     if (na != ma)
       throw WrongDim("SOR", "Matrix must be squared.");
 
-    if (ma != X.GetLength() || ma != B.GetLength())
+    if (ma != long(X.GetLength()) || ma != long(B.GetLength()))
       throw WrongDim("SOR", "Matrix and vector dimensions are incompatible.");
 #endif
 
-    int* ptr = A.GetPtr();
-    int* ind = A.GetInd();
+    size_t* ptr = A.GetPtr();
+    size_t* ind = A.GetInd();
     typename Matrix<T0, Prop0, RowSparse, Allocator0>::pointer data
       = A.GetData();
     
     // Forward sweep.
     if (type_ssor % 2 == 0)
       for (int i = 0; i < iter; i++)
-	for (int j = 0; j < ma; j++)
+	for (long j = 0; j < ma; j++)
 	  {
 	    temp = zero;
-            int k = ptr[j];
-            while (ind[k] < j)
+            size_t k = ptr[j];
+            while (long(ind[k]) < j)
               {
                 temp += data[k] * X(ind[k]);
                 k++;
               }
             
 #ifdef SELDON_CHECK_BOUNDS
-            if ( (k >= ptr[j+1]) || (ind[k] != j) || (data[k] == zero))
+            if ( (k >= ptr[j+1]) || (long(ind[k]) != j) || (data[k] == zero))
               throw WrongArgument("SOR", "Matrix must contain"
                                   " a non-null diagonal");
 #endif
@@ -100,11 +100,11 @@ namespace Seldon
     // Backward sweep.
     if (type_ssor % 3 == 0)
       for (int i = 0; i < iter; i++)
-	for (int j = ma-1 ; j >= 0; j--)
+	for (long j = ma-1 ; j >= 0; j--)
 	  {
 	    temp = zero;
-            int k = ptr[j];
-            while (ind[k] < j)
+            size_t k = ptr[j];
+            while (long(ind[k]) < j)
               {
                 temp += data[k] * X(ind[k]);
                 k++;
@@ -326,7 +326,7 @@ namespace Seldon
   //! Adds values to several non-zero entries on a given row
   template <class T, class Prop, class Storage, class Allocator>
   inline void Matrix_SymComplexSparse<T, Prop, Storage, Allocator>
-  ::AddInteractionRow(int i, int nb, const Vector<int>& col,
+  ::AddInteractionRow(int i, int nb, const IVect& col,
 		      const Vector<entry_type>& val)
   {
     throw Undefined("AddInteractionRow", "Not implemented");
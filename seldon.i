@@ -20,10 +20,191 @@
 %module seldon
 %{
 #include "SeldonHeader.hxx"
+#include "SeldonSolverHeader.hxx"
+#include <map>
 namespace Seldon
 {
   void skip_vector_double(istream& input_stream);
   void skip_matrix_double(istream& input_stream);
+
+
+  //! Python buffers on which Seldon objects are built.
+  /*! The key is the address of the Seldon object. The buffers are released
+    (and the object is nullified) when the object is destroyed.
+  */
+  static std::multimap<const void*, Py_buffer*> python_buffer;
+
+
+  // Characters of the NumPy type strings. Indices are exposed as signed
+  // integers, which SciPy expects.
+  inline char GetNumpyKind(const int&) { return 'i'; }
+  inline char GetNumpyKind(const float&) { return 'f'; }
+  inline char GetNumpyKind(const double&) { return 'f'; }
+  inline char GetNumpyKind(const size_t&) { return 'i'; }
+
+
+  // Checks whether a buffer format (struct module syntax) matches T.
+  inline bool CheckBufferFormat(char c, const int&)
+  {
+    return c == 'i' || (c == 'l' && sizeof(long) == sizeof(int));
+  }
+  inline bool CheckBufferFormat(char c, const float&)
+  {
+    return c == 'f';
+  }
+  inline bool CheckBufferFormat(char c, const double&)
+  {
+    return c == 'd';
+  }
+  inline bool CheckBufferFormat(char c, const size_t&)
+  {
+    return c == 'l' || c == 'q' || c == 'n'
+      || c == 'L' || c == 'Q' || c == 'N';
+  }
+
+
+  //! Returns the NumPy array interface of a C-contiguous array.
+  /*!
+    \param[in] data first element of the array.
+    \param[in] ndim number of dimensions.
+    \param[in] shape lengths of the array along each dimension.
+    \return A dictionary describing the array (version 3 of the interface),
+    so that numpy.asarray shares the memory of the array.
+  */
+  template<class T>
+  PyObject* GetArrayInterface(const T* data, int ndim, const size_t* shape)
+  {
+    int one = 1;
+    string type_string = *reinterpret_cast<char*>(&one) == 1 ? "<" : ">";
+    type_string += GetNumpyKind(T()) + to_str(sizeof(T));
+
+    // NumPy may reject a null address, even for an empty array.
+    static T empty_data;
+    if (data == NULL)
+      data = &empty_data;
+
+    PyObject* shape_tuple = PyTuple_New(ndim);
+    for (int k = 0; k < ndim; k++)
+      PyTuple_SET_ITEM(shape_tuple, k, PyLong_FromSize_t(shape[k]));
+
+    return Py_BuildValue("{s:N,s:s,s:(N,O),s:i}", "shape", shape_tuple,
+                         "typestr", type_string.c_str(), "data",
+                         PyLong_FromVoidPtr(const_cast<T*>(data)), Py_False,
+                         "version", 3);
+  }
+
+
+  //! Gets the C-contiguous and writable buffer of a Python object.
+  /*!
+    \param[in] array Python object providing the buffer protocol (a NumPy
+    array for instance).
+    \param[in] ndim expected number of dimensions.
+    \param[out] shape lengths of the buffer along each dimension.
+    \return The buffer, which must be attached to a Seldon object with
+    AttachPythonBuffer.
+  */
+  template<class T>
+  Py_buffer* GetPythonBuffer(PyObject* array, int ndim, size_t* shape,
+                             const T& x)
+  {
+    Py_buffer* view = new Py_buffer;
+    if (PyObject_GetBuffer(array, view, PyBUF_C_CONTIGUOUS | PyBUF_FORMAT
+                           | PyBUF_WRITABLE) != 0)
+      {
+        delete view;
+        PyErr_Clear();
+        throw WrongArgument("GetPythonBuffer",
+                            "The object does not provide a writable and "
+                            "C-contiguous buffer.");
+      }
+
+    string format = view->format;
+    string error;
+    if (view->ndim != ndim)
+      error = "The buffer has " + to_str(view->ndim) + " dimensions, but "
+        + to_str(ndim) + " dimensions were expected.";
+    else if (view->itemsize != Py_ssize_t(sizeof(T))
+             || !CheckBufferFormat(format[format.size()-1], x))
+      error = "The type of the elements (format \"" + format
+        + "\") is not compatible with the Seldon object.";
+
+    if (!error.empty())
+      {
+        PyBuffer_Release(view);
+        delete view;
+        throw WrongArgument("GetPythonBuffer", error);
+      }
+
+    for (int k = 0; k < ndim; k++)
+      shape[k] = view->shape[k];
+
+    return view;
+  }
+
+
+  //! Keeps a Python buffer alive as long as a Seldon object uses it.
+  inline void AttachPythonBuffer(const void* obj, Py_buffer* view)
+  {
+    python_buffer.insert(std::make_pair(obj, view));
+  }
+
+
+  //! Throws an exception if a Seldon object is built on Python buffers.
+  /*!
+    The memory of a Python buffer cannot be freed or reallocated by Seldon,
+    so that the methods which may reallocate an object are forbidden.
+  */
+  inline void CheckPythonBuffer(const void* obj, string function)
+  {
+    if (python_buffer.count(obj) != 0)
+      throw Error(function, "The object shares the memory of a Python "
+                  "array, it cannot be reallocated. Copy the array (or call "
+                  "Clear) first.");
+  }
+
+
+  //! Nullifies a Seldon object built on Python buffers, and releases them.
+  /*!
+    Nothing is done if the object owns its memory.
+  */
+  template<class T>
+  void ReleasePythonBuffer(T* obj)
+  {
+    typedef std::multimap<const void*, Py_buffer*>::iterator iterator;
+    std::pair<iterator, iterator> range = python_buffer.equal_range(obj);
+    if (range.first == range.second)
+      return;
+
+    obj->Nullify();
+    for (iterator it = range.first; it != range.second; ++it)
+      {
+        PyBuffer_Release(it->second);
+        delete it->second;
+      }
+    python_buffer.erase(range.first, range.second);
+  }
+
+
+  //! Releases the global interpreter lock of Python during its lifetime.
+  /*! Seldon objects and Python objects must not be modified by Python
+    threads while the lock is released.
+   */
+  class PythonThreadRelease
+  {
+  protected:
+    PyThreadState* state_;
+
+  public:
+    PythonThreadRelease()
+    {
+      state_ = PyEval_SaveThread();
+    }
+
+    ~PythonThreadRelease()
+    {
+      PyEval_RestoreThread(state_);
+    }
+  };
 }
   %}
 
@@ -108,6 +289,75 @@ namespace std
     }
 }
 
+// Methods which may reallocate a Seldon object are forbidden on objects
+// built on Python buffers (see SetDataFromBuffer), since they would free or
+// reallocate memory owned by Python. Clear releases the buffers instead.
+%define SELDON_BUFFER_EXCEPTION(method, check)
+%exception method
+{
+  try
+    {
+      check;
+      $action
+	}
+  catch(Seldon::Error& e)
+    {
+      PyErr_SetString(PyExc_Exception, e.What().c_str());
+      return NULL;
+    }
+  catch(std::exception& e)
+    {
+      PyErr_SetString(PyExc_Exception, e.what());
+      return NULL;
+    }
+  catch(...)
+    {
+      PyErr_SetString(PyExc_Exception, "Unknown exception...");
+      return NULL;
+    }
+}
+%enddef
+
+%define SELDON_BUFFER_GROWTH(method)
+SELDON_BUFFER_EXCEPTION(method, Seldon::CheckPythonBuffer(arg1, "$name"))
+%enddef
+
+%define SELDON_BUFFER_CLEAR(method)
+SELDON_BUFFER_EXCEPTION(method, Seldon::ReleasePythonBuffer(arg1))
+%enddef
+
+SELDON_BUFFER_GROWTH(Seldon::Vector::Reallocate)
+SELDON_BUFFER_GROWTH(Seldon::Vector::ReallocateVector)
+SELDON_BUFFER_GROWTH(Seldon::Vector::Resize)
+SELDON_BUFFER_GROWTH(Seldon::Vector::ResizeVector)
+SELDON_BUFFER_GROWTH(Seldon::Vector::Reserve)
+SELDON_BUFFER_GROWTH(Seldon::Vector::Append)
+SELDON_BUFFER_GROWTH(Seldon::Vector::PushBack)
+SELDON_BUFFER_GROWTH(Seldon::Vector::Copy)
+SELDON_BUFFER_GROWTH(Seldon::Vector::Read)
+SELDON_BUFFER_GROWTH(Seldon::Vector::ReadText)
+SELDON_BUFFER_CLEAR(Seldon::Vector::Clear)
+SELDON_BUFFER_GROWTH(Seldon::Matrix_Pointers::Reallocate)
+SELDON_BUFFER_GROWTH(Seldon::Matrix_Pointers::Resize)
+SELDON_BUFFER_GROWTH(Seldon::Matrix_Pointers::Copy)
+SELDON_BUFFER_GROWTH(Seldon::Matrix_Pointers::Read)
+SELDON_BUFFER_GROWTH(Seldon::Matrix_Pointers::ReadText)
+SELDON_BUFFER_CLEAR(Seldon::Matrix_Pointers::Clear)
+SELDON_BUFFER_GROWTH(Seldon::Array3D::Reallocate)
+SELDON_BUFFER_GROWTH(Seldon::Array3D::Copy)
+SELDON_BUFFER_GROWTH(Seldon::Array3D::Read)
+SELDON_BUFFER_CLEAR(Seldon::Array3D::Clear)
+SELDON_BUFFER_GROWTH(Seldon::Matrix_Sparse::Reallocate)
+SELDON_BUFFER_GROWTH(Seldon::Matrix_Sparse::Resize)
+SELDON_BUFFER_GROWTH(Seldon::Matrix_Sparse::Copy)
+SELDON_BUFFER_GROWTH(Seldon::Matrix_Sparse::AddInteraction)
+SELDON_BUFFER_GROWTH(Seldon::Matrix_Sparse::AddInteractionRow)
+SELDON_BUFFER_GROWTH(Seldon::Matrix_Sparse::Set)
+SELDON_BUFFER_GROWTH(Seldon::Matrix_Sparse::FillRand)
+SELDON_BUFFER_GROWTH(Seldon::Matrix_Sparse::Read)
+SELDON_BUFFER_GROWTH(Seldon::Matrix_Sparse::ReadText)
+SELDON_BUFFER_CLEAR(Seldon::Matrix_Sparse::Clear)
+
 %include "SeldonHeader.hxx"
 %include "share/Common.hxx"
 %include "share/Storage.hxx"
@@ -543,6 +793,190 @@ namespace Seldon
     }
   }
 
+  // Sharing of the memory with NumPy: the attribute __array_interface__
+  // makes numpy.asarray return an array on the data of the Seldon object,
+  // and SetDataFromBuffer builds the Seldon object on the memory of a NumPy
+  // array (or of any object providing a writable and C-contiguous
+  // buffer). An object built on a buffer cannot be resized (an exception is
+  // raised), and Clear detaches it from the buffer.
+
+%define SELDON_EXTEND_VECTOR_BUFFER(T)
+  %extend Vector<T, VectFull, MallocAlloc<T> >
+  {
+    PyObject* _array_interface()
+    {
+      size_t shape[1] = {self->GetM()};
+      return Seldon::GetArrayInterface(self->GetData(), 1, shape);
+    }
+    void SetDataFromBuffer(PyObject* array)
+    {
+      size_t shape[1];
+      Py_buffer* view = Seldon::GetPythonBuffer(array, 1, shape, T());
+      Seldon::ReleasePythonBuffer(self);
+      self->SetData(shape[0], static_cast<T*>(view->buf));
+      Seldon::AttachPythonBuffer(self, view);
+    }
+    ~Vector()
+    {
+      Seldon::ReleasePythonBuffer(self);
+      delete self;
+    }
+    %pythoncode %{
+      __array_interface__ = property(lambda self: self._array_interface())
+    %}
+  }
+%enddef
+
+%define SELDON_EXTEND_MATRIX_BUFFER(T)
+  %extend Matrix<T, General, RowMajor, MallocAlloc<T> >
+  {
+    PyObject* _array_interface()
+    {
+      size_t shape[2] = {self->GetM(), self->GetN()};
+      return Seldon::GetArrayInterface(self->GetData(), 2, shape);
+    }
+    void SetDataFromBuffer(PyObject* array)
+    {
+      size_t shape[2];
+      Py_buffer* view = Seldon::GetPythonBuffer(array, 2, shape, T());
+      Seldon::ReleasePythonBuffer(self);
+      self->SetData(shape[0], shape[1], static_cast<T*>(view->buf));
+      Seldon::AttachPythonBuffer(self, view);
+    }
+    ~Matrix()
+    {
+      Seldon::ReleasePythonBuffer(self);
+      delete self;
+    }
+    %pythoncode %{
+      __array_interface__ = property(lambda self: self._array_interface())
+    %}
+  }
+%enddef
+
+%define SELDON_EXTEND_ARRAY3D_BUFFER(T)
+  %extend Array3D<T, MallocAlloc<T> >
+  {
+    PyObject* _array_interface()
+    {
+      size_t shape[3] = {size_t(self->GetLength1()),
+                         size_t(self->GetLength2()),
+                         size_t(self->GetLength3())};
+      return Seldon::GetArrayInterface(self->GetData(), 3, shape);
+    }
+    void SetDataFromBuffer(PyObject* array)
+    {
+      size_t shape[3];
+      Py_buffer* view = Seldon::GetPythonBuffer(array, 3, shape, T());
+      Seldon::ReleasePythonBuffer(self);
+      self->SetData(shape[0], shape[1], shape[2], static_cast<T*>(view->buf));
+      Seldon::AttachPythonBuffer(self, view);
+    }
+    ~Array3D()
+    {
+      Seldon::ReleasePythonBuffer(self);
+      delete self;
+    }
+    %pythoncode %{
+      __array_interface__ = property(lambda self: self._array_interface())
+    %}
+  }
+%enddef
+
+%define SELDON_EXTEND_ARRAY4D_BUFFER(T)
+  %extend Array4D<T, MallocAlloc<T> >
+  {
+    PyObject* _array_interface()
+    {
+      size_t shape[4] = {size_t(self->GetLength1()),
+                         size_t(self->GetLength2()),
+                         size_t(self->GetLength3()),
+                         size_t(self->GetLength4())};
+      return Seldon::GetArrayInterface(self->GetData(), 4, shape);
+    }
+    %pythoncode %{
+      __array_interface__ = property(lambda self: self._array_interface())
+    %}
+  }
+%enddef
+
+  SELDON_EXTEND_VECTOR_BUFFER(int)
+  SELDON_EXTEND_VECTOR_BUFFER(float)
+  SELDON_EXTEND_VECTOR_BUFFER(double)
+  SELDON_EXTEND_MATRIX_BUFFER(int)
+  SELDON_EXTEND_MATRIX_BUFFER(float)
+  SELDON_EXTEND_MATRIX_BUFFER(double)
+  SELDON_EXTEND_ARRAY3D_BUFFER(int)
+  SELDON_EXTEND_ARRAY3D_BUFFER(float)
+  SELDON_EXTEND_ARRAY3D_BUFFER(double)
+  SELDON_EXTEND_ARRAY4D_BUFFER(int)
+  SELDON_EXTEND_ARRAY4D_BUFFER(float)
+  SELDON_EXTEND_ARRAY4D_BUFFER(double)
+
+  // Compressed sparse row matrix on the arrays of a SciPy CSR matrix.
+  %extend Matrix<double, General, RowSparse, MallocAlloc<double> >
+  {
+    //! Array interface of the values (k = 0), row offsets (1) or columns (2).
+    PyObject* _array_interface(int k)
+    {
+      size_t shape[1];
+      if (k == 1)
+        {
+          shape[0] = self->GetM() + 1;
+          return Seldon::GetArrayInterface(self->GetPtr(), 1, shape);
+        }
+      shape[0] = self->GetDataSize();
+      if (k == 2)
+        return Seldon::GetArrayInterface(self->GetInd(), 1, shape);
+      return Seldon::GetArrayInterface(self->GetData(), 1, shape);
+    }
+    void SetDataFromBuffer(size_t m, size_t n, PyObject* values,
+                           PyObject* ptr, PyObject* ind)
+    {
+      size_t nz, ptr_length, ind_length;
+      Py_buffer* view_values
+        = Seldon::GetPythonBuffer(values, 1, &nz, double());
+      Py_buffer* view_ptr = NULL;
+      Py_buffer* view_ind = NULL;
+      try
+        {
+          view_ptr = Seldon::GetPythonBuffer(ptr, 1, &ptr_length, size_t());
+          view_ind = Seldon::GetPythonBuffer(ind, 1, &ind_length, size_t());
+          size_t* ptr_data = static_cast<size_t*>(view_ptr->buf);
+          if (ptr_length != m + 1 || ind_length != nz || ptr_data[m] != nz)
+            throw WrongArgument("Matrix::SetDataFromBuffer",
+                                "The row offsets should have " + to_str(m + 1)
+                                + " elements, and the last offset should be "
+                                "the number of non-zero entries ("
+                                + to_str(nz) + ").");
+        }
+      catch (...)
+        {
+          Py_buffer* view[3] = {view_values, view_ptr, view_ind};
+          for (int k = 0; k < 3; k++)
+            if (view[k] != NULL)
+              {
+                PyBuffer_Release(view[k]);
+                delete view[k];
+              }
+          throw;
+        }
+
+      Seldon::ReleasePythonBuffer(self);
+      self->SetData(m, n, nz, static_cast<double*>(view_values->buf),
+                    static_cast<size_t*>(view_ptr->buf),
+                    static_cast<size_t*>(view_ind->buf));
+      Seldon::AttachPythonBuffer(self, view_values);
+      Seldon::AttachPythonBuffer(self, view_ptr);
+      Seldon::AttachPythonBuffer(self, view_ind);
+    }
+    ~Matrix()
+    {
+      Seldon::ReleasePythonBuffer(self);
+      delete self;
+    }
+  }
+
   %template(IntMalloc) MallocAlloc<int>;
   
   %template(BaseSeldonVectorInt) Vector_Base<int, MallocAlloc<int> >;
@@ -580,6 +1014,167 @@ namespace Seldon
   void skip_matrix_double(istream& input_stream);
 }
 
+// Solvers for sparse matrices. The global interpreter lock is released
+// during the factorizations and the solutions, so that other Python threads
+// may run meanwhile.
+%inline %{
+namespace Seldon
+{
+
+  //! Direct solver for sparse matrices in double precision.
+  /*! The available solvers are SELDON_SOLVER, UMFPACK, SUPERLU, MUMPS,
+    PASTIX, ILUT, PARDISO, WSMP and SELDON_SUPERNODAL, provided that Seldon
+    was compiled with the corresponding library.
+  */
+  class SparseDirectSolverDouble
+  {
+  protected:
+    SparseDirectSolver<double> solver_;
+
+  public:
+    enum {SELDON_SOLVER = SparseDirectSolver<double>::SELDON_SOLVER,
+          UMFPACK = SparseDirectSolver<double>::UMFPACK,
+          SUPERLU = SparseDirectSolver<double>::SUPERLU,
+          MUMPS = SparseDirectSolver<double>::MUMPS,
+          PASTIX = SparseDirectSolver<double>::PASTIX,
+          ILUT = SparseDirectSolver<double>::ILUT,
+          PARDISO = SparseDirectSolver<double>::PARDISO,
+          WSMP = SparseDirectSolver<double>::WSMP,
+          SELDON_SUPERNODAL = SparseDirectSolver<double>::SELDON_SUPERNODAL};
+
+    void SelectDirectSolver(int type)
+    {
+      solver_.SelectDirectSolver(type);
+    }
+
+    void ShowMessages()
+    {
+      solver_.ShowMessages();
+    }
+
+    void HideMessages()
+    {
+      solver_.HideMessages();
+    }
+
+    //! Factorizes A.
+    /*! A is cleared after the factorization if 'keep_matrix' is false,
+      unless A shares the memory of Python arrays.
+    */
+    void Factorize(Matrix<double, General, RowSparse, MallocAlloc<double> >& A,
+                   bool keep_matrix = true)
+    {
+      keep_matrix = keep_matrix || python_buffer.count(&A) != 0;
+      PythonThreadRelease thread_release;
+      solver_.Factorize(A, keep_matrix);
+    }
+
+    //! Overwrites x with the solution of A x = b, where b is given in x.
+    void Solve(Vector<double, VectFull, MallocAlloc<double> >& x)
+    {
+      PythonThreadRelease thread_release;
+      solver_.Solve(x);
+    }
+
+    //! Overwrites x with the solution of A^T x = b, where b is given in x.
+    void TransSolve(Vector<double, VectFull, MallocAlloc<double> >& x)
+    {
+      PythonThreadRelease thread_release;
+      solver_.Solve(SeldonTrans, x);
+    }
+
+    void Clear()
+    {
+      solver_.Clear();
+    }
+  };
+
+
+  //! Iterative solver for sparse matrices in double precision.
+  /*! The available methods are "cg", "bicgstab", and "gmres" when Seldon
+    is compiled with Blas. No preconditioning is applied.
+  */
+  class IterativeSolverDouble
+  {
+  protected:
+    string method_;
+    Iteration<double> iter_;
+
+  public:
+    IterativeSolverDouble(string method = "cg"): method_(method)
+    {
+#ifdef SELDON_WITH_BLAS
+      if (method_ != "cg" && method_ != "bicgstab" && method_ != "gmres")
+#else
+      if (method_ != "cg" && method_ != "bicgstab")
+#endif
+        throw WrongArgument("IterativeSolverDouble(string)",
+                            "Unknown or unavailable method \"" + method
+                            + "\".");
+      iter_.HideMessages();
+    }
+
+    void SetTolerance(double tolerance)
+    {
+      iter_.SetTolerance(tolerance);
+    }
+
+    void SetMaxNumberIteration(int max_iter)
+    {
+      iter_.SetMaxNumberIteration(max_iter);
+    }
+
+    //! Sets the restart parameter of GMRES.
+    void SetRestart(int m)
+    {
+      iter_.SetRestart(m);
+    }
+
+    void ShowMessages()
+    {
+      iter_.ShowMessages();
+    }
+
+    void HideMessages()
+    {
+      iter_.HideMessages();
+    }
+
+    //! Sets whether x contains an initial guess when Solve is called.
+    void SetInitGuess(bool guess)
+    {
+      iter_.SetInitGuess(guess);
+    }
+
+    int GetNumberIteration() const
+    {
+      return iter_.GetNumberIteration();
+    }
+
+    //! Solves A x = b.
+    /*!
+      \return The error code of the iterative solver (0 on convergence).
+    */
+    int Solve(const Matrix<double, General, RowSparse, MallocAlloc<double> >& A,
+              Vector<double, VectFull, MallocAlloc<double> >& x,
+              const Vector<double, VectFull, MallocAlloc<double> >& b)
+    {
+      Preconditioner_Base<double> M;
+      PythonThreadRelease thread_release;
+      if (method_ == "bicgstab")
+        return BiCgStab(A, x, b, M, iter_);
+#ifdef SELDON_WITH_BLAS
+      if (method_ == "gmres")
+        return Gmres(A, x, b, M, iter_);
+#endif
+      return Cg(A, x, b, M, iter_);
+    }
+  };
+
+}
+%}
+
+
 
 // For conversions from Seldon to Numpy, and from Numpy to Seldon.
 %pythoncode %{
@@ -644,14 +1239,21 @@ def load_vector_list(filename, array = False, begin = 0, N = 0):
     return vector_list
 
 
-def to_vector(v):
+def to_vector(v, copy = True):
     """
     Converts a list or a numpy array to a Seldon vector (in double precision).
+    If 'copy' is set to False, the Seldon vector shares the memory of 'v',
+    which must then be a contiguous numpy array of float64; 'v' is kept alive
+    as long as the vector, and methods reallocating the vector (Reallocate,
+    Resize, PushBack...) raise an exception.
     """
-    import seldon
-    out = seldon.VectorDouble(len(v))
-    for i in range(len(v)):
-        out[i] = v[i]
+    import numpy, seldon
+    out = seldon.VectorDouble()
+    if copy:
+        out.Reallocate(len(v))
+        numpy.asarray(out)[:] = v
+    else:
+        out.SetDataFromBuffer(v)
     return out
 
 
@@ -716,14 +1318,72 @@ def load_matrix_list(filename, array = False, begin = 0, N = 0):
     return matrix_list
 
 
-def to_matrix(m):
+def to_matrix(m, copy = True):
     """
-    Converts a numpy array to a Seldon matrix (in double precision).
+    Converts a numpy array to a Seldon matrix (in double precision). If 'copy'
+    is set to False, the Seldon matrix shares the memory of 'm', which must
+    then be a C-contiguous numpy array of float64; 'm' is kept alive as long
+    as the matrix, and methods reallocating the matrix (Reallocate, Resize...)
+    raise an exception.
     """
-    import seldon
-    out = seldon.MatrixDouble(m.shape[0], m.shape[1])
-    for i in range(m.shape[0]):
-        for j in range(m.shape[1]):
-            out[i, j] = m[i, j]
+    import numpy, seldon
+    out = seldon.MatrixDouble()
+    if copy:
+        out.Reallocate(m.shape[0], m.shape[1])
+        numpy.asarray(out)[:] = m
+    else:
+        out.SetDataFromBuffer(m)
+    return out
+
+
+def to_sparse_matrix(m):
+    """
+    Converts a scipy sparse matrix to a Seldon sparse matrix (in double
+    precision, RowSparse storage). The Seldon matrix shares the arrays of the
+    CSR form of 'm' whenever they have the right types (float64 values and
+    int64 indices); otherwise they are converted first. These arrays are kept
+    alive as long as the Seldon matrix, which cannot be reallocated.
+
+    Seldon indices are 64-bit integers, whereas scipy stores the indices in
+    int32 as long as they fit. In this case, 'indptr' and 'indices' are
+    copied (12 bytes per non-zero entry instead of 8 for the values only),
+    and only the values are shared with 'm': a change of the sparsity
+    pattern of 'm' is not seen by the Seldon matrix. Build 'm' with int64
+    indices to share all the arrays.
+    """
+    import numpy, seldon
+    m = m.tocsr()
+    if not m.has_sorted_indices:
+        m = m.sorted_indices()
+    values = numpy.ascontiguousarray(m.data, dtype = numpy.float64)
+    ptr = numpy.ascontiguousarray(m.indptr, dtype = numpy.int64)
+    ind = numpy.ascontiguousarray(m.indices, dtype = numpy.int64)
+    out = seldon.MatrixSparseDouble()
+    out.SetDataFromBuffer(m.shape[0], m.shape[1], values, ptr, ind)
+    return out
+
+
+class _ArrayInterface:
+    """
+    Exposes an array of a Seldon object to numpy, and keeps the object alive
+    as long as the array.
+    """
+    def __init__(self, owner, interface):
+        self.owner = owner
+        self.__array_interface__ = interface
+
+
+def to_csr(m):
+    """
+    Converts a Seldon sparse matrix (in double precision, RowSparse storage)
+    to a scipy CSR matrix which shares the arrays of 'm'.
+    """
+    import numpy, scipy.sparse
+    values, ptr, ind = [numpy.asarray(_ArrayInterface(m, m._array_interface(k)))
+                        for k in range(3)]
+    # The arrays are assigned directly because the constructor of csr_matrix
+    # may convert the indices to 32-bit integers.
+    out = scipy.sparse.csr_matrix((m.GetM(), m.GetN()))
+    out.data, out.indices, out.indptr = values, ind, ptr
     return out
 %}
@@ -41,7 +41,8 @@ namespace Seldon
 
     void* memory_block = malloc(sizeof(int) + sizeof(char*) +
                                 (num + 2) * sizeof(T));
-    memcpy(memory_block, &num, sizeof(int));
+    int nb = num;
+    memcpy(memory_block, &nb, sizeof(int));
     char* data = static_cast<char*>(memory_block)
       + sizeof(int) + sizeof(char*) + sizeof(T);
 
@@ -76,7 +77,10 @@ namespace Seldon
     void * memory_block;
     memcpy(&memory_block,
            reinterpret_cast<char *>(data) - sizeof(char*), sizeof(char*));
-    size_t initial_num = *reinterpret_cast<size_t*>(memory_block);
+    // only an int is stored in front of the array
+    int nb;
+    memcpy(&nb, memory_block, sizeof(int));
+    size_t initial_num = nb;
 
     if (initial_num < num)
       {
@@ -98,7 +102,8 @@ namespace Seldon
     else
       return data;
 
-    memcpy(memory_block, &num, sizeof(int));
+    nb = num;
+    memcpy(memory_block, &nb, sizeof(int));
 
     pointer data_P =
       reinterpret_cast<pointer>(static_cast<char*>(memory_block) +
@@ -19,6 +19,16 @@
 
 #ifndef SELDON_FILE_ALLOCATOR_HXX
 
+//! alignment (in bytes) of blocks allocated by AlignedAlloc
+#ifndef SELDON_MEMORY_ALIGNMENT
+#define SELDON_MEMORY_ALIGNMENT 64
+#endif
+
+//! minimal size (in bytes) of blocks allocated with huge pages
+#ifndef SELDON_HUGE_PAGE_THRESHOLD
+#define SELDON_HUGE_PAGE_THRESHOLD 2097152
+#endif
+
 namespace Seldon
 {
 
@@ -168,6 +178,175 @@ namespace Seldon
   };
 
 
+  ///////////////////
+  // ALIGNEDMEMORY //
+  ///////////////////
+
+
+  //! Low-level management of aligned blocks of memory.
+  /*!
+    The blocks are aligned on SELDON_MEMORY_ALIGNMENT bytes. Large blocks
+    (at least SELDON_HUGE_PAGE_THRESHOLD bytes) may be mapped directly with
+    mmap in order to use huge pages and to control their placement on NUMA
+    nodes. The size of each block is stored just before the returned
+    address, so that blocks can be reallocated without losing their values.
+    This class is used by AlignedAlloc, HugePageAlloc and NumaAlloc.
+  */
+  class AlignedMemory
+  {
+  public:
+    //! placement of the pages of a block on NUMA nodes
+    enum {FIRST_TOUCH, INTERLEAVE, BIND};
+
+  protected:
+    //! information stored in front of each block
+    class BlockHeader
+    {
+    public:
+      //! address returned by malloc or mmap
+      void* base;
+      //! size of the block requested by the user (in bytes)
+      size_t size;
+      //! length of the mapping (0 if the block has been allocated by malloc)
+      size_t mapped_size;
+    };
+
+  public:
+    static void* Allocate(size_t nb_bytes, bool huge_page, bool numa);
+    static void Deallocate(void* data);
+    static void* Reallocate(void* data, size_t nb_bytes,
+                            bool huge_page, bool numa);
+
+    static size_t GetSize(const void* data);
+    static bool IsMapped(const void* data);
+
+    static void FirstTouch(void* data, size_t nb_bytes);
+    static size_t GetHugePageSize();
+
+    static void SetNumaPolicy(int policy, int node = 0);
+    static int GetNumaPolicy();
+    static int GetNumaNode();
+
+  protected:
+    static int& GetNumaPolicyRef();
+    static int& GetNumaNodeRef();
+    static size_t ReadHugePageSize();
+    static BlockHeader* GetHeader(const void* data);
+#ifdef SELDON_WITH_NUMA
+    static void ApplyNumaPolicy(void* base, size_t length);
+#endif
+
+  };
+
+
+  //////////////////
+  // ALIGNEDALLOC //
+  //////////////////
+
+
+  //! Allocator returning blocks aligned for SIMD instructions.
+  /*!
+    The elements are not constructed, this allocator should be used for
+    plain types only (as MallocAlloc).
+  */
+  template <class T>
+  class AlignedAlloc
+  {
+  public:
+    typedef T value_type;
+    typedef T* pointer;
+    typedef const T* const_pointer;
+    typedef T& reference;
+    typedef const T& const_reference;
+
+    //! true if the allocator keeps previous elements when
+    //! calling reallocate
+    static const bool KeepDataReallocate = true;
+
+  public:
+
+    static pointer allocate(size_t num, void* h = 0);
+    static void deallocate(pointer data, size_t num, void* h = 0);
+    static void* reallocate(pointer data, size_t num, void* h = 0);
+    static void memoryset(pointer data, char c, size_t num);
+    static void memorycpy(pointer datat, pointer datas, size_t num);
+  };
+
+
+  ///////////////////
+  // HUGEPAGEALLOC //
+  ///////////////////
+
+
+  //! Aligned allocator using huge pages for large blocks.
+  /*!
+    Blocks larger than SELDON_HUGE_PAGE_THRESHOLD are mapped with
+    MAP_HUGETLB if huge pages are reserved on the system, otherwise
+    transparent huge pages are requested with madvise. It reduces TLB misses
+    for large vectors and matrices. Plain types only.
+  */
+  template <class T>
+  class HugePageAlloc
+  {
+  public:
+    typedef T value_type;
+    typedef T* pointer;
+    typedef const T* const_pointer;
+    typedef T& reference;
+    typedef const T& const_reference;
+
+    //! true if the allocator keeps previous elements when
+    //! calling reallocate
+    static const bool KeepDataReallocate = true;
+
+  public:
+
+    static pointer allocate(size_t num, void* h = 0);
+    static void deallocate(pointer data, size_t num, void* h = 0);
+    static void* reallocate(pointer data, size_t num, void* h = 0);
+    static void memoryset(pointer data, char c, size_t num);
+    static void memorycpy(pointer datat, pointer datas, size_t num);
+  };
+
+
+  ///////////////
+  // NUMAALLOC //
+  ///////////////
+
+
+  //! Aligned allocator controlling the placement of pages on NUMA nodes.
+  /*!
+    Allocated blocks are set to zero by all OpenMP threads with a static
+    schedule (first-touch initialization), so that each page is placed on
+    the node of the thread that will use it in a static loop. If Seldon is
+    compiled with SELDON_WITH_NUMA, large blocks may also be interleaved
+    on all nodes or bound to a given node, see AlignedMemory::SetNumaPolicy.
+    Plain types only.
+  */
+  template <class T>
+  class NumaAlloc
+  {
+  public:
+    typedef T value_type;
+    typedef T* pointer;
+    typedef const T* const_pointer;
+    typedef T& reference;
+    typedef const T& const_reference;
+
+    //! true if the allocator keeps previous elements when
+    //! calling reallocate
+    static const bool KeepDataReallocate = true;
+
+  public:
+
+    static pointer allocate(size_t num, void* h = 0);
+    static void deallocate(pointer data, size_t num, void* h = 0);
+    static void* reallocate(pointer data, size_t num, void* h = 0);
+    static void memoryset(pointer data, char c, size_t num);
+    static void memorycpy(pointer datat, pointer datas, size_t num);
+  };
+
+
   //! Selection of default allocator depending on storage and value type
   template<class Storage, class T>
   class SeldonDefaultAllocator
@@ -22,6 +22,20 @@
 
 #include "Allocator.hxx"
 
+#include <stdint.h>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/mman.h>
+#ifndef SELDON_HAS_MMAP
+#define SELDON_HAS_MMAP
+#endif
+#endif
+
+#ifdef SELDON_WITH_NUMA
+#include <numa.h>
+#include <numaif.h>
+#endif
+
 namespace Seldon
 {
 
@@ -33,20 +47,24 @@ namespace Seldon
 
   template <class T>
   inline typename MallocAlloc<T>::pointer
-  MallocAlloc<T>::allocate(size_t num, void* h)
+  MallocAlloc<T>::allocate(size_t num, void*)
   {
+    SELDON_PROFILE("Allocate");
+    SELDON_PROFILE_COUNT(0., double(num * sizeof(T)));
     return static_cast<pointer>( malloc(num * sizeof(T)) );
   }
 
   template <class T>
-  inline void MallocAlloc<T>::deallocate(pointer data, size_t num, void* h)
+  inline void MallocAlloc<T>::deallocate(pointer data, size_t, void*)
   {
     free(data);
   }
 
   template <class T>
-  inline void* MallocAlloc<T>::reallocate(pointer data, size_t num, void* h)
+  inline void* MallocAlloc<T>::reallocate(pointer data, size_t num, void*)
   {
+    SELDON_PROFILE("Allocate");
+    SELDON_PROFILE_COUNT(0., double(num * sizeof(T)));
     return realloc(reinterpret_cast<void*>(data), num * sizeof(T));
   }
 
@@ -72,20 +90,24 @@ namespace Seldon
 
   template <class T>
   inline typename CallocAlloc<T>::pointer
-  CallocAlloc<T>::allocate(size_t num, void* h)
+  CallocAlloc<T>::allocate(size_t num, void*)
   {
+    SELDON_PROFILE("Allocate");
+    SELDON_PROFILE_COUNT(0., double(num * sizeof(T)));
     return static_cast<pointer>( calloc(num, sizeof(T)) );
   }
 
   template <class T>
-  inline void CallocAlloc<T>::deallocate(pointer data, size_t num, void* h)
+  inline void CallocAlloc<T>::deallocate(pointer data, size_t, void*)
   {
     free(data);
   }
 
   template <class T>
-  inline void* CallocAlloc<T>::reallocate(pointer data, size_t num, void* h)
+  inline void* CallocAlloc<T>::reallocate(pointer data, size_t num, void*)
   {
+    SELDON_PROFILE("Allocate");
+    SELDON_PROFILE_COUNT(0., double(num * sizeof(T)));
     return realloc(reinterpret_cast<void*>(data), num * sizeof(T));
   }
 
@@ -111,20 +133,24 @@ namespace Seldon
 
   template <class T>
   inline typename NewAlloc<T>::pointer
-  NewAlloc<T>::allocate(size_t num, void* h)
+  NewAlloc<T>::allocate(size_t num, void*)
   {
+    SELDON_PROFILE("Allocate");
+    SELDON_PROFILE_COUNT(0., double(num * sizeof(T)));
     return static_cast<pointer>(new T[num]);
   }
 
   template <class T>
-  inline void NewAlloc<T>::deallocate(pointer data, size_t num, void* h)
+  inline void NewAlloc<T>::deallocate(pointer data, size_t, void*)
   {
     delete [] data;
   }
 
   template <class T>
-  inline void* NewAlloc<T>::reallocate(pointer data, size_t num, void* h)
+  inline void* NewAlloc<T>::reallocate(pointer data, size_t num, void*)
   {
+    SELDON_PROFILE("Allocate");
+    SELDON_PROFILE_COUNT(0., double(num * sizeof(T)));
     if (data != NULL)
       delete [] data;
     return (new T[num]);
@@ -151,7 +177,7 @@ namespace Seldon
 
 
   template <class T>
-  inline void NaNAlloc<T>::deallocate(pointer data, size_t num, void* h)
+  inline void NaNAlloc<T>::deallocate(pointer data, size_t, void*)
   {
     free(data);
   }
@@ -171,6 +197,447 @@ namespace Seldon
   }
 
 
+  ///////////////////
+  // ALIGNEDMEMORY //
+  ///////////////////
+
+
+  //! Allocates a block of memory.
+  /*!
+    \param[in] nb_bytes size of the block in bytes.
+    \param[in] huge_page if true, huge pages are used for large blocks.
+    \param[in] numa if true, the NUMA policy is applied to large blocks,
+    and the block is initialized to zero by all threads (first touch).
+    \return The address of the block, aligned on SELDON_MEMORY_ALIGNMENT
+    bytes, or NULL if the allocation failed or if \a nb_bytes is 0.
+  */
+  inline void* AlignedMemory::Allocate(size_t nb_bytes,
+                                       bool huge_page, bool numa)
+  {
+    if (nb_bytes == 0)
+      return NULL;
+
+    SELDON_PROFILE("Allocate");
+    SELDON_PROFILE_COUNT(0., double(nb_bytes));
+
+    const size_t align = SELDON_MEMORY_ALIGNMENT;
+    void* base = NULL;
+    size_t mapped_size = 0;
+    char* data = NULL;
+
+#ifdef SELDON_HAS_MMAP
+    if ((huge_page || numa) && (nb_bytes >= SELDON_HUGE_PAGE_THRESHOLD))
+      {
+        // the header is stored in the first bytes of the mapping
+        mapped_size = nb_bytes + align;
+
+#ifdef MAP_HUGETLB
+        if (huge_page)
+          {
+            // explicit huge pages, available only if they have been
+            // reserved by the administrator
+            size_t huge_size = GetHugePageSize();
+            size_t length = (mapped_size + huge_size - 1)
+              / huge_size * huge_size;
+            base = mmap(NULL, length, PROT_READ | PROT_WRITE,
+                        MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+            if (base == MAP_FAILED)
+              base = NULL;
+            else
+              mapped_size = length;
+          }
+#endif
+
+        if (base == NULL)
+          {
+            base = mmap(NULL, mapped_size, PROT_READ | PROT_WRITE,
+                        MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if (base == MAP_FAILED)
+              return NULL;
+
+#ifdef MADV_HUGEPAGE
+            // transparent huge pages
+            if (huge_page)
+              madvise(base, mapped_size, MADV_HUGEPAGE);
+#endif
+          }
+
+#ifdef SELDON_WITH_NUMA
+        if (numa)
+          ApplyNumaPolicy(base, mapped_size);
+#endif
+
+        data = static_cast<char*>(base) + align;
+      }
+#endif
+
+    if (base == NULL)
+      {
+        mapped_size = 0;
+        base = malloc(nb_bytes + sizeof(BlockHeader) + align);
+        if (base == NULL)
+          return NULL;
+
+        uintptr_t address = reinterpret_cast<uintptr_t>(base)
+          + sizeof(BlockHeader) + align - 1;
+        data = reinterpret_cast<char*>(address - address % align);
+      }
+
+    BlockHeader* header = GetHeader(data);
+    header->base = base;
+    header->size = nb_bytes;
+    header->mapped_size = mapped_size;
+
+    if (numa)
+      FirstTouch(data, nb_bytes);
+
+    return data;
+  }
+
+
+  //! Releases a block allocated by AlignedMemory::Allocate.
+  inline void AlignedMemory::Deallocate(void* data)
+  {
+    if (data == NULL)
+      return;
+
+    BlockHeader* header = GetHeader(data);
+
+#ifdef SELDON_HAS_MMAP
+    if (header->mapped_size > 0)
+      {
+        munmap(header->base, header->mapped_size);
+        return;
+      }
+#endif
+
+    free(header->base);
+  }
+
+
+  //! Changes the size of a block, and keeps previous values.
+  /*!
+    \param[in] data block to reallocate (may be NULL).
+    \param[in] nb_bytes new size of the block in bytes.
+    \param[in] huge_page if true, huge pages are used for large blocks.
+    \param[in] numa if true, the NUMA policy is applied to large blocks.
+    \return The address of the new block.
+  */
+  inline void* AlignedMemory::Reallocate(void* data, size_t nb_bytes,
+                                         bool huge_page, bool numa)
+  {
+    if (data == NULL)
+      return Allocate(nb_bytes, huge_page, numa);
+
+    if (nb_bytes == 0)
+      {
+        Deallocate(data);
+        return NULL;
+      }
+
+    size_t old_size = GetSize(data);
+    if (old_size == nb_bytes)
+      return data;
+
+    void* new_data = Allocate(nb_bytes, huge_page, numa);
+    if (new_data == NULL)
+      return NULL;
+
+    memcpy(new_data, data, min(old_size, nb_bytes));
+    Deallocate(data);
+    return new_data;
+  }
+
+
+  //! Returns the size (in bytes) of a block.
+  inline size_t AlignedMemory::GetSize(const void* data)
+  {
+    if (data == NULL)
+      return 0;
+
+    return GetHeader(data)->size;
+  }
+
+
+  //! Returns true if the block has been mapped with mmap.
+  inline bool AlignedMemory::IsMapped(const void* data)
+  {
+    if (data == NULL)
+      return false;
+
+    return (GetHeader(data)->mapped_size > 0);
+  }
+
+
+  //! Sets a block to zero with a static distribution of pages over threads.
+  /*!
+    The page touched first by a thread is placed on the NUMA node of this
+    thread. Loops over the block with a static OpenMP schedule will then
+    access mostly local memory.
+  */
+  inline void AlignedMemory::FirstTouch(void* data, size_t nb_bytes)
+  {
+    const long page_size = 4096;
+    char* ptr = static_cast<char*>(data);
+    long nb_pages = (nb_bytes + page_size - 1) / page_size;
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) \
+  num_threads(ParallelContext::GetNumThreads(nb_pages, 1))
+#endif
+    for (long p = 0; p < nb_pages; p++)
+      memset(ptr + p * page_size, 0,
+             min(size_t(page_size), nb_bytes - p * page_size));
+  }
+
+
+  //! Returns the size (in bytes) of the explicit huge pages.
+  /*!
+    The default size of huge pages is read in /proc/meminfo (Hugepagesize)
+    on Linux. If it is not available, SELDON_HUGE_PAGE_THRESHOLD is
+    returned. Mappings with MAP_HUGETLB have a length multiple of this
+    size.
+  */
+  inline size_t AlignedMemory::GetHugePageSize()
+  {
+    // the file is read once
+    static size_t huge_size = ReadHugePageSize();
+    return huge_size;
+  }
+
+
+  //! Sets the placement of pages for next allocations of NumaAlloc.
+  /*!
+    \param[in] policy FIRST_TOUCH, INTERLEAVE (pages distributed on all
+    nodes) or BIND (pages placed on node \a node).
+    \param[in] node NUMA node used by the policy BIND.
+    \note The policies INTERLEAVE and BIND require SELDON_WITH_NUMA (and
+    libnuma), otherwise the first-touch placement is used.
+  */
+  inline void AlignedMemory::SetNumaPolicy(int policy, int node)
+  {
+    if ((policy != FIRST_TOUCH) && (policy != INTERLEAVE)
+        && (policy != BIND))
+      throw WrongArgument("AlignedMemory::SetNumaPolicy(int, int)",
+                          "Unknown policy " + to_str(policy) + ".");
+
+    GetNumaPolicyRef() = policy;
+    GetNumaNodeRef() = node;
+  }
+
+
+  //! Returns the current NUMA policy.
+  inline int AlignedMemory::GetNumaPolicy()
+  {
+    return GetNumaPolicyRef();
+  }
+
+
+  //! Returns the NUMA node used by the policy BIND.
+  inline int AlignedMemory::GetNumaNode()
+  {
+    return GetNumaNodeRef();
+  }
+
+
+  inline int& AlignedMemory::GetNumaPolicyRef()
+  {
+    static int policy = FIRST_TOUCH;
+    return policy;
+  }
+
+
+  inline int& AlignedMemory::GetNumaNodeRef()
+  {
+    static int node = 0;
+    return node;
+  }
+
+
+  //! Reads the size (in bytes) of huge pages in /proc/meminfo.
+  inline size_t AlignedMemory::ReadHugePageSize()
+  {
+    size_t size = SELDON_HUGE_PAGE_THRESHOLD;
+#ifdef __linux__
+    ifstream file("/proc/meminfo");
+    string line;
+    while (getline(file, line))
+      if (line.compare(0, 13, "Hugepagesize:") == 0)
+        {
+          istringstream stream(line.substr(13));
+          size_t nb_kb = 0;
+          string unit;
+          if ((stream >> nb_kb >> unit) && (nb_kb > 0) && (unit == "kB"))
+            size = nb_kb * 1024;
+
+          break;
+        }
+#endif
+
+    return size;
+  }
+
+
+  //! Returns the header stored in front of a block.
+  inline AlignedMemory::BlockHeader*
+  AlignedMemory::GetHeader(const void* data)
+  {
+    return reinterpret_cast<BlockHeader*>
+      (const_cast<char*>(static_cast<const char*>(data))
+       - sizeof(BlockHeader));
+  }
+
+
+#ifdef SELDON_WITH_NUMA
+  //! Applies the current NUMA policy to a mapped area.
+  /*!
+    \param[in] base address of the area, aligned on a page.
+    \param[in] length length of the area in bytes.
+  */
+  inline void AlignedMemory::ApplyNumaPolicy(void* base, size_t length)
+  {
+    int policy = GetNumaPolicy();
+    if ((policy == FIRST_TOUCH) || (numa_available() < 0))
+      return;
+
+    int max_node = numa_max_node();
+    unsigned long nb_bits = 8 * sizeof(unsigned long);
+    std::vector<unsigned long> mask(max_node / nb_bits + 1, 0UL);
+    if (policy == INTERLEAVE)
+      for (int i = 0; i <= max_node; i++)
+        mask[i / nb_bits] |= 1UL << (i % nb_bits);
+    else
+      {
+        int node = min(max(GetNumaNode(), 0), max_node);
+        mask[node / nb_bits] |= 1UL << (node % nb_bits);
+      }
+
+    mbind(base, length, (policy == INTERLEAVE) ? MPOL_INTERLEAVE : MPOL_BIND,
+          &mask[0], max_node + 2, 0);
+  }
+#endif
+
+
+  //////////////////
+  // ALIGNEDALLOC //
+  //////////////////
+
+
+  template <class T>
+  inline typename AlignedAlloc<T>::pointer
+  AlignedAlloc<T>::allocate(size_t num, void*)
+  {
+    return static_cast<pointer>
+      ( AlignedMemory::Allocate(num * sizeof(T), false, false) );
+  }
+
+  template <class T>
+  inline void AlignedAlloc<T>::deallocate(pointer data, size_t, void*)
+  {
+    AlignedMemory::Deallocate(data);
+  }
+
+  template <class T>
+  inline void* AlignedAlloc<T>::reallocate(pointer data, size_t num, void*)
+  {
+    return AlignedMemory::Reallocate(data, num * sizeof(T), false, false);
+  }
+
+  template <class T>
+  inline void AlignedAlloc<T>::memoryset(pointer data, char c, size_t num)
+  {
+    memset(reinterpret_cast<void*>(data), c, num);
+  }
+
+  template <class T>
+  inline void
+  AlignedAlloc<T>::memorycpy(pointer datat, pointer datas, size_t num)
+  {
+    memcpy(reinterpret_cast<void*>(datat), reinterpret_cast<void*>(datas),
+	   num * sizeof(T));
+  }
+
+
+  ///////////////////
+  // HUGEPAGEALLOC //
+  ///////////////////
+
+
+  template <class T>
+  inline typename HugePageAlloc<T>::pointer
+  HugePageAlloc<T>::allocate(size_t num, void*)
+  {
+    return static_cast<pointer>
+      ( AlignedMemory::Allocate(num * sizeof(T), true, false) );
+  }
+
+  template <class T>
+  inline void HugePageAlloc<T>::deallocate(pointer data, size_t, void*)
+  {
+    AlignedMemory::Deallocate(data);
+  }
+
+  template <class T>
+  inline void* HugePageAlloc<T>::reallocate(pointer data, size_t num, void*)
+  {
+    return AlignedMemory::Reallocate(data, num * sizeof(T), true, false);
+  }
+
+  template <class T>
+  inline void HugePageAlloc<T>::memoryset(pointer data, char c, size_t num)
+  {
+    memset(reinterpret_cast<void*>(data), c, num);
+  }
+
+  template <class T>
+  inline void
+  HugePageAlloc<T>::memorycpy(pointer datat, pointer datas, size_t num)
+  {
+    memcpy(reinterpret_cast<void*>(datat), reinterpret_cast<void*>(datas),
+	   num * sizeof(T));
+  }
+
+
+  ///////////////
+  // NUMAALLOC //
+  ///////////////
+
+
+  template <class T>
+  inline typename NumaAlloc<T>::pointer
+  NumaAlloc<T>::allocate(size_t num, void*)
+  {
+    return static_cast<pointer>
+      ( AlignedMemory::Allocate(num * sizeof(T), false, true) );
+  }
+
+  template <class T>
+  inline void NumaAlloc<T>::deallocate(pointer data, size_t, void*)
+  {
+    AlignedMemory::Deallocate(data);
+  }
+
+  template <class T>
+  inline void* NumaAlloc<T>::reallocate(pointer data, size_t num, void*)
+  {
+    return AlignedMemory::Reallocate(data, num * sizeof(T), false, true);
+  }
+
+  template <class T>
+  inline void NumaAlloc<T>::memoryset(pointer data, char c, size_t num)
+  {
+    memset(reinterpret_cast<void*>(data), c, num);
+  }
+
+  template <class T>
+  inline void
+  NumaAlloc<T>::memorycpy(pointer datat, pointer datas, size_t num)
+  {
+    memcpy(reinterpret_cast<void*>(datat), reinterpret_cast<void*>(datas),
+	   num * sizeof(T));
+  }
+
+
 } // namespace Seldon.
 
 #define SELDON_FILE_ALLOCATOR_INLINE_CXX
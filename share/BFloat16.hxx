@@ -0,0 +1,72 @@
+// Copyright (C) 2016 INRIA
+//
+// This file is part of the linear-algebra library Seldon,
+// http://seldon.sourceforge.net/.
+//
+// Seldon is free software; you can redistribute it and/or modify it under the
+// terms of the GNU Lesser General Public License as published by the Free
+// Software Foundation; either version 2.1 of the License, or (at your option)
+// any later version.
+//
+// Seldon is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for
+// more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with Seldon. If not, see http://www.gnu.org/licenses/.
+
+
+#ifndef SELDON_FILE_BFLOAT16_HXX
+
+#include <stdint.h>
+
+namespace Seldon
+{
+
+
+  //////////////
+  // BFLOAT16 //
+  //////////////
+
+
+  //! Real number stored on 16 bits (bfloat16 format).
+  /*!
+    A bfloat16 is the upper half of a float: same sign and exponent (hence
+    same range), but only 8 significant bits, i.e. a relative precision of
+    2^-9 (about 2e-3). It is meant for storing values (e.g. the values of a
+    sparse matrix used in a preconditioner) whose accuracy is not critical,
+    computations being performed after conversion to float or double.
+    Conversions round to the nearest representable value (ties to even),
+    NaN remains NaN.
+  */
+  class BFloat16
+  {
+  protected:
+    //! upper 16 bits of the float value
+    uint16_t bits_;
+
+  public:
+    BFloat16();
+    BFloat16(float x);
+    BFloat16(double x);
+
+    operator float() const;
+
+    uint16_t GetBits() const;
+    void SetBits(uint16_t bits);
+
+  protected:
+    static uint16_t Round(uint32_t u);
+
+  };
+
+
+  ostream& operator <<(ostream& out, const BFloat16& x);
+
+
+} // namespace Seldon.
+
+
+#define SELDON_FILE_BFLOAT16_HXX
+#endif
@@ -0,0 +1,119 @@
+// Copyright (C) 2016 INRIA
+//
+// This file is part of the linear-algebra library Seldon,
+// http://seldon.sourceforge.net/.
+//
+// Seldon is free software; you can redistribute it and/or modify it under the
+// terms of the GNU Lesser General Public License as published by the Free
+// Software Foundation; either version 2.1 of the License, or (at your option)
+// any later version.
+//
+// Seldon is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for
+// more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with Seldon. If not, see http://www.gnu.org/licenses/.
+
+
+#ifndef SELDON_FILE_BFLOAT16_INLINE_CXX
+
+#include "BFloat16.hxx"
+
+namespace Seldon
+{
+
+
+  //////////////
+  // BFLOAT16 //
+  //////////////
+
+
+  //! Default constructor (zero).
+  inline BFloat16::BFloat16()
+  {
+    bits_ = 0;
+  }
+
+
+  //! Constructor from a float, rounded to the nearest bfloat16.
+  inline BFloat16::BFloat16(float x)
+  {
+    uint32_t u;
+    memcpy(&u, &x, sizeof(float));
+    bits_ = Round(u);
+  }
+
+
+  //! Constructor from a double, rounded to the nearest bfloat16.
+  /*!
+    x is first rounded to a float. If this float is exactly halfway between
+    two bfloat16, it is moved towards x so that the second rounding gives
+    the bfloat16 nearest to x.
+  */
+  inline BFloat16::BFloat16(double x)
+  {
+    float f = float(x);
+    uint32_t u;
+    memcpy(&u, &f, sizeof(float));
+    if (((u & 0xFFFFu) == 0x8000u) && (double(f) != x) && (x == x))
+      {
+        if (abs(double(f)) > abs(x))
+          u--;
+        else
+          u++;
+      }
+
+    bits_ = Round(u);
+  }
+
+
+  //! Conversion to float (exact).
+  inline BFloat16::operator float() const
+  {
+    uint32_t u = uint32_t(bits_) << 16;
+    float x;
+    memcpy(&x, &u, sizeof(float));
+    return x;
+  }
+
+
+  //! Returns the 16 bits of the number.
+  inline uint16_t BFloat16::GetBits() const
+  {
+    return bits_;
+  }
+
+
+  //! Sets the 16 bits of the number.
+  inline void BFloat16::SetBits(uint16_t bits)
+  {
+    bits_ = bits;
+  }
+
+
+  //! Rounds the bits of a float to the nearest bfloat16 (ties to even).
+  inline uint16_t BFloat16::Round(uint32_t u)
+  {
+    // NaN are kept quiet, the rounding could turn them into infinity
+    if ((u & 0x7FFFFFFFu) > 0x7F800000u)
+      return uint16_t((u >> 16) | 0x0040u);
+
+    return uint16_t((u + 0x7FFFu + ((u >> 16) & 1u)) >> 16);
+  }
+
+
+  //! Writes the value of a bfloat16.
+  inline ostream& operator <<(ostream& out, const BFloat16& x)
+  {
+    out << float(x);
+    return out;
+  }
+
+
+} // namespace Seldon.
+
+
+#define SELDON_FILE_BFLOAT16_INLINE_CXX
+#endif
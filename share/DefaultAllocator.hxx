@@ -76,6 +76,13 @@ namespace Seldon
     typedef MallocAlloc<float> allocator;
   };  
 
+  template<class Storage>
+  class SeldonDefaultAllocator<Storage, BFloat16>
+  {
+  public:
+    typedef MallocAlloc<BFloat16> allocator;
+  };  
+
   template<class Storage>
   class SeldonDefaultAllocator<Storage, double>
   {
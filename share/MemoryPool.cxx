@@ -0,0 +1,101 @@
+// Copyright (C) 2016 INRIA
+//
+// This file is part of the linear-algebra library Seldon,
+// http://seldon.sourceforge.net/.
+//
+// Seldon is free software; you can redistribute it and/or modify it under the
+// terms of the GNU Lesser General Public License as published by the Free
+// Software Foundation; either version 2.1 of the License, or (at your option)
+// any later version.
+//
+// Seldon is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for
+// more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with Seldon. If not, see http://www.gnu.org/licenses/.
+
+
+
+#ifndef SELDON_FILE_MEMORY_POOL_CXX
+
+#include "MemoryPool.hxx"
+
+namespace Seldon
+{
+
+
+  ///////////////
+  // WORKSPACE //
+  ///////////////
+
+
+  //! Returns an array of n elements, valid during the life of the workspace.
+  /*!
+    The elements are not initialized.
+  */
+  template<class T>
+  T* Workspace::Allocate(size_t n)
+  {
+    T* data = static_cast<T*>(pool_.Allocate(n * sizeof(T)));
+
+#ifdef SELDON_CHECK_MEMORY
+    if ((data == NULL) && (n != 0))
+      throw NoMemory("Workspace::Allocate(size_t)",
+		     "Unable to allocate " + to_str(n * sizeof(T))
+		     + " bytes.");
+#endif
+
+    if (data != NULL)
+      block_.push_back(data);
+
+    return data;
+  }
+
+
+  //! Sets a vector of size n on an array of the workspace.
+  /*!
+    \param[in] n size of the vector.
+    \param[out] x vector whose data array is taken from the pool. Previous
+    values are cleared. It must not be reallocated while the workspace is
+    alive, and it is emptied when the workspace is destroyed.
+  */
+  template<class Vect>
+  void Workspace::GetVector(size_t n, Vect& x)
+  {
+    typedef typename Vect::value_type T;
+    x.Clear();
+    T* data = Allocate<T>(n);
+    if (data == NULL)
+      return;
+
+    x.SetData(n, data);
+    vector_.push_back(&x);
+    vector_data_.push_back(data);
+    nullify_.push_back(&NullifyVector<Vect>);
+  }
+
+
+  //! Empties a vector without releasing its data array.
+  /*!
+    \param[in,out] x vector filled by GetVector.
+    \param[in] data array given to the vector.
+    \return False if the vector does not hold \a data anymore (it has been
+    reallocated, cleared or swapped), in which case it is left unchanged.
+  */
+  template<class Vect>
+  bool Workspace::NullifyVector(void* x, void* data)
+  {
+    Vect& v = *static_cast<Vect*>(x);
+    if (static_cast<void*>(v.GetData()) != data)
+      return false;
+
+    v.Nullify();
+    return true;
+  }
+
+} // namespace Seldon.
+
+#define SELDON_FILE_MEMORY_POOL_CXX
+#endif
@@ -0,0 +1,235 @@
+// Copyright (C) 2016 INRIA
+//
+// This file is part of the linear-algebra library Seldon,
+// http://seldon.sourceforge.net/.
+//
+// Seldon is free software; you can redistribute it and/or modify it under the
+// terms of the GNU Lesser General Public License as published by the Free
+// Software Foundation; either version 2.1 of the License, or (at your option)
+// any later version.
+//
+// Seldon is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for
+// more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with Seldon. If not, see http://www.gnu.org/licenses/.
+
+
+
+#ifndef SELDON_FILE_MEMORY_POOL_HXX
+
+#ifdef SELDON_WITH_CPP11
+#include <mutex>
+#elif defined(__unix__) || defined(__APPLE__)
+#include <pthread.h>
+#ifndef SELDON_HAS_PTHREAD
+#define SELDON_HAS_PTHREAD
+#endif
+#endif
+
+namespace Seldon
+{
+
+
+  ////////////////
+  // MEMORYPOOL //
+  ////////////////
+
+
+  //! Pool of memory blocks reused between allocations.
+  /*!
+    Requested sizes are rounded up to a power of two (at least
+    SELDON_MEMORY_ALIGNMENT bytes). A released block is kept in the list of
+    its size class and is given back to the next request of the same class,
+    so that temporary arrays allocated at each call of a function do not
+    go through malloc. Cached memory is limited by SetMaxCachedMemory.
+    The pool can be shared between threads (OpenMP, std::thread or
+    pthreads): its lists and counters are protected by a mutex.
+  */
+  class MemoryPool
+  {
+  protected:
+    //! available blocks for each size class
+    std::vector<std::vector<void*> > free_block_;
+
+    //! number of requests
+    size_t nb_allocation_;
+    //! number of requests that have been forwarded to the system
+    size_t nb_system_allocation_;
+    //! memory (in bytes) currently given to the user
+    size_t memory_used_;
+    //! maximal value reached by memory_used_
+    size_t peak_memory_;
+    //! memory (in bytes) stored in free_block_
+    size_t memory_cached_;
+    //! maximal memory (in bytes) kept in free_block_
+    size_t max_memory_cached_;
+
+    //! mutex protecting free_block_ and the counters
+#ifdef SELDON_WITH_CPP11
+    mutable std::mutex mutex_;
+#elif defined(SELDON_HAS_PTHREAD)
+    mutable pthread_mutex_t mutex_;
+#elif defined(_OPENMP)
+    mutable omp_lock_t mutex_;
+#endif
+
+  public:
+    MemoryPool();
+    ~MemoryPool();
+
+    void* Allocate(size_t nb_bytes);
+    void Deallocate(void* data);
+    void* Reallocate(void* data, size_t nb_bytes);
+    void Clear();
+
+    void SetMaxCachedMemory(size_t nb_bytes);
+    size_t GetMaxCachedMemory() const;
+
+    size_t GetNbAllocation() const;
+    size_t GetNbSystemAllocation() const;
+    size_t GetMemoryUsed() const;
+    size_t GetPeakMemory() const;
+    size_t GetCachedMemory() const;
+    void ResetStatistics();
+    void WriteStatistics(ostream& out = cout) const;
+
+    static MemoryPool& GetDefault();
+
+  protected:
+    static int GetSizeClass(size_t nb_bytes);
+
+    void Lock() const;
+    void Unlock() const;
+
+    friend class MemoryPoolLock;
+
+  private:
+    MemoryPool(const MemoryPool&);
+    MemoryPool& operator=(const MemoryPool&);
+
+  };
+
+
+  ////////////////////
+  // MEMORYPOOLLOCK //
+  ////////////////////
+
+
+  //! Locks a memory pool during a scope.
+  class MemoryPoolLock
+  {
+  protected:
+    //! locked pool
+    const MemoryPool& pool_;
+
+  public:
+    explicit MemoryPoolLock(const MemoryPool& pool);
+    ~MemoryPoolLock();
+
+  private:
+    MemoryPoolLock(const MemoryPoolLock&);
+    MemoryPoolLock& operator=(const MemoryPoolLock&);
+
+  };
+
+
+  ///////////////
+  // POOLALLOC //
+  ///////////////
+
+
+  //! Allocator drawing its blocks from the default memory pool.
+  /*!
+    The elements are not constructed, this allocator should be used for
+    plain types only (as MallocAlloc).
+  */
+  template <class T>
+  class PoolAlloc
+  {
+  public:
+    typedef T value_type;
+    typedef T* pointer;
+    typedef const T* const_pointer;
+    typedef T& reference;
+    typedef const T& const_reference;
+
+    //! true if the allocator keeps previous elements when
+    //! calling reallocate
+    static const bool KeepDataReallocate = true;
+
+  public:
+
+    static pointer allocate(size_t num, void* h = 0);
+    static void deallocate(pointer data, size_t num, void* h = 0);
+    static void* reallocate(pointer data, size_t num, void* h = 0);
+    static void memoryset(pointer data, char c, size_t num);
+    static void memorycpy(pointer datat, pointer datas, size_t num);
+  };
+
+
+  ///////////////
+  // WORKSPACE //
+  ///////////////
+
+
+  //! Temporary arrays taken from a memory pool during a scope.
+  /*!
+    All the arrays given by a workspace are returned to the pool when the
+    workspace is destroyed. Vectors filled by GetVector must be declared
+    before the workspace (so that they are destroyed after it), and must
+    not be reallocated, cleared or swapped while the workspace is alive.
+    When the workspace is released, these vectors are emptied (Nullify),
+    and an exception is raised if one of them no longer holds the array it
+    has been given. Example:
+    \code
+    Vector<double> row_val;
+    IVect index;
+    Workspace work;
+    work.GetVector(n, row_val);
+    work.GetVector(n, index);
+    \endcode
+  */
+  class Workspace
+  {
+  protected:
+    //! pool providing the arrays
+    MemoryPool& pool_;
+    //! arrays taken from the pool
+    std::vector<void*> block_;
+    //! vectors sharing these arrays
+    std::vector<void*> vector_;
+    //! array given to each vector
+    std::vector<void*> vector_data_;
+    //! functions releasing each vector
+    std::vector<bool (*)(void*, void*)> nullify_;
+
+  public:
+    Workspace();
+    explicit Workspace(MemoryPool& pool);
+    ~Workspace();
+
+    template<class T>
+    T* Allocate(size_t n);
+
+    template<class Vect>
+    void GetVector(size_t n, Vect& x);
+
+    void Release();
+
+  protected:
+    template<class Vect>
+    static bool NullifyVector(void* x, void* data);
+
+  private:
+    Workspace(const Workspace&);
+    Workspace& operator=(const Workspace&);
+
+  };
+
+} // namespace Seldon.
+
+#define SELDON_FILE_MEMORY_POOL_HXX
+#endif
@@ -0,0 +1,466 @@
+// Copyright (C) 2016 INRIA
+//
+// This file is part of the linear-algebra library Seldon,
+// http://seldon.sourceforge.net/.
+//
+// Seldon is free software; you can redistribute it and/or modify it under the
+// terms of the GNU Lesser General Public License as published by the Free
+// Software Foundation; either version 2.1 of the License, or (at your option)
+// any later version.
+//
+// Seldon is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for
+// more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with Seldon. If not, see http://www.gnu.org/licenses/.
+
+
+
+#ifndef SELDON_FILE_MEMORY_POOL_INLINE_CXX
+
+#include "MemoryPool.hxx"
+
+namespace Seldon
+{
+
+
+  ////////////////
+  // MEMORYPOOL //
+  ////////////////
+
+
+  //! Default constructor.
+  /*!
+    The pool is empty, and the cached memory is not limited.
+  */
+  inline MemoryPool::MemoryPool()
+  {
+    nb_allocation_ = 0;
+    nb_system_allocation_ = 0;
+    memory_used_ = 0;
+    peak_memory_ = 0;
+    memory_cached_ = 0;
+    max_memory_cached_ = size_t(-1);
+
+#ifdef SELDON_WITH_CPP11
+#elif defined(SELDON_HAS_PTHREAD)
+    pthread_mutex_init(&mutex_, NULL);
+#elif defined(_OPENMP)
+    omp_init_lock(&mutex_);
+#endif
+  }
+
+
+  //! Destructor.
+  /*!
+    Cached blocks are released. Blocks still used are not freed.
+  */
+  inline MemoryPool::~MemoryPool()
+  {
+    Clear();
+
+#ifdef SELDON_WITH_CPP11
+#elif defined(SELDON_HAS_PTHREAD)
+    pthread_mutex_destroy(&mutex_);
+#elif defined(_OPENMP)
+    omp_destroy_lock(&mutex_);
+#endif
+  }
+
+
+  //! Returns a block of at least nb_bytes bytes.
+  /*!
+    \param[in] nb_bytes requested size.
+    \return Block aligned on SELDON_MEMORY_ALIGNMENT bytes, NULL if the
+    allocation failed or if \a nb_bytes is 0.
+  */
+  inline void* MemoryPool::Allocate(size_t nb_bytes)
+  {
+    if (nb_bytes == 0)
+      return NULL;
+
+    SELDON_PROFILE("MemoryPool::Allocate");
+    SELDON_PROFILE_COUNT(0., double(nb_bytes));
+
+    int c = GetSizeClass(nb_bytes);
+    size_t size = size_t(SELDON_MEMORY_ALIGNMENT) << c;
+    void* data = NULL;
+
+    {
+      MemoryPoolLock lock(*this);
+      nb_allocation_++;
+      if ((c < int(free_block_.size())) && (!free_block_[c].empty()))
+	{
+	  data = free_block_[c].back();
+	  free_block_[c].pop_back();
+	  memory_cached_ -= size;
+	  memory_used_ += size;
+	  peak_memory_ = max(peak_memory_, memory_used_);
+	  return data;
+	}
+
+      nb_system_allocation_++;
+    }
+
+    // the system allocation is done outside of the lock
+    data = AlignedMemory::Allocate(size, false, false);
+    if (data != NULL)
+      {
+	MemoryPoolLock lock(*this);
+	memory_used_ += size;
+	peak_memory_ = max(peak_memory_, memory_used_);
+      }
+
+    return data;
+  }
+
+
+  //! Gives a block back to the pool.
+  /*!
+    The block is kept for next allocations, unless the cached memory would
+    exceed the maximal cached memory.
+  */
+  inline void MemoryPool::Deallocate(void* data)
+  {
+    if (data == NULL)
+      return;
+
+    size_t size = AlignedMemory::GetSize(data);
+    int c = GetSizeClass(size);
+    bool release = false;
+
+    {
+      MemoryPoolLock lock(*this);
+      memory_used_ -= size;
+      if (memory_cached_ + size <= max_memory_cached_)
+	{
+	  if (c >= int(free_block_.size()))
+	    free_block_.resize(c + 1);
+
+	  free_block_[c].push_back(data);
+	  memory_cached_ += size;
+	}
+      else
+	release = true;
+    }
+
+    if (release)
+      AlignedMemory::Deallocate(data);
+  }
+
+
+  //! Changes the size of a block, and keeps previous values.
+  inline void* MemoryPool::Reallocate(void* data, size_t nb_bytes)
+  {
+    if (data == NULL)
+      return Allocate(nb_bytes);
+
+    if (nb_bytes == 0)
+      {
+	Deallocate(data);
+	return NULL;
+      }
+
+    // the block is large enough
+    size_t size = AlignedMemory::GetSize(data);
+    if (GetSizeClass(nb_bytes) == GetSizeClass(size))
+      return data;
+
+    void* new_data = Allocate(nb_bytes);
+    if (new_data == NULL)
+      return NULL;
+
+    memcpy(new_data, data, min(size, nb_bytes));
+    Deallocate(data);
+    return new_data;
+  }
+
+
+  //! Releases all cached blocks to the system.
+  inline void MemoryPool::Clear()
+  {
+    // blocks are released outside of the lock
+    std::vector<std::vector<void*> > block;
+    {
+      MemoryPoolLock lock(*this);
+      block.swap(free_block_);
+      memory_cached_ = 0;
+    }
+
+    for (size_t c = 0; c < block.size(); c++)
+      for (size_t i = 0; i < block[c].size(); i++)
+	AlignedMemory::Deallocate(block[c][i]);
+  }
+
+
+  //! Sets the maximal memory (in bytes) kept in the pool.
+  /*!
+    Cached blocks are released if the current cached memory is larger.
+  */
+  inline void MemoryPool::SetMaxCachedMemory(size_t nb_bytes)
+  {
+    bool clear;
+    {
+      MemoryPoolLock lock(*this);
+      max_memory_cached_ = nb_bytes;
+      clear = (memory_cached_ > max_memory_cached_);
+    }
+
+    if (clear)
+      Clear();
+  }
+
+
+  //! Returns the maximal memory (in bytes) kept in the pool.
+  inline size_t MemoryPool::GetMaxCachedMemory() const
+  {
+    MemoryPoolLock lock(*this);
+    return max_memory_cached_;
+  }
+
+
+  //! Returns the number of allocations requested to the pool.
+  inline size_t MemoryPool::GetNbAllocation() const
+  {
+    MemoryPoolLock lock(*this);
+    return nb_allocation_;
+  }
+
+
+  //! Returns the number of allocations that could not reuse a block.
+  inline size_t MemoryPool::GetNbSystemAllocation() const
+  {
+    MemoryPoolLock lock(*this);
+    return nb_system_allocation_;
+  }
+
+
+  //! Returns the memory (in bytes) currently used.
+  inline size_t MemoryPool::GetMemoryUsed() const
+  {
+    MemoryPoolLock lock(*this);
+    return memory_used_;
+  }
+
+
+  //! Returns the peak of used memory (in bytes).
+  inline size_t MemoryPool::GetPeakMemory() const
+  {
+    MemoryPoolLock lock(*this);
+    return peak_memory_;
+  }
+
+
+  //! Returns the memory (in bytes) stored in the pool for reuse.
+  inline size_t MemoryPool::GetCachedMemory() const
+  {
+    MemoryPoolLock lock(*this);
+    return memory_cached_;
+  }
+
+
+  //! Resets the allocation counters and the peak of memory.
+  inline void MemoryPool::ResetStatistics()
+  {
+    MemoryPoolLock lock(*this);
+    nb_allocation_ = 0;
+    nb_system_allocation_ = 0;
+    peak_memory_ = memory_used_;
+  }
+
+
+  //! Displays the statistics of the pool.
+  inline void MemoryPool::WriteStatistics(ostream& out) const
+  {
+    MemoryPoolLock lock(*this);
+    out << "Number of allocations: " << nb_allocation_ << endl;
+    out << "Number of system allocations: " << nb_system_allocation_ << endl;
+    out << "Memory used: " << memory_used_ << " bytes" << endl;
+    out << "Peak memory: " << peak_memory_ << " bytes" << endl;
+    out << "Cached memory: " << memory_cached_ << " bytes" << endl;
+  }
+
+
+  //! Returns the pool used by PoolAlloc and Workspace.
+  /*!
+    The pool is shared by all threads. It is never destroyed, so that
+    static objects can still release their blocks at exit.
+  */
+  inline MemoryPool& MemoryPool::GetDefault()
+  {
+    static MemoryPool* pool = new MemoryPool();
+    return *pool;
+  }
+
+
+  //! Returns the size class of a block of nb_bytes bytes.
+  inline int MemoryPool::GetSizeClass(size_t nb_bytes)
+  {
+    int c = 0;
+    size_t size = SELDON_MEMORY_ALIGNMENT;
+    while (size < nb_bytes)
+      {
+	size *= 2;
+	c++;
+      }
+
+    return c;
+  }
+
+
+  //! Locks the mutex of the pool.
+  inline void MemoryPool::Lock() const
+  {
+#ifdef SELDON_WITH_CPP11
+    mutex_.lock();
+#elif defined(SELDON_HAS_PTHREAD)
+    pthread_mutex_lock(&mutex_);
+#elif defined(_OPENMP)
+    omp_set_lock(&mutex_);
+#endif
+  }
+
+
+  //! Unlocks the mutex of the pool.
+  inline void MemoryPool::Unlock() const
+  {
+#ifdef SELDON_WITH_CPP11
+    mutex_.unlock();
+#elif defined(SELDON_HAS_PTHREAD)
+    pthread_mutex_unlock(&mutex_);
+#elif defined(_OPENMP)
+    omp_unset_lock(&mutex_);
+#endif
+  }
+
+
+  ////////////////////
+  // MEMORYPOOLLOCK //
+  ////////////////////
+
+
+  //! Locks the pool until the end of the scope.
+  inline MemoryPoolLock::MemoryPoolLock(const MemoryPool& pool) : pool_(pool)
+  {
+    pool_.Lock();
+  }
+
+
+  //! Unlocks the pool.
+  inline MemoryPoolLock::~MemoryPoolLock()
+  {
+    pool_.Unlock();
+  }
+
+
+  ///////////////
+  // POOLALLOC //
+  ///////////////
+
+
+  template <class T>
+  inline typename PoolAlloc<T>::pointer
+  PoolAlloc<T>::allocate(size_t num, void*)
+  {
+    return static_cast<pointer>
+      ( MemoryPool::GetDefault().Allocate(num * sizeof(T)) );
+  }
+
+  template <class T>
+  inline void PoolAlloc<T>::deallocate(pointer data, size_t, void*)
+  {
+    MemoryPool::GetDefault().Deallocate(data);
+  }
+
+  template <class T>
+  inline void* PoolAlloc<T>::reallocate(pointer data, size_t num, void*)
+  {
+    return MemoryPool::GetDefault().Reallocate(data, num * sizeof(T));
+  }
+
+  template <class T>
+  inline void PoolAlloc<T>::memoryset(pointer data, char c, size_t num)
+  {
+    memset(reinterpret_cast<void*>(data), c, num);
+  }
+
+  template <class T>
+  inline void
+  PoolAlloc<T>::memorycpy(pointer datat, pointer datas, size_t num)
+  {
+    memcpy(reinterpret_cast<void*>(datat), reinterpret_cast<void*>(datas),
+	   num * sizeof(T));
+  }
+
+
+  ///////////////
+  // WORKSPACE //
+  ///////////////
+
+
+  //! Default constructor, arrays are taken from the default pool.
+  inline Workspace::Workspace() : pool_(MemoryPool::GetDefault())
+  {
+  }
+
+
+  //! Constructor with the pool providing the arrays.
+  inline Workspace::Workspace(MemoryPool& pool) : pool_(pool)
+  {
+  }
+
+
+  //! Destructor, arrays are given back to the pool.
+  /*!
+    The program is stopped if a vector filled by GetVector has been
+    modified, since its array may be released twice.
+  */
+  inline Workspace::~Workspace()
+  {
+    try
+      {
+	Release();
+      }
+    catch (Error& err)
+      {
+	err.CoutWhat();
+	abort();
+      }
+  }
+
+
+  //! Gives back all the arrays to the pool.
+  /*!
+    Vectors filled by GetVector are emptied. If one of them does not hold
+    its array anymore (it has been reallocated, cleared or swapped), an
+    exception is raised and no array is given back to the pool, since they
+    may still be used by other vectors.
+  */
+  inline void Workspace::Release()
+  {
+    bool modified = false;
+    for (size_t i = 0; i < vector_.size(); i++)
+      if (!nullify_[i](vector_[i], vector_data_[i]))
+	modified = true;
+
+    if (!modified)
+      for (size_t i = 0; i < block_.size(); i++)
+	pool_.Deallocate(block_[i]);
+
+    vector_.clear();
+    vector_data_.clear();
+    nullify_.clear();
+    block_.clear();
+
+    if (modified)
+      throw WrongArgument("Workspace::Release()",
+			  "A vector given by GetVector has been reallocated,"
+			  " cleared or swapped while the workspace is alive.");
+  }
+
+} // namespace Seldon.
+
+#define SELDON_FILE_MEMORY_POOL_INLINE_CXX
+#endif
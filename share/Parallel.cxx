@@ -0,0 +1,164 @@
+// Copyright (C) 2016 INRIA
+//
+// This file is part of the linear-algebra library Seldon,
+// http://seldon.sourceforge.net/.
+//
+// Seldon is free software; you can redistribute it and/or modify it under the
+// terms of the GNU Lesser General Public License as published by the Free
+// Software Foundation; either version 2.1 of the License, or (at your option)
+// any later version.
+//
+// Seldon is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for
+// more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with Seldon. If not, see http://www.gnu.org/licenses/.
+
+
+#ifndef SELDON_FILE_PARALLEL_CXX
+
+#include "Parallel.hxx"
+
+namespace Seldon
+{
+
+
+  //! Calls f on blocks of [begin, end), with the threads of Seldon.
+  /*!
+    \param[in] begin first iteration.
+    \param[in] end iteration after the last one.
+    \param[in] f function object, f(i0, i1) performs the iterations i0 to
+    i1 - 1. It is called concurrently on disjoint blocks, one per thread.
+    \param[in] grain minimal number of iterations per thread (0 for the
+    value of ParallelContext::GetGrainSize).
+    An exception thrown in a thread is thrown again by the calling thread
+    once all threads are finished, as when the loop is sequential (see
+    ParallelError).
+    Example:
+    \code
+    class Increment
+    {
+      double* x_;
+    public:
+      Increment(double* x) : x_(x) {}
+      void operator()(size_t i0, size_t i1) const
+      {
+	for (size_t i = i0; i < i1; i++)
+	  x_[i] += 1.0;
+      }
+    };
+
+    ParallelFor(0, n, Increment(x.GetData()));
+    \endcode
+  */
+  template<class Function>
+  void ParallelFor(size_t begin, size_t end, const Function& f,
+		   size_t grain)
+  {
+    if (end <= begin)
+      return;
+
+    int nb_threads = ParallelContext::GetNumThreads(end - begin, grain);
+    if (nb_threads <= 1)
+      {
+	f(begin, end);
+	return;
+      }
+
+#ifdef _OPENMP
+    ParallelError error("ParallelFor");
+
+    // threads used by the loops of other threads are not taken
+    nb_threads = ParallelContext::ReserveThreads(nb_threads);
+#pragma omp parallel num_threads(nb_threads)
+    {
+      size_t i0, i1;
+      ParallelContext::GetBlock(begin, end, omp_get_num_threads(),
+				omp_get_thread_num(), i0, i1);
+      try
+	{
+	  f(i0, i1);
+	}
+      catch (...)
+	{
+	  error.Catch();
+	}
+    }
+
+    ParallelContext::ReleaseThreads(nb_threads);
+    error.Rethrow();
+#endif
+  }
+
+
+  //! Sums the values returned by f on blocks of [begin, end).
+  /*!
+    \param[in] begin first iteration.
+    \param[in] end iteration after the last one.
+    \param[in] f function object, f(i0, i1) returns the contribution of
+    the iterations i0 to i1 - 1.
+    \param[in] init initial value.
+    \param[in] grain minimal number of iterations per thread (0 for the
+    value of ParallelContext::GetGrainSize).
+    \return init plus the contributions of the blocks. The contributions
+    are added in the order of the blocks, so that the result only depends
+    on the number of threads. Exceptions are handled as in ParallelFor.
+  */
+  template<class T, class Function>
+  T ParallelReduce(size_t begin, size_t end, const Function& f,
+		   const T& init, size_t grain)
+  {
+    T value(init);
+    if (end <= begin)
+      return value;
+
+    int nb_threads = ParallelContext::GetNumThreads(end - begin, grain);
+    if (nb_threads <= 1)
+      {
+	value += f(begin, end);
+	return value;
+      }
+
+#ifdef _OPENMP
+    nb_threads = ParallelContext::ReserveThreads(nb_threads);
+    vector<T> partial(nb_threads, init);
+    int nb_team = nb_threads;
+    ParallelError error("ParallelReduce");
+
+#pragma omp parallel num_threads(nb_threads)
+    {
+      int t = omp_get_thread_num();
+      if (t == 0)
+	nb_team = omp_get_num_threads();
+
+      size_t i0, i1;
+      ParallelContext::GetBlock(begin, end, omp_get_num_threads(), t,
+				i0, i1);
+      try
+	{
+	  partial[t] = f(i0, i1);
+	}
+      catch (...)
+	{
+	  error.Catch();
+	}
+    }
+
+    ParallelContext::ReleaseThreads(nb_threads);
+    error.Rethrow();
+
+    // the team may be smaller than requested
+    for (int t = 0; t < nb_team; t++)
+      value += partial[t];
+#endif
+
+    return value;
+  }
+
+
+} // namespace Seldon.
+
+#define SELDON_FILE_PARALLEL_CXX
+#endif
@@ -0,0 +1,138 @@
+// Copyright (C) 2016 INRIA
+//
+// This file is part of the linear-algebra library Seldon,
+// http://seldon.sourceforge.net/.
+//
+// Seldon is free software; you can redistribute it and/or modify it under the
+// terms of the GNU Lesser General Public License as published by the Free
+// Software Foundation; either version 2.1 of the License, or (at your option)
+// any later version.
+//
+// Seldon is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for
+// more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with Seldon. If not, see http://www.gnu.org/licenses/.
+
+
+#ifndef SELDON_FILE_PARALLEL_HXX
+
+namespace Seldon
+{
+
+
+  /////////////////////
+  // PARALLELCONTEXT //
+  /////////////////////
+
+
+  //! Threads used by the parallel loops of Seldon.
+  /*!
+    The parallel loops of Seldon (sparse matrix-vector products, vector
+    functions, conversions, factorizations) ask this class how many threads
+    they may use. Threads are given by OpenMP; without OpenMP, all loops are
+    sequential.
+
+    By default, a loop called inside a parallel region (of Seldon or of the
+    user) is sequential, so that threads are not oversubscribed. With
+    SetNestedPolicy(NESTED_PARALLEL), the threads are shared between the
+    threads of the enclosing region. Loops called at the same time by
+    threads that are not OpenMP threads (std::thread, pthreads) share the
+    threads as well: the threads of the running loops are counted (see
+    ReserveThreads), and a loop only uses the remaining ones.
+
+    With SetDeterministic(true), the reductions DotProd, DotProdConj and
+    Norm2 of dense and distributed vectors return the same result whatever
+    the number of threads and of MPI processes (see
+    Functions_VectorReproducible.hxx).
+  */
+  class ParallelContext
+  {
+  public:
+    //! Policies for a parallel loop called inside a parallel region.
+    enum {NESTED_SEQUENTIAL, NESTED_PARALLEL};
+
+    static int GetNumThreads();
+    static void SetNumThreads(int nb_threads);
+    static int GetDefaultNumThreads();
+
+    static int GetNestedPolicy();
+    static void SetNestedPolicy(int policy);
+
+    static size_t GetGrainSize();
+    static void SetGrainSize(size_t grain);
+
+    static int GetNumThreads(size_t nb_iteration, size_t grain = 0);
+    static int GetBusyThreads();
+    static int ReserveThreads(int nb_threads);
+    static void ReleaseThreads(int nb_threads);
+    static bool InParallel();
+    static int GetThreadNumber();
+    static void GetBlock(size_t begin, size_t end, int nb_block, int num,
+			 size_t& block_begin, size_t& block_end);
+
+    static bool PinThreads();
+
+    static bool IsDeterministic();
+    static void SetDeterministic(bool deterministic);
+
+  private:
+    static int& GetNumThreadsRef();
+    static int& GetNestedPolicyRef();
+    static size_t& GetGrainSizeRef();
+    static bool& GetDeterministicRef();
+    static int& GetBusyThreadsRef();
+  };
+
+
+  ///////////////////
+  // PARALLELERROR //
+  ///////////////////
+
+
+  //! Exception thrown by a thread of a parallel region.
+  /*!
+    The first exception caught by Catch is thrown again by Rethrow, after
+    the parallel region. With C++11, the original exception is thrown
+    again (std::exception_ptr). Otherwise, an Error with the message of
+    the exception is thrown.
+  */
+  class ParallelError
+  {
+  protected:
+    //! function with the parallel region
+    string function_;
+    //! true if an exception has been caught
+    bool failed_;
+#ifdef SELDON_WITH_CPP11
+    //! first exception caught
+    std::exception_ptr error_;
+#else
+    //! message of the first exception caught
+    string message_;
+#endif
+
+  public:
+    explicit ParallelError(string function);
+
+    void Catch();
+    void Rethrow() const;
+
+  };
+
+
+  template<class Function>
+  void ParallelFor(size_t begin, size_t end, const Function& f,
+		   size_t grain = 0);
+
+  template<class T, class Function>
+  T ParallelReduce(size_t begin, size_t end, const Function& f,
+		   const T& init, size_t grain = 0);
+
+
+} // namespace Seldon.
+
+#define SELDON_FILE_PARALLEL_HXX
+#endif
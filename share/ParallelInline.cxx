@@ -0,0 +1,477 @@
+// Copyright (C) 2016 INRIA
+//
+// This file is part of the linear-algebra library Seldon,
+// http://seldon.sourceforge.net/.
+//
+// Seldon is free software; you can redistribute it and/or modify it under the
+// terms of the GNU Lesser General Public License as published by the Free
+// Software Foundation; either version 2.1 of the License, or (at your option)
+// any later version.
+//
+// Seldon is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for
+// more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with Seldon. If not, see http://www.gnu.org/licenses/.
+
+
+#ifndef SELDON_FILE_PARALLEL_INLINE_CXX
+
+#include "Parallel.hxx"
+
+#if defined(_OPENMP) && defined(__linux__)
+#include <sched.h>
+#include <unistd.h>
+#endif
+
+namespace Seldon
+{
+
+
+  /////////////////////
+  // PARALLELCONTEXT //
+  /////////////////////
+
+
+  //! Returns the number of threads used by the parallel loops.
+  inline int ParallelContext::GetNumThreads()
+  {
+    return GetNumThreadsRef();
+  }
+
+
+  //! Sets the number of threads used by the parallel loops.
+  /*!
+    \param[in] nb_threads number of threads. If it is not positive, the
+    default number of threads is restored.
+  */
+  inline void ParallelContext::SetNumThreads(int nb_threads)
+  {
+    if (nb_threads <= 0)
+      GetNumThreadsRef() = GetDefaultNumThreads();
+    else
+      GetNumThreadsRef() = nb_threads;
+  }
+
+
+  //! Returns the number of threads used when SetNumThreads is not called.
+  /*!
+    The number of threads is given by the environment variable
+    SELDON_NUM_THREADS, or else by OpenMP (OMP_NUM_THREADS). If none is
+    set and if several MPI processes run on the same node without being
+    bound to distinct cores, the cores are shared between the processes.
+  */
+  inline int ParallelContext::GetDefaultNumThreads()
+  {
+#ifdef _OPENMP
+    const char* value = getenv("SELDON_NUM_THREADS");
+    if ((value != NULL) && (atoi(value) > 0))
+      return atoi(value);
+
+    int nb_threads = omp_get_max_threads();
+
+#if defined(SELDON_WITH_MPI) && defined(MPI_VERSION) && (MPI_VERSION >= 3)
+    int initialized = 0, finalized = 0;
+    MPI_Initialized(&initialized);
+    MPI_Finalized(&finalized);
+    if (initialized && !finalized && (getenv("OMP_NUM_THREADS") == NULL)
+	&& (omp_get_num_procs() == omp_get_max_threads()))
+      {
+	// processes on the same node
+	MPI_Comm node_comm;
+	int nb_local = 1;
+	MPI_Comm_split_type(MPI_COMM_WORLD, MPI_COMM_TYPE_SHARED, 0,
+			    MPI_INFO_NULL, &node_comm);
+	MPI_Comm_size(node_comm, &nb_local);
+	MPI_Comm_free(&node_comm);
+
+#ifdef __linux__
+	// a process bound to some cores only uses them
+	bool bound = false;
+	cpu_set_t mask;
+	if (sched_getaffinity(0, sizeof(mask), &mask) == 0)
+	  bound = CPU_COUNT(&mask) < sysconf(_SC_NPROCESSORS_ONLN);
+	if (!bound)
+	  nb_threads = max(1, nb_threads / nb_local);
+#else
+	nb_threads = max(1, nb_threads / nb_local);
+#endif
+      }
+#endif
+
+    return nb_threads;
+#else
+    return 1;
+#endif
+  }
+
+
+  //! Returns the policy for loops called inside a parallel region.
+  inline int ParallelContext::GetNestedPolicy()
+  {
+    return GetNestedPolicyRef();
+  }
+
+
+  //! Sets the policy for loops called inside a parallel region.
+  /*!
+    \param[in] policy NESTED_SEQUENTIAL (the loop is sequential) or
+    NESTED_PARALLEL (the loop is shared between the threads of the
+    enclosing region, nested parallelism of OpenMP is then enabled).
+  */
+  inline void ParallelContext::SetNestedPolicy(int policy)
+  {
+    GetNestedPolicyRef() = policy;
+#ifdef _OPENMP
+    if ((policy == NESTED_PARALLEL) && (omp_get_max_active_levels() < 2))
+      omp_set_max_active_levels(2);
+#endif
+  }
+
+
+  //! Returns the minimal number of iterations given to a thread.
+  inline size_t ParallelContext::GetGrainSize()
+  {
+    return GetGrainSizeRef();
+  }
+
+
+  //! Sets the minimal number of iterations given to a thread.
+  /*!
+    A loop with less than 2 * \a grain iterations is sequential, since the
+    cost of starting the threads would not be compensated.
+  */
+  inline void ParallelContext::SetGrainSize(size_t grain)
+  {
+    GetGrainSizeRef() = max(grain, size_t(1));
+  }
+
+
+  //! Returns the number of threads for a loop.
+  /*!
+    \param[in] nb_iteration number of iterations of the loop.
+    \param[in] grain minimal number of iterations per thread (0 for the
+    value of GetGrainSize).
+    \return Number of threads to use, at least 1. The loop is sequential
+    inside a parallel region with policy NESTED_SEQUENTIAL, or without
+    OpenMP. Outside of a parallel region, the threads already used by the
+    loops of other threads (see ReserveThreads) are not counted.
+  */
+  inline int ParallelContext::GetNumThreads(size_t nb_iteration, size_t grain)
+  {
+#ifdef _OPENMP
+    int nb_threads = GetNumThreads();
+    if (omp_in_parallel())
+      {
+	if (GetNestedPolicy() == NESTED_SEQUENTIAL)
+	  return 1;
+
+	// threads are shared between the threads of the enclosing region
+	nb_threads = max(1, nb_threads / omp_get_num_threads());
+      }
+    else
+      nb_threads = max(1, nb_threads - GetBusyThreads());
+#else
+    int nb_threads = 1;
+#endif
+
+    if (grain == 0)
+      grain = GetGrainSize();
+
+    if (size_t(nb_threads) > nb_iteration / grain)
+      nb_threads = max(int(nb_iteration / grain), 1);
+
+    return nb_threads;
+  }
+
+
+  //! Returns the number of threads used by the running parallel loops.
+  inline int ParallelContext::GetBusyThreads()
+  {
+    int nb_busy;
+#ifdef _OPENMP
+#pragma omp atomic read
+#endif
+    nb_busy = GetBusyThreadsRef();
+    return nb_busy;
+  }
+
+
+  //! Reserves threads for a parallel loop.
+  /*!
+    \param[in] nb_threads number of threads requested.
+    \return Number of threads reserved, at most \a nb_threads and at least
+    1. The threads already reserved by the loops of other threads are not
+    given again, so that loops started concurrently by several threads do
+    not use more threads than GetNumThreads(). The threads must be given
+    back with ReleaseThreads. Inside a parallel region, nothing is reserved
+    since the threads are shared by GetNumThreads(nb_iteration, grain).
+  */
+  inline int ParallelContext::ReserveThreads(int nb_threads)
+  {
+    if (InParallel())
+      return nb_threads;
+
+    int& nb_busy = GetBusyThreadsRef();
+    int nb_previous;
+#ifdef _OPENMP
+#pragma omp atomic capture
+#endif
+    {
+      nb_previous = nb_busy;
+      nb_busy += nb_threads;
+    }
+
+    int nb_available = max(1, GetNumThreads() - nb_previous);
+    if (nb_threads > nb_available)
+      {
+	ReleaseThreads(nb_threads - nb_available);
+	nb_threads = nb_available;
+      }
+
+    return nb_threads;
+  }
+
+
+  //! Gives back threads reserved by ReserveThreads.
+  inline void ParallelContext::ReleaseThreads(int nb_threads)
+  {
+    if (InParallel())
+      return;
+
+    int& nb_busy = GetBusyThreadsRef();
+#ifdef _OPENMP
+#pragma omp atomic
+#endif
+    nb_busy -= nb_threads;
+  }
+
+
+  //! Returns true if the caller is inside an active parallel region.
+  inline bool ParallelContext::InParallel()
+  {
+#ifdef _OPENMP
+    return omp_in_parallel();
+#else
+    return false;
+#endif
+  }
+
+
+  //! Returns the number of the calling thread in its team.
+  inline int ParallelContext::GetThreadNumber()
+  {
+#ifdef _OPENMP
+    return omp_get_thread_num();
+#else
+    return 0;
+#endif
+  }
+
+
+  //! Splits [begin, end) into nb_block contiguous blocks.
+  /*!
+    \param[in] begin first iteration.
+    \param[in] end iteration after the last one.
+    \param[in] nb_block number of blocks.
+    \param[in] num block number.
+    \param[out] block_begin first iteration of block \a num.
+    \param[out] block_end iteration after the last one of block \a num.
+    The sizes of the blocks differ by one at most.
+  */
+  inline void ParallelContext::GetBlock(size_t begin, size_t end,
+					int nb_block, int num,
+					size_t& block_begin,
+					size_t& block_end)
+  {
+    size_t n = end - begin, size = n / nb_block, rest = n % nb_block;
+    block_begin = begin + num * size + min(size_t(num), rest);
+    block_end = block_begin + size + (size_t(num) < rest ? 1 : 0);
+  }
+
+
+  //! Binds each thread to a core.
+  /*!
+    The thread number t of the parallel loops is bound to the t-th core
+    on which the process may run (so that the binding of MPI processes is
+    respected). The OpenMP runtime is expected to reuse the same threads
+    for the following parallel regions, which is the case of the usual
+    implementations. Environment variables OMP_PROC_BIND and OMP_PLACES
+    are an alternative to this function.
+    \return true if the threads have been bound, false if it is not
+    supported.
+  */
+  inline bool ParallelContext::PinThreads()
+  {
+#if defined(_OPENMP) && defined(__linux__)
+    cpu_set_t mask;
+    if (sched_getaffinity(0, sizeof(mask), &mask) != 0)
+      return false;
+
+    vector<int> core;
+    for (int i = 0; i < CPU_SETSIZE; i++)
+      if (CPU_ISSET(i, &mask))
+	core.push_back(i);
+
+    if (core.empty())
+      return false;
+
+    bool success = true;
+#pragma omp parallel num_threads(GetNumThreads()) reduction(&&: success)
+    {
+      cpu_set_t thread_mask;
+      CPU_ZERO(&thread_mask);
+      CPU_SET(core[omp_get_thread_num() % core.size()], &thread_mask);
+      success = (sched_setaffinity(0, sizeof(thread_mask),
+				   &thread_mask) == 0);
+    }
+
+    return success;
+#else
+    return false;
+#endif
+  }
+
+
+  //! Returns true if the reductions do not depend on the parallelism.
+  inline bool ParallelContext::IsDeterministic()
+  {
+    return GetDeterministicRef();
+  }
+
+
+  //! Enables or disables the deterministic reductions.
+  /*!
+    \param[in] deterministic if true, DotProd, DotProdConj and Norm2 return
+    the same result, to the last bit, whatever the number of threads, the
+    number of MPI processes and the SIMD instruction set. They are then
+    computed by a reproducible summation, slower than the usual one. By
+    default, the reductions are deterministic if the environment variable
+    SELDON_DETERMINISTIC is set to a positive value.
+  */
+  inline void ParallelContext::SetDeterministic(bool deterministic)
+  {
+    GetDeterministicRef() = deterministic;
+  }
+
+
+  inline int& ParallelContext::GetNumThreadsRef()
+  {
+    static int nb_threads = GetDefaultNumThreads();
+    return nb_threads;
+  }
+
+
+  inline int& ParallelContext::GetNestedPolicyRef()
+  {
+    static int policy = NESTED_SEQUENTIAL;
+    return policy;
+  }
+
+
+  inline size_t& ParallelContext::GetGrainSizeRef()
+  {
+    static size_t grain = 4096;
+    return grain;
+  }
+
+
+  inline bool& ParallelContext::GetDeterministicRef()
+  {
+    static const char* value = getenv("SELDON_DETERMINISTIC");
+    static bool deterministic = (value != NULL) && (atoi(value) > 0);
+    return deterministic;
+  }
+
+
+  inline int& ParallelContext::GetBusyThreadsRef()
+  {
+    static int nb_busy = 0;
+    return nb_busy;
+  }
+
+
+  ///////////////////
+  // PARALLELERROR //
+  ///////////////////
+
+
+  //! Constructor, no exception has been caught.
+  /*!
+    \param[in] function name of the function with the parallel region,
+    used for the Error thrown without C++11.
+  */
+  inline ParallelError::ParallelError(string function)
+    : function_(function)
+  {
+    failed_ = false;
+  }
+
+
+  //! Stores the exception being handled.
+  /*!
+    This method must be called in a catch block, by any thread of the
+    parallel region. Only the first exception is kept.
+  */
+  inline void ParallelError::Catch()
+  {
+#ifdef SELDON_WITH_CPP11
+#ifdef _OPENMP
+#pragma omp critical(seldon_parallel_error)
+#endif
+    if (!failed_)
+      {
+	failed_ = true;
+	error_ = std::current_exception();
+      }
+#else
+    string message;
+    try
+      {
+	throw;
+      }
+    catch (Error& err)
+      {
+	message = err.What();
+      }
+    catch (std::exception& err)
+      {
+	message = err.what();
+      }
+    catch (...)
+      {
+	message = "An exception has been thrown by a thread.";
+      }
+
+#ifdef _OPENMP
+#pragma omp critical(seldon_parallel_error)
+#endif
+    if (!failed_)
+      {
+	failed_ = true;
+	message_ = message;
+      }
+#endif
+  }
+
+
+  //! Throws again the exception stored by Catch, if any.
+  inline void ParallelError::Rethrow() const
+  {
+    if (!failed_)
+      return;
+
+#ifdef SELDON_WITH_CPP11
+    std::rethrow_exception(error_);
+#else
+    throw Error(function_, message_);
+#endif
+  }
+
+
+} // namespace Seldon.
+
+#define SELDON_FILE_PARALLEL_INLINE_CXX
+#endif
@@ -0,0 +1,205 @@
+// Copyright (C) 2016 INRIA
+//
+// This file is part of the linear-algebra library Seldon,
+// http://seldon.sourceforge.net/.
+//
+// Seldon is free software; you can redistribute it and/or modify it under the
+// terms of the GNU Lesser General Public License as published by the Free
+// Software Foundation; either version 2.1 of the License, or (at your option)
+// any later version.
+//
+// Seldon is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for
+// more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with Seldon. If not, see http://www.gnu.org/licenses/.
+
+
+#ifndef SELDON_FILE_PROFILER_HXX
+
+#include <map>
+
+// Profiled regions of Seldon. Without SELDON_WITH_PROFILER, these macros
+// are empty and their arguments are not evaluated.
+#ifdef SELDON_WITH_PROFILER
+#define SELDON_PROFILE(name)                            \
+  Seldon::ProfilerScope seldon_profiler_scope(name)
+#define SELDON_PROFILE_SOLVE(name)                      \
+  Seldon::ProfilerScope seldon_profiler_scope(name, true)
+#define SELDON_PROFILE_COUNT(flops, bytes)              \
+  seldon_profiler_scope.AddCount(flops, bytes)
+#else
+#define SELDON_PROFILE(name) ((void) 0)
+#define SELDON_PROFILE_SOLVE(name) ((void) 0)
+#define SELDON_PROFILE_COUNT(flops, bytes) ((void) 0)
+#endif
+
+namespace Seldon
+{
+
+
+  ////////////////////
+  // PROFILERREGION //
+  ////////////////////
+
+
+  //! Statistics accumulated for a profiled region.
+  class ProfilerRegion
+  {
+  public:
+    //! number of calls
+    size_t nb_call;
+    //! total wall-clock time (in seconds)
+    double time;
+    //! number of floating-point operations
+    double flops;
+    //! number of bytes read, written or sent
+    double bytes;
+
+    ProfilerRegion();
+  };
+
+
+  //! Call of a profiled region, displayed in the timeline.
+  class ProfilerEvent
+  {
+  public:
+    //! name of the region
+    const char* name;
+    //! thread number
+    int thread;
+    //! beginning of the call (in seconds, since the profiler was enabled)
+    double start;
+    //! duration of the call (in seconds)
+    double duration;
+    //! number of floating-point operations
+    double flops;
+    //! number of bytes read, written or sent
+    double bytes;
+  };
+
+
+  //////////////
+  // PROFILER //
+  //////////////
+
+
+  //! Timers and counters of the hot paths of Seldon.
+  /*!
+    The main functions of Seldon (sparse matrix-vector products,
+    preconditioners, orthogonalization of Gmres and Gcr, phases of the
+    direct solvers, MPI exchanges of distributed matrices, allocations) are
+    profiled when Seldon is compiled with SELDON_WITH_PROFILER. Profiling is
+    then disabled until Enable is called, a disabled region only costs a
+    test. Each region counts its calls, wall-clock time, floating-point
+    operations and bytes moved. Regions may be nested, the time of a region
+    includes the time of the regions it calls. Example:
+    \code
+    Profiler::Enable(true);
+    Gmres(A, x, b, prec, iter);
+    Profiler::WriteReport(cout);
+    Profiler::WriteTrace("gmres.json");
+    Profiler::Clear();
+    \endcode
+    The trace can be displayed with chrome://tracing or Perfetto. With
+    EnableReport, a report is also written at the end of each solve
+    (iterative solver, factorisation or solution of a direct solver), with
+    the statistics of this solve only.
+  */
+  class Profiler
+  {
+  public:
+    static bool IsEnabled();
+    static bool IsTraceEnabled();
+    static void Enable(bool trace = false);
+    static void Disable();
+    static void Clear();
+
+    static void EnableReport(ostream& out = cout);
+    static void DisableReport();
+
+    static size_t GetMaxNbEvent();
+    static void SetMaxNbEvent(size_t nb_event);
+
+    static double GetWallTime();
+    static void AddRegion(const char* name, double start, double end,
+                          double flops = 0., double bytes = 0.);
+
+    static size_t GetNbCall(const string& name);
+    static double GetTime(const string& name);
+    static double GetFlops(const string& name);
+    static double GetBytes(const string& name);
+
+    static void WriteReport(ostream& out = cout);
+    static void WriteTrace(const string& file_name);
+    static void WriteTrace(ostream& out);
+
+  private:
+    static void WriteReport(ostream& out,
+                            const std::map<string, ProfilerRegion>& previous);
+    static bool& GetEnabledRef();
+    static bool& GetTraceEnabledRef();
+    static double& GetOriginRef();
+    static size_t& GetMaxNbEventRef();
+    static ostream*& GetReportRef();
+    static int& GetSolveDepthRef();
+    static std::map<string, ProfilerRegion>& GetRegion();
+    static std::vector<ProfilerEvent>& GetEvent();
+    static ProfilerRegion FindRegion(const string& name);
+    static string EscapeName(const string& name);
+
+    friend class ProfilerScope;
+  };
+
+
+  ///////////////////
+  // PROFILERSCOPE //
+  ///////////////////
+
+
+  //! Profiles the scope where it is declared.
+  /*!
+    The region starts with the constructor and ends with the destructor. The
+    name must be a string with static storage (usually a literal), it is
+    stored as a pointer. This class is used through the macros
+    SELDON_PROFILE, SELDON_PROFILE_SOLVE (for a complete solve, reported
+    by Profiler::EnableReport) and SELDON_PROFILE_COUNT:
+    \code
+    SELDON_PROFILE("MltVector(RowSparse)");
+    SELDON_PROFILE_COUNT(2. * nnz, nnz * (sizeof(T) + sizeof(size_t)));
+    \endcode
+  */
+  class ProfilerScope
+  {
+  protected:
+    //! name of the region (NULL if the profiler is disabled)
+    const char* name_;
+    //! beginning of the region
+    double start_;
+    //! number of floating-point operations
+    double flops_;
+    //! number of bytes moved
+    double bytes_;
+    //! true if the region is a solve
+    bool solve_;
+    //! statistics before the solve, for the report (NULL if not reported)
+    std::map<string, ProfilerRegion>* previous_;
+
+  public:
+    explicit ProfilerScope(const char* name, bool solve = false);
+    ~ProfilerScope();
+
+    void AddCount(double flops, double bytes);
+
+  private:
+    ProfilerScope(const ProfilerScope&);
+    ProfilerScope& operator=(const ProfilerScope&);
+  };
+
+
+} // namespace Seldon.
+
+#define SELDON_FILE_PROFILER_HXX
+#endif
@@ -0,0 +1,551 @@
+// Copyright (C) 2016 INRIA
+//
+// This file is part of the linear-algebra library Seldon,
+// http://seldon.sourceforge.net/.
+//
+// Seldon is free software; you can redistribute it and/or modify it under the
+// terms of the GNU Lesser General Public License as published by the Free
+// Software Foundation; either version 2.1 of the License, or (at your option)
+// any later version.
+//
+// Seldon is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for
+// more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with Seldon. If not, see http://www.gnu.org/licenses/.
+
+
+#ifndef SELDON_FILE_PROFILER_INLINE_CXX
+
+#include "Profiler.hxx"
+
+#include <iomanip>
+
+#if !defined(_OPENMP) && (defined(__unix__) || defined(__APPLE__))
+#include <sys/time.h>
+#endif
+
+namespace Seldon
+{
+
+
+  ////////////////////
+  // PROFILERREGION //
+  ////////////////////
+
+
+  //! Default constructor.
+  inline ProfilerRegion::ProfilerRegion()
+  {
+    nb_call = 0;
+    time = 0.;
+    flops = 0.;
+    bytes = 0.;
+  }
+
+
+  //////////////
+  // PROFILER //
+  //////////////
+
+
+  //! Returns true if the profiled regions are recorded.
+  inline bool Profiler::IsEnabled()
+  {
+    return GetEnabledRef();
+  }
+
+
+  //! Returns true if the calls are stored for the timeline.
+  inline bool Profiler::IsTraceEnabled()
+  {
+    return GetTraceEnabledRef();
+  }
+
+
+  //! Starts recording the profiled regions.
+  /*!
+    \param[in] trace if true, each call is also stored for the timeline
+    written by WriteTrace.
+    Previous statistics are kept, Clear must be called to reset them.
+  */
+  inline void Profiler::Enable(bool trace)
+  {
+    if (GetRegion().empty())
+      GetOriginRef() = GetWallTime();
+
+    GetEnabledRef() = true;
+    GetTraceEnabledRef() = trace;
+  }
+
+
+  //! Stops recording the profiled regions.
+  /*!
+    Statistics are kept, so that they can be written afterwards.
+  */
+  inline void Profiler::Disable()
+  {
+    GetEnabledRef() = false;
+    GetTraceEnabledRef() = false;
+  }
+
+
+  //! Clears the statistics and the timeline.
+  inline void Profiler::Clear()
+  {
+#ifdef _OPENMP
+#pragma omp critical(seldon_profiler)
+#endif
+    {
+      GetRegion().clear();
+      std::vector<ProfilerEvent>().swap(GetEvent());
+      GetOriginRef() = GetWallTime();
+    }
+  }
+
+
+  //! Writes a report at the end of each solve.
+  /*!
+    \param[in] out stream where the reports are written.
+    The report of a solve contains the statistics of the regions called
+    during this solve. Solves called by another solve (for example the
+    factorisation of a preconditioner) are only reported within the
+    outermost solve.
+  */
+  inline void Profiler::EnableReport(ostream& out)
+  {
+    GetReportRef() = &out;
+  }
+
+
+  //! No report is written at the end of each solve.
+  inline void Profiler::DisableReport()
+  {
+    GetReportRef() = NULL;
+  }
+
+
+  //! Returns the maximal number of calls stored for the timeline.
+  inline size_t Profiler::GetMaxNbEvent()
+  {
+    return GetMaxNbEventRef();
+  }
+
+
+  //! Sets the maximal number of calls stored for the timeline.
+  /*!
+    Once this number is reached, the following calls are only counted in
+    the statistics. The default value is 10^6.
+  */
+  inline void Profiler::SetMaxNbEvent(size_t nb_event)
+  {
+    GetMaxNbEventRef() = nb_event;
+  }
+
+
+  //! Returns the wall-clock time in seconds.
+  inline double Profiler::GetWallTime()
+  {
+#ifdef _OPENMP
+    return omp_get_wtime();
+#elif defined(__unix__) || defined(__APPLE__)
+    // clock() would not count the time spent waiting for MPI messages
+    timeval t;
+    gettimeofday(&t, NULL);
+    return double(t.tv_sec) + 1e-6 * double(t.tv_usec);
+#else
+    return double(clock()) / CLOCKS_PER_SEC;
+#endif
+  }
+
+
+  //! Records a call of a region.
+  /*!
+    \param[in] name name of the region, with static storage.
+    \param[in] start beginning of the call (given by GetWallTime).
+    \param[in] end end of the call (given by GetWallTime).
+    \param[in] flops number of floating-point operations.
+    \param[in] bytes number of bytes moved.
+    This function may be called by several threads.
+  */
+  inline void Profiler::AddRegion(const char* name, double start, double end,
+                                  double flops, double bytes)
+  {
+#ifdef _OPENMP
+#pragma omp critical(seldon_profiler)
+#endif
+    {
+      ProfilerRegion& region = GetRegion()[name];
+      region.nb_call++;
+      region.time += end - start;
+      region.flops += flops;
+      region.bytes += bytes;
+
+      std::vector<ProfilerEvent>& event = GetEvent();
+      if (IsTraceEnabled() && (event.size() < GetMaxNbEvent()))
+        {
+          ProfilerEvent call;
+          call.name = name;
+          call.thread = ParallelContext::GetThreadNumber();
+          call.start = start - GetOriginRef();
+          call.duration = end - start;
+          call.flops = flops;
+          call.bytes = bytes;
+          event.push_back(call);
+        }
+    }
+  }
+
+
+  //! Returns the number of calls of a region.
+  inline size_t Profiler::GetNbCall(const string& name)
+  {
+    return FindRegion(name).nb_call;
+  }
+
+
+  //! Returns the time (in seconds) spent in a region.
+  inline double Profiler::GetTime(const string& name)
+  {
+    return FindRegion(name).time;
+  }
+
+
+  //! Returns the number of floating-point operations of a region.
+  inline double Profiler::GetFlops(const string& name)
+  {
+    return FindRegion(name).flops;
+  }
+
+
+  //! Returns the number of bytes moved by a region.
+  inline double Profiler::GetBytes(const string& name)
+  {
+    return FindRegion(name).bytes;
+  }
+
+
+  //! Writes the statistics of each region, sorted by decreasing time.
+  /*!
+    For each region, the number of calls, the total and average times, and
+    the rates of floating-point operations and bytes moved are displayed.
+    With MPI, each process writes its own statistics.
+  */
+  inline void Profiler::WriteReport(ostream& out)
+  {
+    WriteReport(out, std::map<string, ProfilerRegion>());
+  }
+
+
+  //! Writes the statistics of the regions since a previous state.
+  /*!
+    \param[in] out output stream.
+    \param[in] previous statistics subtracted from the current ones.
+  */
+  inline void Profiler::WriteReport(ostream& out,
+                                    const std::map<string, ProfilerRegion>&
+                                    previous)
+  {
+    std::map<string, ProfilerRegion> region = GetRegion();
+    std::vector<std::pair<double, string> > sorted;
+    size_t width = 8;
+    for (std::map<string, ProfilerRegion>::iterator it = region.begin();
+         it != region.end(); ++it)
+      {
+        std::map<string, ProfilerRegion>::const_iterator prev
+          = previous.find(it->first);
+        if (prev != previous.end())
+          {
+            it->second.nb_call -= prev->second.nb_call;
+            it->second.time -= prev->second.time;
+            it->second.flops -= prev->second.flops;
+            it->second.bytes -= prev->second.bytes;
+          }
+
+        if (it->second.nb_call > 0)
+          {
+            sorted.push_back(std::make_pair(-it->second.time, it->first));
+            width = max(width, it->first.size());
+          }
+      }
+
+    std::sort(sorted.begin(), sorted.end());
+
+    std::ios::fmtflags flags = out.flags();
+    std::streamsize precision = out.precision();
+    out << std::left << setw(width + 2) << "Region" << std::right
+        << setw(10) << "Calls" << setw(14) << "Time (s)"
+        << setw(14) << "Average (s)" << setw(12) << "GFlop/s"
+        << setw(12) << "GB/s" << endl;
+
+    out.setf(std::ios::scientific, std::ios::floatfield);
+    out.precision(3);
+    for (size_t k = 0; k < sorted.size(); k++)
+      {
+        const ProfilerRegion& stat = region[sorted[k].second];
+        out << std::left << setw(width + 2) << sorted[k].second << std::right
+            << setw(10) << stat.nb_call << setw(14) << stat.time
+            << setw(14) << stat.time / stat.nb_call;
+
+        for (int j = 0; j < 2; j++)
+          {
+            double value = (j == 0) ? stat.flops : stat.bytes;
+            if ((value > 0.) && (stat.time > 0.))
+              out << setw(12) << 1e-9 * value / stat.time;
+            else
+              out << setw(12) << "-";
+          }
+
+        out << endl;
+      }
+
+    out.flags(flags);
+    out.precision(precision);
+  }
+
+
+  //! Writes the timeline in a file, in the Chrome trace format.
+  /*!
+    The file can be displayed with chrome://tracing or Perfetto. With MPI,
+    each process should give a different file name.
+  */
+  inline void Profiler::WriteTrace(const string& file_name)
+  {
+    ofstream file_out(file_name.c_str());
+
+#ifdef SELDON_CHECK_IO
+    if (!file_out.is_open())
+      throw IOError("Profiler::WriteTrace(string)",
+                    string("Unable to open file \"") + file_name + "\".");
+#endif
+
+    WriteTrace(file_out);
+  }
+
+
+  //! Writes the timeline in the Chrome trace format (JSON).
+  /*!
+    Each call is a complete event ("ph": "X") whose process is the MPI rank
+    and whose thread is the OpenMP thread. Times are in microseconds.
+  */
+  inline void Profiler::WriteTrace(ostream& out)
+  {
+    int rank = 0;
+#ifdef SELDON_WITH_MPI
+    if (MPI::Is_initialized())
+      rank = MPI::COMM_WORLD.Get_rank();
+#endif
+
+    std::ios::fmtflags flags = out.flags();
+    std::streamsize precision = out.precision();
+    out.setf(std::ios::fixed, std::ios::floatfield);
+    out.precision(3);
+
+    out << "{\"traceEvents\": [" << endl;
+    out << "{\"name\": \"process_name\", \"ph\": \"M\", \"pid\": " << rank
+        << ", \"args\": {\"name\": \"Seldon " << rank << "\"}}";
+
+    std::vector<ProfilerEvent>& event = GetEvent();
+    for (size_t k = 0; k < event.size(); k++)
+      {
+        out << "," << endl << "{\"name\": \"" << EscapeName(event[k].name)
+            << "\", \"cat\": \"seldon\", \"ph\": \"X\", \"pid\": " << rank
+            << ", \"tid\": " << event[k].thread
+            << ", \"ts\": " << 1e6 * event[k].start
+            << ", \"dur\": " << 1e6 * event[k].duration;
+
+        if ((event[k].flops > 0.) || (event[k].bytes > 0.))
+          out << ", \"args\": {\"flops\": " << event[k].flops
+              << ", \"bytes\": " << event[k].bytes << "}";
+
+        out << "}";
+      }
+
+    out << endl << "], \"displayTimeUnit\": \"ms\"}" << endl;
+
+    out.flags(flags);
+    out.precision(precision);
+  }
+
+
+  //! Returns the flag telling whether the profiler is enabled.
+  inline bool& Profiler::GetEnabledRef()
+  {
+    static bool enabled = false;
+    return enabled;
+  }
+
+
+  //! Returns the flag telling whether the calls are stored.
+  inline bool& Profiler::GetTraceEnabledRef()
+  {
+    static bool trace = false;
+    return trace;
+  }
+
+
+  //! Returns the time origin of the timeline.
+  inline double& Profiler::GetOriginRef()
+  {
+    static double origin = 0.;
+    return origin;
+  }
+
+
+  //! Returns the maximal number of stored calls.
+  inline size_t& Profiler::GetMaxNbEventRef()
+  {
+    static size_t nb_event = 1000000;
+    return nb_event;
+  }
+
+
+  //! Returns the stream of the reports (NULL if disabled).
+  inline ostream*& Profiler::GetReportRef()
+  {
+    static ostream* out = NULL;
+    return out;
+  }
+
+
+  //! Returns the number of active solves.
+  inline int& Profiler::GetSolveDepthRef()
+  {
+    static int depth = 0;
+    return depth;
+  }
+
+
+  //! Returns the statistics of all regions.
+  /*!
+    The map is never destroyed, so that regions can be recorded by static
+    objects at exit.
+  */
+  inline std::map<string, ProfilerRegion>& Profiler::GetRegion()
+  {
+    static std::map<string, ProfilerRegion>* region
+      = new std::map<string, ProfilerRegion>();
+    return *region;
+  }
+
+
+  //! Returns the calls stored for the timeline.
+  inline std::vector<ProfilerEvent>& Profiler::GetEvent()
+  {
+    static std::vector<ProfilerEvent>* event
+      = new std::vector<ProfilerEvent>();
+    return *event;
+  }
+
+
+  //! Returns the statistics of a region (zero if it has not been called).
+  inline ProfilerRegion Profiler::FindRegion(const string& name)
+  {
+    std::map<string, ProfilerRegion>::const_iterator it
+      = GetRegion().find(name);
+    if (it == GetRegion().end())
+      return ProfilerRegion();
+
+    return it->second;
+  }
+
+
+  //! Escapes quotes and backslashes for JSON.
+  inline string Profiler::EscapeName(const string& name)
+  {
+    string escaped;
+    for (size_t i = 0; i < name.size(); i++)
+      {
+        if ((name[i] == '"') || (name[i] == '\\'))
+          escaped += '\\';
+
+        escaped += name[i];
+      }
+
+    return escaped;
+  }
+
+
+  ///////////////////
+  // PROFILERSCOPE //
+  ///////////////////
+
+
+  //! Starts the region if the profiler is enabled.
+  /*!
+    \param[in] name name of the region, with static storage.
+    \param[in] solve true if the region is a complete solve, reported when
+    Profiler::EnableReport has been called.
+  */
+  inline ProfilerScope::ProfilerScope(const char* name, bool solve)
+  {
+    name_ = NULL;
+    start_ = 0.;
+    flops_ = 0.;
+    bytes_ = 0.;
+    solve_ = false;
+    previous_ = NULL;
+    if (!Profiler::IsEnabled())
+      return;
+
+    name_ = name;
+    if (solve && (Profiler::GetReportRef() != NULL)
+        && !ParallelContext::InParallel())
+      {
+        solve_ = true;
+        if (Profiler::GetSolveDepthRef() == 0)
+          {
+#ifdef _OPENMP
+#pragma omp critical(seldon_profiler)
+#endif
+            previous_ = new std::map<string, ProfilerRegion>
+              (Profiler::GetRegion());
+          }
+
+        Profiler::GetSolveDepthRef()++;
+      }
+
+    start_ = Profiler::GetWallTime();
+  }
+
+
+  //! Ends the region, and writes the report of a solve.
+  inline ProfilerScope::~ProfilerScope()
+  {
+    if (name_ == NULL)
+      return;
+
+    Profiler::AddRegion(name_, start_, Profiler::GetWallTime(),
+                        flops_, bytes_);
+
+    if (solve_)
+      Profiler::GetSolveDepthRef()--;
+
+    if (previous_ != NULL)
+      {
+        if (Profiler::GetReportRef() != NULL)
+          {
+            ostream& out = *Profiler::GetReportRef();
+            out << "Profile of " << name_ << ":" << endl;
+            Profiler::WriteReport(out, *previous_);
+          }
+
+        delete previous_;
+      }
+  }
+
+
+  //! Adds floating-point operations and bytes moved to the region.
+  inline void ProfilerScope::AddCount(double flops, double bytes)
+  {
+    flops_ += flops;
+    bytes_ += bytes;
+  }
+
+
+} // namespace Seldon.
+
+#define SELDON_FILE_PROFILER_INLINE_CXX
+#endif
@@ -357,6 +357,16 @@ namespace Seldon
   };
 
 
+  //! Storage of a strided view on a contiguous block of a dense matrix.
+  /*!
+    \tparam Storage storage of the viewed matrix (ColMajor or RowMajor).
+  */
+  template <class Storage>
+  class StridedSubStorage: public Storage
+  {
+  };
+
+
   ///////////
   // TYPES //
   ///////////
@@ -0,0 +1,131 @@
+#define SELDON_DEBUG_LEVEL_0
+
+#include <ctime>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include "Seldon.hxx"
+using namespace Seldon;
+
+
+//! Returns the elapsed time in seconds.
+double GetWallTime()
+{
+#ifdef _OPENMP
+  return omp_get_wtime();
+#else
+  return double(clock()) / CLOCKS_PER_SEC;
+#endif
+}
+
+
+//! Sparse matrix-vector product y = A x, rows distributed statically.
+template<class Allocator>
+void MltParallel(const Matrix<double, General, RowSparse, Allocator>& A,
+                 const Vector<double, VectFull, Allocator>& x,
+                 Vector<double, VectFull, Allocator>& y)
+{
+  long m = A.GetM();
+  const size_t* ptr = A.GetPtr();
+  const size_t* ind = A.GetInd();
+  const double* val = A.GetData();
+  const double* xp = x.GetData();
+  double* yp = y.GetData();
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+  for (long i = 0; i < m; i++)
+    {
+      double sum = 0;
+      for (size_t k = ptr[i]; k < ptr[i+1]; k++)
+        sum += val[k] * xp[ind[k]];
+
+      yp[i] = sum;
+    }
+}
+
+
+//! Measures the bandwidth of the sparse matrix-vector product.
+/*!
+  The matrix has \a nb_band non-zero entries per row (band matrix).
+*/
+template<class Allocator>
+void BenchmarkSpMV(const string& name, long m, int nb_band, int nb_loop)
+{
+  double start, end;
+
+  start = GetWallTime();
+  size_t nnz = size_t(m) * nb_band;
+  Vector<double, VectFull, Allocator> values(nnz), x(m), y(m);
+  Vector<size_t> ptr(m+1), ind(nnz);
+
+  // values are initialized with the same static distribution as the product
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+  for (long i = 0; i < m; i++)
+    {
+      long jmin = max(0L, min(i - nb_band/2, m - nb_band));
+      for (int k = 0; k < nb_band; k++)
+        {
+          ind(i*nb_band + k) = jmin + k;
+          values(i*nb_band + k) = 1.0 / (1.0 + k);
+        }
+
+      ptr(i) = i*nb_band;
+      x(i) = 1.0;
+      y(i) = 0.0;
+    }
+  ptr(m) = nnz;
+
+  Matrix<double, General, RowSparse, Allocator> A;
+  A.SetData(m, m, values, ptr, ind);
+  end = GetWallTime();
+
+  cout << name << endl;
+  cout << "  Allocation: " << end - start << endl;
+
+  start = GetWallTime();
+  for (int l = 0; l < nb_loop; l++)
+    MltParallel(A, x, y);
+  end = GetWallTime();
+
+  // values, indices, and one read of x and y per row
+  double nb_bytes = double(nnz) * (sizeof(double) + sizeof(size_t))
+    + double(m) * (2*sizeof(double) + sizeof(size_t));
+  cout << "  SpMV:       " << (end - start) / nb_loop << " s, "
+       << nb_bytes * nb_loop / (end - start) / 1e9 << " GB/s" << endl;
+}
+
+
+int main(int argc, char *argv[])
+{
+  long m = 2000000;
+  int nb_band = 27, nb_loop = 20;
+  if (argc > 1)
+    m = atol(argv[1]);
+
+  cout << "Rows: " << m << ", non-zero entries: " << m * nb_band << endl;
+#ifdef _OPENMP
+  cout << "Threads: " << omp_get_max_threads() << endl;
+#endif
+
+  BenchmarkSpMV<MallocAlloc<double> >("MallocAlloc", m, nb_band, nb_loop);
+  BenchmarkSpMV<AlignedAlloc<double> >("AlignedAlloc", m, nb_band, nb_loop);
+  BenchmarkSpMV<HugePageAlloc<double> >("HugePageAlloc", m, nb_band,
+                                        nb_loop);
+  BenchmarkSpMV<NumaAlloc<double> >("NumaAlloc (first touch)", m, nb_band,
+                                    nb_loop);
+
+#ifdef SELDON_WITH_NUMA
+  AlignedMemory::SetNumaPolicy(AlignedMemory::INTERLEAVE);
+  BenchmarkSpMV<NumaAlloc<double> >("NumaAlloc (interleave)", m, nb_band,
+                                    nb_loop);
+  AlignedMemory::SetNumaPolicy(AlignedMemory::FIRST_TOUCH);
+#endif
+
+  return 0;
+}
@@ -0,0 +1,152 @@
+#define SELDON_DEBUG_LEVEL_0
+
+#include <ctime>
+
+#include "Seldon.hxx"
+using namespace Seldon;
+
+typedef Matrix<double, General, RowMajor> ElementMatrix;
+
+
+//! Element matrices stored as independent Seldon matrices.
+void BenchmarkMatrix(int nb, int n, int nb_loop)
+{
+  Vector<ElementMatrix, VectFull, NewAlloc<ElementMatrix> > A(nb), B(nb),
+    C(nb);
+  Vector<Vector<double>, VectFull, NewAlloc<Vector<double> > > x(nb);
+  clock_t start, end;
+
+  start = clock();
+  for (int k = 0; k < nb; k++)
+    {
+      A(k).Reallocate(n, n);
+      A(k).FillRand();
+      for (int i = 0; i < n; i++)
+	A(k)(i, i) += n*double(RAND_MAX);
+      B(k) = A(k);
+      C(k).Reallocate(n, n);
+      x(k).Reallocate(n);
+      x(k).FillRand();
+    }
+  end = clock();
+  cout << "  Allocation:  " << double(end - start) / CLOCKS_PER_SEC << endl;
+
+  start = clock();
+  for (int l = 0; l < nb_loop; l++)
+    for (int k = 0; k < nb; k++)
+      Mlt(A(k), B(k), C(k));
+  end = clock();
+  cout << "  Mlt:         " << double(end - start) / CLOCKS_PER_SEC << endl;
+
+  start = clock();
+  for (int l = 0; l < nb_loop; l++)
+    for (int k = 0; k < nb; k++)
+      {
+	C(k) = A(k);
+	GetLU(C(k));
+	SolveLU(C(k), x(k));
+      }
+  end = clock();
+  cout << "  GetLU+Solve: " << double(end - start) / CLOCKS_PER_SEC << endl;
+}
+
+
+//! Element matrices stored in a MatrixBatch.
+void BenchmarkBatch(int nb, int n, int nb_loop)
+{
+  MatrixBatch<double> A, B, C, x;
+  Vector<int> pivot;
+  clock_t start, end;
+
+  start = clock();
+  A.Reallocate(nb, n, n);
+  A.FillRand();
+  for (int k = 0; k < nb; k++)
+    for (int i = 0; i < n; i++)
+      A(k, i, i) += n*double(RAND_MAX);
+  B = A;
+  C.Reallocate(nb, n, n);
+  x.Reallocate(nb, n, 1);
+  x.FillRand();
+  end = clock();
+  cout << "  Allocation:  " << double(end - start) / CLOCKS_PER_SEC << endl;
+
+  start = clock();
+  for (int l = 0; l < nb_loop; l++)
+    Mlt(A, B, C);
+  end = clock();
+  cout << "  Mlt:         " << double(end - start) / CLOCKS_PER_SEC << endl;
+
+  start = clock();
+  for (int l = 0; l < nb_loop; l++)
+    {
+      C = A;
+      GetLU(C, pivot);
+      SolveLU(C, pivot, x);
+    }
+  end = clock();
+  cout << "  GetLU+Solve: " << double(end - start) / CLOCKS_PER_SEC << endl;
+}
+
+
+//! Element matrices stored as TinyMatrix.
+template<int n>
+void BenchmarkTiny(int nb, int nb_loop)
+{
+  Vector<TinyMatrix<double, n, n>, VectFull,
+	 NewAlloc<TinyMatrix<double, n, n> > > A(nb), C(nb);
+  Vector<TinyVector<double, n>, VectFull,
+	 NewAlloc<TinyVector<double, n> > > x(nb);
+  TinyVector<int, n> pivot;
+  clock_t start, end;
+
+  for (int k = 0; k < nb; k++)
+    {
+      A(k).FillRand();
+      for (int i = 0; i < n; i++)
+	A(k)(i, i) += n*double(RAND_MAX);
+      x(k).FillRand();
+    }
+
+  start = clock();
+  for (int l = 0; l < nb_loop; l++)
+    for (int k = 0; k < nb; k++)
+      Mlt(A(k), A(k), C(k));
+  end = clock();
+  cout << "  Mlt:         " << double(end - start) / CLOCKS_PER_SEC << endl;
+
+  start = clock();
+  for (int l = 0; l < nb_loop; l++)
+    for (int k = 0; k < nb; k++)
+      {
+	C(k) = A(k);
+	GetLU(C(k), pivot);
+	SolveLU(C(k), pivot, x(k));
+      }
+  end = clock();
+  cout << "  GetLU+Solve: " << double(end - start) / CLOCKS_PER_SEC << endl;
+}
+
+
+int main(int argc, char *argv[])
+{
+  int nb = 100000;
+  int nb_loop = 5;
+
+  cout << "* 8 x 8 element matrices (" << nb << " matrices)" << endl;
+  cout << "Matrix<General, RowMajor>:" << endl;
+  BenchmarkMatrix(nb, 8, nb_loop);
+  cout << "MatrixBatch:" << endl;
+  BenchmarkBatch(nb, 8, nb_loop);
+  cout << "TinyMatrix:" << endl;
+  BenchmarkTiny<8>(nb, nb_loop);
+
+  nb = 10000;
+  cout << "* 32 x 32 element matrices (" << nb << " matrices)" << endl;
+  cout << "Matrix<General, RowMajor>:" << endl;
+  BenchmarkMatrix(nb, 32, nb_loop);
+  cout << "MatrixBatch:" << endl;
+  BenchmarkBatch(nb, 32, nb_loop);
+
+  return 0;
+}
@@ -0,0 +1,129 @@
+#define SELDON_DEBUG_LEVEL_0
+
+#include <ctime>
+
+#include "Seldon.hxx"
+using namespace Seldon;
+
+
+//! Returns the wall-clock time in seconds.
+double GetWallTime()
+{
+#ifdef _OPENMP
+  return omp_get_wtime();
+#else
+  return double(clock()) / CLOCKS_PER_SEC;
+#endif
+}
+
+
+template<class T>
+void GetRandNumber(T& x)
+{
+  x = T(rand()) / RAND_MAX - T(0.5);
+}
+
+
+template<class T>
+void GetRandNumber(complex<T>& x)
+{
+  T a, b;
+  GetRandNumber(a);
+  GetRandNumber(b);
+  x = complex<T>(a, b);
+}
+
+
+//! Displays the time per element of the reductions, in nanoseconds.
+/*!
+  The reductions are computed with and without the deterministic mode of
+  ParallelContext, for each number of threads up to nb_thread.
+*/
+template<class T>
+void Benchmark(const string& type, size_t n, int nb_loop, int nb_thread)
+{
+  Vector<T> X(n), Y(n);
+  for (size_t i = 0; i < n; i++)
+    {
+      GetRandNumber(X(i));
+      GetRandNumber(Y(i));
+    }
+
+  T sum(0);
+  typename ClassComplexType<T>::Treal norm(0);
+  string name[3] = {"DotProd", "DotProdConj", "Norm2"};
+  double time[2][3];
+  double start;
+
+  cout << "* " << type << ", " << n << " elements (ns per element)" << endl;
+  cout << "  threads\t";
+  for (int k = 0; k < 3; k++)
+    cout << name[k] << "\t\t";
+  cout << endl;
+
+  for (int t = 1; t <= nb_thread; t++)
+    {
+      ParallelContext::SetNumThreads(t);
+      for (int d = 0; d < 2; d++)
+	{
+	  ParallelContext::SetDeterministic(d == 1);
+	  for (int k = 0; k < 3; k++)
+	    time[d][k] = 0.;
+
+	  for (int l = 0; l < nb_loop; l++)
+	    {
+	      start = GetWallTime();
+	      sum += DotProd(X, Y);
+	      time[d][0] += GetWallTime() - start;
+
+	      start = GetWallTime();
+	      sum += DotProdConj(X, Y);
+	      time[d][1] += GetWallTime() - start;
+
+	      start = GetWallTime();
+	      norm += Norm2(X);
+	      time[d][2] += GetWallTime() - start;
+	    }
+	}
+
+      // usual and deterministic times, and their ratio
+      cout << "  " << t << "\t\t";
+      for (int k = 0; k < 3; k++)
+	cout << 1e9 * time[0][k] / (nb_loop * n) << " / "
+	     << 1e9 * time[1][k] / (nb_loop * n) << " (x"
+	     << time[1][k] / max(time[0][k], 1e-9) << ")\t";
+      cout << endl;
+    }
+
+  ParallelContext::SetDeterministic(false);
+
+  // prevents the compiler from discarding the computations
+  if (sum == T(0) || norm == 0)
+    cout << "Unexpected zero result." << endl;
+}
+
+
+int main(int argc, char *argv[])
+{
+  size_t n = 1000000;
+  if (argc > 1)
+    n = atoi(argv[1]);
+
+  int nb_thread = ParallelContext::GetNumThreads();
+  if (argc > 2)
+    nb_thread = atoi(argv[2]);
+
+  int nb_loop = max(1, int(1e8 / max(n, size_t(1)) / nb_thread));
+
+  cout.precision(3);
+  cout << "Instruction set: "
+       << SimdInstructionSet::GetName(SimdInstructionSet::GetCurrent())
+       << endl;
+
+  Benchmark<float>("float", n, nb_loop, nb_thread);
+  Benchmark<double>("double", n, nb_loop, nb_thread);
+  Benchmark<complex<float> >("complex<float>", n, nb_loop, nb_thread);
+  Benchmark<complex<double> >("complex<double>", n, nb_loop, nb_thread);
+
+  return 0;
+}
@@ -0,0 +1,172 @@
+#define SELDON_DEBUG_LEVEL_0
+
+#include <ctime>
+
+#include "Seldon.hxx"
+#include "vector/Vector2.cxx"
+#include "vector/Vector3.cxx"
+#include "vector/PackedVector2.cxx"
+#include "vector/PackedVector3.cxx"
+using namespace Seldon;
+
+
+//! Returns the wall-clock time in seconds.
+double GetWallTime()
+{
+#ifdef _OPENMP
+  return omp_get_wtime();
+#else
+  return double(clock()) / CLOCKS_PER_SEC;
+#endif
+}
+
+
+//! Connectivity of a structured mesh: each node is linked to 4 to 8 nodes.
+class ConnectivityBuilder
+{
+public:
+  size_t Count(size_t i) const
+  {
+    return 4 + i % 5;
+  }
+
+  void Fill(size_t i, int* x) const
+  {
+    for (size_t j = 0; j < Count(i); j++)
+      x[j] = (i * 7 + j * 13) % 1000003;
+  }
+
+  //! Number of faces of element i, for the three-level structure.
+  size_t Count(size_t i, size_t j) const
+  {
+    return 3 + (i + j) % 2;
+  }
+
+  void Fill(size_t i, size_t j, int* x) const
+  {
+    for (size_t k = 0; k < Count(i, j); k++)
+      x[k] = (i * 7 + j * 13 + k) % 1000003;
+  }
+};
+
+
+//! Sums all values of a vector of vectors through operator()(i, j).
+template<class V2>
+long SumVector2(const V2& V)
+{
+  long sum = 0;
+  for (size_t i = 0; i < V.GetLength(); i++)
+    for (size_t j = 0; j < V.GetLength(i); j++)
+      sum += V(i, j);
+  return sum;
+}
+
+
+//! Sums all values of a vector of vectors of vectors.
+template<class V3>
+long SumVector3(const V3& V)
+{
+  long sum = 0;
+  for (size_t i = 0; i < V.GetLength(); i++)
+    for (size_t j = 0; j < V.GetLength(i); j++)
+      for (size_t k = 0; k < V.GetLength(i, j); k++)
+        sum += V(i, j, k);
+  return sum;
+}
+
+
+int main(int argc, char *argv[])
+{
+  size_t n = 2000000;
+  if (argc > 1)
+    n = atoi(argv[1]);
+
+  int nb_loop = 10;
+  ConnectivityBuilder builder;
+  double start, time_build, time_iter;
+  long sum = 0;
+
+#ifdef _OPENMP
+  cout << "Number of threads: " << omp_get_max_threads() << endl;
+#endif
+
+  cout << "* Vector2, " << n << " inner vectors" << endl;
+  {
+    start = GetWallTime();
+    Vector2<int> V(n);
+    for (size_t i = 0; i < n; i++)
+      {
+        V.Reallocate(i, builder.Count(i));
+        builder.Fill(i, V(i).GetData());
+      }
+    time_build = GetWallTime() - start;
+
+    start = GetWallTime();
+    for (int l = 0; l < nb_loop; l++)
+      sum += SumVector2(V);
+    time_iter = (GetWallTime() - start) / nb_loop;
+
+    cout << "  Vector2\t memory: " << V.GetMemorySize() / 1e6
+         << " MB (+ one allocation per inner vector)\tbuild: " << time_build
+         << " s\titeration: " << time_iter << " s" << endl;
+
+    start = GetWallTime();
+    PackedVector2<int> P;
+    P.Build(n, builder);
+    time_build = GetWallTime() - start;
+
+    start = GetWallTime();
+    for (int l = 0; l < nb_loop; l++)
+      sum -= SumVector2(P);
+    time_iter = (GetWallTime() - start) / nb_loop;
+
+    cout << "  PackedVector2\t memory: " << P.GetMemorySize() / 1e6
+         << " MB\tbuild: " << time_build << " s\titeration: " << time_iter
+         << " s" << endl;
+  }
+
+  cout << "* Vector3, " << n / 4 << " vectors of vectors" << endl;
+  {
+    size_t m = n / 4;
+    start = GetWallTime();
+    Vector3<int> V(m);
+    for (size_t i = 0; i < m; i++)
+      {
+        V.Reallocate(i, builder.Count(i));
+        for (size_t j = 0; j < builder.Count(i); j++)
+          {
+            V.Reallocate(i, j, builder.Count(i, j));
+            builder.Fill(i, j, V(i, j).GetData());
+          }
+      }
+    time_build = GetWallTime() - start;
+
+    start = GetWallTime();
+    for (int l = 0; l < nb_loop; l++)
+      sum += SumVector3(V);
+    time_iter = (GetWallTime() - start) / nb_loop;
+
+    cout << "  Vector3\t memory: " << V.GetMemorySize() / 1e6
+         << " MB (+ one allocation per inner vector)\tbuild: " << time_build
+         << " s\titeration: " << time_iter << " s" << endl;
+
+    start = GetWallTime();
+    PackedVector3<int> P;
+    P.Build(m, builder);
+    time_build = GetWallTime() - start;
+
+    start = GetWallTime();
+    for (int l = 0; l < nb_loop; l++)
+      sum -= SumVector3(P);
+    time_iter = (GetWallTime() - start) / nb_loop;
+
+    cout << "  PackedVector3\t memory: " << P.GetMemorySize() / 1e6
+         << " MB\tbuild: " << time_build << " s\titeration: " << time_iter
+         << " s" << endl;
+  }
+
+  if (sum != 0)
+    cout << "The packed and unpacked structures differ." << endl;
+
+  return 0;
+}
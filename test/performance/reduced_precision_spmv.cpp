@@ -0,0 +1,234 @@
+#define SELDON_DEBUG_LEVEL_0
+#define SELDON_WITH_PRECONDITIONING
+
+#include <ctime>
+
+#include "Seldon.hxx"
+#include "SeldonSolver.hxx"
+using namespace Seldon;
+
+
+//! Returns the wall-clock time in seconds.
+double GetWallTime()
+{
+#ifdef _OPENMP
+  return omp_get_wtime();
+#else
+  return double(clock()) / CLOCKS_PER_SEC;
+#endif
+}
+
+
+//! Test matrices on a m x m grid (or m x m x m for the 3-D Laplacian).
+/*!
+  type = 0 : 2-D Laplacian with a convection term (5 points)
+  type = 1 : 3-D Laplacian (7 points)
+  type = 2 : 2-D diffusion with coefficients between 1e-3 and 1e3
+*/
+void ConstructMatrix(int type, int m, Matrix<double, General, ArrayRowSparse>& A)
+{
+  int n = (type == 1) ? m*m*m : m*m;
+  A.Reallocate(n, n);
+  if (type == 1)
+    {
+      for (int i = 0; i < m; i++)
+	for (int j = 0; j < m; j++)
+	  for (int k = 0; k < m; k++)
+	    {
+	      int r = (i*m + j)*m + k;
+	      A.AddInteraction(r, r, 6.5);
+	      int stride[] = {1, m, m*m};
+	      int pos[] = {k, j, i};
+	      for (int d = 0; d < 3; d++)
+		{
+		  if (pos[d] > 0)
+		    A.AddInteraction(r, r - stride[d], -1.0);
+		  if (pos[d]+1 < m)
+		    A.AddInteraction(r, r + stride[d], -1.0);
+		}
+	    }
+
+      return;
+    }
+
+  // diffusion coefficients of the cells
+  Vector<double> coef(n);
+  for (int r = 0; r < n; r++)
+    coef(r) = (type == 2) ? pow(10., 6. * rand() / RAND_MAX - 3.) : 1.0;
+
+  for (int i = 0; i < m; i++)
+    for (int j = 0; j < m; j++)
+      {
+	int r = i*m + j;
+	int neighbor[] = {(j > 0) ? r-1 : -1, (j+1 < m) ? r+1 : -1,
+			  (i > 0) ? r-m : -1, (i+1 < m) ? r+m : -1};
+	double conv[] = {-0.3, 0.3, -0.2, 0.2};
+	double diag = 0.5 * coef(r);
+	for (int d = 0; d < 4; d++)
+	  if (neighbor[d] >= 0)
+	    {
+	      double c = 0.5 * (coef(r) + coef(neighbor[d]));
+	      if (type == 0)
+		c *= 1.0 + conv[d];
+
+	      A.AddInteraction(r, neighbor[d], -c);
+	      diag += c;
+	    }
+
+	A.AddInteraction(r, r, diag);
+      }
+}
+
+
+//! Relative difference between two vectors.
+double GetRelativeError(const Vector<double>& x, const Vector<double>& x_ref)
+{
+  Vector<double> diff(x);
+  Add(-1.0, x_ref, diff);
+  return Norm2(diff) / Norm2(x_ref);
+}
+
+
+//! Returns || b - A x || / || b ||.
+double GetResidual(const Matrix<double, General, RowSparse>& A,
+		   const Vector<double>& x, const Vector<double>& b)
+{
+  Vector<double> r(b);
+  MltAdd(-1.0, A, x, 1.0, r);
+  return Norm2(r) / Norm2(b);
+}
+
+
+//! Displays time and bandwidth of the product, and the errors.
+/*!
+  The product and 10 symmetric SOR sweeps are compared to the ones with
+  values in double precision, the residual is computed with A_ref.
+*/
+template<class MatrixSparse>
+void Benchmark(const string& name, const MatrixSparse& A,
+	       const Matrix<double, General, RowSparse>& A_ref,
+	       const Vector<double>& x, const Vector<double>& y_ref,
+	       const Vector<double>& x_sor_ref, const Vector<double>& b,
+	       double nb_bytes, int nb_loop)
+{
+  int n = x.GetM();
+  Vector<double> y(n);
+  double start = GetWallTime();
+  for (int l = 0; l < nb_loop; l++)
+    Mlt(A, x, y);
+
+  double time = (GetWallTime() - start) / nb_loop;
+
+  Vector<double> x_sor(n);
+  x_sor.Zero();
+  SorVector(A, x_sor, b, 1.0, 10, 2);
+
+  cout << "  " << name << "\t" << nb_bytes / A.GetDataSize() << "\t\t"
+       << 1e3 * time << "\t" << GetSparseProductBytes(A, x, y, false)
+    / time / 1e9 << "\t" << GetRelativeError(y, y_ref) << "\t"
+       << GetRelativeError(x_sor, x_sor_ref) << "\t"
+       << GetResidual(A_ref, x_sor, b) << endl;
+}
+
+
+//! Preconditioned iterations with factors in double and single precision.
+/*!
+  The iteration x <- x + M^{-1} (b - A x) uses the matrix in double
+  precision, so that only the preconditioner is affected by the rounding.
+*/
+void BenchmarkIlut(const Matrix<double, General, ArrayRowSparse>& A0,
+		   const Matrix<double, General, RowSparse>& A,
+		   const Vector<double>& b, int nb_iter)
+{
+  int n = b.GetM();
+  IVect perm(n);
+  perm.Fill();
+  for (int single = 0; single < 2; single++)
+    {
+      IlutPreconditioning<double> mat_lu;
+      mat_lu.SetFactorisationType(IlutPreconditioning<double>::ILU_0);
+      mat_lu.SetSinglePrecisionFactors(single == 1);
+      Matrix<double, General, ArrayRowSparse> B(A0);
+      mat_lu.FactorizeMatrix(perm, B);
+
+      Vector<double> x(n), r(n);
+      x.Zero();
+      double time = 0;
+      for (int k = 0; k < nb_iter; k++)
+	{
+	  r = b;
+	  MltAdd(-1.0, A, x, 1.0, r);
+	  double start = GetWallTime();
+	  mat_lu.Solve(r);
+	  time += GetWallTime() - start;
+	  Add(1.0, r, x);
+	}
+
+      cout << "  ILU(0) " << (single ? "single" : "double") << "\t"
+	   << mat_lu.GetMemorySize() / 1e6 << " MB\t" << 1e3 * time / nb_iter
+	   << " ms per solve\tresidual after " << nb_iter << " iterations: "
+	   << GetResidual(A, x, b) << endl;
+    }
+}
+
+
+int main(int argc, char *argv[])
+{
+  int m = 1000;
+  if (argc > 1)
+    m = atoi(argv[1]);
+
+  cout.precision(3);
+  cout << "Threads: " << ParallelContext::GetNumThreads() << endl;
+
+  string name[3] = {"2-D convection-diffusion", "3-D Laplacian",
+		    "2-D heterogeneous diffusion"};
+  for (int type = 0; type < 3; type++)
+    {
+      int size = (type == 1) ? max(int(pow(double(m*m), 1./3.)), 2) : m;
+      Matrix<double, General, ArrayRowSparse> A0;
+      ConstructMatrix(type, size, A0);
+      Matrix<double, General, RowSparse> A;
+      Copy(A0, A);
+      ReducedPrecisionMatrix<double, General, float> Af;
+      ReducedPrecisionMatrix<double, General, BFloat16> Ab;
+      Copy(A, Af);
+      Copy(A, Ab);
+
+      int n = A.GetM();
+      Vector<double> x(n), y(n), b(n), x_sor(n);
+      x.FillRand();
+      Mlt(1.0 / RAND_MAX, x);
+      b.Fill(1.0);
+      x_sor.Zero();
+      SorVector(A, x_sor, b, 1.0, 10, 2);
+      int nb_loop = max(1, int(1e9 / (A.GetDataSize() * 16.)));
+
+      cout << "* " << name[type] << ", " << n << " rows, "
+	   << A.GetDataSize() << " non-zero entries" << endl;
+      cout << "  values\tbytes/non-zero\tms\tGB/s\tMlt error\t"
+	   << "SOR error\tSOR residual" << endl;
+
+      Mlt(A, x, y);
+      double start = GetWallTime();
+      for (int l = 0; l < nb_loop; l++)
+	Mlt(A, x, y);
+
+      double time = (GetWallTime() - start) / nb_loop;
+      cout << "  double\t" << sizeof(double) + sizeof(size_t) << "\t\t"
+	   << 1e3 * time << "\t" << GetSparseProductBytes(A, x, y, false)
+	/ time / 1e9 << "\t0\t\t0\t\t" << GetResidual(A, x_sor, b) << endl;
+
+      Benchmark("float", Af, A, x, y, x_sor, b,
+		(sizeof(float) + sizeof(uint32_t)) * double(Af.GetDataSize()),
+		nb_loop);
+
+      Benchmark("bfloat16", Ab, A, x, y, x_sor, b,
+		(sizeof(BFloat16) + sizeof(uint32_t))
+		* double(Ab.GetDataSize()), nb_loop);
+
+      BenchmarkIlut(A0, A, b, 20);
+    }
+
+  return 0;
+}
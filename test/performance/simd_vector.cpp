@@ -0,0 +1,180 @@
+#define SELDON_DEBUG_LEVEL_0
+
+#include <ctime>
+
+#include "Seldon.hxx"
+using namespace Seldon;
+
+
+//! Returns the wall-clock time in seconds.
+double GetWallTime()
+{
+#ifdef _OPENMP
+  return omp_get_wtime();
+#else
+  return double(clock()) / CLOCKS_PER_SEC;
+#endif
+}
+
+
+/*
+  Plain loops, as in the generic functions of Functions_Vector.cxx, used as
+  reference for the SIMD kernels.
+*/
+
+template<class T>
+void LoopMlt(const T& alpha, Vector<T>& X)
+{
+  for (size_t i = 0; i < X.GetM(); i++)
+    X(i) *= alpha;
+}
+
+
+template<class T>
+void LoopAdd(const T& alpha, const Vector<T>& X, Vector<T>& Y)
+{
+  for (size_t i = 0; i < X.GetM(); i++)
+    Y(i) += alpha * X(i);
+}
+
+
+template<class T>
+T LoopDotProd(const Vector<T>& X, const Vector<T>& Y)
+{
+  T value(0);
+  for (size_t i = 0; i < X.GetM(); i++)
+    value += X(i) * Y(i);
+
+  return value;
+}
+
+
+template<class T>
+T LoopDotProdConj(const Vector<T>& X, const Vector<T>& Y)
+{
+  T value(0);
+  for (size_t i = 0; i < X.GetM(); i++)
+    value += conjugate(X(i)) * Y(i);
+
+  return value;
+}
+
+
+template<class T>
+typename ClassComplexType<T>::Treal LoopNorm1(const Vector<T>& X)
+{
+  typename ClassComplexType<T>::Treal value(0);
+  for (size_t i = 0; i < X.GetM(); i++)
+    value += ComplexAbs(X(i));
+
+  return value;
+}
+
+
+template<class T>
+typename ClassComplexType<T>::Treal LoopNorm2(const Vector<T>& X)
+{
+  typename ClassComplexType<T>::Treal value(0);
+  for (size_t i = 0; i < X.GetM(); i++)
+    value += absSquare(X(i));
+
+  return sqrt(value);
+}
+
+
+//! Displays the bandwidth of each function, in GB/s.
+template<class T>
+void Benchmark(const string& type, size_t n, int nb_loop)
+{
+  Vector<T> X(n), Y(n);
+  X.Fill(T(1.0001));
+  Y.Fill(T(0.9999));
+  T alpha(1.0001), sum(0);
+  typename ClassComplexType<T>::Treal norm(0);
+
+  // number of bytes read or written by each function
+  double size = double(n * sizeof(T)) / 1e9;
+  string name[6] = {"Mlt", "Add", "DotProd", "DotProdConj", "Norm1",
+		    "Norm2"};
+  double bytes[6] = {2. * size, 3. * size, 2. * size, 2. * size, size, size};
+  double time[6];
+  double start;
+
+  cout << "* " << type << ", " << n << " elements (GB/s)" << endl;
+  cout << "  \t\t";
+  for (int k = 0; k < 6; k++)
+    cout << name[k] << "\t";
+  cout << endl;
+
+  for (int type = -1; type <= SimdInstructionSet::GetSupported(); type++)
+    {
+      if (type >= 0)
+	SimdInstructionSet::SetCurrent(type);
+
+      for (int k = 0; k < 6; k++)
+	time[k] = 0.;
+
+      for (int l = 0; l < nb_loop; l++)
+	{
+	  start = GetWallTime();
+	  if (type < 0)
+	    LoopMlt(alpha, X);
+	  else
+	    Mlt(alpha, X);
+	  time[0] += GetWallTime() - start;
+
+	  start = GetWallTime();
+	  if (type < 0)
+	    LoopAdd(alpha, X, Y);
+	  else
+	    Add(alpha, X, Y);
+	  time[1] += GetWallTime() - start;
+	  Y.Fill(T(0.9999));
+
+	  start = GetWallTime();
+	  sum += type < 0 ? LoopDotProd(X, Y) : DotProd(X, Y);
+	  time[2] += GetWallTime() - start;
+
+	  start = GetWallTime();
+	  sum += type < 0 ? LoopDotProdConj(X, Y) : DotProdConj(X, Y);
+	  time[3] += GetWallTime() - start;
+
+	  start = GetWallTime();
+	  norm += type < 0 ? LoopNorm1(X) : Norm1(X);
+	  time[4] += GetWallTime() - start;
+
+	  start = GetWallTime();
+	  norm += type < 0 ? LoopNorm2(X) : Norm2(X);
+	  time[5] += GetWallTime() - start;
+	}
+
+      if (type < 0)
+	cout << "  loop\t\t";
+      else
+	cout << "  " << SimdInstructionSet::GetName(type) << "\t\t";
+      for (int k = 0; k < 6; k++)
+	cout << bytes[k] * nb_loop / max(time[k], 1e-9) << "\t";
+      cout << endl;
+    }
+
+  // prevents the compiler from discarding the computations
+  if (sum == T(0) || norm == 0)
+    cout << "Unexpected zero result." << endl;
+}
+
+
+int main(int argc, char *argv[])
+{
+  size_t n = 1000000;
+  if (argc > 1)
+    n = atoi(argv[1]);
+
+  int nb_loop = 50;
+
+  Benchmark<float>("float", n, nb_loop);
+  Benchmark<double>("double", n, nb_loop);
+  Benchmark<complex<float> >("complex<float>", n, nb_loop);
+  Benchmark<complex<double> >("complex<double>", n, nb_loop);
+
+  return 0;
+}
@@ -3,17 +3,28 @@
 #include <ctime>
 
 #include "Seldon.hxx"
-#include "SeldonSolver.hxx"
 using namespace Seldon;
 
+
+//! Returns the wall-clock time in seconds.
+double GetWallTime()
+{
+#ifdef _OPENMP
+  return omp_get_wtime();
+#else
+  return double(clock()) / CLOCKS_PER_SEC;
+#endif
+}
+
+
 int main(int argc, char *argv[])
 {
 
   typedef double real;
 
-  int i, j, l, m, n;
-  real v;
-  clock_t start, end;
+  size_t m, n;
+  double start, end;
+  int Nloop = 2;
 
 
   /////////////////
@@ -21,45 +32,74 @@ int main(int argc, char *argv[])
   /////////////////
 
 
+#ifdef _OPENMP
+  cout << "Number of threads: " << omp_get_max_threads() << endl;
+#endif
+
   cout << "* Conversion to RowSparse" << endl;
 
-  m = 20000;
-  n = 10000;
-  int Nelement = 100000;
+  m = 200000;
+  n = 100000;
+  size_t Nelement = 2000000;
 
-  // First an ArrayRowSparse matrix is built so that the row and column
-  // indexes include no duplicates.
-  Matrix<real, General, ArrayRowSparse> A_array(m, n);
-  for (l = 0; l < Nelement; l++)
+  Vector<size_t> row_index_copy(Nelement), col_index_copy(Nelement);
+  Vector<real> value_copy(Nelement);
+  for (size_t l = 0; l < Nelement; l++)
     {
-      i = rand() % m;
-      j = rand() % n;
-      v = real(rand());
-      A_array.AddInteraction(i, j, v);
+      row_index_copy(l) = size_t(rand()) % m;
+      col_index_copy(l) = size_t(rand()) % n;
+      value_copy(l) = real(rand());
     }
-  Vector<int> row_index_copy, col_index_copy;
-  Vector<real> value_copy;
-  ConvertMatrix_to_Coordinates(A_array, row_index_copy, col_index_copy,
-                               value_copy);
 
-  Vector<int> row_index, col_index;
+  Vector<size_t> row_index, col_index;
   Vector<real> value;
 
   Matrix<real, General, RowSparse> A(m, n);
 
-  start = clock();
+  start = GetWallTime();
 
-  for (int i = 0; i < 2; i++)
+  for (int i = 0; i < Nloop; i++)
     {
       row_index = row_index_copy;
       col_index = col_index_copy;
       value = value_copy;
-      ConvertMatrix_from_Coordinates(row_index, col_index, value, A);
+      ConvertMatrix_from_Coordinates(row_index, col_index, value, A, 0);
     }
 
-  end = clock();
+  end = GetWallTime();
+
+  cout << "Elapsed time: " << (end - start) / Nloop << endl;
+
+  cout << "* Conversion from RowSparse to coordinates" << endl;
+
+  start = GetWallTime();
+  for (int i = 0; i < Nloop; i++)
+    ConvertMatrix_to_Coordinates(A, row_index, col_index, value, 0);
+
+  end = GetWallTime();
+  cout << "Elapsed time: " << (end - start) / Nloop << endl;
+
+  cout << "* Conversion from RowSparse to CSC" << endl;
+
+  General sym;
+  Vector<size_t> Ptr, Ind;
+  Vector<real> Val;
+  start = GetWallTime();
+  for (int i = 0; i < Nloop; i++)
+    ConvertToCSC(A, sym, Ptr, Ind, Val, false);
+
+  end = GetWallTime();
+  cout << "Elapsed time: " << (end - start) / Nloop << endl;
+
+  cout << "* Transposition of RowSparse" << endl;
+
+  Matrix<real, General, RowSparse> B;
+  start = GetWallTime();
+  for (int i = 0; i < Nloop; i++)
+    Transpose(A, B);
 
-  cout << "CPU time: " << double(end - start) / CLOCKS_PER_SEC << endl;
+  end = GetWallTime();
+  cout << "Elapsed time: " << (end - start) / Nloop << endl;
 
   return 0;
 }
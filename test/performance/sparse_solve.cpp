@@ -0,0 +1,136 @@
+#define SELDON_DEBUG_LEVEL_0
+#define SELDON_WITH_BLAS
+#define SELDON_WITH_LAPACK
+
+#include <ctime>
+
+#include "Seldon.hxx"
+#include "SeldonSolver.hxx"
+using namespace Seldon;
+
+
+//! Returns the wall-clock time in seconds.
+double GetWallTime()
+{
+#ifdef _OPENMP
+  return omp_get_wtime();
+#else
+  return double(clock()) / CLOCKS_PER_SEC;
+#endif
+}
+
+
+//! Finite-difference Laplacian (with a convection term) on a m x m grid.
+template<class Prop, class Storage>
+void ConstructLaplacian(int m, bool sym, Matrix<double, Prop, Storage>& A)
+{
+  int n = m*m;
+  A.Reallocate(n, n);
+  double cx = sym ? -1.0 : -1.3, cy = sym ? -1.0 : -1.1;
+  double dx = sym ? -1.0 : -0.7, dy = sym ? -1.0 : -0.9;
+  for (int i = 0; i < m; i++)
+    for (int j = 0; j < m; j++)
+      {
+	int r = i*m + j;
+	A.AddInteraction(r, r, 4.5);
+	if (j+1 < m)
+	  {
+	    A.AddInteraction(r, r+1, cx);
+	    if (!sym)
+	      A.AddInteraction(r+1, r, dx);
+	  }
+	if (i+1 < m)
+	  {
+	    A.AddInteraction(r, r+m, cy);
+	    if (!sym)
+	      A.AddInteraction(r+m, r, dy);
+	  }
+      }
+}
+
+
+//! Solves nrhs systems column by column and with a blocked solve.
+/*!
+  For the LU solver, A x = b and A^T x = b are solved, for the Cholesky
+  solver, L x = b and L^T x = b are solved.
+*/
+template<class Solver>
+void BenchmarkSolve(Solver& mat_lu, int n, int nrhs, int nb_loop)
+{
+  Matrix<double, General, ColMajor> B(n, nrhs), X(n, nrhs);
+  B.FillRand();
+  Vector<double> x;
+  double start, end, time_column, time_block;
+
+  start = GetWallTime();
+  for (int l = 0; l < nb_loop; l++)
+    {
+      X = B;
+      for (int k = 0; k < nrhs; k++)
+	{
+	  x.SetData(n, &X.GetData()[k*n]);
+	  mat_lu.Solve(SeldonNoTrans, x);
+	  mat_lu.Solve(SeldonTrans, x);
+	  x.Nullify();
+	}
+    }
+  end = GetWallTime();
+  time_column = (end - start) / nb_loop;
+
+  start = GetWallTime();
+  for (int l = 0; l < nb_loop; l++)
+    {
+      X = B;
+      mat_lu.Solve(SeldonNoTrans, X);
+      mat_lu.Solve(SeldonTrans, X);
+    }
+  end = GetWallTime();
+  time_block = (end - start) / nb_loop;
+
+  cout << "  nrhs = " << nrhs << "\tcolumn by column: " << time_column
+       << " s\tblocked: " << time_block << " s\tspeedup: "
+       << time_column / time_block << endl;
+}
+
+
+int main(int argc, char *argv[])
+{
+  int m = 100;
+  if (argc > 1)
+    m = atoi(argv[1]);
+
+  int n = m*m, nb_loop = 3;
+  int nrhs[8] = {1, 2, 4, 8, 16, 32, 64, 128};
+
+#ifdef _OPENMP
+  cout << "Number of threads: " << omp_get_max_threads() << endl;
+#endif
+
+  IVect permut;
+
+  cout << "* SparseSeldonSolver (LU), n = " << n << endl;
+  {
+    Matrix<double, General, ArrayRowSparse> A;
+    ConstructLaplacian(m, false, A);
+    FindSparseOrdering(A, permut, SparseMatrixOrdering::REVERSE_CUTHILL_MCKEE);
+
+    SparseSeldonSolver<double> mat_lu;
+    mat_lu.FactorizeMatrix(permut, A);
+    for (int k = 0; k < 8; k++)
+      BenchmarkSolve(mat_lu, n, nrhs[k], nb_loop);
+  }
+
+  cout << "* SparseCholeskySolver, n = " << n << endl;
+  {
+    Matrix<double, Symmetric, ArrayRowSymSparse> A;
+    ConstructLaplacian(m, true, A);
+
+    SparseCholeskySolver<double> mat_chol;
+    mat_chol.SetTypeOrdering(SparseMatrixOrdering::REVERSE_CUTHILL_MCKEE);
+    mat_chol.Factorize(A);
+    for (int k = 0; k < 8; k++)
+      BenchmarkSolve(mat_chol, n, nrhs[k], nb_loop);
+  }
+
+  return 0;
+}
@@ -0,0 +1,89 @@
+#define SELDON_DEBUG_LEVEL_0
+
+#include <ctime>
+
+#include "Seldon.hxx"
+using namespace Seldon;
+
+
+//! Returns the wall-clock time in seconds.
+double GetWallTime()
+{
+#ifdef _OPENMP
+  return omp_get_wtime();
+#else
+  return double(clock()) / CLOCKS_PER_SEC;
+#endif
+}
+
+
+//! Computes C = C + A B element by element through operator().
+template<class MatA, class MatB, class MatC>
+void NaiveMltAdd(const MatA& A, const MatB& B, MatC& C)
+{
+  for (size_t i = 0; i < size_t(C.GetM()); i++)
+    for (size_t j = 0; j < size_t(C.GetN()); j++)
+      {
+        double sum = 0.;
+        for (size_t k = 0; k < size_t(A.GetN()); k++)
+          sum += A(i, k) * B(k, j);
+        C(i, j) += sum;
+      }
+}
+
+
+int main(int argc, char *argv[])
+{
+  size_t n = 600;
+  if (argc > 1)
+    n = atoi(argv[1]);
+
+  // the views are taken on the interior of larger matrices
+  size_t N = n + 20;
+  Matrix<double, General, ColMajor> A(N, N), B(N, N), C(N, N);
+  A.FillRand();
+  B.FillRand();
+  C.Zero();
+  double start, time;
+  double flops = 2. * n * n * n;
+
+#ifdef _OPENMP
+  cout << "Number of threads: " << omp_get_max_threads() << endl;
+#endif
+#ifdef SELDON_WITH_BLAS
+  cout << "Strided views are multiplied with Blas." << endl;
+#endif
+
+  Vector<int> row(n), col(n);
+  for (size_t i = 0; i < n; i++)
+    {
+      row(i) = i + 10;
+      col(i) = i + 5;
+    }
+
+  SubMatrix<Matrix<double, General, ColMajor> >
+    As(A, row, col), Bs(B, col, row), Cs(C, row, row);
+
+  start = GetWallTime();
+  NaiveMltAdd(As, Bs, Cs);
+  time = GetWallTime() - start;
+  cout << "SubMatrix, element-wise loop:\t" << time << " s\t"
+       << flops / time * 1e-9 << " GFlops" << endl;
+
+  start = GetWallTime();
+  MltAdd(1., As, Bs, 1., Cs);
+  time = GetWallTime() - start;
+  cout << "SubMatrix, MltAdd:\t\t" << time << " s\t"
+       << flops / time * 1e-9 << " GFlops" << endl;
+
+  StridedSubMatrix<Matrix<double, General, ColMajor> >
+    Av(A, 10, 5, n, n), Bv(B, 5, 10, n, n), Cv(C, 10, 10, n, n);
+
+  start = GetWallTime();
+  MltAdd(1., Av, Bv, 1., Cv);
+  time = GetWallTime() - start;
+  cout << "StridedSubMatrix, MltAdd:\t" << time << " s\t"
+       << flops / time * 1e-9 << " GFlops" << endl;
+
+  return 0;
+}
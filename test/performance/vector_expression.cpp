@@ -0,0 +1,104 @@
+#define SELDON_DEBUG_LEVEL_0
+
+#include <ctime>
+
+#include "Seldon.hxx"
+#include "vector/VectorExpression.cxx"
+using namespace Seldon;
+
+int main(int argc, char *argv[])
+{
+
+  typedef double real;
+
+  int n = 1000000;
+  int nb_loop = 100;
+  clock_t start, end;
+
+  Vector<real> x(n), y(n), z(n), tmp(n);
+  x.FillRand(); y.FillRand(); z.FillRand();
+  Mlt(1.0 / RAND_MAX, x); Mlt(1.0 / RAND_MAX, y); Mlt(1.0 / RAND_MAX, z);
+  real a = 0.5, b = 0.25, c = 0.125, s = 0;
+
+
+  /////////////////////////
+  // y = a x + b y - c z //
+  /////////////////////////
+
+
+  cout << "* y = a x + b y - c z" << endl;
+
+  start = clock();
+  for (int l = 0; l < nb_loop; l++)
+    {
+      Mlt(b, y);
+      Add(a, x, y);
+      Add(-c, z, y);
+    }
+  end = clock();
+  cout << "Mlt/Add calls:      " << double(end - start) / CLOCKS_PER_SEC
+       << endl;
+
+  start = clock();
+  for (int l = 0; l < nb_loop; l++)
+    y = a*x + b*y - c*z;
+  end = clock();
+  cout << "VectorExpression:   " << double(end - start) / CLOCKS_PER_SEC
+       << endl;
+
+
+  ////////////////////////////////////
+  // y = x - a z, followed by ||y|| //
+  ////////////////////////////////////
+
+
+  cout << "* y = x - a z, ||y||" << endl;
+
+  start = clock();
+  for (int l = 0; l < nb_loop; l++)
+    {
+      Copy(x, y);
+      Add(-a, z, y);
+      s += Norm2(y);
+    }
+  end = clock();
+  cout << "Copy/Add/Norm2:     " << double(end - start) / CLOCKS_PER_SEC
+       << endl;
+
+  start = clock();
+  for (int l = 0; l < nb_loop; l++)
+    s += CopyNorm2(x - a*z, y);
+  end = clock();
+  cout << "CopyNorm2:          " << double(end - start) / CLOCKS_PER_SEC
+       << endl;
+
+
+  /////////////////////////////
+  // (x + a y).z without tmp //
+  /////////////////////////////
+
+
+  cout << "* (x + a y).z" << endl;
+
+  start = clock();
+  for (int l = 0; l < nb_loop; l++)
+    {
+      Copy(x, tmp);
+      Add(a, y, tmp);
+      s += DotProd(tmp, z);
+    }
+  end = clock();
+  cout << "Copy/Add/DotProd:   " << double(end - start) / CLOCKS_PER_SEC
+       << endl;
+
+  start = clock();
+  for (int l = 0; l < nb_loop; l++)
+    s += DotProd(x + a*y, z);
+  end = clock();
+  cout << "DotProd(expr, z):   " << double(end - start) / CLOCKS_PER_SEC
+       << endl;
+
+  DISP(s);
+
+  return 0;
+}
@@ -0,0 +1,101 @@
+#define SELDON_DEBUG_LEVEL_0
+
+#include <ctime>
+#include <vector>
+
+#include "Seldon.hxx"
+using namespace Seldon;
+
+
+//! Returns the wall-clock time in seconds.
+double GetWallTime()
+{
+#ifdef _OPENMP
+  return omp_get_wtime();
+#else
+  return double(clock()) / CLOCKS_PER_SEC;
+#endif
+}
+
+
+//! Appends n elements one by one with PushBack.
+void BenchmarkPushBack(int n)
+{
+  double start = GetWallTime();
+  Vector<double> x;
+  for (int i = 0; i < n; i++)
+    x.PushBack(double(i));
+  double time_push = GetWallTime() - start;
+
+  start = GetWallTime();
+  Vector<double> y;
+  y.Reserve(n);
+  for (int i = 0; i < n; i++)
+    y.PushBack(double(i));
+  double time_reserve = GetWallTime() - start;
+
+  cout << "  PushBack, n = " << n << "\tgrowth: " << time_push
+       << " s\treserved: " << time_reserve << " s\tcapacity: "
+       << x.GetCapacity() << endl;
+}
+
+
+//! Adds n entries (in increasing order) to a sparse vector.
+void BenchmarkAddInteraction(int n)
+{
+  double start = GetWallTime();
+  Vector<double, VectSparse> x;
+  for (int i = 0; i < n; i++)
+    x.AddInteraction(2*i, 1.0);
+  double time_add = GetWallTime() - start;
+
+  cout << "  AddInteraction, n = " << n << "\ttime: " << time_add
+       << " s\tcapacity: " << x.GetCapacity() << endl;
+}
+
+
+//! Fills a std::vector of nb vectors of size n, and grows it.
+void BenchmarkContainer(int nb, int n)
+{
+  Vector<double> u(n);
+  u.Fill(1.0);
+
+  double start = GetWallTime();
+  std::vector<Vector<double> > list;
+  for (int i = 0; i < nb; i++)
+    list.push_back(u);
+  double time_fill = GetWallTime() - start;
+
+  start = GetWallTime();
+  Vector<Vector<double>, VectFull, NewAlloc<Vector<double> > > list2;
+  for (int i = 0; i < nb; i++)
+    list2.PushBack(u);
+  double time_seldon = GetWallTime() - start;
+
+  cout << "  container of " << nb << " vectors of size " << n
+       << "\tstd::vector: " << time_fill << " s\tVector<Vector>: "
+       << time_seldon << " s" << endl;
+}
+
+
+int main(int argc, char *argv[])
+{
+  int n = 10000000;
+  if (argc > 1)
+    n = atoi(argv[1]);
+
+#ifdef SELDON_WITH_CPP11
+  cout << "Move semantics are enabled" << endl;
+#else
+  cout << "Move semantics are disabled" << endl;
+#endif
+
+  cout << "* Append-heavy workloads" << endl;
+  BenchmarkPushBack(n);
+  BenchmarkAddInteraction(n / 10);
+
+  cout << "* Containers of vectors" << endl;
+  BenchmarkContainer(n / 1000, 1000);
+
+  return 0;
+}
@@ -0,0 +1,154 @@
+// NewAlloc as default allocator in order to avoid problems
+// with vectors of complex types
+#define SELDON_DEFAULT_ALLOCATOR NewAlloc
+// seldon will call abort() when encountering an exception
+#define SELDON_WITH_ABORT
+// no call of srand by Seldon
+#define SELDON_WITHOUT_REINIT_RANDOM
+
+// C library for time function and for randomization
+#include <cstdlib>
+#include <ctime>
+
+#include "Seldon.hxx"
+
+using namespace Seldon;
+
+typedef double Real_wp;
+typedef complex<double> Complex_wp;
+
+template<class T>
+void GetRandNumber(T& x)
+{
+  x = T(rand())/RAND_MAX;
+}
+
+template<class T>
+void GetRandNumber(complex<T>& x)
+{
+  x = complex<T>(rand(), rand())/Real_wp(RAND_MAX);
+}
+
+// checks alignment, reallocation and copy of vectors with allocator Alloc
+template<class T, class Alloc>
+void CheckAllocator(const string& name, size_t n)
+{
+  Vector<T, VectFull, Alloc> x(n), y;
+  if (reinterpret_cast<uintptr_t>(x.GetData()) % SELDON_MEMORY_ALIGNMENT
+      != 0)
+    {
+      cout << name << ": vector is not aligned" << endl;
+      abort();
+    }
+
+  for (size_t i = 0; i < n; i++)
+    GetRandNumber(x(i));
+
+  y = x;
+  for (size_t i = 0; i < n; i++)
+    if (y(i) != x(i))
+      {
+	cout << name << ": copy incorrect" << endl;
+	abort();
+      }
+
+  // previous values are kept when the vector is enlarged or shrunk
+  y.Resize(2*n + 3);
+  for (size_t i = 0; i < n; i++)
+    if (y(i) != x(i))
+      {
+	cout << name << ": Resize incorrect" << endl;
+	abort();
+      }
+
+  y.Reallocate(n/2);
+  for (size_t i = 0; i < n/2; i++)
+    if (y(i) != x(i))
+      {
+	cout << name << ": Reallocate incorrect" << endl;
+	abort();
+      }
+
+  y.Clear();
+  x.Reallocate(0);
+  if (x.GetM() != 0)
+    {
+      cout << name << ": Reallocate(0) incorrect" << endl;
+      abort();
+    }
+}
+
+// checks a sparse matrix whose values are allocated with Alloc
+template<class Alloc>
+void CheckSparse(const string& name, int n)
+{
+  Vector<Real_wp, VectFull, Alloc> values(3*n-2);
+  Vector<size_t> ptr(n+1), ind(3*n-2);
+  size_t nnz = 0;
+  ptr(0) = 0;
+  for (int i = 0; i < n; i++)
+    {
+      for (int j = max(i-1, 0); j <= min(i+1, n-1); j++)
+	{
+	  ind(nnz) = j;
+	  values(nnz) = Real_wp(i+1);
+	  nnz++;
+	}
+
+      ptr(i+1) = nnz;
+    }
+
+  Matrix<Real_wp, General, RowSparse, Alloc> A;
+  A.SetData(n, n, values, ptr, ind);
+  Matrix<Real_wp, General, RowSparse, Alloc> B(A);
+  for (int i = 0; i < n; i++)
+    if (B(i, i) != Real_wp(i+1))
+      {
+	cout << name << ": sparse matrix incorrect" << endl;
+	abort();
+      }
+}
+
+int main(int argc, char** argv)
+{
+  CheckAllocator<Real_wp, AlignedAlloc<Real_wp> >("AlignedAlloc", 1000);
+  CheckAllocator<Complex_wp, AlignedAlloc<Complex_wp> >("AlignedAlloc", 17);
+  CheckAllocator<int, AlignedAlloc<int> >("AlignedAlloc", 33);
+
+  // size of huge pages, a power of two
+  size_t huge_size = AlignedMemory::GetHugePageSize();
+  if ((huge_size < 4096) || ((huge_size & (huge_size - 1)) != 0))
+    {
+      cout << "GetHugePageSize incorrect" << endl;
+      abort();
+    }
+
+  // large vectors are mapped directly
+  CheckAllocator<Real_wp, HugePageAlloc<Real_wp> >("HugePageAlloc", 10);
+  CheckAllocator<Real_wp, HugePageAlloc<Real_wp> >("HugePageAlloc", 1000000);
+
+  CheckAllocator<Real_wp, NumaAlloc<Real_wp> >("NumaAlloc", 10);
+  CheckAllocator<Real_wp, NumaAlloc<Real_wp> >("NumaAlloc", 1000000);
+  AlignedMemory::SetNumaPolicy(AlignedMemory::INTERLEAVE);
+  CheckAllocator<Real_wp, NumaAlloc<Real_wp> >("NumaAlloc", 1000000);
+  AlignedMemory::SetNumaPolicy(AlignedMemory::BIND, 0);
+  CheckAllocator<Real_wp, NumaAlloc<Real_wp> >("NumaAlloc", 1000000);
+  AlignedMemory::SetNumaPolicy(AlignedMemory::FIRST_TOUCH);
+
+  // values allocated by NumaAlloc are set to zero
+  Vector<Real_wp, VectFull, NumaAlloc<Real_wp> > z(500000);
+  for (size_t i = 0; i < z.GetM(); i++)
+    if (z(i) != Real_wp(0))
+      {
+	cout << "NumaAlloc: first touch incorrect" << endl;
+	abort();
+      }
+
+  CheckSparse<AlignedAlloc<Real_wp> >("AlignedAlloc", 50);
+  CheckSparse<HugePageAlloc<Real_wp> >("HugePageAlloc", 200000);
+  CheckSparse<NumaAlloc<Real_wp> >("NumaAlloc", 200000);
+
+  cout << "All tests passed successfully" << endl;
+
+  return 0;
+}
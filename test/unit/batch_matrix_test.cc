@@ -0,0 +1,217 @@
+// NewAlloc as default allocator in order to avoid problems
+// with vectors of complex types
+#define SELDON_DEFAULT_ALLOCATOR NewAlloc
+// seldon will call abort() when encountering an exception
+#define SELDON_WITH_ABORT
+// no call of srand by Seldon
+#define SELDON_WITHOUT_REINIT_RANDOM
+
+// C library for time function and for randomization
+#include <cstdlib>
+#include <ctime>
+
+#include "Seldon.hxx"
+
+using namespace Seldon;
+
+typedef double Real_wp;
+typedef complex<double> Complex_wp;
+
+Real_wp threshold;
+
+template<class T>
+void GetRandNumber(T& x)
+{
+  x = T(rand())/RAND_MAX;
+}
+
+template<class T>
+void GetRandNumber(complex<T>& x)
+{
+  x = complex<T>(rand(), rand())/Real_wp(RAND_MAX);
+}
+
+// generates a well-conditioned random matrix
+template<class T>
+void GenerateRandomMatrix(Matrix<T, General, RowMajor>& A, int n)
+{
+  A.Reallocate(n, n);
+  for (int i = 0; i < n; i++)
+    for (int j = 0; j < n; j++)
+      GetRandNumber(A(i, j));
+
+  for (int i = 0; i < n; i++)
+    A(i, i) += T(n);
+}
+
+template<class T>
+void CheckBatch(int nb, int n)
+{
+  Vector<Matrix<T, General, RowMajor>, VectFull, NewAlloc<Matrix<T, General, RowMajor> > > A(nb), B(nb);
+  MatrixBatch<T> Ab(nb, n, n), Bb(nb, n, n), Cb(nb, n, n);
+  for (int k = 0; k < nb; k++)
+    {
+      GenerateRandomMatrix(A(k), n);
+      GenerateRandomMatrix(B(k), n);
+      Ab.SetMatrix(k, A(k));
+      Bb.SetMatrix(k, B(k));
+    }
+
+  // product
+  Mlt(Ab, Bb, Cb);
+  for (int k = 0; k < nb; k++)
+    for (int i = 0; i < n; i++)
+      for (int j = 0; j < n; j++)
+	{
+	  T val; SetComplexZero(val);
+	  for (int p = 0; p < n; p++)
+	    val += A(k)(i, p)*B(k)(p, j);
+
+	  if ((abs(val - Cb(k, i, j)) > threshold*abs(val))
+	      || isnan(abs(Cb(k, i, j))))
+	    {
+	      cout << "Mlt(MatrixBatch) incorrect" << endl;
+	      abort();
+	    }
+	}
+
+  // MltAdd
+  T alpha, beta;
+  GetRandNumber(alpha); GetRandNumber(beta);
+  MatrixBatch<T> Db(Cb);
+  MltAdd(alpha, Ab, Bb, beta, Db);
+  for (int k = 0; k < nb; k++)
+    for (int i = 0; i < n; i++)
+      for (int j = 0; j < n; j++)
+	{
+	  T val = beta*Cb(k, i, j) + alpha*Cb(k, i, j);
+	  if (abs(val - Db(k, i, j)) > threshold*abs(val))
+	    {
+	      cout << "MltAdd(MatrixBatch) incorrect" << endl;
+	      abort();
+	    }
+	}
+
+  // LU factorization and resolution
+  Vector<int> pivot;
+  MatrixBatch<T> LU(Ab), X(nb, n, 1);
+  X.FillRand();
+  MatrixBatch<T> Y(X);
+  GetLU(LU, pivot);
+  SolveLU(LU, pivot, X);
+  for (int k = 0; k < nb; k++)
+    for (int i = 0; i < n; i++)
+      {
+	T val; SetComplexZero(val);
+	for (int p = 0; p < n; p++)
+	  val += A(k)(i, p)*X(k, p, 0);
+
+	if (abs(val - Y(k, i, 0)) > threshold*abs(Y(k, i, 0)))
+	  {
+	    cout << "SolveLU(MatrixBatch) incorrect" << endl;
+	    abort();
+	  }
+      }
+
+  // inverse
+  MatrixBatch<T> Ainv(Ab);
+  GetInverse(Ainv);
+  Mlt(Ab, Ainv, Cb);
+  for (int k = 0; k < nb; k++)
+    for (int i = 0; i < n; i++)
+      for (int j = 0; j < n; j++)
+	{
+	  T val; SetComplexZero(val);
+	  if (i == j)
+	    SetComplexOne(val);
+
+	  if (abs(val - Cb(k, i, j)) > threshold)
+	    {
+	      cout << "GetInverse(MatrixBatch) incorrect" << endl;
+	      abort();
+	    }
+	}
+}
+
+template<class T, int n>
+void CheckTiny()
+{
+  Matrix<T, General, RowMajor> A;
+  GenerateRandomMatrix(A, n);
+  TinyMatrix<T, n, n> At, Ainv, C;
+  At.Copy(A);
+
+  TinyVector<T, n> x, y, b;
+  for (int i = 0; i < n; i++)
+    GetRandNumber(x(i));
+
+  Mlt(At, x, b);
+  for (int i = 0; i < n; i++)
+    {
+      T val; SetComplexZero(val);
+      for (int j = 0; j < n; j++)
+	val += A(i, j)*x(j);
+
+      if (abs(val - b(i)) > threshold*abs(val))
+	{
+	  cout << "Mlt(TinyMatrix, TinyVector) incorrect" << endl;
+	  abort();
+	}
+    }
+
+  TinyVector<int, n> pivot;
+  TinyMatrix<T, n, n> lu(At);
+  GetLU(lu, pivot);
+  y = b;
+  SolveLU(lu, pivot, y);
+  for (int i = 0; i < n; i++)
+    if (abs(y(i) - x(i)) > threshold*abs(x(i)))
+      {
+	cout << "SolveLU(TinyMatrix) incorrect" << endl;
+	abort();
+      }
+
+  Ainv = At;
+  GetInverse(Ainv);
+  Mlt(At, Ainv, C);
+  for (int i = 0; i < n; i++)
+    for (int j = 0; j < n; j++)
+      {
+	T val; SetComplexZero(val);
+	if (i == j)
+	  SetComplexOne(val);
+
+	if (abs(val - C(i, j)) > threshold)
+	  {
+	    cout << "GetInverse(TinyMatrix) incorrect" << endl;
+	    abort();
+	  }
+      }
+
+  y = x;
+  Add(T(2), x, y);
+  if (abs(DotProd(x, y) - T(3)*DotProd(x, x)) > threshold*abs(DotProd(x, y)))
+    {
+      cout << "DotProd(TinyVector) incorrect" << endl;
+      abort();
+    }
+}
+
+int main(int argc, char** argv)
+{
+  threshold = 1e-10;
+
+  // batch sizes not multiple of the pack size are also tested
+  CheckBatch<Real_wp>(1, 8);
+  CheckBatch<Real_wp>(37, 8);
+  CheckBatch<Real_wp>(20, 17);
+  CheckBatch<Complex_wp>(13, 9);
+
+  CheckTiny<Real_wp, 3>();
+  CheckTiny<Real_wp, 8>();
+  CheckTiny<Complex_wp, 5>();
+
+  cout << "All tests passed successfully" << endl;
+
+  return 0;
+}
@@ -388,6 +388,25 @@ void CheckSparseCholesky(Matrix<T, Prop, Storage, Allocator>& A)
       abort();
     }
 
+  // several right hand sides
+  Matrix<T, General, ColMajor> xm(b.GetM(), 2);
+  for (int i = 0; i < b.GetM(); i++)
+    {
+      xm(i, 0) = b(i);
+      xm(i, 1) = b(i);
+    }
+
+  mat_lu.Solve(SeldonNoTrans, xm);
+  mat_lu.Solve(SeldonTrans, xm);
+  for (int i = 0; i < b.GetM(); i++)
+    if ((abs(xm(i, 0) - x(i)) > threshold)
+        || (abs(xm(i, 1) - x(i)) > threshold))
+      {
+        cout << "SolveCholesky with several right hand sides incorrect"
+             << endl;
+        abort();
+      }
+
   y.Fill();
   mat_lu.Solve(SeldonNoTrans, y);
   mat_lu.Solve(SeldonTrans, y);
@@ -213,7 +213,11 @@ void CheckDirectSolver(Matrix<T, Prop, Storage, Allocator>& A)
   z.Fill(zero);
   b.Fill(zero); bt.Fill(zero);
   Mlt(A, x, b);
-  Mlt(SeldonTrans, A, x, bt);
+  // with Blas, Mlt(SeldonTrans, A, x, bt) is taken as Mlt(alpha, A, x, bt)
+  for (int i = 0; i < n; i++)
+    for (int j = 0; j < n; j++)
+      bt(j) += A(i, j) * x(i);
+
   y = x;
 
   {
@@ -1043,6 +1047,232 @@ void CheckDirectSolver(Matrix<T, Prop, Storage, Allocator>& A)
     mat_lu.Clear();
   }
 
+  {
+    SparseDirectSolver<T> mat_lu;
+    mat_lu.SelectDirectSolver(mat_lu.SELDON_SOLVER);
+    
+    // symbolic factorization, then numerical factorization
+    mat_lu.Analyze(A);
+    mat_lu.FactorizeNumeric(A, true);
+    
+    x = b;
+    mat_lu.Solve(x);
+    
+    if (!EqualVector(x, y, 10.0*threshold))
+      {
+	cout << "FactorizeNumeric incorrect " << endl;
+	abort();
+      }
+    
+    // new values with the same pattern
+    Matrix<T, Prop, Storage, Allocator> B(A);
+    T two = 2.0;
+    Mlt(two, B);
+    mat_lu.Refactorize(B, true);
+    
+    x = b;
+    mat_lu.Solve(x);
+    Mlt(two, x);
+    
+    if (!EqualVector(x, y, 10.0*threshold))
+      {
+	cout << "Refactorize incorrect " << endl;
+	abort();
+      }
+    
+    mat_lu.Clear();
+  }
+
+  {
+    // resolution of multiple right hand-sides with level-set schedules
+    SparseSeldonSolver<T> mat_lu;
+    IVect perm(n);
+    perm.Fill();
+    mat_lu.FactorizeMatrix(perm, A, true);
+    
+    Matrix<T, General, ColMajor> xm(n, 2);
+    for (int i = 0; i < n; i++)
+      {
+        xm(i, 0) = b(i);
+        xm(i, 1) = b(i);
+      }
+    
+    mat_lu.Solve(SeldonNoTrans, xm);
+    for (int i = 0; i < n; i++)
+      if ((abs(xm(i, 0) - y(i)) > threshold)
+          || (abs(xm(i, 1) - y(i)) > threshold))
+        {
+          cout << "Solve of Seldon with several right hand-sides incorrect "
+               << endl;
+          abort();
+        }
+    
+    for (int i = 0; i < n; i++)
+      {
+        xm(i, 0) = bt(i);
+        xm(i, 1) = bt(i);
+      }
+    
+    mat_lu.Solve(SeldonTrans, xm);
+    for (int i = 0; i < n; i++)
+      if ((abs(xm(i, 0) - y(i)) > threshold)
+          || (abs(xm(i, 1) - y(i)) > threshold))
+        {
+          cout << "Solve of Seldon with several right hand-sides incorrect "
+               << endl;
+          abort();
+        }
+  }
+
+  {
+    SparseSupernodalSolver<T> mat_lu;
+    mat_lu.SetPivotThreshold(0.5);
+    mat_lu.FactorizeMatrix(num, A, true);
+    
+    x = b;
+    mat_lu.Solve(x);
+    
+    if (!EqualVector(x, y))
+      {
+	cout << "Solve of supernodal solver incorrect " << endl;
+	abort();
+      }
+    
+    x = bt;
+    mat_lu.Solve(SeldonTrans, x);
+
+    if (!EqualVector(x, y))
+      {
+	cout << "Solve of supernodal solver incorrect " << endl;
+	abort();
+      }
+    
+    // testing resolution of multiple right hand-sides
+    Matrix<T, General, ColMajor> xm(n, 2);
+    for (int i = 0; i < n; i++)
+      {
+        xm(i, 0) = b(i);
+        xm(i, 1) = bt(i);
+      }
+    
+    mat_lu.Solve(SeldonNoTrans, xm.GetData(), 1);
+    mat_lu.Solve(SeldonTrans, &xm.GetData()[n], 1);
+    for (int i = 0; i < n; i++)
+      if ((abs(xm(i, 0) - y(i)) > threshold)
+          || (abs(xm(i, 1) - y(i)) > threshold))
+        {
+          cout << "Solve of supernodal solver incorrect " << endl;
+          abort();
+        }
+  }
+
+  {
+    // factors written on the disk
+    SparseSupernodalSolver<T> mat_lu;
+    mat_lu.EnableOutOfCore();
+    mat_lu.SetOutOfCoreMemoryBudget(0);
+    mat_lu.FactorizeMatrix(num, A, true);
+    
+    if (mat_lu.GetOutOfCoreBytesWritten() <= 0)
+      {
+	cout << "Out-of-core factorization of supernodal solver incorrect "
+             << endl;
+	abort();
+      }
+    
+    x = b;
+    mat_lu.Solve(x);
+    
+    if (!EqualVector(x, y))
+      {
+	cout << "Out-of-core solve of supernodal solver incorrect " << endl;
+	abort();
+      }
+    
+    x = bt;
+    mat_lu.Solve(SeldonTrans, x);
+
+    if (!EqualVector(x, y))
+      {
+	cout << "Out-of-core solve of supernodal solver incorrect " << endl;
+	abort();
+      }
+  }
+
+  {
+    // Schur complement and static condensation
+    int p = 40;
+    IVect num_schur(p);
+    for (int i = 0; i < p; i++)
+      num_schur(i) = (7*i + 3) % n;
+
+    SparseSupernodalSolver<T> mat_lu;
+    Matrix<T, General, ColMajor> mat_schur;
+    mat_lu.GetSchurMatrix(num, A, num_schur, mat_schur, true);
+    
+    if ((int(mat_schur.GetM()) != p) || (int(mat_lu.GetSchurSize()) != p))
+      {
+	cout << "GetSchurMatrix of supernodal solver incorrect" << endl;
+	abort();
+      }
+
+    Vector<T> b_schur, x_schur(p), y_schur(p);
+    mat_lu.CondenseRightHandSide(b, b_schur);
+
+    // the Schur unknowns of the solution satisfy S x_schur = b_schur
+    for (int i = 0; i < p; i++)
+      x_schur(i) = y(num_schur(i));
+
+    y_schur.Fill(zero);
+    Mlt(mat_schur, x_schur, y_schur);
+    if (!EqualVector(y_schur, b_schur))
+      {
+	cout << "Schur complement of supernodal solver incorrect" << endl;
+	abort();
+      }
+
+    mat_lu.ExpandSolution(b, x_schur, x);
+    if (!EqualVector(x, y))
+      {
+	cout << "Static condensation of supernodal solver incorrect" << endl;
+	abort();
+      }
+  }
+
+  {
+    SparseDirectSolver<T> mat_lu;
+    mat_lu.SelectDirectSolver(mat_lu.SELDON_SUPERNODAL);
+    mat_lu.RefineSolution();
+    mat_lu.Factorize(A, true);
+    
+    x = b;
+    mat_lu.Solve(x);
+    
+    if (!EqualVector(x, y))
+      {
+	cout << "Solve of supernodal solver incorrect " << endl;
+	abort();
+      }
+    
+    // new values with the same pattern
+    Matrix<T, Prop, Storage, Allocator> B(A);
+    T two = 2.0;
+    Mlt(two, B);
+    mat_lu.Refactorize(B, true);
+    
+    x = b;
+    mat_lu.Solve(x);
+    Mlt(two, x);
+    
+    if (!EqualVector(x, y))
+      {
+	cout << "Refactorize of supernodal solver incorrect " << endl;
+	abort();
+      }
+    
+    mat_lu.Clear();
+  }
+
 }
 
 
@@ -74,6 +74,41 @@ void Mlt(const Matrix_Laplacian1D<T1>& A,
 }
 
 
+// preconditioner for the 1-D laplacian (exact solve with tridiagonal matrix)
+class Preconditioner_Laplacian1D
+{
+protected :
+  double dx;
+  
+public :
+  void Init(const Matrix_Laplacian1D<double>& A)
+  {
+    dx = A.dx;
+  }
+  
+  template<class Matrix1>
+  void Solve(const Matrix1& A, const Vector<double>& r, Vector<double>& z)
+  {
+    int n = r.GetM();
+    Vector<double> c(n);
+    c(0) = -0.5;
+    z(0) = 0.5*r(0);
+    for (int i = 1; i < n; i++)
+      {
+        double coef = 1.0/(2.0 + c(i-1));
+        c(i) = -coef;
+        z(i) = (r(i) + z(i-1))*coef;
+      }
+    
+    for (int i = n-2; i >= 0; i--)
+      z(i) -= c(i)*z(i+1);
+    
+    Mlt(dx*dx, z);
+  }
+  
+};
+
+
 // returns true if the matrix is complex
 template<class T>
 bool IsComplexMatrix(const Matrix_Laplacian1D<T>& A)
@@ -1021,7 +1056,80 @@ int main(int argc, char** argv)
     cout << endl << endl;
 
   }
-  
+
+#ifdef SELDON_WITH_LAPACK
+  {
+    // testing native solvers (LOBPCG and Krylov-Schur) with a matrix-free class
+    Matrix_Laplacian1D<double> K;
+    K.Init(200, 2.0);
+
+    MatrixFreeEigenProblem<double, Matrix_Laplacian1D<double> > var_eig;
+    var_eig.SetStoppingCriterion(1e-12);
+    var_eig.SetNbAskedEigenvalues(nb_eigenval);
+    var_eig.SetComputationalMode(var_eig.REGULAR_MODE);
+    var_eig.SetTypeSpectrum(var_eig.SMALL_EIGENVALUES, 0, var_eig.SORTED_MODULUS);
+
+    Vector<double> lambda, lambda_imag;
+    Matrix<double, General, ColMajor> eigen_vec;
+
+    // LOBPCG is called directly in order to provide a preconditioner
+    Preconditioner_Laplacian1D prec;
+    prec.Init(K);
+    var_eig.InitMatrix(K);
+    cout << "Testing computation of small eigenvalues of symmetric matrix with LOBPCG..." << endl;
+    FindEigenvaluesLobpcg(var_eig, lambda, lambda_imag, eigen_vec, prec);
+    DISP(lambda);
+
+    CheckEigenvalues(K, lambda, eigen_vec);
+    cout << endl << endl;
+
+    TypeEigenvalueSolver::default_solver = TypeEigenvalueSolver::KRYLOV_SCHUR;
+    var_eig.InitMatrix(K);
+    var_eig.SetTypeSpectrum(var_eig.LARGE_EIGENVALUES, 0, var_eig.SORTED_MODULUS);
+    cout << "Testing computation of large eigenvalues of symmetric matrix with Krylov-Schur..." << endl;
+    GetEigenvaluesEigenvectors(var_eig, lambda, lambda_imag, eigen_vec);
+    DISP(lambda);
+
+    CheckEigenvalues(K, lambda, eigen_vec);
+    cout << endl << endl;
+
+    TypeEigenvalueSolver::default_solver = TypeEigenvalueSolver::DEFAULT;
+  }
+
+  {
+    // testing native contour solver on a dense generalized eigenproblem
+    int n = 100;
+    Matrix<double, Symmetric, RowSymPacked> K(n, n), M(n, n);
+    K.Zero(); M.Zero();
+    for (int i = 0; i < n; i++)
+      {
+        K.Val(i, i) = 2.0;
+        M.Val(i, i) = 1.0 + 0.01*i;
+        if (i > 0)
+          K.Val(i-1, i) = -1.0;
+      }
+
+    DenseEigenProblem<double, Symmetric, RowSymPacked> var_eig;
+    var_eig.SetStoppingCriterion(1e-12);
+    var_eig.SetNbAskedEigenvalues(nb_eigenval);
+    var_eig.SetIntervalSpectrum(0.2, 0.5);
+    var_eig.InitMatrix(K, M);
+
+    Vector<double> lambda, lambda_imag;
+    Matrix<double, General, ColMajor> eigen_vec;
+
+    TypeEigenvalueSolver::default_solver = TypeEigenvalueSolver::CONTOUR;
+    cout << "Testing computation of eigenvalues in an interval with contour solver..." << endl;
+    GetEigenvaluesEigenvectors(var_eig, lambda, lambda_imag, eigen_vec);
+    DISP(lambda);
+
+    CheckEigenvalues(K, M, lambda, eigen_vec);
+    cout << endl << endl;
+
+    TypeEigenvalueSolver::default_solver = TypeEigenvalueSolver::DEFAULT;
+  }
+#endif
+
   if (all_test)
     cout << "All tests passed successfully" << endl;
 
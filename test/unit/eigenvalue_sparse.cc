@@ -694,6 +694,103 @@ void TestStandardProblem(MatrixK& K, MatrixM& M, T&,
     }
 }
 
+// eigenvalues of a real nonsymmetric sparse matrix with Krylov-Schur
+// (symmetric and skew-symmetric parts, complex conjugate eigenvalues)
+void TestKrylovSchurProblem(int nb_eigenval)
+{
+  int n = 400;
+  Matrix<double, General, ArrayRowSparse> K(n, n);
+  for (int i = 0; i < n; i++)
+    {
+      K.AddInteraction(i, i, 1.0 + 3.0*i/n + 0.5*cos(0.1*i));
+      if (i > 0)
+        K.AddInteraction(i, i-1, -1.0);
+
+      if (i < n-1)
+        K.AddInteraction(i, i+1, -1.0);
+
+      if (i < n-7)
+        {
+          K.AddInteraction(i, i+7, 0.3);
+          K.AddInteraction(i+7, i, -0.3);
+        }
+    }
+
+  SparseEigenProblem<double, Matrix<double, General, ArrayRowSparse> > var_eig;
+  var_eig.SetStoppingCriterion(1e-12);
+  var_eig.SetNbAskedEigenvalues(nb_eigenval);
+  Vector<double> lambda, lambda_imag;
+  Matrix<double, General, ColMajor> eigen_vec;
+
+  TypeEigenvalueSolver::default_solver = TypeEigenvalueSolver::KRYLOV_SCHUR;
+
+  // largest eigenvalues
+  var_eig.SetComputationalMode(var_eig.REGULAR_MODE);
+  var_eig.SetTypeSpectrum(var_eig.LARGE_EIGENVALUES, 0,
+                          var_eig.SORTED_MODULUS);
+  var_eig.InitMatrix(K);
+  GetEigenvaluesEigenvectors(var_eig, lambda, lambda_imag, eigen_vec);
+  DISP(lambda); DISP(lambda_imag);
+  CheckEigenvalues(K, lambda, lambda_imag, eigen_vec);
+
+  // eigenvalues close to a real shift, K - sigma I is factorized
+  var_eig.SetComputationalMode(var_eig.SHIFTED_MODE);
+  var_eig.SetTypeSpectrum(var_eig.CENTERED_EIGENVALUES, 1.5,
+                          var_eig.SORTED_MODULUS);
+  var_eig.InitMatrix(K);
+  GetEigenvaluesEigenvectors(var_eig, lambda, lambda_imag, eigen_vec);
+  DISP(lambda); DISP(lambda_imag);
+  CheckEigenvalues(K, lambda, lambda_imag, eigen_vec);
+
+  TypeEigenvalueSolver::default_solver = TypeEigenvalueSolver::DEFAULT;
+}
+
+
+// eigenvalues of a real sparse symmetric pencil in an interval
+// (contour solver, z M - K is factorized with complex shifts)
+void TestContourProblem(int nb_eigenval)
+{
+  int n = 100;
+  Matrix<double, Symmetric, ArrayRowSymSparse> K(n, n), M(n, n);
+  for (int i = 0; i < n; i++)
+    {
+      K.AddInteraction(i, i, 2.0);
+      M.AddInteraction(i, i, 1.0 + 0.01*i);
+      if (i > 0)
+        K.AddInteraction(i-1, i, -1.0);
+    }
+
+  SparseEigenProblem<double, Matrix<double, Symmetric, ArrayRowSymSparse> >
+    var_eig;
+  var_eig.SetStoppingCriterion(1e-12);
+  var_eig.SetNbAskedEigenvalues(nb_eigenval);
+  var_eig.SetIntervalSpectrum(0.2, 0.5);
+  var_eig.InitMatrix(K, M);
+
+  Vector<double> lambda, lambda_imag;
+  Matrix<double, General, ColMajor> eigen_vec;
+
+  TypeEigenvalueSolver::default_solver = TypeEigenvalueSolver::CONTOUR;
+  GetEigenvaluesEigenvectors(var_eig, lambda, lambda_imag, eigen_vec);
+  TypeEigenvalueSolver::default_solver = TypeEigenvalueSolver::DEFAULT;
+  DISP(lambda);
+
+  if (lambda.GetM() == 0)
+    {
+      cout << "No eigenvalue found in the interval" << endl;
+      abort();
+    }
+
+  for (int i = 0; i < lambda.GetM(); i++)
+    if ((lambda(i) < 0.2) || (lambda(i) > 0.5))
+      {
+        cout << "Eigenvalue " << lambda(i) << " outside the interval" << endl;
+        abort();
+      }
+
+  CheckEigenvalues(K, M, lambda, eigen_vec);
+}
+
 int main(int argc, char** argv)
 {
 #ifdef SELDON_WITH_MPI
@@ -910,6 +1007,12 @@ int main(int argc, char** argv)
     complex<double> x;
     TestGeneralProblem(K, M, x, true, nb_eigenval);
   }
+
+  // testing Krylov-Schur on a real nonsymmetric sparse problem
+  TestKrylovSchurProblem(nb_eigenval);
+
+  // testing contour solver on a real sparse problem
+  TestContourProblem(10);
   
   if (all_test)
     cout << "All tests passed successfully" << endl;
@@ -462,6 +462,9 @@ void CheckHermitianEigenvalue(Matrix<complex<T>, Prop, Storage, Alloc>& A, int n
   // checking generalized eigenvalues
   Matrix<complex<T> > L, LLc;
   GenerateRandomMatrix(A, n, n);
+  for (int i = 0; i < n; i++)
+    A.Get(i, i) = real(A(i, i));
+  
   GenerateRandomMatrix(L, n, n);
   LLc.Reallocate(n, n);
   MltAdd(complex<T>(1.0, 0.0), SeldonNoTrans, L, SeldonConjTrans, L, complex<T>(0.0, 0.0), LLc);  
@@ -895,6 +898,114 @@ void CheckSylvester(Matrix<T, Prop, Storage, Allocator>& A, int n)
   
 }
 
+template<class T, class Prop, class Storage, class Alloc>
+void CheckNativeEigenvalue(Matrix<T, Prop, Storage, Alloc>& A, int n)
+{
+  typedef typename ClassComplexType<T>::Treal Treal;
+  GenerateRandomMatrix(A, n, n);
+  for (int i = 0; i < n; i++)
+    A.Set(i, i, T(realpart(A(i, i))));
+  
+  // checking GetEigenvaluesEigenvectorsNative against Lapack
+  Matrix<T, Prop, Storage, Alloc> B(A);
+  Vector<Treal> lambda, w;
+  Vector<T> x(n), y(n);
+  Matrix<T, General, ColMajor> V;
+  GetEigenvaluesEigenvectorsNative(A, lambda, V);
+  GetEigenvalues(B, w);
+  B = A;
+  
+  for (int j = 0; j < n; j++)
+    {
+      if (abs(lambda(j) - w(j)) > threshold*max(Treal(1), abs(w(j))))
+        {
+          cout << "GetEigenvaluesEigenvectorsNative incorrect" << endl;
+          abort();
+        }
+      
+      for (int i = 0; i < n; i++)
+        x(i) = V(i, j);
+      
+      // y = A x
+      Mlt(B, x, y);
+      
+      Treal err = 0;
+      for (int i = 0; i < n; i++)
+        err += absSquare(y(i) - lambda(j)*x(i));
+      
+      err = sqrt(err);
+      if (err > threshold*max(Treal(1), abs(lambda(j))))
+        {
+          cout << "Error on eigenvalue " << lambda(j) << endl;
+          cout << "Error = " << err << endl;
+          abort();
+        }
+    }
+  
+  GetEigenvaluesNative(A, w);
+  for (int i = 0; i < n; i++)
+    if (abs(lambda(i) - w(i)) > threshold*max(Treal(1), abs(w(i))))
+      {
+        cout << "GetEigenvaluesNative incorrect" << endl;
+        abort();
+      }
+  
+  // checking GetSVDNative against Lapack
+  T zero, one;
+  SetComplexZero(zero);
+  SetComplexOne(one);
+  for (int m = n-2; m <= n+2; m += 4)
+    {
+      Matrix<T, General, ColMajor> C, D, U, W, Id;
+      Vector<Treal> sigma, sigma_ref;
+      GenerateRandomMatrix(C, m, n);
+      D = C;
+      GetSVDNative(C, sigma, U, W);
+      GetSVD(D, sigma_ref, Id, V);
+      
+      for (int k = 0; k < min(m, n); k++)
+        if (abs(sigma(k) - sigma_ref(k)) > threshold*sigma_ref(0))
+          {
+            cout << "GetSVDNative incorrect" << endl;
+            abort();
+          }
+      
+      Id.Reallocate(m, m);
+      Id.Fill(zero);
+      MltAdd(one, SeldonNoTrans, U, SeldonConjTrans, U, zero, Id);
+      if (!CheckIdentity(Id))
+        {
+          cout << "GetSVDNative" << endl;
+          abort();
+        }
+      
+      Id.Reallocate(n, n);
+      Id.Fill(zero);
+      MltAdd(one, SeldonNoTrans, W, SeldonConjTrans, W, zero, Id);
+      if (!CheckIdentity(Id))
+        {
+          cout << "GetSVDNative" << endl;
+          abort();
+        }
+      
+      // C = U diag(sigma) W
+      D.Reallocate(m, n);
+      for (int i = 0; i < m; i++)
+        for (int j = 0; j < n; j++)
+          {
+            D(i, j) = zero;
+            for (int k = 0; k < min(m, n); k++)
+              D(i, j) += U(i, k)*sigma(k)*W(k, j);
+          }
+      
+      if (!EqualMatrix(C, D))
+        {
+          cout << "GetSVDNative incorrect" << endl;
+          abort();
+        }
+    }
+}
+
 int main(int argc, char** argv)
 {
   srand(0);
@@ -1027,6 +1138,19 @@ int main(int argc, char** argv)
   }    
 
 
+  {
+    Matrix<Real_wp, Symmetric, RowSymPacked> A;
+    int n = 70;
+    CheckNativeEigenvalue(A, n);
+  }    
+
+  {
+    Matrix<Complex_wp, Hermitian, ColHermPacked> A;
+    int n = 60;
+    CheckNativeEigenvalue(A, n);
+  }    
+
+
   if (all_test)
     cout << "All tests passed successfully" << endl;
 
@@ -0,0 +1,134 @@
+// seldon will call abort() when encountering an exception
+#define SELDON_WITH_ABORT
+// no call of srand by Seldon
+#define SELDON_WITHOUT_REINIT_RANDOM
+#define SELDON_CHECK_DIMENSIONS
+#define SELDON_WITH_PRECONDITIONING
+
+// C library for time function and for randomization
+#include <cstdlib>
+#include <ctime>
+
+#include "Seldon.hxx"
+#include "SeldonSolver.hxx"
+
+using namespace Seldon;
+
+template<class T>
+void GetRandNumber(T& x)
+{
+  x = T(rand())/RAND_MAX - T(0.5);
+}
+
+template<class T>
+void GetRandNumber(complex<T>& x)
+{
+  T a, b;
+  GetRandNumber(a);
+  GetRandNumber(b);
+  x = complex<T>(a, b);
+}
+
+template<class T>
+void GenerateRandomVector(Vector<T>& x, int n)
+{
+  x.Reallocate(n);
+  for (int i = 0; i < n; i++)
+    GetRandNumber(x(i));
+}
+
+// diagonally dominant matrix
+template<class T, class Prop, class Storage, class Allocator>
+void GenerateRandomMatrix(Matrix<T, Prop, Storage, Allocator>& A,
+			  int n, int nnz_row)
+{
+  A.Reallocate(n, n);
+  T val;
+  for (int i = 0; i < n; i++)
+    {
+      for (int k = 0; k < nnz_row; k++)
+	{
+	  int j = rand() % n;
+	  GetRandNumber(val);
+	  if (j != i)
+	    A.AddInteraction(i, j, val);
+	}
+
+      A.AddInteraction(i, i, T(2 * nnz_row));
+    }
+}
+
+// without dropping, the incomplete factorization is exact
+template<class T>
+void CheckSymmetricIlut(int n, int type_ilu)
+{
+  Matrix<T, Symmetric, ArrayRowSymSparse> A;
+  GenerateRandomMatrix(A, n, 6);
+  IVect perm(n);
+  perm.Fill();
+
+  IlutPreconditioning<T> mat_lu;
+  mat_lu.SetSymmetricAlgorithm();
+  mat_lu.SetFactorisationType(type_ilu);
+  mat_lu.SetDroppingThreshold(0);
+  mat_lu.SetFillLevel(n);
+  mat_lu.SetAdditionalFillNumber(n);
+  mat_lu.FactorizeMatrix(perm, A, true);
+
+  Vector<T> x, y(n), b(n);
+  GenerateRandomVector(x, n);
+  for (int trans = 0; trans < 2; trans++)
+    {
+      Mlt(A, x, b);
+      y = b;
+      if (trans == 0)
+	mat_lu.Solve(y);
+      else
+	mat_lu.TransSolve(y);
+
+      Add(T(-1), x, y);
+      if (Norm2(y) > 1e-10 * Norm2(x))
+	{
+	  cout << "Solve of symmetric ILUT incorrect for type "
+	       << type_ilu << endl;
+	  abort();
+	}
+
+      // the result does not depend on the number of threads
+      int nb_thread = ParallelContext::GetNumThreads();
+      Vector<T> y_seq(b);
+      y = b;
+      ParallelContext::SetNumThreads(1);
+      mat_lu.Solve(y_seq);
+      ParallelContext::SetNumThreads(4);
+      mat_lu.Solve(y);
+      ParallelContext::SetNumThreads(nb_thread);
+      Add(T(-1), y_seq, y);
+      if (Norm2(y) != 0)
+	{
+	  cout << "Solve of symmetric ILUT depends on the number of threads"
+	       << endl;
+	  abort();
+	}
+    }
+}
+
+int main(int argc, char** argv)
+{
+  srand(time(NULL));
+
+  cout.precision(15);
+
+  int type_ilu[] = {IlutPreconditioning<double>::ILUT,
+		    IlutPreconditioning<double>::ILU_D,
+		    IlutPreconditioning<double>::ILUT_K};
+  for (int k = 0; k < 3; k++)
+    {
+      CheckSymmetricIlut<double>(1000, type_ilu[k]);
+      CheckSymmetricIlut<complex<double> >(1000, type_ilu[k]);
+    }
+
+  cout << "All tests passed successfully" << endl;
+
+  return 0;
+}
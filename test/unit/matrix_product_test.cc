@@ -1233,6 +1233,91 @@ void CheckTriangMatrix(Matrix<T0, Prop0, Storage0, Allocator0>& A, bool lower)
         }
 }
 
+//! Checks products of strided views and of submatrices with index lists.
+template<class T, class Storage>
+void CheckStridedSubMatrix(const T& alpha, const T& beta)
+{
+  int m = 23, n = 17, k = 31;
+  Matrix<T, General, Storage> A(m + 5, k + 4), B(k + 3, n + 6),
+    Bt(n + 2, k + 2), C(m + 4, n + 2), C0, D(m, n);
+
+  for (int i = 0; i < A.GetM(); i++)
+    for (int j = 0; j < A.GetN(); j++)
+      GetRandNumber(A(i, j));
+  for (int i = 0; i < B.GetM(); i++)
+    for (int j = 0; j < B.GetN(); j++)
+      GetRandNumber(B(i, j));
+  for (int i = 0; i < Bt.GetM(); i++)
+    for (int j = 0; j < Bt.GetN(); j++)
+      Bt(i, j) = B(j + 1, i + 2);
+  for (int i = 0; i < C.GetM(); i++)
+    for (int j = 0; j < C.GetN(); j++)
+      GetRandNumber(C(i, j));
+  C0 = C;
+
+  // reference product of A(2:2+m, 3:3+k) with B(1:1+k, 2:2+n)
+  D.Zero();
+  for (int i = 0; i < m; i++)
+    for (int j = 0; j < n; j++)
+      for (int l = 0; l < k; l++)
+        D(i, j) += A(i + 2, l + 3) * B(l + 1, j + 2);
+
+  StridedSubMatrix<Matrix<T, General, Storage> > Av(A, 2, 3, m, k),
+    Bv(B, 1, 2, k, n), Btv(Bt, 0, 0, n, k), Cv(C, 1, 1, m, n);
+
+  MltAdd(alpha, SeldonNoTrans, Av, SeldonTrans, Btv, beta, Cv);
+  for (int i = 0; i < C.GetM(); i++)
+    for (int j = 0; j < C.GetN(); j++)
+      {
+        T val = C0(i, j);
+        if (i >= 1 && i < m + 1 && j >= 1 && j < n + 1)
+          val = beta*C0(i, j) + alpha*D(i - 1, j - 1);
+
+        if ((abs(C(i, j) - val) > threshold) || isnan(abs(C(i, j) - val)))
+          {
+            cout << "MltAdd incorrect for strided views" << endl;
+            abort();
+          }
+      }
+
+  // same product with rows and columns given by index lists
+  Vector<int> row(m), col(n), col_a(k), row_b(k);
+  for (int i = 0; i < m; i++)
+    row(i) = i + 2;
+  for (int j = 0; j < n; j++)
+    col(j) = j + 2;
+  for (int l = 0; l < k; l++)
+    {
+      col_a(l) = l + 3;
+      row_b(l) = l + 1;
+    }
+
+  Matrix<T, General, Storage> E(m + 5, n + 6), E0;
+  for (int i = 0; i < E.GetM(); i++)
+    for (int j = 0; j < E.GetN(); j++)
+      GetRandNumber(E(i, j));
+  E0 = E;
+
+  SubMatrix<Matrix<T, General, Storage> > As(A, row, col_a), Bs(B, row_b, col),
+    Es(E, row, col);
+
+  MltAdd(alpha, As, Bs, beta, Es);
+  for (int i = 0; i < E.GetM(); i++)
+    for (int j = 0; j < E.GetN(); j++)
+      {
+        T val = E0(i, j);
+        if (i >= 2 && i < m + 2 && j >= 2 && j < n + 2)
+          val = beta*E0(i, j) + alpha*D(i - 2, j - 2);
+
+        if ((abs(E(i, j) - val) > threshold) || isnan(abs(E(i, j) - val)))
+          {
+            cout << "MltAdd incorrect for submatrices" << endl;
+            abort();
+          }
+      }
+}
+
+
 int main(int argc, char** argv)
 {
   threshold = 1e-10;
@@ -1624,6 +1709,14 @@ int main(int argc, char** argv)
     Matrix<Complex_wp, General, RowMajor> B;
     CheckHermMatrix(A, B);
   }
+
+  // testing products of strided views and submatrices
+  CheckStridedSubMatrix<Real_wp, ColMajor>(Real_wp(1.3), Real_wp(0.4));
+  CheckStridedSubMatrix<Real_wp, RowMajor>(Real_wp(-0.7), Real_wp(0));
+  CheckStridedSubMatrix<Complex_wp, ColMajor>(Complex_wp(0.5, 1.1),
+                                              Complex_wp(0.3, -0.2));
+  CheckStridedSubMatrix<Complex_wp, RowMajor>(Complex_wp(1.0, 0.0),
+                                              Complex_wp(1.0, 0.0));
   
   cout << "All tests passed successfully" << endl;
 
@@ -0,0 +1,232 @@
+// NewAlloc as default allocator in order to avoid problems
+// with vectors of complex types
+#define SELDON_DEFAULT_ALLOCATOR NewAlloc
+// seldon will call abort() when encountering an exception
+#define SELDON_WITH_ABORT
+// no call of srand by Seldon
+#define SELDON_WITHOUT_REINIT_RANDOM
+
+// C library for time function and for randomization
+#include <cstdlib>
+#include <ctime>
+
+#include "Seldon.hxx"
+#include "SeldonSolver.hxx"
+
+#ifdef SELDON_WITH_CPP11
+#include <thread>
+#endif
+
+using namespace Seldon;
+
+typedef double Real_wp;
+typedef complex<double> Complex_wp;
+
+template<class T>
+void GetRandNumber(T& x)
+{
+  x = T(rand())/RAND_MAX;
+}
+
+template<class T>
+void GetRandNumber(complex<T>& x)
+{
+  x = complex<T>(rand(), rand())/Real_wp(RAND_MAX);
+}
+
+// checks vectors allocated with PoolAlloc
+template<class T>
+void CheckPoolAlloc(size_t n)
+{
+  MemoryPool& pool = MemoryPool::GetDefault();
+  Vector<T, VectFull, PoolAlloc<T> > x(n), y;
+  for (size_t i = 0; i < n; i++)
+    GetRandNumber(x(i));
+
+  y = x;
+  y.Resize(3*n);
+  for (size_t i = 0; i < n; i++)
+    if (y(i) != x(i))
+      {
+	cout << "PoolAlloc: Resize incorrect" << endl;
+	abort();
+      }
+
+  // a released block is reused for the next vector of the same size
+  x.Clear();
+  size_t nb_system = pool.GetNbSystemAllocation();
+  Vector<T, VectFull, PoolAlloc<T> > z(n);
+  if (pool.GetNbSystemAllocation() != nb_system)
+    {
+      cout << "PoolAlloc: block not reused" << endl;
+      abort();
+    }
+}
+
+// checks a workspace
+void CheckWorkspace()
+{
+  MemoryPool pool;
+  size_t n = 1000;
+  {
+    Vector<Real_wp> x;
+    IVect ind;
+    Workspace work(pool);
+    work.GetVector(n, x);
+    work.GetVector(n, ind);
+    Real_wp* tmp = work.Allocate<Real_wp>(10);
+    x.Fill(1.0);
+    ind.Fill(2);
+    tmp[9] = 3.0;
+
+    if ((x.GetM() != n) || (ind.GetM() != n)
+	|| (pool.GetNbAllocation() != 3)
+	|| (pool.GetMemoryUsed() < n*(sizeof(Real_wp) + sizeof(int))))
+      {
+	cout << "Workspace: allocation incorrect" << endl;
+	abort();
+      }
+  }
+
+  if ((pool.GetMemoryUsed() != 0) || (pool.GetCachedMemory() == 0)
+      || (pool.GetPeakMemory() < n*(sizeof(Real_wp) + sizeof(int))))
+    {
+      cout << "Workspace: release incorrect" << endl;
+      abort();
+    }
+
+  // second scope : no new system allocation
+  {
+    Vector<Real_wp> x;
+    Workspace work(pool);
+    work.GetVector(n, x);
+
+    // vectors are emptied when the arrays are given back
+    work.Release();
+    if ((x.GetM() != 0) || (x.GetData() != NULL)
+	|| (pool.GetMemoryUsed() != 0))
+      {
+	cout << "Workspace: vectors not emptied by Release" << endl;
+	abort();
+      }
+  }
+
+  if ((pool.GetNbSystemAllocation() != 3) || (pool.GetNbAllocation() != 4))
+    {
+      cout << "Workspace: blocks not reused" << endl;
+      abort();
+    }
+
+  pool.SetMaxCachedMemory(0);
+  if (pool.GetCachedMemory() != 0)
+    {
+      cout << "MemoryPool: SetMaxCachedMemory incorrect" << endl;
+      abort();
+    }
+}
+
+// repeated factorizations reuse the work arrays
+template<class T>
+void CheckFactorization(int n)
+{
+  Matrix<T, Symmetric, ArrayRowSymSparse> A(n, n), B;
+  for (int i = 0; i < n; i++)
+    {
+      A.AddInteraction(i, i, T(4));
+      if (i < n-1)
+	A.AddInteraction(i, i+1, T(-1));
+    }
+
+  MemoryPool& pool = MemoryPool::GetDefault();
+  B = A;
+  GetCholesky(B);
+  size_t nb_system = pool.GetNbSystemAllocation();
+  B = A;
+  GetCholesky(B);
+  if (pool.GetNbSystemAllocation() != nb_system)
+    {
+      cout << "GetCholesky: work arrays not reused" << endl;
+      abort();
+    }
+
+  Vector<T> x(n), y(n);
+  x.FillRand();
+  Mlt(A, x, y);
+  SolveCholesky(SeldonNoTrans, B, y);
+  SolveCholesky(SeldonTrans, B, y);
+  for (int i = 0; i < n; i++)
+    if (abs(y(i) - x(i)) > 1e-10*abs(x(i)))
+      {
+	cout << "GetCholesky incorrect" << endl;
+	abort();
+      }
+}
+
+#ifdef SELDON_WITH_CPP11
+// workspaces used concurrently by threads that are not OpenMP threads
+void UseWorkspace(int seed, int nb_loop, bool* success)
+{
+  for (int k = 0; k < nb_loop; k++)
+    {
+      size_t n = 100 + (seed * 37 + k * 11) % 2000;
+      Vector<Real_wp> x;
+      Workspace work;
+      work.GetVector(n, x);
+      x.Fill(Real_wp(seed));
+      for (size_t i = 0; i < n; i++)
+	if (x(i) != Real_wp(seed))
+	  *success = false;
+    }
+}
+
+// checks the default pool shared by std::thread
+void CheckThreads()
+{
+  MemoryPool& pool = MemoryPool::GetDefault();
+  size_t memory_used = pool.GetMemoryUsed();
+
+  const int nb_thread = 8;
+  bool success[nb_thread];
+  std::vector<std::thread> thread;
+  for (int i = 0; i < nb_thread; i++)
+    {
+      success[i] = true;
+      thread.push_back(std::thread(UseWorkspace, i, 2000, &success[i]));
+    }
+
+  for (int i = 0; i < nb_thread; i++)
+    {
+      thread[i].join();
+      if (!success[i])
+	{
+	  cout << "Workspace shared between threads incorrect" << endl;
+	  abort();
+	}
+    }
+
+  if (pool.GetMemoryUsed() != memory_used)
+    {
+      cout << "MemoryPool: blocks lost by threads" << endl;
+      abort();
+    }
+}
+#endif
+
+int main(int argc, char** argv)
+{
+  CheckPoolAlloc<Real_wp>(100);
+  CheckPoolAlloc<Complex_wp>(1000);
+  CheckPoolAlloc<int>(7);
+
+  CheckWorkspace();
+
+  CheckFactorization<Real_wp>(200);
+
+#ifdef SELDON_WITH_CPP11
+  CheckThreads();
+#endif
+
+  cout << "All tests passed successfully" << endl;
+
+  return 0;
+}
@@ -0,0 +1,172 @@
+// seldon will call abort() when encountering an exception
+#define SELDON_WITH_ABORT
+// no call of srand by Seldon
+#define SELDON_WITHOUT_REINIT_RANDOM
+
+#include "Seldon.hxx"
+
+// the test is run only if NLopt is available
+#ifdef SELDON_WITH_NLOPT
+#include "computation/optimization/NLoptSolver.cxx"
+#endif
+
+using namespace Seldon;
+
+#ifdef SELDON_WITH_NLOPT
+
+// each parameter has a local minimum close to 1 and a global minimum close
+// to -1
+double DoubleWell(const Vector<double>& x, Vector<double>& gradient, void*)
+{
+  double cost = 0;
+  for (int i = 0; i < int(x.GetM()); i++)
+    {
+      cost += (x(i)*x(i) - 1.) * (x(i)*x(i) - 1.) + 0.2 * x(i);
+      if (gradient.GetM() > 0)
+        gradient(i) = 4. * x(i) * (x(i)*x(i) - 1.) + 0.2;
+    }
+
+  return cost;
+}
+
+
+void DoubleWellBatch(const Matrix<double, General, ColMajor>& x,
+                     Vector<double>& cost, void* argument)
+{
+  Vector<double> parameter(x.GetM()), gradient;
+  for (int j = 0; j < int(x.GetN()); j++)
+    {
+      for (int i = 0; i < int(x.GetM()); i++)
+        parameter(i) = x(i, j);
+      cost(j) = DoubleWell(parameter, gradient, argument);
+    }
+}
+
+
+// minimum of the cost function for one parameter, computed with Newton
+void GetGlobalMinimum(double& x, double& cost)
+{
+  x = -1.;
+  for (int k = 0; k < 20; k++)
+    x -= (4. * x * (x*x - 1.) + 0.2) / (12. * x*x - 4.);
+
+  cost = (x*x - 1.) * (x*x - 1.) + 0.2 * x;
+}
+
+
+void CheckMultiStart(bool batch, bool target)
+{
+  int n = 3;
+  NLoptSolver solver;
+  solver.Initialize(n, "LD_LBFGS", 1e-10, 1e-12);
+
+  Vector<double> lower(n), upper(n), parameter(n);
+  lower.Fill(-2.);
+  upper.Fill(2.);
+  solver.SetLowerBound(lower);
+  solver.SetUpperBound(upper);
+
+  // the initial parameters are in the basin of the local minimum
+  parameter.Fill(1.);
+  solver.SetParameter(parameter);
+
+  double x_min, cost_min;
+  GetGlobalMinimum(x_min, cost_min);
+
+  solver.SetNstart(8);
+  solver.SetNsample(64);
+  solver.SetSeed(1);
+  if (target)
+    solver.SetTargetCost(n * cost_min + 1e-3);
+
+  solver.OptimizeMultiStart(DoubleWell, batch ? DoubleWellBatch : NULL, NULL);
+
+  solver.GetParameter(parameter);
+  if (!target)
+    for (int i = 0; i < n; i++)
+      if (abs(parameter(i) - x_min) > 1e-4)
+        {
+          cout << "OptimizeMultiStart did not find the global minimum" << endl;
+          abort();
+        }
+
+  Vector<double> gradient;
+  double cost = solver.GetCost();
+  if (abs(cost - DoubleWell(parameter, gradient, NULL)) > 1e-12
+      || cost > n * cost_min + (target ? 1e-3 : 1e-8))
+    {
+      cout << "OptimizeMultiStart returned an incorrect cost" << endl;
+      abort();
+    }
+
+  // the sampled points are evaluated
+  if (solver.GetNevaluation() < 64)
+    {
+      cout << "Incorrect number of evaluations" << endl;
+      abort();
+    }
+
+  double time = solver.GetOptimizationTime();
+  double time_to_target = solver.GetTimeToTarget();
+  if (time < 0. || (target && (time_to_target < 0. || time_to_target > time))
+      || (!target && time_to_target != -1.))
+    {
+      cout << "Incorrect optimization times" << endl;
+      abort();
+    }
+}
+
+
+// the starting points only depend on the seed, so that the result does not
+// depend on the number of threads
+void CheckSeed()
+{
+  NLoptSolver solver;
+  solver.Initialize(2, "LN_BOBYQA", 1e-8, 1e-10);
+  Vector<double> parameter(2), parameter_ref;
+  parameter.Fill(1.);
+
+  for (int nb_threads = 1; nb_threads <= 4; nb_threads *= 4)
+    {
+      ParallelContext::SetNumThreads(nb_threads);
+      solver.SetParameter(parameter);
+      solver.SetNstart(4);
+      solver.SetSeed(7);
+      solver.SetStartRadius(2.);
+      solver.OptimizeMultiStart(DoubleWell, NULL);
+      if (nb_threads == 1)
+        solver.GetParameter(parameter_ref);
+      else
+        {
+          Vector<double> x;
+          solver.GetParameter(x);
+          Add(-1., parameter_ref, x);
+          if (Norm2(x) > 1e-6)
+            {
+              cout << "OptimizeMultiStart depends on the number of threads"
+                   << endl;
+              abort();
+            }
+        }
+    }
+}
+
+#endif
+
+
+int main(int argc, char** argv)
+{
+#ifdef SELDON_WITH_NLOPT
+  for (int batch = 0; batch < 2; batch++)
+    for (int target = 0; target < 2; target++)
+      CheckMultiStart(batch == 1, target == 1);
+
+  CheckSeed();
+#else
+  cout << "Seldon is compiled without NLopt, the test is skipped" << endl;
+#endif
+
+  cout << "All tests passed successfully" << endl;
+
+  return 0;
+}
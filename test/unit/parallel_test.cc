@@ -0,0 +1,446 @@
+// seldon will call abort() when encountering an exception
+#define SELDON_WITH_ABORT
+// no call of srand by Seldon
+#define SELDON_WITHOUT_REINIT_RANDOM
+
+// C library for time function and for randomization
+#include <cstdlib>
+#include <ctime>
+
+#include "Seldon.hxx"
+
+#ifdef SELDON_WITH_CPP11
+#include <atomic>
+#include <chrono>
+#include <thread>
+#endif
+
+using namespace Seldon;
+
+typedef double Real_wp;
+typedef complex<double> Complex_wp;
+
+template<class T>
+void GetRandNumber(T& x)
+{
+  x = T(rand())/RAND_MAX;
+}
+
+template<class T>
+void GetRandNumber(complex<T>& x)
+{
+  x = complex<T>(rand(), rand())/Real_wp(RAND_MAX);
+}
+
+
+// counts how many times each iteration is performed
+class CountIteration
+{
+  int* count_;
+
+public:
+  CountIteration(int* count) : count_(count)
+  {
+  }
+
+  void operator()(size_t i0, size_t i1) const
+  {
+    for (size_t i = i0; i < i1; i++)
+      count_[i]++;
+  }
+};
+
+
+// sums the elements of an array
+class SumArray
+{
+  const Real_wp* x_;
+
+public:
+  SumArray(const Real_wp* x) : x_(x)
+  {
+  }
+
+  Real_wp operator()(size_t i0, size_t i1) const
+  {
+    Real_wp sum = 0;
+    for (size_t i = i0; i < i1; i++)
+      sum += x_[i];
+
+    return sum;
+  }
+};
+
+
+// records the number of threads available inside a parallel loop
+class NestedLoop
+{
+  int* nb_threads_;
+
+public:
+  NestedLoop(int* nb_threads) : nb_threads_(nb_threads)
+  {
+  }
+
+  void operator()(size_t i0, size_t i1) const
+  {
+    for (size_t i = i0; i < i1; i++)
+      nb_threads_[i] = ParallelContext::GetNumThreads(1000000);
+  }
+};
+
+
+// throws an exception on the block containing the iteration 10
+class ThrowIteration
+{
+public:
+  void operator()(size_t i0, size_t i1) const
+  {
+    if ((i0 <= 10) && (i1 > 10))
+      throw std::out_of_range("iteration 10");
+  }
+};
+
+
+// same exception for a reduction
+class ThrowSum
+{
+public:
+  Real_wp operator()(size_t i0, size_t i1) const
+  {
+    ThrowIteration()(i0, i1);
+    return Real_wp(i1 - i0);
+  }
+};
+
+
+#ifdef SELDON_WITH_CPP11
+// records the largest number of blocks treated at the same time
+class ConcurrentBlock
+{
+  int* count_;
+  std::atomic<int>* nb_active_;
+  std::atomic<int>* nb_max_;
+
+public:
+  ConcurrentBlock(int* count, std::atomic<int>* nb_active,
+		  std::atomic<int>* nb_max)
+    : count_(count), nb_active_(nb_active), nb_max_(nb_max)
+  {
+  }
+
+  void operator()(size_t i0, size_t i1) const
+  {
+    int nb = ++(*nb_active_);
+    int nb_max = *nb_max_;
+    while ((nb > nb_max) && !nb_max_->compare_exchange_weak(nb_max, nb))
+      ;
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    for (size_t i = i0; i < i1; i++)
+      count_[i]++;
+
+    --(*nb_active_);
+  }
+};
+
+
+void RunConcurrentLoop(int* count, std::atomic<int>* nb_active,
+		       std::atomic<int>* nb_max)
+{
+  ParallelFor(0, 1000, ConcurrentBlock(count, nb_active, nb_max));
+}
+#endif
+
+
+void CheckBlock()
+{
+  size_t size[] = {0, 1, 7, 100, 1001};
+  for (size_t k = 0; k < sizeof(size) / sizeof(size_t); k++)
+    for (int nb_block = 1; nb_block < 9; nb_block++)
+      {
+	size_t next = 3, i0, i1, nmin = size[k], nmax = 0;
+	for (int b = 0; b < nb_block; b++)
+	  {
+	    ParallelContext::GetBlock(3, 3 + size[k], nb_block, b, i0, i1);
+	    if ((i0 != next) || (i1 < i0))
+	      {
+		cout << "GetBlock incorrect" << endl;
+		abort();
+	      }
+
+	    next = i1;
+	    nmin = min(nmin, i1 - i0);
+	    nmax = max(nmax, i1 - i0);
+	  }
+
+	if ((next != 3 + size[k]) || (nmax > nmin + 1))
+	  {
+	    cout << "GetBlock incorrect" << endl;
+	    abort();
+	  }
+      }
+}
+
+
+void CheckParallelFor(int nb_threads)
+{
+  ParallelContext::SetNumThreads(nb_threads);
+  ParallelContext::SetGrainSize(10);
+
+  size_t size[] = {0, 1, 19, 20, 21, 1000, 100003};
+  for (size_t k = 0; k < sizeof(size) / sizeof(size_t); k++)
+    {
+      size_t n = size[k];
+      Vector<int> count(n);
+      count.Zero();
+      ParallelFor(0, n, CountIteration(count.GetData()));
+      for (size_t i = 0; i < n; i++)
+	if (count(i) != 1)
+	  {
+	    cout << "ParallelFor incorrect with " << nb_threads
+		 << " threads" << endl;
+	    abort();
+	  }
+
+      Vector<Real_wp> x(n);
+      Real_wp sum = 0;
+      for (size_t i = 0; i < n; i++)
+	{
+	  GetRandNumber(x(i));
+	  sum += x(i);
+	}
+
+      Real_wp value = ParallelReduce(0, n, SumArray(x.GetData()),
+				     Real_wp(1));
+      if (abs(value - sum - 1) > 1e-12 * (n + 1))
+	{
+	  cout << "ParallelReduce incorrect with " << nb_threads
+	       << " threads" << endl;
+	  abort();
+	}
+
+      // the result does not depend on the run
+      for (int l = 0; l < 5; l++)
+	if (ParallelReduce(0, n, SumArray(x.GetData()), Real_wp(1)) != value)
+	  {
+	    cout << "ParallelReduce is not reproducible" << endl;
+	    abort();
+	  }
+    }
+
+  // grain size: small loops are sequential
+  if (ParallelContext::GetNumThreads(15) != 1)
+    {
+      cout << "GetNumThreads incorrect for a small loop" << endl;
+      abort();
+    }
+
+#ifdef _OPENMP
+  int nb_threads_loop = nb_threads;
+#else
+  int nb_threads_loop = 1;
+#endif
+  if (ParallelContext::GetNumThreads(1000000) != nb_threads_loop)
+    {
+      cout << "GetNumThreads incorrect" << endl;
+      abort();
+    }
+
+  // loops inside a parallel loop are sequential by default
+  Vector<int> nested(100);
+  nested.Fill(-1);
+  ParallelFor(0, 100, NestedLoop(nested.GetData()));
+  for (size_t i = 0; i < 100; i++)
+    if ((nb_threads > 1) && (nested(i) != 1))
+      {
+	cout << "Nested loops should be sequential" << endl;
+	abort();
+      }
+
+  // threads are shared with NESTED_PARALLEL
+  ParallelContext::SetNestedPolicy(ParallelContext::NESTED_PARALLEL);
+  ParallelFor(0, 100, NestedLoop(nested.GetData()));
+  for (size_t i = 0; i < 100; i++)
+    if ((nested(i) < 1) || (nested(i) > nb_threads))
+      {
+	cout << "Nested loops should share the threads" << endl;
+	abort();
+      }
+
+  ParallelContext::SetNestedPolicy(ParallelContext::NESTED_SEQUENTIAL);
+  ParallelContext::SetGrainSize(4096);
+}
+
+
+// the sparse matrix-vector product does not depend on the number of threads
+template<class T>
+void CheckSparseProduct(int n)
+{
+  Vector<size_t> row(5*n), col(5*n);
+  Vector<T> val(5*n);
+  for (int i = 0; i < n; i++)
+    for (int k = 0; k < 5; k++)
+      {
+	row(5*i + k) = i;
+	col(5*i + k) = (i * 7 + k * 13) % n;
+	GetRandNumber(val(5*i + k));
+      }
+
+  Matrix<T, General, RowSparse> A;
+  ConvertMatrix_from_Coordinates(row, col, val, A, 0);
+
+  Vector<T> x(n), y(n), y_ref(n), z(n), z_ref(n);
+  for (int i = 0; i < n; i++)
+    {
+      GetRandNumber(x(i));
+      GetRandNumber(z_ref(i));
+    }
+
+  z = z_ref;
+  ParallelContext::SetNumThreads(1);
+  Mlt(A, x, y_ref);
+  MltAdd(T(2), A, x, T(0.5), z_ref);
+
+  ParallelContext::SetNumThreads(4);
+  ParallelContext::SetGrainSize(16);
+  Mlt(A, x, y);
+  MltAdd(T(2), A, x, T(0.5), z);
+  for (int i = 0; i < n; i++)
+    if ((y(i) != y_ref(i)) || (z(i) != z_ref(i)))
+      {
+	cout << "Parallel sparse product incorrect" << endl;
+	abort();
+      }
+
+  ParallelContext::SetGrainSize(4096);
+  ParallelContext::SetNumThreads(0);
+}
+
+
+#ifdef SELDON_WITH_CPP11
+// the exception thrown by a thread is given to the caller
+void CheckException(int nb_threads)
+{
+  ParallelContext::SetNumThreads(nb_threads);
+  ParallelContext::SetGrainSize(10);
+
+  bool caught = false;
+  try
+    {
+      ParallelFor(0, 1000, ThrowIteration());
+    }
+  catch (std::out_of_range& err)
+    {
+      caught = (string(err.what()) == "iteration 10");
+    }
+
+  if (!caught)
+    {
+      cout << "ParallelFor: exception incorrect" << endl;
+      abort();
+    }
+
+  caught = false;
+  try
+    {
+      ParallelReduce(0, 1000, ThrowSum(), Real_wp(0));
+    }
+  catch (std::out_of_range& err)
+    {
+      caught = (string(err.what()) == "iteration 10");
+    }
+
+  if (!caught)
+    {
+      cout << "ParallelReduce: exception incorrect" << endl;
+      abort();
+    }
+}
+
+
+// loops called by several std::thread share the threads
+void CheckConcurrentLoops(int nb_threads)
+{
+  ParallelContext::SetNumThreads(nb_threads);
+  ParallelContext::SetGrainSize(10);
+
+  const int nb_caller = 4;
+  Vector<int> count[nb_caller];
+  std::atomic<int> nb_active(0), nb_max(0);
+  std::vector<std::thread> thread;
+  for (int i = 0; i < nb_caller; i++)
+    {
+      count[i].Reallocate(1000);
+      count[i].Zero();
+      thread.push_back(std::thread(RunConcurrentLoop, count[i].GetData(),
+				   &nb_active, &nb_max));
+    }
+
+  for (int i = 0; i < nb_caller; i++)
+    {
+      thread[i].join();
+      for (int j = 0; j < 1000; j++)
+	if (count[i](j) != 1)
+	  {
+	    cout << "ParallelFor incorrect when called by several threads"
+		 << endl;
+	    abort();
+	  }
+    }
+
+  // each caller is given at least one thread
+  if (nb_max > nb_threads + nb_caller - 1)
+    {
+      cout << "Loops called by several threads use too many threads" << endl;
+      abort();
+    }
+
+  if (ParallelContext::GetBusyThreads() != 0)
+    {
+      cout << "Threads not released by ParallelFor" << endl;
+      abort();
+    }
+
+  ParallelContext::SetGrainSize(4096);
+}
+#endif
+
+
+int main(int argc, char** argv)
+{
+  srand(time(NULL));
+
+  if (ParallelContext::GetNumThreads() < 1)
+    {
+      cout << "The number of threads should be positive" << endl;
+      abort();
+    }
+
+  CheckBlock();
+
+  for (int nb_threads = 1; nb_threads <= 4; nb_threads++)
+    CheckParallelFor(nb_threads);
+
+#ifdef SELDON_WITH_CPP11
+  for (int nb_threads = 1; nb_threads <= 4; nb_threads++)
+    CheckException(nb_threads);
+
+  CheckConcurrentLoops(4);
+#endif
+
+  ParallelContext::SetNumThreads(0);
+  if (ParallelContext::GetNumThreads()
+      != ParallelContext::GetDefaultNumThreads())
+    {
+      cout << "SetNumThreads(0) should restore the default value" << endl;
+      abort();
+    }
+
+  CheckSparseProduct<Real_wp>(1000);
+  CheckSparseProduct<Complex_wp>(1000);
+
+  cout << "All tests passed successfully" << endl;
+
+  return 0;
+}
@@ -354,7 +354,7 @@ void CheckSymmetricPreconditioning(Matrix<T, Prop, Storage, Allocator>& A)
 	  col_max(i) = j;
       
       for (int j = k; j <= i; j++)
-	col_max(j) = max(col_max(j), i);
+	col_max(j) = max(col_max(j), size_t(i));
     }
   
   for (int i = 0; i < n; i++)
@@ -736,7 +736,7 @@ void CheckGeneralPreconditioning(Matrix<T, Prop, Storage, Allocator>& A)
 	  col_max(i) = j;
       
       for (int j = k; j <= i; j++)
-	col_max(j) = max(col_max(j), i);
+	col_max(j) = max(col_max(j), size_t(i));
     }
   
   col_min.Fill(0); col_max.Fill(n-1);
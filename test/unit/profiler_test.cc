@@ -0,0 +1,286 @@
+// seldon will call abort() when encountering an exception
+#define SELDON_WITH_ABORT
+// no call of srand by Seldon
+#define SELDON_WITHOUT_REINIT_RANDOM
+// profiled regions of Seldon are compiled
+#define SELDON_WITH_PROFILER
+
+// C library for time function and for randomization
+#include <cstdlib>
+#include <ctime>
+
+#include "Seldon.hxx"
+
+using namespace Seldon;
+
+typedef double Real_wp;
+
+template<class T>
+void GetRandNumber(T& x)
+{
+  x = T(rand())/RAND_MAX;
+}
+
+
+// profiled function, as a solve of Seldon
+void ProfiledSolve(int nb_call)
+{
+  SELDON_PROFILE_SOLVE("ProfiledSolve");
+
+  for (int i = 0; i < nb_call; i++)
+    {
+      SELDON_PROFILE("ProfiledKernel");
+      SELDON_PROFILE_COUNT(10., 100.);
+    }
+}
+
+
+// profiled blocks of a parallel loop
+class ProfiledBlock
+{
+public:
+  void operator()(size_t i0, size_t i1) const
+  {
+    SELDON_PROFILE("ProfiledBlock");
+    SELDON_PROFILE_COUNT(double(i1 - i0), 0.);
+  }
+};
+
+
+void CheckRegions()
+{
+  // nothing is recorded while the profiler is disabled
+  Profiler::Clear();
+  ProfiledSolve(3);
+  if (Profiler::GetNbCall("ProfiledKernel") != 0)
+    {
+      cout << "Regions should not be recorded if the profiler is disabled"
+           << endl;
+      abort();
+    }
+
+  Profiler::Enable();
+  ProfiledSolve(3);
+  ProfiledSolve(2);
+  Profiler::Disable();
+  ProfiledSolve(2);
+  if ((Profiler::GetNbCall("ProfiledSolve") != 2)
+      || (Profiler::GetNbCall("ProfiledKernel") != 5)
+      || (Profiler::GetFlops("ProfiledKernel") != 50.)
+      || (Profiler::GetBytes("ProfiledKernel") != 500.)
+      || (Profiler::GetNbCall("Unknown") != 0))
+    {
+      cout << "Number of calls or counters incorrect" << endl;
+      abort();
+    }
+
+  // the time of a region includes the time of nested regions
+  if ((Profiler::GetTime("ProfiledKernel") < 0.)
+      || (Profiler::GetTime("ProfiledSolve")
+          < Profiler::GetTime("ProfiledKernel")))
+    {
+      cout << "Times of nested regions incorrect" << endl;
+      abort();
+    }
+
+  Profiler::Clear();
+  if (Profiler::GetNbCall("ProfiledSolve") != 0)
+    {
+      cout << "Clear should reset the statistics" << endl;
+      abort();
+    }
+}
+
+
+void CheckSeldonRegions()
+{
+  int n = 500;
+  Vector<size_t> row(3*n), col(3*n);
+  Vector<Real_wp> val(3*n);
+  for (int i = 0; i < n; i++)
+    for (int k = 0; k < 3; k++)
+      {
+        row(3*i + k) = i;
+        col(3*i + k) = (i + k * 17) % n;
+        GetRandNumber(val(3*i + k));
+      }
+
+  Matrix<Real_wp, General, RowSparse> A;
+  ConvertMatrix_from_Coordinates(row, col, val, A, 0);
+  size_t nnz = A.GetDataSize();
+
+  Vector<Real_wp> x(n), y(n);
+  x.Fill(1.0);
+  y.Fill(0.);
+
+  Profiler::Clear();
+  Profiler::Enable();
+  Mlt(A, x, y);
+  MltAdd(Real_wp(2), A, x, Real_wp(1), y);
+  MltAdd(Real_wp(2), A, x, Real_wp(1), y);
+  Vector<Real_wp> z(n);
+  Profiler::Disable();
+
+  if ((Profiler::GetNbCall("MltVector(RowSparse)") != 1)
+      || (Profiler::GetNbCall("MltAddVector(RowSparse)") != 2)
+      || (Profiler::GetFlops("MltVector(RowSparse)") != 2. * nnz)
+      || (Profiler::GetFlops("MltAddVector(RowSparse)") != 4. * nnz)
+      || (Profiler::GetBytes("MltVector(RowSparse)")
+          < nnz * (sizeof(Real_wp) + sizeof(size_t))))
+    {
+      cout << "Sparse matrix-vector product not profiled correctly" << endl;
+      abort();
+    }
+
+  if ((Profiler::GetNbCall("Allocate") != 1)
+      || (Profiler::GetBytes("Allocate") != n * sizeof(Real_wp)))
+    {
+      cout << "Allocation not profiled correctly" << endl;
+      abort();
+    }
+
+  Profiler::Clear();
+}
+
+
+void CheckReport()
+{
+  ostringstream report;
+  Profiler::Enable();
+  Profiler::EnableReport(report);
+  ProfiledSolve(4);
+  ProfiledSolve(1);
+  Profiler::DisableReport();
+  ProfiledSolve(1);
+  Profiler::Disable();
+
+  // one report per solve, with the calls of this solve
+  string text = report.str();
+  size_t first = text.find("Profile of ProfiledSolve");
+  size_t second = text.find("Profile of ProfiledSolve", first + 1);
+  if ((first == string::npos) || (second == string::npos)
+      || (text.find("Profile of", second + 1) != string::npos))
+    {
+      cout << "A report should be written after each solve" << endl;
+      abort();
+    }
+
+  istringstream stream(text.substr(second));
+  string line, name;
+  size_t nb_call = 0;
+  while (getline(stream, line))
+    {
+      istringstream words(line);
+      words >> name >> nb_call;
+      if (name == "ProfiledKernel")
+        break;
+    }
+
+  if ((name != "ProfiledKernel") || (nb_call != 1))
+    {
+      cout << "Report of a solve incorrect" << endl;
+      abort();
+    }
+
+  // the global report contains all the calls
+  ostringstream global;
+  Profiler::WriteReport(global);
+  if (global.str().find("ProfiledKernel") == string::npos)
+    {
+      cout << "Report incorrect" << endl;
+      abort();
+    }
+
+  Profiler::Clear();
+}
+
+
+void CheckTrace()
+{
+  Profiler::Clear();
+  Profiler::Enable(true);
+  ProfiledSolve(3);
+  Profiler::Disable();
+
+  ostringstream trace;
+  Profiler::WriteTrace(trace);
+  string text = trace.str();
+  size_t nb_event = 0, pos = 0;
+  while ((pos = text.find("\"ph\": \"X\"", pos)) != string::npos)
+    {
+      nb_event++;
+      pos++;
+    }
+
+  if ((text.find("{\"traceEvents\": [") != 0) || (nb_event != 4)
+      || (text.find("\"name\": \"ProfiledKernel\"") == string::npos)
+      || (text.find("\"flops\": 10.000") == string::npos))
+    {
+      cout << "Trace incorrect" << endl;
+      abort();
+    }
+
+  // calls are still counted once the maximal number of events is reached
+  Profiler::Clear();
+  Profiler::SetMaxNbEvent(2);
+  Profiler::Enable(true);
+  ProfiledSolve(5);
+  Profiler::Disable();
+  trace.str("");
+  Profiler::WriteTrace(trace);
+  text = trace.str();
+  nb_event = 0; pos = 0;
+  while ((pos = text.find("\"ph\": \"X\"", pos)) != string::npos)
+    {
+      nb_event++;
+      pos++;
+    }
+
+  if ((nb_event != 2) || (Profiler::GetNbCall("ProfiledKernel") != 5))
+    {
+      cout << "Maximal number of events not respected" << endl;
+      abort();
+    }
+
+  Profiler::SetMaxNbEvent(1000000);
+  Profiler::Clear();
+}
+
+
+void CheckThreads()
+{
+  ParallelContext::SetNumThreads(4);
+  ParallelContext::SetGrainSize(10);
+  Profiler::Clear();
+  Profiler::Enable(true);
+  ParallelFor(0, 1000, ProfiledBlock());
+  Profiler::Disable();
+
+  size_t nb_block = ParallelContext::GetNumThreads(1000);
+  if ((Profiler::GetNbCall("ProfiledBlock") != nb_block)
+      || (Profiler::GetFlops("ProfiledBlock") != 1000.))
+    {
+      cout << "Regions called by several threads incorrect" << endl;
+      abort();
+    }
+
+  ParallelContext::SetGrainSize(4096);
+  ParallelContext::SetNumThreads(0);
+  Profiler::Clear();
+}
+
+
+int main(int argc, char** argv)
+{
+  srand(time(NULL));
+
+  CheckRegions();
+  CheckSeldonRegions();
+  CheckReport();
+  CheckTrace();
+  CheckThreads();
+
+  cout << "All tests passed successfully" << endl;
+
+  return 0;
+}
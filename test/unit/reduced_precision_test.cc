@@ -0,0 +1,316 @@
+// seldon will call abort() when encountering an exception
+#define SELDON_WITH_ABORT
+// no call of srand by Seldon
+#define SELDON_WITHOUT_REINIT_RANDOM
+#define SELDON_CHECK_DIMENSIONS
+#define SELDON_WITH_PRECONDITIONING
+
+// C library for time function and for randomization
+#include <cstdlib>
+#include <ctime>
+#include <limits>
+
+#include "Seldon.hxx"
+#include "SeldonSolver.hxx"
+
+using namespace Seldon;
+
+template<class T>
+void GetRandNumber(T& x)
+{
+  x = T(rand())/RAND_MAX - T(0.5);
+}
+
+template<class T>
+void GetRandNumber(complex<T>& x)
+{
+  T a, b;
+  GetRandNumber(a);
+  GetRandNumber(b);
+  x = complex<T>(a, b);
+}
+
+template<class T>
+void GenerateRandomVector(Vector<T>& x, int n)
+{
+  x.Reallocate(n);
+  for (int i = 0; i < n; i++)
+    GetRandNumber(x(i));
+}
+
+// diagonally dominant matrix with values of different magnitudes
+// if exact is true, values are multiples of 1/8 (exact in bfloat16)
+template<class T, class Prop, class Storage, class Allocator>
+void GenerateRandomMatrix(Matrix<T, Prop, Storage, Allocator>& A,
+			  int n, int nnz_row, bool exact)
+{
+  A.Reallocate(n, n);
+  for (int i = 0; i < n; i++)
+    {
+      T val;
+      for (int k = 0; k < nnz_row; k++)
+	{
+	  int j = rand() % n;
+	  GetRandNumber(val);
+	  if (exact)
+	    val = T(rand() % 17 - 8) / 8.;
+	  else
+	    val *= pow(10., rand() % 7 - 3);
+
+	  if (j != i)
+	    A.AddInteraction(i, j, val);
+	}
+
+      A.AddInteraction(i, i, T(2 * nnz_row * (exact ? 1 : 1000)));
+    }
+}
+
+// checks the conversion of double to bfloat16
+void CheckBFloat16()
+{
+  // exact values
+  float values[] = {0.f, 1.f, -2.5f, 0.0078125f, 3.0e38f, 1.e-38f};
+  for (int k = 0; k < 6; k++)
+    {
+      float x = float(BFloat16(values[k]));
+      if (abs(x - values[k]) > abs(values[k]) * 0.004f)
+	{
+	  cout << "BFloat16 incorrect for " << values[k] << endl;
+	  abort();
+	}
+    }
+
+  // ties are rounded to even
+  if ((float(BFloat16(1.00390625)) != 1.f)
+      || (float(BFloat16(1.01171875)) != 1.015625f)
+      || (float(BFloat16(-1.00390625f)) != -1.f))
+    {
+      cout << "BFloat16 does not round ties to even" << endl;
+      abort();
+    }
+
+  // a double slightly above a tie is rounded upward (no double rounding)
+  if ((float(BFloat16(1.00390625 + 1e-12)) != 1.0078125f)
+      || (float(BFloat16(-1.00390625 - 1e-12)) != -1.0078125f))
+    {
+      cout << "Double rounding in the conversion of double to BFloat16"
+	   << endl;
+      abort();
+    }
+
+  // overflow, infinity and NaN
+  float inf = numeric_limits<float>::infinity();
+  float nan = numeric_limits<float>::quiet_NaN();
+  float y = BFloat16(3.4e38f), z = BFloat16(-inf), w = BFloat16(nan);
+  if ((y != inf) || (z != -inf) || (w == w))
+    {
+      cout << "BFloat16 incorrect for large values, infinity or NaN" << endl;
+      abort();
+    }
+
+  // random values are rounded to the nearest
+  for (int k = 0; k < 10000; k++)
+    {
+      double x;
+      GetRandNumber(x);
+      x *= pow(2., rand() % 60 - 30);
+      double xb = float(BFloat16(x));
+      if (abs(xb - x) > abs(x) / 256.)
+	{
+	  cout << "BFloat16 incorrect for " << x << endl;
+	  abort();
+	}
+    }
+}
+
+// the entry i of y is compared to the one of y_ref
+// with a relative precision eps on each product a_ij x_j
+template<class T, class T2>
+void CheckProduct(const Vector<T>& y, const Vector<T>& y_ref,
+		  const Matrix<T2, General, RowSparse>& A, const Vector<T>& x,
+		  double eps, const string& name)
+{
+  for (size_t i = 0; i < A.GetM(); i++)
+    {
+      double sum = 0;
+      for (size_t k = A.GetPtr()[i]; k < A.GetPtr()[i+1]; k++)
+	sum += abs(A.GetData()[k]) * abs(x(A.GetInd()[k]));
+
+      if (abs(y(i) - y_ref(i)) > eps * (sum + abs(y_ref(i))))
+	{
+	  cout << name << " incorrect: " << y(i) << " instead of "
+	       << y_ref(i) << endl;
+	  abort();
+	}
+    }
+}
+
+// checks the matrix-vector products for a storage type Tvalue
+template<class T, class Tvalue>
+void CheckMatrixVector(int n, double eps, size_t bytes_per_entry)
+{
+  Matrix<double, General, ArrayRowSparse> A;
+  GenerateRandomMatrix(A, n, 8, false);
+  Matrix<double, General, RowSparse> B;
+  Copy(A, B);
+
+  ReducedPrecisionMatrix<double, General, Tvalue> Ar, Br;
+  Copy(A, Ar);
+  Copy(B, Br);
+  if ((Ar.GetM() != size_t(n)) || (Ar.GetN() != size_t(n))
+      || (Ar.GetDataSize() != size_t(B.GetDataSize()))
+      || (Br.GetDataSize() != size_t(B.GetDataSize())))
+    {
+      cout << "Copy to ReducedPrecisionMatrix incorrect" << endl;
+      abort();
+    }
+
+  // bytes of values and column numbers
+  int64_t bytes = Br.GetMemorySize() - sizeof(Br) - (n + 1) * sizeof(size_t);
+  if (bytes != int64_t(bytes_per_entry * Br.GetDataSize()))
+    {
+      cout << "Unexpected memory size of ReducedPrecisionMatrix" << endl;
+      abort();
+    }
+
+  Vector<T> x, y_ref(n), y(n), z(n);
+  GenerateRandomVector(x, n);
+  Mlt(B, x, y_ref);
+
+  Mlt(Ar, x, y);
+  CheckProduct(y, y_ref, B, x, eps, "Mlt");
+
+  Mlt(Br, x, y);
+  CheckProduct(y, y_ref, B, x, eps, "Mlt");
+
+  // y = 2 z + 3 A x
+  GenerateRandomVector(z, n);
+  y = z;
+  MltAdd(T(3), Br, x, T(2), y);
+  Mlt(T(3), y_ref);
+  Add(T(2), z, y_ref);
+  Mlt(T(3), x);
+  CheckProduct(y, y_ref, B, x, 1.1 * eps, "MltAdd");
+}
+
+// relaxations are the same as RowSparse ones if values are exact
+template<class Tvalue>
+void CheckSor(int n)
+{
+  Matrix<double, General, ArrayRowSparse> A;
+  GenerateRandomMatrix(A, n, 6, true);
+  Matrix<double, General, RowSparse> B;
+  Copy(A, B);
+  ReducedPrecisionMatrix<double, General, Tvalue> Br;
+  Copy(B, Br);
+
+  Vector<double> b, x_ref(n), x(n);
+  GenerateRandomVector(b, n);
+  int type_ssor[] = {0, 2, 3};
+  for (int k = 0; k < 3; k++)
+    {
+      x_ref.Zero();
+      x.Zero();
+      SorVector(B, x_ref, b, 1.2, 3, type_ssor[k]);
+      SorVector(Br, x, b, 1.2, 3, type_ssor[k]);
+      for (int i = 0; i < n; i++)
+	if (abs(x(i) - x_ref(i)) > 1e-14 * abs(x_ref(i)))
+	  {
+	    cout << "SorVector incorrect: " << x(i) << " instead of "
+		 << x_ref(i) << endl;
+	    abort();
+	  }
+    }
+}
+
+// incomplete factorisation with factors in single precision
+template<class T, class Prop, class Storage>
+void CheckIlut(int n, int type_ilu)
+{
+  Matrix<T, Prop, Storage> A;
+  GenerateRandomMatrix(A, n, 6, false);
+  IVect perm(n);
+  perm.Fill();
+
+  IlutPreconditioning<T> mat_lu, mat_lu_single;
+  mat_lu.SetFactorisationType(type_ilu);
+  mat_lu_single.SetFactorisationType(type_ilu);
+  if (IsSymmetricMatrix(A))
+    {
+      mat_lu.SetSymmetricAlgorithm();
+      mat_lu_single.SetSymmetricAlgorithm();
+    }
+
+  mat_lu_single.SetSinglePrecisionFactors();
+  if (!mat_lu_single.UseSinglePrecisionFactors())
+    {
+      cout << "SetSinglePrecisionFactors incorrect" << endl;
+      abort();
+    }
+
+  mat_lu.FactorizeMatrix(perm, A, true);
+  mat_lu_single.FactorizeMatrix(perm, A, true);
+  if (mat_lu_single.GetMemorySize() >= mat_lu.GetMemorySize())
+    {
+      cout << "Factors in single precision do not reduce memory" << endl;
+      abort();
+    }
+
+  Vector<T> x, y;
+  GenerateRandomVector(x, n);
+  for (int trans = 0; trans < 2; trans++)
+    {
+      Vector<T> y_ref(x);
+      y = x;
+      if (trans == 0)
+	{
+	  mat_lu.Solve(y_ref);
+	  mat_lu_single.Solve(y);
+	}
+      else
+	{
+	  mat_lu.TransSolve(y_ref);
+	  mat_lu_single.TransSolve(y);
+	}
+
+      Add(T(-1), y_ref, y);
+      if (Norm2(y) > 1e-5 * Norm2(y_ref))
+	{
+	  cout << "Solve with factors in single precision incorrect" << endl;
+	  abort();
+	}
+    }
+}
+
+int main(int argc, char** argv)
+{
+  srand(time(NULL));
+
+  cout.precision(15);
+
+  CheckBFloat16();
+
+  // products accumulated in double, only values are rounded
+  CheckMatrixVector<double, float>(1000, 1e-7, 8);
+  CheckMatrixVector<double, BFloat16>(1000, 4e-3, 6);
+  CheckMatrixVector<complex<double>, float>(1000, 1e-7, 8);
+  CheckMatrixVector<complex<double>, BFloat16>(1000, 4e-3, 6);
+
+  CheckSor<float>(500);
+  CheckSor<BFloat16>(500);
+
+  int type_ilu[] = {IlutPreconditioning<double>::ILUT,
+		    IlutPreconditioning<double>::ILU_0};
+  for (int k = 0; k < 2; k++)
+    {
+      CheckIlut<double, General, ArrayRowSparse>(500, type_ilu[k]);
+      CheckIlut<complex<double>, General, ArrayRowSparse>(500, type_ilu[k]);
+    }
+
+  CheckIlut<double, Symmetric, ArrayRowSymSparse>
+    (500, IlutPreconditioning<double>::ILU_0);
+
+  cout << "All tests passed successfully" << endl;
+
+  return 0;
+}
@@ -0,0 +1,307 @@
+// seldon will call abort() when encountering an exception
+#define SELDON_WITH_ABORT
+// no call of srand by Seldon
+#define SELDON_WITHOUT_REINIT_RANDOM
+
+// C library for time function and for randomization
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <limits>
+
+#include "Seldon.hxx"
+
+using namespace Seldon;
+
+template<class T>
+void GetRandNumber(T& x)
+{
+  // values of very different magnitudes
+  x = (T(rand())/RAND_MAX - T(0.5)) * pow(T(2), T(rand() % 40 - 20));
+}
+
+template<class T>
+void GetRandNumber(complex<T>& x)
+{
+  T a, b;
+  GetRandNumber(a);
+  GetRandNumber(b);
+  x = complex<T>(a, b);
+}
+
+template<class T>
+void GenerateRandomVector(Vector<T>& x, size_t n)
+{
+  x.Reallocate(n);
+  for (size_t i = 0; i < n; i++)
+    GetRandNumber(x(i));
+}
+
+long double ToLongDouble(float x)
+{
+  return x;
+}
+
+long double ToLongDouble(double x)
+{
+  return x;
+}
+
+complex<long double> ToLongDouble(const complex<float>& x)
+{
+  return complex<long double>(real(x), imag(x));
+}
+
+complex<long double> ToLongDouble(const complex<double>& x)
+{
+  return complex<long double>(real(x), imag(x));
+}
+
+long double ConjLongDouble(long double x)
+{
+  return x;
+}
+
+complex<long double> ConjLongDouble(const complex<long double>& x)
+{
+  return conj(x);
+}
+
+long double AbsLongDouble(long double x)
+{
+  return abs(x);
+}
+
+long double AbsLongDouble(const complex<long double>& x)
+{
+  return abs(real(x)) + abs(imag(x));
+}
+
+// true if the two values have the same bits
+template<class T>
+bool SameBits(const T& x, const T& y)
+{
+  return memcmp(&x, &y, sizeof(T)) == 0;
+}
+
+template<class T, class Tref>
+void CheckClose(const T& x, const Tref& y, long double scale,
+		const string& name)
+{
+  typedef typename ClassComplexType<T>::Treal Treal;
+  if (abs(ToLongDouble(x) - y) > 4 * numeric_limits<Treal>::epsilon() * scale)
+    {
+      cout << name << " incorrect: " << x << " instead of " << y << endl;
+      abort();
+    }
+}
+
+// the three reductions computed in deterministic mode
+template<class T>
+class Reduction
+{
+public:
+  T dot, dot_conj;
+  typename ClassComplexType<T>::Treal norm;
+
+  Reduction(const Vector<T>& x, const Vector<T>& y)
+  {
+    dot = DotProd(x, y);
+    dot_conj = DotProdConj(x, y);
+    norm = Norm2(x);
+  }
+
+  bool operator==(const Reduction<T>& r) const
+  {
+    return SameBits(dot, r.dot) && SameBits(dot_conj, r.dot_conj)
+      && SameBits(norm, r.norm);
+  }
+};
+
+// checks the accuracy and the reproducibility of the reductions
+template<class T>
+void CheckReduction(size_t n)
+{
+  Vector<T> x, y;
+  GenerateRandomVector(x, n);
+  GenerateRandomVector(y, n);
+
+  // the errors are relative to the sums of the moduli
+  typedef typename ClassComplexType<T>::Treal Treal;
+  complex<long double> dot = 0, dot_conj = 0;
+  long double norm = 0, abs_dot = 0;
+  for (size_t i = 0; i < n; i++)
+    {
+      dot += ToLongDouble(x(i)) * ToLongDouble(y(i));
+      dot_conj += ConjLongDouble(ToLongDouble(x(i))) * ToLongDouble(y(i));
+      abs_dot += AbsLongDouble(ToLongDouble(x(i)))
+	* AbsLongDouble(ToLongDouble(y(i)));
+      norm += pow(abs(ToLongDouble(x(i))), 2);
+    }
+
+  ParallelContext::SetDeterministic(true);
+  int nb_thread = ParallelContext::GetNumThreads();
+  ParallelContext::SetNumThreads(1);
+  Reduction<T> ref(x, y);
+
+  // the results are rounded once, the tolerance includes the rounding
+  // errors of the reference
+  long double error_ref = n * abs_dot * numeric_limits<long double>::epsilon()
+    / numeric_limits<Treal>::epsilon();
+  CheckClose(complex<Treal>(ref.dot), dot, abs(dot) + error_ref, "DotProd");
+  CheckClose(complex<Treal>(ref.dot_conj), dot_conj,
+	     abs(dot_conj) + error_ref, "DotProdConj");
+  CheckClose(ref.norm, sqrt(norm), sqrt(norm), "Norm2");
+
+  // same bits with any number of threads
+  for (int k = 2; k <= 8; k++)
+    {
+      ParallelContext::SetNumThreads(k);
+      if (!(Reduction<T>(x, y) == ref))
+	{
+	  cout << "Results with " << k << " threads differ from the result"
+	       << " with one thread" << endl;
+	  abort();
+	}
+    }
+
+  // same bits with any instruction set
+  int type = SimdInstructionSet::GetCurrent();
+  for (int k = SimdInstructionSet::SCALAR;
+       k <= SimdInstructionSet::GetSupported(); k++)
+    {
+      SimdInstructionSet::SetCurrent(k);
+      if (!(Reduction<T>(x, y) == ref))
+	{
+	  cout << "Results with instruction set "
+	       << SimdInstructionSet::GetName(k) << " differ" << endl;
+	  abort();
+	}
+    }
+
+  SimdInstructionSet::SetCurrent(type);
+
+  // same bits if the elements are permuted
+  Vector<T> xp(n), yp(n);
+  for (size_t i = 0; i < n; i++)
+    {
+      xp(i) = x(n - 1 - i);
+      yp(i) = y(n - 1 - i);
+    }
+
+  if (!(Reduction<T>(xp, yp) == ref))
+    {
+      cout << "Results differ for permuted vectors" << endl;
+      abort();
+    }
+
+  ParallelContext::SetNumThreads(nb_thread);
+  ParallelContext::SetDeterministic(false);
+}
+
+// checks a sum with a catastrophic cancellation
+template<class T>
+void CheckCancellation(size_t n)
+{
+  // large values and their opposites, randomly shuffled, with three ones
+  Vector<T> x(2 * n + 3), y(2 * n + 3);
+  for (size_t i = 0; i < n; i++)
+    {
+      GetRandNumber(x(i));
+      x(i) *= T(1e6);
+      x(n + i) = -x(i);
+    }
+
+  for (size_t i = 2 * n; i < 2 * n + 3; i++)
+    x(i) = T(1);
+
+  for (size_t i = x.GetM() - 1; i > 0; i--)
+    swap(x(i), x(rand() % (i + 1)));
+
+  y.Fill(T(1));
+  ParallelContext::SetDeterministic(true);
+  T value = DotProd(x, y);
+  ParallelContext::SetDeterministic(false);
+  if (value != T(3))
+    {
+      cout << "DotProd incorrect with cancellations: " << value
+	   << " instead of 3" << endl;
+      abort();
+    }
+}
+
+// checks the 2-norm of large and small values, Inf and NaN
+template<class T>
+void CheckSpecialValues(size_t n)
+{
+  ParallelContext::SetDeterministic(true);
+  typedef typename ClassComplexType<T>::Treal Treal;
+  // the squares of the first two values overflow or underflow
+  Treal values[] = {numeric_limits<Treal>::max() / Treal(4 * n),
+		    Treal(10) * numeric_limits<Treal>::min(), Treal(0)};
+  Vector<T> x(n);
+  for (int k = 0; k < 3; k++)
+    {
+      x.Fill(T(values[k]));
+      long double ref = sqrt(pow(AbsLongDouble(ToLongDouble(T(values[k]))),
+				 2) * n);
+      CheckClose(Norm2(x), ref, ref, "Norm2");
+    }
+
+  x.Fill(T(1));
+  x(n / 2) = numeric_limits<Treal>::infinity();
+  if (Norm2(x) != numeric_limits<Treal>::infinity())
+    {
+      cout << "Norm2 incorrect with infinite value" << endl;
+      abort();
+    }
+
+  x(n / 3) = numeric_limits<Treal>::quiet_NaN();
+  x(n / 2) = T(1);
+  Treal value = Norm2(x);
+  T dot = DotProd(x, x);
+  if (value == value || dot == dot)
+    {
+      cout << "Norm2 or DotProd incorrect with NaN" << endl;
+      abort();
+    }
+
+  ParallelContext::SetDeterministic(false);
+}
+
+template<class T>
+void CheckAllReductions()
+{
+  size_t size[] = {0, 1, 2, 3, 7, 17, 64, 1001, 50003, 200001};
+  for (size_t k = 0; k < sizeof(size) / sizeof(size_t); k++)
+    {
+      CheckReduction<T>(size[k]);
+      CheckReduction<complex<T> >(size[k]);
+    }
+
+  CheckCancellation<T>(10000);
+  CheckSpecialValues<T>(1000);
+  CheckSpecialValues<complex<T> >(1000);
+}
+
+int main(int argc, char** argv)
+{
+  srand(time(NULL));
+
+  cout.precision(15);
+
+  // default mode given by the environment
+  char* mode = getenv("SELDON_DETERMINISTIC");
+  if (ParallelContext::IsDeterministic() != (mode != NULL && atoi(mode) > 0))
+    {
+      cout << "Deterministic mode not set by SELDON_DETERMINISTIC" << endl;
+      abort();
+    }
+
+  CheckAllReductions<float>();
+  CheckAllReductions<double>();
+
+  cout << "All tests passed successfully" << endl;
+
+  return 0;
+}
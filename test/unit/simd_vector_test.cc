@@ -0,0 +1,246 @@
+// seldon will call abort() when encountering an exception
+#define SELDON_WITH_ABORT
+// no call of srand by Seldon
+#define SELDON_WITHOUT_REINIT_RANDOM
+
+// C library for time function and for randomization
+#include <cstdlib>
+#include <ctime>
+#include <limits>
+
+#include "Seldon.hxx"
+
+using namespace Seldon;
+
+template<class T>
+void GetRandNumber(T& x)
+{
+  x = T(rand())/RAND_MAX - T(0.5);
+}
+
+template<class T>
+void GetRandNumber(complex<T>& x)
+{
+  T a, b;
+  GetRandNumber(a);
+  GetRandNumber(b);
+  x = complex<T>(a, b);
+}
+
+template<class T>
+void GenerateRandomVector(Vector<T>& x, size_t n)
+{
+  x.Reallocate(n);
+  for (size_t i = 0; i < n; i++)
+    GetRandNumber(x(i));
+}
+
+// conversion to long double for reference values
+template<class T>
+class LongDouble
+{
+public:
+  typedef long double Type;
+};
+
+template<class T>
+class LongDouble<complex<T> >
+{
+public:
+  typedef complex<long double> Type;
+};
+
+long double ToLongDouble(float x)
+{
+  return x;
+}
+
+long double ToLongDouble(double x)
+{
+  return x;
+}
+
+complex<long double> ToLongDouble(const complex<float>& x)
+{
+  return complex<long double>(real(x), imag(x));
+}
+
+complex<long double> ToLongDouble(const complex<double>& x)
+{
+  return complex<long double>(real(x), imag(x));
+}
+
+long double ConjLongDouble(long double x)
+{
+  return x;
+}
+
+complex<long double> ConjLongDouble(const complex<long double>& x)
+{
+  return conj(x);
+}
+
+long double AbsSquare(long double x)
+{
+  return x * x;
+}
+
+long double AbsSquare(const complex<long double>& x)
+{
+  return norm(x);
+}
+
+template<class T>
+void CheckClose(const T& x, long double y, long double scale,
+		const string& name)
+{
+  if (abs(ToLongDouble(x) - y) > 100 * numeric_limits<T>::epsilon() * scale)
+    {
+      cout << name << " incorrect: " << x << " instead of " << y << endl;
+      abort();
+    }
+}
+
+template<class T>
+void CheckClose(const complex<T>& x, const complex<long double>& y,
+		long double scale, const string& name)
+{
+  if (abs(ToLongDouble(x) - y) > 100 * numeric_limits<T>::epsilon() * scale)
+    {
+      cout << name << " incorrect: " << x << " instead of " << y << endl;
+      abort();
+    }
+}
+
+// compares the kernels of the current instruction set with long double loops
+template<class T, class Treal>
+void CheckSimdKernel(const T& alpha, const Treal& beta, size_t n)
+{
+  string name = SimdInstructionSet::GetName(SimdInstructionSet::GetCurrent());
+  Vector<T> x, y, z;
+  GenerateRandomVector(x, n);
+  GenerateRandomVector(y, n);
+
+  long double norm1 = 0, norm2 = 0;
+  typename LongDouble<T>::Type dot = 0, dot_conj = 0;
+  for (size_t i = 0; i < n; i++)
+    {
+      dot += ToLongDouble(x(i)) * ToLongDouble(y(i));
+      dot_conj += ConjLongDouble(ToLongDouble(x(i))) * ToLongDouble(y(i));
+      norm1 += sqrt(AbsSquare(ToLongDouble(x(i))));
+      norm2 += AbsSquare(ToLongDouble(x(i)));
+    }
+
+  CheckClose(DotProd(x, y), dot, n, name + " DotProd");
+  CheckClose(DotProdConj(x, y), dot_conj, n, name + " DotProdConj");
+  CheckClose(Norm1(x), norm1, n, name + " Norm1");
+  CheckClose(Norm2(x), sqrt(norm2), n, name + " Norm2");
+
+  z = y;
+  Add(alpha, x, z);
+  for (size_t i = 0; i < n; i++)
+    CheckClose(z(i), ToLongDouble(y(i)) + ToLongDouble(alpha)
+	       * ToLongDouble(x(i)), 1, name + " Add");
+
+  z = x;
+  Mlt(alpha, z);
+  for (size_t i = 0; i < n; i++)
+    CheckClose(z(i), ToLongDouble(alpha) * ToLongDouble(x(i)), 1,
+	       name + " Mlt");
+
+  z = x;
+  Mlt(beta, z);
+  for (size_t i = 0; i < n; i++)
+    CheckClose(z(i), ToLongDouble(beta) * ToLongDouble(x(i)), 1,
+	       name + " Mlt");
+}
+
+// checks that Norm1 and Norm2 neither overflow nor underflow
+template<class T, class Treal>
+void CheckNorm2(const Treal& x0, size_t n)
+{
+  string name = SimdInstructionSet::GetName(SimdInstructionSet::GetCurrent());
+  Vector<T> x(n);
+  x.Fill(x0);
+  Treal value = Norm2(x);
+  long double ref = sqrt(AbsSquare(ToLongDouble(T(x0))) * n);
+  // subnormal results cannot be more accurate than denorm_min
+  if (abs(value - ref) > 10 * numeric_limits<Treal>::epsilon() * ref
+      + numeric_limits<Treal>::denorm_min())
+    {
+      cout << name << " Norm2 incorrect for " << x0 << ": " << value
+	   << " instead of " << ref << endl;
+      abort();
+    }
+
+  value = Norm1(x);
+  ref = sqrt(AbsSquare(ToLongDouble(T(x0)))) * n;
+  if (abs(value - ref) > 10 * numeric_limits<Treal>::epsilon() * ref
+      + numeric_limits<Treal>::denorm_min())
+    {
+      cout << name << " Norm1 incorrect for " << x0 << ": " << value
+	   << " instead of " << ref << endl;
+      abort();
+    }
+
+  x(n / 2) = numeric_limits<Treal>::infinity();
+  if (Norm2(x) != numeric_limits<Treal>::infinity())
+    {
+      cout << name << " Norm2 incorrect with infinite value" << endl;
+      abort();
+    }
+
+  x(n / 3) = numeric_limits<Treal>::quiet_NaN();
+  value = Norm2(x);
+  if (value == value)
+    {
+      cout << name << " Norm2 incorrect with NaN" << endl;
+      abort();
+    }
+}
+
+template<class T>
+void CheckAllKernels()
+{
+  size_t size[] = {0, 1, 2, 3, 5, 7, 8, 15, 16, 17, 31, 32, 33, 63, 64, 65,
+		   127, 1001};
+  for (size_t k = 0; k < sizeof(size) / sizeof(size_t); k++)
+    {
+      CheckSimdKernel(T(0.7), T(-1.3), size[k]);
+      CheckSimdKernel(complex<T>(0.7, -0.4), T(-1.3), size[k]);
+    }
+
+  T big = T(0.1) * sqrt(numeric_limits<T>::max());
+  T small = T(10) * sqrt(numeric_limits<T>::min());
+  T subnormal = T(4) * numeric_limits<T>::denorm_min();
+  for (size_t n = 5; n < 70; n += 19)
+    {
+      CheckNorm2<T>(big * T(100), n);
+      CheckNorm2<T>(small / T(100), n);
+      CheckNorm2<T>(subnormal, n);
+      CheckNorm2<complex<T> >(big * T(100), n);
+      CheckNorm2<complex<T> >(small / T(100), n);
+    }
+}
+
+int main(int argc, char** argv)
+{
+  srand(time(NULL));
+
+  cout.precision(15);
+
+  int supported = SimdInstructionSet::GetSupported();
+  cout << "Supported instruction set: "
+       << SimdInstructionSet::GetName(supported) << endl;
+
+  for (int type = SimdInstructionSet::SCALAR; type <= supported; type++)
+    {
+      SimdInstructionSet::SetCurrent(type);
+      CheckAllKernels<float>();
+      CheckAllKernels<double>();
+    }
+
+  cout << "All tests passed successfully" << endl;
+
+  return 0;
+}
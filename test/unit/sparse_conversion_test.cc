@@ -0,0 +1,148 @@
+// NewAlloc as default allocator in order to avoid problems
+// with vectors of complex types
+#define SELDON_DEFAULT_ALLOCATOR NewAlloc
+// seldon will call abort() when encountering an exception
+#define SELDON_WITH_ABORT
+// no call of srand by Seldon
+#define SELDON_WITHOUT_REINIT_RANDOM
+
+// C library for time function and for randomization
+#include <cstdlib>
+#include <ctime>
+
+#include "Seldon.hxx"
+
+using namespace Seldon;
+
+typedef double Real_wp;
+
+// checks radix sort and cumulative sum
+void CheckRadixSort(size_t nb, size_t key_max)
+{
+  Vector<size_t> X(nb), Y(nb);
+  Vector<Real_wp> Z(nb);
+  for (size_t i = 0; i < nb; i++)
+    {
+      X(i) = size_t(rand()) % key_max;
+      Y(i) = size_t(rand()) % 100;
+      Z(i) = Real_wp(X(i)) * 1000 + Real_wp(Y(i));
+    }
+
+  RadixSort(X, Y, Z);
+  for (size_t i = 0; i < nb; i++)
+    {
+      if (Z(i) != Real_wp(X(i)) * 1000 + Real_wp(Y(i)))
+	{
+	  cout << "RadixSort: values not permuted" << endl;
+	  abort();
+	}
+
+      if ((i > 0) && ((X(i) < X(i-1)) || ((X(i) == X(i-1))
+                                          && (Y(i) < Y(i-1)))))
+	{
+	  cout << "RadixSort: vectors not sorted" << endl;
+	  abort();
+	}
+    }
+
+  Vector<long> S(nb);
+  S.Fill(1);
+  CumulativeSum(S);
+  for (size_t i = 0; i < nb; i++)
+    if (S(i) != long(i+1))
+      {
+	cout << "CumulativeSum incorrect" << endl;
+	abort();
+      }
+}
+
+// checks the conversions of a random sparse matrix
+void CheckConversion(size_t m, size_t n, size_t nnz)
+{
+  Matrix<Real_wp, General, RowMajor> Aref(m, n);
+  Aref.Zero();
+  Vector<size_t> IndRow(nnz), IndCol(nnz);
+  Vector<Real_wp> Val(nnz);
+  for (size_t k = 0; k < nnz; k++)
+    {
+      // no duplicate
+      size_t i, j;
+      do
+	{
+	  i = size_t(rand()) % m;
+	  j = size_t(rand()) % n;
+	}
+      while (Aref(i, j) != Real_wp(0));
+
+      IndRow(k) = i; IndCol(k) = j;
+      Val(k) = Real_wp(rand() + 1) / RAND_MAX;
+      Aref(i, j) = Val(k);
+    }
+
+  Matrix<Real_wp, General, RowSparse> A;
+  ConvertMatrix_from_Coordinates(IndRow, IndCol, Val, A, 0);
+  size_t* ptr = A.GetPtr();
+  size_t* ind = A.GetInd();
+  if ((A.GetM() != m) || (A.GetDataSize() != nnz))
+    {
+      cout << "ConvertMatrix_from_Coordinates: wrong size" << endl;
+      abort();
+    }
+
+  for (size_t i = 0; i < m; i++)
+    for (size_t k = ptr[i]; k < ptr[i+1]; k++)
+      if (((k > ptr[i]) && (ind[k] <= ind[k-1]))
+	  || (A.GetData()[k] != Aref(i, ind[k])))
+	{
+	  cout << "ConvertMatrix_from_Coordinates incorrect" << endl;
+	  abort();
+	}
+
+  // CSC format
+  General sym;
+  Vector<size_t> Ptr, Ind;
+  Vector<Real_wp> Value;
+  ConvertToCSC(A, sym, Ptr, Ind, Value, false);
+  if ((Ptr.GetM() != A.GetN()+1) || (Ptr(A.GetN()) != A.GetDataSize()))
+    {
+      cout << "ConvertToCSC: wrong size" << endl;
+      abort();
+    }
+
+  for (size_t j = 0; j < A.GetN(); j++)
+    for (size_t k = Ptr(j); k < Ptr(j+1); k++)
+      if (((k > Ptr(j)) && (Ind(k) <= Ind(k-1)))
+	  || (Value(k) != Aref(Ind(k), j)))
+	{
+	  cout << "ConvertToCSC incorrect" << endl;
+	  abort();
+	}
+
+  // transpose
+  Matrix<Real_wp, General, RowSparse> B;
+  Transpose(A, B);
+  ptr = B.GetPtr();
+  ind = B.GetInd();
+  for (size_t j = 0; j < B.GetM(); j++)
+    for (size_t k = ptr[j]; k < ptr[j+1]; k++)
+      if ((ind[k] != Ind(k)) || (B.GetData()[k] != Value(k)))
+	{
+	  cout << "Transpose incorrect" << endl;
+	  abort();
+	}
+}
+
+int main(int argc, char** argv)
+{
+  CheckRadixSort(1, 10);
+  CheckRadixSort(1000, 7);
+  CheckRadixSort(100000, 1000000);
+
+  CheckConversion(10, 10, 30);
+  CheckConversion(1000, 300, 20000);
+  CheckConversion(5000, 5000, 100000);
+
+  cout << "All tests passed successfully" << endl;
+
+  return 0;
+}
@@ -23,6 +23,7 @@
 using namespace Seldon;
 
 #include "vector/Vector2.cxx"
+#include "vector/PackedVector2.cxx"
 
 
 class Vector2Test: public CppUnit::TestFixture
@@ -30,6 +31,7 @@ class Vector2Test: public CppUnit::TestFixture
   CPPUNIT_TEST_SUITE(Vector2Test);
   CPPUNIT_TEST(test_reallocate);
   CPPUNIT_TEST(test_fill);
+  CPPUNIT_TEST(test_packed);
   CPPUNIT_TEST_SUITE_END();
 
 protected:
@@ -62,6 +64,13 @@ public:
   }
 
 
+  void test_packed()
+  {
+    length1_ = 10;
+    packed();
+  }
+
+
   void reallocate()
   {
     int i;
@@ -132,4 +141,44 @@ public:
           CPPUNIT_ASSERT(V.GetVector(i)(j) == double(j));
         }
   }
+
+
+  void packed()
+  {
+    int i, j;
+    Vector<size_t> length(length1_);
+    for (i = 0; i < length1_; i++)
+      length(i) = i % 4;
+
+    Vector2<double> V(length);
+    for (i = 0; i < length1_; i++)
+      V(i).Fill();
+
+    PackedVector2<double> P;
+    P.Copy(V);
+    CPPUNIT_ASSERT(P.HasSameShape(V));
+    CPPUNIT_ASSERT(P.GetNelement() == V.GetNelement());
+    for (i = 0; i < length1_; i++)
+      for (j = 0; j < int(V.GetLength(i)); j++)
+        CPPUNIT_ASSERT(P(i, j) == V(i, j));
+
+    Vector<double> data, view;
+    V.Flatten(data);
+    P.FlattenView(view);
+    CPPUNIT_ASSERT(view.GetM() == data.GetM());
+    for (i = 0; i < int(data.GetM()); i++)
+      CPPUNIT_ASSERT(view(i) == data(i));
+    view.Nullify();
+
+    Vector<double> X(3);
+    X.Fill();
+    V.Select(2, 7);
+    P.Select(2, 7);
+    V.PushBack(X);
+    P.PushBack(X);
+    CPPUNIT_ASSERT(P.HasSameShape(V));
+    for (i = 0; i < int(V.GetLength()); i++)
+      for (j = 0; j < int(V.GetLength(i)); j++)
+        CPPUNIT_ASSERT(P(i, j) == V(i, j));
+  }
 };
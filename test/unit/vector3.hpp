@@ -23,6 +23,7 @@
 using namespace Seldon;
 
 #include "vector/Vector3.cxx"
+#include "vector/PackedVector3.cxx"
 
 
 class Vector3Test: public CppUnit::TestFixture
@@ -30,6 +31,7 @@ class Vector3Test: public CppUnit::TestFixture
   CPPUNIT_TEST_SUITE(Vector3Test);
   CPPUNIT_TEST(test_reallocate);
   CPPUNIT_TEST(test_fill);
+  CPPUNIT_TEST(test_packed);
   CPPUNIT_TEST_SUITE_END();
 
 protected:
@@ -64,6 +66,13 @@ public:
   }
 
 
+  void test_packed()
+  {
+    length1_ = 10;
+    packed();
+  }
+
+
   void reallocate()
   {
     int i;
@@ -155,4 +164,50 @@ public:
             CPPUNIT_ASSERT(V.GetVector(i, j)(k) == -3.);
           }
   }
+
+
+  void packed()
+  {
+    int i, j, k;
+    Vector3<double> V(length1_);
+    for (i = 0; i < length1_; i++)
+      {
+        V.Reallocate(i, i % 3 + 1);
+        for (j = 0; j < int(V.GetLength(i)); j++)
+          {
+            V.Reallocate(i, j, (i + j) % 4);
+            V(i, j).Fill();
+          }
+      }
+
+    PackedVector3<double> P;
+    P.Copy(V);
+    CPPUNIT_ASSERT(P.GetLength() == V.GetLength());
+    CPPUNIT_ASSERT(P.GetNelement() == V.GetNelement());
+    for (i = 0; i < length1_; i++)
+      {
+        CPPUNIT_ASSERT(P.GetLength(i) == V.GetLength(i));
+        for (j = 0; j < int(V.GetLength(i)); j++)
+          for (k = 0; k < int(V.GetLength(i, j)); k++)
+            CPPUNIT_ASSERT(P(i, j, k) == V(i, j, k));
+      }
+
+    Vector<double> data, view;
+    V.Flatten(data);
+    P.FlattenView(view);
+    CPPUNIT_ASSERT(view.GetM() == data.GetM());
+    for (i = 0; i < int(data.GetM()); i++)
+      CPPUNIT_ASSERT(view(i) == data(i));
+    view.Nullify();
+
+    P.Select(2, 5);
+    P.PushBack(V(1));
+    CPPUNIT_ASSERT(P.GetLength() == 4);
+    for (j = 0; j < int(V.GetLength(1)); j++)
+      for (k = 0; k < int(V.GetLength(1, j)); k++)
+        CPPUNIT_ASSERT(P(3, j, k) == V(1, j, k));
+    for (j = 0; j < int(V.GetLength(4)); j++)
+      for (k = 0; k < int(V.GetLength(4, j)); k++)
+        CPPUNIT_ASSERT(P(2, j, k) == V(4, j, k));
+  }
 };
@@ -0,0 +1,159 @@
+// NewAlloc as default allocator in order to avoid problems
+// with vectors of complex types
+#define SELDON_DEFAULT_ALLOCATOR NewAlloc
+// seldon will call abort() when encountering an exception
+#define SELDON_WITH_ABORT
+// no call of srand by Seldon
+#define SELDON_WITHOUT_REINIT_RANDOM
+
+// C library for time function and for randomization
+#include <cstdlib>
+#include <ctime>
+
+#include "Seldon.hxx"
+#include "vector/VectorExpression.cxx"
+
+using namespace Seldon;
+
+typedef double Real_wp;
+typedef complex<double> Complex_wp;
+
+Real_wp threshold;
+
+template<class T>
+void GetRandNumber(T& x)
+{
+  x = T(rand())/RAND_MAX;
+}
+
+template<class T>
+void GetRandNumber(complex<T>& x)
+{
+  x = complex<T>(rand(), rand())/Real_wp(RAND_MAX);
+}
+
+template<class T>
+void GenerateRandomVector(Vector<T>& x, int n)
+{
+  x.Reallocate(n);
+  for (int i = 0; i < n; i++)
+    GetRandNumber(x(i));
+}
+
+template<class T>
+bool EqualVector(const Vector<T>& x, const Vector<T>& y)
+{
+  if (x.GetM() != y.GetM())
+    return false;
+
+  for (size_t i = 0; i < x.GetM(); i++)
+    if ((abs(x(i) - y(i)) > threshold) || isnan(abs(x(i)-y(i))))
+      {
+        DISP(i); DISP(x(i)); DISP(y(i));
+        return false;
+      }
+
+  return true;
+}
+
+template<class T>
+void CheckExpression(int n)
+{
+  Vector<T> x, y, z, y_ref, w;
+  GenerateRandomVector(x, n);
+  GenerateRandomVector(y, n);
+  GenerateRandomVector(z, n);
+  T a, b, c;
+  GetRandNumber(a); GetRandNumber(b); GetRandNumber(c);
+
+  // y = a x + b y - c z
+  y_ref = y;
+  Mlt(b, y_ref);
+  Add(a, x, y_ref);
+  Add(-c, z, y_ref);
+  y = a*x + b*y - c*z;
+  if (!EqualVector(y, y_ref))
+    {
+      cout << "operator=(VectorExpression) incorrect" << endl;
+      abort();
+    }
+
+  // compound assignments
+  y_ref = y;
+  Add(T(1), x, y_ref);
+  Add(T(-1), z, y_ref);
+  y += x - z;
+  if (!EqualVector(y, y_ref))
+    {
+      cout << "operator+=(VectorExpression) incorrect" << endl;
+      abort();
+    }
+
+  y_ref = y;
+  Add(-a, x, y_ref);
+  y -= x*a;
+  if (!EqualVector(y, y_ref))
+    {
+      cout << "operator-=(VectorExpression) incorrect" << endl;
+      abort();
+    }
+
+  // unary minus and products by real scalars
+  w = -x + 2.0*y;
+  y_ref = y;
+  Mlt(T(2), y_ref);
+  Add(T(-1), x, y_ref);
+  if (!EqualVector(w, y_ref))
+    {
+      cout << "operator-(Vector) incorrect" << endl;
+      abort();
+    }
+
+  // reductions on expressions
+  Vector<T> u;
+  u = x + y;
+  if ((abs(DotProd(x + y, z) - DotProd(u, z)) > threshold)
+      || (abs(DotProdConj(z, x + y) - DotProdConj(z, u)) > threshold)
+      || (abs(Norm2(x + y) - Norm2(u)) > threshold)
+      || (abs(Norm1(x + y) - Norm1(u)) > threshold))
+    {
+      cout << "Reductions on VectorExpression incorrect" << endl;
+      abort();
+    }
+
+  // fused assignment and reduction
+  Real_wp nrm = CopyNorm2(x - c*z, w);
+  u = x - c*z;
+  if (!EqualVector(w, u) || (abs(nrm - Norm2(u)) > threshold))
+    {
+      cout << "CopyNorm2 incorrect" << endl;
+      abort();
+    }
+
+  T scal = CopyDotProdConj(x + a*y, w, z);
+  u = x + a*y;
+  if (!EqualVector(w, u) || (abs(scal - DotProdConj(u, z)) > threshold))
+    {
+      cout << "CopyDotProdConj incorrect" << endl;
+      abort();
+    }
+
+  scal = CopyDotProd(x + a*y, w, z);
+  if (abs(scal - DotProd(u, z)) > threshold)
+    {
+      cout << "CopyDotProd incorrect" << endl;
+      abort();
+    }
+}
+
+int main(int argc, char** argv)
+{
+  threshold = 1e-12;
+
+  CheckExpression<Real_wp>(37);
+  CheckExpression<Complex_wp>(23);
+
+  cout << "All tests passed successfully" << endl;
+
+  return 0;
+}
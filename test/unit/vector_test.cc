@@ -699,7 +699,7 @@ int main(int argc, char** argv)
     
     v.Clear();
     v.AddInteraction(4, to_num<Real_wp>("0.4"));
-    Vector<int> col(3);
+    IVect col(3);
     Vector<Real_wp> val(3);
     col(0) = 6;
     col(1) = 0;
@@ -870,7 +870,7 @@ int main(int argc, char** argv)
     
     v.Clear();
     v.AddInteraction(4, y);
-    Vector<int> col(3);
+    IVect col(3);
     Vector<complex<Real_wp> > val(3);
     col(0) = 6;
     col(1) = 0;
@@ -931,7 +931,7 @@ int main(int argc, char** argv)
     // testing functions in Functions_Arrays.cxx
     int n = 30, n0 = 5, n1 = 25;
     Vector<Real_wp> x(n), x2, x3, y;
-    Vector<int> permut(n), permut1(n), permut2(n);
+    IVect permut(n), permut1(n), permut2(n);
     
     x.FillRand();
     y = x; x2 = x; x3 = x;
@@ -1054,7 +1054,7 @@ int main(int argc, char** argv)
       }    
     
     int p = 15;
-    Vector<int> num(n);
+    IVect num(n);
     Vector<bool> present(p); present.Fill(false);
     Vector<Real_wp> somme(p); somme.Fill(0);
     for (int i = 0; i < n; i++)
@@ -1067,7 +1067,7 @@ int main(int argc, char** argv)
     
     y = x;
     permut = num; permut1 = num;
-    int nb = permut.GetM(); int nb2 = permut.GetM();
+    size_t nb = permut.GetM(); size_t nb2 = permut.GetM();
     Assemble(nb, permut);
     Assemble(nb2, permut1, x);
     for (int i = 0; i < nb; i++)
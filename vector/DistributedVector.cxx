@@ -35,6 +35,10 @@ namespace Seldon
 		   const DistributedVector<T1, Allocator1>& Y)
   {
     T1 value;
+    if (ParallelContext::IsDeterministic()
+	&& ReproducibleDotProd(X, Y, false, value))
+      return value;
+
     SetComplexZero(value);
     for (int i = 0; i < X.GetNbOverlap(); i++)
       value += X(X.GetOverlapRow(i)) * Y(Y.GetOverlapRow(i));
@@ -68,6 +72,10 @@ namespace Seldon
 		       const DistributedVector<T1, Allocator1>& Y)
   {
     T1 value;
+    if (ParallelContext::IsDeterministic()
+	&& ReproducibleDotProd(X, Y, true, value))
+      return value;
+
     SetComplexZero(value);
     for (int i = 0; i < X.GetNbOverlap(); i++)
       value += conjugate(X(X.GetOverlapRow(i))) * Y(Y.GetOverlapRow(i));
@@ -105,6 +113,190 @@ namespace Seldon
     T scal = DotProd(x, x);
     return sqrt(scal);
   }
+
+
+  //! Computes a reduction whose result depends neither on the threads nor
+  //! on the processors
+  /*!
+    The rows of overlap are not counted, as in DotProdVector. The scaling
+    and the bins are set from the global maximum and the global number of
+    rows, so that the bins of all the processors are summed exactly.
+    \param[in] type reduction (see ReproducibleBlockKernel).
+    \param[in] n number of local rows.
+    \param[in] x first array.
+    \param[in] y second array (not read by the sums of squares).
+    \param[in] overlap rows already counted by another processor.
+    \param[in] comm communicator of the processors.
+    \param[out] sum global sum of the scaled terms.
+    \param[out] e exponent of the scaling (see ReproducibleReduce).
+    \return false on all the processors if a product is infinite.
+  */
+  template<class T>
+  bool ReproducibleReduce(int type, size_t n, const T* x, const T* y,
+			  const IVect& overlap, const MPI::Comm& comm,
+			  ReproducibleSum& sum, int& e)
+  {
+    e = 0;
+    ReproducibleBlockKernel<T> kernel(type, x, y);
+    double max_abs = ReproducibleMaxAbs(kernel, n);
+    double nb_row = double(n) - double(overlap.GetM());
+    Vector<int64_t> xtmp;
+    if (comm.Get_size() > 1)
+      {
+	double local_max = max_abs, local_row = nb_row;
+	MpiAllreduce(comm, &local_max, xtmp, &max_abs, 1, MPI::MAX);
+	MpiAllreduce(comm, &local_row, xtmp, &nb_row, 1, MPI::SUM);
+      }
+
+    if (!(max_abs <= numeric_limits<double>::max()))
+      return false;
+
+    double nb_term = ReproducibleBlockKernel<T>::GetNbTerm(type, nb_row);
+    sum.Init(nb_term);
+    e = GetReproducibleExponent(max_abs);
+    kernel.SetScale(ldexp(1., -e), nb_term);
+    ReproducibleAdd(kernel, n, sum);
+
+    // the terms of the overlap are split as in the sum, and removed exactly
+    if (overlap.GetM() > 0)
+      {
+	ReproducibleBlockKernel<T> kernel_overlap(type, x, y,
+						  overlap.GetData());
+	kernel_overlap.SetScale(ldexp(1., -e), nb_term);
+	sum -= kernel_overlap(0, overlap.GetM());
+      }
+
+    if (comm.Get_size() > 1)
+      {
+	ReproducibleSum local_sum(sum);
+	MpiAllreduce(comm, local_sum.GetData(), xtmp, sum.GetData(),
+		     sum.GetDataSize(), MPI::SUM);
+      }
+
+    return true;
+  }
+
+
+  //! Reproducible scalar product, not available for these vectors.
+  /*!
+    \return false, the usual scalar product has to be computed.
+  */
+  template<class T, class Allocator>
+  bool ReproducibleDotProd(const DistributedVector<T, Allocator>&,
+			   const DistributedVector<T, Allocator>&,
+			   bool, T&)
+  {
+    return false;
+  }
+
+
+  //! Reproducible scalar product X.Y of distributed vectors.
+  /*!
+    The overlapped rows are handled as in DotProdVector. The result is the
+    same on each processor, and does not depend on the number of processors
+    nor on the number of threads.
+    \param[in] X first vector.
+    \param[in] Y second vector.
+    \param[out] value scalar product, computed in double precision.
+    \return false if a product is infinite, value is then not computed.
+    \note The third argument, true for conj(X).Y, has no effect on real
+    vectors.
+  */
+  template<class Allocator>
+  bool ReproducibleDotProd(const DistributedVector<float, Allocator>& X,
+			   const DistributedVector<float, Allocator>& Y,
+			   bool, float& value)
+  {
+    IVect overlap(X.GetNbOverlap());
+    for (int i = 0; i < X.GetNbOverlap(); i++)
+      overlap(i) = X.GetOverlapRow(i);
+
+    ReproducibleSum sum;
+    int e;
+    if (!ReproducibleReduce(ReproducibleBlockKernel<float>::DOT_PROD,
+			    X.GetM(), X.GetData(), Y.GetData(), overlap,
+			    X.GetCommunicator(), sum, e))
+      return false;
+
+    value = ldexp(sum.GetReal(), e);
+    return true;
+  }
+
+
+  //! Reproducible scalar product X.Y of distributed vectors.
+  template<class Allocator>
+  bool ReproducibleDotProd(const DistributedVector<double, Allocator>& X,
+			   const DistributedVector<double, Allocator>& Y,
+			   bool, double& value)
+  {
+    IVect overlap(X.GetNbOverlap());
+    for (int i = 0; i < X.GetNbOverlap(); i++)
+      overlap(i) = X.GetOverlapRow(i);
+
+    ReproducibleSum sum;
+    int e;
+    if (!ReproducibleReduce(ReproducibleBlockKernel<double>::DOT_PROD,
+			    X.GetM(), X.GetData(), Y.GetData(), overlap,
+			    X.GetCommunicator(), sum, e))
+      return false;
+
+    value = ldexp(sum.GetReal(), e);
+    return true;
+  }
+
+
+  //! Reproducible scalar product X.Y or conj(X).Y of distributed vectors.
+  template<class Allocator>
+  bool ReproducibleDotProd(const DistributedVector<complex<float>,
+			   Allocator>& X,
+			   const DistributedVector<complex<float>,
+			   Allocator>& Y, bool conj, complex<float>& value)
+  {
+    typedef ReproducibleBlockKernel<float> Kernel;
+    IVect overlap(X.GetNbOverlap());
+    for (int i = 0; i < X.GetNbOverlap(); i++)
+      overlap(i) = X.GetOverlapRow(i);
+
+    ReproducibleSum sum;
+    int e;
+    if (!ReproducibleReduce(conj ? Kernel::DOT_PROD_CONJ
+			    : Kernel::DOT_PROD_COMPLEX, X.GetM(),
+			    reinterpret_cast<const float*>(X.GetData()),
+			    reinterpret_cast<const float*>(Y.GetData()),
+			    overlap, X.GetCommunicator(), sum, e))
+      return false;
+
+    value = complex<float>(ldexp(sum.GetReal(), e),
+			   ldexp(sum.GetImag(), e));
+    return true;
+  }
+
+
+  //! Reproducible scalar product X.Y or conj(X).Y of distributed vectors.
+  template<class Allocator>
+  bool ReproducibleDotProd(const DistributedVector<complex<double>,
+			   Allocator>& X,
+			   const DistributedVector<complex<double>,
+			   Allocator>& Y, bool conj, complex<double>& value)
+  {
+    typedef ReproducibleBlockKernel<double> Kernel;
+    IVect overlap(X.GetNbOverlap());
+    for (int i = 0; i < X.GetNbOverlap(); i++)
+      overlap(i) = X.GetOverlapRow(i);
+
+    ReproducibleSum sum;
+    int e;
+    if (!ReproducibleReduce(conj ? Kernel::DOT_PROD_CONJ
+			    : Kernel::DOT_PROD_COMPLEX, X.GetM(),
+			    reinterpret_cast<const double*>(X.GetData()),
+			    reinterpret_cast<const double*>(Y.GetData()),
+			    overlap, X.GetCommunicator(), sum, e))
+      return false;
+
+    value = complex<double>(ldexp(sum.GetReal(), e),
+			    ldexp(sum.GetImag(), e));
+    return true;
+  }
   
   
   //! minimum for real numbers
@@ -85,6 +85,38 @@ namespace Seldon
   template<class T, class Allocator>
   T Norm2(const DistributedVector<T, Allocator>& x);
 
+  template<class T>
+  bool ReproducibleReduce(int type, size_t n, const T* x, const T* y,
+			  const IVect& overlap, const MPI::Comm& comm,
+			  ReproducibleSum& sum, int& e);
+
+  template<class T, class Allocator>
+  bool ReproducibleDotProd(const DistributedVector<T, Allocator>& X,
+			   const DistributedVector<T, Allocator>& Y,
+			   bool conj, T& value);
+
+  template<class Allocator>
+  bool ReproducibleDotProd(const DistributedVector<float, Allocator>& X,
+			   const DistributedVector<float, Allocator>& Y,
+			   bool conj, float& value);
+
+  template<class Allocator>
+  bool ReproducibleDotProd(const DistributedVector<double, Allocator>& X,
+			   const DistributedVector<double, Allocator>& Y,
+			   bool conj, double& value);
+
+  template<class Allocator>
+  bool ReproducibleDotProd(const DistributedVector<complex<float>,
+			   Allocator>& X,
+			   const DistributedVector<complex<float>,
+			   Allocator>& Y, bool conj, complex<float>& value);
+
+  template<class Allocator>
+  bool ReproducibleDotProd(const DistributedVector<complex<double>,
+			   Allocator>& X,
+			   const DistributedVector<complex<double>,
+			   Allocator>& Y, bool conj, complex<double>& value);
+
   template<class T>
   T minComplex(const T& x, const T& y);
 
@@ -41,6 +41,12 @@
   Sort(X, Y);
   Sort(X, Y, Z);
 
+  GetRadixPermutation(X, permutation);
+  PermuteVector(X, permutation);
+  RadixSort(X, Y);
+  RadixSort(X, Y, Z);
+  CumulativeSum(X);
+
   Assemble(m, X);
   Assemble(m, X, Y);
 
@@ -742,6 +748,223 @@ namespace Seldon
   ////////////
 
 
+  //////////////////
+  //  RADIX SORT  //
+
+
+  //! Stable sort of a permutation with respect to integer keys.
+  /*!
+    On exit, V(permutation(i)) is non-decreasing, and indices with equal
+    keys keep the order they had in \a permutation on entry. If
+    \a permutation does not have the size of \a V on entry, it is set to the
+    identity first. The keys must be non-negative. The least significant
+    digits are sorted first, each pass being distributed over OpenMP
+    threads with per-thread counters.
+  */
+  template<class Tint, class Allocator1, class Allocator2>
+  void GetRadixPermutation(const Vector<Tint, VectFull, Allocator1>& V,
+                           Vector<size_t, VectFull, Allocator2>& permutation)
+  {
+    long nb = V.GetM();
+    if (long(permutation.GetM()) != nb)
+      {
+        permutation.Reallocate(nb);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) \
+  num_threads(ParallelContext::GetNumThreads(nb))
+#endif
+        for (long i = 0; i < nb; i++)
+          permutation(i) = i;
+      }
+
+    if (nb <= 1)
+      return;
+
+    const Tint* key = V.GetData();
+    size_t key_max = 0;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) reduction(max: key_max) \
+  num_threads(ParallelContext::GetNumThreads(nb))
+#endif
+    for (long i = 0; i < nb; i++)
+      key_max = max(key_max, size_t(key[i]));
+
+    const int nb_bits = 11;
+    const size_t nb_bucket = size_t(1) << nb_bits;
+    const size_t mask = nb_bucket - 1;
+
+    int nb_thread = ParallelContext::GetNumThreads(nb);
+
+    Vector<size_t, VectFull, Allocator2> work(nb);
+    std::vector<size_t> count(nb_thread * nb_bucket);
+    size_t* source = permutation.GetData();
+    size_t* target = work.GetData();
+    for (int shift = 0; (shift < int(8*sizeof(size_t)))
+           && ((key_max >> shift) > 0); shift += nb_bits)
+      {
+#ifdef _OPENMP
+#pragma omp parallel num_threads(nb_thread)
+#endif
+        {
+          int t = 0, nb_t = 1;
+#ifdef _OPENMP
+          t = omp_get_thread_num();
+          nb_t = omp_get_num_threads();
+#endif
+          long first = nb * t / nb_t, last = nb * (t + 1) / nb_t;
+          size_t* count_t = &count[t * nb_bucket];
+          for (size_t b = 0; b < nb_bucket; b++)
+            count_t[b] = 0;
+
+          for (long i = first; i < last; i++)
+            count_t[(size_t(key[source[i]]) >> shift) & mask]++;
+
+#ifdef _OPENMP
+#pragma omp barrier
+#pragma omp single
+#endif
+          {
+            // position of the first element of each bucket for each thread
+            size_t offset = 0;
+            for (size_t b = 0; b < nb_bucket; b++)
+              for (int k = 0; k < nb_t; k++)
+                {
+                  size_t nb_elt = count[k * nb_bucket + b];
+                  count[k * nb_bucket + b] = offset;
+                  offset += nb_elt;
+                }
+          }
+
+          for (long i = first; i < last; i++)
+            target[count_t[(size_t(key[source[i]]) >> shift) & mask]++]
+              = source[i];
+        }
+
+        std::swap(source, target);
+      }
+
+    if (source != permutation.GetData())
+      {
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) \
+  num_threads(ParallelContext::GetNumThreads(nb))
+#endif
+        for (long i = 0; i < nb; i++)
+          permutation(i) = source[i];
+      }
+  }
+
+
+  //! Applies a permutation to a vector.
+  /*!
+    On exit, V(i) is equal to the value V(permutation(i)) had on entry.
+  */
+  template<class T, class Allocator1, class Allocator2>
+  void PermuteVector(Vector<T, VectFull, Allocator1>& V,
+                     const Vector<size_t, VectFull, Allocator2>& permutation)
+  {
+    long nb = V.GetM();
+    Vector<T, VectFull, Allocator1> V_new(nb);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) \
+  num_threads(ParallelContext::GetNumThreads(nb))
+#endif
+    for (long i = 0; i < nb; i++)
+      V_new(i) = V(permutation(i));
+
+    V.SetData(nb, V_new.GetData());
+    V_new.Nullify();
+  }
+
+
+  //! Sorts vectors \a V and \a V2 with a radix sort.
+  /*!
+    The pairs (V(i), V2(i)) are sorted in lexicographic order: \a V is
+    sorted, and \a V2 is sorted for equal values of \a V. Both vectors
+    must contain non-negative integers.
+  */
+  template<class T1, class Allocator1, class T2, class Allocator2>
+  void RadixSort(Vector<T1, VectFull, Allocator1>& V,
+                 Vector<T2, VectFull, Allocator2>& V2)
+  {
+    Vector<size_t> permutation;
+    GetRadixPermutation(V2, permutation);
+    GetRadixPermutation(V, permutation);
+
+    PermuteVector(V, permutation);
+    PermuteVector(V2, permutation);
+  }
+
+
+  //! Sorts vectors \a V and \a V2 with a radix sort.
+  /*!
+    The pairs (V(i), V2(i)) are sorted in lexicographic order, and the same
+    permutation is applied to \a V3. \a V and \a V2 must contain
+    non-negative integers.
+  */
+  template<class T1, class Allocator1, class T2, class Allocator2,
+           class T3, class Allocator3>
+  void RadixSort(Vector<T1, VectFull, Allocator1>& V,
+                 Vector<T2, VectFull, Allocator2>& V2,
+                 Vector<T3, VectFull, Allocator3>& V3)
+  {
+    Vector<size_t> permutation;
+    GetRadixPermutation(V2, permutation);
+    GetRadixPermutation(V, permutation);
+
+    PermuteVector(V, permutation);
+    PermuteVector(V2, permutation);
+    PermuteVector(V3, permutation);
+  }
+
+
+  //! Replaces each element of \a V by the sum of previous elements.
+  /*!
+    On exit, V(i) = V(0) + V(1) + ... + V(i). The vector is split in one
+    block per thread, block sums are accumulated sequentially, then each
+    block is completed in parallel.
+  */
+  template<class T, class Allocator>
+  void CumulativeSum(Vector<T, VectFull, Allocator>& V)
+  {
+    long nb = V.GetM();
+    int nb_thread = ParallelContext::GetNumThreads(nb);
+
+    std::vector<T> offset(nb_thread + 1, T(0));
+#ifdef _OPENMP
+#pragma omp parallel num_threads(nb_thread)
+#endif
+    {
+      int t = 0, nb_t = 1;
+#ifdef _OPENMP
+      t = omp_get_thread_num();
+      nb_t = omp_get_num_threads();
+#endif
+      long first = nb * t / nb_t, last = nb * (t + 1) / nb_t;
+      for (long i = first + 1; i < last; i++)
+        V(i) += V(i - 1);
+
+      if (last > first)
+        offset[t + 1] = V(last - 1);
+
+#ifdef _OPENMP
+#pragma omp barrier
+#pragma omp single
+#endif
+      for (int k = 0; k < nb_t; k++)
+        offset[k + 1] += offset[k];
+
+      if (t > 0)
+        for (long i = first; i < last; i++)
+          V(i) += offset[t];
+    }
+  }
+
+
+  //  RADIX SORT  //
+  //////////////////
+
+
   //! Whether \a X contains element \a a.
   template<class T, class Storage, class Allocator>
   bool HasElement(Vector<T, Storage, Allocator>& X, T& a)
@@ -146,6 +146,27 @@ namespace Seldon
 	    Vector<T2, Storage2, Allocator2>& V2,
 	    Vector<T3, Storage3, Allocator3>& V3);
 
+  template<class Tint, class Allocator1, class Allocator2>
+  void GetRadixPermutation(const Vector<Tint, VectFull, Allocator1>& V,
+                           Vector<size_t, VectFull, Allocator2>& permutation);
+
+  template<class T, class Allocator1, class Allocator2>
+  void PermuteVector(Vector<T, VectFull, Allocator1>& V,
+                     const Vector<size_t, VectFull, Allocator2>& permutation);
+
+  template<class T1, class Allocator1, class T2, class Allocator2>
+  void RadixSort(Vector<T1, VectFull, Allocator1>& V,
+                 Vector<T2, VectFull, Allocator2>& V2);
+
+  template<class T1, class Allocator1, class T2, class Allocator2,
+           class T3, class Allocator3>
+  void RadixSort(Vector<T1, VectFull, Allocator1>& V,
+                 Vector<T2, VectFull, Allocator2>& V2,
+                 Vector<T3, VectFull, Allocator3>& V3);
+
+  template<class T, class Allocator>
+  void CumulativeSum(Vector<T, VectFull, Allocator>& V);
+
   template<class T, class Storage, class Allocator>
   bool HasElement(Vector<T, Storage, Allocator>& X, T& a);
 
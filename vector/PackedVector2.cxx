@@ -0,0 +1,714 @@
+// Copyright (C) 2016 INRIA
+//
+// This file is part of the linear-algebra library Seldon,
+// http://seldon.sourceforge.net/.
+//
+// Seldon is free software; you can redistribute it and/or modify it under the
+// terms of the GNU Lesser General Public License as published by the Free
+// Software Foundation; either version 2.1 of the License, or (at your option)
+// any later version.
+//
+// Seldon is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for
+// more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with Seldon. If not, see http://www.gnu.org/licenses/.
+
+
+#ifndef SELDON_FILE_VECTOR_PACKED_VECTOR2_CXX
+
+
+#include "PackedVector2.hxx"
+
+
+namespace Seldon
+{
+
+
+  ///////////////////
+  // PACKEDVECTOR2 //
+  ///////////////////
+
+
+  /***************
+   * CONSTRUCTOR *
+   ***************/
+
+
+  //! Default constructor.
+  /*!
+    No inner vector is allocated.
+  */
+  template <class T, class Allocator>
+  PackedVector2<T, Allocator>::PackedVector2()
+  {
+    offset_.Reallocate(1);
+    offset_(0) = 0;
+  }
+
+
+  //! Constructor.
+  /*! The inner vectors are allocated (in a single array).
+    \param[in] length the lengths of the inner vectors.
+  */
+  template <class T, class Allocator>
+  PackedVector2<T, Allocator>::PackedVector2(const Vector<size_t>& length)
+  {
+    Reallocate(length);
+  }
+
+
+  /**************
+   * DESTRUCTOR *
+   **************/
+
+
+  //! Destructor.
+  template <class T, class Allocator>
+  PackedVector2<T, Allocator>::~PackedVector2()
+  {
+  }
+
+
+  /*****************************
+   * MANAGEMENT OF THE VECTORS *
+   *****************************/
+
+
+  //! Checks whether no elements are contained in the inner vectors.
+  /*!
+    \return True is no inner vector contains an element, false otherwise.
+  */
+  template <class T, class Allocator>
+  bool PackedVector2<T, Allocator>::IsEmpty() const
+  {
+    return GetNelement() == 0;
+  }
+
+
+  //! Returns the number of inner vectors.
+  template <class T, class Allocator>
+  size_t PackedVector2<T, Allocator>::GetLength() const
+  {
+    return offset_.GetM() - 1;
+  }
+
+
+  //! Returns the number of inner vectors.
+  template <class T, class Allocator>
+  size_t PackedVector2<T, Allocator>::GetSize() const
+  {
+    return offset_.GetM() - 1;
+  }
+
+
+  //! Returns the length of the inner vector #\a i.
+  template <class T, class Allocator>
+  size_t PackedVector2<T, Allocator>::GetLength(size_t i) const
+  {
+    return offset_(i+1) - offset_(i);
+  }
+
+
+  //! Returns the length of the inner vector #\a i.
+  template <class T, class Allocator>
+  size_t PackedVector2<T, Allocator>::GetSize(size_t i) const
+  {
+    return offset_(i+1) - offset_(i);
+  }
+
+
+  //! Returns the memory used by the object in bytes.
+  /*!
+    In this method, the type T is assumed to be "static"
+    such that sizeof(T) provides the correct size
+  */
+  template <class T, class Allocator>
+  int64_t PackedVector2<T, Allocator>::GetMemorySize() const
+  {
+    return sizeof(*this) + offset_.GetMemorySize() + data_.GetMemorySize()
+      - sizeof(offset_) - sizeof(data_);
+  }
+
+
+  //! Returns the total number of elements in the inner vectors.
+  template <class T, class Allocator>
+  size_t PackedVector2<T, Allocator>::GetNelement() const
+  {
+    return offset_(GetLength()) - offset_(0);
+  }
+
+
+  //! Returns the total number of elements in a range of inner vectors.
+  /*! Returns the total number of elements in the range [\a beg, \a end[ of
+    inner vectors.
+    \param[in] beg inclusive lower-bound for the indexes.
+    \param[in] end exclusive upper-bound for the indexes.
+  */
+  template <class T, class Allocator>
+  size_t PackedVector2<T, Allocator>
+  ::GetNelement(size_t beg, size_t end) const
+  {
+    if (beg > end)
+      throw WrongArgument("PackedVector2::GetNelement(size_t beg, size_t end)",
+                          "The lower bound of the range of inner vectors, ["
+                          + to_str(beg) + ", " + to_str(end)
+                          + "[, is strictly greater than its upper bound.");
+    if (end > GetLength())
+      throw WrongArgument("PackedVector2::GetNelement(size_t beg, size_t end)",
+			  "The inner-vector indexes should be in [0,"
+			  + to_str(GetLength()) + "] but [" + to_str(beg)
+                          + ", " + to_str(end) + "[ was provided.");
+
+    return offset_(end) - offset_(beg);
+  }
+
+
+  //! Returns the shape.
+  /*!
+    \return A vector with the lengths of the inner vectors.
+  */
+  template <class T, class Allocator>
+  Vector<size_t> PackedVector2<T, Allocator>::GetShape() const
+  {
+    Vector<size_t> shape;
+    GetShape(shape);
+    return shape;
+  }
+
+
+  //! Returns the shape.
+  /*!
+    \param[out] shape the lengths of the inner vectors.
+  */
+  template <class T, class Allocator>
+  void PackedVector2<T, Allocator>::GetShape(Vector<size_t>& shape) const
+  {
+    shape.Reallocate(GetLength());
+    for (size_t i = 0; i < GetLength(); i++)
+      shape(i) = GetLength(i);
+  }
+
+
+  //! Reallocates the whole structure.
+  /*!
+    \param[in] length the new lengths of the inner vectors. Previous values
+    are lost.
+  */
+  template <class T, class Allocator>
+  void PackedVector2<T, Allocator>::Reallocate(const Vector<size_t>& length)
+  {
+    size_t m = length.GetSize();
+    offset_.Reallocate(m + 1);
+    offset_(0) = 0;
+    for (size_t i = 0; i < m; i++)
+      offset_(i+1) = offset_(i) + length(i);
+
+    data_.Reallocate(offset_(m));
+  }
+
+
+  //! Constructs the structure with a counting pass and a filling pass.
+  /*! The object \a builder must provide two methods:
+    <ul>
+    <li> size_t Count(size_t i), which returns the length of the inner vector
+    #i, </li>
+    <li> void Fill(size_t i, T* x), which fills the Count(i) elements of the
+    inner vector #i stored in \a x. </li>
+    </ul>
+    Both passes are performed in parallel if OpenMP is enabled, so these
+    methods must be thread-safe.
+    \param[in] n number of inner vectors.
+    \param[in,out] builder object computing the inner vectors.
+  */
+  template <class T, class Allocator>
+  template <class Builder>
+  void PackedVector2<T, Allocator>::Build(size_t n, Builder& builder)
+  {
+    long nb = n;
+    offset_.Reallocate(n + 1);
+    offset_(0) = 0;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 256) \
+  num_threads(ParallelContext::GetNumThreads(nb, 256))
+#endif
+    for (long i = 0; i < nb; i++)
+      offset_(i+1) = builder.Count(i);
+
+    for (size_t i = 0; i < n; i++)
+      offset_(i+1) += offset_(i);
+
+    data_.Reallocate(offset_(n));
+    T* data = data_.GetData();
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 256) \
+  num_threads(ParallelContext::GetNumThreads(nb, 256))
+#endif
+    for (long i = 0; i < nb; i++)
+      builder.Fill(i, data + offset_(i));
+  }
+
+
+  //! Selects a range of inner vectors.
+  /*! Only the inner vectors with index in [\a beg, \a end[ are kept. The
+    values are not copied: only the offsets are updated, the values of the
+    other vectors stay in memory until the next reallocation.
+    \param[in] beg inclusive lower-bound for the indexes.
+    \param[in] end exclusive upper-bound for the indexes.
+  */
+  template <class T, class Allocator>
+  void PackedVector2<T, Allocator>::Select(size_t beg, size_t end)
+  {
+    if (beg > end)
+      throw WrongArgument("PackedVector2::Select(size_t beg, size_t end)",
+                          "The lower bound of the range of inner vectors, ["
+                          + to_str(beg) + ", " + to_str(end)
+                          + "[, is strictly greater than its upper bound.");
+    if (end > GetLength())
+      throw WrongArgument("PackedVector2::Select(size_t beg, size_t end)",
+			  "The inner-vector indexes should be in [0,"
+			  + to_str(GetLength()) + "] but [" + to_str(beg)
+                          + ", " + to_str(end) + "[ was provided.");
+
+    for (size_t i = 0; i <= end - beg; i++)
+      offset_(i) = offset_(beg + i);
+    offset_.Resize(end - beg + 1);
+  }
+
+
+  //! Returns all values in a vector.
+  /*! The output vector contains all inner vectors concatenated in the same
+    order as they appear in the current instance.
+    \return All values from the current instance.
+  */
+  template <class T, class Allocator>
+  Vector<T, VectFull, Allocator> PackedVector2<T, Allocator>::Flatten() const
+  {
+    Vector<T, VectFull, Allocator> data;
+    Flatten(data);
+    return data;
+  }
+
+
+  //! Returns all values in a vector.
+  /*! The output vector \a data contains all inner vectors concatenated in the
+    same order as they appear in the current instance.
+    \param[out] data all values from the current instance.
+  */
+  template <class T, class Allocator>
+  template <class Td, class Allocatord>
+  void PackedVector2<T, Allocator>
+  ::Flatten(Vector<Td, VectFull, Allocatord>& data) const
+  {
+    Flatten(0, GetLength(), data);
+  }
+
+
+  //! Returns in a vector all values from a range of inner vectors.
+  /*! The output vector \a data contains all inner vectors, in the index range
+    [\a beg, \a end[, concatenated in the same order as they appear in the
+    current instance.
+    \param[in] beg inclusive lower-bound for the indexes.
+    \param[in] end exclusive upper-bound for the indexes.
+    \param[out] data the values contained in the inner vectors [\a beg, \a
+    end[.
+  */
+  template <class T, class Allocator>
+  template <class Td, class Allocatord>
+  void PackedVector2<T, Allocator>
+  ::Flatten(size_t beg, size_t end, Vector<Td, VectFull, Allocatord>& data)
+    const
+  {
+    data.Reallocate(GetNelement(beg, end));
+    const T* x = data_.GetData() + offset_(beg);
+    for (size_t n = 0; n < data.GetM(); n++)
+      data(n) = x[n];
+  }
+
+
+  //! Returns all values in a vector, without copy.
+  /*! On exit, \a data shares its memory with the current instance: it is
+    valid until the current instance is reallocated, and data.Nullify() must
+    be called before \a data is destroyed or reallocated.
+    \param[out] data all values from the current instance.
+  */
+  template <class T, class Allocator>
+  void PackedVector2<T, Allocator>
+  ::FlattenView(Vector<T, VectFull, Allocator>& data)
+  {
+    data.Clear();
+    data.SetData(GetNelement(), data_.GetData() + offset_(0));
+  }
+
+
+  //! Appends an inner vector at the end of the vector.
+  /*! The array of values grows geometrically, so that successive calls to
+    this method have an amortized linear cost.
+    \param[in] X vector to be appended.
+  */
+  template <class T, class Allocator>
+  template <class Allocator0>
+  void PackedVector2<T, Allocator>
+  ::PushBack(const Vector<T, VectFull, Allocator0>& X)
+  {
+    size_t m = GetLength(), n = offset_(m) + X.GetM();
+    if (n > data_.GetCapacity())
+      data_.Reserve(max(size_t(2) * data_.GetCapacity(), n));
+
+    if (n > data_.GetM())
+      data_.Resize(n);
+
+    for (size_t j = 0; j < X.GetM(); j++)
+      data_(offset_(m) + j) = X(j);
+
+    offset_.PushBack(n);
+  }
+
+
+  //! Clears the vector.
+  /*! All inner vectors are removed and the memory is released.
+   */
+  template <class T, class Allocator>
+  void PackedVector2<T, Allocator>::Clear()
+  {
+    data_.Clear();
+    offset_.Reallocate(1);
+    offset_(0) = 0;
+  }
+
+
+  //! Fills the vector with a given value.
+  /*!
+    \param[in] x value to fill the vector with.
+  */
+  template <class T, class Allocator>
+  void PackedVector2<T, Allocator>::Fill(const T& x)
+  {
+    T* data = data_.GetData();
+    for (size_t n = offset_(0); n < offset_(GetLength()); n++)
+      data[n] = x;
+  }
+
+
+  //! Returns the offsets of the inner vectors.
+  /*! The inner vector #i is made of the elements in [offset(i),
+    offset(i+1)[ of the array of values, whose first element is GetData(0).
+    After a call to Select, offset(0) may be positive.
+    \return The offsets (GetLength() + 1 elements).
+  */
+  template <class T, class Allocator>
+  const Vector<size_t>& PackedVector2<T, Allocator>::GetOffset() const
+  {
+    return offset_;
+  }
+
+
+  //! Returns a pointer to the first element of the inner vector #\a i.
+  template <class T, class Allocator>
+  typename PackedVector2<T, Allocator>::pointer
+  PackedVector2<T, Allocator>::GetData(size_t i)
+  {
+    return data_.GetData() + offset_(i);
+  }
+
+
+  //! Returns a pointer to the first element of the inner vector #\a i.
+  template <class T, class Allocator>
+  typename PackedVector2<T, Allocator>::const_pointer
+  PackedVector2<T, Allocator>::GetData(size_t i) const
+  {
+    return data_.GetData() + offset_(i);
+  }
+
+
+  //! Returns a given inner vector, without copy.
+  /*! On exit, \a V shares its memory with the current instance: it is valid
+    until the current instance is reallocated, and V.Nullify() must be called
+    before \a V is destroyed or reallocated.
+    \param[in] i index of the inner vector.
+    \param[out] V the inner vector #\a i.
+  */
+  template <class T, class Allocator>
+  void PackedVector2<T, Allocator>
+  ::GetVector(size_t i, Vector<T, VectFull, Allocator>& V)
+  {
+    V.Clear();
+    V.SetData(GetLength(i), GetData(i));
+  }
+
+
+  //! Copies a vector of vectors.
+  /*!
+    \param[in] V vector of vectors to be copied (Vector2 or PackedVector2).
+  */
+  template <class T, class Allocator>
+  template <class V2>
+  void PackedVector2<T, Allocator>::Copy(const V2& V)
+  {
+    Vector<size_t> length;
+    V.GetShape(length);
+    Reallocate(length);
+    for (size_t i = 0; i < V.GetLength(); i++)
+      for (size_t j = 0; j < V.GetLength(i); j++)
+        data_(offset_(i) + j) = V(i, j);
+  }
+
+
+  /*********************************
+   * ELEMENT ACCESS AND ASSIGNMENT *
+   *********************************/
+
+
+  //! Returns an element of a given inner vector.
+  /*!
+    \param[in] i index of the inner vector.
+    \param[in] j index of the element in the inner vector #\a i.
+    \return The element #\a j of the inner vector #\a i.
+  */
+  template <class T, class Allocator>
+  typename PackedVector2<T, Allocator>::const_reference
+  PackedVector2<T, Allocator>::operator() (size_t i, size_t j) const
+  {
+#ifdef SELDON_CHECK_BOUNDS
+    if (j >= GetLength(i))
+      throw WrongIndex("PackedVector2::operator()",
+                       string("Index along dimension #2 should be in [0, ")
+                       + to_str(GetLength(i)-1) + "], but is equal to "
+                       + to_str(j) + ".");
+#endif
+
+    return data_(offset_(i) + j);
+  }
+
+
+  //! Returns an element of a given inner vector.
+  /*!
+    \param[in] i index of the inner vector.
+    \param[in] j index of the element in the inner vector #\a i.
+    \return The element #\a j of the inner vector #\a i.
+  */
+  template <class T, class Allocator>
+  typename PackedVector2<T, Allocator>::reference
+  PackedVector2<T, Allocator>::operator() (size_t i, size_t j)
+  {
+#ifdef SELDON_CHECK_BOUNDS
+    if (j >= GetLength(i))
+      throw WrongIndex("PackedVector2::operator()",
+                       string("Index along dimension #2 should be in [0, ")
+                       + to_str(GetLength(i)-1) + "], but is equal to "
+                       + to_str(j) + ".");
+#endif
+
+    return data_(offset_(i) + j);
+  }
+
+
+  /**********************
+   * CONVENIENT METHODS *
+   **********************/
+
+
+  //! Checks whether another vector of vectors has the same shape.
+  /*!
+    \param[in] V vector of vectors (Vector2 or PackedVector2) whose shape is
+    compared to that of the current instance.
+    \return True if the current instance as the same shape as \a V, false
+    otherwise.
+  */
+  template <class T, class Allocator>
+  template <class V2>
+  bool PackedVector2<T, Allocator>::HasSameShape(const V2& V) const
+  {
+    if (V.GetLength() != GetLength())
+      return false;
+    for (size_t i = 0; i < GetLength(); i++)
+      if (V.GetLength(i) != GetLength(i))
+	return false;
+    return true;
+  }
+
+
+  //! Displays the vector.
+  template <class T, class Allocator>
+  void PackedVector2<T, Allocator>::Print() const
+  {
+    for (size_t i = 0; i < GetLength(); i++)
+      {
+        cout << "Vector " << i << ": ";
+        for (size_t j = 0; j < GetLength(i); j++)
+          cout << (*this)(i, j) << '\t';
+        cout << endl;
+      }
+  }
+
+
+  /**************************
+   * INPUT/OUTPUT FUNCTIONS *
+   **************************/
+
+
+  //! Writes the instance in a binary file.
+  /*!
+    The format is the same as for Vector2: the number of inner vectors is
+    written first, then for each vector, the length of the vector and all
+    elements of the vector are written.
+    \param[in] file_name file name.
+    \param[in] with_size if set to 'false', the number of vectors and the
+    lengths of the inner vectors are not saved.
+  */
+  template <class T, class Allocator>
+  void PackedVector2<T, Allocator>
+  ::Write(string file_name, bool with_size) const
+  {
+    ofstream file_stream;
+    file_stream.open(file_name.c_str());
+
+#ifdef SELDON_CHECK_IO
+    // Checks if the file was opened.
+    if (!file_stream.is_open())
+      throw IOError("PackedVector2::Write(string file_name, bool with_size)",
+		    string("Unable to open file \"") + file_name + "\".");
+#endif
+
+    this->Write(file_stream, with_size);
+
+    file_stream.close();
+  }
+
+
+  //! Writes the instance in a stream in a binary format.
+  /*!
+    The format is the same as for Vector2: the number of inner vectors is
+    written first, then for each vector, the length of the vector and all
+    elements of the vector are written.
+    \param[in,out] stream output stream.
+    \param[in] with_size if set to 'false', the number of vectors and the
+    lengths of the inner vectors are not saved.
+  */
+  template <class T, class Allocator>
+  void PackedVector2<T, Allocator>
+  ::Write(ostream& stream, bool with_size) const
+  {
+
+#ifdef SELDON_CHECK_IO
+    // Checks if the stream is ready.
+    if (!stream.good())
+      throw IOError("PackedVector2::Write(ostream& stream, bool with_size)",
+                    "The stream is not ready.");
+#endif
+
+    if (with_size)
+      {
+        size_t m = GetLength();
+        stream.write(reinterpret_cast<char*>(&m), sizeof(size_t));
+      }
+
+    for (size_t i = 0; i < GetLength(); i++)
+      {
+        size_t n = GetLength(i);
+        if (with_size)
+          stream.write(reinterpret_cast<char*>(&n), sizeof(size_t));
+
+        stream.write(reinterpret_cast<const char*>(GetData(i)),
+                     n * sizeof(value_type));
+      }
+
+#ifdef SELDON_CHECK_IO
+    // Checks if data was written.
+    if (!stream.good())
+      throw IOError("PackedVector2::Write(ostream& stream, bool with_size)",
+                    "Output operation failed.");
+#endif
+
+  }
+
+
+  //! Reads the instance from a file.
+  /*!
+    The format is the same as for Vector2.
+    \param[in] file_name file name.
+    \param[in] with_size if set to 'false', the total number of inner vectors
+    and the lengths of the vectors are not available in the file. In this
+    case, the shape of the current instance is unchanged and the values of the
+    elements are directly read in the file.
+  */
+  template <class T, class Allocator>
+  void PackedVector2<T, Allocator>::Read(string file_name, bool with_size)
+  {
+    ifstream file_stream;
+    file_stream.open(file_name.c_str());
+
+#ifdef SELDON_CHECK_IO
+    // Checks if the file was opened.
+    if (!file_stream.is_open())
+      throw IOError("PackedVector2::Read(string file_name, bool with_size)",
+		    string("Unable to open file \"") + file_name + "\".");
+#endif
+
+    this->Read(file_stream, with_size);
+
+    file_stream.close();
+  }
+
+
+  //! Reads the instance from a stream.
+  /*!
+    The format is the same as for Vector2.
+    \param[in,out] stream input stream.
+    \param[in] with_size if set to 'false', the total number of inner vectors
+    and the lengths of the vectors are not available in the stream. In this
+    case, the shape of the current instance is unchanged and the values of the
+    elements are directly read in the stream.
+  */
+  template <class T, class Allocator>
+  void PackedVector2<T, Allocator>::Read(istream& stream, bool with_size)
+  {
+
+#ifdef SELDON_CHECK_IO
+    // Checks if the stream is ready.
+    if (!stream.good())
+      throw IOError("PackedVector2::Read(istream& stream, bool with_size)",
+                    "The stream is not ready.");
+#endif
+
+    if (with_size)
+      {
+        size_t m, n;
+        stream.read(reinterpret_cast<char*>(&m), sizeof(size_t));
+        Clear();
+        offset_.Reallocate(m + 1);
+        offset_(0) = 0;
+        for (size_t i = 0; i < m; i++)
+          {
+            stream.read(reinterpret_cast<char*>(&n), sizeof(size_t));
+            offset_(i+1) = offset_(i) + n;
+            if (offset_(i+1) > data_.GetCapacity())
+              data_.Reserve(max(size_t(2) * data_.GetCapacity(),
+                                offset_(i+1)));
+
+            data_.Resize(offset_(i+1));
+            stream.read(reinterpret_cast<char*>(GetData(i)),
+                        n * sizeof(value_type));
+          }
+      }
+    else
+      stream.read(reinterpret_cast<char*>(GetData(0)),
+                  GetNelement() * sizeof(value_type));
+
+#ifdef SELDON_CHECK_IO
+    // Checks if data was read.
+    if (!stream.good())
+      throw IOError("PackedVector2::Read(istream& stream, bool with_size)",
+                    "Input operation failed.");
+#endif
+
+  }
+
+
+}
+
+
+#define SELDON_FILE_VECTOR_PACKED_VECTOR2_CXX
+#endif
@@ -0,0 +1,128 @@
+// Copyright (C) 2016 INRIA
+//
+// This file is part of the linear-algebra library Seldon,
+// http://seldon.sourceforge.net/.
+//
+// Seldon is free software; you can redistribute it and/or modify it under the
+// terms of the GNU Lesser General Public License as published by the Free
+// Software Foundation; either version 2.1 of the License, or (at your option)
+// any later version.
+//
+// Seldon is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for
+// more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with Seldon. If not, see http://www.gnu.org/licenses/.
+
+
+#ifndef SELDON_FILE_VECTOR_PACKED_VECTOR2_HXX
+
+
+namespace Seldon
+{
+
+
+  //! %Vector of vectors stored in a single array.
+  /*! PackedVector2 acts like a Vector2 whose inner vectors cannot be resized
+    individually. All the elements are stored contiguously in a single array,
+    and the inner vector #i is made of the elements in [offset(i),
+    offset(i+1)[ (as the rows of a RowSparse matrix). It avoids one
+    allocation per inner vector, and the flattened values are available
+    without any copy.
+    \tparam T numerical type of the inner vectors.
+    \tparam Allocator allocator for the array of values.
+  */
+  template <class T, class Allocator = SELDON_DEFAULT_ALLOCATOR<T> >
+  class PackedVector2
+  {
+  public:
+    typedef T value_type;
+    typedef T* pointer;
+    typedef const T* const_pointer;
+    typedef T& reference;
+    typedef const T& const_reference;
+
+  protected:
+    //! Offsets of the inner vectors in data_ (GetLength() + 1 elements).
+    Vector<size_t> offset_;
+    //! Values of all the inner vectors.
+    Vector<T, VectFull, Allocator> data_;
+
+  public:
+
+    /*** Constructors and destructor ***/
+
+    PackedVector2();
+    PackedVector2(const Vector<size_t>& length);
+    ~PackedVector2();
+
+    /*** Management of the vectors ***/
+
+    bool IsEmpty() const;
+    size_t GetLength() const;
+    size_t GetSize() const;
+    size_t GetLength(size_t i) const;
+    size_t GetSize(size_t i) const;
+    int64_t GetMemorySize() const;
+    size_t GetNelement() const;
+    size_t GetNelement(size_t beg, size_t end) const;
+    Vector<size_t> GetShape() const;
+    void GetShape(Vector<size_t>& shape) const;
+    void Reallocate(const Vector<size_t>& length);
+    template <class Builder>
+    void Build(size_t n, Builder& builder);
+    void Select(size_t beg, size_t end);
+    Vector<T, VectFull, Allocator> Flatten() const;
+    template <class Td, class Allocatord>
+    void Flatten(Vector<Td, VectFull, Allocatord>& data) const;
+    template <class Td, class Allocatord>
+    void Flatten(size_t beg, size_t end, Vector<Td, VectFull, Allocatord>& data)
+      const;
+    void FlattenView(Vector<T, VectFull, Allocator>& data);
+
+    template <class Allocator0>
+    void PushBack(const Vector<T, VectFull, Allocator0>& X);
+
+    void Clear();
+
+    void Fill(const T& x);
+
+    const Vector<size_t>& GetOffset() const;
+    pointer GetData(size_t i);
+#ifndef SWIG
+    const_pointer GetData(size_t i) const;
+#endif
+    void GetVector(size_t i, Vector<T, VectFull, Allocator>& V);
+
+    template <class V2>
+    void Copy(const V2& V);
+
+    /*** Element access and assignment ***/
+
+#ifndef SWIG
+    const_reference operator() (size_t i, size_t j) const;
+#endif
+    reference operator() (size_t i, size_t j);
+
+    /*** Convenient methods ***/
+
+    template <class V2>
+    bool HasSameShape(const V2& V) const;
+    void Print() const;
+
+    /*** Input/output functions ***/
+
+    void Write(string file_name, bool with_size = true) const;
+    void Write(ostream& file_stream, bool with_size = true) const;
+    void Read(string file_name, bool with_size = true);
+    void Read(istream& file_stream, bool with_size = true);
+  };
+
+
+}
+
+
+#define SELDON_FILE_VECTOR_PACKED_VECTOR2_HXX
+#endif
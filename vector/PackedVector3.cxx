@@ -0,0 +1,778 @@
+// Copyright (C) 2016 INRIA
+//
+// This file is part of the linear-algebra library Seldon,
+// http://seldon.sourceforge.net/.
+//
+// Seldon is free software; you can redistribute it and/or modify it under the
+// terms of the GNU Lesser General Public License as published by the Free
+// Software Foundation; either version 2.1 of the License, or (at your option)
+// any later version.
+//
+// Seldon is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for
+// more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with Seldon. If not, see http://www.gnu.org/licenses/.
+
+
+#ifndef SELDON_FILE_VECTOR_PACKED_VECTOR3_CXX
+
+
+#include "PackedVector3.hxx"
+
+
+namespace Seldon
+{
+
+
+  ///////////////////
+  // PACKEDVECTOR3 //
+  ///////////////////
+
+
+  /***************
+   * CONSTRUCTOR *
+   ***************/
+
+
+  //! Default constructor.
+  /*!
+    Nothing is allocated.
+  */
+  template <class T, class Allocator>
+  PackedVector3<T, Allocator>::PackedVector3()
+  {
+    Clear();
+  }
+
+
+  //! Constructor.
+  /*! The inner vectors are allocated (in a single array).
+    \param[in] length the lengths of the inner vectors: length(i)(j) is the
+    length of the inner vector #j of the element #i.
+  */
+  template <class T, class Allocator>
+  template <class Allocator0>
+  PackedVector3<T, Allocator>
+  ::PackedVector3(const Vector<Vector<size_t>, VectFull, Allocator0>& length)
+  {
+    Reallocate(length);
+  }
+
+
+  /**************
+   * DESTRUCTOR *
+   **************/
+
+
+  //! Destructor.
+  template <class T, class Allocator>
+  PackedVector3<T, Allocator>::~PackedVector3()
+  {
+  }
+
+
+  /*****************************
+   * MANAGEMENT OF THE VECTORS *
+   *****************************/
+
+
+  //! Returns the number of vectors of vectors.
+  template <class T, class Allocator>
+  size_t PackedVector3<T, Allocator>::GetLength() const
+  {
+    return vector_offset_.GetM() - 1;
+  }
+
+
+  //! Returns the number of vectors of vectors.
+  template <class T, class Allocator>
+  size_t PackedVector3<T, Allocator>::GetSize() const
+  {
+    return vector_offset_.GetM() - 1;
+  }
+
+
+  //! Returns the number of inner vectors of the element #\a i.
+  template <class T, class Allocator>
+  size_t PackedVector3<T, Allocator>::GetLength(size_t i) const
+  {
+    return vector_offset_(i+1) - vector_offset_(i);
+  }
+
+
+  //! Returns the number of inner vectors of the element #\a i.
+  template <class T, class Allocator>
+  size_t PackedVector3<T, Allocator>::GetSize(size_t i) const
+  {
+    return vector_offset_(i+1) - vector_offset_(i);
+  }
+
+
+  //! Returns the length of the inner vector #\a j of the element #\a i.
+  template <class T, class Allocator>
+  size_t PackedVector3<T, Allocator>::GetLength(size_t i, size_t j) const
+  {
+    size_t k = vector_offset_(i) + j;
+    return offset_(k+1) - offset_(k);
+  }
+
+
+  //! Returns the length of the inner vector #\a j of the element #\a i.
+  template <class T, class Allocator>
+  size_t PackedVector3<T, Allocator>::GetSize(size_t i, size_t j) const
+  {
+    return GetLength(i, j);
+  }
+
+
+  //! Returns the memory used by the object in bytes.
+  /*!
+    In this method, the type T is assumed to be "static"
+    such that sizeof(T) provides the correct size
+  */
+  template <class T, class Allocator>
+  int64_t PackedVector3<T, Allocator>::GetMemorySize() const
+  {
+    return sizeof(*this) + vector_offset_.GetMemorySize()
+      + offset_.GetMemorySize() + data_.GetMemorySize()
+      - sizeof(vector_offset_) - sizeof(offset_) - sizeof(data_);
+  }
+
+
+  //! Returns the total number of elements in the inner vectors.
+  template <class T, class Allocator>
+  size_t PackedVector3<T, Allocator>::GetNelement() const
+  {
+    return GetNelement(0, GetLength());
+  }
+
+
+  //! Returns the total number of elements in a range of vectors of vectors.
+  /*! Returns the total number of elements in the range [\a beg, \a end[ of
+    vectors of vectors.
+    \param[in] beg inclusive lower-bound for the indexes.
+    \param[in] end exclusive upper-bound for the indexes.
+  */
+  template <class T, class Allocator>
+  size_t PackedVector3<T, Allocator>
+  ::GetNelement(size_t beg, size_t end) const
+  {
+    if (beg > end)
+      throw WrongArgument("PackedVector3::GetNelement(size_t beg, size_t end)",
+                          "The lower bound of the range of inner vectors "
+                          "of vectors, [" + to_str(beg) + ", " + to_str(end)
+                          + "[, is strictly greater than its upper bound.");
+    if (end > GetLength())
+      throw WrongArgument("PackedVector3::GetNelement(size_t beg, size_t end)",
+			  "The inner-vector of vectors indexes should be in "
+			  "[0," + to_str(GetLength()) + "] but ["
+			  + to_str(beg) + ", " + to_str(end)
+			  + "[ was provided.");
+
+    return offset_(vector_offset_(end)) - offset_(vector_offset_(beg));
+  }
+
+
+  //! Returns the shape of the element #\a i.
+  /*!
+    \param[in] i index of the vector of vectors.
+    \return A vector with the lengths of the inner vectors of the element #\a
+    i.
+  */
+  template <class T, class Allocator>
+  Vector<size_t> PackedVector3<T, Allocator>::GetShape(size_t i) const
+  {
+    Vector<size_t> shape;
+    GetShape(i, shape);
+    return shape;
+  }
+
+
+  //! Returns the shape of the element #\a i.
+  /*!
+    \param[in] i index of the vector of vectors.
+    \param[out] shape the lengths of the inner vectors of the element #\a i.
+  */
+  template <class T, class Allocator>
+  void PackedVector3<T, Allocator>
+  ::GetShape(size_t i, Vector<size_t>& shape) const
+  {
+    shape.Reallocate(GetLength(i));
+    for (size_t j = 0; j < GetLength(i); j++)
+      shape(j) = GetLength(i, j);
+  }
+
+
+  //! Reallocates the whole structure.
+  /*!
+    \param[in] length the new lengths of the inner vectors: length(i)(j) is
+    the length of the inner vector #j of the element #i. Previous values are
+    lost.
+  */
+  template <class T, class Allocator>
+  template <class Allocator0>
+  void PackedVector3<T, Allocator>
+  ::Reallocate(const Vector<Vector<size_t>, VectFull, Allocator0>& length)
+  {
+    size_t m = length.GetM();
+    vector_offset_.Reallocate(m + 1);
+    vector_offset_(0) = 0;
+    for (size_t i = 0; i < m; i++)
+      vector_offset_(i+1) = vector_offset_(i) + length(i).GetM();
+
+    offset_.Reallocate(vector_offset_(m) + 1);
+    offset_(0) = 0;
+    size_t k = 0;
+    for (size_t i = 0; i < m; i++)
+      for (size_t j = 0; j < length(i).GetM(); j++, k++)
+        offset_(k+1) = offset_(k) + length(i)(j);
+
+    data_.Reallocate(offset_(k));
+  }
+
+
+  //! Constructs the structure with counting passes and a filling pass.
+  /*! The object \a builder must provide three methods:
+    <ul>
+    <li> size_t Count(size_t i), which returns the number of inner vectors of
+    the element #i, </li>
+    <li> size_t Count(size_t i, size_t j), which returns the length of the
+    inner vector #j of the element #i, </li>
+    <li> void Fill(size_t i, size_t j, T* x), which fills the Count(i, j)
+    elements of the inner vector #j of the element #i stored in \a x. </li>
+    </ul>
+    The passes are performed in parallel if OpenMP is enabled, so these
+    methods must be thread-safe.
+    \param[in] n number of vectors of vectors.
+    \param[in,out] builder object computing the inner vectors.
+  */
+  template <class T, class Allocator>
+  template <class Builder>
+  void PackedVector3<T, Allocator>::Build(size_t n, Builder& builder)
+  {
+    long nb = n;
+    vector_offset_.Reallocate(n + 1);
+    vector_offset_(0) = 0;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 256) \
+  num_threads(ParallelContext::GetNumThreads(nb, 256))
+#endif
+    for (long i = 0; i < nb; i++)
+      vector_offset_(i+1) = builder.Count(i);
+
+    for (size_t i = 0; i < n; i++)
+      vector_offset_(i+1) += vector_offset_(i);
+
+    offset_.Reallocate(vector_offset_(n) + 1);
+    offset_(0) = 0;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 256) \
+  num_threads(ParallelContext::GetNumThreads(nb, 256))
+#endif
+    for (long i = 0; i < nb; i++)
+      for (size_t k = vector_offset_(i); k < vector_offset_(i+1); k++)
+        offset_(k+1) = builder.Count(i, k - vector_offset_(i));
+
+    for (size_t k = 0; k < vector_offset_(n); k++)
+      offset_(k+1) += offset_(k);
+
+    data_.Reallocate(offset_(vector_offset_(n)));
+    T* data = data_.GetData();
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 256) \
+  num_threads(ParallelContext::GetNumThreads(nb, 256))
+#endif
+    for (long i = 0; i < nb; i++)
+      for (size_t k = vector_offset_(i); k < vector_offset_(i+1); k++)
+        builder.Fill(i, k - vector_offset_(i), data + offset_(k));
+  }
+
+
+  //! Selects a range of vectors of vectors.
+  /*! Only the vectors of vectors with index in [\a beg, \a end[ are
+    kept. The values and the offsets of the inner vectors are not copied: the
+    other vectors stay in memory until the next reallocation.
+    \param[in] beg inclusive lower-bound for the indexes.
+    \param[in] end exclusive upper-bound for the indexes.
+  */
+  template <class T, class Allocator>
+  void PackedVector3<T, Allocator>::Select(size_t beg, size_t end)
+  {
+    if (beg > end)
+      throw WrongArgument("PackedVector3::Select(size_t beg, size_t end)",
+                          "The lower bound of the range of inner vectors "
+                          "of vectors, [" + to_str(beg) + ", " + to_str(end)
+                          + "[, is strictly greater than its upper bound.");
+    if (end > GetLength())
+      throw WrongArgument("PackedVector3::Select(size_t beg, size_t end)",
+			  "The inner-vector of vectors indexes should be in "
+			  "[0," + to_str(GetLength()) + "] but ["
+			  + to_str(beg) + ", " + to_str(end)
+			  + "[ was provided.");
+
+    for (size_t i = 0; i <= end - beg; i++)
+      vector_offset_(i) = vector_offset_(beg + i);
+    vector_offset_.Resize(end - beg + 1);
+  }
+
+
+  //! Returns all values in a vector.
+  /*! The output vector \a data contains all inner vectors concatenated in the
+    same order as they appear in the current instance.
+    \param[out] data all values from the current instance.
+  */
+  template <class T, class Allocator>
+  template <class Td, class Allocatord>
+  void PackedVector3<T, Allocator>
+  ::Flatten(Vector<Td, VectFull, Allocatord>& data) const
+  {
+    Flatten(0, GetLength(), data);
+  }
+
+
+  //! Returns in a vector all values from a range of vectors of vectors.
+  /*! The output vector \a data contains all inner vectors, in the index range
+    [\a beg, \a end[, concatenated in the same order as they appear in the
+    current instance.
+    \param[in] beg inclusive lower-bound for the indexes.
+    \param[in] end exclusive upper-bound for the indexes.
+    \param[out] data the values contained in the inner vectors [\a beg, \a
+    end[.
+  */
+  template <class T, class Allocator>
+  template <class Td, class Allocatord>
+  void PackedVector3<T, Allocator>
+  ::Flatten(size_t beg, size_t end, Vector<Td, VectFull, Allocatord>& data)
+    const
+  {
+    data.Reallocate(GetNelement(beg, end));
+    const T* x = data_.GetData() + offset_(vector_offset_(beg));
+    for (size_t n = 0; n < data.GetM(); n++)
+      data(n) = x[n];
+  }
+
+
+  //! Returns all values in a vector, without copy.
+  /*! On exit, \a data shares its memory with the current instance: it is
+    valid until the current instance is reallocated, and data.Nullify() must
+    be called before \a data is destroyed or reallocated.
+    \param[out] data all values from the current instance.
+  */
+  template <class T, class Allocator>
+  void PackedVector3<T, Allocator>
+  ::FlattenView(Vector<T, VectFull, Allocator>& data)
+  {
+    data.Clear();
+    data.SetData(GetNelement(),
+                 data_.GetData() + offset_(vector_offset_(0)));
+  }
+
+
+  //! Appends a vector of vectors at the end of the instance.
+  /*! The arrays grow geometrically, so that successive calls to this method
+    have an amortized linear cost.
+    \param[in] X vector of vectors to be appended.
+  */
+  template <class T, class Allocator>
+  template <class Allocator0, class Allocator1>
+  void PackedVector3<T, Allocator>
+  ::PushBack(const Vector<Vector<T, VectFull, Allocator0>,
+             VectFull, Allocator1>& X)
+  {
+    size_t m = GetLength(), k = vector_offset_(m);
+    size_t nb_vect = k + X.GetM() + 1, n = offset_(k);
+    for (size_t j = 0; j < X.GetM(); j++)
+      n += X(j).GetM();
+
+    if (nb_vect > offset_.GetCapacity())
+      offset_.Reserve(max(size_t(2) * offset_.GetCapacity(), nb_vect));
+
+    if (nb_vect > offset_.GetM())
+      offset_.Resize(nb_vect);
+
+    if (n > data_.GetCapacity())
+      data_.Reserve(max(size_t(2) * data_.GetCapacity(), n));
+
+    if (n > data_.GetM())
+      data_.Resize(n);
+
+    for (size_t j = 0; j < X.GetM(); j++, k++)
+      {
+        offset_(k+1) = offset_(k) + X(j).GetM();
+        for (size_t l = 0; l < X(j).GetM(); l++)
+          data_(offset_(k) + l) = X(j)(l);
+      }
+
+    vector_offset_.PushBack(k);
+  }
+
+
+  //! Clears the instance.
+  /*! All inner vectors are removed and the memory is released.
+   */
+  template <class T, class Allocator>
+  void PackedVector3<T, Allocator>::Clear()
+  {
+    data_.Clear();
+    vector_offset_.Reallocate(1);
+    vector_offset_(0) = 0;
+    offset_.Reallocate(1);
+    offset_(0) = 0;
+  }
+
+
+  //! Fills the instance with a given value.
+  /*!
+    \param[in] x value to fill the instance with.
+  */
+  template <class T, class Allocator>
+  void PackedVector3<T, Allocator>::Fill(const T& x)
+  {
+    T* data = data_.GetData();
+    for (size_t n = offset_(vector_offset_(0));
+         n < offset_(vector_offset_(GetLength())); n++)
+      data[n] = x;
+  }
+
+
+  //! Returns the indexes of the first inner vectors.
+  /*! The inner vectors of the element #i are the vectors in
+    [vector_offset(i), vector_offset(i+1)[.
+    \return The indexes of the first inner vectors (GetLength() + 1
+    elements).
+  */
+  template <class T, class Allocator>
+  const Vector<size_t>& PackedVector3<T, Allocator>::GetVectorOffset() const
+  {
+    return vector_offset_;
+  }
+
+
+  //! Returns the offsets of the inner vectors.
+  /*! The inner vector #k is made of the elements in [offset(k),
+    offset(k+1)[ of the array of values, whose first element is GetData(0,
+    0) - offset(vector_offset(0)).
+    \return The offsets of the inner vectors.
+  */
+  template <class T, class Allocator>
+  const Vector<size_t>& PackedVector3<T, Allocator>::GetOffset() const
+  {
+    return offset_;
+  }
+
+
+  //! Returns a pointer to the inner vector #\a j of the element #\a i.
+  template <class T, class Allocator>
+  typename PackedVector3<T, Allocator>::pointer
+  PackedVector3<T, Allocator>::GetData(size_t i, size_t j)
+  {
+    return data_.GetData() + offset_(vector_offset_(i) + j);
+  }
+
+
+  //! Returns a pointer to the inner vector #\a j of the element #\a i.
+  template <class T, class Allocator>
+  typename PackedVector3<T, Allocator>::const_pointer
+  PackedVector3<T, Allocator>::GetData(size_t i, size_t j) const
+  {
+    return data_.GetData() + offset_(vector_offset_(i) + j);
+  }
+
+
+  //! Returns the inner vector #\a j of the element #\a i, without copy.
+  /*! On exit, \a V shares its memory with the current instance: it is valid
+    until the current instance is reallocated, and V.Nullify() must be called
+    before \a V is destroyed or reallocated.
+    \param[in] i index of the vector of vectors.
+    \param[in] j index of the inner vector.
+    \param[out] V the inner vector #\a j of the element #\a i.
+  */
+  template <class T, class Allocator>
+  void PackedVector3<T, Allocator>
+  ::GetVector(size_t i, size_t j, Vector<T, VectFull, Allocator>& V)
+  {
+    V.Clear();
+    V.SetData(GetLength(i, j), GetData(i, j));
+  }
+
+
+  //! Copies a vector of vectors of vectors.
+  /*!
+    \param[in] V vector of vectors of vectors to be copied (Vector3 or
+    PackedVector3).
+  */
+  template <class T, class Allocator>
+  template <class V3>
+  void PackedVector3<T, Allocator>::Copy(const V3& V)
+  {
+    Vector<Vector<size_t>, VectFull, NewAlloc<Vector<size_t> > >
+      length(V.GetLength());
+    for (size_t i = 0; i < V.GetLength(); i++)
+      V.GetShape(i, length(i));
+
+    Reallocate(length);
+    for (size_t i = 0; i < V.GetLength(); i++)
+      for (size_t j = 0; j < V.GetLength(i); j++)
+        {
+          T* x = GetData(i, j);
+          for (size_t k = 0; k < V.GetLength(i, j); k++)
+            x[k] = V(i, j, k);
+        }
+  }
+
+
+  /*********************************
+   * ELEMENT ACCESS AND ASSIGNMENT *
+   *********************************/
+
+
+  //! Returns the element #\a k of the inner vector #\a j of the element #\a i.
+  template <class T, class Allocator>
+  typename PackedVector3<T, Allocator>::const_reference
+  PackedVector3<T, Allocator>::operator() (size_t i, size_t j, size_t k) const
+  {
+#ifdef SELDON_CHECK_BOUNDS
+    if (j >= GetLength(i))
+      throw WrongIndex("PackedVector3::operator()",
+                       string("Index along dimension #2 should be in [0, ")
+                       + to_str(GetLength(i)-1) + "], but is equal to "
+                       + to_str(j) + ".");
+    if (k >= GetLength(i, j))
+      throw WrongIndex("PackedVector3::operator()",
+                       string("Index along dimension #3 should be in [0, ")
+                       + to_str(GetLength(i, j)-1) + "], but is equal to "
+                       + to_str(k) + ".");
+#endif
+
+    return data_(offset_(vector_offset_(i) + j) + k);
+  }
+
+
+  //! Returns the element #\a k of the inner vector #\a j of the element #\a i.
+  template <class T, class Allocator>
+  typename PackedVector3<T, Allocator>::reference
+  PackedVector3<T, Allocator>::operator() (size_t i, size_t j, size_t k)
+  {
+#ifdef SELDON_CHECK_BOUNDS
+    if (j >= GetLength(i))
+      throw WrongIndex("PackedVector3::operator()",
+                       string("Index along dimension #2 should be in [0, ")
+                       + to_str(GetLength(i)-1) + "], but is equal to "
+                       + to_str(j) + ".");
+    if (k >= GetLength(i, j))
+      throw WrongIndex("PackedVector3::operator()",
+                       string("Index along dimension #3 should be in [0, ")
+                       + to_str(GetLength(i, j)-1) + "], but is equal to "
+                       + to_str(k) + ".");
+#endif
+
+    return data_(offset_(vector_offset_(i) + j) + k);
+  }
+
+
+  /**********************
+   * CONVENIENT METHODS *
+   **********************/
+
+
+  //! Displays the instance.
+  template <class T, class Allocator>
+  void PackedVector3<T, Allocator>::Print() const
+  {
+    for (size_t i = 0; i < GetLength(); i++)
+      for (size_t j = 0; j < GetLength(i); j++)
+        {
+          cout << "Vector " << i << ", " << j << ": ";
+          for (size_t k = 0; k < GetLength(i, j); k++)
+            cout << (*this)(i, j, k) << '\t';
+          cout << endl;
+        }
+  }
+
+
+  /**************************
+   * INPUT/OUTPUT FUNCTIONS *
+   **************************/
+
+
+  //! Writes the instance in a binary file.
+  /*!
+    The format is the same as for Vector3.
+    \param[in] file_name file name.
+    \param[in] with_size if set to 'false', the shape is not saved.
+  */
+  template <class T, class Allocator>
+  void PackedVector3<T, Allocator>
+  ::Write(string file_name, bool with_size) const
+  {
+    ofstream file_stream;
+    file_stream.open(file_name.c_str());
+
+#ifdef SELDON_CHECK_IO
+    // Checks if the file was opened.
+    if (!file_stream.is_open())
+      throw IOError("PackedVector3::Write(string file_name, bool with_size)",
+		    string("Unable to open file \"") + file_name + "\".");
+#endif
+
+    this->Write(file_stream, with_size);
+
+    file_stream.close();
+  }
+
+
+  //! Writes the instance in a stream in a binary format.
+  /*!
+    The format is the same as for Vector3: the number of vectors of vectors
+    is written first, then for each vector of vectors, the number of inner
+    vectors is written, followed by the length and the elements of each inner
+    vector.
+    \param[in,out] stream output stream.
+    \param[in] with_size if set to 'false', the shape is not saved.
+  */
+  template <class T, class Allocator>
+  void PackedVector3<T, Allocator>
+  ::Write(ostream& stream, bool with_size) const
+  {
+
+#ifdef SELDON_CHECK_IO
+    // Checks if the stream is ready.
+    if (!stream.good())
+      throw IOError("PackedVector3::Write(ostream& stream, bool with_size)",
+                    "The stream is not ready.");
+#endif
+
+    if (with_size)
+      {
+        size_t m = GetLength();
+        stream.write(reinterpret_cast<char*>(&m), sizeof(size_t));
+      }
+
+    for (size_t i = 0; i < GetLength(); i++)
+      {
+        if (with_size)
+          {
+            size_t m = GetLength(i);
+            stream.write(reinterpret_cast<char*>(&m), sizeof(size_t));
+          }
+        for (size_t j = 0; j < GetLength(i); j++)
+          {
+            size_t n = GetLength(i, j);
+            if (with_size)
+              stream.write(reinterpret_cast<char*>(&n), sizeof(size_t));
+
+            stream.write(reinterpret_cast<const char*>(GetData(i, j)),
+                         n * sizeof(value_type));
+          }
+      }
+
+#ifdef SELDON_CHECK_IO
+    // Checks if data was written.
+    if (!stream.good())
+      throw IOError("PackedVector3::Write(ostream& stream, bool with_size)",
+                    "Output operation failed.");
+#endif
+
+  }
+
+
+  //! Reads the instance from a file.
+  /*!
+    The format is the same as for Vector3.
+    \param[in] file_name file name.
+    \param[in] with_size if set to 'false', the shape is not available in the
+    file, the shape of the current instance is thus unchanged and the values
+    of the elements are directly read in the file.
+  */
+  template <class T, class Allocator>
+  void PackedVector3<T, Allocator>::Read(string file_name, bool with_size)
+  {
+    ifstream file_stream;
+    file_stream.open(file_name.c_str());
+
+#ifdef SELDON_CHECK_IO
+    // Checks if the file was opened.
+    if (!file_stream.is_open())
+      throw IOError("PackedVector3::Read(string file_name, bool with_size)",
+		    string("Unable to open file \"") + file_name + "\".");
+#endif
+
+    this->Read(file_stream, with_size);
+
+    file_stream.close();
+  }
+
+
+  //! Reads the instance from a stream.
+  /*!
+    The format is the same as for Vector3.
+    \param[in,out] stream input stream.
+    \param[in] with_size if set to 'false', the shape is not available in the
+    stream, the shape of the current instance is thus unchanged and the
+    values of the elements are directly read in the stream.
+  */
+  template <class T, class Allocator>
+  void PackedVector3<T, Allocator>::Read(istream& stream, bool with_size)
+  {
+
+#ifdef SELDON_CHECK_IO
+    // Checks if the stream is ready.
+    if (!stream.good())
+      throw IOError("PackedVector3::Read(istream& stream, bool with_size)",
+                    "The stream is not ready.");
+#endif
+
+    if (with_size)
+      {
+        size_t m, nb_vect, n, k = 0;
+        stream.read(reinterpret_cast<char*>(&m), sizeof(size_t));
+        Clear();
+        vector_offset_.Reallocate(m + 1);
+        vector_offset_(0) = 0;
+        for (size_t i = 0; i < m; i++)
+          {
+            stream.read(reinterpret_cast<char*>(&nb_vect), sizeof(size_t));
+            vector_offset_(i+1) = vector_offset_(i) + nb_vect;
+            if (vector_offset_(i+1) + 1 > offset_.GetCapacity())
+              offset_.Reserve(max(size_t(2) * offset_.GetCapacity(),
+                                  vector_offset_(i+1) + 1));
+
+            offset_.Resize(vector_offset_(i+1) + 1);
+            for (size_t j = 0; j < nb_vect; j++, k++)
+              {
+                stream.read(reinterpret_cast<char*>(&n), sizeof(size_t));
+                offset_(k+1) = offset_(k) + n;
+                if (offset_(k+1) > data_.GetCapacity())
+                  data_.Reserve(max(size_t(2) * data_.GetCapacity(),
+                                    offset_(k+1)));
+
+                data_.Resize(offset_(k+1));
+                stream.read(reinterpret_cast<char*>(data_.GetData()
+                                                    + offset_(k)),
+                            n * sizeof(value_type));
+              }
+          }
+      }
+    else
+      stream.read(reinterpret_cast<char*>(data_.GetData()
+                                          + offset_(vector_offset_(0))),
+                  GetNelement() * sizeof(value_type));
+
+#ifdef SELDON_CHECK_IO
+    // Checks if data was read.
+    if (!stream.good())
+      throw IOError("PackedVector3::Read(istream& stream, bool with_size)",
+                    "Input operation failed.");
+#endif
+
+  }
+
+
+}
+
+
+#define SELDON_FILE_VECTOR_PACKED_VECTOR3_CXX
+#endif
@@ -0,0 +1,133 @@
+// Copyright (C) 2016 INRIA
+//
+// This file is part of the linear-algebra library Seldon,
+// http://seldon.sourceforge.net/.
+//
+// Seldon is free software; you can redistribute it and/or modify it under the
+// terms of the GNU Lesser General Public License as published by the Free
+// Software Foundation; either version 2.1 of the License, or (at your option)
+// any later version.
+//
+// Seldon is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for
+// more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with Seldon. If not, see http://www.gnu.org/licenses/.
+
+
+#ifndef SELDON_FILE_VECTOR_PACKED_VECTOR3_HXX
+
+
+namespace Seldon
+{
+
+
+  //! %Vector of vectors of vectors stored in a single array.
+  /*! PackedVector3 acts like a Vector3 whose inner vectors cannot be resized
+    individually. The inner vectors are numbered consecutively: the inner
+    vectors of the element #i are the vectors in [vector_offset(i),
+    vector_offset(i+1)[, and the inner vector #k is made of the elements in
+    [offset(k), offset(k+1)[ of a single array of values.
+    \tparam T numerical type of the inner vectors.
+    \tparam Allocator allocator for the array of values.
+  */
+  template <class T, class Allocator = SELDON_DEFAULT_ALLOCATOR<T> >
+  class PackedVector3
+  {
+  public:
+    typedef T value_type;
+    typedef T* pointer;
+    typedef const T* const_pointer;
+    typedef T& reference;
+    typedef const T& const_reference;
+
+  protected:
+    //! Indexes of the first inner vectors (GetLength() + 1 elements).
+    Vector<size_t> vector_offset_;
+    //! Offsets of the inner vectors in data_.
+    Vector<size_t> offset_;
+    //! Values of all the inner vectors.
+    Vector<T, VectFull, Allocator> data_;
+
+  public:
+
+    /*** Constructors and destructor ***/
+
+    PackedVector3();
+    template <class Allocator0>
+    PackedVector3(const Vector<Vector<size_t>, VectFull, Allocator0>& length);
+    ~PackedVector3();
+
+    /*** Management of the vectors ***/
+
+    size_t GetLength() const;
+    size_t GetSize() const;
+    size_t GetLength(size_t i) const;
+    size_t GetSize(size_t i) const;
+    size_t GetLength(size_t i, size_t j) const;
+    size_t GetSize(size_t i, size_t j) const;
+    int64_t GetMemorySize() const;
+    size_t GetNelement() const;
+    size_t GetNelement(size_t beg, size_t end) const;
+    Vector<size_t> GetShape(size_t i) const;
+    void GetShape(size_t i, Vector<size_t>& shape) const;
+    template <class Allocator0>
+    void Reallocate(const Vector<Vector<size_t>, VectFull, Allocator0>&
+                    length);
+    template <class Builder>
+    void Build(size_t n, Builder& builder);
+    void Select(size_t beg, size_t end);
+
+    template <class Td, class Allocatord>
+    void Flatten(Vector<Td, VectFull, Allocatord>& data) const;
+    template <class Td, class Allocatord>
+    void Flatten(size_t beg, size_t end, Vector<Td, VectFull, Allocatord>& data)
+      const;
+    void FlattenView(Vector<T, VectFull, Allocator>& data);
+
+    template <class Allocator0, class Allocator1>
+    void PushBack(const Vector<Vector<T, VectFull, Allocator0>,
+                  VectFull, Allocator1>& X);
+
+    void Clear();
+
+    void Fill(const T& x);
+
+    const Vector<size_t>& GetVectorOffset() const;
+    const Vector<size_t>& GetOffset() const;
+    pointer GetData(size_t i, size_t j);
+#ifndef SWIG
+    const_pointer GetData(size_t i, size_t j) const;
+#endif
+    void GetVector(size_t i, size_t j, Vector<T, VectFull, Allocator>& V);
+
+    template <class V3>
+    void Copy(const V3& V);
+
+    /*** Element access and assignment ***/
+
+#ifndef SWIG
+    const_reference operator() (size_t i, size_t j, size_t k) const;
+#endif
+    reference operator() (size_t i, size_t j, size_t k);
+
+    /*** Convenient method ***/
+
+    void Print() const;
+
+    /*** Input/output functions ***/
+
+    void Write(string file_name, bool with_size = true) const;
+    void Write(ostream& file_stream, bool with_size = true) const;
+    void Read(string file_name, bool with_size = true);
+    void Read(istream& file_stream, bool with_size = true);
+  };
+
+
+}
+
+
+#define SELDON_FILE_VECTOR_PACKED_VECTOR3_HXX
+#endif
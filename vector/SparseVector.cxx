@@ -45,17 +45,18 @@ namespace Seldon
 #endif
 	if (this->data_ != NULL)
 	  {
-	    Allocator::deallocate(this->data_, this->m_);
+	    Allocator::deallocate(this->data_, this->capacity_);
 	    this->data_ = NULL;
 	  }
 
 	if (index_ != NULL)
 	  {
-	    AllocatorInt::deallocate(index_, this->m_);
+	    AllocatorInt::deallocate(index_, this->capacity_);
 	    index_ = NULL;
 	  }
 
 	this->m_ = 0;
+	this->capacity_ = 0;
 
 #ifdef SELDON_CHECK_MEMORY
       }
@@ -64,6 +65,7 @@ namespace Seldon
 	this->data_ = NULL;
 	index_ = NULL;
 	this->m_ = 0;
+	this->capacity_ = 0;
 	return;
       }
 #endif
@@ -87,6 +89,7 @@ namespace Seldon
       {
 
 	this->m_ = i;
+	this->capacity_ = i;
 
 #ifdef SELDON_CHECK_MEMORY
 	try
@@ -106,6 +109,7 @@ namespace Seldon
 	catch (...)
 	  {
 	    this->m_ = 0;
+	    this->capacity_ = 0;
 	    this->data_ = NULL;
 	    this->index_ = NULL;
 	    return;
@@ -113,6 +117,7 @@ namespace Seldon
 	if (this->data_ == NULL)
 	  {
 	    this->m_ = 0;
+	    this->capacity_ = 0;
 	    this->index_ = NULL;
 	    return;
 	  }
@@ -149,6 +154,13 @@ namespace Seldon
     if (n == this->m_)
       return;
 
+    // the allocated memory is large enough
+    if ((n > this->m_) && (n <= this->capacity_))
+      {
+	this->m_ = n;
+	return;
+      }
+
     Vector<T, VectFull, Allocator> new_value(n);
     Vector<size_t> new_index(n);
     size_t Nmin = min(this->m_, n);
@@ -162,6 +174,53 @@ namespace Seldon
   }
 
 
+  //! Allocates memory for at least n non-zero entries.
+  /*!
+    The non-zero entries are not modified. If \a n is greater than the
+    capacity, the arrays are reallocated such that \a n non-zero entries can
+    be stored without further reallocation.
+    \param n number of non-zero entries to be allocated.
+  */
+  template <class T, class Allocator>
+  void Vector<T, VectSparse, Allocator>::Reserve(size_t n)
+  {
+    if (n <= this->capacity_)
+      return;
+
+    size_t m = this->m_;
+    Vector<T, VectFull, Allocator> new_value(n);
+    Vector<size_t> new_index(n);
+    for (size_t i = 0; i < m; i++)
+      {
+	new_value(i) = this->data_[i];
+	new_index(i) = index_[i];
+      }
+
+    SetData(new_value, new_index);
+    this->m_ = m;
+  }
+
+
+  //! Releases the memory allocated beyond the number of non-zero entries.
+  template <class T, class Allocator>
+  void Vector<T, VectSparse, Allocator>::ShrinkToFit()
+  {
+    if (this->capacity_ == this->m_)
+      return;
+
+    size_t m = this->m_;
+    Vector<T, VectFull, Allocator> new_value(m);
+    Vector<size_t> new_index(m);
+    for (size_t i = 0; i < m; i++)
+      {
+	new_value(i) = this->data_[i];
+	new_index(i) = index_[i];
+      }
+
+    SetData(new_value, new_index);
+  }
+
+
   /*! \brief Changes the length of the vector and sets its data array (low
     level method). */
   /*!
@@ -185,6 +244,7 @@ namespace Seldon
     this->Clear();
 
     this->m_ = i;
+    this->capacity_ = i;
 
     this->data_ = data;
     this->index_ = index;
@@ -254,6 +314,7 @@ namespace Seldon
   {
     this->m_ = 0;
     this->data_ = NULL;
+    this->capacity_ = 0;
     this->index_ = NULL;
   }
 
@@ -518,10 +579,22 @@ namespace Seldon
   template <class T, class Allocator>
   void Vector<T, VectSparse, Allocator>::AddInteraction(size_t i, const T& val)
   {
-    // Searching for the position where the entry may be.
-    size_t pos = 0;
-    while (pos < this->m_ && index_[pos] < i)
-      pos++;
+    // Searching for the position where the entry may be (entries are
+    // usually appended at the end, otherwise a dichotomy is performed).
+    size_t pos = this->m_;
+    if (this->m_ > 0 && index_[this->m_-1] >= i)
+      {
+        size_t first = 0, last = this->m_;
+        while (first < last)
+          {
+            size_t mid = (first + last) / 2;
+            if (index_[mid] < i)
+              first = mid + 1;
+            else
+              last = mid;
+          }
+        pos = first;
+      }
 
     // If the entry already exists, adds 'val'.
     if (pos < this->m_ && index_[pos] == i)
@@ -532,7 +605,11 @@ namespace Seldon
 
     size_t k;
 
-    // If the entry does not exist, the vector is reallocated.
+    // If the entry does not exist, the vector is enlarged (the capacity is
+    // doubled if needed).
+    if (this->m_ == this->capacity_)
+      Reserve(max(size_t(2)*this->capacity_, size_t(4)));
+
     Resize(this->m_ + 1);
     
     for (k = this->m_-1; k > pos; k--)
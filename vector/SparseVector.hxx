@@ -51,6 +51,9 @@ namespace Seldon
     explicit Vector();
     explicit Vector(size_t i);
     Vector(const Vector<T, VectSparse, Allocator>& A);
+#ifdef SELDON_WITH_CPP11
+    Vector(Vector<T, VectSparse, Allocator>&& A) noexcept;
+#endif
 
     // Destructor.
     ~Vector();
@@ -61,6 +64,8 @@ namespace Seldon
     void ReallocateVector(size_t i);
     void Resize(size_t i);
     void ResizeVector(size_t i);
+    void Reserve(size_t n);
+    void ShrinkToFit();
     void SetData(size_t nz, T* data, size_t* index);
     template<class Allocator2>
     void SetData(Vector<T, VectFull, Allocator2>& data,
@@ -88,6 +93,10 @@ namespace Seldon
     const_reference Val(size_t i) const;
     Vector<T, VectSparse, Allocator>& operator= (const Vector<T, VectSparse,
 						 Allocator>& X);
+#ifdef SELDON_WITH_CPP11
+    Vector<T, VectSparse, Allocator>& operator= (Vector<T, VectSparse,
+						 Allocator>&& X) noexcept;
+#endif
 #endif
     void Copy(const Vector<T, VectSparse, Allocator>& X);
 
@@ -66,12 +66,14 @@ namespace Seldon
 	this->m_ = 0;
 	this->index_ = NULL;
 	this->data_ = NULL;
+	this->capacity_ = 0;
       }
 
     if (this->index_ == NULL)
       {
 	this->m_ = 0;
 	this->data_ = NULL;
+	this->capacity_ = 0;
       }
 
     if (this->data_ == NULL && i != 0)
@@ -98,6 +100,28 @@ namespace Seldon
   }
 
 
+#ifdef SELDON_WITH_CPP11
+  //! Move constructor.
+  /*! The arrays of \a V are taken over, no memory is allocated.
+    \param V vector to be moved. On exit, \a V is empty.
+  */
+  template <class T, class Allocator>
+  inline Vector<T, VectSparse, Allocator>::
+  Vector(Vector<T, VectSparse, Allocator>&& V) noexcept :
+    Vector<T, VectFull, Allocator>()
+  {
+    this->m_ = V.m_;
+    this->data_ = V.data_;
+    this->capacity_ = V.capacity_;
+    this->index_ = V.index_;
+    V.m_ = 0;
+    V.data_ = NULL;
+    V.capacity_ = 0;
+    V.index_ = NULL;
+  }
+#endif
+
+
   //! Vector reallocation.
   /*!
     The vector is resized.
@@ -216,6 +240,34 @@ namespace Seldon
   }
 
 
+#ifdef SELDON_WITH_CPP11
+  //! Move assignment.
+  /*!
+    The current arrays are released and the arrays of \a X are taken over.
+    \param X vector to be moved. On exit, \a X is empty.
+  */
+  template <class T, class Allocator>
+  inline Vector<T, VectSparse, Allocator>& Vector<T, VectSparse, Allocator>
+  ::operator= (Vector<T, VectSparse, Allocator>&& X) noexcept
+  {
+    if (this != &X)
+      {
+	this->Clear();
+	this->m_ = X.m_;
+	this->data_ = X.data_;
+	this->capacity_ = X.capacity_;
+	this->index_ = X.index_;
+	X.m_ = 0;
+	X.data_ = NULL;
+	X.capacity_ = 0;
+	X.index_ = NULL;
+      }
+
+    return *this;
+  }
+#endif
+
+
   /*******************
    * BASIC FUNCTIONS *
    *******************/
@@ -241,7 +293,8 @@ namespace Seldon
   template <class T, class Allocator>
   inline int64_t Vector<T, VectSparse, Allocator>::GetMemorySize() const
   {
-    return sizeof(*this) + int64_t(sizeof(T) + sizeof(size_t))*this->m_;
+    return sizeof(*this)
+      + int64_t(sizeof(T) + sizeof(size_t))*this->capacity_;
   }
   
 } // namespace Seldon.
@@ -0,0 +1,61 @@
+// Copyright (C) 2016 INRIA
+//
+// This file is part of the linear-algebra library Seldon,
+// http://seldon.sourceforge.net/.
+//
+// Seldon is free software; you can redistribute it and/or modify it under the
+// terms of the GNU Lesser General Public License as published by the Free
+// Software Foundation; either version 2.1 of the License, or (at your option)
+// any later version.
+//
+// Seldon is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for
+// more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with Seldon. If not, see http://www.gnu.org/licenses/.
+
+
+#ifndef SELDON_FILE_TINY_VECTOR_CXX
+
+
+#include "TinyVector.hxx"
+
+
+namespace Seldon
+{
+
+
+  ////////////////
+  // TINYVECTOR //
+  ////////////////
+
+
+  //! Displays the vector on the standard output.
+  template <class T, int m>
+  void TinyVector<T, m>::Print() const
+  {
+    for (int i = 0; i < m; i++)
+      cout << data_[i] << "\t";
+    cout << endl;
+  }
+
+
+  //! Writes the vector in a stream.
+  template<class T, int m>
+  ostream& operator << (ostream& out, const TinyVector<T, m>& x)
+  {
+    for (int i = 0; i < m - 1; i++)
+      out << x(i) << '\t';
+    if (m > 0)
+      out << x(m - 1);
+    return out;
+  }
+
+
+} // namespace Seldon.
+
+
+#define SELDON_FILE_TINY_VECTOR_CXX
+#endif
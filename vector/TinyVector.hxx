@@ -0,0 +1,110 @@
+// Copyright (C) 2016 INRIA
+//
+// This file is part of the linear-algebra library Seldon,
+// http://seldon.sourceforge.net/.
+//
+// Seldon is free software; you can redistribute it and/or modify it under the
+// terms of the GNU Lesser General Public License as published by the Free
+// Software Foundation; either version 2.1 of the License, or (at your option)
+// any later version.
+//
+// Seldon is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for
+// more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with Seldon. If not, see http://www.gnu.org/licenses/.
+
+
+#ifndef SELDON_FILE_TINY_VECTOR_HXX
+
+
+namespace Seldon
+{
+
+
+  //! Vector whose size is known at compilation time.
+  /*! TinyVector stores its \a m elements in a static array, so that it does
+    not require any dynamic allocation. The loops over the elements have a
+    fixed trip count and are unrolled by the compiler. It is intended for
+    small vectors (typically m <= 64), e.g. element vectors in finite
+    elements.
+  */
+  template <class T, int m>
+  class TinyVector
+  {
+  public:
+    typedef T value_type;
+    typedef T* pointer;
+    typedef const T* const_pointer;
+    typedef T& reference;
+    typedef const T& const_reference;
+
+  protected:
+    //! elements of the vector
+    T data_[m];
+
+  public:
+    TinyVector();
+    explicit TinyVector(const T& a);
+
+    int GetM() const;
+    int GetLength() const;
+    int GetSize() const;
+    pointer GetData();
+    const_pointer GetData() const;
+
+    reference operator() (int i);
+#ifndef SWIG
+    const_reference operator() (int i) const;
+#endif
+
+    void Zero();
+    void Fill();
+    template<class T0>
+    void Fill(const T0& x);
+    void FillRand();
+
+#ifndef SWIG
+    template<class T0>
+    TinyVector<T, m>& operator= (const T0& x);
+#endif
+    TinyVector<T, m>& operator+= (const TinyVector<T, m>& x);
+    TinyVector<T, m>& operator-= (const TinyVector<T, m>& x);
+    template<class T0>
+    TinyVector<T, m>& operator*= (const T0& alpha);
+
+    void Print() const;
+  };
+
+
+  template<class T0, class T, int m>
+  void Mlt(const T0& alpha, TinyVector<T, m>& x);
+
+  template<class T0, class T, int m>
+  void Add(const T0& alpha, const TinyVector<T, m>& x, TinyVector<T, m>& y);
+
+  template<class T, int m>
+  void Copy(const TinyVector<T, m>& x, TinyVector<T, m>& y);
+
+  template<class T, int m>
+  T DotProd(const TinyVector<T, m>& x, const TinyVector<T, m>& y);
+
+  template<class T, int m>
+  T DotProdConj(const TinyVector<T, m>& x, const TinyVector<T, m>& y);
+
+  template<class T, int m>
+  typename ClassComplexType<T>::Treal Norm2(const TinyVector<T, m>& x);
+
+#ifndef SWIG
+  template<class T, int m>
+  ostream& operator << (ostream& out, const TinyVector<T, m>& x);
+#endif
+
+
+} // namespace Seldon.
+
+
+#define SELDON_FILE_TINY_VECTOR_HXX
+#endif
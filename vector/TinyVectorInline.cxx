@@ -0,0 +1,284 @@
+// Copyright (C) 2016 INRIA
+//
+// This file is part of the linear-algebra library Seldon,
+// http://seldon.sourceforge.net/.
+//
+// Seldon is free software; you can redistribute it and/or modify it under the
+// terms of the GNU Lesser General Public License as published by the Free
+// Software Foundation; either version 2.1 of the License, or (at your option)
+// any later version.
+//
+// Seldon is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for
+// more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with Seldon. If not, see http://www.gnu.org/licenses/.
+
+
+#ifndef SELDON_FILE_TINY_VECTOR_INLINE_CXX
+
+
+#include "TinyVector.hxx"
+
+
+namespace Seldon
+{
+
+
+  ////////////////
+  // TINYVECTOR //
+  ////////////////
+
+
+  //! Default constructor.
+  /*!
+    \warning The elements are not initialized.
+  */
+  template <class T, int m>
+  inline TinyVector<T, m>::TinyVector()
+  {
+  }
+
+
+  //! Constructor filling the vector with a value.
+  /*!
+    \param[in] a value of all the elements.
+  */
+  template <class T, int m>
+  inline TinyVector<T, m>::TinyVector(const T& a)
+  {
+    for (int i = 0; i < m; i++)
+      data_[i] = a;
+  }
+
+
+  //! Returns the number of elements.
+  template <class T, int m>
+  inline int TinyVector<T, m>::GetM() const
+  {
+    return m;
+  }
+
+
+  //! Returns the number of elements.
+  template <class T, int m>
+  inline int TinyVector<T, m>::GetLength() const
+  {
+    return m;
+  }
+
+
+  //! Returns the number of elements.
+  template <class T, int m>
+  inline int TinyVector<T, m>::GetSize() const
+  {
+    return m;
+  }
+
+
+  //! Returns a pointer to the elements.
+  template <class T, int m>
+  inline typename TinyVector<T, m>::pointer TinyVector<T, m>::GetData()
+  {
+    return data_;
+  }
+
+
+  //! Returns a const pointer to the elements.
+  template <class T, int m>
+  inline typename TinyVector<T, m>::const_pointer
+  TinyVector<T, m>::GetData() const
+  {
+    return data_;
+  }
+
+
+  //! Access operator.
+  /*!
+    \param[in] i index.
+    \return The element \a i of the vector.
+  */
+  template <class T, int m>
+  inline typename TinyVector<T, m>::reference
+  TinyVector<T, m>::operator() (int i)
+  {
+
+#ifdef SELDON_CHECK_BOUNDS
+    CheckBounds(i, m, "TinyVector");
+#endif
+
+    return data_[i];
+  }
+
+
+  //! Access operator.
+  /*!
+    \param[in] i index.
+    \return The element \a i of the vector.
+  */
+  template <class T, int m>
+  inline typename TinyVector<T, m>::const_reference
+  TinyVector<T, m>::operator() (int i) const
+  {
+
+#ifdef SELDON_CHECK_BOUNDS
+    CheckBounds(i, m, "TinyVector");
+#endif
+
+    return data_[i];
+  }
+
+
+  //! Sets all elements to zero.
+  template <class T, int m>
+  inline void TinyVector<T, m>::Zero()
+  {
+    T zero;
+    SetComplexZero(zero);
+    for (int i = 0; i < m; i++)
+      data_[i] = zero;
+  }
+
+
+  //! Fills the vector with 0, 1, 2, ...
+  template <class T, int m>
+  inline void TinyVector<T, m>::Fill()
+  {
+    for (int i = 0; i < m; i++)
+      SetComplexReal(i, data_[i]);
+  }
+
+
+  //! Sets all elements to \a x.
+  template <class T, int m> template<class T0>
+  inline void TinyVector<T, m>::Fill(const T0& x)
+  {
+    T x_;
+    SetComplexReal(x, x_);
+    for (int i = 0; i < m; i++)
+      data_[i] = x_;
+  }
+
+
+  //! Fills the vector randomly.
+  template <class T, int m>
+  inline void TinyVector<T, m>::FillRand()
+  {
+#ifndef SELDON_WITHOUT_REINIT_RANDOM
+    srand(time(NULL));
+#endif
+    for (int i = 0; i < m; i++)
+      SetComplexReal(rand(), data_[i]);
+  }
+
+
+  //! Sets all elements to \a x.
+  template <class T, int m> template<class T0>
+  inline TinyVector<T, m>& TinyVector<T, m>::operator= (const T0& x)
+  {
+    Fill(x);
+    return *this;
+  }
+
+
+  //! Adds a vector to the current vector.
+  template <class T, int m>
+  inline TinyVector<T, m>&
+  TinyVector<T, m>::operator+= (const TinyVector<T, m>& x)
+  {
+    for (int i = 0; i < m; i++)
+      data_[i] += x.data_[i];
+    return *this;
+  }
+
+
+  //! Subtracts a vector from the current vector.
+  template <class T, int m>
+  inline TinyVector<T, m>&
+  TinyVector<T, m>::operator-= (const TinyVector<T, m>& x)
+  {
+    for (int i = 0; i < m; i++)
+      data_[i] -= x.data_[i];
+    return *this;
+  }
+
+
+  //! Multiplies the vector by a scalar.
+  template <class T, int m> template<class T0>
+  inline TinyVector<T, m>& TinyVector<T, m>::operator*= (const T0& alpha)
+  {
+    for (int i = 0; i < m; i++)
+      data_[i] *= alpha;
+    return *this;
+  }
+
+
+  //! x = alpha x
+  template<class T0, class T, int m>
+  inline void Mlt(const T0& alpha, TinyVector<T, m>& x)
+  {
+    x *= alpha;
+  }
+
+
+  //! y = y + alpha x
+  template<class T0, class T, int m>
+  inline void Add(const T0& alpha, const TinyVector<T, m>& x,
+		  TinyVector<T, m>& y)
+  {
+    for (int i = 0; i < m; i++)
+      y(i) += alpha*x(i);
+  }
+
+
+  //! y = x
+  template<class T, int m>
+  inline void Copy(const TinyVector<T, m>& x, TinyVector<T, m>& y)
+  {
+    for (int i = 0; i < m; i++)
+      y(i) = x(i);
+  }
+
+
+  //! Returns the scalar product x^T y.
+  template<class T, int m>
+  inline T DotProd(const TinyVector<T, m>& x, const TinyVector<T, m>& y)
+  {
+    T s;
+    SetComplexZero(s);
+    for (int i = 0; i < m; i++)
+      s += x(i)*y(i);
+    return s;
+  }
+
+
+  //! Returns the scalar product x^H y.
+  template<class T, int m>
+  inline T DotProdConj(const TinyVector<T, m>& x, const TinyVector<T, m>& y)
+  {
+    T s;
+    SetComplexZero(s);
+    for (int i = 0; i < m; i++)
+      s += conjugate(x(i))*y(i);
+    return s;
+  }
+
+
+  //! Returns the euclidian norm of x.
+  template<class T, int m>
+  inline typename ClassComplexType<T>::Treal Norm2(const TinyVector<T, m>& x)
+  {
+    typename ClassComplexType<T>::Treal s(0);
+    for (int i = 0; i < m; i++)
+      s += absSquare(x(i));
+    return sqrt(s);
+  }
+
+
+} // namespace Seldon.
+
+
+#define SELDON_FILE_TINY_VECTOR_INLINE_CXX
+#endif
@@ -50,6 +50,13 @@ namespace Seldon
     if (n == this->m_)
       return;
 
+    // the allocated memory is large enough
+    if ((n > this->m_) && (n <= this->capacity_))
+      {
+	this->m_ = n;
+	return;
+      }
+
     Vector<T, VectFull, Allocator> X_new(n);
     for (size_t i = 0; i < min(this->m_, n); i++)
       X_new(i) = this->data_[i];
@@ -57,6 +64,60 @@ namespace Seldon
     SetData(n, X_new.GetData());
     X_new.Nullify();
   }
+
+
+  //! Allocates memory for at least n elements.
+  /*!
+    The length of the vector and its values are not modified. If \a n is
+    greater than the capacity, the data array is reallocated such that the
+    vector can grow up to \a n elements without further reallocation.
+    \param n number of elements to be allocated.
+  */
+  template <class T, class Allocator>
+  void Vector<T, VectFull, Allocator>::Reserve(size_t n)
+  {
+    if (n <= this->capacity_)
+      return;
+
+    size_t m = this->m_;
+    Vector<T, VectFull, Allocator> X_new(n);
+#ifdef SELDON_WITH_CPP11
+    for (size_t i = 0; i < m; i++)
+      X_new(i) = std::move(this->data_[i]);
+#else
+    for (size_t i = 0; i < m; i++)
+      X_new(i) = this->data_[i];
+#endif
+
+    SetData(n, X_new.GetData());
+    X_new.Nullify();
+    this->m_ = m;
+  }
+
+
+  //! Releases the memory allocated beyond the length of the vector.
+  /*!
+    On exit, the capacity is equal to the length of the vector.
+  */
+  template <class T, class Allocator>
+  void Vector<T, VectFull, Allocator>::ShrinkToFit()
+  {
+    if (this->capacity_ == this->m_)
+      return;
+
+    size_t m = this->m_;
+    Vector<T, VectFull, Allocator> X_new(m);
+#ifdef SELDON_WITH_CPP11
+    for (size_t i = 0; i < m; i++)
+      X_new(i) = std::move(this->data_[i]);
+#else
+    for (size_t i = 0; i < m; i++)
+      X_new(i) = this->data_[i];
+#endif
+
+    SetData(m, X_new.GetData());
+    X_new.Nullify();
+  }
   
   
   /*********
@@ -53,6 +53,8 @@ namespace Seldon
     size_t m_;
     // Pointer to stored elements.
     pointer data_;
+    // Number of elements allocated in data_ (greater or equal to m_).
+    size_t capacity_;
 
     // Methods.
   public:
@@ -69,6 +71,7 @@ namespace Seldon
     size_t GetM() const;
     size_t GetLength() const;
     size_t GetSize() const;
+    size_t GetCapacity() const;
     int64_t GetMemorySize() const;
     pointer GetData() const;
     const_pointer GetDataConst() const;
@@ -105,6 +108,9 @@ namespace Seldon
     explicit Vector(size_t i);
     Vector(size_t i, pointer data);
     Vector(const Vector<T, VectFull, Allocator>& A);
+#ifdef SELDON_WITH_CPP11
+    Vector(Vector<T, VectFull, Allocator>&& A) noexcept;
+#endif
 
     // Destructor.
     ~Vector();
@@ -115,6 +121,8 @@ namespace Seldon
     void ReallocateVector(size_t i);
     void Resize(size_t i);
     void ResizeVector(size_t i);
+    void Reserve(size_t n);
+    void ShrinkToFit();
     void SetData(size_t i, pointer data);
     template <class Allocator0>
     void SetData(const Vector<T, VectFull, Allocator0>& V);
@@ -128,6 +136,10 @@ namespace Seldon
     const_reference Get(size_t i) const;
     Vector<T, VectFull, Allocator>& operator= (const Vector<T, VectFull,
 					       Allocator>& X);
+#ifdef SELDON_WITH_CPP11
+    Vector<T, VectFull, Allocator>& operator= (Vector<T, VectFull,
+					       Allocator>&& X) noexcept;
+#endif
 #endif
     void Copy(const Vector<T, VectFull, Allocator>& X);
     Vector<T, VectFull, Allocator> Copy() const;
@@ -153,6 +165,16 @@ namespace Seldon
     Vector<T, VectFull, Allocator>& operator*= (const T0& X);
     Vector<T, VectFull, Allocator>& operator+= (const Vector<T, VectFull,
 						Allocator>& rhs);
+#ifndef SWIG
+    template <class E>
+    Vector<T, VectFull, Allocator>& operator= (const VectorExpression<T, E>& X);
+    template <class E>
+    Vector<T, VectFull, Allocator>&
+    operator+= (const VectorExpression<T, E>& X);
+    template <class E>
+    Vector<T, VectFull, Allocator>&
+    operator-= (const VectorExpression<T, E>& X);
+#endif
     void FillRand();
     void Print() const;
 
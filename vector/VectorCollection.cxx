@@ -253,6 +253,36 @@ namespace Seldon
   }
 
 
+#ifdef SELDON_WITH_CPP11
+  //! Move assignment.
+  /*!
+    The current inner vectors are nullified, then the inner vectors of \a X
+    are taken over.
+    \param[in] X vector collection to be moved. On exit, \a X is empty.
+  */
+  template <class T, class Allocator >
+  Vector<T, Collection, Allocator>& Vector<T, Collection, Allocator>
+  ::operator= (Vector<T, Collection, Allocator>&& X) noexcept
+  {
+    if (this != &X)
+      {
+	Clear();
+	Nvector_ = X.Nvector_;
+	this->m_ = X.m_;
+	length_ = std::move(X.length_);
+	length_sum_ = std::move(X.length_sum_);
+	vector_ = std::move(X.vector_);
+	label_map_.swap(X.label_map_);
+	label_vector_.swap(X.label_vector_);
+	X.Nvector_ = 0;
+	X.m_ = 0;
+      }
+
+    return *this;
+  }
+#endif
+
+
   //! Duplicates a vector collection.
   /*!
     \param[in] X vector collection to be copied.
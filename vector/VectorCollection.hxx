@@ -81,6 +81,9 @@ namespace Seldon
     explicit Vector();
     explicit Vector(size_t i);
     Vector(const Vector<T, Collection, Allocator>& A);
+#ifdef SELDON_WITH_CPP11
+    Vector(Vector<T, Collection, Allocator>&& A) noexcept;
+#endif
 
     // Destructor.
     ~Vector();
@@ -126,6 +129,10 @@ namespace Seldon
     reference operator() (size_t i);
     Vector<T, Collection, Allocator>& operator=
     (const Vector<T, Collection, Allocator>& X);
+#ifdef SELDON_WITH_CPP11
+    Vector<T, Collection, Allocator>& operator=
+    (Vector<T, Collection, Allocator>&& X) noexcept;
+#endif
 
     void Copy(const Vector<T, Collection, Allocator>& X,
               bool duplicate_data = true);
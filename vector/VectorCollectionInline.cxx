@@ -79,6 +79,27 @@ namespace Seldon
   }
 
 
+#ifdef SELDON_WITH_CPP11
+  //! Move constructor.
+  /*! The inner vectors of \a V are taken over, nothing is duplicated.
+    \param[in] V vector collection to be moved. On exit, \a V is empty.
+  */
+  template <class T, class Allocator>
+  inline Vector<T, Collection, Allocator>::
+  Vector(Vector<T, Collection, Allocator>&& V) noexcept:
+    Vector_Base<T, Allocator>(), Nvector_(V.Nvector_),
+    length_(std::move(V.length_)), length_sum_(std::move(V.length_sum_)),
+    vector_(std::move(V.vector_))
+  {
+    this->m_ = V.m_;
+    label_map_.swap(V.label_map_);
+    label_vector_.swap(V.label_vector_);
+    V.m_ = 0;
+    V.Nvector_ = 0;
+  }
+#endif
+
+
   /*****************
    * BASIC METHODS *
    *****************/
@@ -0,0 +1,698 @@
+// Copyright (C) 2016 INRIA
+//
+// This file is part of the linear-algebra library Seldon,
+// http://seldon.sourceforge.net/.
+//
+// Seldon is free software; you can redistribute it and/or modify it under the
+// terms of the GNU Lesser General Public License as published by the Free
+// Software Foundation; either version 2.1 of the License, or (at your option)
+// any later version.
+//
+// Seldon is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for
+// more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with Seldon. If not, see http://www.gnu.org/licenses/.
+
+
+#ifndef SELDON_FILE_VECTOR_EXPRESSION_CXX
+
+
+#include "VectorExpression.hxx"
+
+
+namespace Seldon
+{
+
+
+  /////////////////
+  // EXPRESSIONS //
+  /////////////////
+
+
+  //! Constructor.
+  /*!
+    \param[in] x vector referenced by the expression. It must not be
+    reallocated while the expression is alive.
+  */
+  template<class T> template<class Allocator>
+  inline VectorLeafExpression<T>
+  ::VectorLeafExpression(const Vector<T, VectFull, Allocator>& x)
+  {
+    m_ = x.GetM();
+    data_ = x.GetData();
+  }
+
+
+  //! Returns the size of the expression.
+  template<class T>
+  inline size_t VectorLeafExpression<T>::GetM() const
+  {
+    return m_;
+  }
+
+
+  //! Returns the element i of the expression.
+  template<class T>
+  inline T VectorLeafExpression<T>::operator() (size_t i) const
+  {
+    return data_[i];
+  }
+
+
+  //! Constructor.
+  template<class T, class E1, class E2>
+  inline VectorSumExpression<T, E1, E2>
+  ::VectorSumExpression(const E1& u, const E2& v)
+    : u_(u), v_(v)
+  {
+
+#ifdef SELDON_CHECK_DIMENSIONS
+    if (u.GetM() != v.GetM())
+      throw WrongDim("operator + (VectorExpression, VectorExpression)",
+		     "The expressions have different sizes: "
+		     + to_str(u.GetM()) + " and " + to_str(v.GetM()) + ".");
+#endif
+
+  }
+
+
+  //! Returns the size of the expression.
+  template<class T, class E1, class E2>
+  inline size_t VectorSumExpression<T, E1, E2>::GetM() const
+  {
+    return u_.GetM();
+  }
+
+
+  //! Returns the element i of the expression.
+  template<class T, class E1, class E2>
+  inline T VectorSumExpression<T, E1, E2>::operator() (size_t i) const
+  {
+    return u_(i) + v_(i);
+  }
+
+
+  //! Constructor.
+  template<class T, class E1, class E2>
+  inline VectorDiffExpression<T, E1, E2>
+  ::VectorDiffExpression(const E1& u, const E2& v)
+    : u_(u), v_(v)
+  {
+
+#ifdef SELDON_CHECK_DIMENSIONS
+    if (u.GetM() != v.GetM())
+      throw WrongDim("operator - (VectorExpression, VectorExpression)",
+		     "The expressions have different sizes: "
+		     + to_str(u.GetM()) + " and " + to_str(v.GetM()) + ".");
+#endif
+
+  }
+
+
+  //! Returns the size of the expression.
+  template<class T, class E1, class E2>
+  inline size_t VectorDiffExpression<T, E1, E2>::GetM() const
+  {
+    return u_.GetM();
+  }
+
+
+  //! Returns the element i of the expression.
+  template<class T, class E1, class E2>
+  inline T VectorDiffExpression<T, E1, E2>::operator() (size_t i) const
+  {
+    return u_(i) - v_(i);
+  }
+
+
+  //! Constructor.
+  template<class T, class T0, class E>
+  inline VectorScaledExpression<T, T0, E>
+  ::VectorScaledExpression(const T0& alpha, const E& u)
+    : alpha_(alpha), u_(u)
+  {
+  }
+
+
+  //! Returns the size of the expression.
+  template<class T, class T0, class E>
+  inline size_t VectorScaledExpression<T, T0, E>::GetM() const
+  {
+    return u_.GetM();
+  }
+
+
+  //! Returns the element i of the expression.
+  template<class T, class T0, class E>
+  inline T VectorScaledExpression<T, T0, E>::operator() (size_t i) const
+  {
+    return alpha_ * u_(i);
+  }
+
+
+  //! Constructor.
+  template<class T, class E>
+  inline VectorOppositeExpression<T, E>::VectorOppositeExpression(const E& u)
+    : u_(u)
+  {
+  }
+
+
+  //! Returns the size of the expression.
+  template<class T, class E>
+  inline size_t VectorOppositeExpression<T, E>::GetM() const
+  {
+    return u_.GetM();
+  }
+
+
+  //! Returns the element i of the expression.
+  template<class T, class E>
+  inline T VectorOppositeExpression<T, E>::operator() (size_t i) const
+  {
+    return -u_(i);
+  }
+
+
+  //! Constructor.
+  template<class T, class E>
+  inline VectorExpression<T, E>::VectorExpression(const E& expr)
+    : expr_(expr)
+  {
+  }
+
+
+  //! Returns the node of the expression.
+  template<class T, class E>
+  inline const E& VectorExpression<T, E>::GetExpression() const
+  {
+    return expr_;
+  }
+
+
+  //! Returns the size of the expression.
+  template<class T, class E>
+  inline size_t VectorExpression<T, E>::GetM() const
+  {
+    return expr_.GetM();
+  }
+
+
+  //! Returns the size of the expression.
+  template<class T, class E>
+  inline size_t VectorExpression<T, E>::GetSize() const
+  {
+    return expr_.GetM();
+  }
+
+
+  //! Returns the element i of the expression.
+  template<class T, class E>
+  inline T VectorExpression<T, E>::operator() (size_t i) const
+  {
+    return expr_(i);
+  }
+
+
+  //! Returns an expression referencing a vector.
+  template<class T, class Allocator>
+  inline VectorExpression<T, VectorLeafExpression<T> >
+  MakeExpression(const Vector<T, VectFull, Allocator>& x)
+  {
+    return VectorExpression<T, VectorLeafExpression<T> >
+      (VectorLeafExpression<T>(x));
+  }
+
+
+  /////////////
+  // SUM (+) //
+
+
+  //! Returns the expression u + v.
+  template<class T, class E1, class E2>
+  inline VectorExpression<T, VectorSumExpression<T, E1, E2> >
+  operator + (const VectorExpression<T, E1>& u,
+	      const VectorExpression<T, E2>& v)
+  {
+    return VectorExpression<T, VectorSumExpression<T, E1, E2> >
+      (VectorSumExpression<T, E1, E2>(u.GetExpression(), v.GetExpression()));
+  }
+
+
+  //! Returns the expression u + v.
+  template<class T, class Allocator, class E2>
+  inline
+  VectorExpression<T, VectorSumExpression<T, VectorLeafExpression<T>, E2> >
+  operator + (const Vector<T, VectFull, Allocator>& u,
+	      const VectorExpression<T, E2>& v)
+  {
+    return MakeExpression(u) + v;
+  }
+
+
+  //! Returns the expression u + v.
+  template<class T, class E1, class Allocator>
+  inline
+  VectorExpression<T, VectorSumExpression<T, E1, VectorLeafExpression<T> > >
+  operator + (const VectorExpression<T, E1>& u,
+	      const Vector<T, VectFull, Allocator>& v)
+  {
+    return u + MakeExpression(v);
+  }
+
+
+  //! Returns the expression u + v.
+  template<class T, class Allocator1, class Allocator2>
+  inline VectorExpression<T, VectorSumExpression<T, VectorLeafExpression<T>,
+						 VectorLeafExpression<T> > >
+  operator + (const Vector<T, VectFull, Allocator1>& u,
+	      const Vector<T, VectFull, Allocator2>& v)
+  {
+    return MakeExpression(u) + MakeExpression(v);
+  }
+
+
+  // SUM (+) //
+  /////////////
+
+
+  //////////////
+  // DIFF (-) //
+
+
+  //! Returns the expression u - v.
+  template<class T, class E1, class E2>
+  inline VectorExpression<T, VectorDiffExpression<T, E1, E2> >
+  operator - (const VectorExpression<T, E1>& u,
+	      const VectorExpression<T, E2>& v)
+  {
+    return VectorExpression<T, VectorDiffExpression<T, E1, E2> >
+      (VectorDiffExpression<T, E1, E2>(u.GetExpression(), v.GetExpression()));
+  }
+
+
+  //! Returns the expression u - v.
+  template<class T, class Allocator, class E2>
+  inline
+  VectorExpression<T, VectorDiffExpression<T, VectorLeafExpression<T>, E2> >
+  operator - (const Vector<T, VectFull, Allocator>& u,
+	      const VectorExpression<T, E2>& v)
+  {
+    return MakeExpression(u) - v;
+  }
+
+
+  //! Returns the expression u - v.
+  template<class T, class E1, class Allocator>
+  inline
+  VectorExpression<T, VectorDiffExpression<T, E1, VectorLeafExpression<T> > >
+  operator - (const VectorExpression<T, E1>& u,
+	      const Vector<T, VectFull, Allocator>& v)
+  {
+    return u - MakeExpression(v);
+  }
+
+
+  //! Returns the expression u - v.
+  template<class T, class Allocator1, class Allocator2>
+  inline VectorExpression<T, VectorDiffExpression<T, VectorLeafExpression<T>,
+						  VectorLeafExpression<T> > >
+  operator - (const Vector<T, VectFull, Allocator1>& u,
+	      const Vector<T, VectFull, Allocator2>& v)
+  {
+    return MakeExpression(u) - MakeExpression(v);
+  }
+
+
+  //! Returns the expression -u.
+  template<class T, class E>
+  inline VectorExpression<T, VectorOppositeExpression<T, E> >
+  operator - (const VectorExpression<T, E>& u)
+  {
+    return VectorExpression<T, VectorOppositeExpression<T, E> >
+      (VectorOppositeExpression<T, E>(u.GetExpression()));
+  }
+
+
+  //! Returns the expression -u.
+  template<class T, class Allocator>
+  inline
+  VectorExpression<T, VectorOppositeExpression<T, VectorLeafExpression<T> > >
+  operator - (const Vector<T, VectFull, Allocator>& u)
+  {
+    return -MakeExpression(u);
+  }
+
+
+  // DIFF (-) //
+  //////////////
+
+
+  ////////////////////
+  // SCALAR PRODUCT //
+
+
+  //! Returns the expression alpha u.
+  template<class T0, class T, class E>
+  inline VectorExpression<T, VectorScaledExpression<T, T0, E> >
+  operator * (const T0& alpha, const VectorExpression<T, E>& u)
+  {
+    return VectorExpression<T, VectorScaledExpression<T, T0, E> >
+      (VectorScaledExpression<T, T0, E>(alpha, u.GetExpression()));
+  }
+
+
+  //! Returns the expression u alpha.
+  template<class T0, class T, class E>
+  inline VectorExpression<T, VectorScaledExpression<T, T0, E> >
+  operator * (const VectorExpression<T, E>& u, const T0& alpha)
+  {
+    return alpha * u;
+  }
+
+
+  //! Returns the expression alpha u.
+  template<class T0, class T, class Allocator>
+  inline VectorExpression<T, VectorScaledExpression<T, T0,
+						    VectorLeafExpression<T> > >
+  operator * (const T0& alpha, const Vector<T, VectFull, Allocator>& u)
+  {
+    return alpha * MakeExpression(u);
+  }
+
+
+  //! Returns the expression u alpha.
+  template<class T0, class T, class Allocator>
+  inline VectorExpression<T, VectorScaledExpression<T, T0,
+						    VectorLeafExpression<T> > >
+  operator * (const Vector<T, VectFull, Allocator>& u, const T0& alpha)
+  {
+    return alpha * MakeExpression(u);
+  }
+
+
+  // SCALAR PRODUCT //
+  ////////////////////
+
+
+  ////////////////
+  // REDUCTIONS //
+
+
+  //! Returns the scalar product u.v, evaluated in a single loop.
+  template<class T, class E1, class E2>
+  T DotProd(const VectorExpression<T, E1>& u,
+	    const VectorExpression<T, E2>& v)
+  {
+
+#ifdef SELDON_CHECK_DIMENSIONS
+    if (u.GetM() != v.GetM())
+      throw WrongDim("DotProd(VectorExpression, VectorExpression)",
+		     "The expressions have different sizes.");
+#endif
+
+    const E1& u_ = u.GetExpression();
+    const E2& v_ = v.GetExpression();
+    T s;
+    SetComplexZero(s);
+    size_t m = u.GetM();
+    for (size_t i = 0; i < m; i++)
+      s += u_(i) * v_(i);
+
+    return s;
+  }
+
+
+  //! Returns the scalar product u.v, evaluated in a single loop.
+  template<class T, class Allocator, class E2>
+  inline T DotProd(const Vector<T, VectFull, Allocator>& u,
+		   const VectorExpression<T, E2>& v)
+  {
+    return DotProd(MakeExpression(u), v);
+  }
+
+
+  //! Returns the scalar product u.v, evaluated in a single loop.
+  template<class T, class E1, class Allocator>
+  inline T DotProd(const VectorExpression<T, E1>& u,
+		   const Vector<T, VectFull, Allocator>& v)
+  {
+    return DotProd(u, MakeExpression(v));
+  }
+
+
+  //! Returns the scalar product conj(u).v, evaluated in a single loop.
+  template<class T, class E1, class E2>
+  T DotProdConj(const VectorExpression<T, E1>& u,
+		const VectorExpression<T, E2>& v)
+  {
+
+#ifdef SELDON_CHECK_DIMENSIONS
+    if (u.GetM() != v.GetM())
+      throw WrongDim("DotProdConj(VectorExpression, VectorExpression)",
+		     "The expressions have different sizes.");
+#endif
+
+    const E1& u_ = u.GetExpression();
+    const E2& v_ = v.GetExpression();
+    T s;
+    SetComplexZero(s);
+    size_t m = u.GetM();
+    for (size_t i = 0; i < m; i++)
+      s += conjugate(u_(i)) * v_(i);
+
+    return s;
+  }
+
+
+  //! Returns the scalar product conj(u).v, evaluated in a single loop.
+  template<class T, class Allocator, class E2>
+  inline T DotProdConj(const Vector<T, VectFull, Allocator>& u,
+		       const VectorExpression<T, E2>& v)
+  {
+    return DotProdConj(MakeExpression(u), v);
+  }
+
+
+  //! Returns the scalar product conj(u).v, evaluated in a single loop.
+  template<class T, class E1, class Allocator>
+  inline T DotProdConj(const VectorExpression<T, E1>& u,
+		       const Vector<T, VectFull, Allocator>& v)
+  {
+    return DotProdConj(u, MakeExpression(v));
+  }
+
+
+  //! Returns the 1-norm of an expression, without temporary vector.
+  template<class T, class E>
+  typename ClassComplexType<T>::Treal
+  Norm1(const VectorExpression<T, E>& u)
+  {
+    const E& u_ = u.GetExpression();
+    typename ClassComplexType<T>::Treal s(0);
+    size_t m = u.GetM();
+    for (size_t i = 0; i < m; i++)
+      s += ComplexAbs(u_(i));
+
+    return s;
+  }
+
+
+  //! Returns the 2-norm of an expression, without temporary vector.
+  template<class T, class E>
+  typename ClassComplexType<T>::Treal
+  Norm2(const VectorExpression<T, E>& u)
+  {
+    const E& u_ = u.GetExpression();
+    typename ClassComplexType<T>::Treal s(0);
+    size_t m = u.GetM();
+    for (size_t i = 0; i < m; i++)
+      s += absSquare(u_(i));
+
+    return sqrt(s);
+  }
+
+
+  //! Evaluates an expression: Y = X.
+  template<class T, class E, class Allocator>
+  inline void Copy(const VectorExpression<T, E>& X,
+		   Vector<T, VectFull, Allocator>& Y)
+  {
+    Y = X;
+  }
+
+
+  //! Evaluates Y = X and returns the 2-norm of Y, in a single loop.
+  template<class T, class E, class Allocator>
+  typename ClassComplexType<T>::Treal
+  CopyNorm2(const VectorExpression<T, E>& X,
+	    Vector<T, VectFull, Allocator>& Y)
+  {
+    size_t m = X.GetM();
+    if (Y.GetM() != m)
+      Y.Reallocate(m);
+
+    const E& x = X.GetExpression();
+    T* y = Y.GetData();
+    typename ClassComplexType<T>::Treal s(0);
+    for (size_t i = 0; i < m; i++)
+      {
+	y[i] = x(i);
+	s += absSquare(y[i]);
+      }
+
+    return sqrt(s);
+  }
+
+
+  //! Evaluates Y = X and returns Y.Z, in a single loop.
+  template<class T, class E, class Allocator1, class Allocator2>
+  T CopyDotProd(const VectorExpression<T, E>& X,
+		Vector<T, VectFull, Allocator1>& Y,
+		const Vector<T, VectFull, Allocator2>& Z)
+  {
+
+#ifdef SELDON_CHECK_DIMENSIONS
+    if (X.GetM() != Z.GetM())
+      throw WrongDim("CopyDotProd(VectorExpression, Vector, Vector)",
+		     "The expression and Z have different sizes.");
+#endif
+
+    size_t m = X.GetM();
+    if (Y.GetM() != m)
+      Y.Reallocate(m);
+
+    const E& x = X.GetExpression();
+    T* y = Y.GetData();
+    const T* z = Z.GetData();
+    T s;
+    SetComplexZero(s);
+    for (size_t i = 0; i < m; i++)
+      {
+	y[i] = x(i);
+	s += y[i] * z[i];
+      }
+
+    return s;
+  }
+
+
+  //! Evaluates Y = X and returns conj(Y).Z, in a single loop.
+  template<class T, class E, class Allocator1, class Allocator2>
+  T CopyDotProdConj(const VectorExpression<T, E>& X,
+		    Vector<T, VectFull, Allocator1>& Y,
+		    const Vector<T, VectFull, Allocator2>& Z)
+  {
+
+#ifdef SELDON_CHECK_DIMENSIONS
+    if (X.GetM() != Z.GetM())
+      throw WrongDim("CopyDotProdConj(VectorExpression, Vector, Vector)",
+		     "The expression and Z have different sizes.");
+#endif
+
+    size_t m = X.GetM();
+    if (Y.GetM() != m)
+      Y.Reallocate(m);
+
+    const E& x = X.GetExpression();
+    T* y = Y.GetData();
+    const T* z = Z.GetData();
+    T s;
+    SetComplexZero(s);
+    for (size_t i = 0; i < m; i++)
+      {
+	y[i] = x(i);
+	s += conjugate(y[i]) * z[i];
+      }
+
+    return s;
+  }
+
+
+  // REDUCTIONS //
+  ////////////////
+
+
+  ///////////////////////
+  // VECTOR<VECT_FULL> //
+  ///////////////////////
+
+
+  //! Evaluates an expression in the current vector.
+  /*!
+    \param[in] X expression, evaluated element by element in a single loop.
+    The current vector may appear in the expression.
+  */
+  template <class T, class Allocator> template<class E>
+  inline Vector<T, VectFull, Allocator>& Vector<T, VectFull, Allocator>
+  ::operator= (const VectorExpression<T, E>& X)
+  {
+    size_t m = X.GetM();
+    if (this->m_ != m)
+      this->Reallocate(m);
+
+    const E& x = X.GetExpression();
+    T* y = this->data_;
+    for (size_t i = 0; i < m; i++)
+      y[i] = x(i);
+
+    return *this;
+  }
+
+
+  //! Adds an expression to the current vector.
+  /*!
+    \param[in] X expression, evaluated element by element in a single loop.
+  */
+  template <class T, class Allocator> template<class E>
+  inline Vector<T, VectFull, Allocator>& Vector<T, VectFull, Allocator>
+  ::operator+= (const VectorExpression<T, E>& X)
+  {
+
+#ifdef SELDON_CHECK_DIMENSIONS
+    if (X.GetM() != this->m_)
+      throw WrongDim("Vector<VectFull>::operator+=(VectorExpression)",
+		     "Inconsistent vector sizes.");
+#endif
+
+    const E& x = X.GetExpression();
+    T* y = this->data_;
+    for (size_t i = 0; i < this->m_; i++)
+      y[i] += x(i);
+
+    return *this;
+  }
+
+
+  //! Subtracts an expression from the current vector.
+  /*!
+    \param[in] X expression, evaluated element by element in a single loop.
+  */
+  template <class T, class Allocator> template<class E>
+  inline Vector<T, VectFull, Allocator>& Vector<T, VectFull, Allocator>
+  ::operator-= (const VectorExpression<T, E>& X)
+  {
+
+#ifdef SELDON_CHECK_DIMENSIONS
+    if (X.GetM() != this->m_)
+      throw WrongDim("Vector<VectFull>::operator-=(VectorExpression)",
+		     "Inconsistent vector sizes.");
+#endif
+
+    const E& x = X.GetExpression();
+    T* y = this->data_;
+    for (size_t i = 0; i < this->m_; i++)
+      y[i] -= x(i);
+
+    return *this;
+  }
+
+
+} // namespace Seldon.
+
+
+#define SELDON_FILE_VECTOR_EXPRESSION_CXX
+#endif
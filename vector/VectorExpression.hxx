@@ -0,0 +1,324 @@
+// Copyright (C) 2016 INRIA
+//
+// This file is part of the linear-algebra library Seldon,
+// http://seldon.sourceforge.net/.
+//
+// Seldon is free software; you can redistribute it and/or modify it under the
+// terms of the GNU Lesser General Public License as published by the Free
+// Software Foundation; either version 2.1 of the License, or (at your option)
+// any later version.
+//
+// Seldon is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for
+// more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with Seldon. If not, see http://www.gnu.org/licenses/.
+
+
+#ifndef SELDON_FILE_VECTOR_EXPRESSION_HXX
+
+/*
+  Expression templates for dense vectors (opt-in, include
+  "vector/VectorExpression.cxx").
+
+  An expression such as alpha*x + beta*y - gamma*z is not evaluated when it
+  is written but stored in a VectorExpression object. The evaluation is
+  performed element by element when the expression is assigned to a vector,
+  so that a single loop is executed and no temporary vector is allocated:
+
+  y = alpha*x + beta*y - gamma*z;
+  y += alpha*x;
+  y -= x - z;
+
+  Reductions are also available on expressions:
+
+  DotProd(X, Y)
+  DotProdConj(X, Y)
+  Norm1(X)
+  Norm2(X)
+
+  and reductions fused with the assignment (one pass over the data):
+
+  Y = X, return ||Y||
+  CopyNorm2(X, Y)
+
+  Y = X, return Y.Z
+  CopyDotProd(X, Y, Z)
+  CopyDotProdConj(X, Y, Z)
+*/
+
+namespace Seldon
+{
+
+
+  //! Leaf of an expression: a dense vector.
+  template<class T>
+  class VectorLeafExpression
+  {
+  protected:
+    //! size of the vector
+    size_t m_;
+    //! values of the vector
+    const T* data_;
+
+  public:
+    template<class Allocator>
+    VectorLeafExpression(const Vector<T, VectFull, Allocator>& x);
+
+    size_t GetM() const;
+    T operator() (size_t i) const;
+  };
+
+
+  //! Sum of two expressions.
+  template<class T, class E1, class E2>
+  class VectorSumExpression
+  {
+  protected:
+    E1 u_;
+    E2 v_;
+
+  public:
+    VectorSumExpression(const E1& u, const E2& v);
+
+    size_t GetM() const;
+    T operator() (size_t i) const;
+  };
+
+
+  //! Difference between two expressions.
+  template<class T, class E1, class E2>
+  class VectorDiffExpression
+  {
+  protected:
+    E1 u_;
+    E2 v_;
+
+  public:
+    VectorDiffExpression(const E1& u, const E2& v);
+
+    size_t GetM() const;
+    T operator() (size_t i) const;
+  };
+
+
+  //! Product of an expression by a scalar.
+  template<class T, class T0, class E>
+  class VectorScaledExpression
+  {
+  protected:
+    T0 alpha_;
+    E u_;
+
+  public:
+    VectorScaledExpression(const T0& alpha, const E& u);
+
+    size_t GetM() const;
+    T operator() (size_t i) const;
+  };
+
+
+  //! Opposite of an expression.
+  template<class T, class E>
+  class VectorOppositeExpression
+  {
+  protected:
+    E u_;
+
+  public:
+    VectorOppositeExpression(const E& u);
+
+    size_t GetM() const;
+    T operator() (size_t i) const;
+  };
+
+
+  //! Vector expression, evaluated element by element.
+  /*!
+    \tparam T type of the elements of the expression.
+    \tparam E node of the expression (VectorLeafExpression,
+    VectorSumExpression, ...).
+  */
+  template<class T, class E>
+  class VectorExpression
+  {
+  protected:
+    E expr_;
+
+  public:
+    explicit VectorExpression(const E& expr);
+
+    const E& GetExpression() const;
+    size_t GetM() const;
+    size_t GetSize() const;
+    T operator() (size_t i) const;
+  };
+
+
+  template<class T, class Allocator>
+  VectorExpression<T, VectorLeafExpression<T> >
+  MakeExpression(const Vector<T, VectFull, Allocator>& x);
+
+
+  /////////////
+  // SUM (+) //
+
+
+  template<class T, class E1, class E2>
+  VectorExpression<T, VectorSumExpression<T, E1, E2> >
+  operator + (const VectorExpression<T, E1>& u,
+	      const VectorExpression<T, E2>& v);
+
+  template<class T, class Allocator, class E2>
+  VectorExpression<T, VectorSumExpression<T, VectorLeafExpression<T>, E2> >
+  operator + (const Vector<T, VectFull, Allocator>& u,
+	      const VectorExpression<T, E2>& v);
+
+  template<class T, class E1, class Allocator>
+  VectorExpression<T, VectorSumExpression<T, E1, VectorLeafExpression<T> > >
+  operator + (const VectorExpression<T, E1>& u,
+	      const Vector<T, VectFull, Allocator>& v);
+
+  template<class T, class Allocator1, class Allocator2>
+  VectorExpression<T, VectorSumExpression<T, VectorLeafExpression<T>,
+					  VectorLeafExpression<T> > >
+  operator + (const Vector<T, VectFull, Allocator1>& u,
+	      const Vector<T, VectFull, Allocator2>& v);
+
+
+  // SUM (+) //
+  /////////////
+
+
+  //////////////
+  // DIFF (-) //
+
+
+  template<class T, class E1, class E2>
+  VectorExpression<T, VectorDiffExpression<T, E1, E2> >
+  operator - (const VectorExpression<T, E1>& u,
+	      const VectorExpression<T, E2>& v);
+
+  template<class T, class Allocator, class E2>
+  VectorExpression<T, VectorDiffExpression<T, VectorLeafExpression<T>, E2> >
+  operator - (const Vector<T, VectFull, Allocator>& u,
+	      const VectorExpression<T, E2>& v);
+
+  template<class T, class E1, class Allocator>
+  VectorExpression<T, VectorDiffExpression<T, E1, VectorLeafExpression<T> > >
+  operator - (const VectorExpression<T, E1>& u,
+	      const Vector<T, VectFull, Allocator>& v);
+
+  template<class T, class Allocator1, class Allocator2>
+  VectorExpression<T, VectorDiffExpression<T, VectorLeafExpression<T>,
+					   VectorLeafExpression<T> > >
+  operator - (const Vector<T, VectFull, Allocator1>& u,
+	      const Vector<T, VectFull, Allocator2>& v);
+
+  template<class T, class E>
+  VectorExpression<T, VectorOppositeExpression<T, E> >
+  operator - (const VectorExpression<T, E>& u);
+
+  template<class T, class Allocator>
+  VectorExpression<T, VectorOppositeExpression<T, VectorLeafExpression<T> > >
+  operator - (const Vector<T, VectFull, Allocator>& u);
+
+
+  // DIFF (-) //
+  //////////////
+
+
+  ////////////////////
+  // SCALAR PRODUCT //
+
+
+  template<class T0, class T, class E>
+  VectorExpression<T, VectorScaledExpression<T, T0, E> >
+  operator * (const T0& alpha, const VectorExpression<T, E>& u);
+
+  template<class T0, class T, class E>
+  VectorExpression<T, VectorScaledExpression<T, T0, E> >
+  operator * (const VectorExpression<T, E>& u, const T0& alpha);
+
+  template<class T0, class T, class Allocator>
+  VectorExpression<T, VectorScaledExpression<T, T0,
+					     VectorLeafExpression<T> > >
+  operator * (const T0& alpha, const Vector<T, VectFull, Allocator>& u);
+
+  template<class T0, class T, class Allocator>
+  VectorExpression<T, VectorScaledExpression<T, T0,
+					     VectorLeafExpression<T> > >
+  operator * (const Vector<T, VectFull, Allocator>& u, const T0& alpha);
+
+
+  // SCALAR PRODUCT //
+  ////////////////////
+
+
+  ////////////////
+  // REDUCTIONS //
+
+
+  template<class T, class E1, class E2>
+  T DotProd(const VectorExpression<T, E1>& u,
+	    const VectorExpression<T, E2>& v);
+
+  template<class T, class Allocator, class E2>
+  T DotProd(const Vector<T, VectFull, Allocator>& u,
+	    const VectorExpression<T, E2>& v);
+
+  template<class T, class E1, class Allocator>
+  T DotProd(const VectorExpression<T, E1>& u,
+	    const Vector<T, VectFull, Allocator>& v);
+
+  template<class T, class E1, class E2>
+  T DotProdConj(const VectorExpression<T, E1>& u,
+		const VectorExpression<T, E2>& v);
+
+  template<class T, class Allocator, class E2>
+  T DotProdConj(const Vector<T, VectFull, Allocator>& u,
+		const VectorExpression<T, E2>& v);
+
+  template<class T, class E1, class Allocator>
+  T DotProdConj(const VectorExpression<T, E1>& u,
+		const Vector<T, VectFull, Allocator>& v);
+
+  template<class T, class E>
+  typename ClassComplexType<T>::Treal
+  Norm1(const VectorExpression<T, E>& u);
+
+  template<class T, class E>
+  typename ClassComplexType<T>::Treal
+  Norm2(const VectorExpression<T, E>& u);
+
+  template<class T, class E, class Allocator>
+  void Copy(const VectorExpression<T, E>& X,
+	    Vector<T, VectFull, Allocator>& Y);
+
+  template<class T, class E, class Allocator>
+  typename ClassComplexType<T>::Treal
+  CopyNorm2(const VectorExpression<T, E>& X,
+	    Vector<T, VectFull, Allocator>& Y);
+
+  template<class T, class E, class Allocator1, class Allocator2>
+  T CopyDotProd(const VectorExpression<T, E>& X,
+		Vector<T, VectFull, Allocator1>& Y,
+		const Vector<T, VectFull, Allocator2>& Z);
+
+  template<class T, class E, class Allocator1, class Allocator2>
+  T CopyDotProdConj(const VectorExpression<T, E>& X,
+		    Vector<T, VectFull, Allocator1>& Y,
+		    const Vector<T, VectFull, Allocator2>& Z);
+
+
+  // REDUCTIONS //
+  ////////////////
+
+
+} // namespace Seldon.
+
+
+#define SELDON_FILE_VECTOR_EXPRESSION_HXX
+#endif
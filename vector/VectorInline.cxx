@@ -45,6 +45,7 @@ namespace Seldon
   {
     m_ = 0;
     data_ = NULL;
+    capacity_ = 0;
   }
 
 
@@ -58,6 +59,7 @@ namespace Seldon
   {
     m_ = i;
     data_ = NULL;
+    capacity_ = 0;
   }
 
 
@@ -72,6 +74,7 @@ namespace Seldon
   {
     m_ = A.GetM();
     data_ = NULL;
+    capacity_ = 0;
   }
 
 
@@ -100,9 +103,10 @@ namespace Seldon
 
 	if (data_ != NULL)
 	  {
-	    Allocator::deallocate(data_, m_);
+	    Allocator::deallocate(data_, capacity_);
 	    m_ = 0;
 	    data_ = NULL;
+	    capacity_ = 0;
 	  }
 
 #ifdef SELDON_CHECK_MEMORY
@@ -111,6 +115,7 @@ namespace Seldon
       {
 	m_ = 0;
 	data_ = NULL;
+	capacity_ = 0;
       }
 #endif
 
@@ -155,6 +160,18 @@ namespace Seldon
   }
 
 
+  //! Returns the number of elements allocated.
+  /*!
+    \return The number of elements that can be stored without reallocating
+    the data array. It is greater or equal to the length of the vector.
+  */
+  template <class T, class Allocator>
+  inline size_t Vector_Base<T, Allocator>::GetCapacity() const
+  {
+    return capacity_;
+  }
+
+
   //! Returns the memory used by the object in bytes.
   /*!
     In this method, the type T is assumed to be "static"
@@ -163,7 +180,7 @@ namespace Seldon
   template <class T, class Allocator>
   inline int64_t Vector_Base<T, Allocator>::GetMemorySize() const
   {
-    return sizeof(*this) + int64_t(sizeof(T))*GetSize();
+    return sizeof(*this) + int64_t(sizeof(T))*max(GetSize(), capacity_);
   }
 
   
@@ -250,6 +267,7 @@ namespace Seldon
 #endif
 
 	this->data_ = Allocator::allocate(i, this);
+	this->capacity_ = i;
 
 #ifdef SELDON_CHECK_MEMORY
       }
@@ -259,7 +277,10 @@ namespace Seldon
 	this->data_ = NULL;
       }
     if (this->data_ == NULL)
-      this->m_ = 0;
+      {
+	this->m_ = 0;
+	this->capacity_ = 0;
+      }
     if (this->data_ == NULL && i != 0)
       throw NoMemory("Vector<VectFull>::Vector(int)",
 		     string("Unable to allocate memory for a vector of size ")
@@ -306,6 +327,7 @@ namespace Seldon
 #endif
 
 	this->data_ = Allocator::allocate(V.GetM(), this);
+	this->capacity_ = V.GetM();
 
 #ifdef SELDON_CHECK_MEMORY
       }
@@ -315,7 +337,10 @@ namespace Seldon
 	this->data_ = NULL;
       }
     if (this->data_ == NULL)
-      this->m_ = 0;
+      {
+	this->m_ = 0;
+	this->capacity_ = 0;
+      }
     if (this->data_ == NULL && V.GetM() != 0)
       throw NoMemory("Vector<VectFull>::Vector(Vector<VectFull>&)",
 		     string("Unable to allocate memory for a vector of size ")
@@ -328,6 +353,26 @@ namespace Seldon
   }
 
 
+#ifdef SELDON_WITH_CPP11
+  //! Move constructor.
+  /*! The data array of \a V is taken over, no memory is allocated.
+    \param V vector to be moved. On exit, \a V is empty.
+  */
+  template <class T, class Allocator>
+  inline Vector<T, VectFull, Allocator>::
+  Vector(Vector<T, VectFull, Allocator>&& V) noexcept:
+    Vector_Base<T, Allocator>()
+  {
+    this->m_ = V.m_;
+    this->data_ = V.data_;
+    this->capacity_ = V.capacity_;
+    V.m_ = 0;
+    V.data_ = NULL;
+    V.capacity_ = 0;
+  }
+#endif
+
+
   /**************
    * DESTRUCTOR *
    **************/
@@ -387,6 +432,7 @@ namespace Seldon
       {
 
 	this->m_ = i;
+	this->capacity_ = i;
 
 #ifdef SELDON_CHECK_MEMORY
 	try
@@ -403,11 +449,13 @@ namespace Seldon
 	  {
 	    this->m_ = 0;
 	    this->data_ = NULL;
+	    this->capacity_ = 0;
 	    return;
 	  }
 	if (this->data_ == NULL)
 	  {
 	    this->m_ = 0;
+	    this->capacity_ = 0;
 	    return;
 	  }
 #endif
@@ -438,6 +486,7 @@ namespace Seldon
     this->Clear();
 
     this->m_ = i;
+    this->capacity_ = i;
 
     this->data_ = data;
   }
@@ -476,6 +525,7 @@ namespace Seldon
   {
     this->m_ = 0;
     this->data_ = NULL;
+    this->capacity_ = 0;
   }
 
 
@@ -571,6 +621,33 @@ namespace Seldon
   }
 
 
+#ifdef SELDON_WITH_CPP11
+  //! Move assignment.
+  /*!
+    The current data array is released and the data array of \a X is taken
+    over.
+    \param X vector to be moved. On exit, \a X is empty.
+  */
+  template <class T, class Allocator>
+  inline Vector<T, VectFull, Allocator>& Vector<T, VectFull, Allocator>
+  ::operator= (Vector<T, VectFull, Allocator>&& X) noexcept
+  {
+    if (this != &X)
+      {
+	this->Clear();
+	this->m_ = X.m_;
+	this->data_ = X.data_;
+	this->capacity_ = X.capacity_;
+	X.m_ = 0;
+	X.data_ = NULL;
+	X.capacity_ = 0;
+      }
+
+    return *this;
+  }
+#endif
+
+
   //! Duplicates a vector.
   /*!
     \param X vector to be copied.
@@ -641,26 +718,27 @@ namespace Seldon
   //! Appends an element to the vector.
   /*!
     \param x element to be appended.
-    \warning This method will only work if the allocator preserves the
-    elements while reallocating.
   */
   template <class T, class Allocator>
   inline void Vector<T, VectFull, Allocator>::Append(const T& x)
   {
-    size_t i = this->GetLength();
-    this->Reallocate(i + 1);
-    this->data_[i] = x;
+    PushBack(x);
   }
 
 
   //! Appends an element at the end of the vector.
   /*!
+    The capacity is doubled when the vector is full, so that appending n
+    elements costs O(n) operations.
     \param x element to be appended.
   */
   template <class T, class Allocator> template<class T0>
   inline void Vector<T, VectFull, Allocator>::PushBack(const T0& x)
   {
-    Resize(this->m_+1);
+    if (this->m_ == this->capacity_)
+      Reserve(max(size_t(2)*this->capacity_, size_t(4)));
+
+    this->m_++;
     this->data_[this->m_-1] = x;
   }
 
@@ -674,6 +752,9 @@ namespace Seldon
   ::PushBack(const Vector<T, VectFull, Allocator0>& X)
   {
     size_t Nold = this->m_;
+    if (this->m_ + X.GetM() > this->capacity_)
+      Reserve(max(size_t(2)*this->capacity_, this->m_ + X.GetM()));
+
     Resize(this->m_ + X.GetM());
     for (size_t i = 0; i < X.GetM(); i++)
       this->data_[Nold+i] = X(i);